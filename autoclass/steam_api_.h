@@ -2,6 +2,16 @@
 #define STEAM_FORWARDER_HEADER
 #include <steam_api.h>
 #include <config.h>
+#include <forwarder.h>
+#include <intern.h>
+#include <versions.h>
+#include <profiler.h>
+#include <forward.h>
+#include <capture.h>
+#include <netstats.h>
+#include <p2p.h>
+#include <sessions.h>
+#include <sockets.h>
 
 #include <wrap_isteamapplist.h>
 #include <wrap_isteamapps.h>
@@ -0,0 +1,1894 @@
+
+#include <lazy.h>
+#ifdef LAZY_STEAM_API
+LAZY_RESOLVER;
+LAZY_SYMBOL(0, SteamAPI_Init)
+LAZY_SYMBOL(1, SteamAPI_Shutdown)
+LAZY_SYMBOL(2, SteamAPI_RestartAppIfNecessary)
+LAZY_SYMBOL(3, SteamAPI_WriteMiniDump)
+LAZY_SYMBOL(4, SteamAPI_SetMiniDumpComment)
+LAZY_SYMBOL(5, SteamAPI_RunCallbacks)
+LAZY_SYMBOL(6, SteamAPI_RegisterCallback)
+LAZY_SYMBOL(7, SteamAPI_UnregisterCallback)
+LAZY_SYMBOL(8, SteamAPI_RegisterCallResult)
+LAZY_SYMBOL(9, SteamAPI_UnregisterCallResult)
+LAZY_SYMBOL(10, SteamAPI_IsSteamRunning)
+LAZY_SYMBOL(11, Steam_RunCallbacks)
+LAZY_SYMBOL(12, Steam_RegisterInterfaceFuncs)
+LAZY_SYMBOL(13, Steam_GetHSteamUserCurrent)
+LAZY_SYMBOL(14, SteamAPI_GetSteamInstallPath)
+LAZY_SYMBOL(15, SteamAPI_GetHSteamPipe)
+LAZY_SYMBOL(16, SteamAPI_SetTryCatchCallbacks)
+LAZY_SYMBOL(17, GetHSteamPipe)
+LAZY_SYMBOL(18, GetHSteamUser)
+LAZY_SYMBOL(19, SteamAPI_InitSafe)
+LAZY_SYMBOL(20, SteamAPI_GetHSteamUser)
+LAZY_SYMBOL(21, SteamAPI_UseBreakpadCrashHandler)
+LAZY_SYMBOL(22, SteamAPI_SetBreakpadAppID)
+LAZY_SYMBOL(23, SteamAPI_ISteamClient_CreateSteamPipe)
+LAZY_SYMBOL(24, SteamAPI_ISteamClient_BReleaseSteamPipe)
+LAZY_SYMBOL(25, SteamAPI_ISteamClient_ConnectToGlobalUser)
+LAZY_SYMBOL(26, SteamAPI_ISteamClient_CreateLocalUser)
+LAZY_SYMBOL(27, SteamAPI_ISteamClient_ReleaseUser)
+LAZY_SYMBOL(28, SteamAPI_ISteamClient_GetISteamUser)
+LAZY_SYMBOL(29, SteamAPI_ISteamClient_GetISteamGameServer)
+LAZY_SYMBOL(30, SteamAPI_ISteamClient_SetLocalIPBinding)
+LAZY_SYMBOL(31, SteamAPI_ISteamClient_GetISteamFriends)
+LAZY_SYMBOL(32, SteamAPI_ISteamClient_GetISteamUtils)
+LAZY_SYMBOL(33, SteamAPI_ISteamClient_GetISteamMatchmaking)
+LAZY_SYMBOL(34, SteamAPI_ISteamClient_GetISteamMatchmakingServers)
+LAZY_SYMBOL(35, SteamAPI_ISteamClient_GetISteamGenericInterface)
+LAZY_SYMBOL(36, SteamAPI_ISteamClient_GetISteamUserStats)
+LAZY_SYMBOL(37, SteamAPI_ISteamClient_GetISteamGameServerStats)
+LAZY_SYMBOL(38, SteamAPI_ISteamClient_GetISteamApps)
+LAZY_SYMBOL(39, SteamAPI_ISteamClient_GetISteamNetworking)
+LAZY_SYMBOL(40, SteamAPI_ISteamClient_GetISteamRemoteStorage)
+LAZY_SYMBOL(41, SteamAPI_ISteamClient_GetISteamScreenshots)
+LAZY_SYMBOL(42, SteamAPI_ISteamClient_GetIPCCallCount)
+LAZY_SYMBOL(43, SteamAPI_ISteamClient_SetWarningMessageHook)
+LAZY_SYMBOL(44, SteamAPI_ISteamClient_BShutdownIfAllPipesClosed)
+LAZY_SYMBOL(45, SteamAPI_ISteamClient_GetISteamHTTP)
+LAZY_SYMBOL(46, SteamAPI_ISteamClient_GetISteamUnifiedMessages)
+LAZY_SYMBOL(47, SteamAPI_ISteamClient_GetISteamController)
+LAZY_SYMBOL(48, SteamAPI_ISteamClient_GetISteamUGC)
+LAZY_SYMBOL(49, SteamAPI_ISteamClient_GetISteamAppList)
+LAZY_SYMBOL(50, SteamAPI_ISteamClient_GetISteamMusic)
+LAZY_SYMBOL(51, SteamAPI_ISteamClient_GetISteamMusicRemote)
+LAZY_SYMBOL(52, SteamAPI_ISteamClient_GetISteamHTMLSurface)
+LAZY_SYMBOL(53, SteamAPI_ISteamClient_GetISteamInventory)
+LAZY_SYMBOL(54, SteamAPI_ISteamClient_GetISteamVideo)
+LAZY_SYMBOL(55, SteamAPI_ISteamUser_GetHSteamUser)
+LAZY_SYMBOL(56, SteamAPI_ISteamUser_BLoggedOn)
+LAZY_SYMBOL(57, SteamAPI_ISteamUser_GetSteamID)
+LAZY_SYMBOL(58, SteamAPI_ISteamUser_InitiateGameConnection)
+LAZY_SYMBOL(59, SteamAPI_ISteamUser_TerminateGameConnection)
+LAZY_SYMBOL(60, SteamAPI_ISteamUser_TrackAppUsageEvent)
+LAZY_SYMBOL(61, SteamAPI_ISteamUser_GetUserDataFolder)
+LAZY_SYMBOL(62, SteamAPI_ISteamUser_StartVoiceRecording)
+LAZY_SYMBOL(63, SteamAPI_ISteamUser_StopVoiceRecording)
+LAZY_SYMBOL(64, SteamAPI_ISteamUser_GetAvailableVoice)
+LAZY_SYMBOL(65, SteamAPI_ISteamUser_GetVoice)
+LAZY_SYMBOL(66, SteamAPI_ISteamUser_DecompressVoice)
+LAZY_SYMBOL(67, SteamAPI_ISteamUser_GetVoiceOptimalSampleRate)
+LAZY_SYMBOL(68, SteamAPI_ISteamUser_GetAuthSessionTicket)
+LAZY_SYMBOL(69, SteamAPI_ISteamUser_BeginAuthSession)
+LAZY_SYMBOL(70, SteamAPI_ISteamUser_EndAuthSession)
+LAZY_SYMBOL(71, SteamAPI_ISteamUser_CancelAuthTicket)
+LAZY_SYMBOL(72, SteamAPI_ISteamUser_UserHasLicenseForApp)
+LAZY_SYMBOL(73, SteamAPI_ISteamUser_BIsBehindNAT)
+LAZY_SYMBOL(74, SteamAPI_ISteamUser_AdvertiseGame)
+LAZY_SYMBOL(75, SteamAPI_ISteamUser_RequestEncryptedAppTicket)
+LAZY_SYMBOL(76, SteamAPI_ISteamUser_GetEncryptedAppTicket)
+LAZY_SYMBOL(77, SteamAPI_ISteamUser_GetGameBadgeLevel)
+LAZY_SYMBOL(78, SteamAPI_ISteamUser_GetPlayerSteamLevel)
+LAZY_SYMBOL(79, SteamAPI_ISteamUser_RequestStoreAuthURL)
+LAZY_SYMBOL(80, SteamAPI_ISteamFriends_GetPersonaName)
+LAZY_SYMBOL(81, SteamAPI_ISteamFriends_SetPersonaName)
+LAZY_SYMBOL(82, SteamAPI_ISteamFriends_GetPersonaState)
+LAZY_SYMBOL(83, SteamAPI_ISteamFriends_GetFriendCount)
+LAZY_SYMBOL(84, SteamAPI_ISteamFriends_GetFriendByIndex)
+LAZY_SYMBOL(85, SteamAPI_ISteamFriends_GetFriendRelationship)
+LAZY_SYMBOL(86, SteamAPI_ISteamFriends_GetFriendPersonaState)
+LAZY_SYMBOL(87, SteamAPI_ISteamFriends_GetFriendPersonaName)
+LAZY_SYMBOL(88, SteamAPI_ISteamFriends_GetFriendGamePlayed)
+LAZY_SYMBOL(89, SteamAPI_ISteamFriends_GetFriendPersonaNameHistory)
+LAZY_SYMBOL(90, SteamAPI_ISteamFriends_GetFriendSteamLevel)
+LAZY_SYMBOL(91, SteamAPI_ISteamFriends_GetPlayerNickname)
+LAZY_SYMBOL(92, SteamAPI_ISteamFriends_GetFriendsGroupCount)
+LAZY_SYMBOL(93, SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex)
+LAZY_SYMBOL(94, SteamAPI_ISteamFriends_GetFriendsGroupName)
+LAZY_SYMBOL(95, SteamAPI_ISteamFriends_GetFriendsGroupMembersCount)
+LAZY_SYMBOL(96, SteamAPI_ISteamFriends_GetFriendsGroupMembersList)
+LAZY_SYMBOL(97, SteamAPI_ISteamFriends_HasFriend)
+LAZY_SYMBOL(98, SteamAPI_ISteamFriends_GetClanCount)
+LAZY_SYMBOL(99, SteamAPI_ISteamFriends_GetClanByIndex)
+LAZY_SYMBOL(100, SteamAPI_ISteamFriends_GetClanName)
+LAZY_SYMBOL(101, SteamAPI_ISteamFriends_GetClanTag)
+LAZY_SYMBOL(102, SteamAPI_ISteamFriends_GetClanActivityCounts)
+LAZY_SYMBOL(103, SteamAPI_ISteamFriends_DownloadClanActivityCounts)
+LAZY_SYMBOL(104, SteamAPI_ISteamFriends_GetFriendCountFromSource)
+LAZY_SYMBOL(105, SteamAPI_ISteamFriends_GetFriendFromSourceByIndex)
+LAZY_SYMBOL(106, SteamAPI_ISteamFriends_IsUserInSource)
+LAZY_SYMBOL(107, SteamAPI_ISteamFriends_SetInGameVoiceSpeaking)
+LAZY_SYMBOL(108, SteamAPI_ISteamFriends_ActivateGameOverlay)
+LAZY_SYMBOL(109, SteamAPI_ISteamFriends_ActivateGameOverlayToUser)
+LAZY_SYMBOL(110, SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage)
+LAZY_SYMBOL(111, SteamAPI_ISteamFriends_ActivateGameOverlayToStore)
+LAZY_SYMBOL(112, SteamAPI_ISteamFriends_SetPlayedWith)
+LAZY_SYMBOL(113, SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog)
+LAZY_SYMBOL(114, SteamAPI_ISteamFriends_GetSmallFriendAvatar)
+LAZY_SYMBOL(115, SteamAPI_ISteamFriends_GetMediumFriendAvatar)
+LAZY_SYMBOL(116, SteamAPI_ISteamFriends_GetLargeFriendAvatar)
+LAZY_SYMBOL(117, SteamAPI_ISteamFriends_RequestUserInformation)
+LAZY_SYMBOL(118, SteamAPI_ISteamFriends_RequestClanOfficerList)
+LAZY_SYMBOL(119, SteamAPI_ISteamFriends_GetClanOwner)
+LAZY_SYMBOL(120, SteamAPI_ISteamFriends_GetClanOfficerCount)
+LAZY_SYMBOL(121, SteamAPI_ISteamFriends_GetClanOfficerByIndex)
+LAZY_SYMBOL(122, SteamAPI_ISteamFriends_GetUserRestrictions)
+LAZY_SYMBOL(123, SteamAPI_ISteamFriends_SetRichPresence)
+LAZY_SYMBOL(124, SteamAPI_ISteamFriends_ClearRichPresence)
+LAZY_SYMBOL(125, SteamAPI_ISteamFriends_GetFriendRichPresence)
+LAZY_SYMBOL(126, SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount)
+LAZY_SYMBOL(127, SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex)
+LAZY_SYMBOL(128, SteamAPI_ISteamFriends_RequestFriendRichPresence)
+LAZY_SYMBOL(129, SteamAPI_ISteamFriends_InviteUserToGame)
+LAZY_SYMBOL(130, SteamAPI_ISteamFriends_GetCoplayFriendCount)
+LAZY_SYMBOL(131, SteamAPI_ISteamFriends_GetCoplayFriend)
+LAZY_SYMBOL(132, SteamAPI_ISteamFriends_GetFriendCoplayTime)
+LAZY_SYMBOL(133, SteamAPI_ISteamFriends_GetFriendCoplayGame)
+LAZY_SYMBOL(134, SteamAPI_ISteamFriends_JoinClanChatRoom)
+LAZY_SYMBOL(135, SteamAPI_ISteamFriends_LeaveClanChatRoom)
+LAZY_SYMBOL(136, SteamAPI_ISteamFriends_GetClanChatMemberCount)
+LAZY_SYMBOL(137, SteamAPI_ISteamFriends_GetChatMemberByIndex)
+LAZY_SYMBOL(138, SteamAPI_ISteamFriends_SendClanChatMessage)
+LAZY_SYMBOL(139, SteamAPI_ISteamFriends_GetClanChatMessage)
+LAZY_SYMBOL(140, SteamAPI_ISteamFriends_IsClanChatAdmin)
+LAZY_SYMBOL(141, SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam)
+LAZY_SYMBOL(142, SteamAPI_ISteamFriends_OpenClanChatWindowInSteam)
+LAZY_SYMBOL(143, SteamAPI_ISteamFriends_CloseClanChatWindowInSteam)
+LAZY_SYMBOL(144, SteamAPI_ISteamFriends_SetListenForFriendsMessages)
+LAZY_SYMBOL(145, SteamAPI_ISteamFriends_ReplyToFriendMessage)
+LAZY_SYMBOL(146, SteamAPI_ISteamFriends_GetFriendMessage)
+LAZY_SYMBOL(147, SteamAPI_ISteamFriends_GetFollowerCount)
+LAZY_SYMBOL(148, SteamAPI_ISteamFriends_IsFollowing)
+LAZY_SYMBOL(149, SteamAPI_ISteamFriends_EnumerateFollowingList)
+LAZY_SYMBOL(150, SteamAPI_ISteamUtils_GetSecondsSinceAppActive)
+LAZY_SYMBOL(151, SteamAPI_ISteamUtils_GetSecondsSinceComputerActive)
+LAZY_SYMBOL(152, SteamAPI_ISteamUtils_GetConnectedUniverse)
+LAZY_SYMBOL(153, SteamAPI_ISteamUtils_GetServerRealTime)
+LAZY_SYMBOL(154, SteamAPI_ISteamUtils_GetIPCountry)
+LAZY_SYMBOL(155, SteamAPI_ISteamUtils_GetImageSize)
+LAZY_SYMBOL(156, SteamAPI_ISteamUtils_GetImageRGBA)
+LAZY_SYMBOL(157, SteamAPI_ISteamUtils_GetCSERIPPort)
+LAZY_SYMBOL(158, SteamAPI_ISteamUtils_GetCurrentBatteryPower)
+LAZY_SYMBOL(159, SteamAPI_ISteamUtils_GetAppID)
+LAZY_SYMBOL(160, SteamAPI_ISteamUtils_SetOverlayNotificationPosition)
+LAZY_SYMBOL(161, SteamAPI_ISteamUtils_IsAPICallCompleted)
+LAZY_SYMBOL(162, SteamAPI_ISteamUtils_GetAPICallFailureReason)
+LAZY_SYMBOL(163, SteamAPI_ISteamUtils_GetAPICallResult)
+LAZY_SYMBOL(164, SteamAPI_ISteamUtils_GetIPCCallCount)
+LAZY_SYMBOL(165, SteamAPI_ISteamUtils_SetWarningMessageHook)
+LAZY_SYMBOL(166, SteamAPI_ISteamUtils_IsOverlayEnabled)
+LAZY_SYMBOL(167, SteamAPI_ISteamUtils_BOverlayNeedsPresent)
+LAZY_SYMBOL(168, SteamAPI_ISteamUtils_CheckFileSignature)
+LAZY_SYMBOL(169, SteamAPI_ISteamUtils_ShowGamepadTextInput)
+LAZY_SYMBOL(170, SteamAPI_ISteamUtils_GetEnteredGamepadTextLength)
+LAZY_SYMBOL(171, SteamAPI_ISteamUtils_GetEnteredGamepadTextInput)
+LAZY_SYMBOL(172, SteamAPI_ISteamUtils_GetSteamUILanguage)
+LAZY_SYMBOL(173, SteamAPI_ISteamUtils_IsSteamRunningInVR)
+LAZY_SYMBOL(174, SteamAPI_ISteamMatchmaking_GetFavoriteGameCount)
+LAZY_SYMBOL(175, SteamAPI_ISteamMatchmaking_GetFavoriteGame)
+LAZY_SYMBOL(176, SteamAPI_ISteamMatchmaking_AddFavoriteGame)
+LAZY_SYMBOL(177, SteamAPI_ISteamMatchmaking_RemoveFavoriteGame)
+LAZY_SYMBOL(178, SteamAPI_ISteamMatchmaking_RequestLobbyList)
+LAZY_SYMBOL(179, SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter)
+LAZY_SYMBOL(180, SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter)
+LAZY_SYMBOL(181, SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter)
+LAZY_SYMBOL(182, SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable)
+LAZY_SYMBOL(183, SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter)
+LAZY_SYMBOL(184, SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter)
+LAZY_SYMBOL(185, SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter)
+LAZY_SYMBOL(186, SteamAPI_ISteamMatchmaking_GetLobbyByIndex)
+LAZY_SYMBOL(187, SteamAPI_ISteamMatchmaking_CreateLobby)
+LAZY_SYMBOL(188, SteamAPI_ISteamMatchmaking_JoinLobby)
+LAZY_SYMBOL(189, SteamAPI_ISteamMatchmaking_LeaveLobby)
+LAZY_SYMBOL(190, SteamAPI_ISteamMatchmaking_InviteUserToLobby)
+LAZY_SYMBOL(191, SteamAPI_ISteamMatchmaking_GetNumLobbyMembers)
+LAZY_SYMBOL(192, SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex)
+LAZY_SYMBOL(193, SteamAPI_ISteamMatchmaking_GetLobbyData)
+LAZY_SYMBOL(194, SteamAPI_ISteamMatchmaking_SetLobbyData)
+LAZY_SYMBOL(195, SteamAPI_ISteamMatchmaking_GetLobbyDataCount)
+LAZY_SYMBOL(196, SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex)
+LAZY_SYMBOL(197, SteamAPI_ISteamMatchmaking_DeleteLobbyData)
+LAZY_SYMBOL(198, SteamAPI_ISteamMatchmaking_GetLobbyMemberData)
+LAZY_SYMBOL(199, SteamAPI_ISteamMatchmaking_SetLobbyMemberData)
+LAZY_SYMBOL(200, SteamAPI_ISteamMatchmaking_SendLobbyChatMsg)
+LAZY_SYMBOL(201, SteamAPI_ISteamMatchmaking_GetLobbyChatEntry)
+LAZY_SYMBOL(202, SteamAPI_ISteamMatchmaking_RequestLobbyData)
+LAZY_SYMBOL(203, SteamAPI_ISteamMatchmaking_SetLobbyGameServer)
+LAZY_SYMBOL(204, SteamAPI_ISteamMatchmaking_GetLobbyGameServer)
+LAZY_SYMBOL(205, SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit)
+LAZY_SYMBOL(206, SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit)
+LAZY_SYMBOL(207, SteamAPI_ISteamMatchmaking_SetLobbyType)
+LAZY_SYMBOL(208, SteamAPI_ISteamMatchmaking_SetLobbyJoinable)
+LAZY_SYMBOL(209, SteamAPI_ISteamMatchmaking_GetLobbyOwner)
+LAZY_SYMBOL(210, SteamAPI_ISteamMatchmaking_SetLobbyOwner)
+LAZY_SYMBOL(211, SteamAPI_ISteamMatchmaking_SetLinkedLobby)
+LAZY_SYMBOL(212, SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded)
+LAZY_SYMBOL(213, SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond)
+LAZY_SYMBOL(214, SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete)
+LAZY_SYMBOL(215, SteamAPI_ISteamMatchmakingPingResponse_ServerResponded)
+LAZY_SYMBOL(216, SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond)
+LAZY_SYMBOL(217, SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList)
+LAZY_SYMBOL(218, SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond)
+LAZY_SYMBOL(219, SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete)
+LAZY_SYMBOL(220, SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded)
+LAZY_SYMBOL(221, SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond)
+LAZY_SYMBOL(222, SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete)
+LAZY_SYMBOL(223, SteamAPI_ISteamMatchmakingServers_RequestInternetServerList)
+LAZY_SYMBOL(224, SteamAPI_ISteamMatchmakingServers_RequestLANServerList)
+LAZY_SYMBOL(225, SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList)
+LAZY_SYMBOL(226, SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList)
+LAZY_SYMBOL(227, SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList)
+LAZY_SYMBOL(228, SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList)
+LAZY_SYMBOL(229, SteamAPI_ISteamMatchmakingServers_ReleaseRequest)
+LAZY_SYMBOL(230, SteamAPI_ISteamMatchmakingServers_GetServerDetails)
+LAZY_SYMBOL(231, SteamAPI_ISteamMatchmakingServers_CancelQuery)
+LAZY_SYMBOL(232, SteamAPI_ISteamMatchmakingServers_RefreshQuery)
+LAZY_SYMBOL(233, SteamAPI_ISteamMatchmakingServers_IsRefreshing)
+LAZY_SYMBOL(234, SteamAPI_ISteamMatchmakingServers_GetServerCount)
+LAZY_SYMBOL(235, SteamAPI_ISteamMatchmakingServers_RefreshServer)
+LAZY_SYMBOL(236, SteamAPI_ISteamMatchmakingServers_PingServer)
+LAZY_SYMBOL(237, SteamAPI_ISteamMatchmakingServers_PlayerDetails)
+LAZY_SYMBOL(238, SteamAPI_ISteamMatchmakingServers_ServerRules)
+LAZY_SYMBOL(239, SteamAPI_ISteamMatchmakingServers_CancelServerQuery)
+LAZY_SYMBOL(240, SteamAPI_ISteamRemoteStorage_FileWrite)
+LAZY_SYMBOL(241, SteamAPI_ISteamRemoteStorage_FileRead)
+LAZY_SYMBOL(242, SteamAPI_ISteamRemoteStorage_FileForget)
+LAZY_SYMBOL(243, SteamAPI_ISteamRemoteStorage_FileDelete)
+LAZY_SYMBOL(244, SteamAPI_ISteamRemoteStorage_FileShare)
+LAZY_SYMBOL(245, SteamAPI_ISteamRemoteStorage_SetSyncPlatforms)
+LAZY_SYMBOL(246, SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen)
+LAZY_SYMBOL(247, SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk)
+LAZY_SYMBOL(248, SteamAPI_ISteamRemoteStorage_FileWriteStreamClose)
+LAZY_SYMBOL(249, SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel)
+LAZY_SYMBOL(250, SteamAPI_ISteamRemoteStorage_FileExists)
+LAZY_SYMBOL(251, SteamAPI_ISteamRemoteStorage_FilePersisted)
+LAZY_SYMBOL(252, SteamAPI_ISteamRemoteStorage_GetFileSize)
+LAZY_SYMBOL(253, SteamAPI_ISteamRemoteStorage_GetFileTimestamp)
+LAZY_SYMBOL(254, SteamAPI_ISteamRemoteStorage_GetSyncPlatforms)
+LAZY_SYMBOL(255, SteamAPI_ISteamRemoteStorage_GetFileCount)
+LAZY_SYMBOL(256, SteamAPI_ISteamRemoteStorage_GetFileNameAndSize)
+LAZY_SYMBOL(257, SteamAPI_ISteamRemoteStorage_GetQuota)
+LAZY_SYMBOL(258, SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount)
+LAZY_SYMBOL(259, SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp)
+LAZY_SYMBOL(260, SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp)
+LAZY_SYMBOL(261, SteamAPI_ISteamRemoteStorage_UGCDownload)
+LAZY_SYMBOL(262, SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress)
+LAZY_SYMBOL(263, SteamAPI_ISteamRemoteStorage_GetUGCDetails)
+LAZY_SYMBOL(264, SteamAPI_ISteamRemoteStorage_UGCRead)
+LAZY_SYMBOL(265, SteamAPI_ISteamRemoteStorage_GetCachedUGCCount)
+LAZY_SYMBOL(266, SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle)
+LAZY_SYMBOL(267, SteamAPI_ISteamRemoteStorage_PublishWorkshopFile)
+LAZY_SYMBOL(268, SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest)
+LAZY_SYMBOL(269, SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile)
+LAZY_SYMBOL(270, SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile)
+LAZY_SYMBOL(271, SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle)
+LAZY_SYMBOL(272, SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription)
+LAZY_SYMBOL(273, SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility)
+LAZY_SYMBOL(274, SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags)
+LAZY_SYMBOL(275, SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate)
+LAZY_SYMBOL(276, SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails)
+LAZY_SYMBOL(277, SteamAPI_ISteamRemoteStorage_DeletePublishedFile)
+LAZY_SYMBOL(278, SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles)
+LAZY_SYMBOL(279, SteamAPI_ISteamRemoteStorage_SubscribePublishedFile)
+LAZY_SYMBOL(280, SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles)
+LAZY_SYMBOL(281, SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile)
+LAZY_SYMBOL(282, SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription)
+LAZY_SYMBOL(283, SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails)
+LAZY_SYMBOL(284, SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote)
+LAZY_SYMBOL(285, SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails)
+LAZY_SYMBOL(286, SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles)
+LAZY_SYMBOL(287, SteamAPI_ISteamRemoteStorage_PublishVideo)
+LAZY_SYMBOL(288, SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction)
+LAZY_SYMBOL(289, SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction)
+LAZY_SYMBOL(290, SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles)
+LAZY_SYMBOL(291, SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation)
+LAZY_SYMBOL(292, SteamAPI_ISteamUserStats_RequestCurrentStats)
+LAZY_SYMBOL(293, SteamAPI_ISteamUserStats_GetStat)
+LAZY_SYMBOL(294, SteamAPI_ISteamUserStats_GetStat0)
+LAZY_SYMBOL(295, SteamAPI_ISteamUserStats_SetStat)
+LAZY_SYMBOL(296, SteamAPI_ISteamUserStats_SetStat0)
+LAZY_SYMBOL(297, SteamAPI_ISteamUserStats_UpdateAvgRateStat)
+LAZY_SYMBOL(298, SteamAPI_ISteamUserStats_GetAchievement)
+LAZY_SYMBOL(299, SteamAPI_ISteamUserStats_SetAchievement)
+LAZY_SYMBOL(300, SteamAPI_ISteamUserStats_ClearAchievement)
+LAZY_SYMBOL(301, SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime)
+LAZY_SYMBOL(302, SteamAPI_ISteamUserStats_StoreStats)
+LAZY_SYMBOL(303, SteamAPI_ISteamUserStats_GetAchievementIcon)
+LAZY_SYMBOL(304, SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute)
+LAZY_SYMBOL(305, SteamAPI_ISteamUserStats_IndicateAchievementProgress)
+LAZY_SYMBOL(306, SteamAPI_ISteamUserStats_GetNumAchievements)
+LAZY_SYMBOL(307, SteamAPI_ISteamUserStats_GetAchievementName)
+LAZY_SYMBOL(308, SteamAPI_ISteamUserStats_RequestUserStats)
+LAZY_SYMBOL(309, SteamAPI_ISteamUserStats_GetUserStat)
+LAZY_SYMBOL(310, SteamAPI_ISteamUserStats_GetUserStat0)
+LAZY_SYMBOL(311, SteamAPI_ISteamUserStats_GetUserAchievement)
+LAZY_SYMBOL(312, SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime)
+LAZY_SYMBOL(313, SteamAPI_ISteamUserStats_ResetAllStats)
+LAZY_SYMBOL(314, SteamAPI_ISteamUserStats_FindOrCreateLeaderboard)
+LAZY_SYMBOL(315, SteamAPI_ISteamUserStats_FindLeaderboard)
+LAZY_SYMBOL(316, SteamAPI_ISteamUserStats_GetLeaderboardName)
+LAZY_SYMBOL(317, SteamAPI_ISteamUserStats_GetLeaderboardEntryCount)
+LAZY_SYMBOL(318, SteamAPI_ISteamUserStats_GetLeaderboardSortMethod)
+LAZY_SYMBOL(319, SteamAPI_ISteamUserStats_GetLeaderboardDisplayType)
+LAZY_SYMBOL(320, SteamAPI_ISteamUserStats_DownloadLeaderboardEntries)
+LAZY_SYMBOL(321, SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers)
+LAZY_SYMBOL(322, SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry)
+LAZY_SYMBOL(323, SteamAPI_ISteamUserStats_UploadLeaderboardScore)
+LAZY_SYMBOL(324, SteamAPI_ISteamUserStats_AttachLeaderboardUGC)
+LAZY_SYMBOL(325, SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers)
+LAZY_SYMBOL(326, SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages)
+LAZY_SYMBOL(327, SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo)
+LAZY_SYMBOL(328, SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo)
+LAZY_SYMBOL(329, SteamAPI_ISteamUserStats_GetAchievementAchievedPercent)
+LAZY_SYMBOL(330, SteamAPI_ISteamUserStats_RequestGlobalStats)
+LAZY_SYMBOL(331, SteamAPI_ISteamUserStats_GetGlobalStat)
+LAZY_SYMBOL(332, SteamAPI_ISteamUserStats_GetGlobalStat0)
+LAZY_SYMBOL(333, SteamAPI_ISteamUserStats_GetGlobalStatHistory)
+LAZY_SYMBOL(334, SteamAPI_ISteamUserStats_GetGlobalStatHistory0)
+LAZY_SYMBOL(335, SteamAPI_ISteamApps_BIsSubscribed)
+LAZY_SYMBOL(336, SteamAPI_ISteamApps_BIsLowViolence)
+LAZY_SYMBOL(337, SteamAPI_ISteamApps_BIsCybercafe)
+LAZY_SYMBOL(338, SteamAPI_ISteamApps_BIsVACBanned)
+LAZY_SYMBOL(339, SteamAPI_ISteamApps_GetCurrentGameLanguage)
+LAZY_SYMBOL(340, SteamAPI_ISteamApps_GetAvailableGameLanguages)
+LAZY_SYMBOL(341, SteamAPI_ISteamApps_BIsSubscribedApp)
+LAZY_SYMBOL(342, SteamAPI_ISteamApps_BIsDlcInstalled)
+LAZY_SYMBOL(343, SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime)
+LAZY_SYMBOL(344, SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend)
+LAZY_SYMBOL(345, SteamAPI_ISteamApps_GetDLCCount)
+LAZY_SYMBOL(346, SteamAPI_ISteamApps_BGetDLCDataByIndex)
+LAZY_SYMBOL(347, SteamAPI_ISteamApps_InstallDLC)
+LAZY_SYMBOL(348, SteamAPI_ISteamApps_UninstallDLC)
+LAZY_SYMBOL(349, SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey)
+LAZY_SYMBOL(350, SteamAPI_ISteamApps_GetCurrentBetaName)
+LAZY_SYMBOL(351, SteamAPI_ISteamApps_MarkContentCorrupt)
+LAZY_SYMBOL(352, SteamAPI_ISteamApps_GetInstalledDepots)
+LAZY_SYMBOL(353, SteamAPI_ISteamApps_GetAppInstallDir)
+LAZY_SYMBOL(354, SteamAPI_ISteamApps_BIsAppInstalled)
+LAZY_SYMBOL(355, SteamAPI_ISteamApps_GetAppOwner)
+LAZY_SYMBOL(356, SteamAPI_ISteamApps_GetLaunchQueryParam)
+LAZY_SYMBOL(357, SteamAPI_ISteamApps_GetDlcDownloadProgress)
+LAZY_SYMBOL(358, SteamAPI_ISteamApps_GetAppBuildId)
+LAZY_SYMBOL(359, SteamAPI_ISteamNetworking_SendP2PPacket)
+LAZY_SYMBOL(360, SteamAPI_ISteamNetworking_IsP2PPacketAvailable)
+LAZY_SYMBOL(361, SteamAPI_ISteamNetworking_ReadP2PPacket)
+LAZY_SYMBOL(362, SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser)
+LAZY_SYMBOL(363, SteamAPI_ISteamNetworking_CloseP2PSessionWithUser)
+LAZY_SYMBOL(364, SteamAPI_ISteamNetworking_CloseP2PChannelWithUser)
+LAZY_SYMBOL(365, SteamAPI_ISteamNetworking_GetP2PSessionState)
+LAZY_SYMBOL(366, SteamAPI_ISteamNetworking_AllowP2PPacketRelay)
+LAZY_SYMBOL(367, SteamAPI_ISteamNetworking_CreateListenSocket)
+LAZY_SYMBOL(368, SteamAPI_ISteamNetworking_CreateP2PConnectionSocket)
+LAZY_SYMBOL(369, SteamAPI_ISteamNetworking_CreateConnectionSocket)
+LAZY_SYMBOL(370, SteamAPI_ISteamNetworking_DestroySocket)
+LAZY_SYMBOL(371, SteamAPI_ISteamNetworking_DestroyListenSocket)
+LAZY_SYMBOL(372, SteamAPI_ISteamNetworking_SendDataOnSocket)
+LAZY_SYMBOL(373, SteamAPI_ISteamNetworking_IsDataAvailableOnSocket)
+LAZY_SYMBOL(374, SteamAPI_ISteamNetworking_RetrieveDataFromSocket)
+LAZY_SYMBOL(375, SteamAPI_ISteamNetworking_IsDataAvailable)
+LAZY_SYMBOL(376, SteamAPI_ISteamNetworking_RetrieveData)
+LAZY_SYMBOL(377, SteamAPI_ISteamNetworking_GetSocketInfo)
+LAZY_SYMBOL(378, SteamAPI_ISteamNetworking_GetListenSocketInfo)
+LAZY_SYMBOL(379, SteamAPI_ISteamNetworking_GetSocketConnectionType)
+LAZY_SYMBOL(380, SteamAPI_ISteamNetworking_GetMaxPacketSize)
+LAZY_SYMBOL(381, SteamAPI_ISteamScreenshots_WriteScreenshot)
+LAZY_SYMBOL(382, SteamAPI_ISteamScreenshots_AddScreenshotToLibrary)
+LAZY_SYMBOL(383, SteamAPI_ISteamScreenshots_TriggerScreenshot)
+LAZY_SYMBOL(384, SteamAPI_ISteamScreenshots_HookScreenshots)
+LAZY_SYMBOL(385, SteamAPI_ISteamScreenshots_SetLocation)
+LAZY_SYMBOL(386, SteamAPI_ISteamScreenshots_TagUser)
+LAZY_SYMBOL(387, SteamAPI_ISteamScreenshots_TagPublishedFile)
+LAZY_SYMBOL(388, SteamAPI_ISteamMusic_BIsEnabled)
+LAZY_SYMBOL(389, SteamAPI_ISteamMusic_BIsPlaying)
+LAZY_SYMBOL(390, SteamAPI_ISteamMusic_GetPlaybackStatus)
+LAZY_SYMBOL(391, SteamAPI_ISteamMusic_Play)
+LAZY_SYMBOL(392, SteamAPI_ISteamMusic_Pause)
+LAZY_SYMBOL(393, SteamAPI_ISteamMusic_PlayPrevious)
+LAZY_SYMBOL(394, SteamAPI_ISteamMusic_PlayNext)
+LAZY_SYMBOL(395, SteamAPI_ISteamMusic_SetVolume)
+LAZY_SYMBOL(396, SteamAPI_ISteamMusic_GetVolume)
+LAZY_SYMBOL(397, SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote)
+LAZY_SYMBOL(398, SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote)
+LAZY_SYMBOL(399, SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote)
+LAZY_SYMBOL(400, SteamAPI_ISteamMusicRemote_BActivationSuccess)
+LAZY_SYMBOL(401, SteamAPI_ISteamMusicRemote_SetDisplayName)
+LAZY_SYMBOL(402, SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64)
+LAZY_SYMBOL(403, SteamAPI_ISteamMusicRemote_EnablePlayPrevious)
+LAZY_SYMBOL(404, SteamAPI_ISteamMusicRemote_EnablePlayNext)
+LAZY_SYMBOL(405, SteamAPI_ISteamMusicRemote_EnableShuffled)
+LAZY_SYMBOL(406, SteamAPI_ISteamMusicRemote_EnableLooped)
+LAZY_SYMBOL(407, SteamAPI_ISteamMusicRemote_EnableQueue)
+LAZY_SYMBOL(408, SteamAPI_ISteamMusicRemote_EnablePlaylists)
+LAZY_SYMBOL(409, SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus)
+LAZY_SYMBOL(410, SteamAPI_ISteamMusicRemote_UpdateShuffled)
+LAZY_SYMBOL(411, SteamAPI_ISteamMusicRemote_UpdateLooped)
+LAZY_SYMBOL(412, SteamAPI_ISteamMusicRemote_UpdateVolume)
+LAZY_SYMBOL(413, SteamAPI_ISteamMusicRemote_CurrentEntryWillChange)
+LAZY_SYMBOL(414, SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable)
+LAZY_SYMBOL(415, SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText)
+LAZY_SYMBOL(416, SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds)
+LAZY_SYMBOL(417, SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt)
+LAZY_SYMBOL(418, SteamAPI_ISteamMusicRemote_CurrentEntryDidChange)
+LAZY_SYMBOL(419, SteamAPI_ISteamMusicRemote_QueueWillChange)
+LAZY_SYMBOL(420, SteamAPI_ISteamMusicRemote_ResetQueueEntries)
+LAZY_SYMBOL(421, SteamAPI_ISteamMusicRemote_SetQueueEntry)
+LAZY_SYMBOL(422, SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry)
+LAZY_SYMBOL(423, SteamAPI_ISteamMusicRemote_QueueDidChange)
+LAZY_SYMBOL(424, SteamAPI_ISteamMusicRemote_PlaylistWillChange)
+LAZY_SYMBOL(425, SteamAPI_ISteamMusicRemote_ResetPlaylistEntries)
+LAZY_SYMBOL(426, SteamAPI_ISteamMusicRemote_SetPlaylistEntry)
+LAZY_SYMBOL(427, SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry)
+LAZY_SYMBOL(428, SteamAPI_ISteamMusicRemote_PlaylistDidChange)
+LAZY_SYMBOL(429, SteamAPI_ISteamHTTP_CreateHTTPRequest)
+LAZY_SYMBOL(430, SteamAPI_ISteamHTTP_SetHTTPRequestContextValue)
+LAZY_SYMBOL(431, SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout)
+LAZY_SYMBOL(432, SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue)
+LAZY_SYMBOL(433, SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter)
+LAZY_SYMBOL(434, SteamAPI_ISteamHTTP_SendHTTPRequest)
+LAZY_SYMBOL(435, SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse)
+LAZY_SYMBOL(436, SteamAPI_ISteamHTTP_DeferHTTPRequest)
+LAZY_SYMBOL(437, SteamAPI_ISteamHTTP_PrioritizeHTTPRequest)
+LAZY_SYMBOL(438, SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize)
+LAZY_SYMBOL(439, SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue)
+LAZY_SYMBOL(440, SteamAPI_ISteamHTTP_GetHTTPResponseBodySize)
+LAZY_SYMBOL(441, SteamAPI_ISteamHTTP_GetHTTPResponseBodyData)
+LAZY_SYMBOL(442, SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData)
+LAZY_SYMBOL(443, SteamAPI_ISteamHTTP_ReleaseHTTPRequest)
+LAZY_SYMBOL(444, SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct)
+LAZY_SYMBOL(445, SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody)
+LAZY_SYMBOL(446, SteamAPI_ISteamHTTP_CreateCookieContainer)
+LAZY_SYMBOL(447, SteamAPI_ISteamHTTP_ReleaseCookieContainer)
+LAZY_SYMBOL(448, SteamAPI_ISteamHTTP_SetCookie)
+LAZY_SYMBOL(449, SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer)
+LAZY_SYMBOL(450, SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo)
+LAZY_SYMBOL(451, SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate)
+LAZY_SYMBOL(452, SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS)
+LAZY_SYMBOL(453, SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut)
+LAZY_SYMBOL(454, SteamAPI_ISteamUnifiedMessages_SendMethod)
+LAZY_SYMBOL(455, SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo)
+LAZY_SYMBOL(456, SteamAPI_ISteamUnifiedMessages_GetMethodResponseData)
+LAZY_SYMBOL(457, SteamAPI_ISteamUnifiedMessages_ReleaseMethod)
+LAZY_SYMBOL(458, SteamAPI_ISteamUnifiedMessages_SendNotification)
+LAZY_SYMBOL(459, SteamAPI_ISteamController_Init)
+LAZY_SYMBOL(460, SteamAPI_ISteamController_Shutdown)
+LAZY_SYMBOL(461, SteamAPI_ISteamController_RunFrame)
+LAZY_SYMBOL(462, SteamAPI_ISteamController_TriggerHapticPulse)
+LAZY_SYMBOL(463, SteamAPI_ISteamUGC_CreateQueryUserUGCRequest)
+LAZY_SYMBOL(464, SteamAPI_ISteamUGC_CreateQueryAllUGCRequest)
+LAZY_SYMBOL(465, SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest)
+LAZY_SYMBOL(466, SteamAPI_ISteamUGC_SendQueryUGCRequest)
+LAZY_SYMBOL(467, SteamAPI_ISteamUGC_GetQueryUGCResult)
+LAZY_SYMBOL(468, SteamAPI_ISteamUGC_GetQueryUGCPreviewURL)
+LAZY_SYMBOL(469, SteamAPI_ISteamUGC_GetQueryUGCMetadata)
+LAZY_SYMBOL(470, SteamAPI_ISteamUGC_GetQueryUGCChildren)
+LAZY_SYMBOL(471, SteamAPI_ISteamUGC_GetQueryUGCStatistic)
+LAZY_SYMBOL(472, SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews)
+LAZY_SYMBOL(473, SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview)
+LAZY_SYMBOL(474, SteamAPI_ISteamUGC_ReleaseQueryUGCRequest)
+LAZY_SYMBOL(475, SteamAPI_ISteamUGC_AddRequiredTag)
+LAZY_SYMBOL(476, SteamAPI_ISteamUGC_AddExcludedTag)
+LAZY_SYMBOL(477, SteamAPI_ISteamUGC_SetReturnLongDescription)
+LAZY_SYMBOL(478, SteamAPI_ISteamUGC_SetReturnMetadata)
+LAZY_SYMBOL(479, SteamAPI_ISteamUGC_SetReturnChildren)
+LAZY_SYMBOL(480, SteamAPI_ISteamUGC_SetReturnAdditionalPreviews)
+LAZY_SYMBOL(481, SteamAPI_ISteamUGC_SetReturnTotalOnly)
+LAZY_SYMBOL(482, SteamAPI_ISteamUGC_SetAllowCachedResponse)
+LAZY_SYMBOL(483, SteamAPI_ISteamUGC_SetCloudFileNameFilter)
+LAZY_SYMBOL(484, SteamAPI_ISteamUGC_SetMatchAnyTag)
+LAZY_SYMBOL(485, SteamAPI_ISteamUGC_SetSearchText)
+LAZY_SYMBOL(486, SteamAPI_ISteamUGC_SetRankedByTrendDays)
+LAZY_SYMBOL(487, SteamAPI_ISteamUGC_RequestUGCDetails)
+LAZY_SYMBOL(488, SteamAPI_ISteamUGC_CreateItem)
+LAZY_SYMBOL(489, SteamAPI_ISteamUGC_StartItemUpdate)
+LAZY_SYMBOL(490, SteamAPI_ISteamUGC_SetItemTitle)
+LAZY_SYMBOL(491, SteamAPI_ISteamUGC_SetItemDescription)
+LAZY_SYMBOL(492, SteamAPI_ISteamUGC_SetItemMetadata)
+LAZY_SYMBOL(493, SteamAPI_ISteamUGC_SetItemVisibility)
+LAZY_SYMBOL(494, SteamAPI_ISteamUGC_SetItemTags)
+LAZY_SYMBOL(495, SteamAPI_ISteamUGC_SetItemContent)
+LAZY_SYMBOL(496, SteamAPI_ISteamUGC_SetItemPreview)
+LAZY_SYMBOL(497, SteamAPI_ISteamUGC_SubmitItemUpdate)
+LAZY_SYMBOL(498, SteamAPI_ISteamUGC_GetItemUpdateProgress)
+LAZY_SYMBOL(499, SteamAPI_ISteamUGC_AddItemToFavorites)
+LAZY_SYMBOL(500, SteamAPI_ISteamUGC_RemoveItemFromFavorites)
+LAZY_SYMBOL(501, SteamAPI_ISteamUGC_SubscribeItem)
+LAZY_SYMBOL(502, SteamAPI_ISteamUGC_UnsubscribeItem)
+LAZY_SYMBOL(503, SteamAPI_ISteamUGC_GetNumSubscribedItems)
+LAZY_SYMBOL(504, SteamAPI_ISteamUGC_GetSubscribedItems)
+LAZY_SYMBOL(505, SteamAPI_ISteamUGC_GetItemState)
+LAZY_SYMBOL(506, SteamAPI_ISteamUGC_GetItemInstallInfo)
+LAZY_SYMBOL(507, SteamAPI_ISteamUGC_GetItemDownloadInfo)
+LAZY_SYMBOL(508, SteamAPI_ISteamUGC_DownloadItem)
+LAZY_SYMBOL(509, SteamAPI_ISteamAppList_GetNumInstalledApps)
+LAZY_SYMBOL(510, SteamAPI_ISteamAppList_GetInstalledApps)
+LAZY_SYMBOL(511, SteamAPI_ISteamAppList_GetAppName)
+LAZY_SYMBOL(512, SteamAPI_ISteamAppList_GetAppInstallDir)
+LAZY_SYMBOL(513, SteamAPI_ISteamAppList_GetAppBuildId)
+LAZY_SYMBOL(514, SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface)
+LAZY_SYMBOL(515, SteamAPI_ISteamHTMLSurface_Init)
+LAZY_SYMBOL(516, SteamAPI_ISteamHTMLSurface_Shutdown)
+LAZY_SYMBOL(517, SteamAPI_ISteamHTMLSurface_CreateBrowser)
+LAZY_SYMBOL(518, SteamAPI_ISteamHTMLSurface_RemoveBrowser)
+LAZY_SYMBOL(519, SteamAPI_ISteamHTMLSurface_LoadURL)
+LAZY_SYMBOL(520, SteamAPI_ISteamHTMLSurface_SetSize)
+LAZY_SYMBOL(521, SteamAPI_ISteamHTMLSurface_StopLoad)
+LAZY_SYMBOL(522, SteamAPI_ISteamHTMLSurface_Reload)
+LAZY_SYMBOL(523, SteamAPI_ISteamHTMLSurface_GoBack)
+LAZY_SYMBOL(524, SteamAPI_ISteamHTMLSurface_GoForward)
+LAZY_SYMBOL(525, SteamAPI_ISteamHTMLSurface_AddHeader)
+LAZY_SYMBOL(526, SteamAPI_ISteamHTMLSurface_ExecuteJavascript)
+LAZY_SYMBOL(527, SteamAPI_ISteamHTMLSurface_MouseUp)
+LAZY_SYMBOL(528, SteamAPI_ISteamHTMLSurface_MouseDown)
+LAZY_SYMBOL(529, SteamAPI_ISteamHTMLSurface_MouseDoubleClick)
+LAZY_SYMBOL(530, SteamAPI_ISteamHTMLSurface_MouseMove)
+LAZY_SYMBOL(531, SteamAPI_ISteamHTMLSurface_MouseWheel)
+LAZY_SYMBOL(532, SteamAPI_ISteamHTMLSurface_KeyDown)
+LAZY_SYMBOL(533, SteamAPI_ISteamHTMLSurface_KeyUp)
+LAZY_SYMBOL(534, SteamAPI_ISteamHTMLSurface_KeyChar)
+LAZY_SYMBOL(535, SteamAPI_ISteamHTMLSurface_SetHorizontalScroll)
+LAZY_SYMBOL(536, SteamAPI_ISteamHTMLSurface_SetVerticalScroll)
+LAZY_SYMBOL(537, SteamAPI_ISteamHTMLSurface_SetKeyFocus)
+LAZY_SYMBOL(538, SteamAPI_ISteamHTMLSurface_ViewSource)
+LAZY_SYMBOL(539, SteamAPI_ISteamHTMLSurface_CopyToClipboard)
+LAZY_SYMBOL(540, SteamAPI_ISteamHTMLSurface_PasteFromClipboard)
+LAZY_SYMBOL(541, SteamAPI_ISteamHTMLSurface_Find)
+LAZY_SYMBOL(542, SteamAPI_ISteamHTMLSurface_StopFind)
+LAZY_SYMBOL(543, SteamAPI_ISteamHTMLSurface_GetLinkAtPosition)
+LAZY_SYMBOL(544, SteamAPI_ISteamHTMLSurface_SetCookie)
+LAZY_SYMBOL(545, SteamAPI_ISteamHTMLSurface_SetPageScaleFactor)
+LAZY_SYMBOL(546, SteamAPI_ISteamHTMLSurface_SetBackgroundMode)
+LAZY_SYMBOL(547, SteamAPI_ISteamHTMLSurface_AllowStartRequest)
+LAZY_SYMBOL(548, SteamAPI_ISteamHTMLSurface_JSDialogResponse)
+LAZY_SYMBOL(549, SteamAPI_ISteamInventory_GetResultStatus)
+LAZY_SYMBOL(550, SteamAPI_ISteamInventory_GetResultItems)
+LAZY_SYMBOL(551, SteamAPI_ISteamInventory_GetResultTimestamp)
+LAZY_SYMBOL(552, SteamAPI_ISteamInventory_CheckResultSteamID)
+LAZY_SYMBOL(553, SteamAPI_ISteamInventory_DestroyResult)
+LAZY_SYMBOL(554, SteamAPI_ISteamInventory_GetAllItems)
+LAZY_SYMBOL(555, SteamAPI_ISteamInventory_GetItemsByID)
+LAZY_SYMBOL(556, SteamAPI_ISteamInventory_SerializeResult)
+LAZY_SYMBOL(557, SteamAPI_ISteamInventory_DeserializeResult)
+LAZY_SYMBOL(558, SteamAPI_ISteamInventory_GenerateItems)
+LAZY_SYMBOL(559, SteamAPI_ISteamInventory_GrantPromoItems)
+LAZY_SYMBOL(560, SteamAPI_ISteamInventory_AddPromoItem)
+LAZY_SYMBOL(561, SteamAPI_ISteamInventory_AddPromoItems)
+LAZY_SYMBOL(562, SteamAPI_ISteamInventory_ConsumeItem)
+LAZY_SYMBOL(563, SteamAPI_ISteamInventory_ExchangeItems)
+LAZY_SYMBOL(564, SteamAPI_ISteamInventory_TransferItemQuantity)
+LAZY_SYMBOL(565, SteamAPI_ISteamInventory_SendItemDropHeartbeat)
+LAZY_SYMBOL(566, SteamAPI_ISteamInventory_TriggerItemDrop)
+LAZY_SYMBOL(567, SteamAPI_ISteamInventory_TradeItems)
+LAZY_SYMBOL(568, SteamAPI_ISteamInventory_LoadItemDefinitions)
+LAZY_SYMBOL(569, SteamAPI_ISteamInventory_GetItemDefinitionIDs)
+LAZY_SYMBOL(570, SteamAPI_ISteamInventory_GetItemDefinitionProperty)
+LAZY_SYMBOL(571, SteamAPI_ISteamVideo_GetVideoURL)
+LAZY_SYMBOL(572, SteamAPI_ISteamVideo_IsBroadcasting)
+LAZY_SYMBOL(573, SteamAPI_ISteamGameServer_InitGameServer)
+LAZY_SYMBOL(574, SteamAPI_ISteamGameServer_SetProduct)
+LAZY_SYMBOL(575, SteamAPI_ISteamGameServer_SetGameDescription)
+LAZY_SYMBOL(576, SteamAPI_ISteamGameServer_SetModDir)
+LAZY_SYMBOL(577, SteamAPI_ISteamGameServer_SetDedicatedServer)
+LAZY_SYMBOL(578, SteamAPI_ISteamGameServer_LogOn)
+LAZY_SYMBOL(579, SteamAPI_ISteamGameServer_LogOnAnonymous)
+LAZY_SYMBOL(580, SteamAPI_ISteamGameServer_LogOff)
+LAZY_SYMBOL(581, SteamAPI_ISteamGameServer_BLoggedOn)
+LAZY_SYMBOL(582, SteamAPI_ISteamGameServer_BSecure)
+LAZY_SYMBOL(583, SteamAPI_ISteamGameServer_GetSteamID)
+LAZY_SYMBOL(584, SteamAPI_ISteamGameServer_WasRestartRequested)
+LAZY_SYMBOL(585, SteamAPI_ISteamGameServer_SetMaxPlayerCount)
+LAZY_SYMBOL(586, SteamAPI_ISteamGameServer_SetBotPlayerCount)
+LAZY_SYMBOL(587, SteamAPI_ISteamGameServer_SetServerName)
+LAZY_SYMBOL(588, SteamAPI_ISteamGameServer_SetMapName)
+LAZY_SYMBOL(589, SteamAPI_ISteamGameServer_SetPasswordProtected)
+LAZY_SYMBOL(590, SteamAPI_ISteamGameServer_SetSpectatorPort)
+LAZY_SYMBOL(591, SteamAPI_ISteamGameServer_SetSpectatorServerName)
+LAZY_SYMBOL(592, SteamAPI_ISteamGameServer_ClearAllKeyValues)
+LAZY_SYMBOL(593, SteamAPI_ISteamGameServer_SetKeyValue)
+LAZY_SYMBOL(594, SteamAPI_ISteamGameServer_SetGameTags)
+LAZY_SYMBOL(595, SteamAPI_ISteamGameServer_SetGameData)
+LAZY_SYMBOL(596, SteamAPI_ISteamGameServer_SetRegion)
+LAZY_SYMBOL(597, SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate)
+LAZY_SYMBOL(598, SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection)
+LAZY_SYMBOL(599, SteamAPI_ISteamGameServer_SendUserDisconnect)
+LAZY_SYMBOL(600, SteamAPI_ISteamGameServer_BUpdateUserData)
+LAZY_SYMBOL(601, SteamAPI_ISteamGameServer_GetAuthSessionTicket)
+LAZY_SYMBOL(602, SteamAPI_ISteamGameServer_BeginAuthSession)
+LAZY_SYMBOL(603, SteamAPI_ISteamGameServer_EndAuthSession)
+LAZY_SYMBOL(604, SteamAPI_ISteamGameServer_CancelAuthTicket)
+LAZY_SYMBOL(605, SteamAPI_ISteamGameServer_UserHasLicenseForApp)
+LAZY_SYMBOL(606, SteamAPI_ISteamGameServer_RequestUserGroupStatus)
+LAZY_SYMBOL(607, SteamAPI_ISteamGameServer_GetGameplayStats)
+LAZY_SYMBOL(608, SteamAPI_ISteamGameServer_GetServerReputation)
+LAZY_SYMBOL(609, SteamAPI_ISteamGameServer_GetPublicIP)
+LAZY_SYMBOL(610, SteamAPI_ISteamGameServer_HandleIncomingPacket)
+LAZY_SYMBOL(611, SteamAPI_ISteamGameServer_GetNextOutgoingPacket)
+LAZY_SYMBOL(612, SteamAPI_ISteamGameServer_EnableHeartbeats)
+LAZY_SYMBOL(613, SteamAPI_ISteamGameServer_SetHeartbeatInterval)
+LAZY_SYMBOL(614, SteamAPI_ISteamGameServer_ForceHeartbeat)
+LAZY_SYMBOL(615, SteamAPI_ISteamGameServer_AssociateWithClan)
+LAZY_SYMBOL(616, SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility)
+LAZY_SYMBOL(617, SteamAPI_ISteamGameServerStats_RequestUserStats)
+LAZY_SYMBOL(618, SteamAPI_ISteamGameServerStats_GetUserStat)
+LAZY_SYMBOL(619, SteamAPI_ISteamGameServerStats_GetUserStat0)
+LAZY_SYMBOL(620, SteamAPI_ISteamGameServerStats_GetUserAchievement)
+LAZY_SYMBOL(621, SteamAPI_ISteamGameServerStats_SetUserStat)
+LAZY_SYMBOL(622, SteamAPI_ISteamGameServerStats_SetUserStat0)
+LAZY_SYMBOL(623, SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat)
+LAZY_SYMBOL(624, SteamAPI_ISteamGameServerStats_SetUserAchievement)
+LAZY_SYMBOL(625, SteamAPI_ISteamGameServerStats_ClearUserAchievement)
+LAZY_SYMBOL(626, SteamAPI_ISteamGameServerStats_StoreUserStats)
+
+extern "C" {
+void *steamSymbols[] = {
+  LAZY_ENTRY(SteamAPI_Init),
+  LAZY_ENTRY(SteamAPI_Shutdown),
+  LAZY_ENTRY(SteamAPI_RestartAppIfNecessary),
+  LAZY_ENTRY(SteamAPI_WriteMiniDump),
+  LAZY_ENTRY(SteamAPI_SetMiniDumpComment),
+  LAZY_ENTRY(SteamAPI_RunCallbacks),
+  LAZY_ENTRY(SteamAPI_RegisterCallback),
+  LAZY_ENTRY(SteamAPI_UnregisterCallback),
+  LAZY_ENTRY(SteamAPI_RegisterCallResult),
+  LAZY_ENTRY(SteamAPI_UnregisterCallResult),
+  LAZY_ENTRY(SteamAPI_IsSteamRunning),
+  LAZY_ENTRY(Steam_RunCallbacks),
+  LAZY_ENTRY(Steam_RegisterInterfaceFuncs),
+  LAZY_ENTRY(Steam_GetHSteamUserCurrent),
+  LAZY_ENTRY(SteamAPI_GetSteamInstallPath),
+  LAZY_ENTRY(SteamAPI_GetHSteamPipe),
+  LAZY_ENTRY(SteamAPI_SetTryCatchCallbacks),
+  LAZY_ENTRY(GetHSteamPipe),
+  LAZY_ENTRY(GetHSteamUser),
+  LAZY_ENTRY(SteamAPI_InitSafe),
+  LAZY_ENTRY(SteamAPI_GetHSteamUser),
+  LAZY_ENTRY(SteamAPI_UseBreakpadCrashHandler),
+  LAZY_ENTRY(SteamAPI_SetBreakpadAppID),
+  LAZY_ENTRY(SteamAPI_ISteamClient_CreateSteamPipe),
+  LAZY_ENTRY(SteamAPI_ISteamClient_BReleaseSteamPipe),
+  LAZY_ENTRY(SteamAPI_ISteamClient_ConnectToGlobalUser),
+  LAZY_ENTRY(SteamAPI_ISteamClient_CreateLocalUser),
+  LAZY_ENTRY(SteamAPI_ISteamClient_ReleaseUser),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamUser),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamGameServer),
+  LAZY_ENTRY(SteamAPI_ISteamClient_SetLocalIPBinding),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamFriends),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamUtils),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamMatchmaking),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamMatchmakingServers),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamGenericInterface),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamUserStats),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamGameServerStats),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamApps),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamNetworking),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamRemoteStorage),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamScreenshots),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetIPCCallCount),
+  LAZY_ENTRY(SteamAPI_ISteamClient_SetWarningMessageHook),
+  LAZY_ENTRY(SteamAPI_ISteamClient_BShutdownIfAllPipesClosed),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamHTTP),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamUnifiedMessages),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamController),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamUGC),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamAppList),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamMusic),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamMusicRemote),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamHTMLSurface),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamInventory),
+  LAZY_ENTRY(SteamAPI_ISteamClient_GetISteamVideo),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetHSteamUser),
+  LAZY_ENTRY(SteamAPI_ISteamUser_BLoggedOn),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetSteamID),
+  LAZY_ENTRY(SteamAPI_ISteamUser_InitiateGameConnection),
+  LAZY_ENTRY(SteamAPI_ISteamUser_TerminateGameConnection),
+  LAZY_ENTRY(SteamAPI_ISteamUser_TrackAppUsageEvent),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetUserDataFolder),
+  LAZY_ENTRY(SteamAPI_ISteamUser_StartVoiceRecording),
+  LAZY_ENTRY(SteamAPI_ISteamUser_StopVoiceRecording),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetAvailableVoice),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetVoice),
+  LAZY_ENTRY(SteamAPI_ISteamUser_DecompressVoice),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetVoiceOptimalSampleRate),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetAuthSessionTicket),
+  LAZY_ENTRY(SteamAPI_ISteamUser_BeginAuthSession),
+  LAZY_ENTRY(SteamAPI_ISteamUser_EndAuthSession),
+  LAZY_ENTRY(SteamAPI_ISteamUser_CancelAuthTicket),
+  LAZY_ENTRY(SteamAPI_ISteamUser_UserHasLicenseForApp),
+  LAZY_ENTRY(SteamAPI_ISteamUser_BIsBehindNAT),
+  LAZY_ENTRY(SteamAPI_ISteamUser_AdvertiseGame),
+  LAZY_ENTRY(SteamAPI_ISteamUser_RequestEncryptedAppTicket),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetEncryptedAppTicket),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetGameBadgeLevel),
+  LAZY_ENTRY(SteamAPI_ISteamUser_GetPlayerSteamLevel),
+  LAZY_ENTRY(SteamAPI_ISteamUser_RequestStoreAuthURL),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetPersonaName),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_SetPersonaName),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetPersonaState),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendRelationship),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendPersonaState),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendPersonaName),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendGamePlayed),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendPersonaNameHistory),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendSteamLevel),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetPlayerNickname),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendsGroupCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendsGroupName),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendsGroupMembersCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendsGroupMembersList),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_HasFriend),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanName),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanTag),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanActivityCounts),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_DownloadClanActivityCounts),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendCountFromSource),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendFromSourceByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_IsUserInSource),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_SetInGameVoiceSpeaking),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_ActivateGameOverlay),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_ActivateGameOverlayToUser),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_ActivateGameOverlayToStore),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_SetPlayedWith),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetSmallFriendAvatar),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetMediumFriendAvatar),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetLargeFriendAvatar),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_RequestUserInformation),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_RequestClanOfficerList),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanOwner),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanOfficerCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanOfficerByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetUserRestrictions),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_SetRichPresence),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_ClearRichPresence),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendRichPresence),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_RequestFriendRichPresence),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_InviteUserToGame),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetCoplayFriendCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetCoplayFriend),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendCoplayTime),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendCoplayGame),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_JoinClanChatRoom),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_LeaveClanChatRoom),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanChatMemberCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetChatMemberByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_SendClanChatMessage),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetClanChatMessage),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_IsClanChatAdmin),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_OpenClanChatWindowInSteam),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_CloseClanChatWindowInSteam),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_SetListenForFriendsMessages),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_ReplyToFriendMessage),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFriendMessage),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_GetFollowerCount),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_IsFollowing),
+  LAZY_ENTRY(SteamAPI_ISteamFriends_EnumerateFollowingList),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetSecondsSinceAppActive),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetSecondsSinceComputerActive),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetConnectedUniverse),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetServerRealTime),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetIPCountry),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetImageSize),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetImageRGBA),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetCSERIPPort),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetCurrentBatteryPower),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetAppID),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_SetOverlayNotificationPosition),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_IsAPICallCompleted),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetAPICallFailureReason),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetAPICallResult),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetIPCCallCount),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_SetWarningMessageHook),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_IsOverlayEnabled),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_BOverlayNeedsPresent),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_CheckFileSignature),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_ShowGamepadTextInput),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetEnteredGamepadTextLength),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetEnteredGamepadTextInput),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_GetSteamUILanguage),
+  LAZY_ENTRY(SteamAPI_ISteamUtils_IsSteamRunningInVR),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetFavoriteGameCount),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetFavoriteGame),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddFavoriteGame),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_RemoveFavoriteGame),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_RequestLobbyList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_CreateLobby),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_JoinLobby),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_LeaveLobby),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_InviteUserToLobby),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetNumLobbyMembers),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyData),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLobbyData),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyDataCount),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_DeleteLobbyData),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyMemberData),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLobbyMemberData),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SendLobbyChatMsg),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyChatEntry),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_RequestLobbyData),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLobbyGameServer),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyGameServer),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLobbyType),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLobbyJoinable),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_GetLobbyOwner),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLobbyOwner),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmaking_SetLinkedLobby),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingPingResponse_ServerResponded),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RequestInternetServerList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RequestLANServerList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_ReleaseRequest),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_GetServerDetails),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_CancelQuery),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RefreshQuery),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_IsRefreshing),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_GetServerCount),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_RefreshServer),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_PingServer),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_PlayerDetails),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_ServerRules),
+  LAZY_ENTRY(SteamAPI_ISteamMatchmakingServers_CancelServerQuery),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileWrite),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileRead),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileForget),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileDelete),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileShare),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_SetSyncPlatforms),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileWriteStreamClose),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FileExists),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_FilePersisted),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetFileSize),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetFileTimestamp),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetSyncPlatforms),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetFileCount),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetFileNameAndSize),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetQuota),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UGCDownload),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetUGCDetails),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UGCRead),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetCachedUGCCount),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_PublishWorkshopFile),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_DeletePublishedFile),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_SubscribePublishedFile),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_PublishVideo),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles),
+  LAZY_ENTRY(SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_RequestCurrentStats),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetStat),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetStat0),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_SetStat),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_SetStat0),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_UpdateAvgRateStat),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetAchievement),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_SetAchievement),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_ClearAchievement),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_StoreStats),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetAchievementIcon),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_IndicateAchievementProgress),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetNumAchievements),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetAchievementName),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_RequestUserStats),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetUserStat),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetUserStat0),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetUserAchievement),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_ResetAllStats),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_FindOrCreateLeaderboard),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_FindLeaderboard),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetLeaderboardName),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetLeaderboardEntryCount),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetLeaderboardSortMethod),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetLeaderboardDisplayType),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_DownloadLeaderboardEntries),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_UploadLeaderboardScore),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_AttachLeaderboardUGC),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetAchievementAchievedPercent),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_RequestGlobalStats),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetGlobalStat),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetGlobalStat0),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetGlobalStatHistory),
+  LAZY_ENTRY(SteamAPI_ISteamUserStats_GetGlobalStatHistory0),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsSubscribed),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsLowViolence),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsCybercafe),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsVACBanned),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetCurrentGameLanguage),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetAvailableGameLanguages),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsSubscribedApp),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsDlcInstalled),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetDLCCount),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BGetDLCDataByIndex),
+  LAZY_ENTRY(SteamAPI_ISteamApps_InstallDLC),
+  LAZY_ENTRY(SteamAPI_ISteamApps_UninstallDLC),
+  LAZY_ENTRY(SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetCurrentBetaName),
+  LAZY_ENTRY(SteamAPI_ISteamApps_MarkContentCorrupt),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetInstalledDepots),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetAppInstallDir),
+  LAZY_ENTRY(SteamAPI_ISteamApps_BIsAppInstalled),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetAppOwner),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetLaunchQueryParam),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetDlcDownloadProgress),
+  LAZY_ENTRY(SteamAPI_ISteamApps_GetAppBuildId),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_SendP2PPacket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_IsP2PPacketAvailable),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_ReadP2PPacket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_CloseP2PSessionWithUser),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_CloseP2PChannelWithUser),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_GetP2PSessionState),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_AllowP2PPacketRelay),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_CreateListenSocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_CreateP2PConnectionSocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_CreateConnectionSocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_DestroySocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_DestroyListenSocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_SendDataOnSocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_IsDataAvailableOnSocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_RetrieveDataFromSocket),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_IsDataAvailable),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_RetrieveData),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_GetSocketInfo),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_GetListenSocketInfo),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_GetSocketConnectionType),
+  LAZY_ENTRY(SteamAPI_ISteamNetworking_GetMaxPacketSize),
+  LAZY_ENTRY(SteamAPI_ISteamScreenshots_WriteScreenshot),
+  LAZY_ENTRY(SteamAPI_ISteamScreenshots_AddScreenshotToLibrary),
+  LAZY_ENTRY(SteamAPI_ISteamScreenshots_TriggerScreenshot),
+  LAZY_ENTRY(SteamAPI_ISteamScreenshots_HookScreenshots),
+  LAZY_ENTRY(SteamAPI_ISteamScreenshots_SetLocation),
+  LAZY_ENTRY(SteamAPI_ISteamScreenshots_TagUser),
+  LAZY_ENTRY(SteamAPI_ISteamScreenshots_TagPublishedFile),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_BIsEnabled),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_BIsPlaying),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_GetPlaybackStatus),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_Play),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_Pause),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_PlayPrevious),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_PlayNext),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_SetVolume),
+  LAZY_ENTRY(SteamAPI_ISteamMusic_GetVolume),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_BActivationSuccess),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_SetDisplayName),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_EnablePlayPrevious),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_EnablePlayNext),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_EnableShuffled),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_EnableLooped),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_EnableQueue),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_EnablePlaylists),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_UpdateShuffled),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_UpdateLooped),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_UpdateVolume),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_CurrentEntryWillChange),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_CurrentEntryDidChange),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_QueueWillChange),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_ResetQueueEntries),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_SetQueueEntry),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_QueueDidChange),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_PlaylistWillChange),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_ResetPlaylistEntries),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_SetPlaylistEntry),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry),
+  LAZY_ENTRY(SteamAPI_ISteamMusicRemote_PlaylistDidChange),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_CreateHTTPRequest),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestContextValue),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SendHTTPRequest),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_DeferHTTPRequest),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_PrioritizeHTTPRequest),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_GetHTTPResponseBodySize),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_GetHTTPResponseBodyData),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_ReleaseHTTPRequest),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_CreateCookieContainer),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_ReleaseCookieContainer),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetCookie),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS),
+  LAZY_ENTRY(SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut),
+  LAZY_ENTRY(SteamAPI_ISteamUnifiedMessages_SendMethod),
+  LAZY_ENTRY(SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo),
+  LAZY_ENTRY(SteamAPI_ISteamUnifiedMessages_GetMethodResponseData),
+  LAZY_ENTRY(SteamAPI_ISteamUnifiedMessages_ReleaseMethod),
+  LAZY_ENTRY(SteamAPI_ISteamUnifiedMessages_SendNotification),
+  LAZY_ENTRY(SteamAPI_ISteamController_Init),
+  LAZY_ENTRY(SteamAPI_ISteamController_Shutdown),
+  LAZY_ENTRY(SteamAPI_ISteamController_RunFrame),
+  LAZY_ENTRY(SteamAPI_ISteamController_TriggerHapticPulse),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_CreateQueryUserUGCRequest),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_CreateQueryAllUGCRequest),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SendQueryUGCRequest),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetQueryUGCResult),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetQueryUGCPreviewURL),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetQueryUGCMetadata),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetQueryUGCChildren),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetQueryUGCStatistic),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_ReleaseQueryUGCRequest),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_AddRequiredTag),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_AddExcludedTag),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetReturnLongDescription),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetReturnMetadata),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetReturnChildren),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetReturnAdditionalPreviews),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetReturnTotalOnly),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetAllowCachedResponse),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetCloudFileNameFilter),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetMatchAnyTag),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetSearchText),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetRankedByTrendDays),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_RequestUGCDetails),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_CreateItem),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_StartItemUpdate),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetItemTitle),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetItemDescription),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetItemMetadata),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetItemVisibility),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetItemTags),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetItemContent),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SetItemPreview),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SubmitItemUpdate),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetItemUpdateProgress),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_AddItemToFavorites),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_RemoveItemFromFavorites),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_SubscribeItem),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_UnsubscribeItem),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetNumSubscribedItems),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetSubscribedItems),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetItemState),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetItemInstallInfo),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_GetItemDownloadInfo),
+  LAZY_ENTRY(SteamAPI_ISteamUGC_DownloadItem),
+  LAZY_ENTRY(SteamAPI_ISteamAppList_GetNumInstalledApps),
+  LAZY_ENTRY(SteamAPI_ISteamAppList_GetInstalledApps),
+  LAZY_ENTRY(SteamAPI_ISteamAppList_GetAppName),
+  LAZY_ENTRY(SteamAPI_ISteamAppList_GetAppInstallDir),
+  LAZY_ENTRY(SteamAPI_ISteamAppList_GetAppBuildId),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_Init),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_Shutdown),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_CreateBrowser),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_RemoveBrowser),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_LoadURL),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_SetSize),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_StopLoad),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_Reload),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_GoBack),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_GoForward),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_AddHeader),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_ExecuteJavascript),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_MouseUp),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_MouseDown),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_MouseDoubleClick),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_MouseMove),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_MouseWheel),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_KeyDown),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_KeyUp),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_KeyChar),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_SetHorizontalScroll),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_SetVerticalScroll),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_SetKeyFocus),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_ViewSource),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_CopyToClipboard),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_PasteFromClipboard),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_Find),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_StopFind),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_GetLinkAtPosition),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_SetCookie),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_SetPageScaleFactor),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_SetBackgroundMode),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_AllowStartRequest),
+  LAZY_ENTRY(SteamAPI_ISteamHTMLSurface_JSDialogResponse),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GetResultStatus),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GetResultItems),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GetResultTimestamp),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_CheckResultSteamID),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_DestroyResult),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GetAllItems),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GetItemsByID),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_SerializeResult),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_DeserializeResult),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GenerateItems),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GrantPromoItems),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_AddPromoItem),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_AddPromoItems),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_ConsumeItem),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_ExchangeItems),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_TransferItemQuantity),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_SendItemDropHeartbeat),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_TriggerItemDrop),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_TradeItems),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_LoadItemDefinitions),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GetItemDefinitionIDs),
+  LAZY_ENTRY(SteamAPI_ISteamInventory_GetItemDefinitionProperty),
+  LAZY_ENTRY(SteamAPI_ISteamVideo_GetVideoURL),
+  LAZY_ENTRY(SteamAPI_ISteamVideo_IsBroadcasting),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_InitGameServer),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetProduct),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetGameDescription),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetModDir),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetDedicatedServer),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_LogOn),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_LogOnAnonymous),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_LogOff),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_BLoggedOn),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_BSecure),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_GetSteamID),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_WasRestartRequested),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetMaxPlayerCount),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetBotPlayerCount),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetServerName),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetMapName),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetPasswordProtected),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetSpectatorPort),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetSpectatorServerName),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_ClearAllKeyValues),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetKeyValue),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetGameTags),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetGameData),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetRegion),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SendUserDisconnect),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_BUpdateUserData),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_GetAuthSessionTicket),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_BeginAuthSession),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_EndAuthSession),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_CancelAuthTicket),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_UserHasLicenseForApp),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_RequestUserGroupStatus),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_GetGameplayStats),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_GetServerReputation),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_GetPublicIP),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_HandleIncomingPacket),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_GetNextOutgoingPacket),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_EnableHeartbeats),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_SetHeartbeatInterval),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_ForceHeartbeat),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_AssociateWithClan),
+  LAZY_ENTRY(SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_RequestUserStats),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_GetUserStat),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_GetUserStat0),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_GetUserAchievement),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_SetUserStat),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_SetUserStat0),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_SetUserAchievement),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_ClearUserAchievement),
+  LAZY_ENTRY(SteamAPI_ISteamGameServerStats_StoreUserStats)
+};
+const char *const steamSymbolNames[] = {
+  "SteamAPI_Init",
+  "SteamAPI_Shutdown",
+  "SteamAPI_RestartAppIfNecessary",
+  "SteamAPI_WriteMiniDump",
+  "SteamAPI_SetMiniDumpComment",
+  "SteamAPI_RunCallbacks",
+  "SteamAPI_RegisterCallback",
+  "SteamAPI_UnregisterCallback",
+  "SteamAPI_RegisterCallResult",
+  "SteamAPI_UnregisterCallResult",
+  "SteamAPI_IsSteamRunning",
+  "Steam_RunCallbacks",
+  "Steam_RegisterInterfaceFuncs",
+  "Steam_GetHSteamUserCurrent",
+  "SteamAPI_GetSteamInstallPath",
+  "SteamAPI_GetHSteamPipe",
+  "SteamAPI_SetTryCatchCallbacks",
+  "GetHSteamPipe",
+  "GetHSteamUser",
+  "SteamAPI_InitSafe",
+  "SteamAPI_GetHSteamUser",
+  "SteamAPI_UseBreakpadCrashHandler",
+  "SteamAPI_SetBreakpadAppID",
+  "SteamAPI_ISteamClient_CreateSteamPipe",
+  "SteamAPI_ISteamClient_BReleaseSteamPipe",
+  "SteamAPI_ISteamClient_ConnectToGlobalUser",
+  "SteamAPI_ISteamClient_CreateLocalUser",
+  "SteamAPI_ISteamClient_ReleaseUser",
+  "SteamAPI_ISteamClient_GetISteamUser",
+  "SteamAPI_ISteamClient_GetISteamGameServer",
+  "SteamAPI_ISteamClient_SetLocalIPBinding",
+  "SteamAPI_ISteamClient_GetISteamFriends",
+  "SteamAPI_ISteamClient_GetISteamUtils",
+  "SteamAPI_ISteamClient_GetISteamMatchmaking",
+  "SteamAPI_ISteamClient_GetISteamMatchmakingServers",
+  "SteamAPI_ISteamClient_GetISteamGenericInterface",
+  "SteamAPI_ISteamClient_GetISteamUserStats",
+  "SteamAPI_ISteamClient_GetISteamGameServerStats",
+  "SteamAPI_ISteamClient_GetISteamApps",
+  "SteamAPI_ISteamClient_GetISteamNetworking",
+  "SteamAPI_ISteamClient_GetISteamRemoteStorage",
+  "SteamAPI_ISteamClient_GetISteamScreenshots",
+  "SteamAPI_ISteamClient_GetIPCCallCount",
+  "SteamAPI_ISteamClient_SetWarningMessageHook",
+  "SteamAPI_ISteamClient_BShutdownIfAllPipesClosed",
+  "SteamAPI_ISteamClient_GetISteamHTTP",
+  "SteamAPI_ISteamClient_GetISteamUnifiedMessages",
+  "SteamAPI_ISteamClient_GetISteamController",
+  "SteamAPI_ISteamClient_GetISteamUGC",
+  "SteamAPI_ISteamClient_GetISteamAppList",
+  "SteamAPI_ISteamClient_GetISteamMusic",
+  "SteamAPI_ISteamClient_GetISteamMusicRemote",
+  "SteamAPI_ISteamClient_GetISteamHTMLSurface",
+  "SteamAPI_ISteamClient_GetISteamInventory",
+  "SteamAPI_ISteamClient_GetISteamVideo",
+  "SteamAPI_ISteamUser_GetHSteamUser",
+  "SteamAPI_ISteamUser_BLoggedOn",
+  "SteamAPI_ISteamUser_GetSteamID",
+  "SteamAPI_ISteamUser_InitiateGameConnection",
+  "SteamAPI_ISteamUser_TerminateGameConnection",
+  "SteamAPI_ISteamUser_TrackAppUsageEvent",
+  "SteamAPI_ISteamUser_GetUserDataFolder",
+  "SteamAPI_ISteamUser_StartVoiceRecording",
+  "SteamAPI_ISteamUser_StopVoiceRecording",
+  "SteamAPI_ISteamUser_GetAvailableVoice",
+  "SteamAPI_ISteamUser_GetVoice",
+  "SteamAPI_ISteamUser_DecompressVoice",
+  "SteamAPI_ISteamUser_GetVoiceOptimalSampleRate",
+  "SteamAPI_ISteamUser_GetAuthSessionTicket",
+  "SteamAPI_ISteamUser_BeginAuthSession",
+  "SteamAPI_ISteamUser_EndAuthSession",
+  "SteamAPI_ISteamUser_CancelAuthTicket",
+  "SteamAPI_ISteamUser_UserHasLicenseForApp",
+  "SteamAPI_ISteamUser_BIsBehindNAT",
+  "SteamAPI_ISteamUser_AdvertiseGame",
+  "SteamAPI_ISteamUser_RequestEncryptedAppTicket",
+  "SteamAPI_ISteamUser_GetEncryptedAppTicket",
+  "SteamAPI_ISteamUser_GetGameBadgeLevel",
+  "SteamAPI_ISteamUser_GetPlayerSteamLevel",
+  "SteamAPI_ISteamUser_RequestStoreAuthURL",
+  "SteamAPI_ISteamFriends_GetPersonaName",
+  "SteamAPI_ISteamFriends_SetPersonaName",
+  "SteamAPI_ISteamFriends_GetPersonaState",
+  "SteamAPI_ISteamFriends_GetFriendCount",
+  "SteamAPI_ISteamFriends_GetFriendByIndex",
+  "SteamAPI_ISteamFriends_GetFriendRelationship",
+  "SteamAPI_ISteamFriends_GetFriendPersonaState",
+  "SteamAPI_ISteamFriends_GetFriendPersonaName",
+  "SteamAPI_ISteamFriends_GetFriendGamePlayed",
+  "SteamAPI_ISteamFriends_GetFriendPersonaNameHistory",
+  "SteamAPI_ISteamFriends_GetFriendSteamLevel",
+  "SteamAPI_ISteamFriends_GetPlayerNickname",
+  "SteamAPI_ISteamFriends_GetFriendsGroupCount",
+  "SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex",
+  "SteamAPI_ISteamFriends_GetFriendsGroupName",
+  "SteamAPI_ISteamFriends_GetFriendsGroupMembersCount",
+  "SteamAPI_ISteamFriends_GetFriendsGroupMembersList",
+  "SteamAPI_ISteamFriends_HasFriend",
+  "SteamAPI_ISteamFriends_GetClanCount",
+  "SteamAPI_ISteamFriends_GetClanByIndex",
+  "SteamAPI_ISteamFriends_GetClanName",
+  "SteamAPI_ISteamFriends_GetClanTag",
+  "SteamAPI_ISteamFriends_GetClanActivityCounts",
+  "SteamAPI_ISteamFriends_DownloadClanActivityCounts",
+  "SteamAPI_ISteamFriends_GetFriendCountFromSource",
+  "SteamAPI_ISteamFriends_GetFriendFromSourceByIndex",
+  "SteamAPI_ISteamFriends_IsUserInSource",
+  "SteamAPI_ISteamFriends_SetInGameVoiceSpeaking",
+  "SteamAPI_ISteamFriends_ActivateGameOverlay",
+  "SteamAPI_ISteamFriends_ActivateGameOverlayToUser",
+  "SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage",
+  "SteamAPI_ISteamFriends_ActivateGameOverlayToStore",
+  "SteamAPI_ISteamFriends_SetPlayedWith",
+  "SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog",
+  "SteamAPI_ISteamFriends_GetSmallFriendAvatar",
+  "SteamAPI_ISteamFriends_GetMediumFriendAvatar",
+  "SteamAPI_ISteamFriends_GetLargeFriendAvatar",
+  "SteamAPI_ISteamFriends_RequestUserInformation",
+  "SteamAPI_ISteamFriends_RequestClanOfficerList",
+  "SteamAPI_ISteamFriends_GetClanOwner",
+  "SteamAPI_ISteamFriends_GetClanOfficerCount",
+  "SteamAPI_ISteamFriends_GetClanOfficerByIndex",
+  "SteamAPI_ISteamFriends_GetUserRestrictions",
+  "SteamAPI_ISteamFriends_SetRichPresence",
+  "SteamAPI_ISteamFriends_ClearRichPresence",
+  "SteamAPI_ISteamFriends_GetFriendRichPresence",
+  "SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount",
+  "SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex",
+  "SteamAPI_ISteamFriends_RequestFriendRichPresence",
+  "SteamAPI_ISteamFriends_InviteUserToGame",
+  "SteamAPI_ISteamFriends_GetCoplayFriendCount",
+  "SteamAPI_ISteamFriends_GetCoplayFriend",
+  "SteamAPI_ISteamFriends_GetFriendCoplayTime",
+  "SteamAPI_ISteamFriends_GetFriendCoplayGame",
+  "SteamAPI_ISteamFriends_JoinClanChatRoom",
+  "SteamAPI_ISteamFriends_LeaveClanChatRoom",
+  "SteamAPI_ISteamFriends_GetClanChatMemberCount",
+  "SteamAPI_ISteamFriends_GetChatMemberByIndex",
+  "SteamAPI_ISteamFriends_SendClanChatMessage",
+  "SteamAPI_ISteamFriends_GetClanChatMessage",
+  "SteamAPI_ISteamFriends_IsClanChatAdmin",
+  "SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam",
+  "SteamAPI_ISteamFriends_OpenClanChatWindowInSteam",
+  "SteamAPI_ISteamFriends_CloseClanChatWindowInSteam",
+  "SteamAPI_ISteamFriends_SetListenForFriendsMessages",
+  "SteamAPI_ISteamFriends_ReplyToFriendMessage",
+  "SteamAPI_ISteamFriends_GetFriendMessage",
+  "SteamAPI_ISteamFriends_GetFollowerCount",
+  "SteamAPI_ISteamFriends_IsFollowing",
+  "SteamAPI_ISteamFriends_EnumerateFollowingList",
+  "SteamAPI_ISteamUtils_GetSecondsSinceAppActive",
+  "SteamAPI_ISteamUtils_GetSecondsSinceComputerActive",
+  "SteamAPI_ISteamUtils_GetConnectedUniverse",
+  "SteamAPI_ISteamUtils_GetServerRealTime",
+  "SteamAPI_ISteamUtils_GetIPCountry",
+  "SteamAPI_ISteamUtils_GetImageSize",
+  "SteamAPI_ISteamUtils_GetImageRGBA",
+  "SteamAPI_ISteamUtils_GetCSERIPPort",
+  "SteamAPI_ISteamUtils_GetCurrentBatteryPower",
+  "SteamAPI_ISteamUtils_GetAppID",
+  "SteamAPI_ISteamUtils_SetOverlayNotificationPosition",
+  "SteamAPI_ISteamUtils_IsAPICallCompleted",
+  "SteamAPI_ISteamUtils_GetAPICallFailureReason",
+  "SteamAPI_ISteamUtils_GetAPICallResult",
+  "SteamAPI_ISteamUtils_GetIPCCallCount",
+  "SteamAPI_ISteamUtils_SetWarningMessageHook",
+  "SteamAPI_ISteamUtils_IsOverlayEnabled",
+  "SteamAPI_ISteamUtils_BOverlayNeedsPresent",
+  "SteamAPI_ISteamUtils_CheckFileSignature",
+  "SteamAPI_ISteamUtils_ShowGamepadTextInput",
+  "SteamAPI_ISteamUtils_GetEnteredGamepadTextLength",
+  "SteamAPI_ISteamUtils_GetEnteredGamepadTextInput",
+  "SteamAPI_ISteamUtils_GetSteamUILanguage",
+  "SteamAPI_ISteamUtils_IsSteamRunningInVR",
+  "SteamAPI_ISteamMatchmaking_GetFavoriteGameCount",
+  "SteamAPI_ISteamMatchmaking_GetFavoriteGame",
+  "SteamAPI_ISteamMatchmaking_AddFavoriteGame",
+  "SteamAPI_ISteamMatchmaking_RemoveFavoriteGame",
+  "SteamAPI_ISteamMatchmaking_RequestLobbyList",
+  "SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter",
+  "SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter",
+  "SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter",
+  "SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable",
+  "SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter",
+  "SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter",
+  "SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter",
+  "SteamAPI_ISteamMatchmaking_GetLobbyByIndex",
+  "SteamAPI_ISteamMatchmaking_CreateLobby",
+  "SteamAPI_ISteamMatchmaking_JoinLobby",
+  "SteamAPI_ISteamMatchmaking_LeaveLobby",
+  "SteamAPI_ISteamMatchmaking_InviteUserToLobby",
+  "SteamAPI_ISteamMatchmaking_GetNumLobbyMembers",
+  "SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex",
+  "SteamAPI_ISteamMatchmaking_GetLobbyData",
+  "SteamAPI_ISteamMatchmaking_SetLobbyData",
+  "SteamAPI_ISteamMatchmaking_GetLobbyDataCount",
+  "SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex",
+  "SteamAPI_ISteamMatchmaking_DeleteLobbyData",
+  "SteamAPI_ISteamMatchmaking_GetLobbyMemberData",
+  "SteamAPI_ISteamMatchmaking_SetLobbyMemberData",
+  "SteamAPI_ISteamMatchmaking_SendLobbyChatMsg",
+  "SteamAPI_ISteamMatchmaking_GetLobbyChatEntry",
+  "SteamAPI_ISteamMatchmaking_RequestLobbyData",
+  "SteamAPI_ISteamMatchmaking_SetLobbyGameServer",
+  "SteamAPI_ISteamMatchmaking_GetLobbyGameServer",
+  "SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit",
+  "SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit",
+  "SteamAPI_ISteamMatchmaking_SetLobbyType",
+  "SteamAPI_ISteamMatchmaking_SetLobbyJoinable",
+  "SteamAPI_ISteamMatchmaking_GetLobbyOwner",
+  "SteamAPI_ISteamMatchmaking_SetLobbyOwner",
+  "SteamAPI_ISteamMatchmaking_SetLinkedLobby",
+  "SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded",
+  "SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond",
+  "SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete",
+  "SteamAPI_ISteamMatchmakingPingResponse_ServerResponded",
+  "SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond",
+  "SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList",
+  "SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond",
+  "SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete",
+  "SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded",
+  "SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond",
+  "SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete",
+  "SteamAPI_ISteamMatchmakingServers_RequestInternetServerList",
+  "SteamAPI_ISteamMatchmakingServers_RequestLANServerList",
+  "SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList",
+  "SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList",
+  "SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList",
+  "SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList",
+  "SteamAPI_ISteamMatchmakingServers_ReleaseRequest",
+  "SteamAPI_ISteamMatchmakingServers_GetServerDetails",
+  "SteamAPI_ISteamMatchmakingServers_CancelQuery",
+  "SteamAPI_ISteamMatchmakingServers_RefreshQuery",
+  "SteamAPI_ISteamMatchmakingServers_IsRefreshing",
+  "SteamAPI_ISteamMatchmakingServers_GetServerCount",
+  "SteamAPI_ISteamMatchmakingServers_RefreshServer",
+  "SteamAPI_ISteamMatchmakingServers_PingServer",
+  "SteamAPI_ISteamMatchmakingServers_PlayerDetails",
+  "SteamAPI_ISteamMatchmakingServers_ServerRules",
+  "SteamAPI_ISteamMatchmakingServers_CancelServerQuery",
+  "SteamAPI_ISteamRemoteStorage_FileWrite",
+  "SteamAPI_ISteamRemoteStorage_FileRead",
+  "SteamAPI_ISteamRemoteStorage_FileForget",
+  "SteamAPI_ISteamRemoteStorage_FileDelete",
+  "SteamAPI_ISteamRemoteStorage_FileShare",
+  "SteamAPI_ISteamRemoteStorage_SetSyncPlatforms",
+  "SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen",
+  "SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk",
+  "SteamAPI_ISteamRemoteStorage_FileWriteStreamClose",
+  "SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel",
+  "SteamAPI_ISteamRemoteStorage_FileExists",
+  "SteamAPI_ISteamRemoteStorage_FilePersisted",
+  "SteamAPI_ISteamRemoteStorage_GetFileSize",
+  "SteamAPI_ISteamRemoteStorage_GetFileTimestamp",
+  "SteamAPI_ISteamRemoteStorage_GetSyncPlatforms",
+  "SteamAPI_ISteamRemoteStorage_GetFileCount",
+  "SteamAPI_ISteamRemoteStorage_GetFileNameAndSize",
+  "SteamAPI_ISteamRemoteStorage_GetQuota",
+  "SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount",
+  "SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp",
+  "SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp",
+  "SteamAPI_ISteamRemoteStorage_UGCDownload",
+  "SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress",
+  "SteamAPI_ISteamRemoteStorage_GetUGCDetails",
+  "SteamAPI_ISteamRemoteStorage_UGCRead",
+  "SteamAPI_ISteamRemoteStorage_GetCachedUGCCount",
+  "SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle",
+  "SteamAPI_ISteamRemoteStorage_PublishWorkshopFile",
+  "SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest",
+  "SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile",
+  "SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile",
+  "SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle",
+  "SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription",
+  "SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility",
+  "SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags",
+  "SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate",
+  "SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails",
+  "SteamAPI_ISteamRemoteStorage_DeletePublishedFile",
+  "SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles",
+  "SteamAPI_ISteamRemoteStorage_SubscribePublishedFile",
+  "SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles",
+  "SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile",
+  "SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription",
+  "SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails",
+  "SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote",
+  "SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails",
+  "SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles",
+  "SteamAPI_ISteamRemoteStorage_PublishVideo",
+  "SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction",
+  "SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction",
+  "SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles",
+  "SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation",
+  "SteamAPI_ISteamUserStats_RequestCurrentStats",
+  "SteamAPI_ISteamUserStats_GetStat",
+  "SteamAPI_ISteamUserStats_GetStat0",
+  "SteamAPI_ISteamUserStats_SetStat",
+  "SteamAPI_ISteamUserStats_SetStat0",
+  "SteamAPI_ISteamUserStats_UpdateAvgRateStat",
+  "SteamAPI_ISteamUserStats_GetAchievement",
+  "SteamAPI_ISteamUserStats_SetAchievement",
+  "SteamAPI_ISteamUserStats_ClearAchievement",
+  "SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime",
+  "SteamAPI_ISteamUserStats_StoreStats",
+  "SteamAPI_ISteamUserStats_GetAchievementIcon",
+  "SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute",
+  "SteamAPI_ISteamUserStats_IndicateAchievementProgress",
+  "SteamAPI_ISteamUserStats_GetNumAchievements",
+  "SteamAPI_ISteamUserStats_GetAchievementName",
+  "SteamAPI_ISteamUserStats_RequestUserStats",
+  "SteamAPI_ISteamUserStats_GetUserStat",
+  "SteamAPI_ISteamUserStats_GetUserStat0",
+  "SteamAPI_ISteamUserStats_GetUserAchievement",
+  "SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime",
+  "SteamAPI_ISteamUserStats_ResetAllStats",
+  "SteamAPI_ISteamUserStats_FindOrCreateLeaderboard",
+  "SteamAPI_ISteamUserStats_FindLeaderboard",
+  "SteamAPI_ISteamUserStats_GetLeaderboardName",
+  "SteamAPI_ISteamUserStats_GetLeaderboardEntryCount",
+  "SteamAPI_ISteamUserStats_GetLeaderboardSortMethod",
+  "SteamAPI_ISteamUserStats_GetLeaderboardDisplayType",
+  "SteamAPI_ISteamUserStats_DownloadLeaderboardEntries",
+  "SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers",
+  "SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry",
+  "SteamAPI_ISteamUserStats_UploadLeaderboardScore",
+  "SteamAPI_ISteamUserStats_AttachLeaderboardUGC",
+  "SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers",
+  "SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages",
+  "SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo",
+  "SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo",
+  "SteamAPI_ISteamUserStats_GetAchievementAchievedPercent",
+  "SteamAPI_ISteamUserStats_RequestGlobalStats",
+  "SteamAPI_ISteamUserStats_GetGlobalStat",
+  "SteamAPI_ISteamUserStats_GetGlobalStat0",
+  "SteamAPI_ISteamUserStats_GetGlobalStatHistory",
+  "SteamAPI_ISteamUserStats_GetGlobalStatHistory0",
+  "SteamAPI_ISteamApps_BIsSubscribed",
+  "SteamAPI_ISteamApps_BIsLowViolence",
+  "SteamAPI_ISteamApps_BIsCybercafe",
+  "SteamAPI_ISteamApps_BIsVACBanned",
+  "SteamAPI_ISteamApps_GetCurrentGameLanguage",
+  "SteamAPI_ISteamApps_GetAvailableGameLanguages",
+  "SteamAPI_ISteamApps_BIsSubscribedApp",
+  "SteamAPI_ISteamApps_BIsDlcInstalled",
+  "SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime",
+  "SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend",
+  "SteamAPI_ISteamApps_GetDLCCount",
+  "SteamAPI_ISteamApps_BGetDLCDataByIndex",
+  "SteamAPI_ISteamApps_InstallDLC",
+  "SteamAPI_ISteamApps_UninstallDLC",
+  "SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey",
+  "SteamAPI_ISteamApps_GetCurrentBetaName",
+  "SteamAPI_ISteamApps_MarkContentCorrupt",
+  "SteamAPI_ISteamApps_GetInstalledDepots",
+  "SteamAPI_ISteamApps_GetAppInstallDir",
+  "SteamAPI_ISteamApps_BIsAppInstalled",
+  "SteamAPI_ISteamApps_GetAppOwner",
+  "SteamAPI_ISteamApps_GetLaunchQueryParam",
+  "SteamAPI_ISteamApps_GetDlcDownloadProgress",
+  "SteamAPI_ISteamApps_GetAppBuildId",
+  "SteamAPI_ISteamNetworking_SendP2PPacket",
+  "SteamAPI_ISteamNetworking_IsP2PPacketAvailable",
+  "SteamAPI_ISteamNetworking_ReadP2PPacket",
+  "SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser",
+  "SteamAPI_ISteamNetworking_CloseP2PSessionWithUser",
+  "SteamAPI_ISteamNetworking_CloseP2PChannelWithUser",
+  "SteamAPI_ISteamNetworking_GetP2PSessionState",
+  "SteamAPI_ISteamNetworking_AllowP2PPacketRelay",
+  "SteamAPI_ISteamNetworking_CreateListenSocket",
+  "SteamAPI_ISteamNetworking_CreateP2PConnectionSocket",
+  "SteamAPI_ISteamNetworking_CreateConnectionSocket",
+  "SteamAPI_ISteamNetworking_DestroySocket",
+  "SteamAPI_ISteamNetworking_DestroyListenSocket",
+  "SteamAPI_ISteamNetworking_SendDataOnSocket",
+  "SteamAPI_ISteamNetworking_IsDataAvailableOnSocket",
+  "SteamAPI_ISteamNetworking_RetrieveDataFromSocket",
+  "SteamAPI_ISteamNetworking_IsDataAvailable",
+  "SteamAPI_ISteamNetworking_RetrieveData",
+  "SteamAPI_ISteamNetworking_GetSocketInfo",
+  "SteamAPI_ISteamNetworking_GetListenSocketInfo",
+  "SteamAPI_ISteamNetworking_GetSocketConnectionType",
+  "SteamAPI_ISteamNetworking_GetMaxPacketSize",
+  "SteamAPI_ISteamScreenshots_WriteScreenshot",
+  "SteamAPI_ISteamScreenshots_AddScreenshotToLibrary",
+  "SteamAPI_ISteamScreenshots_TriggerScreenshot",
+  "SteamAPI_ISteamScreenshots_HookScreenshots",
+  "SteamAPI_ISteamScreenshots_SetLocation",
+  "SteamAPI_ISteamScreenshots_TagUser",
+  "SteamAPI_ISteamScreenshots_TagPublishedFile",
+  "SteamAPI_ISteamMusic_BIsEnabled",
+  "SteamAPI_ISteamMusic_BIsPlaying",
+  "SteamAPI_ISteamMusic_GetPlaybackStatus",
+  "SteamAPI_ISteamMusic_Play",
+  "SteamAPI_ISteamMusic_Pause",
+  "SteamAPI_ISteamMusic_PlayPrevious",
+  "SteamAPI_ISteamMusic_PlayNext",
+  "SteamAPI_ISteamMusic_SetVolume",
+  "SteamAPI_ISteamMusic_GetVolume",
+  "SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote",
+  "SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote",
+  "SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote",
+  "SteamAPI_ISteamMusicRemote_BActivationSuccess",
+  "SteamAPI_ISteamMusicRemote_SetDisplayName",
+  "SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64",
+  "SteamAPI_ISteamMusicRemote_EnablePlayPrevious",
+  "SteamAPI_ISteamMusicRemote_EnablePlayNext",
+  "SteamAPI_ISteamMusicRemote_EnableShuffled",
+  "SteamAPI_ISteamMusicRemote_EnableLooped",
+  "SteamAPI_ISteamMusicRemote_EnableQueue",
+  "SteamAPI_ISteamMusicRemote_EnablePlaylists",
+  "SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus",
+  "SteamAPI_ISteamMusicRemote_UpdateShuffled",
+  "SteamAPI_ISteamMusicRemote_UpdateLooped",
+  "SteamAPI_ISteamMusicRemote_UpdateVolume",
+  "SteamAPI_ISteamMusicRemote_CurrentEntryWillChange",
+  "SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable",
+  "SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText",
+  "SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds",
+  "SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt",
+  "SteamAPI_ISteamMusicRemote_CurrentEntryDidChange",
+  "SteamAPI_ISteamMusicRemote_QueueWillChange",
+  "SteamAPI_ISteamMusicRemote_ResetQueueEntries",
+  "SteamAPI_ISteamMusicRemote_SetQueueEntry",
+  "SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry",
+  "SteamAPI_ISteamMusicRemote_QueueDidChange",
+  "SteamAPI_ISteamMusicRemote_PlaylistWillChange",
+  "SteamAPI_ISteamMusicRemote_ResetPlaylistEntries",
+  "SteamAPI_ISteamMusicRemote_SetPlaylistEntry",
+  "SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry",
+  "SteamAPI_ISteamMusicRemote_PlaylistDidChange",
+  "SteamAPI_ISteamHTTP_CreateHTTPRequest",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestContextValue",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter",
+  "SteamAPI_ISteamHTTP_SendHTTPRequest",
+  "SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse",
+  "SteamAPI_ISteamHTTP_DeferHTTPRequest",
+  "SteamAPI_ISteamHTTP_PrioritizeHTTPRequest",
+  "SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize",
+  "SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue",
+  "SteamAPI_ISteamHTTP_GetHTTPResponseBodySize",
+  "SteamAPI_ISteamHTTP_GetHTTPResponseBodyData",
+  "SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData",
+  "SteamAPI_ISteamHTTP_ReleaseHTTPRequest",
+  "SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody",
+  "SteamAPI_ISteamHTTP_CreateCookieContainer",
+  "SteamAPI_ISteamHTTP_ReleaseCookieContainer",
+  "SteamAPI_ISteamHTTP_SetCookie",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate",
+  "SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS",
+  "SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut",
+  "SteamAPI_ISteamUnifiedMessages_SendMethod",
+  "SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo",
+  "SteamAPI_ISteamUnifiedMessages_GetMethodResponseData",
+  "SteamAPI_ISteamUnifiedMessages_ReleaseMethod",
+  "SteamAPI_ISteamUnifiedMessages_SendNotification",
+  "SteamAPI_ISteamController_Init",
+  "SteamAPI_ISteamController_Shutdown",
+  "SteamAPI_ISteamController_RunFrame",
+  "SteamAPI_ISteamController_TriggerHapticPulse",
+  "SteamAPI_ISteamUGC_CreateQueryUserUGCRequest",
+  "SteamAPI_ISteamUGC_CreateQueryAllUGCRequest",
+  "SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest",
+  "SteamAPI_ISteamUGC_SendQueryUGCRequest",
+  "SteamAPI_ISteamUGC_GetQueryUGCResult",
+  "SteamAPI_ISteamUGC_GetQueryUGCPreviewURL",
+  "SteamAPI_ISteamUGC_GetQueryUGCMetadata",
+  "SteamAPI_ISteamUGC_GetQueryUGCChildren",
+  "SteamAPI_ISteamUGC_GetQueryUGCStatistic",
+  "SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews",
+  "SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview",
+  "SteamAPI_ISteamUGC_ReleaseQueryUGCRequest",
+  "SteamAPI_ISteamUGC_AddRequiredTag",
+  "SteamAPI_ISteamUGC_AddExcludedTag",
+  "SteamAPI_ISteamUGC_SetReturnLongDescription",
+  "SteamAPI_ISteamUGC_SetReturnMetadata",
+  "SteamAPI_ISteamUGC_SetReturnChildren",
+  "SteamAPI_ISteamUGC_SetReturnAdditionalPreviews",
+  "SteamAPI_ISteamUGC_SetReturnTotalOnly",
+  "SteamAPI_ISteamUGC_SetAllowCachedResponse",
+  "SteamAPI_ISteamUGC_SetCloudFileNameFilter",
+  "SteamAPI_ISteamUGC_SetMatchAnyTag",
+  "SteamAPI_ISteamUGC_SetSearchText",
+  "SteamAPI_ISteamUGC_SetRankedByTrendDays",
+  "SteamAPI_ISteamUGC_RequestUGCDetails",
+  "SteamAPI_ISteamUGC_CreateItem",
+  "SteamAPI_ISteamUGC_StartItemUpdate",
+  "SteamAPI_ISteamUGC_SetItemTitle",
+  "SteamAPI_ISteamUGC_SetItemDescription",
+  "SteamAPI_ISteamUGC_SetItemMetadata",
+  "SteamAPI_ISteamUGC_SetItemVisibility",
+  "SteamAPI_ISteamUGC_SetItemTags",
+  "SteamAPI_ISteamUGC_SetItemContent",
+  "SteamAPI_ISteamUGC_SetItemPreview",
+  "SteamAPI_ISteamUGC_SubmitItemUpdate",
+  "SteamAPI_ISteamUGC_GetItemUpdateProgress",
+  "SteamAPI_ISteamUGC_AddItemToFavorites",
+  "SteamAPI_ISteamUGC_RemoveItemFromFavorites",
+  "SteamAPI_ISteamUGC_SubscribeItem",
+  "SteamAPI_ISteamUGC_UnsubscribeItem",
+  "SteamAPI_ISteamUGC_GetNumSubscribedItems",
+  "SteamAPI_ISteamUGC_GetSubscribedItems",
+  "SteamAPI_ISteamUGC_GetItemState",
+  "SteamAPI_ISteamUGC_GetItemInstallInfo",
+  "SteamAPI_ISteamUGC_GetItemDownloadInfo",
+  "SteamAPI_ISteamUGC_DownloadItem",
+  "SteamAPI_ISteamAppList_GetNumInstalledApps",
+  "SteamAPI_ISteamAppList_GetInstalledApps",
+  "SteamAPI_ISteamAppList_GetAppName",
+  "SteamAPI_ISteamAppList_GetAppInstallDir",
+  "SteamAPI_ISteamAppList_GetAppBuildId",
+  "SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface",
+  "SteamAPI_ISteamHTMLSurface_Init",
+  "SteamAPI_ISteamHTMLSurface_Shutdown",
+  "SteamAPI_ISteamHTMLSurface_CreateBrowser",
+  "SteamAPI_ISteamHTMLSurface_RemoveBrowser",
+  "SteamAPI_ISteamHTMLSurface_LoadURL",
+  "SteamAPI_ISteamHTMLSurface_SetSize",
+  "SteamAPI_ISteamHTMLSurface_StopLoad",
+  "SteamAPI_ISteamHTMLSurface_Reload",
+  "SteamAPI_ISteamHTMLSurface_GoBack",
+  "SteamAPI_ISteamHTMLSurface_GoForward",
+  "SteamAPI_ISteamHTMLSurface_AddHeader",
+  "SteamAPI_ISteamHTMLSurface_ExecuteJavascript",
+  "SteamAPI_ISteamHTMLSurface_MouseUp",
+  "SteamAPI_ISteamHTMLSurface_MouseDown",
+  "SteamAPI_ISteamHTMLSurface_MouseDoubleClick",
+  "SteamAPI_ISteamHTMLSurface_MouseMove",
+  "SteamAPI_ISteamHTMLSurface_MouseWheel",
+  "SteamAPI_ISteamHTMLSurface_KeyDown",
+  "SteamAPI_ISteamHTMLSurface_KeyUp",
+  "SteamAPI_ISteamHTMLSurface_KeyChar",
+  "SteamAPI_ISteamHTMLSurface_SetHorizontalScroll",
+  "SteamAPI_ISteamHTMLSurface_SetVerticalScroll",
+  "SteamAPI_ISteamHTMLSurface_SetKeyFocus",
+  "SteamAPI_ISteamHTMLSurface_ViewSource",
+  "SteamAPI_ISteamHTMLSurface_CopyToClipboard",
+  "SteamAPI_ISteamHTMLSurface_PasteFromClipboard",
+  "SteamAPI_ISteamHTMLSurface_Find",
+  "SteamAPI_ISteamHTMLSurface_StopFind",
+  "SteamAPI_ISteamHTMLSurface_GetLinkAtPosition",
+  "SteamAPI_ISteamHTMLSurface_SetCookie",
+  "SteamAPI_ISteamHTMLSurface_SetPageScaleFactor",
+  "SteamAPI_ISteamHTMLSurface_SetBackgroundMode",
+  "SteamAPI_ISteamHTMLSurface_AllowStartRequest",
+  "SteamAPI_ISteamHTMLSurface_JSDialogResponse",
+  "SteamAPI_ISteamInventory_GetResultStatus",
+  "SteamAPI_ISteamInventory_GetResultItems",
+  "SteamAPI_ISteamInventory_GetResultTimestamp",
+  "SteamAPI_ISteamInventory_CheckResultSteamID",
+  "SteamAPI_ISteamInventory_DestroyResult",
+  "SteamAPI_ISteamInventory_GetAllItems",
+  "SteamAPI_ISteamInventory_GetItemsByID",
+  "SteamAPI_ISteamInventory_SerializeResult",
+  "SteamAPI_ISteamInventory_DeserializeResult",
+  "SteamAPI_ISteamInventory_GenerateItems",
+  "SteamAPI_ISteamInventory_GrantPromoItems",
+  "SteamAPI_ISteamInventory_AddPromoItem",
+  "SteamAPI_ISteamInventory_AddPromoItems",
+  "SteamAPI_ISteamInventory_ConsumeItem",
+  "SteamAPI_ISteamInventory_ExchangeItems",
+  "SteamAPI_ISteamInventory_TransferItemQuantity",
+  "SteamAPI_ISteamInventory_SendItemDropHeartbeat",
+  "SteamAPI_ISteamInventory_TriggerItemDrop",
+  "SteamAPI_ISteamInventory_TradeItems",
+  "SteamAPI_ISteamInventory_LoadItemDefinitions",
+  "SteamAPI_ISteamInventory_GetItemDefinitionIDs",
+  "SteamAPI_ISteamInventory_GetItemDefinitionProperty",
+  "SteamAPI_ISteamVideo_GetVideoURL",
+  "SteamAPI_ISteamVideo_IsBroadcasting",
+  "SteamAPI_ISteamGameServer_InitGameServer",
+  "SteamAPI_ISteamGameServer_SetProduct",
+  "SteamAPI_ISteamGameServer_SetGameDescription",
+  "SteamAPI_ISteamGameServer_SetModDir",
+  "SteamAPI_ISteamGameServer_SetDedicatedServer",
+  "SteamAPI_ISteamGameServer_LogOn",
+  "SteamAPI_ISteamGameServer_LogOnAnonymous",
+  "SteamAPI_ISteamGameServer_LogOff",
+  "SteamAPI_ISteamGameServer_BLoggedOn",
+  "SteamAPI_ISteamGameServer_BSecure",
+  "SteamAPI_ISteamGameServer_GetSteamID",
+  "SteamAPI_ISteamGameServer_WasRestartRequested",
+  "SteamAPI_ISteamGameServer_SetMaxPlayerCount",
+  "SteamAPI_ISteamGameServer_SetBotPlayerCount",
+  "SteamAPI_ISteamGameServer_SetServerName",
+  "SteamAPI_ISteamGameServer_SetMapName",
+  "SteamAPI_ISteamGameServer_SetPasswordProtected",
+  "SteamAPI_ISteamGameServer_SetSpectatorPort",
+  "SteamAPI_ISteamGameServer_SetSpectatorServerName",
+  "SteamAPI_ISteamGameServer_ClearAllKeyValues",
+  "SteamAPI_ISteamGameServer_SetKeyValue",
+  "SteamAPI_ISteamGameServer_SetGameTags",
+  "SteamAPI_ISteamGameServer_SetGameData",
+  "SteamAPI_ISteamGameServer_SetRegion",
+  "SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate",
+  "SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection",
+  "SteamAPI_ISteamGameServer_SendUserDisconnect",
+  "SteamAPI_ISteamGameServer_BUpdateUserData",
+  "SteamAPI_ISteamGameServer_GetAuthSessionTicket",
+  "SteamAPI_ISteamGameServer_BeginAuthSession",
+  "SteamAPI_ISteamGameServer_EndAuthSession",
+  "SteamAPI_ISteamGameServer_CancelAuthTicket",
+  "SteamAPI_ISteamGameServer_UserHasLicenseForApp",
+  "SteamAPI_ISteamGameServer_RequestUserGroupStatus",
+  "SteamAPI_ISteamGameServer_GetGameplayStats",
+  "SteamAPI_ISteamGameServer_GetServerReputation",
+  "SteamAPI_ISteamGameServer_GetPublicIP",
+  "SteamAPI_ISteamGameServer_HandleIncomingPacket",
+  "SteamAPI_ISteamGameServer_GetNextOutgoingPacket",
+  "SteamAPI_ISteamGameServer_EnableHeartbeats",
+  "SteamAPI_ISteamGameServer_SetHeartbeatInterval",
+  "SteamAPI_ISteamGameServer_ForceHeartbeat",
+  "SteamAPI_ISteamGameServer_AssociateWithClan",
+  "SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility",
+  "SteamAPI_ISteamGameServerStats_RequestUserStats",
+  "SteamAPI_ISteamGameServerStats_GetUserStat",
+  "SteamAPI_ISteamGameServerStats_GetUserStat0",
+  "SteamAPI_ISteamGameServerStats_GetUserAchievement",
+  "SteamAPI_ISteamGameServerStats_SetUserStat",
+  "SteamAPI_ISteamGameServerStats_SetUserStat0",
+  "SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat",
+  "SteamAPI_ISteamGameServerStats_SetUserAchievement",
+  "SteamAPI_ISteamGameServerStats_ClearUserAchievement",
+  "SteamAPI_ISteamGameServerStats_StoreUserStats"
+};
+}
+const unsigned steamSymbolCount = 627;
+#endif
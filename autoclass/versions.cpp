@@ -0,0 +1,205 @@
+#include <steam_api_.h>
+
+static void *wrapISteamAppList(void *internal, const char *version)
+{
+  return internInterface<ISteamAppList_, ISteamAppList>("ISteamAppList", (ISteamAppList *)internal, version);
+}
+
+static void *wrapISteamApps(void *internal, const char *version)
+{
+  return internInterface<ISteamApps_, ISteamApps>("ISteamApps", (ISteamApps *)internal, version);
+}
+
+static void *wrapISteamAppTicket(void *internal, const char *version)
+{
+  return internInterface<ISteamAppTicket_, ISteamAppTicket>("ISteamAppTicket", (ISteamAppTicket *)internal, version);
+}
+
+static void *wrapISteamClient(void *internal, const char *version)
+{
+  return internInterface<ISteamClient_, ISteamClient>("ISteamClient", (ISteamClient *)internal, version);
+}
+
+static void *wrapISteamController(void *internal, const char *version)
+{
+  return internInterface<ISteamController_, ISteamController>("ISteamController", (ISteamController *)internal, version);
+}
+
+static void *wrapISteamFriends(void *internal, const char *version)
+{
+  return internInterface<ISteamFriends_, ISteamFriends>("ISteamFriends", (ISteamFriends *)internal, version);
+}
+
+static void *wrapISteamGameCoordinator(void *internal, const char *version)
+{
+  return internInterface<ISteamGameCoordinator_, ISteamGameCoordinator>("ISteamGameCoordinator", (ISteamGameCoordinator *)internal, version);
+}
+
+static void *wrapISteamGameServer(void *internal, const char *version)
+{
+  return internInterface<ISteamGameServer_, ISteamGameServer>("ISteamGameServer", (ISteamGameServer *)internal, version);
+}
+
+static void *wrapISteamGameServerStats(void *internal, const char *version)
+{
+  return internInterface<ISteamGameServerStats_, ISteamGameServerStats>("ISteamGameServerStats", (ISteamGameServerStats *)internal, version);
+}
+
+static void *wrapISteamHTMLSurface(void *internal, const char *version)
+{
+  return internInterface<ISteamHTMLSurface_, ISteamHTMLSurface>("ISteamHTMLSurface", (ISteamHTMLSurface *)internal, version);
+}
+
+static void *wrapISteamHTTP(void *internal, const char *version)
+{
+  return internInterface<ISteamHTTP_, ISteamHTTP>("ISteamHTTP", (ISteamHTTP *)internal, version);
+}
+
+static void *wrapISteamInventory(void *internal, const char *version)
+{
+  return internInterface<ISteamInventory_, ISteamInventory>("ISteamInventory", (ISteamInventory *)internal, version);
+}
+
+static void *wrapISteamMatchmaking(void *internal, const char *version)
+{
+  return internInterface<ISteamMatchmaking_, ISteamMatchmaking>("ISteamMatchmaking", (ISteamMatchmaking *)internal, version);
+}
+
+static void *wrapISteamMatchmakingServers(void *internal, const char *version)
+{
+  return internInterface<ISteamMatchmakingServers_, ISteamMatchmakingServers>("ISteamMatchmakingServers", (ISteamMatchmakingServers *)internal, version);
+}
+
+static void *wrapISteamMusic(void *internal, const char *version)
+{
+  return internInterface<ISteamMusic_, ISteamMusic>("ISteamMusic", (ISteamMusic *)internal, version);
+}
+
+static void *wrapISteamMusicRemote(void *internal, const char *version)
+{
+  return internInterface<ISteamMusicRemote_, ISteamMusicRemote>("ISteamMusicRemote", (ISteamMusicRemote *)internal, version);
+}
+
+static void *wrapISteamNetworking(void *internal, const char *version)
+{
+  return internInterface<ISteamNetworking_, ISteamNetworking>("ISteamNetworking", (ISteamNetworking *)internal, version);
+}
+
+static void *wrapISteamRemoteStorage(void *internal, const char *version)
+{
+  return internInterface<ISteamRemoteStorage_, ISteamRemoteStorage>("ISteamRemoteStorage", (ISteamRemoteStorage *)internal, version);
+}
+
+static void *wrapISteamScreenshots(void *internal, const char *version)
+{
+  return internInterface<ISteamScreenshots_, ISteamScreenshots>("ISteamScreenshots", (ISteamScreenshots *)internal, version);
+}
+
+static void *wrapISteamUGC(void *internal, const char *version)
+{
+  return internInterface<ISteamUGC_, ISteamUGC>("ISteamUGC", (ISteamUGC *)internal, version);
+}
+
+static void *wrapISteamUnifiedMessages(void *internal, const char *version)
+{
+  return internInterface<ISteamUnifiedMessages_, ISteamUnifiedMessages>("ISteamUnifiedMessages", (ISteamUnifiedMessages *)internal, version);
+}
+
+static void *wrapISteamUser(void *internal, const char *version)
+{
+  return internInterface<ISteamUser_, ISteamUser>("ISteamUser", (ISteamUser *)internal, version);
+}
+
+static void *wrapISteamUserStats(void *internal, const char *version)
+{
+  return internInterface<ISteamUserStats_, ISteamUserStats>("ISteamUserStats", (ISteamUserStats *)internal, version);
+}
+
+static void *wrapISteamUtils(void *internal, const char *version)
+{
+  return internInterface<ISteamUtils_, ISteamUtils>("ISteamUtils", (ISteamUtils *)internal, version);
+}
+
+static void *wrapISteamVideo(void *internal, const char *version)
+{
+  return internInterface<ISteamVideo_, ISteamVideo>("ISteamVideo", (ISteamVideo *)internal, version);
+}
+
+const InterfaceVersion knownVersions[] = {
+#ifdef STEAMAPPLIST_INTERFACE_VERSION
+  {STEAMAPPLIST_INTERFACE_VERSION, "ISteamAppList", wrapISteamAppList},
+#endif
+#ifdef STEAMAPPS_INTERFACE_VERSION
+  {STEAMAPPS_INTERFACE_VERSION, "ISteamApps", wrapISteamApps},
+#endif
+#ifdef STEAMAPPTICKET_INTERFACE_VERSION
+  {STEAMAPPTICKET_INTERFACE_VERSION, "ISteamAppTicket", wrapISteamAppTicket},
+#endif
+#ifdef STEAMCLIENT_INTERFACE_VERSION
+  {STEAMCLIENT_INTERFACE_VERSION, "ISteamClient", wrapISteamClient},
+#endif
+#ifdef STEAMCONTROLLER_INTERFACE_VERSION
+  {STEAMCONTROLLER_INTERFACE_VERSION, "ISteamController", wrapISteamController},
+#endif
+#ifdef STEAMFRIENDS_INTERFACE_VERSION
+  {STEAMFRIENDS_INTERFACE_VERSION, "ISteamFriends", wrapISteamFriends},
+#endif
+#ifdef STEAMGAMECOORDINATOR_INTERFACE_VERSION
+  {STEAMGAMECOORDINATOR_INTERFACE_VERSION, "ISteamGameCoordinator", wrapISteamGameCoordinator},
+#endif
+#ifdef STEAMGAMESERVER_INTERFACE_VERSION
+  {STEAMGAMESERVER_INTERFACE_VERSION, "ISteamGameServer", wrapISteamGameServer},
+#endif
+#ifdef STEAMGAMESERVERSTATS_INTERFACE_VERSION
+  {STEAMGAMESERVERSTATS_INTERFACE_VERSION, "ISteamGameServerStats", wrapISteamGameServerStats},
+#endif
+#ifdef STEAMHTMLSURFACE_INTERFACE_VERSION
+  {STEAMHTMLSURFACE_INTERFACE_VERSION, "ISteamHTMLSurface", wrapISteamHTMLSurface},
+#endif
+#ifdef STEAMHTTP_INTERFACE_VERSION
+  {STEAMHTTP_INTERFACE_VERSION, "ISteamHTTP", wrapISteamHTTP},
+#endif
+#ifdef STEAMINVENTORY_INTERFACE_VERSION
+  {STEAMINVENTORY_INTERFACE_VERSION, "ISteamInventory", wrapISteamInventory},
+#endif
+#ifdef STEAMMATCHMAKING_INTERFACE_VERSION
+  {STEAMMATCHMAKING_INTERFACE_VERSION, "ISteamMatchmaking", wrapISteamMatchmaking},
+#endif
+#ifdef STEAMMATCHMAKINGSERVERS_INTERFACE_VERSION
+  {STEAMMATCHMAKINGSERVERS_INTERFACE_VERSION, "ISteamMatchmakingServers", wrapISteamMatchmakingServers},
+#endif
+#ifdef STEAMMUSIC_INTERFACE_VERSION
+  {STEAMMUSIC_INTERFACE_VERSION, "ISteamMusic", wrapISteamMusic},
+#endif
+#ifdef STEAMMUSICREMOTE_INTERFACE_VERSION
+  {STEAMMUSICREMOTE_INTERFACE_VERSION, "ISteamMusicRemote", wrapISteamMusicRemote},
+#endif
+#ifdef STEAMNETWORKING_INTERFACE_VERSION
+  {STEAMNETWORKING_INTERFACE_VERSION, "ISteamNetworking", wrapISteamNetworking},
+#endif
+#ifdef STEAMREMOTESTORAGE_INTERFACE_VERSION
+  {STEAMREMOTESTORAGE_INTERFACE_VERSION, "ISteamRemoteStorage", wrapISteamRemoteStorage},
+#endif
+#ifdef STEAMSCREENSHOTS_INTERFACE_VERSION
+  {STEAMSCREENSHOTS_INTERFACE_VERSION, "ISteamScreenshots", wrapISteamScreenshots},
+#endif
+#ifdef STEAMUGC_INTERFACE_VERSION
+  {STEAMUGC_INTERFACE_VERSION, "ISteamUGC", wrapISteamUGC},
+#endif
+#ifdef STEAMUNIFIEDMESSAGES_INTERFACE_VERSION
+  {STEAMUNIFIEDMESSAGES_INTERFACE_VERSION, "ISteamUnifiedMessages", wrapISteamUnifiedMessages},
+#endif
+#ifdef STEAMUSER_INTERFACE_VERSION
+  {STEAMUSER_INTERFACE_VERSION, "ISteamUser", wrapISteamUser},
+#endif
+#ifdef STEAMUSERSTATS_INTERFACE_VERSION
+  {STEAMUSERSTATS_INTERFACE_VERSION, "ISteamUserStats", wrapISteamUserStats},
+#endif
+#ifdef STEAMUTILS_INTERFACE_VERSION
+  {STEAMUTILS_INTERFACE_VERSION, "ISteamUtils", wrapISteamUtils},
+#endif
+#ifdef STEAMVIDEO_INTERFACE_VERSION
+  {STEAMVIDEO_INTERFACE_VERSION, "ISteamVideo", wrapISteamVideo},
+#endif
+};
+const uint32_t knownVersionCount = sizeof(knownVersions) / sizeof(knownVersions[0]);
@@ -1,52 +1,43 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetNumInstalledApps);
+FORWARD_METHOD(GetInstalledApps);
+FORWARD_METHOD(GetAppName);
+FORWARD_METHOD(GetAppInstallDir);
+FORWARD_METHOD(GetAppBuildId);
+
 
 uint32  ISteamAppList_::GetNumInstalledApps()
 {
-  TRACE("((ISteamAppList *)%p)\n", this);
-  uint32  result = this->internal->GetNumInstalledApps();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamAppList::GetNumInstalledApps");
+  return Forward<Method_GetNumInstalledApps>::call(&point, this->internal);
 }
 
 
 uint32  ISteamAppList_::GetInstalledApps(AppId_t * pvecAppID, uint32  unMaxAppIDs)
 {
-  TRACE("((ISteamAppList *)%p, (AppId_t *)%p, (uint32 )%d)\n", this, pvecAppID, unMaxAppIDs);
-  uint32  result = this->internal->GetInstalledApps(pvecAppID, unMaxAppIDs);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamAppList::GetInstalledApps");
+  return Forward<Method_GetInstalledApps>::call(&point, this->internal, pvecAppID, unMaxAppIDs);
 }
 
 
 int  ISteamAppList_::GetAppName(AppId_t  nAppID, char * pchName, int  cchNameMax)
 {
-  TRACE("((ISteamAppList *)%p, (AppId_t )%p, (char *)\"%s\", (int )%d)\n", this, nAppID, pchName, cchNameMax);
-  int  result = this->internal->GetAppName(nAppID, pchName, cchNameMax);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamAppList::GetAppName", "2:3");
+  return Forward<Method_GetAppName>::call(&point, this->internal, nAppID, pchName, cchNameMax);
 }
 
 
 int  ISteamAppList_::GetAppInstallDir(AppId_t  nAppID, char * pchDirectory, int  cchNameMax)
 {
-  TRACE("((ISteamAppList *)%p, (AppId_t )%p, (char *)\"%s\", (int )%d)\n", this, nAppID, pchDirectory, cchNameMax);
-  int  result = this->internal->GetAppInstallDir(nAppID, pchDirectory, cchNameMax);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamAppList::GetAppInstallDir", "2:3");
+  return Forward<Method_GetAppInstallDir>::call(&point, this->internal, nAppID, pchDirectory, cchNameMax);
 }
 
 
 int  ISteamAppList_::GetAppBuildId(AppId_t  nAppID)
 {
-  TRACE("((ISteamAppList *)%p, (AppId_t )%p)\n", this, nAppID);
-  int  result = this->internal->GetAppBuildId(nAppID);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamAppList::GetAppBuildId");
+  return Forward<Method_GetAppBuildId>::call(&point, this->internal, nAppID);
 }
 ISteamAppList_::ISteamAppList_(ISteamAppList * towrap)
 {
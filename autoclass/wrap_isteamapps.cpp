@@ -1,252 +1,211 @@
 #include <steam_api_.h>
+FORWARD_METHOD(BIsSubscribed);
+FORWARD_METHOD(BIsLowViolence);
+FORWARD_METHOD(BIsCybercafe);
+FORWARD_METHOD(BIsVACBanned);
+FORWARD_METHOD(GetCurrentGameLanguage);
+FORWARD_METHOD(GetAvailableGameLanguages);
+FORWARD_METHOD(BIsSubscribedApp);
+FORWARD_METHOD(BIsDlcInstalled);
+FORWARD_METHOD(GetEarliestPurchaseUnixTime);
+FORWARD_METHOD(BIsSubscribedFromFreeWeekend);
+FORWARD_METHOD(GetDLCCount);
+FORWARD_METHOD(BGetDLCDataByIndex);
+FORWARD_METHOD(InstallDLC);
+FORWARD_METHOD(UninstallDLC);
+FORWARD_METHOD(RequestAppProofOfPurchaseKey);
+FORWARD_METHOD(GetCurrentBetaName);
+FORWARD_METHOD(MarkContentCorrupt);
+FORWARD_METHOD(GetInstalledDepots);
+FORWARD_METHOD(GetAppInstallDir);
+FORWARD_METHOD(BIsAppInstalled);
+FORWARD_METHOD(GetAppOwner);
+FORWARD_METHOD(GetLaunchQueryParam);
+FORWARD_METHOD(GetDlcDownloadProgress);
+FORWARD_METHOD(GetAppBuildId);
+FORWARD_METHOD(RequestAllProofOfPurchaseKeys);
+FORWARD_METHOD(GetFileDetails);
+
 
 bool  ISteamApps_::BIsSubscribed()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  bool  result = this->internal->BIsSubscribed();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsSubscribed");
+  return Forward<Method_BIsSubscribed>::call(&point, this->internal);
 }
 
 
 bool  ISteamApps_::BIsLowViolence()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  bool  result = this->internal->BIsLowViolence();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsLowViolence");
+  return Forward<Method_BIsLowViolence>::call(&point, this->internal);
 }
 
 
 bool  ISteamApps_::BIsCybercafe()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  bool  result = this->internal->BIsCybercafe();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsCybercafe");
+  return Forward<Method_BIsCybercafe>::call(&point, this->internal);
 }
 
 
 bool  ISteamApps_::BIsVACBanned()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  bool  result = this->internal->BIsVACBanned();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsVACBanned");
+  return Forward<Method_BIsVACBanned>::call(&point, this->internal);
 }
 
 
 char * ISteamApps_::GetCurrentGameLanguage()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  char * result = this->internal->GetCurrentGameLanguage();
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetCurrentGameLanguage");
+  return Forward<Method_GetCurrentGameLanguage>::call(&point, this->internal);
 }
 
 
 char * ISteamApps_::GetAvailableGameLanguages()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  char * result = this->internal->GetAvailableGameLanguages();
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetAvailableGameLanguages");
+  return Forward<Method_GetAvailableGameLanguages>::call(&point, this->internal);
 }
 
 
 bool  ISteamApps_::BIsSubscribedApp(AppId_t  appID)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p)\n", this, appID);
-  bool  result = this->internal->BIsSubscribedApp(appID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsSubscribedApp");
+  return Forward<Method_BIsSubscribedApp>::call(&point, this->internal, appID);
 }
 
 
 bool  ISteamApps_::BIsDlcInstalled(AppId_t  appID)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p)\n", this, appID);
-  bool  result = this->internal->BIsDlcInstalled(appID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsDlcInstalled");
+  return Forward<Method_BIsDlcInstalled>::call(&point, this->internal, appID);
 }
 
 
 uint32  ISteamApps_::GetEarliestPurchaseUnixTime(AppId_t  nAppID)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p)\n", this, nAppID);
-  uint32  result = this->internal->GetEarliestPurchaseUnixTime(nAppID);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetEarliestPurchaseUnixTime");
+  return Forward<Method_GetEarliestPurchaseUnixTime>::call(&point, this->internal, nAppID);
 }
 
 
 bool  ISteamApps_::BIsSubscribedFromFreeWeekend()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  bool  result = this->internal->BIsSubscribedFromFreeWeekend();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsSubscribedFromFreeWeekend");
+  return Forward<Method_BIsSubscribedFromFreeWeekend>::call(&point, this->internal);
 }
 
 
 int  ISteamApps_::GetDLCCount()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  int  result = this->internal->GetDLCCount();
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetDLCCount");
+  return Forward<Method_GetDLCCount>::call(&point, this->internal);
 }
 
 
 bool  ISteamApps_::BGetDLCDataByIndex(int  iDLC, AppId_t * pAppID, bool * pbAvailable, char * pchName, int  cchNameBufferSize)
 {
-  TRACE("((ISteamApps *)%p, (int )%d, (AppId_t *)%p, (bool *)%d, (char *)\"%s\", (int )%d)\n", this, iDLC, pAppID, pbAvailable, pchName, cchNameBufferSize);
-  bool  result = this->internal->BGetDLCDataByIndex(iDLC, pAppID, pbAvailable, pchName, cchNameBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BGetDLCDataByIndex", "4:5");
+  return Forward<Method_BGetDLCDataByIndex>::call(&point, this->internal, iDLC, pAppID, pbAvailable, pchName, cchNameBufferSize);
 }
 
 
 void  ISteamApps_::InstallDLC(AppId_t  nAppID)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p)\n", this, nAppID);
-  this->internal->InstallDLC(nAppID);
-  
+  static ProfilePoint point("ISteamApps::InstallDLC");
+  return Forward<Method_InstallDLC>::call(&point, this->internal, nAppID);
 }
 
 
 void  ISteamApps_::UninstallDLC(AppId_t  nAppID)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p)\n", this, nAppID);
-  this->internal->UninstallDLC(nAppID);
-  
+  static ProfilePoint point("ISteamApps::UninstallDLC");
+  return Forward<Method_UninstallDLC>::call(&point, this->internal, nAppID);
 }
 
 
 void  ISteamApps_::RequestAppProofOfPurchaseKey(AppId_t  nAppID)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p)\n", this, nAppID);
-  this->internal->RequestAppProofOfPurchaseKey(nAppID);
-  
+  static ProfilePoint point("ISteamApps::RequestAppProofOfPurchaseKey");
+  return Forward<Method_RequestAppProofOfPurchaseKey>::call(&point, this->internal, nAppID);
 }
 
 
 bool  ISteamApps_::GetCurrentBetaName(char * pchName, int  cchNameBufferSize)
 {
-  TRACE("((ISteamApps *)%p, (char *)\"%s\", (int )%d)\n", this, pchName, cchNameBufferSize);
-  bool  result = this->internal->GetCurrentBetaName(pchName, cchNameBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetCurrentBetaName", "1:2");
+  return Forward<Method_GetCurrentBetaName>::call(&point, this->internal, pchName, cchNameBufferSize);
 }
 
 
 bool  ISteamApps_::MarkContentCorrupt(bool  bMissingFilesOnly)
 {
-  TRACE("((ISteamApps *)%p, (bool )%d)\n", this, bMissingFilesOnly);
-  bool  result = this->internal->MarkContentCorrupt(bMissingFilesOnly);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::MarkContentCorrupt");
+  return Forward<Method_MarkContentCorrupt>::call(&point, this->internal, bMissingFilesOnly);
 }
 
 
 uint32  ISteamApps_::GetInstalledDepots(AppId_t  appID, DepotId_t * pvecDepots, uint32  cMaxDepots)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p, (DepotId_t *)%p, (uint32 )%d)\n", this, appID, pvecDepots, cMaxDepots);
-  uint32  result = this->internal->GetInstalledDepots(appID, pvecDepots, cMaxDepots);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetInstalledDepots");
+  return Forward<Method_GetInstalledDepots>::call(&point, this->internal, appID, pvecDepots, cMaxDepots);
 }
 
 
 uint32  ISteamApps_::GetAppInstallDir(AppId_t  appID, char * pchFolder, uint32  cchFolderBufferSize)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p, (char *)\"%s\", (uint32 )%d)\n", this, appID, pchFolder, cchFolderBufferSize);
-  uint32  result = this->internal->GetAppInstallDir(appID, pchFolder, cchFolderBufferSize);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetAppInstallDir", "2:3");
+  return Forward<Method_GetAppInstallDir>::call(&point, this->internal, appID, pchFolder, cchFolderBufferSize);
 }
 
 
 bool  ISteamApps_::BIsAppInstalled(AppId_t  appID)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p)\n", this, appID);
-  bool  result = this->internal->BIsAppInstalled(appID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::BIsAppInstalled");
+  return Forward<Method_BIsAppInstalled>::call(&point, this->internal, appID);
 }
 
 
 CSteamID * ISteamApps_::GetAppOwner(CSteamID * hidden)
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  *hidden = this->internal->GetAppOwner();
-  return hidden;
+  static ProfilePoint point("ISteamApps::GetAppOwner");
+  return Forward<Method_GetAppOwner>::hidden(&point, hidden, this->internal);
 }
 
 
 char * ISteamApps_::GetLaunchQueryParam(char * pchKey)
 {
-  TRACE("((ISteamApps *)%p, (char *)\"%s\")\n", this, pchKey);
-  char * result = this->internal->GetLaunchQueryParam(pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetLaunchQueryParam");
+  return Forward<Method_GetLaunchQueryParam>::call(&point, this->internal, pchKey);
 }
 
 
 bool  ISteamApps_::GetDlcDownloadProgress(AppId_t  nAppID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
 {
-  TRACE("((ISteamApps *)%p, (AppId_t )%p, (uint64 *)%d, (uint64 *)%d)\n", this, nAppID, punBytesDownloaded, punBytesTotal);
-  bool  result = this->internal->GetDlcDownloadProgress(nAppID, punBytesDownloaded, punBytesTotal);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetDlcDownloadProgress");
+  return Forward<Method_GetDlcDownloadProgress>::call(&point, this->internal, nAppID, punBytesDownloaded, punBytesTotal);
 }
 
 
 int  ISteamApps_::GetAppBuildId()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  int  result = this->internal->GetAppBuildId();
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetAppBuildId");
+  return Forward<Method_GetAppBuildId>::call(&point, this->internal);
 }
 
 
 void  ISteamApps_::RequestAllProofOfPurchaseKeys()
 {
-  TRACE("((ISteamApps *)%p)\n", this);
-  this->internal->RequestAllProofOfPurchaseKeys();
-  
+  static ProfilePoint point("ISteamApps::RequestAllProofOfPurchaseKeys");
+  return Forward<Method_RequestAllProofOfPurchaseKeys>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamApps_::GetFileDetails(char * pszFileName)
 {
-  TRACE("((ISteamApps *)%p, (char *)\"%s\")\n", this, pszFileName);
-  SteamAPICall_t  result = this->internal->GetFileDetails(pszFileName);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamApps::GetFileDetails");
+  return Forward<Method_GetFileDetails>::call(&point, this->internal, pszFileName);
 }
 ISteamApps_::ISteamApps_(ISteamApps * towrap)
 {
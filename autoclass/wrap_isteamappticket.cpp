@@ -1,12 +1,11 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetAppOwnershipTicketData);
+
 
 uint32  ISteamAppTicket_::GetAppOwnershipTicketData(uint32  nAppID, void * pvBuffer, uint32  cbBufferLength, uint32 * piAppId, uint32 * piSteamId, uint32 * piSignature, uint32 * pcbSignature)
 {
-  TRACE("((ISteamAppTicket *)%p, (uint32 )%d, (void *)%p, (uint32 )%d, (uint32 *)%d, (uint32 *)%d, (uint32 *)%d, (uint32 *)%d)\n", this, nAppID, pvBuffer, cbBufferLength, piAppId, piSteamId, piSignature, pcbSignature);
-  uint32  result = this->internal->GetAppOwnershipTicketData(nAppID, pvBuffer, cbBufferLength, piAppId, piSteamId, piSignature, pcbSignature);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamAppTicket::GetAppOwnershipTicketData", "2:3");
+  return Forward<Method_GetAppOwnershipTicketData>::call(&point, this->internal, nAppID, pvBuffer, cbBufferLength, piAppId, piSteamId, piSignature, pcbSignature);
 }
 ISteamAppTicket_::ISteamAppTicket_(ISteamAppTicket * towrap)
 {
@@ -1,193 +1,174 @@
 #include <steam_api_.h>
+FORWARD_METHOD(CreateSteamPipe);
+FORWARD_METHOD(BReleaseSteamPipe);
+FORWARD_METHOD(ConnectToGlobalUser);
+FORWARD_METHOD(CreateLocalUser);
+FORWARD_METHOD(ReleaseUser);
+FORWARD_METHOD(GetISteamUser);
+FORWARD_METHOD(GetISteamGameServer);
+FORWARD_METHOD(SetLocalIPBinding);
+FORWARD_METHOD(GetISteamFriends);
+FORWARD_METHOD(GetISteamUtils);
+FORWARD_METHOD(GetISteamMatchmaking);
+FORWARD_METHOD(GetISteamMatchmakingServers);
+FORWARD_METHOD(GetISteamGenericInterface);
+FORWARD_METHOD(GetISteamUserStats);
+FORWARD_METHOD(GetISteamGameServerStats);
+FORWARD_METHOD(GetISteamApps);
+FORWARD_METHOD(GetISteamNetworking);
+FORWARD_METHOD(GetISteamRemoteStorage);
+FORWARD_METHOD(GetISteamScreenshots);
+FORWARD_METHOD(GetIPCCallCount);
+FORWARD_METHOD(SetWarningMessageHook);
+FORWARD_METHOD(BShutdownIfAllPipesClosed);
+FORWARD_METHOD(GetISteamHTTP);
+FORWARD_METHOD(GetISteamUnifiedMessages);
+FORWARD_METHOD(GetISteamController);
+FORWARD_METHOD(GetISteamUGC);
+FORWARD_METHOD(GetISteamAppList);
+FORWARD_METHOD(GetISteamMusic);
+FORWARD_METHOD(GetISteamMusicRemote);
+FORWARD_METHOD(GetISteamHTMLSurface);
+FORWARD_METHOD(GetISteamInventory);
+FORWARD_METHOD(GetISteamVideo);
+
 
 HSteamPipe  ISteamClient_::CreateSteamPipe()
 {
-  TRACE("((ISteamClient *)%p)\n", this);
-  HSteamPipe  result = this->internal->CreateSteamPipe();
-  TRACE("() = (HSteamPipe )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamClient::CreateSteamPipe");
+  return Forward<Method_CreateSteamPipe>::call(&point, this->internal);
 }
 
 
 bool  ISteamClient_::BReleaseSteamPipe(HSteamPipe  hSteamPipe)
 {
-  TRACE("((ISteamClient *)%p, (HSteamPipe )%p)\n", this, hSteamPipe);
-  bool  result = this->internal->BReleaseSteamPipe(hSteamPipe);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamClient::BReleaseSteamPipe");
+  return Forward<Method_BReleaseSteamPipe>::call(&point, this->internal, hSteamPipe);
 }
 
 
 HSteamUser  ISteamClient_::ConnectToGlobalUser(HSteamPipe  hSteamPipe)
 {
-  TRACE("((ISteamClient *)%p, (HSteamPipe )%p)\n", this, hSteamPipe);
-  HSteamUser  result = this->internal->ConnectToGlobalUser(hSteamPipe);
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamClient::ConnectToGlobalUser");
+  return Forward<Method_ConnectToGlobalUser>::call(&point, this->internal, hSteamPipe);
 }
 
 
 HSteamUser  ISteamClient_::CreateLocalUser(HSteamPipe * phSteamPipe, EAccountType  eAccountType)
 {
-  TRACE("((ISteamClient *)%p, (HSteamPipe *)%p, (EAccountType )%p)\n", this, phSteamPipe, eAccountType);
-  HSteamUser  result = this->internal->CreateLocalUser(phSteamPipe, eAccountType);
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamClient::CreateLocalUser");
+  return Forward<Method_CreateLocalUser>::call(&point, this->internal, phSteamPipe, eAccountType);
 }
 
 
 void  ISteamClient_::ReleaseUser(HSteamPipe  hSteamPipe, HSteamUser  hUser)
 {
-  TRACE("((ISteamClient *)%p, (HSteamPipe )%p, (HSteamUser )%p)\n", this, hSteamPipe, hUser);
-  this->internal->ReleaseUser(hSteamPipe, hUser);
-  
+  static ProfilePoint point("ISteamClient::ReleaseUser");
+  return Forward<Method_ReleaseUser>::call(&point, this->internal, hSteamPipe, hUser);
 }
 
 
 ISteamUser * ISteamClient_::GetISteamUser(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamUser_* result = new ISteamUser_(this->internal->GetISteamUser(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUser *)%p\n", result);
-
-  return (ISteamUser *)result;
+  static ProfilePoint point("ISteamClient::GetISteamUser");
+  return (ISteamUser *)wrapVersion<ISteamUser_, ISteamUser>("ISteamUser", Forward<Method_GetISteamUser>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamGameServer * ISteamClient_::GetISteamGameServer(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamGameServer_* result = new ISteamGameServer_(this->internal->GetISteamGameServer(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamGameServer *)%p\n", result);
-
-  return (ISteamGameServer *)result;
+  static ProfilePoint point("ISteamClient::GetISteamGameServer");
+  return (ISteamGameServer *)wrapVersion<ISteamGameServer_, ISteamGameServer>("ISteamGameServer", Forward<Method_GetISteamGameServer>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 void  ISteamClient_::SetLocalIPBinding(uint32  unIP, uint16  usPort)
 {
-  TRACE("((ISteamClient *)%p, (uint32 )%d, (uint16 )%d)\n", this, unIP, usPort);
-  this->internal->SetLocalIPBinding(unIP, usPort);
-  
+  static ProfilePoint point("ISteamClient::SetLocalIPBinding");
+  return Forward<Method_SetLocalIPBinding>::call(&point, this->internal, unIP, usPort);
 }
 
 
 ISteamFriends * ISteamClient_::GetISteamFriends(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamFriends_* result = new ISteamFriends_(this->internal->GetISteamFriends(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamFriends *)%p\n", result);
-
-  return (ISteamFriends *)result;
+  static ProfilePoint point("ISteamClient::GetISteamFriends");
+  return (ISteamFriends *)wrapVersion<ISteamFriends_, ISteamFriends>("ISteamFriends", Forward<Method_GetISteamFriends>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUtils * ISteamClient_::GetISteamUtils(HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamPipe, pchVersion);
-  ISteamUtils_* result = new ISteamUtils_(this->internal->GetISteamUtils(hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUtils *)%p\n", result);
-
-  return (ISteamUtils *)result;
+  static ProfilePoint point("ISteamClient::GetISteamUtils");
+  return (ISteamUtils *)wrapVersion<ISteamUtils_, ISteamUtils>("ISteamUtils", Forward<Method_GetISteamUtils>::call(&point, this->internal, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMatchmaking * ISteamClient_::GetISteamMatchmaking(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamMatchmaking_* result = new ISteamMatchmaking_(this->internal->GetISteamMatchmaking(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMatchmaking *)%p\n", result);
-
-  return (ISteamMatchmaking *)result;
+  static ProfilePoint point("ISteamClient::GetISteamMatchmaking");
+  return (ISteamMatchmaking *)wrapVersion<ISteamMatchmaking_, ISteamMatchmaking>("ISteamMatchmaking", Forward<Method_GetISteamMatchmaking>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMatchmakingServers * ISteamClient_::GetISteamMatchmakingServers(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamMatchmakingServers_* result = new ISteamMatchmakingServers_(this->internal->GetISteamMatchmakingServers(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMatchmakingServers *)%p\n", result);
-
-  return (ISteamMatchmakingServers *)result;
+  static ProfilePoint point("ISteamClient::GetISteamMatchmakingServers");
+  return (ISteamMatchmakingServers *)wrapVersion<ISteamMatchmakingServers_, ISteamMatchmakingServers>("ISteamMatchmakingServers", Forward<Method_GetISteamMatchmakingServers>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 void * ISteamClient_::GetISteamGenericInterface(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  void * result = this->internal->GetISteamGenericInterface(hSteamUser, hSteamPipe, pchVersion);
-  
-
-  return result;
+  static ProfilePoint point("ISteamClient::GetISteamGenericInterface");
+  return wrapGenericInterface(Forward<Method_GetISteamGenericInterface>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUserStats * ISteamClient_::GetISteamUserStats(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamUserStats_* result = new ISteamUserStats_(this->internal->GetISteamUserStats(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUserStats *)%p\n", result);
-
-  return (ISteamUserStats *)result;
+  static ProfilePoint point("ISteamClient::GetISteamUserStats");
+  return (ISteamUserStats *)wrapVersion<ISteamUserStats_, ISteamUserStats>("ISteamUserStats", Forward<Method_GetISteamUserStats>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamGameServerStats * ISteamClient_::GetISteamGameServerStats(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamGameServerStats_* result = new ISteamGameServerStats_(this->internal->GetISteamGameServerStats(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamGameServerStats *)%p\n", result);
-
-  return (ISteamGameServerStats *)result;
+  static ProfilePoint point("ISteamClient::GetISteamGameServerStats");
+  return (ISteamGameServerStats *)wrapVersion<ISteamGameServerStats_, ISteamGameServerStats>("ISteamGameServerStats", Forward<Method_GetISteamGameServerStats>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamApps * ISteamClient_::GetISteamApps(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamApps_* result = new ISteamApps_(this->internal->GetISteamApps(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamApps *)%p\n", result);
-
-  return (ISteamApps *)result;
+  static ProfilePoint point("ISteamClient::GetISteamApps");
+  return (ISteamApps *)wrapVersion<ISteamApps_, ISteamApps>("ISteamApps", Forward<Method_GetISteamApps>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamNetworking * ISteamClient_::GetISteamNetworking(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamNetworking_* result = new ISteamNetworking_(this->internal->GetISteamNetworking(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamNetworking *)%p\n", result);
-
-  return (ISteamNetworking *)result;
+  static ProfilePoint point("ISteamClient::GetISteamNetworking");
+  return (ISteamNetworking *)wrapVersion<ISteamNetworking_, ISteamNetworking>("ISteamNetworking", Forward<Method_GetISteamNetworking>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamRemoteStorage * ISteamClient_::GetISteamRemoteStorage(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamRemoteStorage_* result = new ISteamRemoteStorage_(this->internal->GetISteamRemoteStorage(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamRemoteStorage *)%p\n", result);
-
-  return (ISteamRemoteStorage *)result;
+  static ProfilePoint point("ISteamClient::GetISteamRemoteStorage");
+  return (ISteamRemoteStorage *)wrapVersion<ISteamRemoteStorage_, ISteamRemoteStorage>("ISteamRemoteStorage", Forward<Method_GetISteamRemoteStorage>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamScreenshots * ISteamClient_::GetISteamScreenshots(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamScreenshots_* result = new ISteamScreenshots_(this->internal->GetISteamScreenshots(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamScreenshots *)%p\n", result);
-
-  return (ISteamScreenshots *)result;
+  static ProfilePoint point("ISteamClient::GetISteamScreenshots");
+  return (ISteamScreenshots *)wrapVersion<ISteamScreenshots_, ISteamScreenshots>("ISteamScreenshots", Forward<Method_GetISteamScreenshots>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 void  ISteamClient_::RunFrame()
 {
+  PROFILE("ISteamClient::RunFrame");
   TRACE("((ISteamClient *)%p)\n", this);
   
   
@@ -196,114 +177,84 @@ void  ISteamClient_::RunFrame()
 
 uint32  ISteamClient_::GetIPCCallCount()
 {
-  TRACE("((ISteamClient *)%p)\n", this);
-  uint32  result = this->internal->GetIPCCallCount();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamClient::GetIPCCallCount");
+  return Forward<Method_GetIPCCallCount>::call(&point, this->internal);
 }
 
 
 void  ISteamClient_::SetWarningMessageHook(SteamAPIWarningMessageHook_t  pFunction)
 {
-  TRACE("((ISteamClient *)%p, (SteamAPIWarningMessageHook_t )%p)\n", this, pFunction);
-  this->internal->SetWarningMessageHook(pFunction);
-  
+  static ProfilePoint point("ISteamClient::SetWarningMessageHook");
+  return Forward<Method_SetWarningMessageHook>::call(&point, this->internal, pFunction);
 }
 
 
 bool  ISteamClient_::BShutdownIfAllPipesClosed()
 {
-  TRACE("((ISteamClient *)%p)\n", this);
-  bool  result = this->internal->BShutdownIfAllPipesClosed();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamClient::BShutdownIfAllPipesClosed");
+  return Forward<Method_BShutdownIfAllPipesClosed>::call(&point, this->internal);
 }
 
 
 ISteamHTTP * ISteamClient_::GetISteamHTTP(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamHTTP_* result = new ISteamHTTP_(this->internal->GetISteamHTTP(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamHTTP *)%p\n", result);
-
-  return (ISteamHTTP *)result;
+  static ProfilePoint point("ISteamClient::GetISteamHTTP");
+  return (ISteamHTTP *)wrapVersion<ISteamHTTP_, ISteamHTTP>("ISteamHTTP", Forward<Method_GetISteamHTTP>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUnifiedMessages * ISteamClient_::GetISteamUnifiedMessages(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamUnifiedMessages_* result = new ISteamUnifiedMessages_(this->internal->GetISteamUnifiedMessages(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUnifiedMessages *)%p\n", result);
-
-  return (ISteamUnifiedMessages *)result;
+  static ProfilePoint point("ISteamClient::GetISteamUnifiedMessages");
+  return (ISteamUnifiedMessages *)wrapVersion<ISteamUnifiedMessages_, ISteamUnifiedMessages>("ISteamUnifiedMessages", Forward<Method_GetISteamUnifiedMessages>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamController * ISteamClient_::GetISteamController(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamController_* result = new ISteamController_(this->internal->GetISteamController(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamController *)%p\n", result);
-
-  return (ISteamController *)result;
+  static ProfilePoint point("ISteamClient::GetISteamController");
+  return (ISteamController *)wrapVersion<ISteamController_, ISteamController>("ISteamController", Forward<Method_GetISteamController>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUGC * ISteamClient_::GetISteamUGC(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamUGC_* result = new ISteamUGC_(this->internal->GetISteamUGC(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUGC *)%p\n", result);
-
-  return (ISteamUGC *)result;
+  static ProfilePoint point("ISteamClient::GetISteamUGC");
+  return (ISteamUGC *)wrapVersion<ISteamUGC_, ISteamUGC>("ISteamUGC", Forward<Method_GetISteamUGC>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamAppList * ISteamClient_::GetISteamAppList(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamUser, hSteamPipe, pchVersion);
-  ISteamAppList_* result = new ISteamAppList_(this->internal->GetISteamAppList(hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamAppList *)%p\n", result);
-
-  return (ISteamAppList *)result;
+  static ProfilePoint point("ISteamClient::GetISteamAppList");
+  return (ISteamAppList *)wrapVersion<ISteamAppList_, ISteamAppList>("ISteamAppList", Forward<Method_GetISteamAppList>::call(&point, this->internal, hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMusic * ISteamClient_::GetISteamMusic(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamMusic_* result = new ISteamMusic_(this->internal->GetISteamMusic(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMusic *)%p\n", result);
-
-  return (ISteamMusic *)result;
+  static ProfilePoint point("ISteamClient::GetISteamMusic");
+  return (ISteamMusic *)wrapVersion<ISteamMusic_, ISteamMusic>("ISteamMusic", Forward<Method_GetISteamMusic>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMusicRemote * ISteamClient_::GetISteamMusicRemote(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamMusicRemote_* result = new ISteamMusicRemote_(this->internal->GetISteamMusicRemote(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMusicRemote *)%p\n", result);
-
-  return (ISteamMusicRemote *)result;
+  static ProfilePoint point("ISteamClient::GetISteamMusicRemote");
+  return (ISteamMusicRemote *)wrapVersion<ISteamMusicRemote_, ISteamMusicRemote>("ISteamMusicRemote", Forward<Method_GetISteamMusicRemote>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamHTMLSurface * ISteamClient_::GetISteamHTMLSurface(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamHTMLSurface_* result = new ISteamHTMLSurface_(this->internal->GetISteamHTMLSurface(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamHTMLSurface *)%p\n", result);
-
-  return (ISteamHTMLSurface *)result;
+  static ProfilePoint point("ISteamClient::GetISteamHTMLSurface");
+  return (ISteamHTMLSurface *)wrapVersion<ISteamHTMLSurface_, ISteamHTMLSurface>("ISteamHTMLSurface", Forward<Method_GetISteamHTMLSurface>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 void  ISteamClient_::DEPRECATED_Set_SteamAPI_CPostAPIResultInProcess()
 {
+  PROFILE("ISteamClient::DEPRECATED_Set_SteamAPI_CPostAPIResultInProcess");
   TRACE("((ISteamClient *)%p)\n", this);
   
   
@@ -312,6 +263,7 @@ void  ISteamClient_::DEPRECATED_Set_SteamAPI_CPostAPIResultInProcess()
 
 void  ISteamClient_::DEPRECATED_Remove_SteamAPI_CPostAPIResultInProcess()
 {
+  PROFILE("ISteamClient::DEPRECATED_Remove_SteamAPI_CPostAPIResultInProcess");
   TRACE("((ISteamClient *)%p)\n", this);
   
   
@@ -320,6 +272,7 @@ void  ISteamClient_::DEPRECATED_Remove_SteamAPI_CPostAPIResultInProcess()
 
 void  ISteamClient_::Set_SteamAPI_CCheckCallbackRegisteredInProcess(SteamAPI_CheckCallbackRegistered_t  func)
 {
+  PROFILE("ISteamClient::Set_SteamAPI_CCheckCallbackRegisteredInProcess");
   TRACE("((ISteamClient *)%p, (SteamAPI_CheckCallbackRegistered_t )%p)\n", this, func);
   
   
@@ -328,21 +281,15 @@ void  ISteamClient_::Set_SteamAPI_CCheckCallbackRegisteredInProcess(SteamAPI_Che
 
 ISteamInventory * ISteamClient_::GetISteamInventory(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamInventory_* result = new ISteamInventory_(this->internal->GetISteamInventory(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamInventory *)%p\n", result);
-
-  return (ISteamInventory *)result;
+  static ProfilePoint point("ISteamClient::GetISteamInventory");
+  return (ISteamInventory *)wrapVersion<ISteamInventory_, ISteamInventory>("ISteamInventory", Forward<Method_GetISteamInventory>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamVideo * ISteamClient_::GetISteamVideo(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((ISteamClient *)%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", this, hSteamuser, hSteamPipe, pchVersion);
-  ISteamVideo_* result = new ISteamVideo_(this->internal->GetISteamVideo(hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamVideo *)%p\n", result);
-
-  return (ISteamVideo *)result;
+  static ProfilePoint point("ISteamClient::GetISteamVideo");
+  return (ISteamVideo *)wrapVersion<ISteamVideo_, ISteamVideo>("ISteamVideo", Forward<Method_GetISteamVideo>::call(&point, this->internal, hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 ISteamClient_::ISteamClient_(ISteamClient * towrap)
 {
@@ -1,248 +1,211 @@
 #include <steam_api_.h>
+FORWARD_METHOD(Init);
+FORWARD_METHOD(Shutdown);
+FORWARD_METHOD(RunFrame);
+FORWARD_METHOD(GetConnectedControllers);
+FORWARD_METHOD(ShowBindingPanel);
+FORWARD_METHOD(GetActionSetHandle);
+FORWARD_METHOD(ActivateActionSet);
+FORWARD_METHOD(GetCurrentActionSet);
+FORWARD_METHOD(GetDigitalActionHandle);
+FORWARD_METHOD(GetDigitalActionData);
+FORWARD_METHOD(GetDigitalActionOrigins);
+FORWARD_METHOD(GetAnalogActionHandle);
+FORWARD_METHOD(GetAnalogActionData);
+FORWARD_METHOD(GetAnalogActionOrigins);
+FORWARD_METHOD(StopAnalogActionMomentum);
+FORWARD_METHOD(TriggerHapticPulse);
+FORWARD_METHOD(TriggerRepeatedHapticPulse);
+FORWARD_METHOD(TriggerVibration);
+FORWARD_METHOD(SetLEDColor);
+FORWARD_METHOD(GetGamepadIndexForController);
+FORWARD_METHOD(GetControllerForGamepadIndex);
+FORWARD_METHOD(GetMotionData);
+FORWARD_METHOD(ShowDigitalActionOrigins);
+FORWARD_METHOD(ShowAnalogActionOrigins);
+FORWARD_METHOD(GetStringForActionOrigin);
+FORWARD_METHOD(GetGlyphForActionOrigin);
+
 
 bool  ISteamController_::Init()
 {
-  TRACE("((ISteamController *)%p)\n", this);
-  bool  result = this->internal->Init();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::Init");
+  return Forward<Method_Init, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamController_::Shutdown()
 {
-  TRACE("((ISteamController *)%p)\n", this);
-  bool  result = this->internal->Shutdown();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::Shutdown");
+  return Forward<Method_Shutdown, true>::call(&point, this->internal);
 }
 
 
 void  ISteamController_::RunFrame()
 {
-  TRACE("((ISteamController *)%p)\n", this);
-  this->internal->RunFrame();
-  
+  static ProfilePoint point("ISteamController::RunFrame");
+  return Forward<Method_RunFrame, true>::call(&point, this->internal);
 }
 
 
 int  ISteamController_::GetConnectedControllers(ControllerHandle_t * handlesOut)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t *)%p)\n", this, handlesOut);
-  int  result = this->internal->GetConnectedControllers(handlesOut);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetConnectedControllers");
+  return Forward<Method_GetConnectedControllers, true>::call(&point, this->internal, handlesOut);
 }
 
 
 bool  ISteamController_::ShowBindingPanel(ControllerHandle_t  controllerHandle)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p)\n", this, controllerHandle);
-  bool  result = this->internal->ShowBindingPanel(controllerHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::ShowBindingPanel");
+  return Forward<Method_ShowBindingPanel, true>::call(&point, this->internal, controllerHandle);
 }
 
 
 ControllerActionSetHandle_t  ISteamController_::GetActionSetHandle(char * pszActionSetName)
 {
-  TRACE("((ISteamController *)%p, (char *)\"%s\")\n", this, pszActionSetName);
-  ControllerActionSetHandle_t  result = this->internal->GetActionSetHandle(pszActionSetName);
-  TRACE("() = (ControllerActionSetHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetActionSetHandle");
+  return Forward<Method_GetActionSetHandle, true>::call(&point, this->internal, pszActionSetName);
 }
 
 
 void  ISteamController_::ActivateActionSet(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerActionSetHandle_t )%p)\n", this, controllerHandle, actionSetHandle);
-  this->internal->ActivateActionSet(controllerHandle, actionSetHandle);
-  
+  static ProfilePoint point("ISteamController::ActivateActionSet");
+  return Forward<Method_ActivateActionSet, true>::call(&point, this->internal, controllerHandle, actionSetHandle);
 }
 
 
 ControllerActionSetHandle_t  ISteamController_::GetCurrentActionSet(ControllerHandle_t  controllerHandle)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p)\n", this, controllerHandle);
-  ControllerActionSetHandle_t  result = this->internal->GetCurrentActionSet(controllerHandle);
-  TRACE("() = (ControllerActionSetHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetCurrentActionSet");
+  return Forward<Method_GetCurrentActionSet, true>::call(&point, this->internal, controllerHandle);
 }
 
 
 ControllerDigitalActionHandle_t  ISteamController_::GetDigitalActionHandle(char * pszActionName)
 {
-  TRACE("((ISteamController *)%p, (char *)\"%s\")\n", this, pszActionName);
-  ControllerDigitalActionHandle_t  result = this->internal->GetDigitalActionHandle(pszActionName);
-  TRACE("() = (ControllerDigitalActionHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetDigitalActionHandle");
+  return Forward<Method_GetDigitalActionHandle, true>::call(&point, this->internal, pszActionName);
 }
 
 
 ControllerDigitalActionData_t  ISteamController_::GetDigitalActionData(ControllerHandle_t  controllerHandle, ControllerDigitalActionHandle_t  digitalActionHandle)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerDigitalActionHandle_t )%p)\n", this, controllerHandle, digitalActionHandle);
-  ControllerDigitalActionData_t  result = this->internal->GetDigitalActionData(controllerHandle, digitalActionHandle);
-  TRACE("() = (ControllerDigitalActionData_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetDigitalActionData");
+  return Forward<Method_GetDigitalActionData, true>::call(&point, this->internal, controllerHandle, digitalActionHandle);
 }
 
 
 int  ISteamController_::GetDigitalActionOrigins(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle, ControllerDigitalActionHandle_t  digitalActionHandle, EControllerActionOrigin * originsOut)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerActionSetHandle_t )%p, (ControllerDigitalActionHandle_t )%p, (EControllerActionOrigin *)%p)\n", this, controllerHandle, actionSetHandle, digitalActionHandle, originsOut);
-  int  result = this->internal->GetDigitalActionOrigins(controllerHandle, actionSetHandle, digitalActionHandle, originsOut);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetDigitalActionOrigins");
+  return Forward<Method_GetDigitalActionOrigins, true>::call(&point, this->internal, controllerHandle, actionSetHandle, digitalActionHandle, originsOut);
 }
 
 
 ControllerAnalogActionHandle_t  ISteamController_::GetAnalogActionHandle(char * pszActionName)
 {
-  TRACE("((ISteamController *)%p, (char *)\"%s\")\n", this, pszActionName);
-  ControllerAnalogActionHandle_t  result = this->internal->GetAnalogActionHandle(pszActionName);
-  TRACE("() = (ControllerAnalogActionHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetAnalogActionHandle");
+  return Forward<Method_GetAnalogActionHandle, true>::call(&point, this->internal, pszActionName);
 }
 
 
 ControllerAnalogActionData_t  ISteamController_::GetAnalogActionData(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  analogActionHandle)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerAnalogActionHandle_t )%p)\n", this, controllerHandle, analogActionHandle);
-  ControllerAnalogActionData_t  result = this->internal->GetAnalogActionData(controllerHandle, analogActionHandle);
-  TRACE("() = (ControllerAnalogActionData_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetAnalogActionData");
+  return Forward<Method_GetAnalogActionData, true>::call(&point, this->internal, controllerHandle, analogActionHandle);
 }
 
 
 int  ISteamController_::GetAnalogActionOrigins(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle, ControllerAnalogActionHandle_t  analogActionHandle, EControllerActionOrigin * originsOut)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerActionSetHandle_t )%p, (ControllerAnalogActionHandle_t )%p, (EControllerActionOrigin *)%p)\n", this, controllerHandle, actionSetHandle, analogActionHandle, originsOut);
-  int  result = this->internal->GetAnalogActionOrigins(controllerHandle, actionSetHandle, analogActionHandle, originsOut);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetAnalogActionOrigins");
+  return Forward<Method_GetAnalogActionOrigins, true>::call(&point, this->internal, controllerHandle, actionSetHandle, analogActionHandle, originsOut);
 }
 
 
 void  ISteamController_::StopAnalogActionMomentum(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  eAction)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerAnalogActionHandle_t )%p)\n", this, controllerHandle, eAction);
-  this->internal->StopAnalogActionMomentum(controllerHandle, eAction);
-  
+  static ProfilePoint point("ISteamController::StopAnalogActionMomentum");
+  return Forward<Method_StopAnalogActionMomentum, true>::call(&point, this->internal, controllerHandle, eAction);
 }
 
 
 void  ISteamController_::TriggerHapticPulse(ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ESteamControllerPad )%p, (unsigned short )%p)\n", this, controllerHandle, eTargetPad, usDurationMicroSec);
-  this->internal->TriggerHapticPulse(controllerHandle, eTargetPad, usDurationMicroSec);
-  
+  static ProfilePoint point("ISteamController::TriggerHapticPulse");
+  return Forward<Method_TriggerHapticPulse, true>::call(&point, this->internal, controllerHandle, eTargetPad, usDurationMicroSec);
 }
 
 
 void  ISteamController_::TriggerRepeatedHapticPulse(ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec, unsigned short  usOffMicroSec, unsigned short  unRepeat, int  nFlags)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ESteamControllerPad )%p, (unsigned short )%p, (unsigned short )%p, (unsigned short )%p, (int )%d)\n", this, controllerHandle, eTargetPad, usDurationMicroSec, usOffMicroSec, unRepeat, nFlags);
-  this->internal->TriggerRepeatedHapticPulse(controllerHandle, eTargetPad, usDurationMicroSec, usOffMicroSec, unRepeat, nFlags);
-  
+  static ProfilePoint point("ISteamController::TriggerRepeatedHapticPulse");
+  return Forward<Method_TriggerRepeatedHapticPulse, true>::call(&point, this->internal, controllerHandle, eTargetPad, usDurationMicroSec, usOffMicroSec, unRepeat, nFlags);
 }
 
 
 void  ISteamController_::TriggerVibration(ControllerHandle_t  controllerHandle, unsigned short  usLeftSpeed, unsigned short  usRightSpeed)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (unsigned short )%p, (unsigned short )%p)\n", this, controllerHandle, usLeftSpeed, usRightSpeed);
-  this->internal->TriggerVibration(controllerHandle, usLeftSpeed, usRightSpeed);
-  
+  static ProfilePoint point("ISteamController::TriggerVibration");
+  return Forward<Method_TriggerVibration, true>::call(&point, this->internal, controllerHandle, usLeftSpeed, usRightSpeed);
 }
 
 
 void  ISteamController_::SetLEDColor(ControllerHandle_t  controllerHandle, uint8  nColorR, uint8  nColorG, uint8  nColorB, int  nFlags)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (uint8 )%p, (uint8 )%p, (uint8 )%p, (int )%d)\n", this, controllerHandle, nColorR, nColorG, nColorB, nFlags);
-  this->internal->SetLEDColor(controllerHandle, nColorR, nColorG, nColorB, nFlags);
-  
+  static ProfilePoint point("ISteamController::SetLEDColor");
+  return Forward<Method_SetLEDColor, true>::call(&point, this->internal, controllerHandle, nColorR, nColorG, nColorB, nFlags);
 }
 
 
 int  ISteamController_::GetGamepadIndexForController(ControllerHandle_t  ulControllerHandle)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p)\n", this, ulControllerHandle);
-  int  result = this->internal->GetGamepadIndexForController(ulControllerHandle);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetGamepadIndexForController");
+  return Forward<Method_GetGamepadIndexForController, true>::call(&point, this->internal, ulControllerHandle);
 }
 
 
 ControllerHandle_t  ISteamController_::GetControllerForGamepadIndex(int  nIndex)
 {
-  TRACE("((ISteamController *)%p, (int )%d)\n", this, nIndex);
-  ControllerHandle_t  result = this->internal->GetControllerForGamepadIndex(nIndex);
-  TRACE("() = (ControllerHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetControllerForGamepadIndex");
+  return Forward<Method_GetControllerForGamepadIndex, true>::call(&point, this->internal, nIndex);
 }
 
 
 ControllerMotionData_t  ISteamController_::GetMotionData(ControllerHandle_t  controllerHandle)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p)\n", this, controllerHandle);
-  ControllerMotionData_t  result = this->internal->GetMotionData(controllerHandle);
-  TRACE("() = (ControllerMotionData_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetMotionData");
+  return Forward<Method_GetMotionData, true>::call(&point, this->internal, controllerHandle);
 }
 
 
 bool  ISteamController_::ShowDigitalActionOrigins(ControllerHandle_t  controllerHandle, ControllerDigitalActionHandle_t  digitalActionHandle, float  flScale, float  flXPosition, float  flYPosition)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerDigitalActionHandle_t )%p, (float )%f, (float )%f, (float )%f)\n", this, controllerHandle, digitalActionHandle, flScale, flXPosition, flYPosition);
-  bool  result = this->internal->ShowDigitalActionOrigins(controllerHandle, digitalActionHandle, flScale, flXPosition, flYPosition);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::ShowDigitalActionOrigins");
+  return Forward<Method_ShowDigitalActionOrigins, true>::call(&point, this->internal, controllerHandle, digitalActionHandle, flScale, flXPosition, flYPosition);
 }
 
 
 bool  ISteamController_::ShowAnalogActionOrigins(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  analogActionHandle, float  flScale, float  flXPosition, float  flYPosition)
 {
-  TRACE("((ISteamController *)%p, (ControllerHandle_t )%p, (ControllerAnalogActionHandle_t )%p, (float )%f, (float )%f, (float )%f)\n", this, controllerHandle, analogActionHandle, flScale, flXPosition, flYPosition);
-  bool  result = this->internal->ShowAnalogActionOrigins(controllerHandle, analogActionHandle, flScale, flXPosition, flYPosition);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::ShowAnalogActionOrigins");
+  return Forward<Method_ShowAnalogActionOrigins, true>::call(&point, this->internal, controllerHandle, analogActionHandle, flScale, flXPosition, flYPosition);
 }
 
 
 char * ISteamController_::GetStringForActionOrigin(EControllerActionOrigin  eOrigin)
 {
-  TRACE("((ISteamController *)%p, (EControllerActionOrigin )%p)\n", this, eOrigin);
-  char * result = this->internal->GetStringForActionOrigin(eOrigin);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetStringForActionOrigin");
+  return Forward<Method_GetStringForActionOrigin, true>::call(&point, this->internal, eOrigin);
 }
 
 
 char * ISteamController_::GetGlyphForActionOrigin(EControllerActionOrigin  eOrigin)
 {
-  TRACE("((ISteamController *)%p, (EControllerActionOrigin )%p)\n", this, eOrigin);
-  char * result = this->internal->GetGlyphForActionOrigin(eOrigin);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamController::GetGlyphForActionOrigin");
+  return Forward<Method_GetGlyphForActionOrigin, true>::call(&point, this->internal, eOrigin);
 }
 ISteamController_::ISteamController_(ISteamController * towrap)
 {
@@ -1,668 +1,563 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetPersonaName);
+FORWARD_METHOD(SetPersonaName);
+FORWARD_METHOD(GetPersonaState);
+FORWARD_METHOD(GetFriendCount);
+FORWARD_METHOD(GetFriendByIndex);
+FORWARD_METHOD(GetFriendRelationship);
+FORWARD_METHOD(GetFriendPersonaState);
+FORWARD_METHOD(GetFriendPersonaName);
+FORWARD_METHOD(GetFriendGamePlayed);
+FORWARD_METHOD(GetFriendPersonaNameHistory);
+FORWARD_METHOD(GetFriendSteamLevel);
+FORWARD_METHOD(GetPlayerNickname);
+FORWARD_METHOD(GetFriendsGroupCount);
+FORWARD_METHOD(GetFriendsGroupIDByIndex);
+FORWARD_METHOD(GetFriendsGroupName);
+FORWARD_METHOD(GetFriendsGroupMembersCount);
+FORWARD_METHOD(GetFriendsGroupMembersList);
+FORWARD_METHOD(HasFriend);
+FORWARD_METHOD(GetClanCount);
+FORWARD_METHOD(GetClanByIndex);
+FORWARD_METHOD(GetClanName);
+FORWARD_METHOD(GetClanTag);
+FORWARD_METHOD(GetClanActivityCounts);
+FORWARD_METHOD(DownloadClanActivityCounts);
+FORWARD_METHOD(GetFriendCountFromSource);
+FORWARD_METHOD(GetFriendFromSourceByIndex);
+FORWARD_METHOD(IsUserInSource);
+FORWARD_METHOD(SetInGameVoiceSpeaking);
+FORWARD_METHOD(ActivateGameOverlay);
+FORWARD_METHOD(ActivateGameOverlayToUser);
+FORWARD_METHOD(ActivateGameOverlayToWebPage);
+FORWARD_METHOD(ActivateGameOverlayToStore);
+FORWARD_METHOD(SetPlayedWith);
+FORWARD_METHOD(ActivateGameOverlayInviteDialog);
+FORWARD_METHOD(GetSmallFriendAvatar);
+FORWARD_METHOD(GetMediumFriendAvatar);
+FORWARD_METHOD(GetLargeFriendAvatar);
+FORWARD_METHOD(RequestUserInformation);
+FORWARD_METHOD(RequestClanOfficerList);
+FORWARD_METHOD(GetClanOwner);
+FORWARD_METHOD(GetClanOfficerCount);
+FORWARD_METHOD(GetClanOfficerByIndex);
+FORWARD_METHOD(GetUserRestrictions);
+FORWARD_METHOD(SetRichPresence);
+FORWARD_METHOD(ClearRichPresence);
+FORWARD_METHOD(GetFriendRichPresence);
+FORWARD_METHOD(GetFriendRichPresenceKeyCount);
+FORWARD_METHOD(GetFriendRichPresenceKeyByIndex);
+FORWARD_METHOD(RequestFriendRichPresence);
+FORWARD_METHOD(InviteUserToGame);
+FORWARD_METHOD(GetCoplayFriendCount);
+FORWARD_METHOD(GetCoplayFriend);
+FORWARD_METHOD(GetFriendCoplayTime);
+FORWARD_METHOD(GetFriendCoplayGame);
+FORWARD_METHOD(JoinClanChatRoom);
+FORWARD_METHOD(LeaveClanChatRoom);
+FORWARD_METHOD(GetClanChatMemberCount);
+FORWARD_METHOD(GetChatMemberByIndex);
+FORWARD_METHOD(SendClanChatMessage);
+FORWARD_METHOD(GetClanChatMessage);
+FORWARD_METHOD(IsClanChatAdmin);
+FORWARD_METHOD(IsClanChatWindowOpenInSteam);
+FORWARD_METHOD(OpenClanChatWindowInSteam);
+FORWARD_METHOD(CloseClanChatWindowInSteam);
+FORWARD_METHOD(SetListenForFriendsMessages);
+FORWARD_METHOD(ReplyToFriendMessage);
+FORWARD_METHOD(GetFriendMessage);
+FORWARD_METHOD(GetFollowerCount);
+FORWARD_METHOD(IsFollowing);
+FORWARD_METHOD(EnumerateFollowingList);
+
 
 char * ISteamFriends_::GetPersonaName()
 {
-  TRACE("((ISteamFriends *)%p)\n", this);
-  char * result = this->internal->GetPersonaName();
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetPersonaName");
+  return Forward<Method_GetPersonaName>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamFriends_::SetPersonaName(char * pchPersonaName)
 {
-  TRACE("((ISteamFriends *)%p, (char *)\"%s\")\n", this, pchPersonaName);
-  SteamAPICall_t  result = this->internal->SetPersonaName(pchPersonaName);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::SetPersonaName");
+  return Forward<Method_SetPersonaName>::call(&point, this->internal, pchPersonaName);
 }
 
 
 EPersonaState  ISteamFriends_::GetPersonaState()
 {
-  TRACE("((ISteamFriends *)%p)\n", this);
-  EPersonaState  result = this->internal->GetPersonaState();
-  TRACE("() = (EPersonaState )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetPersonaState");
+  return Forward<Method_GetPersonaState>::call(&point, this->internal);
 }
 
 
 int  ISteamFriends_::GetFriendCount(int  iFriendFlags)
 {
-  TRACE("((ISteamFriends *)%p, (int )%d)\n", this, iFriendFlags);
-  int  result = this->internal->GetFriendCount(iFriendFlags);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendCount");
+  return Forward<Method_GetFriendCount>::call(&point, this->internal, iFriendFlags);
 }
 
 
 CSteamID * ISteamFriends_::GetFriendByIndex(CSteamID * hidden, int  iFriend, int  iFriendFlags)
 {
-  TRACE("((ISteamFriends *)%p, (int )%d, (int )%d)\n", this, iFriend, iFriendFlags);
-  *hidden = this->internal->GetFriendByIndex(iFriend, iFriendFlags);
-  return hidden;
+  static ProfilePoint point("ISteamFriends::GetFriendByIndex");
+  return Forward<Method_GetFriendByIndex>::hidden(&point, hidden, this->internal, iFriend, iFriendFlags);
 }
 
 
 EFriendRelationship  ISteamFriends_::GetFriendRelationship(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  EFriendRelationship  result = this->internal->GetFriendRelationship(steamIDFriend);
-  TRACE("() = (EFriendRelationship )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendRelationship");
+  return Forward<Method_GetFriendRelationship>::call(&point, this->internal, steamIDFriend);
 }
 
 
 EPersonaState  ISteamFriends_::GetFriendPersonaState(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  EPersonaState  result = this->internal->GetFriendPersonaState(steamIDFriend);
-  TRACE("() = (EPersonaState )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendPersonaState");
+  return Forward<Method_GetFriendPersonaState>::call(&point, this->internal, steamIDFriend);
 }
 
 
 char * ISteamFriends_::GetFriendPersonaName(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  char * result = this->internal->GetFriendPersonaName(steamIDFriend);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendPersonaName");
+  return Forward<Method_GetFriendPersonaName>::call(&point, this->internal, steamIDFriend);
 }
 
 
 bool  ISteamFriends_::GetFriendGamePlayed(CSteamID  steamIDFriend, FriendGameInfo_t * pFriendGameInfo)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (FriendGameInfo_t *)%p)\n", this, steamIDFriend, pFriendGameInfo);
-  bool  result = this->internal->GetFriendGamePlayed(steamIDFriend, pFriendGameInfo);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendGamePlayed");
+  return Forward<Method_GetFriendGamePlayed>::call(&point, this->internal, steamIDFriend, pFriendGameInfo);
 }
 
 
 char * ISteamFriends_::GetFriendPersonaNameHistory(CSteamID  steamIDFriend, int  iPersonaName)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDFriend, iPersonaName);
-  char * result = this->internal->GetFriendPersonaNameHistory(steamIDFriend, iPersonaName);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendPersonaNameHistory");
+  return Forward<Method_GetFriendPersonaNameHistory>::call(&point, this->internal, steamIDFriend, iPersonaName);
 }
 
 
 int  ISteamFriends_::GetFriendSteamLevel(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  int  result = this->internal->GetFriendSteamLevel(steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendSteamLevel");
+  return Forward<Method_GetFriendSteamLevel>::call(&point, this->internal, steamIDFriend);
 }
 
 
 char * ISteamFriends_::GetPlayerNickname(CSteamID  steamIDPlayer)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDPlayer);
-  char * result = this->internal->GetPlayerNickname(steamIDPlayer);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetPlayerNickname");
+  return Forward<Method_GetPlayerNickname>::call(&point, this->internal, steamIDPlayer);
 }
 
 
 int  ISteamFriends_::GetFriendsGroupCount()
 {
-  TRACE("((ISteamFriends *)%p)\n", this);
-  int  result = this->internal->GetFriendsGroupCount();
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendsGroupCount");
+  return Forward<Method_GetFriendsGroupCount>::call(&point, this->internal);
 }
 
 
 FriendsGroupID_t  ISteamFriends_::GetFriendsGroupIDByIndex(int  iFG)
 {
-  TRACE("((ISteamFriends *)%p, (int )%d)\n", this, iFG);
-  FriendsGroupID_t  result = this->internal->GetFriendsGroupIDByIndex(iFG);
-  TRACE("() = (FriendsGroupID_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendsGroupIDByIndex");
+  return Forward<Method_GetFriendsGroupIDByIndex>::call(&point, this->internal, iFG);
 }
 
 
 char * ISteamFriends_::GetFriendsGroupName(FriendsGroupID_t  friendsGroupID)
 {
-  TRACE("((ISteamFriends *)%p, (FriendsGroupID_t )%p)\n", this, friendsGroupID);
-  char * result = this->internal->GetFriendsGroupName(friendsGroupID);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendsGroupName");
+  return Forward<Method_GetFriendsGroupName>::call(&point, this->internal, friendsGroupID);
 }
 
 
 int  ISteamFriends_::GetFriendsGroupMembersCount(FriendsGroupID_t  friendsGroupID)
 {
-  TRACE("((ISteamFriends *)%p, (FriendsGroupID_t )%p)\n", this, friendsGroupID);
-  int  result = this->internal->GetFriendsGroupMembersCount(friendsGroupID);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendsGroupMembersCount");
+  return Forward<Method_GetFriendsGroupMembersCount>::call(&point, this->internal, friendsGroupID);
 }
 
 
 void  ISteamFriends_::GetFriendsGroupMembersList(FriendsGroupID_t  friendsGroupID, CSteamID * pOutSteamIDMembers, int  nMembersCount)
 {
-  TRACE("((ISteamFriends *)%p, (FriendsGroupID_t )%p, (CSteamID *)%p, (int )%d)\n", this, friendsGroupID, pOutSteamIDMembers, nMembersCount);
-  this->internal->GetFriendsGroupMembersList(friendsGroupID, pOutSteamIDMembers, nMembersCount);
-  
+  static ProfilePoint point("ISteamFriends::GetFriendsGroupMembersList");
+  return Forward<Method_GetFriendsGroupMembersList>::call(&point, this->internal, friendsGroupID, pOutSteamIDMembers, nMembersCount);
 }
 
 
 bool  ISteamFriends_::HasFriend(CSteamID  steamIDFriend, int  iFriendFlags)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDFriend, iFriendFlags);
-  bool  result = this->internal->HasFriend(steamIDFriend, iFriendFlags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::HasFriend");
+  return Forward<Method_HasFriend>::call(&point, this->internal, steamIDFriend, iFriendFlags);
 }
 
 
 int  ISteamFriends_::GetClanCount()
 {
-  TRACE("((ISteamFriends *)%p)\n", this);
-  int  result = this->internal->GetClanCount();
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetClanCount");
+  return Forward<Method_GetClanCount>::call(&point, this->internal);
 }
 
 
 CSteamID * ISteamFriends_::GetClanByIndex(CSteamID * hidden, int  iClan)
 {
-  TRACE("((ISteamFriends *)%p, (int )%d)\n", this, iClan);
-  *hidden = this->internal->GetClanByIndex(iClan);
-  return hidden;
+  static ProfilePoint point("ISteamFriends::GetClanByIndex");
+  return Forward<Method_GetClanByIndex>::hidden(&point, hidden, this->internal, iClan);
 }
 
 
 char * ISteamFriends_::GetClanName(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  char * result = this->internal->GetClanName(steamIDClan);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetClanName");
+  return Forward<Method_GetClanName>::call(&point, this->internal, steamIDClan);
 }
 
 
 char * ISteamFriends_::GetClanTag(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  char * result = this->internal->GetClanTag(steamIDClan);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetClanTag");
+  return Forward<Method_GetClanTag>::call(&point, this->internal, steamIDClan);
 }
 
 
 bool  ISteamFriends_::GetClanActivityCounts(CSteamID  steamIDClan, int * pnOnline, int * pnInGame, int * pnChatting)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int *)%d, (int *)%d, (int *)%d)\n", this, steamIDClan, pnOnline, pnInGame, pnChatting);
-  bool  result = this->internal->GetClanActivityCounts(steamIDClan, pnOnline, pnInGame, pnChatting);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetClanActivityCounts");
+  return Forward<Method_GetClanActivityCounts>::call(&point, this->internal, steamIDClan, pnOnline, pnInGame, pnChatting);
 }
 
 
 SteamAPICall_t  ISteamFriends_::DownloadClanActivityCounts(CSteamID * psteamIDClans, int  cClansToRequest)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID *)%p, (int )%d)\n", this, psteamIDClans, cClansToRequest);
-  SteamAPICall_t  result = this->internal->DownloadClanActivityCounts(psteamIDClans, cClansToRequest);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::DownloadClanActivityCounts");
+  return Forward<Method_DownloadClanActivityCounts>::call(&point, this->internal, psteamIDClans, cClansToRequest);
 }
 
 
 int  ISteamFriends_::GetFriendCountFromSource(CSteamID  steamIDSource)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDSource);
-  int  result = this->internal->GetFriendCountFromSource(steamIDSource);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendCountFromSource");
+  return Forward<Method_GetFriendCountFromSource>::call(&point, this->internal, steamIDSource);
 }
 
 
 CSteamID * ISteamFriends_::GetFriendFromSourceByIndex(CSteamID * hidden, CSteamID  steamIDSource, int  iFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDSource, iFriend);
-  *hidden = this->internal->GetFriendFromSourceByIndex(steamIDSource, iFriend);
-  return hidden;
+  static ProfilePoint point("ISteamFriends::GetFriendFromSourceByIndex");
+  return Forward<Method_GetFriendFromSourceByIndex>::hidden(&point, hidden, this->internal, steamIDSource, iFriend);
 }
 
 
 bool  ISteamFriends_::IsUserInSource(CSteamID  steamIDUser, CSteamID  steamIDSource)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (CSteamID )%p)\n", this, steamIDUser, steamIDSource);
-  bool  result = this->internal->IsUserInSource(steamIDUser, steamIDSource);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::IsUserInSource");
+  return Forward<Method_IsUserInSource>::call(&point, this->internal, steamIDUser, steamIDSource);
 }
 
 
 void  ISteamFriends_::SetInGameVoiceSpeaking(CSteamID  steamIDUser, bool  bSpeaking)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (bool )%d)\n", this, steamIDUser, bSpeaking);
-  this->internal->SetInGameVoiceSpeaking(steamIDUser, bSpeaking);
-  
+  static ProfilePoint point("ISteamFriends::SetInGameVoiceSpeaking");
+  return Forward<Method_SetInGameVoiceSpeaking>::call(&point, this->internal, steamIDUser, bSpeaking);
 }
 
 
 void  ISteamFriends_::ActivateGameOverlay(char * pchDialog)
 {
-  TRACE("((ISteamFriends *)%p, (char *)\"%s\")\n", this, pchDialog);
-  this->internal->ActivateGameOverlay(pchDialog);
-  
+  static ProfilePoint point("ISteamFriends::ActivateGameOverlay");
+  return Forward<Method_ActivateGameOverlay>::call(&point, this->internal, pchDialog);
 }
 
 
 void  ISteamFriends_::ActivateGameOverlayToUser(char * pchDialog, CSteamID  steamID)
 {
-  TRACE("((ISteamFriends *)%p, (char *)\"%s\", (CSteamID )%p)\n", this, pchDialog, steamID);
-  this->internal->ActivateGameOverlayToUser(pchDialog, steamID);
-  
+  static ProfilePoint point("ISteamFriends::ActivateGameOverlayToUser");
+  return Forward<Method_ActivateGameOverlayToUser>::call(&point, this->internal, pchDialog, steamID);
 }
 
 
 void  ISteamFriends_::ActivateGameOverlayToWebPage(char * pchURL)
 {
-  TRACE("((ISteamFriends *)%p, (char *)\"%s\")\n", this, pchURL);
-  this->internal->ActivateGameOverlayToWebPage(pchURL);
-  
+  static ProfilePoint point("ISteamFriends::ActivateGameOverlayToWebPage");
+  return Forward<Method_ActivateGameOverlayToWebPage>::call(&point, this->internal, pchURL);
 }
 
 
 void  ISteamFriends_::ActivateGameOverlayToStore(AppId_t  nAppID, EOverlayToStoreFlag  eFlag)
 {
-  TRACE("((ISteamFriends *)%p, (AppId_t )%p, (EOverlayToStoreFlag )%p)\n", this, nAppID, eFlag);
-  this->internal->ActivateGameOverlayToStore(nAppID, eFlag);
-  
+  static ProfilePoint point("ISteamFriends::ActivateGameOverlayToStore");
+  return Forward<Method_ActivateGameOverlayToStore>::call(&point, this->internal, nAppID, eFlag);
 }
 
 
 void  ISteamFriends_::SetPlayedWith(CSteamID  steamIDUserPlayedWith)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDUserPlayedWith);
-  this->internal->SetPlayedWith(steamIDUserPlayedWith);
-  
+  static ProfilePoint point("ISteamFriends::SetPlayedWith");
+  return Forward<Method_SetPlayedWith>::call(&point, this->internal, steamIDUserPlayedWith);
 }
 
 
 void  ISteamFriends_::ActivateGameOverlayInviteDialog(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  this->internal->ActivateGameOverlayInviteDialog(steamIDLobby);
-  
+  static ProfilePoint point("ISteamFriends::ActivateGameOverlayInviteDialog");
+  return Forward<Method_ActivateGameOverlayInviteDialog>::call(&point, this->internal, steamIDLobby);
 }
 
 
 int  ISteamFriends_::GetSmallFriendAvatar(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  int  result = this->internal->GetSmallFriendAvatar(steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetSmallFriendAvatar");
+  return Forward<Method_GetSmallFriendAvatar>::call(&point, this->internal, steamIDFriend);
 }
 
 
 int  ISteamFriends_::GetMediumFriendAvatar(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  int  result = this->internal->GetMediumFriendAvatar(steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetMediumFriendAvatar");
+  return Forward<Method_GetMediumFriendAvatar>::call(&point, this->internal, steamIDFriend);
 }
 
 
 int  ISteamFriends_::GetLargeFriendAvatar(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  int  result = this->internal->GetLargeFriendAvatar(steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetLargeFriendAvatar");
+  return Forward<Method_GetLargeFriendAvatar>::call(&point, this->internal, steamIDFriend);
 }
 
 
 bool  ISteamFriends_::RequestUserInformation(CSteamID  steamIDUser, bool  bRequireNameOnly)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (bool )%d)\n", this, steamIDUser, bRequireNameOnly);
-  bool  result = this->internal->RequestUserInformation(steamIDUser, bRequireNameOnly);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::RequestUserInformation");
+  return Forward<Method_RequestUserInformation>::call(&point, this->internal, steamIDUser, bRequireNameOnly);
 }
 
 
 SteamAPICall_t  ISteamFriends_::RequestClanOfficerList(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  SteamAPICall_t  result = this->internal->RequestClanOfficerList(steamIDClan);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::RequestClanOfficerList");
+  return Forward<Method_RequestClanOfficerList>::call(&point, this->internal, steamIDClan);
 }
 
 
 CSteamID * ISteamFriends_::GetClanOwner(CSteamID * hidden, CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  *hidden = this->internal->GetClanOwner(steamIDClan);
-  return hidden;
+  static ProfilePoint point("ISteamFriends::GetClanOwner");
+  return Forward<Method_GetClanOwner>::hidden(&point, hidden, this->internal, steamIDClan);
 }
 
 
 int  ISteamFriends_::GetClanOfficerCount(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  int  result = this->internal->GetClanOfficerCount(steamIDClan);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetClanOfficerCount");
+  return Forward<Method_GetClanOfficerCount>::call(&point, this->internal, steamIDClan);
 }
 
 
 CSteamID * ISteamFriends_::GetClanOfficerByIndex(CSteamID * hidden, CSteamID  steamIDClan, int  iOfficer)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDClan, iOfficer);
-  *hidden = this->internal->GetClanOfficerByIndex(steamIDClan, iOfficer);
-  return hidden;
+  static ProfilePoint point("ISteamFriends::GetClanOfficerByIndex");
+  return Forward<Method_GetClanOfficerByIndex>::hidden(&point, hidden, this->internal, steamIDClan, iOfficer);
 }
 
 
 uint32  ISteamFriends_::GetUserRestrictions()
 {
-  TRACE("((ISteamFriends *)%p)\n", this);
-  uint32  result = this->internal->GetUserRestrictions();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetUserRestrictions");
+  return Forward<Method_GetUserRestrictions>::call(&point, this->internal);
 }
 
 
 bool  ISteamFriends_::SetRichPresence(char * pchKey, char * pchValue)
 {
-  TRACE("((ISteamFriends *)%p, (char *)\"%s\", (char *)\"%s\")\n", this, pchKey, pchValue);
-  bool  result = this->internal->SetRichPresence(pchKey, pchValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::SetRichPresence");
+  return Forward<Method_SetRichPresence>::call(&point, this->internal, pchKey, pchValue);
 }
 
 
 void  ISteamFriends_::ClearRichPresence()
 {
-  TRACE("((ISteamFriends *)%p)\n", this);
-  this->internal->ClearRichPresence();
-  
+  static ProfilePoint point("ISteamFriends::ClearRichPresence");
+  return Forward<Method_ClearRichPresence>::call(&point, this->internal);
 }
 
 
 char * ISteamFriends_::GetFriendRichPresence(CSteamID  steamIDFriend, char * pchKey)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDFriend, pchKey);
-  char * result = this->internal->GetFriendRichPresence(steamIDFriend, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendRichPresence");
+  return Forward<Method_GetFriendRichPresence>::call(&point, this->internal, steamIDFriend, pchKey);
 }
 
 
 int  ISteamFriends_::GetFriendRichPresenceKeyCount(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  int  result = this->internal->GetFriendRichPresenceKeyCount(steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendRichPresenceKeyCount");
+  return Forward<Method_GetFriendRichPresenceKeyCount>::call(&point, this->internal, steamIDFriend);
 }
 
 
 char * ISteamFriends_::GetFriendRichPresenceKeyByIndex(CSteamID  steamIDFriend, int  iKey)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDFriend, iKey);
-  char * result = this->internal->GetFriendRichPresenceKeyByIndex(steamIDFriend, iKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendRichPresenceKeyByIndex");
+  return Forward<Method_GetFriendRichPresenceKeyByIndex>::call(&point, this->internal, steamIDFriend, iKey);
 }
 
 
 void  ISteamFriends_::RequestFriendRichPresence(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  this->internal->RequestFriendRichPresence(steamIDFriend);
-  
+  static ProfilePoint point("ISteamFriends::RequestFriendRichPresence");
+  return Forward<Method_RequestFriendRichPresence>::call(&point, this->internal, steamIDFriend);
 }
 
 
 bool  ISteamFriends_::InviteUserToGame(CSteamID  steamIDFriend, char * pchConnectString)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDFriend, pchConnectString);
-  bool  result = this->internal->InviteUserToGame(steamIDFriend, pchConnectString);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::InviteUserToGame");
+  return Forward<Method_InviteUserToGame>::call(&point, this->internal, steamIDFriend, pchConnectString);
 }
 
 
 int  ISteamFriends_::GetCoplayFriendCount()
 {
-  TRACE("((ISteamFriends *)%p)\n", this);
-  int  result = this->internal->GetCoplayFriendCount();
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetCoplayFriendCount");
+  return Forward<Method_GetCoplayFriendCount>::call(&point, this->internal);
 }
 
 
 CSteamID * ISteamFriends_::GetCoplayFriend(CSteamID * hidden, int  iCoplayFriend)
 {
-  TRACE("((ISteamFriends *)%p, (int )%d)\n", this, iCoplayFriend);
-  *hidden = this->internal->GetCoplayFriend(iCoplayFriend);
-  return hidden;
+  static ProfilePoint point("ISteamFriends::GetCoplayFriend");
+  return Forward<Method_GetCoplayFriend>::hidden(&point, hidden, this->internal, iCoplayFriend);
 }
 
 
 int  ISteamFriends_::GetFriendCoplayTime(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  int  result = this->internal->GetFriendCoplayTime(steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendCoplayTime");
+  return Forward<Method_GetFriendCoplayTime>::call(&point, this->internal, steamIDFriend);
 }
 
 
 AppId_t  ISteamFriends_::GetFriendCoplayGame(CSteamID  steamIDFriend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDFriend);
-  AppId_t  result = this->internal->GetFriendCoplayGame(steamIDFriend);
-  TRACE("() = (AppId_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendCoplayGame");
+  return Forward<Method_GetFriendCoplayGame>::call(&point, this->internal, steamIDFriend);
 }
 
 
 SteamAPICall_t  ISteamFriends_::JoinClanChatRoom(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  SteamAPICall_t  result = this->internal->JoinClanChatRoom(steamIDClan);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::JoinClanChatRoom");
+  return Forward<Method_JoinClanChatRoom>::call(&point, this->internal, steamIDClan);
 }
 
 
 bool  ISteamFriends_::LeaveClanChatRoom(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  bool  result = this->internal->LeaveClanChatRoom(steamIDClan);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::LeaveClanChatRoom");
+  return Forward<Method_LeaveClanChatRoom>::call(&point, this->internal, steamIDClan);
 }
 
 
 int  ISteamFriends_::GetClanChatMemberCount(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  int  result = this->internal->GetClanChatMemberCount(steamIDClan);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetClanChatMemberCount");
+  return Forward<Method_GetClanChatMemberCount>::call(&point, this->internal, steamIDClan);
 }
 
 
 CSteamID * ISteamFriends_::GetChatMemberByIndex(CSteamID * hidden, CSteamID  steamIDClan, int  iUser)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDClan, iUser);
-  *hidden = this->internal->GetChatMemberByIndex(steamIDClan, iUser);
-  return hidden;
+  static ProfilePoint point("ISteamFriends::GetChatMemberByIndex");
+  return Forward<Method_GetChatMemberByIndex>::hidden(&point, hidden, this->internal, steamIDClan, iUser);
 }
 
 
 bool  ISteamFriends_::SendClanChatMessage(CSteamID  steamIDClanChat, char * pchText)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDClanChat, pchText);
-  bool  result = this->internal->SendClanChatMessage(steamIDClanChat, pchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::SendClanChatMessage");
+  return Forward<Method_SendClanChatMessage>::call(&point, this->internal, steamIDClanChat, pchText);
 }
 
 
 int  ISteamFriends_::GetClanChatMessage(CSteamID  steamIDClanChat, int  iMessage, void * prgchText, int  cchTextMax, EChatEntryType * peChatEntryType, CSteamID * psteamidChatter)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d, (void *)%p, (int )%d, (EChatEntryType *)%p, (CSteamID *)%p)\n", this, steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter);
-  int  result = this->internal->GetClanChatMessage(steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetClanChatMessage", "3:4");
+  return Forward<Method_GetClanChatMessage>::call(&point, this->internal, steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter);
 }
 
 
 bool  ISteamFriends_::IsClanChatAdmin(CSteamID  steamIDClanChat, CSteamID  steamIDUser)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (CSteamID )%p)\n", this, steamIDClanChat, steamIDUser);
-  bool  result = this->internal->IsClanChatAdmin(steamIDClanChat, steamIDUser);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::IsClanChatAdmin");
+  return Forward<Method_IsClanChatAdmin>::call(&point, this->internal, steamIDClanChat, steamIDUser);
 }
 
 
 bool  ISteamFriends_::IsClanChatWindowOpenInSteam(CSteamID  steamIDClanChat)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClanChat);
-  bool  result = this->internal->IsClanChatWindowOpenInSteam(steamIDClanChat);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::IsClanChatWindowOpenInSteam");
+  return Forward<Method_IsClanChatWindowOpenInSteam>::call(&point, this->internal, steamIDClanChat);
 }
 
 
 bool  ISteamFriends_::OpenClanChatWindowInSteam(CSteamID  steamIDClanChat)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClanChat);
-  bool  result = this->internal->OpenClanChatWindowInSteam(steamIDClanChat);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::OpenClanChatWindowInSteam");
+  return Forward<Method_OpenClanChatWindowInSteam>::call(&point, this->internal, steamIDClanChat);
 }
 
 
 bool  ISteamFriends_::CloseClanChatWindowInSteam(CSteamID  steamIDClanChat)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamIDClanChat);
-  bool  result = this->internal->CloseClanChatWindowInSteam(steamIDClanChat);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::CloseClanChatWindowInSteam");
+  return Forward<Method_CloseClanChatWindowInSteam>::call(&point, this->internal, steamIDClanChat);
 }
 
 
 bool  ISteamFriends_::SetListenForFriendsMessages(bool  bInterceptEnabled)
 {
-  TRACE("((ISteamFriends *)%p, (bool )%d)\n", this, bInterceptEnabled);
-  bool  result = this->internal->SetListenForFriendsMessages(bInterceptEnabled);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::SetListenForFriendsMessages");
+  return Forward<Method_SetListenForFriendsMessages>::call(&point, this->internal, bInterceptEnabled);
 }
 
 
 bool  ISteamFriends_::ReplyToFriendMessage(CSteamID  steamIDFriend, char * pchMsgToSend)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDFriend, pchMsgToSend);
-  bool  result = this->internal->ReplyToFriendMessage(steamIDFriend, pchMsgToSend);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::ReplyToFriendMessage");
+  return Forward<Method_ReplyToFriendMessage>::call(&point, this->internal, steamIDFriend, pchMsgToSend);
 }
 
 
 int  ISteamFriends_::GetFriendMessage(CSteamID  steamIDFriend, int  iMessageID, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p, (int )%d, (void *)%p, (int )%d, (EChatEntryType *)%p)\n", this, steamIDFriend, iMessageID, pvData, cubData, peChatEntryType);
-  int  result = this->internal->GetFriendMessage(steamIDFriend, iMessageID, pvData, cubData, peChatEntryType);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFriendMessage", "3:4");
+  return Forward<Method_GetFriendMessage>::call(&point, this->internal, steamIDFriend, iMessageID, pvData, cubData, peChatEntryType);
 }
 
 
 SteamAPICall_t  ISteamFriends_::GetFollowerCount(CSteamID  steamID)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamID);
-  SteamAPICall_t  result = this->internal->GetFollowerCount(steamID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::GetFollowerCount");
+  return Forward<Method_GetFollowerCount>::call(&point, this->internal, steamID);
 }
 
 
 SteamAPICall_t  ISteamFriends_::IsFollowing(CSteamID  steamID)
 {
-  TRACE("((ISteamFriends *)%p, (CSteamID )%p)\n", this, steamID);
-  SteamAPICall_t  result = this->internal->IsFollowing(steamID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::IsFollowing");
+  return Forward<Method_IsFollowing>::call(&point, this->internal, steamID);
 }
 
 
 SteamAPICall_t  ISteamFriends_::EnumerateFollowingList(uint32  unStartIndex)
 {
-  TRACE("((ISteamFriends *)%p, (uint32 )%d)\n", this, unStartIndex);
-  SteamAPICall_t  result = this->internal->EnumerateFollowingList(unStartIndex);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamFriends::EnumerateFollowingList");
+  return Forward<Method_EnumerateFollowingList>::call(&point, this->internal, unStartIndex);
 }
 ISteamFriends_::ISteamFriends_(ISteamFriends * towrap)
 {
@@ -1,32 +1,27 @@
 #include <steam_api_.h>
+FORWARD_METHOD(SendMessage);
+FORWARD_METHOD(IsMessageAvailable);
+FORWARD_METHOD(RetrieveMessage);
+
 
 EGCResults  ISteamGameCoordinator_::SendMessage(uint32  unMsgType, void * pubData, uint32  cubData)
 {
-  TRACE("((ISteamGameCoordinator *)%p, (uint32 )%d, (void *)%p, (uint32 )%d)\n", this, unMsgType, pubData, cubData);
-  EGCResults  result = this->internal->SendMessage(unMsgType, pubData, cubData);
-  TRACE("() = (EGCResults )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameCoordinator::SendMessage", "2:3");
+  return Forward<Method_SendMessage>::call(&point, this->internal, unMsgType, pubData, cubData);
 }
 
 
 bool  ISteamGameCoordinator_::IsMessageAvailable(uint32 * pcubMsgSize)
 {
-  TRACE("((ISteamGameCoordinator *)%p, (uint32 *)%d)\n", this, pcubMsgSize);
-  bool  result = this->internal->IsMessageAvailable(pcubMsgSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameCoordinator::IsMessageAvailable");
+  return Forward<Method_IsMessageAvailable>::call(&point, this->internal, pcubMsgSize);
 }
 
 
 EGCResults  ISteamGameCoordinator_::RetrieveMessage(uint32 * punMsgType, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize)
 {
-  TRACE("((ISteamGameCoordinator *)%p, (uint32 *)%d, (void *)%p, (uint32 )%d, (uint32 *)%d)\n", this, punMsgType, pubDest, cubDest, pcubMsgSize);
-  EGCResults  result = this->internal->RetrieveMessage(punMsgType, pubDest, cubDest, pcubMsgSize);
-  TRACE("() = (EGCResults )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameCoordinator::RetrieveMessage", "2:3");
+  return Forward<Method_RetrieveMessage>::call(&point, this->internal, punMsgType, pubDest, cubDest, pcubMsgSize);
 }
 ISteamGameCoordinator_::ISteamGameCoordinator_(ISteamGameCoordinator * towrap)
 {
@@ -1,386 +1,355 @@
 #include <steam_api_.h>
+FORWARD_METHOD(InitGameServer);
+FORWARD_METHOD(SetProduct);
+FORWARD_METHOD(SetGameDescription);
+FORWARD_METHOD(SetModDir);
+FORWARD_METHOD(SetDedicatedServer);
+FORWARD_METHOD(LogOn);
+FORWARD_METHOD(LogOnAnonymous);
+FORWARD_METHOD(LogOff);
+FORWARD_METHOD(BLoggedOn);
+FORWARD_METHOD(BSecure);
+FORWARD_METHOD(GetSteamID);
+FORWARD_METHOD(WasRestartRequested);
+FORWARD_METHOD(SetMaxPlayerCount);
+FORWARD_METHOD(SetBotPlayerCount);
+FORWARD_METHOD(SetServerName);
+FORWARD_METHOD(SetMapName);
+FORWARD_METHOD(SetPasswordProtected);
+FORWARD_METHOD(SetSpectatorPort);
+FORWARD_METHOD(SetSpectatorServerName);
+FORWARD_METHOD(ClearAllKeyValues);
+FORWARD_METHOD(SetKeyValue);
+FORWARD_METHOD(SetGameTags);
+FORWARD_METHOD(SetGameData);
+FORWARD_METHOD(SetRegion);
+FORWARD_METHOD(SendUserConnectAndAuthenticate);
+FORWARD_METHOD(CreateUnauthenticatedUserConnection);
+FORWARD_METHOD(SendUserDisconnect);
+FORWARD_METHOD(BUpdateUserData);
+FORWARD_METHOD(GetAuthSessionTicket);
+FORWARD_METHOD(BeginAuthSession);
+FORWARD_METHOD(EndAuthSession);
+FORWARD_METHOD(CancelAuthTicket);
+FORWARD_METHOD(UserHasLicenseForApp);
+FORWARD_METHOD(RequestUserGroupStatus);
+FORWARD_METHOD(GetGameplayStats);
+FORWARD_METHOD(GetServerReputation);
+FORWARD_METHOD(GetPublicIP);
+FORWARD_METHOD(HandleIncomingPacket);
+FORWARD_METHOD(GetNextOutgoingPacket);
+FORWARD_METHOD(EnableHeartbeats);
+FORWARD_METHOD(SetHeartbeatInterval);
+FORWARD_METHOD(ForceHeartbeat);
+FORWARD_METHOD(AssociateWithClan);
+FORWARD_METHOD(ComputeNewPlayerCompatibility);
+
 
 bool  ISteamGameServer_::InitGameServer(uint32  unIP, uint16  usGamePort, uint16  usQueryPort, uint32  unFlags, AppId_t  nGameAppId, char * pchVersionString)
 {
-  TRACE("((ISteamGameServer *)%p, (uint32 )%d, (uint16 )%d, (uint16 )%d, (uint32 )%d, (AppId_t )%p, (char *)\"%s\")\n", this, unIP, usGamePort, usQueryPort, unFlags, nGameAppId, pchVersionString);
-  bool  result = this->internal->InitGameServer(unIP, usGamePort, usQueryPort, unFlags, nGameAppId, pchVersionString);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::InitGameServer");
+  return Forward<Method_InitGameServer>::call(&point, this->internal, unIP, usGamePort, usQueryPort, unFlags, nGameAppId, pchVersionString);
 }
 
 
 void  ISteamGameServer_::SetProduct(char * pszProduct)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszProduct);
-  this->internal->SetProduct(pszProduct);
-  
+  static ProfilePoint point("ISteamGameServer::SetProduct");
+  return Forward<Method_SetProduct>::call(&point, this->internal, pszProduct);
 }
 
 
 void  ISteamGameServer_::SetGameDescription(char * pszGameDescription)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszGameDescription);
-  this->internal->SetGameDescription(pszGameDescription);
-  
+  static ProfilePoint point("ISteamGameServer::SetGameDescription");
+  return Forward<Method_SetGameDescription>::call(&point, this->internal, pszGameDescription);
 }
 
 
 void  ISteamGameServer_::SetModDir(char * pszModDir)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszModDir);
-  this->internal->SetModDir(pszModDir);
-  
+  static ProfilePoint point("ISteamGameServer::SetModDir");
+  return Forward<Method_SetModDir>::call(&point, this->internal, pszModDir);
 }
 
 
 void  ISteamGameServer_::SetDedicatedServer(bool  bDedicated)
 {
-  TRACE("((ISteamGameServer *)%p, (bool )%d)\n", this, bDedicated);
-  this->internal->SetDedicatedServer(bDedicated);
-  
+  static ProfilePoint point("ISteamGameServer::SetDedicatedServer");
+  return Forward<Method_SetDedicatedServer>::call(&point, this->internal, bDedicated);
 }
 
 
 void  ISteamGameServer_::LogOn(char * pszToken)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszToken);
-  this->internal->LogOn(pszToken);
-  
+  static ProfilePoint point("ISteamGameServer::LogOn");
+  return Forward<Method_LogOn>::call(&point, this->internal, pszToken);
 }
 
 
 void  ISteamGameServer_::LogOnAnonymous()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  this->internal->LogOnAnonymous();
-  
+  static ProfilePoint point("ISteamGameServer::LogOnAnonymous");
+  return Forward<Method_LogOnAnonymous>::call(&point, this->internal);
 }
 
 
 void  ISteamGameServer_::LogOff()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  this->internal->LogOff();
-  
+  static ProfilePoint point("ISteamGameServer::LogOff");
+  return Forward<Method_LogOff>::call(&point, this->internal);
 }
 
 
 bool  ISteamGameServer_::BLoggedOn()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  bool  result = this->internal->BLoggedOn();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::BLoggedOn");
+  return Forward<Method_BLoggedOn>::call(&point, this->internal);
 }
 
 
 bool  ISteamGameServer_::BSecure()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  bool  result = this->internal->BSecure();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::BSecure");
+  return Forward<Method_BSecure>::call(&point, this->internal);
 }
 
 
 CSteamID * ISteamGameServer_::GetSteamID(CSteamID * hidden)
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  *hidden = this->internal->GetSteamID();
-  return hidden;
+  static ProfilePoint point("ISteamGameServer::GetSteamID");
+  return Forward<Method_GetSteamID>::hidden(&point, hidden, this->internal);
 }
 
 
 bool  ISteamGameServer_::WasRestartRequested()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  bool  result = this->internal->WasRestartRequested();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::WasRestartRequested");
+  return Forward<Method_WasRestartRequested>::call(&point, this->internal);
 }
 
 
 void  ISteamGameServer_::SetMaxPlayerCount(int  cPlayersMax)
 {
-  TRACE("((ISteamGameServer *)%p, (int )%d)\n", this, cPlayersMax);
-  this->internal->SetMaxPlayerCount(cPlayersMax);
-  
+  static ProfilePoint point("ISteamGameServer::SetMaxPlayerCount");
+  return Forward<Method_SetMaxPlayerCount>::call(&point, this->internal, cPlayersMax);
 }
 
 
 void  ISteamGameServer_::SetBotPlayerCount(int  cBotplayers)
 {
-  TRACE("((ISteamGameServer *)%p, (int )%d)\n", this, cBotplayers);
-  this->internal->SetBotPlayerCount(cBotplayers);
-  
+  static ProfilePoint point("ISteamGameServer::SetBotPlayerCount");
+  return Forward<Method_SetBotPlayerCount>::call(&point, this->internal, cBotplayers);
 }
 
 
 void  ISteamGameServer_::SetServerName(char * pszServerName)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszServerName);
-  this->internal->SetServerName(pszServerName);
-  
+  static ProfilePoint point("ISteamGameServer::SetServerName");
+  return Forward<Method_SetServerName>::call(&point, this->internal, pszServerName);
 }
 
 
 void  ISteamGameServer_::SetMapName(char * pszMapName)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszMapName);
-  this->internal->SetMapName(pszMapName);
-  
+  static ProfilePoint point("ISteamGameServer::SetMapName");
+  return Forward<Method_SetMapName>::call(&point, this->internal, pszMapName);
 }
 
 
 void  ISteamGameServer_::SetPasswordProtected(bool  bPasswordProtected)
 {
-  TRACE("((ISteamGameServer *)%p, (bool )%d)\n", this, bPasswordProtected);
-  this->internal->SetPasswordProtected(bPasswordProtected);
-  
+  static ProfilePoint point("ISteamGameServer::SetPasswordProtected");
+  return Forward<Method_SetPasswordProtected>::call(&point, this->internal, bPasswordProtected);
 }
 
 
 void  ISteamGameServer_::SetSpectatorPort(uint16  unSpectatorPort)
 {
-  TRACE("((ISteamGameServer *)%p, (uint16 )%d)\n", this, unSpectatorPort);
-  this->internal->SetSpectatorPort(unSpectatorPort);
-  
+  static ProfilePoint point("ISteamGameServer::SetSpectatorPort");
+  return Forward<Method_SetSpectatorPort>::call(&point, this->internal, unSpectatorPort);
 }
 
 
 void  ISteamGameServer_::SetSpectatorServerName(char * pszSpectatorServerName)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszSpectatorServerName);
-  this->internal->SetSpectatorServerName(pszSpectatorServerName);
-  
+  static ProfilePoint point("ISteamGameServer::SetSpectatorServerName");
+  return Forward<Method_SetSpectatorServerName>::call(&point, this->internal, pszSpectatorServerName);
 }
 
 
 void  ISteamGameServer_::ClearAllKeyValues()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  this->internal->ClearAllKeyValues();
-  
+  static ProfilePoint point("ISteamGameServer::ClearAllKeyValues");
+  return Forward<Method_ClearAllKeyValues>::call(&point, this->internal);
 }
 
 
 void  ISteamGameServer_::SetKeyValue(char * pKey, char * pValue)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\", (char *)\"%s\")\n", this, pKey, pValue);
-  this->internal->SetKeyValue(pKey, pValue);
-  
+  static ProfilePoint point("ISteamGameServer::SetKeyValue");
+  return Forward<Method_SetKeyValue>::call(&point, this->internal, pKey, pValue);
 }
 
 
 void  ISteamGameServer_::SetGameTags(char * pchGameTags)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pchGameTags);
-  this->internal->SetGameTags(pchGameTags);
-  
+  static ProfilePoint point("ISteamGameServer::SetGameTags");
+  return Forward<Method_SetGameTags>::call(&point, this->internal, pchGameTags);
 }
 
 
 void  ISteamGameServer_::SetGameData(char * pchGameData)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pchGameData);
-  this->internal->SetGameData(pchGameData);
-  
+  static ProfilePoint point("ISteamGameServer::SetGameData");
+  return Forward<Method_SetGameData>::call(&point, this->internal, pchGameData);
 }
 
 
 void  ISteamGameServer_::SetRegion(char * pszRegion)
 {
-  TRACE("((ISteamGameServer *)%p, (char *)\"%s\")\n", this, pszRegion);
-  this->internal->SetRegion(pszRegion);
-  
+  static ProfilePoint point("ISteamGameServer::SetRegion");
+  return Forward<Method_SetRegion>::call(&point, this->internal, pszRegion);
 }
 
 
 bool  ISteamGameServer_::SendUserConnectAndAuthenticate(uint32  unIPClient, void * pvAuthBlob, uint32  cubAuthBlobSize, CSteamID * pSteamIDUser)
 {
-  TRACE("((ISteamGameServer *)%p, (uint32 )%d, (void *)%p, (uint32 )%d, (CSteamID *)%p)\n", this, unIPClient, pvAuthBlob, cubAuthBlobSize, pSteamIDUser);
-  bool  result = this->internal->SendUserConnectAndAuthenticate(unIPClient, pvAuthBlob, cubAuthBlobSize, pSteamIDUser);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::SendUserConnectAndAuthenticate", "2:3");
+  return Forward<Method_SendUserConnectAndAuthenticate>::call(&point, this->internal, unIPClient, pvAuthBlob, cubAuthBlobSize, pSteamIDUser);
 }
 
 
 CSteamID * ISteamGameServer_::CreateUnauthenticatedUserConnection(CSteamID * hidden)
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  *hidden = this->internal->CreateUnauthenticatedUserConnection();
-  return hidden;
+  static ProfilePoint point("ISteamGameServer::CreateUnauthenticatedUserConnection");
+  return Forward<Method_CreateUnauthenticatedUserConnection>::hidden(&point, hidden, this->internal);
 }
 
 
 void  ISteamGameServer_::SendUserDisconnect(CSteamID  steamIDUser)
 {
-  TRACE("((ISteamGameServer *)%p, (CSteamID )%p)\n", this, steamIDUser);
-  this->internal->SendUserDisconnect(steamIDUser);
-  
+  static ProfilePoint point("ISteamGameServer::SendUserDisconnect");
+  return Forward<Method_SendUserDisconnect>::call(&point, this->internal, steamIDUser);
 }
 
 
 bool  ISteamGameServer_::BUpdateUserData(CSteamID  steamIDUser, char * pchPlayerName, uint32  uScore)
 {
-  TRACE("((ISteamGameServer *)%p, (CSteamID )%p, (char *)\"%s\", (uint32 )%d)\n", this, steamIDUser, pchPlayerName, uScore);
-  bool  result = this->internal->BUpdateUserData(steamIDUser, pchPlayerName, uScore);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::BUpdateUserData");
+  return Forward<Method_BUpdateUserData>::call(&point, this->internal, steamIDUser, pchPlayerName, uScore);
 }
 
 
 HAuthTicket  ISteamGameServer_::GetAuthSessionTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
 {
-  TRACE("((ISteamGameServer *)%p, (void *)%p, (int )%d, (uint32 *)%d)\n", this, pTicket, cbMaxTicket, pcbTicket);
-  HAuthTicket  result = this->internal->GetAuthSessionTicket(pTicket, cbMaxTicket, pcbTicket);
-  TRACE("() = (HAuthTicket )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::GetAuthSessionTicket", "1:2");
+  return Forward<Method_GetAuthSessionTicket>::call(&point, this->internal, pTicket, cbMaxTicket, pcbTicket);
 }
 
 
 EBeginAuthSessionResult  ISteamGameServer_::BeginAuthSession(void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
 {
-  TRACE("((ISteamGameServer *)%p, (void *)%p, (int )%d, (CSteamID )%p)\n", this, pAuthTicket, cbAuthTicket, steamID);
-  EBeginAuthSessionResult  result = this->internal->BeginAuthSession(pAuthTicket, cbAuthTicket, steamID);
-  TRACE("() = (EBeginAuthSessionResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::BeginAuthSession", "1:2");
+  return Forward<Method_BeginAuthSession>::call(&point, this->internal, pAuthTicket, cbAuthTicket, steamID);
 }
 
 
 void  ISteamGameServer_::EndAuthSession(CSteamID  steamID)
 {
-  TRACE("((ISteamGameServer *)%p, (CSteamID )%p)\n", this, steamID);
-  this->internal->EndAuthSession(steamID);
-  
+  static ProfilePoint point("ISteamGameServer::EndAuthSession");
+  return Forward<Method_EndAuthSession>::call(&point, this->internal, steamID);
 }
 
 
 void  ISteamGameServer_::CancelAuthTicket(HAuthTicket  hAuthTicket)
 {
-  TRACE("((ISteamGameServer *)%p, (HAuthTicket )%p)\n", this, hAuthTicket);
-  this->internal->CancelAuthTicket(hAuthTicket);
-  
+  static ProfilePoint point("ISteamGameServer::CancelAuthTicket");
+  return Forward<Method_CancelAuthTicket>::call(&point, this->internal, hAuthTicket);
 }
 
 
 EUserHasLicenseForAppResult  ISteamGameServer_::UserHasLicenseForApp(CSteamID  steamID, AppId_t  appID)
 {
-  TRACE("((ISteamGameServer *)%p, (CSteamID )%p, (AppId_t )%p)\n", this, steamID, appID);
-  EUserHasLicenseForAppResult  result = this->internal->UserHasLicenseForApp(steamID, appID);
-  TRACE("() = (EUserHasLicenseForAppResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::UserHasLicenseForApp");
+  return Forward<Method_UserHasLicenseForApp>::call(&point, this->internal, steamID, appID);
 }
 
 
 bool  ISteamGameServer_::RequestUserGroupStatus(CSteamID  steamIDUser, CSteamID  steamIDGroup)
 {
-  TRACE("((ISteamGameServer *)%p, (CSteamID )%p, (CSteamID )%p)\n", this, steamIDUser, steamIDGroup);
-  bool  result = this->internal->RequestUserGroupStatus(steamIDUser, steamIDGroup);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::RequestUserGroupStatus");
+  return Forward<Method_RequestUserGroupStatus>::call(&point, this->internal, steamIDUser, steamIDGroup);
 }
 
 
 void  ISteamGameServer_::GetGameplayStats()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  this->internal->GetGameplayStats();
-  
+  static ProfilePoint point("ISteamGameServer::GetGameplayStats");
+  return Forward<Method_GetGameplayStats>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamGameServer_::GetServerReputation()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  SteamAPICall_t  result = this->internal->GetServerReputation();
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::GetServerReputation");
+  return Forward<Method_GetServerReputation>::call(&point, this->internal);
 }
 
 
 uint32  ISteamGameServer_::GetPublicIP()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  uint32  result = this->internal->GetPublicIP();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::GetPublicIP");
+  return Forward<Method_GetPublicIP>::call(&point, this->internal);
 }
 
 
 bool  ISteamGameServer_::HandleIncomingPacket(void * pData, int  cbData, uint32  srcIP, uint16  srcPort)
 {
-  TRACE("((ISteamGameServer *)%p, (void *)%p, (int )%d, (uint32 )%d, (uint16 )%d)\n", this, pData, cbData, srcIP, srcPort);
-  bool  result = this->internal->HandleIncomingPacket(pData, cbData, srcIP, srcPort);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::HandleIncomingPacket", "1:2");
+  return Forward<Method_HandleIncomingPacket>::call(&point, this->internal, pData, cbData, srcIP, srcPort);
 }
 
 
 int  ISteamGameServer_::GetNextOutgoingPacket(void * pOut, int  cbMaxOut, uint32 * pNetAdr, uint16 * pPort)
 {
-  TRACE("((ISteamGameServer *)%p, (void *)%p, (int )%d, (uint32 *)%d, (uint16 *)%d)\n", this, pOut, cbMaxOut, pNetAdr, pPort);
-  int  result = this->internal->GetNextOutgoingPacket(pOut, cbMaxOut, pNetAdr, pPort);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::GetNextOutgoingPacket", "1:2");
+  return Forward<Method_GetNextOutgoingPacket>::call(&point, this->internal, pOut, cbMaxOut, pNetAdr, pPort);
 }
 
 
 void  ISteamGameServer_::EnableHeartbeats(bool  bActive)
 {
-  TRACE("((ISteamGameServer *)%p, (bool )%d)\n", this, bActive);
-  this->internal->EnableHeartbeats(bActive);
-  
+  static ProfilePoint point("ISteamGameServer::EnableHeartbeats");
+  return Forward<Method_EnableHeartbeats>::call(&point, this->internal, bActive);
 }
 
 
 void  ISteamGameServer_::SetHeartbeatInterval(int  iHeartbeatInterval)
 {
-  TRACE("((ISteamGameServer *)%p, (int )%d)\n", this, iHeartbeatInterval);
-  this->internal->SetHeartbeatInterval(iHeartbeatInterval);
-  
+  static ProfilePoint point("ISteamGameServer::SetHeartbeatInterval");
+  return Forward<Method_SetHeartbeatInterval>::call(&point, this->internal, iHeartbeatInterval);
 }
 
 
 void  ISteamGameServer_::ForceHeartbeat()
 {
-  TRACE("((ISteamGameServer *)%p)\n", this);
-  this->internal->ForceHeartbeat();
-  
+  static ProfilePoint point("ISteamGameServer::ForceHeartbeat");
+  return Forward<Method_ForceHeartbeat>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamGameServer_::AssociateWithClan(CSteamID  steamIDClan)
 {
-  TRACE("((ISteamGameServer *)%p, (CSteamID )%p)\n", this, steamIDClan);
-  SteamAPICall_t  result = this->internal->AssociateWithClan(steamIDClan);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::AssociateWithClan");
+  return Forward<Method_AssociateWithClan>::call(&point, this->internal, steamIDClan);
 }
 
 
 SteamAPICall_t  ISteamGameServer_::ComputeNewPlayerCompatibility(CSteamID  steamIDNewPlayer)
 {
-  TRACE("((ISteamGameServer *)%p, (CSteamID )%p)\n", this, steamIDNewPlayer);
-  SteamAPICall_t  result = this->internal->ComputeNewPlayerCompatibility(steamIDNewPlayer);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServer::ComputeNewPlayerCompatibility");
+  return Forward<Method_ComputeNewPlayerCompatibility>::call(&point, this->internal, steamIDNewPlayer);
 }
 ISteamGameServer_::ISteamGameServer_(ISteamGameServer * towrap)
 {
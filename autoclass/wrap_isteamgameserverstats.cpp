@@ -1,102 +1,81 @@
 #include <steam_api_.h>
+FORWARD_METHOD(RequestUserStats);
+FORWARD_METHOD(GetUserStat);
+FORWARD_METHOD(GetUserAchievement);
+FORWARD_METHOD(SetUserStat);
+FORWARD_METHOD(UpdateUserAvgRateStat);
+FORWARD_METHOD(SetUserAchievement);
+FORWARD_METHOD(ClearUserAchievement);
+FORWARD_METHOD(StoreUserStats);
+
 
 SteamAPICall_t  ISteamGameServerStats_::RequestUserStats(CSteamID  steamIDUser)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p)\n", this, steamIDUser);
-  SteamAPICall_t  result = this->internal->RequestUserStats(steamIDUser);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::RequestUserStats");
+  return Forward<Method_RequestUserStats>::call(&point, this->internal, steamIDUser);
 }
 
 
 bool  ISteamGameServerStats_::GetUserStat(CSteamID  steamIDUser, char * pchName, int32 * pData)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\", (int32 *)%d)\n", this, steamIDUser, pchName, pData);
-  bool  result = this->internal->GetUserStat(steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::GetUserStat");
+  return Forward<Method_GetUserStat>::call(&point, this->internal, steamIDUser, pchName, pData);
 }
 
 
 bool  ISteamGameServerStats_::GetUserStat(CSteamID  steamIDUser, char * pchName, float * pData)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\", (float *)%f)\n", this, steamIDUser, pchName, pData);
-  bool  result = this->internal->GetUserStat(steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::GetUserStat");
+  return Forward<Method_GetUserStat>::call(&point, this->internal, steamIDUser, pchName, pData);
 }
 
 
 bool  ISteamGameServerStats_::GetUserAchievement(CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\", (bool *)%d)\n", this, steamIDUser, pchName, pbAchieved);
-  bool  result = this->internal->GetUserAchievement(steamIDUser, pchName, pbAchieved);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::GetUserAchievement");
+  return Forward<Method_GetUserAchievement>::call(&point, this->internal, steamIDUser, pchName, pbAchieved);
 }
 
 
 bool  ISteamGameServerStats_::SetUserStat(CSteamID  steamIDUser, char * pchName, int32  nData)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\", (int32 )%d)\n", this, steamIDUser, pchName, nData);
-  bool  result = this->internal->SetUserStat(steamIDUser, pchName, nData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::SetUserStat");
+  return Forward<Method_SetUserStat>::call(&point, this->internal, steamIDUser, pchName, nData);
 }
 
 
 bool  ISteamGameServerStats_::SetUserStat(CSteamID  steamIDUser, char * pchName, float  fData)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\", (float )%f)\n", this, steamIDUser, pchName, fData);
-  bool  result = this->internal->SetUserStat(steamIDUser, pchName, fData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::SetUserStat");
+  return Forward<Method_SetUserStat>::call(&point, this->internal, steamIDUser, pchName, fData);
 }
 
 
 bool  ISteamGameServerStats_::UpdateUserAvgRateStat(CSteamID  steamIDUser, char * pchName, float  flCountThisSession, double  dSessionLength)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\", (float )%f, (double )%f)\n", this, steamIDUser, pchName, flCountThisSession, dSessionLength);
-  bool  result = this->internal->UpdateUserAvgRateStat(steamIDUser, pchName, flCountThisSession, dSessionLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::UpdateUserAvgRateStat");
+  return Forward<Method_UpdateUserAvgRateStat>::call(&point, this->internal, steamIDUser, pchName, flCountThisSession, dSessionLength);
 }
 
 
 bool  ISteamGameServerStats_::SetUserAchievement(CSteamID  steamIDUser, char * pchName)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDUser, pchName);
-  bool  result = this->internal->SetUserAchievement(steamIDUser, pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::SetUserAchievement");
+  return Forward<Method_SetUserAchievement>::call(&point, this->internal, steamIDUser, pchName);
 }
 
 
 bool  ISteamGameServerStats_::ClearUserAchievement(CSteamID  steamIDUser, char * pchName)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDUser, pchName);
-  bool  result = this->internal->ClearUserAchievement(steamIDUser, pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::ClearUserAchievement");
+  return Forward<Method_ClearUserAchievement>::call(&point, this->internal, steamIDUser, pchName);
 }
 
 
 SteamAPICall_t  ISteamGameServerStats_::StoreUserStats(CSteamID  steamIDUser)
 {
-  TRACE("((ISteamGameServerStats *)%p, (CSteamID )%p)\n", this, steamIDUser);
-  SteamAPICall_t  result = this->internal->StoreUserStats(steamIDUser);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamGameServerStats::StoreUserStats");
+  return Forward<Method_StoreUserStats>::call(&point, this->internal, steamIDUser);
 }
 ISteamGameServerStats_::ISteamGameServerStats_(ISteamGameServerStats * towrap)
 {
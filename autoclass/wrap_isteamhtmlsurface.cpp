@@ -1,288 +1,283 @@
 #include <steam_api_.h>
+FORWARD_METHOD(Init);
+FORWARD_METHOD(Shutdown);
+FORWARD_METHOD(CreateBrowser);
+FORWARD_METHOD(RemoveBrowser);
+FORWARD_METHOD(LoadURL);
+FORWARD_METHOD(SetSize);
+FORWARD_METHOD(StopLoad);
+FORWARD_METHOD(Reload);
+FORWARD_METHOD(GoBack);
+FORWARD_METHOD(GoForward);
+FORWARD_METHOD(AddHeader);
+FORWARD_METHOD(ExecuteJavascript);
+FORWARD_METHOD(MouseUp);
+FORWARD_METHOD(MouseDown);
+FORWARD_METHOD(MouseDoubleClick);
+FORWARD_METHOD(MouseMove);
+FORWARD_METHOD(MouseWheel);
+FORWARD_METHOD(KeyDown);
+FORWARD_METHOD(KeyUp);
+FORWARD_METHOD(KeyChar);
+FORWARD_METHOD(SetHorizontalScroll);
+FORWARD_METHOD(SetVerticalScroll);
+FORWARD_METHOD(SetKeyFocus);
+FORWARD_METHOD(ViewSource);
+FORWARD_METHOD(CopyToClipboard);
+FORWARD_METHOD(PasteFromClipboard);
+FORWARD_METHOD(Find);
+FORWARD_METHOD(StopFind);
+FORWARD_METHOD(GetLinkAtPosition);
+FORWARD_METHOD(SetCookie);
+FORWARD_METHOD(SetPageScaleFactor);
+FORWARD_METHOD(SetBackgroundMode);
+FORWARD_METHOD(AllowStartRequest);
+FORWARD_METHOD(JSDialogResponse);
+FORWARD_METHOD(FileLoadDialogResponse);
+
 
 bool  ISteamHTMLSurface_::Init()
 {
-  TRACE("((ISteamHTMLSurface *)%p)\n", this);
-  bool  result = this->internal->Init();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTMLSurface::Init");
+  return Forward<Method_Init>::call(&point, this->internal);
 }
 
 
 bool  ISteamHTMLSurface_::Shutdown()
 {
-  TRACE("((ISteamHTMLSurface *)%p)\n", this);
-  bool  result = this->internal->Shutdown();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTMLSurface::Shutdown");
+  return Forward<Method_Shutdown>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamHTMLSurface_::CreateBrowser(char * pchUserAgent, char * pchUserCSS)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (char *)\"%s\", (char *)\"%s\")\n", this, pchUserAgent, pchUserCSS);
-  SteamAPICall_t  result = this->internal->CreateBrowser(pchUserAgent, pchUserCSS);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTMLSurface::CreateBrowser");
+  return Forward<Method_CreateBrowser>::call(&point, this->internal, pchUserAgent, pchUserCSS);
 }
 
 
 void  ISteamHTMLSurface_::RemoveBrowser(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->RemoveBrowser(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::RemoveBrowser");
+  return Forward<Method_RemoveBrowser>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::LoadURL(HHTMLBrowser  unBrowserHandle, char * pchURL, char * pchPostData)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (char *)\"%s\", (char *)\"%s\")\n", this, unBrowserHandle, pchURL, pchPostData);
-  this->internal->LoadURL(unBrowserHandle, pchURL, pchPostData);
-  
+  static ProfilePoint point("ISteamHTMLSurface::LoadURL");
+  return Forward<Method_LoadURL>::call(&point, this->internal, unBrowserHandle, pchURL, pchPostData);
 }
 
 
 void  ISteamHTMLSurface_::SetSize(HHTMLBrowser  unBrowserHandle, uint32  unWidth, uint32  unHeight)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (uint32 )%d, (uint32 )%d)\n", this, unBrowserHandle, unWidth, unHeight);
-  this->internal->SetSize(unBrowserHandle, unWidth, unHeight);
-  
+  static ProfilePoint point("ISteamHTMLSurface::SetSize");
+  return Forward<Method_SetSize>::call(&point, this->internal, unBrowserHandle, unWidth, unHeight);
 }
 
 
 void  ISteamHTMLSurface_::StopLoad(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->StopLoad(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::StopLoad");
+  return Forward<Method_StopLoad>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::Reload(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->Reload(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::Reload");
+  return Forward<Method_Reload>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::GoBack(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->GoBack(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::GoBack");
+  return Forward<Method_GoBack>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::GoForward(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->GoForward(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::GoForward");
+  return Forward<Method_GoForward>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::AddHeader(HHTMLBrowser  unBrowserHandle, char * pchKey, char * pchValue)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (char *)\"%s\", (char *)\"%s\")\n", this, unBrowserHandle, pchKey, pchValue);
-  this->internal->AddHeader(unBrowserHandle, pchKey, pchValue);
-  
+  static ProfilePoint point("ISteamHTMLSurface::AddHeader");
+  return Forward<Method_AddHeader>::call(&point, this->internal, unBrowserHandle, pchKey, pchValue);
 }
 
 
 void  ISteamHTMLSurface_::ExecuteJavascript(HHTMLBrowser  unBrowserHandle, char * pchScript)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (char *)\"%s\")\n", this, unBrowserHandle, pchScript);
-  this->internal->ExecuteJavascript(unBrowserHandle, pchScript);
-  
+  static ProfilePoint point("ISteamHTMLSurface::ExecuteJavascript");
+  return Forward<Method_ExecuteJavascript>::call(&point, this->internal, unBrowserHandle, pchScript);
 }
 
 
 void  ISteamHTMLSurface_::MouseUp(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (ISteamHTMLSurface::EHTMLMouseButton )%p)\n", this, unBrowserHandle, eMouseButton);
-  this->internal->MouseUp(unBrowserHandle, eMouseButton);
-  
+  static ProfilePoint point("ISteamHTMLSurface::MouseUp");
+  return Forward<Method_MouseUp>::call(&point, this->internal, unBrowserHandle, eMouseButton);
 }
 
 
 void  ISteamHTMLSurface_::MouseDown(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (ISteamHTMLSurface::EHTMLMouseButton )%p)\n", this, unBrowserHandle, eMouseButton);
-  this->internal->MouseDown(unBrowserHandle, eMouseButton);
-  
+  static ProfilePoint point("ISteamHTMLSurface::MouseDown");
+  return Forward<Method_MouseDown>::call(&point, this->internal, unBrowserHandle, eMouseButton);
 }
 
 
 void  ISteamHTMLSurface_::MouseDoubleClick(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (ISteamHTMLSurface::EHTMLMouseButton )%p)\n", this, unBrowserHandle, eMouseButton);
-  this->internal->MouseDoubleClick(unBrowserHandle, eMouseButton);
-  
+  static ProfilePoint point("ISteamHTMLSurface::MouseDoubleClick");
+  return Forward<Method_MouseDoubleClick>::call(&point, this->internal, unBrowserHandle, eMouseButton);
 }
 
 
 void  ISteamHTMLSurface_::MouseMove(HHTMLBrowser  unBrowserHandle, int  x, int  y)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (int )%d, (int )%d)\n", this, unBrowserHandle, x, y);
-  this->internal->MouseMove(unBrowserHandle, x, y);
-  
+  static ProfilePoint point("ISteamHTMLSurface::MouseMove");
+  return Forward<Method_MouseMove>::call(&point, this->internal, unBrowserHandle, x, y);
 }
 
 
 void  ISteamHTMLSurface_::MouseWheel(HHTMLBrowser  unBrowserHandle, int32  nDelta)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (int32 )%d)\n", this, unBrowserHandle, nDelta);
-  this->internal->MouseWheel(unBrowserHandle, nDelta);
-  
+  static ProfilePoint point("ISteamHTMLSurface::MouseWheel");
+  return Forward<Method_MouseWheel>::call(&point, this->internal, unBrowserHandle, nDelta);
 }
 
 
 void  ISteamHTMLSurface_::KeyDown(HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (uint32 )%d, (ISteamHTMLSurface::EHTMLKeyModifiers )%p)\n", this, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  this->internal->KeyDown(unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  
+  static ProfilePoint point("ISteamHTMLSurface::KeyDown");
+  return Forward<Method_KeyDown>::call(&point, this->internal, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
 }
 
 
 void  ISteamHTMLSurface_::KeyUp(HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (uint32 )%d, (ISteamHTMLSurface::EHTMLKeyModifiers )%p)\n", this, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  this->internal->KeyUp(unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  
+  static ProfilePoint point("ISteamHTMLSurface::KeyUp");
+  return Forward<Method_KeyUp>::call(&point, this->internal, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
 }
 
 
 void  ISteamHTMLSurface_::KeyChar(HHTMLBrowser  unBrowserHandle, uint32  cUnicodeChar, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (uint32 )%d, (ISteamHTMLSurface::EHTMLKeyModifiers )%p)\n", this, unBrowserHandle, cUnicodeChar, eHTMLKeyModifiers);
-  this->internal->KeyChar(unBrowserHandle, cUnicodeChar, eHTMLKeyModifiers);
-  
+  static ProfilePoint point("ISteamHTMLSurface::KeyChar");
+  return Forward<Method_KeyChar>::call(&point, this->internal, unBrowserHandle, cUnicodeChar, eHTMLKeyModifiers);
 }
 
 
 void  ISteamHTMLSurface_::SetHorizontalScroll(HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (uint32 )%d)\n", this, unBrowserHandle, nAbsolutePixelScroll);
-  this->internal->SetHorizontalScroll(unBrowserHandle, nAbsolutePixelScroll);
-  
+  static ProfilePoint point("ISteamHTMLSurface::SetHorizontalScroll");
+  return Forward<Method_SetHorizontalScroll>::call(&point, this->internal, unBrowserHandle, nAbsolutePixelScroll);
 }
 
 
 void  ISteamHTMLSurface_::SetVerticalScroll(HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (uint32 )%d)\n", this, unBrowserHandle, nAbsolutePixelScroll);
-  this->internal->SetVerticalScroll(unBrowserHandle, nAbsolutePixelScroll);
-  
+  static ProfilePoint point("ISteamHTMLSurface::SetVerticalScroll");
+  return Forward<Method_SetVerticalScroll>::call(&point, this->internal, unBrowserHandle, nAbsolutePixelScroll);
 }
 
 
 void  ISteamHTMLSurface_::SetKeyFocus(HHTMLBrowser  unBrowserHandle, bool  bHasKeyFocus)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (bool )%d)\n", this, unBrowserHandle, bHasKeyFocus);
-  this->internal->SetKeyFocus(unBrowserHandle, bHasKeyFocus);
-  
+  static ProfilePoint point("ISteamHTMLSurface::SetKeyFocus");
+  return Forward<Method_SetKeyFocus>::call(&point, this->internal, unBrowserHandle, bHasKeyFocus);
 }
 
 
 void  ISteamHTMLSurface_::ViewSource(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->ViewSource(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::ViewSource");
+  return Forward<Method_ViewSource>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::CopyToClipboard(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->CopyToClipboard(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::CopyToClipboard");
+  return Forward<Method_CopyToClipboard>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::PasteFromClipboard(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->PasteFromClipboard(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::PasteFromClipboard");
+  return Forward<Method_PasteFromClipboard>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::Find(HHTMLBrowser  unBrowserHandle, char * pchSearchStr, bool  bCurrentlyInFind, bool  bReverse)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (char *)\"%s\", (bool )%d, (bool )%d)\n", this, unBrowserHandle, pchSearchStr, bCurrentlyInFind, bReverse);
-  this->internal->Find(unBrowserHandle, pchSearchStr, bCurrentlyInFind, bReverse);
-  
+  static ProfilePoint point("ISteamHTMLSurface::Find");
+  return Forward<Method_Find>::call(&point, this->internal, unBrowserHandle, pchSearchStr, bCurrentlyInFind, bReverse);
 }
 
 
 void  ISteamHTMLSurface_::StopFind(HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p)\n", this, unBrowserHandle);
-  this->internal->StopFind(unBrowserHandle);
-  
+  static ProfilePoint point("ISteamHTMLSurface::StopFind");
+  return Forward<Method_StopFind>::call(&point, this->internal, unBrowserHandle);
 }
 
 
 void  ISteamHTMLSurface_::GetLinkAtPosition(HHTMLBrowser  unBrowserHandle, int  x, int  y)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (int )%d, (int )%d)\n", this, unBrowserHandle, x, y);
-  this->internal->GetLinkAtPosition(unBrowserHandle, x, y);
-  
+  static ProfilePoint point("ISteamHTMLSurface::GetLinkAtPosition");
+  return Forward<Method_GetLinkAtPosition>::call(&point, this->internal, unBrowserHandle, x, y);
 }
 
 
 void  ISteamHTMLSurface_::SetCookie(char * pchHostname, char * pchKey, char * pchValue, char * pchPath)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (char *)\"%s\", (char *)\"%s\", (char *)\"%s\", (char *)\"%s\")\n", this, pchHostname, pchKey, pchValue, pchPath);
-  this->internal->SetCookie(pchHostname, pchKey, pchValue, pchPath);
-  
+  static ProfilePoint point("ISteamHTMLSurface::SetCookie");
+  return Forward<Method_SetCookie>::call(&point, this->internal, pchHostname, pchKey, pchValue, pchPath);
 }
 
 
 void  ISteamHTMLSurface_::SetPageScaleFactor(HHTMLBrowser  unBrowserHandle, float  flZoom, int  nPointX, int  nPointY)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (float )%f, (int )%d, (int )%d)\n", this, unBrowserHandle, flZoom, nPointX, nPointY);
-  this->internal->SetPageScaleFactor(unBrowserHandle, flZoom, nPointX, nPointY);
-  
+  static ProfilePoint point("ISteamHTMLSurface::SetPageScaleFactor");
+  return Forward<Method_SetPageScaleFactor>::call(&point, this->internal, unBrowserHandle, flZoom, nPointX, nPointY);
 }
 
 
 void  ISteamHTMLSurface_::SetBackgroundMode(HHTMLBrowser  unBrowserHandle, bool  bBackgroundMode)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (bool )%d)\n", this, unBrowserHandle, bBackgroundMode);
-  this->internal->SetBackgroundMode(unBrowserHandle, bBackgroundMode);
-  
+  static ProfilePoint point("ISteamHTMLSurface::SetBackgroundMode");
+  return Forward<Method_SetBackgroundMode>::call(&point, this->internal, unBrowserHandle, bBackgroundMode);
 }
 
 
 void  ISteamHTMLSurface_::AllowStartRequest(HHTMLBrowser  unBrowserHandle, bool  bAllowed)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (bool )%d)\n", this, unBrowserHandle, bAllowed);
-  this->internal->AllowStartRequest(unBrowserHandle, bAllowed);
-  
+  static ProfilePoint point("ISteamHTMLSurface::AllowStartRequest");
+  return Forward<Method_AllowStartRequest>::call(&point, this->internal, unBrowserHandle, bAllowed);
 }
 
 
 void  ISteamHTMLSurface_::JSDialogResponse(HHTMLBrowser  unBrowserHandle, bool  bResult)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (bool )%d)\n", this, unBrowserHandle, bResult);
-  this->internal->JSDialogResponse(unBrowserHandle, bResult);
-  
+  static ProfilePoint point("ISteamHTMLSurface::JSDialogResponse");
+  return Forward<Method_JSDialogResponse>::call(&point, this->internal, unBrowserHandle, bResult);
 }
 
 
 void  ISteamHTMLSurface_::FileLoadDialogResponse(HHTMLBrowser  unBrowserHandle, char ** pchSelectedFiles)
 {
-  TRACE("((ISteamHTMLSurface *)%p, (HHTMLBrowser )%p, (char **)\"%s\")\n", this, unBrowserHandle, pchSelectedFiles);
-  this->internal->FileLoadDialogResponse(unBrowserHandle, pchSelectedFiles);
-  
+  static ProfilePoint point("ISteamHTMLSurface::FileLoadDialogResponse");
+  return Forward<Method_FileLoadDialogResponse>::call(&point, this->internal, unBrowserHandle, pchSelectedFiles);
 }
 ISteamHTMLSurface_::ISteamHTMLSurface_(ISteamHTMLSurface * towrap)
 {
@@ -1,252 +1,203 @@
 #include <steam_api_.h>
+FORWARD_METHOD(CreateHTTPRequest);
+FORWARD_METHOD(SetHTTPRequestContextValue);
+FORWARD_METHOD(SetHTTPRequestNetworkActivityTimeout);
+FORWARD_METHOD(SetHTTPRequestHeaderValue);
+FORWARD_METHOD(SetHTTPRequestGetOrPostParameter);
+FORWARD_METHOD(SendHTTPRequest);
+FORWARD_METHOD(SendHTTPRequestAndStreamResponse);
+FORWARD_METHOD(DeferHTTPRequest);
+FORWARD_METHOD(PrioritizeHTTPRequest);
+FORWARD_METHOD(GetHTTPResponseHeaderSize);
+FORWARD_METHOD(GetHTTPResponseHeaderValue);
+FORWARD_METHOD(GetHTTPResponseBodySize);
+FORWARD_METHOD(GetHTTPResponseBodyData);
+FORWARD_METHOD(GetHTTPStreamingResponseBodyData);
+FORWARD_METHOD(ReleaseHTTPRequest);
+FORWARD_METHOD(GetHTTPDownloadProgressPct);
+FORWARD_METHOD(SetHTTPRequestRawPostBody);
+FORWARD_METHOD(CreateCookieContainer);
+FORWARD_METHOD(ReleaseCookieContainer);
+FORWARD_METHOD(SetCookie);
+FORWARD_METHOD(SetHTTPRequestCookieContainer);
+FORWARD_METHOD(SetHTTPRequestUserAgentInfo);
+FORWARD_METHOD(SetHTTPRequestRequiresVerifiedCertificate);
+FORWARD_METHOD(SetHTTPRequestAbsoluteTimeoutMS);
+FORWARD_METHOD(GetHTTPRequestWasTimedOut);
+
 
 HTTPRequestHandle  ISteamHTTP_::CreateHTTPRequest(EHTTPMethod  eHTTPRequestMethod, char * pchAbsoluteURL)
 {
-  TRACE("((ISteamHTTP *)%p, (EHTTPMethod )%p, (char *)\"%s\")\n", this, eHTTPRequestMethod, pchAbsoluteURL);
-  HTTPRequestHandle  result = this->internal->CreateHTTPRequest(eHTTPRequestMethod, pchAbsoluteURL);
-  TRACE("() = (HTTPRequestHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::CreateHTTPRequest");
+  return Forward<Method_CreateHTTPRequest>::call(&point, this->internal, eHTTPRequestMethod, pchAbsoluteURL);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestContextValue(HTTPRequestHandle  hRequest, uint64  ulContextValue)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (uint64 )%d)\n", this, hRequest, ulContextValue);
-  bool  result = this->internal->SetHTTPRequestContextValue(hRequest, ulContextValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestContextValue");
+  return Forward<Method_SetHTTPRequestContextValue>::call(&point, this->internal, hRequest, ulContextValue);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestNetworkActivityTimeout(HTTPRequestHandle  hRequest, uint32  unTimeoutSeconds)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (uint32 )%d)\n", this, hRequest, unTimeoutSeconds);
-  bool  result = this->internal->SetHTTPRequestNetworkActivityTimeout(hRequest, unTimeoutSeconds);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestNetworkActivityTimeout");
+  return Forward<Method_SetHTTPRequestNetworkActivityTimeout>::call(&point, this->internal, hRequest, unTimeoutSeconds);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestHeaderValue(HTTPRequestHandle  hRequest, char * pchHeaderName, char * pchHeaderValue)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (char *)\"%s\", (char *)\"%s\")\n", this, hRequest, pchHeaderName, pchHeaderValue);
-  bool  result = this->internal->SetHTTPRequestHeaderValue(hRequest, pchHeaderName, pchHeaderValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestHeaderValue");
+  return Forward<Method_SetHTTPRequestHeaderValue>::call(&point, this->internal, hRequest, pchHeaderName, pchHeaderValue);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestGetOrPostParameter(HTTPRequestHandle  hRequest, char * pchParamName, char * pchParamValue)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (char *)\"%s\", (char *)\"%s\")\n", this, hRequest, pchParamName, pchParamValue);
-  bool  result = this->internal->SetHTTPRequestGetOrPostParameter(hRequest, pchParamName, pchParamValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestGetOrPostParameter");
+  return Forward<Method_SetHTTPRequestGetOrPostParameter>::call(&point, this->internal, hRequest, pchParamName, pchParamValue);
 }
 
 
 bool  ISteamHTTP_::SendHTTPRequest(HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (SteamAPICall_t *)%p)\n", this, hRequest, pCallHandle);
-  bool  result = this->internal->SendHTTPRequest(hRequest, pCallHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SendHTTPRequest");
+  return Forward<Method_SendHTTPRequest>::call(&point, this->internal, hRequest, pCallHandle);
 }
 
 
 bool  ISteamHTTP_::SendHTTPRequestAndStreamResponse(HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (SteamAPICall_t *)%p)\n", this, hRequest, pCallHandle);
-  bool  result = this->internal->SendHTTPRequestAndStreamResponse(hRequest, pCallHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SendHTTPRequestAndStreamResponse");
+  return Forward<Method_SendHTTPRequestAndStreamResponse>::call(&point, this->internal, hRequest, pCallHandle);
 }
 
 
 bool  ISteamHTTP_::DeferHTTPRequest(HTTPRequestHandle  hRequest)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p)\n", this, hRequest);
-  bool  result = this->internal->DeferHTTPRequest(hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::DeferHTTPRequest");
+  return Forward<Method_DeferHTTPRequest>::call(&point, this->internal, hRequest);
 }
 
 
 bool  ISteamHTTP_::PrioritizeHTTPRequest(HTTPRequestHandle  hRequest)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p)\n", this, hRequest);
-  bool  result = this->internal->PrioritizeHTTPRequest(hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::PrioritizeHTTPRequest");
+  return Forward<Method_PrioritizeHTTPRequest>::call(&point, this->internal, hRequest);
 }
 
 
 bool  ISteamHTTP_::GetHTTPResponseHeaderSize(HTTPRequestHandle  hRequest, char * pchHeaderName, uint32 * unResponseHeaderSize)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (char *)\"%s\", (uint32 *)%d)\n", this, hRequest, pchHeaderName, unResponseHeaderSize);
-  bool  result = this->internal->GetHTTPResponseHeaderSize(hRequest, pchHeaderName, unResponseHeaderSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::GetHTTPResponseHeaderSize");
+  return Forward<Method_GetHTTPResponseHeaderSize>::call(&point, this->internal, hRequest, pchHeaderName, unResponseHeaderSize);
 }
 
 
 bool  ISteamHTTP_::GetHTTPResponseHeaderValue(HTTPRequestHandle  hRequest, char * pchHeaderName, uint8 * pHeaderValueBuffer, uint32  unBufferSize)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (char *)\"%s\", (uint8 *)%p, (uint32 )%d)\n", this, hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize);
-  bool  result = this->internal->GetHTTPResponseHeaderValue(hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::GetHTTPResponseHeaderValue", "3:4");
+  return Forward<Method_GetHTTPResponseHeaderValue>::call(&point, this->internal, hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize);
 }
 
 
 bool  ISteamHTTP_::GetHTTPResponseBodySize(HTTPRequestHandle  hRequest, uint32 * unBodySize)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (uint32 *)%d)\n", this, hRequest, unBodySize);
-  bool  result = this->internal->GetHTTPResponseBodySize(hRequest, unBodySize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::GetHTTPResponseBodySize");
+  return Forward<Method_GetHTTPResponseBodySize>::call(&point, this->internal, hRequest, unBodySize);
 }
 
 
 bool  ISteamHTTP_::GetHTTPResponseBodyData(HTTPRequestHandle  hRequest, uint8 * pBodyDataBuffer, uint32  unBufferSize)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (uint8 *)%p, (uint32 )%d)\n", this, hRequest, pBodyDataBuffer, unBufferSize);
-  bool  result = this->internal->GetHTTPResponseBodyData(hRequest, pBodyDataBuffer, unBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::GetHTTPResponseBodyData", "2:3");
+  return Forward<Method_GetHTTPResponseBodyData>::call(&point, this->internal, hRequest, pBodyDataBuffer, unBufferSize);
 }
 
 
 bool  ISteamHTTP_::GetHTTPStreamingResponseBodyData(HTTPRequestHandle  hRequest, uint32  cOffset, uint8 * pBodyDataBuffer, uint32  unBufferSize)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (uint32 )%d, (uint8 *)%p, (uint32 )%d)\n", this, hRequest, cOffset, pBodyDataBuffer, unBufferSize);
-  bool  result = this->internal->GetHTTPStreamingResponseBodyData(hRequest, cOffset, pBodyDataBuffer, unBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::GetHTTPStreamingResponseBodyData", "3:4");
+  return Forward<Method_GetHTTPStreamingResponseBodyData>::call(&point, this->internal, hRequest, cOffset, pBodyDataBuffer, unBufferSize);
 }
 
 
 bool  ISteamHTTP_::ReleaseHTTPRequest(HTTPRequestHandle  hRequest)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p)\n", this, hRequest);
-  bool  result = this->internal->ReleaseHTTPRequest(hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::ReleaseHTTPRequest");
+  return Forward<Method_ReleaseHTTPRequest>::call(&point, this->internal, hRequest);
 }
 
 
 bool  ISteamHTTP_::GetHTTPDownloadProgressPct(HTTPRequestHandle  hRequest, float * pflPercentOut)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (float *)%f)\n", this, hRequest, pflPercentOut);
-  bool  result = this->internal->GetHTTPDownloadProgressPct(hRequest, pflPercentOut);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::GetHTTPDownloadProgressPct");
+  return Forward<Method_GetHTTPDownloadProgressPct>::call(&point, this->internal, hRequest, pflPercentOut);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestRawPostBody(HTTPRequestHandle  hRequest, char * pchContentType, uint8 * pubBody, uint32  unBodyLen)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (char *)\"%s\", (uint8 *)%p, (uint32 )%d)\n", this, hRequest, pchContentType, pubBody, unBodyLen);
-  bool  result = this->internal->SetHTTPRequestRawPostBody(hRequest, pchContentType, pubBody, unBodyLen);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestRawPostBody");
+  return Forward<Method_SetHTTPRequestRawPostBody>::call(&point, this->internal, hRequest, pchContentType, pubBody, unBodyLen);
 }
 
 
 HTTPCookieContainerHandle  ISteamHTTP_::CreateCookieContainer(bool  bAllowResponsesToModify)
 {
-  TRACE("((ISteamHTTP *)%p, (bool )%d)\n", this, bAllowResponsesToModify);
-  HTTPCookieContainerHandle  result = this->internal->CreateCookieContainer(bAllowResponsesToModify);
-  TRACE("() = (HTTPCookieContainerHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::CreateCookieContainer");
+  return Forward<Method_CreateCookieContainer>::call(&point, this->internal, bAllowResponsesToModify);
 }
 
 
 bool  ISteamHTTP_::ReleaseCookieContainer(HTTPCookieContainerHandle  hCookieContainer)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPCookieContainerHandle )%p)\n", this, hCookieContainer);
-  bool  result = this->internal->ReleaseCookieContainer(hCookieContainer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::ReleaseCookieContainer");
+  return Forward<Method_ReleaseCookieContainer>::call(&point, this->internal, hCookieContainer);
 }
 
 
 bool  ISteamHTTP_::SetCookie(HTTPCookieContainerHandle  hCookieContainer, char * pchHost, char * pchUrl, char * pchCookie)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPCookieContainerHandle )%p, (char *)\"%s\", (char *)\"%s\", (char *)\"%s\")\n", this, hCookieContainer, pchHost, pchUrl, pchCookie);
-  bool  result = this->internal->SetCookie(hCookieContainer, pchHost, pchUrl, pchCookie);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetCookie");
+  return Forward<Method_SetCookie>::call(&point, this->internal, hCookieContainer, pchHost, pchUrl, pchCookie);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestCookieContainer(HTTPRequestHandle  hRequest, HTTPCookieContainerHandle  hCookieContainer)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (HTTPCookieContainerHandle )%p)\n", this, hRequest, hCookieContainer);
-  bool  result = this->internal->SetHTTPRequestCookieContainer(hRequest, hCookieContainer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestCookieContainer");
+  return Forward<Method_SetHTTPRequestCookieContainer>::call(&point, this->internal, hRequest, hCookieContainer);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestUserAgentInfo(HTTPRequestHandle  hRequest, char * pchUserAgentInfo)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (char *)\"%s\")\n", this, hRequest, pchUserAgentInfo);
-  bool  result = this->internal->SetHTTPRequestUserAgentInfo(hRequest, pchUserAgentInfo);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestUserAgentInfo");
+  return Forward<Method_SetHTTPRequestUserAgentInfo>::call(&point, this->internal, hRequest, pchUserAgentInfo);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestRequiresVerifiedCertificate(HTTPRequestHandle  hRequest, bool  bRequireVerifiedCertificate)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (bool )%d)\n", this, hRequest, bRequireVerifiedCertificate);
-  bool  result = this->internal->SetHTTPRequestRequiresVerifiedCertificate(hRequest, bRequireVerifiedCertificate);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestRequiresVerifiedCertificate");
+  return Forward<Method_SetHTTPRequestRequiresVerifiedCertificate>::call(&point, this->internal, hRequest, bRequireVerifiedCertificate);
 }
 
 
 bool  ISteamHTTP_::SetHTTPRequestAbsoluteTimeoutMS(HTTPRequestHandle  hRequest, uint32  unMilliseconds)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (uint32 )%d)\n", this, hRequest, unMilliseconds);
-  bool  result = this->internal->SetHTTPRequestAbsoluteTimeoutMS(hRequest, unMilliseconds);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::SetHTTPRequestAbsoluteTimeoutMS");
+  return Forward<Method_SetHTTPRequestAbsoluteTimeoutMS>::call(&point, this->internal, hRequest, unMilliseconds);
 }
 
 
 bool  ISteamHTTP_::GetHTTPRequestWasTimedOut(HTTPRequestHandle  hRequest, bool * pbWasTimedOut)
 {
-  TRACE("((ISteamHTTP *)%p, (HTTPRequestHandle )%p, (bool *)%d)\n", this, hRequest, pbWasTimedOut);
-  bool  result = this->internal->GetHTTPRequestWasTimedOut(hRequest, pbWasTimedOut);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamHTTP::GetHTTPRequestWasTimedOut");
+  return Forward<Method_GetHTTPRequestWasTimedOut>::call(&point, this->internal, hRequest, pbWasTimedOut);
 }
 ISteamHTTP_::ISteamHTTP_(ISteamHTTP * towrap)
 {
@@ -1,238 +1,195 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetResultStatus);
+FORWARD_METHOD(GetResultItems);
+FORWARD_METHOD(GetResultTimestamp);
+FORWARD_METHOD(CheckResultSteamID);
+FORWARD_METHOD(DestroyResult);
+FORWARD_METHOD(GetAllItems);
+FORWARD_METHOD(GetItemsByID);
+FORWARD_METHOD(SerializeResult);
+FORWARD_METHOD(DeserializeResult);
+FORWARD_METHOD(GenerateItems);
+FORWARD_METHOD(GrantPromoItems);
+FORWARD_METHOD(AddPromoItem);
+FORWARD_METHOD(AddPromoItems);
+FORWARD_METHOD(ConsumeItem);
+FORWARD_METHOD(ExchangeItems);
+FORWARD_METHOD(TransferItemQuantity);
+FORWARD_METHOD(SendItemDropHeartbeat);
+FORWARD_METHOD(TriggerItemDrop);
+FORWARD_METHOD(TradeItems);
+FORWARD_METHOD(LoadItemDefinitions);
+FORWARD_METHOD(GetItemDefinitionIDs);
+FORWARD_METHOD(GetItemDefinitionProperty);
+FORWARD_METHOD(RequestEligiblePromoItemDefinitionsIDs);
+FORWARD_METHOD(GetEligiblePromoItemDefinitionIDs);
+
 
 EResult  ISteamInventory_::GetResultStatus(SteamInventoryResult_t  resultHandle)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t )%p)\n", this, resultHandle);
-  EResult  result = this->internal->GetResultStatus(resultHandle);
-  TRACE("() = (EResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetResultStatus");
+  return Forward<Method_GetResultStatus>::call(&point, this->internal, resultHandle);
 }
 
 
 bool  ISteamInventory_::GetResultItems(SteamInventoryResult_t  resultHandle, SteamItemDetails_t * pOutItemsArray, uint32 * punOutItemsArraySize)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t )%p, (SteamItemDetails_t *)%p, (uint32 *)%d)\n", this, resultHandle, pOutItemsArray, punOutItemsArraySize);
-  bool  result = this->internal->GetResultItems(resultHandle, pOutItemsArray, punOutItemsArraySize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetResultItems");
+  return Forward<Method_GetResultItems>::call(&point, this->internal, resultHandle, pOutItemsArray, punOutItemsArraySize);
 }
 
 
 uint32  ISteamInventory_::GetResultTimestamp(SteamInventoryResult_t  resultHandle)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t )%p)\n", this, resultHandle);
-  uint32  result = this->internal->GetResultTimestamp(resultHandle);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetResultTimestamp");
+  return Forward<Method_GetResultTimestamp>::call(&point, this->internal, resultHandle);
 }
 
 
 bool  ISteamInventory_::CheckResultSteamID(SteamInventoryResult_t  resultHandle, CSteamID  steamIDExpected)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t )%p, (CSteamID )%p)\n", this, resultHandle, steamIDExpected);
-  bool  result = this->internal->CheckResultSteamID(resultHandle, steamIDExpected);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::CheckResultSteamID");
+  return Forward<Method_CheckResultSteamID>::call(&point, this->internal, resultHandle, steamIDExpected);
 }
 
 
 void  ISteamInventory_::DestroyResult(SteamInventoryResult_t  resultHandle)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t )%p)\n", this, resultHandle);
-  this->internal->DestroyResult(resultHandle);
-  
+  static ProfilePoint point("ISteamInventory::DestroyResult");
+  return Forward<Method_DestroyResult>::call(&point, this->internal, resultHandle);
 }
 
 
 bool  ISteamInventory_::GetAllItems(SteamInventoryResult_t * pResultHandle)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p)\n", this, pResultHandle);
-  bool  result = this->internal->GetAllItems(pResultHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetAllItems");
+  return Forward<Method_GetAllItems>::call(&point, this->internal, pResultHandle);
 }
 
 
 bool  ISteamInventory_::GetItemsByID(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t * pInstanceIDs, uint32  unCountInstanceIDs)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemInstanceID_t *)%p, (uint32 )%d)\n", this, pResultHandle, pInstanceIDs, unCountInstanceIDs);
-  bool  result = this->internal->GetItemsByID(pResultHandle, pInstanceIDs, unCountInstanceIDs);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetItemsByID");
+  return Forward<Method_GetItemsByID>::call(&point, this->internal, pResultHandle, pInstanceIDs, unCountInstanceIDs);
 }
 
 
 bool  ISteamInventory_::SerializeResult(SteamInventoryResult_t  resultHandle, void * pOutBuffer, uint32 * punOutBufferSize)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t )%p, (void *)%p, (uint32 *)%d)\n", this, resultHandle, pOutBuffer, punOutBufferSize);
-  bool  result = this->internal->SerializeResult(resultHandle, pOutBuffer, punOutBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::SerializeResult");
+  return Forward<Method_SerializeResult>::call(&point, this->internal, resultHandle, pOutBuffer, punOutBufferSize);
 }
 
 
 bool  ISteamInventory_::DeserializeResult(SteamInventoryResult_t * pOutResultHandle, void * pBuffer, uint32  unBufferSize, bool  bRESERVED_MUST_BE_FALSE)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (void *)%p, (uint32 )%d, (bool )%d)\n", this, pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE);
-  bool  result = this->internal->DeserializeResult(pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::DeserializeResult", "2:3");
+  return Forward<Method_DeserializeResult>::call(&point, this->internal, pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE);
 }
 
 
 bool  ISteamInventory_::GenerateItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32 * punArrayQuantity, uint32  unArrayLength)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t *)%p, (uint32 *)%d, (uint32 )%d)\n", this, pResultHandle, pArrayItemDefs, punArrayQuantity, unArrayLength);
-  bool  result = this->internal->GenerateItems(pResultHandle, pArrayItemDefs, punArrayQuantity, unArrayLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GenerateItems");
+  return Forward<Method_GenerateItems>::call(&point, this->internal, pResultHandle, pArrayItemDefs, punArrayQuantity, unArrayLength);
 }
 
 
 bool  ISteamInventory_::GrantPromoItems(SteamInventoryResult_t * pResultHandle)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p)\n", this, pResultHandle);
-  bool  result = this->internal->GrantPromoItems(pResultHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GrantPromoItems");
+  return Forward<Method_GrantPromoItems>::call(&point, this->internal, pResultHandle);
 }
 
 
 bool  ISteamInventory_::AddPromoItem(SteamInventoryResult_t * pResultHandle, SteamItemDef_t  itemDef)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t )%p)\n", this, pResultHandle, itemDef);
-  bool  result = this->internal->AddPromoItem(pResultHandle, itemDef);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::AddPromoItem");
+  return Forward<Method_AddPromoItem>::call(&point, this->internal, pResultHandle, itemDef);
 }
 
 
 bool  ISteamInventory_::AddPromoItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32  unArrayLength)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t *)%p, (uint32 )%d)\n", this, pResultHandle, pArrayItemDefs, unArrayLength);
-  bool  result = this->internal->AddPromoItems(pResultHandle, pArrayItemDefs, unArrayLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::AddPromoItems");
+  return Forward<Method_AddPromoItems>::call(&point, this->internal, pResultHandle, pArrayItemDefs, unArrayLength);
 }
 
 
 bool  ISteamInventory_::ConsumeItem(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemConsume, uint32  unQuantity)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemInstanceID_t )%p, (uint32 )%d)\n", this, pResultHandle, itemConsume, unQuantity);
-  bool  result = this->internal->ConsumeItem(pResultHandle, itemConsume, unQuantity);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::ConsumeItem");
+  return Forward<Method_ConsumeItem>::call(&point, this->internal, pResultHandle, itemConsume, unQuantity);
 }
 
 
 bool  ISteamInventory_::ExchangeItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayGenerate, uint32 * punArrayGenerateQuantity, uint32  unArrayGenerateLength, SteamItemInstanceID_t * pArrayDestroy, uint32 * punArrayDestroyQuantity, uint32  unArrayDestroyLength)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t *)%p, (uint32 *)%d, (uint32 )%d, (SteamItemInstanceID_t *)%p, (uint32 *)%d, (uint32 )%d)\n", this, pResultHandle, pArrayGenerate, punArrayGenerateQuantity, unArrayGenerateLength, pArrayDestroy, punArrayDestroyQuantity, unArrayDestroyLength);
-  bool  result = this->internal->ExchangeItems(pResultHandle, pArrayGenerate, punArrayGenerateQuantity, unArrayGenerateLength, pArrayDestroy, punArrayDestroyQuantity, unArrayDestroyLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::ExchangeItems");
+  return Forward<Method_ExchangeItems>::call(&point, this->internal, pResultHandle, pArrayGenerate, punArrayGenerateQuantity, unArrayGenerateLength, pArrayDestroy, punArrayDestroyQuantity, unArrayDestroyLength);
 }
 
 
 bool  ISteamInventory_::TransferItemQuantity(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemIdSource, uint32  unQuantity, SteamItemInstanceID_t  itemIdDest)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemInstanceID_t )%p, (uint32 )%d, (SteamItemInstanceID_t )%p)\n", this, pResultHandle, itemIdSource, unQuantity, itemIdDest);
-  bool  result = this->internal->TransferItemQuantity(pResultHandle, itemIdSource, unQuantity, itemIdDest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::TransferItemQuantity");
+  return Forward<Method_TransferItemQuantity>::call(&point, this->internal, pResultHandle, itemIdSource, unQuantity, itemIdDest);
 }
 
 
 void  ISteamInventory_::SendItemDropHeartbeat()
 {
-  TRACE("((ISteamInventory *)%p)\n", this);
-  this->internal->SendItemDropHeartbeat();
-  
+  static ProfilePoint point("ISteamInventory::SendItemDropHeartbeat");
+  return Forward<Method_SendItemDropHeartbeat>::call(&point, this->internal);
 }
 
 
 bool  ISteamInventory_::TriggerItemDrop(SteamInventoryResult_t * pResultHandle, SteamItemDef_t  dropListDefinition)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t )%p)\n", this, pResultHandle, dropListDefinition);
-  bool  result = this->internal->TriggerItemDrop(pResultHandle, dropListDefinition);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::TriggerItemDrop");
+  return Forward<Method_TriggerItemDrop>::call(&point, this->internal, pResultHandle, dropListDefinition);
 }
 
 
 bool  ISteamInventory_::TradeItems(SteamInventoryResult_t * pResultHandle, CSteamID  steamIDTradePartner, SteamItemInstanceID_t * pArrayGive, uint32 * pArrayGiveQuantity, uint32  nArrayGiveLength, SteamItemInstanceID_t * pArrayGet, uint32 * pArrayGetQuantity, uint32  nArrayGetLength)
 {
-  TRACE("((ISteamInventory *)%p, (SteamInventoryResult_t *)%p, (CSteamID )%p, (SteamItemInstanceID_t *)%p, (uint32 *)%d, (uint32 )%d, (SteamItemInstanceID_t *)%p, (uint32 *)%d, (uint32 )%d)\n", this, pResultHandle, steamIDTradePartner, pArrayGive, pArrayGiveQuantity, nArrayGiveLength, pArrayGet, pArrayGetQuantity, nArrayGetLength);
-  bool  result = this->internal->TradeItems(pResultHandle, steamIDTradePartner, pArrayGive, pArrayGiveQuantity, nArrayGiveLength, pArrayGet, pArrayGetQuantity, nArrayGetLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::TradeItems");
+  return Forward<Method_TradeItems>::call(&point, this->internal, pResultHandle, steamIDTradePartner, pArrayGive, pArrayGiveQuantity, nArrayGiveLength, pArrayGet, pArrayGetQuantity, nArrayGetLength);
 }
 
 
 bool  ISteamInventory_::LoadItemDefinitions()
 {
-  TRACE("((ISteamInventory *)%p)\n", this);
-  bool  result = this->internal->LoadItemDefinitions();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::LoadItemDefinitions");
+  return Forward<Method_LoadItemDefinitions>::call(&point, this->internal);
 }
 
 
 bool  ISteamInventory_::GetItemDefinitionIDs(SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize)
 {
-  TRACE("((ISteamInventory *)%p, (SteamItemDef_t *)%p, (uint32 *)%d)\n", this, pItemDefIDs, punItemDefIDsArraySize);
-  bool  result = this->internal->GetItemDefinitionIDs(pItemDefIDs, punItemDefIDsArraySize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetItemDefinitionIDs");
+  return Forward<Method_GetItemDefinitionIDs>::call(&point, this->internal, pItemDefIDs, punItemDefIDsArraySize);
 }
 
 
 bool  ISteamInventory_::GetItemDefinitionProperty(SteamItemDef_t  iDefinition, char * pchPropertyName, char * pchValueBuffer, uint32 * punValueBufferSizeOut)
 {
-  TRACE("((ISteamInventory *)%p, (SteamItemDef_t )%p, (char *)\"%s\", (char *)\"%s\", (uint32 *)%d)\n", this, iDefinition, pchPropertyName, pchValueBuffer, punValueBufferSizeOut);
-  bool  result = this->internal->GetItemDefinitionProperty(iDefinition, pchPropertyName, pchValueBuffer, punValueBufferSizeOut);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetItemDefinitionProperty");
+  return Forward<Method_GetItemDefinitionProperty>::call(&point, this->internal, iDefinition, pchPropertyName, pchValueBuffer, punValueBufferSizeOut);
 }
 
 
 SteamAPICall_t  ISteamInventory_::RequestEligiblePromoItemDefinitionsIDs(CSteamID  steamID)
 {
-  TRACE("((ISteamInventory *)%p, (CSteamID )%p)\n", this, steamID);
-  SteamAPICall_t  result = this->internal->RequestEligiblePromoItemDefinitionsIDs(steamID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::RequestEligiblePromoItemDefinitionsIDs");
+  return Forward<Method_RequestEligiblePromoItemDefinitionsIDs>::call(&point, this->internal, steamID);
 }
 
 
 bool  ISteamInventory_::GetEligiblePromoItemDefinitionIDs(CSteamID  steamID, SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize)
 {
-  TRACE("((ISteamInventory *)%p, (CSteamID )%p, (SteamItemDef_t *)%p, (uint32 *)%d)\n", this, steamID, pItemDefIDs, punItemDefIDsArraySize);
-  bool  result = this->internal->GetEligiblePromoItemDefinitionIDs(steamID, pItemDefIDs, punItemDefIDsArraySize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamInventory::GetEligiblePromoItemDefinitionIDs");
+  return Forward<Method_GetEligiblePromoItemDefinitionIDs>::call(&point, this->internal, steamID, pItemDefIDs, punItemDefIDsArraySize);
 }
 ISteamInventory_::ISteamInventory_(ISteamInventory * towrap)
 {
@@ -1,356 +1,333 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetFavoriteGameCount);
+FORWARD_METHOD(GetFavoriteGame);
+FORWARD_METHOD(AddFavoriteGame);
+FORWARD_METHOD(RemoveFavoriteGame);
+FORWARD_METHOD(RequestLobbyList);
+FORWARD_METHOD(AddRequestLobbyListStringFilter);
+FORWARD_METHOD(AddRequestLobbyListNumericalFilter);
+FORWARD_METHOD(AddRequestLobbyListNearValueFilter);
+FORWARD_METHOD(AddRequestLobbyListFilterSlotsAvailable);
+FORWARD_METHOD(AddRequestLobbyListDistanceFilter);
+FORWARD_METHOD(AddRequestLobbyListResultCountFilter);
+FORWARD_METHOD(AddRequestLobbyListCompatibleMembersFilter);
+FORWARD_METHOD(GetLobbyByIndex);
+FORWARD_METHOD(CreateLobby);
+FORWARD_METHOD(JoinLobby);
+FORWARD_METHOD(LeaveLobby);
+FORWARD_METHOD(InviteUserToLobby);
+FORWARD_METHOD(GetNumLobbyMembers);
+FORWARD_METHOD(GetLobbyMemberByIndex);
+FORWARD_METHOD(GetLobbyData);
+FORWARD_METHOD(SetLobbyData);
+FORWARD_METHOD(GetLobbyDataCount);
+FORWARD_METHOD(GetLobbyDataByIndex);
+FORWARD_METHOD(DeleteLobbyData);
+FORWARD_METHOD(GetLobbyMemberData);
+FORWARD_METHOD(SetLobbyMemberData);
+FORWARD_METHOD(SendLobbyChatMsg);
+FORWARD_METHOD(GetLobbyChatEntry);
+FORWARD_METHOD(RequestLobbyData);
+FORWARD_METHOD(SetLobbyGameServer);
+FORWARD_METHOD(GetLobbyGameServer);
+FORWARD_METHOD(SetLobbyMemberLimit);
+FORWARD_METHOD(GetLobbyMemberLimit);
+FORWARD_METHOD(SetLobbyType);
+FORWARD_METHOD(SetLobbyJoinable);
+FORWARD_METHOD(GetLobbyOwner);
+FORWARD_METHOD(SetLobbyOwner);
+FORWARD_METHOD(SetLinkedLobby);
+FORWARD_METHOD(ServerResponded);
+FORWARD_METHOD(ServerFailedToRespond);
+FORWARD_METHOD(RefreshComplete);
+FORWARD_METHOD(AddPlayerToList);
+FORWARD_METHOD(PlayersFailedToRespond);
+FORWARD_METHOD(PlayersRefreshComplete);
+FORWARD_METHOD(RulesResponded);
+FORWARD_METHOD(RulesFailedToRespond);
+FORWARD_METHOD(RulesRefreshComplete);
+FORWARD_METHOD(RequestInternetServerList);
+FORWARD_METHOD(RequestLANServerList);
+FORWARD_METHOD(RequestFriendsServerList);
+FORWARD_METHOD(RequestFavoritesServerList);
+FORWARD_METHOD(RequestHistoryServerList);
+FORWARD_METHOD(RequestSpectatorServerList);
+FORWARD_METHOD(ReleaseRequest);
+FORWARD_METHOD(GetServerDetails);
+FORWARD_METHOD(CancelQuery);
+FORWARD_METHOD(RefreshQuery);
+FORWARD_METHOD(IsRefreshing);
+FORWARD_METHOD(GetServerCount);
+FORWARD_METHOD(RefreshServer);
+FORWARD_METHOD(PingServer);
+FORWARD_METHOD(PlayerDetails);
+FORWARD_METHOD(ServerRules);
+FORWARD_METHOD(CancelServerQuery);
+
 
 int  ISteamMatchmaking_::GetFavoriteGameCount()
 {
-  TRACE("((ISteamMatchmaking *)%p)\n", this);
-  int  result = this->internal->GetFavoriteGameCount();
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetFavoriteGameCount");
+  return Forward<Method_GetFavoriteGameCount>::call(&point, this->internal);
 }
 
 
 bool  ISteamMatchmaking_::GetFavoriteGame(int  iGame, AppId_t * pnAppID, uint32 * pnIP, uint16 * pnConnPort, uint16 * pnQueryPort, uint32 * punFlags, uint32 * pRTime32LastPlayedOnServer)
 {
-  TRACE("((ISteamMatchmaking *)%p, (int )%d, (AppId_t *)%p, (uint32 *)%d, (uint16 *)%d, (uint16 *)%d, (uint32 *)%d, (uint32 *)%d)\n", this, iGame, pnAppID, pnIP, pnConnPort, pnQueryPort, punFlags, pRTime32LastPlayedOnServer);
-  bool  result = this->internal->GetFavoriteGame(iGame, pnAppID, pnIP, pnConnPort, pnQueryPort, punFlags, pRTime32LastPlayedOnServer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetFavoriteGame");
+  return Forward<Method_GetFavoriteGame>::call(&point, this->internal, iGame, pnAppID, pnIP, pnConnPort, pnQueryPort, punFlags, pRTime32LastPlayedOnServer);
 }
 
 
 int  ISteamMatchmaking_::AddFavoriteGame(AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags, uint32  rTime32LastPlayedOnServer)
 {
-  TRACE("((ISteamMatchmaking *)%p, (AppId_t )%p, (uint32 )%d, (uint16 )%d, (uint16 )%d, (uint32 )%d, (uint32 )%d)\n", this, nAppID, nIP, nConnPort, nQueryPort, unFlags, rTime32LastPlayedOnServer);
-  int  result = this->internal->AddFavoriteGame(nAppID, nIP, nConnPort, nQueryPort, unFlags, rTime32LastPlayedOnServer);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::AddFavoriteGame");
+  return Forward<Method_AddFavoriteGame>::call(&point, this->internal, nAppID, nIP, nConnPort, nQueryPort, unFlags, rTime32LastPlayedOnServer);
 }
 
 
 bool  ISteamMatchmaking_::RemoveFavoriteGame(AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags)
 {
-  TRACE("((ISteamMatchmaking *)%p, (AppId_t )%p, (uint32 )%d, (uint16 )%d, (uint16 )%d, (uint32 )%d)\n", this, nAppID, nIP, nConnPort, nQueryPort, unFlags);
-  bool  result = this->internal->RemoveFavoriteGame(nAppID, nIP, nConnPort, nQueryPort, unFlags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::RemoveFavoriteGame");
+  return Forward<Method_RemoveFavoriteGame>::call(&point, this->internal, nAppID, nIP, nConnPort, nQueryPort, unFlags);
 }
 
 
 SteamAPICall_t  ISteamMatchmaking_::RequestLobbyList()
 {
-  TRACE("((ISteamMatchmaking *)%p)\n", this);
-  SteamAPICall_t  result = this->internal->RequestLobbyList();
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::RequestLobbyList");
+  return Forward<Method_RequestLobbyList>::call(&point, this->internal);
 }
 
 
 void  ISteamMatchmaking_::AddRequestLobbyListStringFilter(char * pchKeyToMatch, char * pchValueToMatch, ELobbyComparison  eComparisonType)
 {
-  TRACE("((ISteamMatchmaking *)%p, (char *)\"%s\", (char *)\"%s\", (ELobbyComparison )%p)\n", this, pchKeyToMatch, pchValueToMatch, eComparisonType);
-  this->internal->AddRequestLobbyListStringFilter(pchKeyToMatch, pchValueToMatch, eComparisonType);
-  
+  static ProfilePoint point("ISteamMatchmaking::AddRequestLobbyListStringFilter");
+  return Forward<Method_AddRequestLobbyListStringFilter>::call(&point, this->internal, pchKeyToMatch, pchValueToMatch, eComparisonType);
 }
 
 
 void  ISteamMatchmaking_::AddRequestLobbyListNumericalFilter(char * pchKeyToMatch, int  nValueToMatch, ELobbyComparison  eComparisonType)
 {
-  TRACE("((ISteamMatchmaking *)%p, (char *)\"%s\", (int )%d, (ELobbyComparison )%p)\n", this, pchKeyToMatch, nValueToMatch, eComparisonType);
-  this->internal->AddRequestLobbyListNumericalFilter(pchKeyToMatch, nValueToMatch, eComparisonType);
-  
+  static ProfilePoint point("ISteamMatchmaking::AddRequestLobbyListNumericalFilter");
+  return Forward<Method_AddRequestLobbyListNumericalFilter>::call(&point, this->internal, pchKeyToMatch, nValueToMatch, eComparisonType);
 }
 
 
 void  ISteamMatchmaking_::AddRequestLobbyListNearValueFilter(char * pchKeyToMatch, int  nValueToBeCloseTo)
 {
-  TRACE("((ISteamMatchmaking *)%p, (char *)\"%s\", (int )%d)\n", this, pchKeyToMatch, nValueToBeCloseTo);
-  this->internal->AddRequestLobbyListNearValueFilter(pchKeyToMatch, nValueToBeCloseTo);
-  
+  static ProfilePoint point("ISteamMatchmaking::AddRequestLobbyListNearValueFilter");
+  return Forward<Method_AddRequestLobbyListNearValueFilter>::call(&point, this->internal, pchKeyToMatch, nValueToBeCloseTo);
 }
 
 
 void  ISteamMatchmaking_::AddRequestLobbyListFilterSlotsAvailable(int  nSlotsAvailable)
 {
-  TRACE("((ISteamMatchmaking *)%p, (int )%d)\n", this, nSlotsAvailable);
-  this->internal->AddRequestLobbyListFilterSlotsAvailable(nSlotsAvailable);
-  
+  static ProfilePoint point("ISteamMatchmaking::AddRequestLobbyListFilterSlotsAvailable");
+  return Forward<Method_AddRequestLobbyListFilterSlotsAvailable>::call(&point, this->internal, nSlotsAvailable);
 }
 
 
 void  ISteamMatchmaking_::AddRequestLobbyListDistanceFilter(ELobbyDistanceFilter  eLobbyDistanceFilter)
 {
-  TRACE("((ISteamMatchmaking *)%p, (ELobbyDistanceFilter )%p)\n", this, eLobbyDistanceFilter);
-  this->internal->AddRequestLobbyListDistanceFilter(eLobbyDistanceFilter);
-  
+  static ProfilePoint point("ISteamMatchmaking::AddRequestLobbyListDistanceFilter");
+  return Forward<Method_AddRequestLobbyListDistanceFilter>::call(&point, this->internal, eLobbyDistanceFilter);
 }
 
 
 void  ISteamMatchmaking_::AddRequestLobbyListResultCountFilter(int  cMaxResults)
 {
-  TRACE("((ISteamMatchmaking *)%p, (int )%d)\n", this, cMaxResults);
-  this->internal->AddRequestLobbyListResultCountFilter(cMaxResults);
-  
+  static ProfilePoint point("ISteamMatchmaking::AddRequestLobbyListResultCountFilter");
+  return Forward<Method_AddRequestLobbyListResultCountFilter>::call(&point, this->internal, cMaxResults);
 }
 
 
 void  ISteamMatchmaking_::AddRequestLobbyListCompatibleMembersFilter(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  this->internal->AddRequestLobbyListCompatibleMembersFilter(steamIDLobby);
-  
+  static ProfilePoint point("ISteamMatchmaking::AddRequestLobbyListCompatibleMembersFilter");
+  return Forward<Method_AddRequestLobbyListCompatibleMembersFilter>::call(&point, this->internal, steamIDLobby);
 }
 
 
 CSteamID * ISteamMatchmaking_::GetLobbyByIndex(CSteamID * hidden, int  iLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (int )%d)\n", this, iLobby);
-  *hidden = this->internal->GetLobbyByIndex(iLobby);
-  return hidden;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyByIndex");
+  return Forward<Method_GetLobbyByIndex>::hidden(&point, hidden, this->internal, iLobby);
 }
 
 
 SteamAPICall_t  ISteamMatchmaking_::CreateLobby(ELobbyType  eLobbyType, int  cMaxMembers)
 {
-  TRACE("((ISteamMatchmaking *)%p, (ELobbyType )%p, (int )%d)\n", this, eLobbyType, cMaxMembers);
-  SteamAPICall_t  result = this->internal->CreateLobby(eLobbyType, cMaxMembers);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::CreateLobby");
+  return Forward<Method_CreateLobby>::call(&point, this->internal, eLobbyType, cMaxMembers);
 }
 
 
 SteamAPICall_t  ISteamMatchmaking_::JoinLobby(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  SteamAPICall_t  result = this->internal->JoinLobby(steamIDLobby);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::JoinLobby");
+  return Forward<Method_JoinLobby>::call(&point, this->internal, steamIDLobby);
 }
 
 
 void  ISteamMatchmaking_::LeaveLobby(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  this->internal->LeaveLobby(steamIDLobby);
-  
+  static ProfilePoint point("ISteamMatchmaking::LeaveLobby");
+  return Forward<Method_LeaveLobby>::call(&point, this->internal, steamIDLobby);
 }
 
 
 bool  ISteamMatchmaking_::InviteUserToLobby(CSteamID  steamIDLobby, CSteamID  steamIDInvitee)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (CSteamID )%p)\n", this, steamIDLobby, steamIDInvitee);
-  bool  result = this->internal->InviteUserToLobby(steamIDLobby, steamIDInvitee);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::InviteUserToLobby");
+  return Forward<Method_InviteUserToLobby>::call(&point, this->internal, steamIDLobby, steamIDInvitee);
 }
 
 
 int  ISteamMatchmaking_::GetNumLobbyMembers(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  int  result = this->internal->GetNumLobbyMembers(steamIDLobby);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetNumLobbyMembers");
+  return Forward<Method_GetNumLobbyMembers>::call(&point, this->internal, steamIDLobby);
 }
 
 
 CSteamID * ISteamMatchmaking_::GetLobbyMemberByIndex(CSteamID * hidden, CSteamID  steamIDLobby, int  iMember)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDLobby, iMember);
-  *hidden = this->internal->GetLobbyMemberByIndex(steamIDLobby, iMember);
-  return hidden;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyMemberByIndex");
+  return Forward<Method_GetLobbyMemberByIndex>::hidden(&point, hidden, this->internal, steamIDLobby, iMember);
 }
 
 
 char * ISteamMatchmaking_::GetLobbyData(CSteamID  steamIDLobby, char * pchKey)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDLobby, pchKey);
-  char * result = this->internal->GetLobbyData(steamIDLobby, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyData");
+  return Forward<Method_GetLobbyData>::call(&point, this->internal, steamIDLobby, pchKey);
 }
 
 
 bool  ISteamMatchmaking_::SetLobbyData(CSteamID  steamIDLobby, char * pchKey, char * pchValue)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (char *)\"%s\", (char *)\"%s\")\n", this, steamIDLobby, pchKey, pchValue);
-  bool  result = this->internal->SetLobbyData(steamIDLobby, pchKey, pchValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::SetLobbyData");
+  return Forward<Method_SetLobbyData>::call(&point, this->internal, steamIDLobby, pchKey, pchValue);
 }
 
 
 int  ISteamMatchmaking_::GetLobbyDataCount(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  int  result = this->internal->GetLobbyDataCount(steamIDLobby);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyDataCount");
+  return Forward<Method_GetLobbyDataCount>::call(&point, this->internal, steamIDLobby);
 }
 
 
 bool  ISteamMatchmaking_::GetLobbyDataByIndex(CSteamID  steamIDLobby, int  iLobbyData, char * pchKey, int  cchKeyBufferSize, char * pchValue, int  cchValueBufferSize)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (int )%d, (char *)\"%s\", (int )%d, (char *)\"%s\", (int )%d)\n", this, steamIDLobby, iLobbyData, pchKey, cchKeyBufferSize, pchValue, cchValueBufferSize);
-  bool  result = this->internal->GetLobbyDataByIndex(steamIDLobby, iLobbyData, pchKey, cchKeyBufferSize, pchValue, cchValueBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyDataByIndex", "3:4 5:6");
+  return Forward<Method_GetLobbyDataByIndex>::call(&point, this->internal, steamIDLobby, iLobbyData, pchKey, cchKeyBufferSize, pchValue, cchValueBufferSize);
 }
 
 
 bool  ISteamMatchmaking_::DeleteLobbyData(CSteamID  steamIDLobby, char * pchKey)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDLobby, pchKey);
-  bool  result = this->internal->DeleteLobbyData(steamIDLobby, pchKey);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::DeleteLobbyData");
+  return Forward<Method_DeleteLobbyData>::call(&point, this->internal, steamIDLobby, pchKey);
 }
 
 
 char * ISteamMatchmaking_::GetLobbyMemberData(CSteamID  steamIDLobby, CSteamID  steamIDUser, char * pchKey)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (CSteamID )%p, (char *)\"%s\")\n", this, steamIDLobby, steamIDUser, pchKey);
-  char * result = this->internal->GetLobbyMemberData(steamIDLobby, steamIDUser, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyMemberData");
+  return Forward<Method_GetLobbyMemberData>::call(&point, this->internal, steamIDLobby, steamIDUser, pchKey);
 }
 
 
 void  ISteamMatchmaking_::SetLobbyMemberData(CSteamID  steamIDLobby, char * pchKey, char * pchValue)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (char *)\"%s\", (char *)\"%s\")\n", this, steamIDLobby, pchKey, pchValue);
-  this->internal->SetLobbyMemberData(steamIDLobby, pchKey, pchValue);
-  
+  static ProfilePoint point("ISteamMatchmaking::SetLobbyMemberData");
+  return Forward<Method_SetLobbyMemberData>::call(&point, this->internal, steamIDLobby, pchKey, pchValue);
 }
 
 
 bool  ISteamMatchmaking_::SendLobbyChatMsg(CSteamID  steamIDLobby, void * pvMsgBody, int  cubMsgBody)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (void *)%p, (int )%d)\n", this, steamIDLobby, pvMsgBody, cubMsgBody);
-  bool  result = this->internal->SendLobbyChatMsg(steamIDLobby, pvMsgBody, cubMsgBody);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::SendLobbyChatMsg", "2:3");
+  return Forward<Method_SendLobbyChatMsg>::call(&point, this->internal, steamIDLobby, pvMsgBody, cubMsgBody);
 }
 
 
 int  ISteamMatchmaking_::GetLobbyChatEntry(CSteamID  steamIDLobby, int  iChatID, CSteamID * pSteamIDUser, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (int )%d, (CSteamID *)%p, (void *)%p, (int )%d, (EChatEntryType *)%p)\n", this, steamIDLobby, iChatID, pSteamIDUser, pvData, cubData, peChatEntryType);
-  int  result = this->internal->GetLobbyChatEntry(steamIDLobby, iChatID, pSteamIDUser, pvData, cubData, peChatEntryType);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyChatEntry", "4:5");
+  return Forward<Method_GetLobbyChatEntry>::call(&point, this->internal, steamIDLobby, iChatID, pSteamIDUser, pvData, cubData, peChatEntryType);
 }
 
 
 bool  ISteamMatchmaking_::RequestLobbyData(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  bool  result = this->internal->RequestLobbyData(steamIDLobby);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::RequestLobbyData");
+  return Forward<Method_RequestLobbyData>::call(&point, this->internal, steamIDLobby);
 }
 
 
 void  ISteamMatchmaking_::SetLobbyGameServer(CSteamID  steamIDLobby, uint32  unGameServerIP, uint16  unGameServerPort, CSteamID  steamIDGameServer)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (uint32 )%d, (uint16 )%d, (CSteamID )%p)\n", this, steamIDLobby, unGameServerIP, unGameServerPort, steamIDGameServer);
-  this->internal->SetLobbyGameServer(steamIDLobby, unGameServerIP, unGameServerPort, steamIDGameServer);
-  
+  static ProfilePoint point("ISteamMatchmaking::SetLobbyGameServer");
+  return Forward<Method_SetLobbyGameServer>::call(&point, this->internal, steamIDLobby, unGameServerIP, unGameServerPort, steamIDGameServer);
 }
 
 
 bool  ISteamMatchmaking_::GetLobbyGameServer(CSteamID  steamIDLobby, uint32 * punGameServerIP, uint16 * punGameServerPort, CSteamID * psteamIDGameServer)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (uint32 *)%d, (uint16 *)%d, (CSteamID *)%p)\n", this, steamIDLobby, punGameServerIP, punGameServerPort, psteamIDGameServer);
-  bool  result = this->internal->GetLobbyGameServer(steamIDLobby, punGameServerIP, punGameServerPort, psteamIDGameServer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyGameServer");
+  return Forward<Method_GetLobbyGameServer>::call(&point, this->internal, steamIDLobby, punGameServerIP, punGameServerPort, psteamIDGameServer);
 }
 
 
 bool  ISteamMatchmaking_::SetLobbyMemberLimit(CSteamID  steamIDLobby, int  cMaxMembers)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDLobby, cMaxMembers);
-  bool  result = this->internal->SetLobbyMemberLimit(steamIDLobby, cMaxMembers);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::SetLobbyMemberLimit");
+  return Forward<Method_SetLobbyMemberLimit>::call(&point, this->internal, steamIDLobby, cMaxMembers);
 }
 
 
 int  ISteamMatchmaking_::GetLobbyMemberLimit(CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  int  result = this->internal->GetLobbyMemberLimit(steamIDLobby);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyMemberLimit");
+  return Forward<Method_GetLobbyMemberLimit>::call(&point, this->internal, steamIDLobby);
 }
 
 
 bool  ISteamMatchmaking_::SetLobbyType(CSteamID  steamIDLobby, ELobbyType  eLobbyType)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (ELobbyType )%p)\n", this, steamIDLobby, eLobbyType);
-  bool  result = this->internal->SetLobbyType(steamIDLobby, eLobbyType);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::SetLobbyType");
+  return Forward<Method_SetLobbyType>::call(&point, this->internal, steamIDLobby, eLobbyType);
 }
 
 
 bool  ISteamMatchmaking_::SetLobbyJoinable(CSteamID  steamIDLobby, bool  bLobbyJoinable)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (bool )%d)\n", this, steamIDLobby, bLobbyJoinable);
-  bool  result = this->internal->SetLobbyJoinable(steamIDLobby, bLobbyJoinable);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::SetLobbyJoinable");
+  return Forward<Method_SetLobbyJoinable>::call(&point, this->internal, steamIDLobby, bLobbyJoinable);
 }
 
 
 CSteamID * ISteamMatchmaking_::GetLobbyOwner(CSteamID * hidden, CSteamID  steamIDLobby)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p)\n", this, steamIDLobby);
-  *hidden = this->internal->GetLobbyOwner(steamIDLobby);
-  return hidden;
+  static ProfilePoint point("ISteamMatchmaking::GetLobbyOwner");
+  return Forward<Method_GetLobbyOwner>::hidden(&point, hidden, this->internal, steamIDLobby);
 }
 
 
 bool  ISteamMatchmaking_::SetLobbyOwner(CSteamID  steamIDLobby, CSteamID  steamIDNewOwner)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (CSteamID )%p)\n", this, steamIDLobby, steamIDNewOwner);
-  bool  result = this->internal->SetLobbyOwner(steamIDLobby, steamIDNewOwner);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::SetLobbyOwner");
+  return Forward<Method_SetLobbyOwner>::call(&point, this->internal, steamIDLobby, steamIDNewOwner);
 }
 
 
 bool  ISteamMatchmaking_::SetLinkedLobby(CSteamID  steamIDLobby, CSteamID  steamIDLobbyDependent)
 {
-  TRACE("((ISteamMatchmaking *)%p, (CSteamID )%p, (CSteamID )%p)\n", this, steamIDLobby, steamIDLobbyDependent);
-  bool  result = this->internal->SetLinkedLobby(steamIDLobby, steamIDLobbyDependent);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmaking::SetLinkedLobby");
+  return Forward<Method_SetLinkedLobby>::call(&point, this->internal, steamIDLobby, steamIDLobbyDependent);
 }
 ISteamMatchmaking_::ISteamMatchmaking_(ISteamMatchmaking * towrap)
 {
@@ -366,25 +343,22 @@ ISteamMatchmaking_::~ISteamMatchmaking_()
 
 void  ISteamMatchmakingServerListResponse_::ServerResponded(HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((ISteamMatchmakingServerListResponse *)%p, (HServerListRequest )%p, (int )%d)\n", this, hRequest, iServer);
-  this->internal->ServerResponded(hRequest, iServer);
-  
+  static ProfilePoint point("ISteamMatchmakingServerListResponse::ServerResponded");
+  return Forward<Method_ServerResponded>::call(&point, this->internal, hRequest, iServer);
 }
 
 
 void  ISteamMatchmakingServerListResponse_::ServerFailedToRespond(HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((ISteamMatchmakingServerListResponse *)%p, (HServerListRequest )%p, (int )%d)\n", this, hRequest, iServer);
-  this->internal->ServerFailedToRespond(hRequest, iServer);
-  
+  static ProfilePoint point("ISteamMatchmakingServerListResponse::ServerFailedToRespond");
+  return Forward<Method_ServerFailedToRespond>::call(&point, this->internal, hRequest, iServer);
 }
 
 
 void  ISteamMatchmakingServerListResponse_::RefreshComplete(HServerListRequest  hRequest, EMatchMakingServerResponse  response)
 {
-  TRACE("((ISteamMatchmakingServerListResponse *)%p, (HServerListRequest )%p, (EMatchMakingServerResponse )%p)\n", this, hRequest, response);
-  this->internal->RefreshComplete(hRequest, response);
-  
+  static ProfilePoint point("ISteamMatchmakingServerListResponse::RefreshComplete");
+  return Forward<Method_RefreshComplete>::call(&point, this->internal, hRequest, response);
 }
 ISteamMatchmakingServerListResponse_::ISteamMatchmakingServerListResponse_(ISteamMatchmakingServerListResponse * towrap)
 {
@@ -400,17 +374,15 @@ ISteamMatchmakingServerListResponse_::~ISteamMatchmakingServerListResponse_()
 
 void  ISteamMatchmakingPingResponse_::ServerResponded(gameserveritem_t & server)
 {
-  TRACE("((ISteamMatchmakingPingResponse *)%p, (gameserveritem_t &)%p)\n", this, server);
-  this->internal->ServerResponded(server);
-  
+  static ProfilePoint point("ISteamMatchmakingPingResponse::ServerResponded");
+  return Forward<Method_ServerResponded>::call(&point, this->internal, server);
 }
 
 
 void  ISteamMatchmakingPingResponse_::ServerFailedToRespond()
 {
-  TRACE("((ISteamMatchmakingPingResponse *)%p)\n", this);
-  this->internal->ServerFailedToRespond();
-  
+  static ProfilePoint point("ISteamMatchmakingPingResponse::ServerFailedToRespond");
+  return Forward<Method_ServerFailedToRespond>::call(&point, this->internal);
 }
 ISteamMatchmakingPingResponse_::ISteamMatchmakingPingResponse_(ISteamMatchmakingPingResponse * towrap)
 {
@@ -426,25 +398,22 @@ ISteamMatchmakingPingResponse_::~ISteamMatchmakingPingResponse_()
 
 void  ISteamMatchmakingPlayersResponse_::AddPlayerToList(char * pchName, int  nScore, float  flTimePlayed)
 {
-  TRACE("((ISteamMatchmakingPlayersResponse *)%p, (char *)\"%s\", (int )%d, (float )%f)\n", this, pchName, nScore, flTimePlayed);
-  this->internal->AddPlayerToList(pchName, nScore, flTimePlayed);
-  
+  static ProfilePoint point("ISteamMatchmakingPlayersResponse::AddPlayerToList");
+  return Forward<Method_AddPlayerToList>::call(&point, this->internal, pchName, nScore, flTimePlayed);
 }
 
 
 void  ISteamMatchmakingPlayersResponse_::PlayersFailedToRespond()
 {
-  TRACE("((ISteamMatchmakingPlayersResponse *)%p)\n", this);
-  this->internal->PlayersFailedToRespond();
-  
+  static ProfilePoint point("ISteamMatchmakingPlayersResponse::PlayersFailedToRespond");
+  return Forward<Method_PlayersFailedToRespond>::call(&point, this->internal);
 }
 
 
 void  ISteamMatchmakingPlayersResponse_::PlayersRefreshComplete()
 {
-  TRACE("((ISteamMatchmakingPlayersResponse *)%p)\n", this);
-  this->internal->PlayersRefreshComplete();
-  
+  static ProfilePoint point("ISteamMatchmakingPlayersResponse::PlayersRefreshComplete");
+  return Forward<Method_PlayersRefreshComplete>::call(&point, this->internal);
 }
 ISteamMatchmakingPlayersResponse_::ISteamMatchmakingPlayersResponse_(ISteamMatchmakingPlayersResponse * towrap)
 {
@@ -460,25 +429,22 @@ ISteamMatchmakingPlayersResponse_::~ISteamMatchmakingPlayersResponse_()
 
 void  ISteamMatchmakingRulesResponse_::RulesResponded(char * pchRule, char * pchValue)
 {
-  TRACE("((ISteamMatchmakingRulesResponse *)%p, (char *)\"%s\", (char *)\"%s\")\n", this, pchRule, pchValue);
-  this->internal->RulesResponded(pchRule, pchValue);
-  
+  static ProfilePoint point("ISteamMatchmakingRulesResponse::RulesResponded");
+  return Forward<Method_RulesResponded>::call(&point, this->internal, pchRule, pchValue);
 }
 
 
 void  ISteamMatchmakingRulesResponse_::RulesFailedToRespond()
 {
-  TRACE("((ISteamMatchmakingRulesResponse *)%p)\n", this);
-  this->internal->RulesFailedToRespond();
-  
+  static ProfilePoint point("ISteamMatchmakingRulesResponse::RulesFailedToRespond");
+  return Forward<Method_RulesFailedToRespond>::call(&point, this->internal);
 }
 
 
 void  ISteamMatchmakingRulesResponse_::RulesRefreshComplete()
 {
-  TRACE("((ISteamMatchmakingRulesResponse *)%p)\n", this);
-  this->internal->RulesRefreshComplete();
-  
+  static ProfilePoint point("ISteamMatchmakingRulesResponse::RulesRefreshComplete");
+  return Forward<Method_RulesRefreshComplete>::call(&point, this->internal);
 }
 ISteamMatchmakingRulesResponse_::ISteamMatchmakingRulesResponse_(ISteamMatchmakingRulesResponse * towrap)
 {
@@ -494,161 +460,120 @@ ISteamMatchmakingRulesResponse_::~ISteamMatchmakingRulesResponse_()
 
 HServerListRequest  ISteamMatchmakingServers_::RequestInternetServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", this, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = this->internal->RequestInternetServerList(iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::RequestInternetServerList");
+  return Forward<Method_RequestInternetServerList>::call(&point, this->internal, iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  ISteamMatchmakingServers_::RequestLANServerList(AppId_t  iApp, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (AppId_t )%p, (ISteamMatchmakingServerListResponse *)%p)\n", this, iApp, pRequestServersResponse);
-  HServerListRequest  result = this->internal->RequestLANServerList(iApp, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::RequestLANServerList");
+  return Forward<Method_RequestLANServerList>::call(&point, this->internal, iApp, pRequestServersResponse);
 }
 
 
 HServerListRequest  ISteamMatchmakingServers_::RequestFriendsServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", this, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = this->internal->RequestFriendsServerList(iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::RequestFriendsServerList");
+  return Forward<Method_RequestFriendsServerList>::call(&point, this->internal, iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  ISteamMatchmakingServers_::RequestFavoritesServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", this, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = this->internal->RequestFavoritesServerList(iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::RequestFavoritesServerList");
+  return Forward<Method_RequestFavoritesServerList>::call(&point, this->internal, iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  ISteamMatchmakingServers_::RequestHistoryServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", this, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = this->internal->RequestHistoryServerList(iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::RequestHistoryServerList");
+  return Forward<Method_RequestHistoryServerList>::call(&point, this->internal, iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  ISteamMatchmakingServers_::RequestSpectatorServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", this, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = this->internal->RequestSpectatorServerList(iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::RequestSpectatorServerList");
+  return Forward<Method_RequestSpectatorServerList>::call(&point, this->internal, iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 void  ISteamMatchmakingServers_::ReleaseRequest(HServerListRequest  hServerListRequest)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerListRequest )%p)\n", this, hServerListRequest);
-  this->internal->ReleaseRequest(hServerListRequest);
-  
+  static ProfilePoint point("ISteamMatchmakingServers::ReleaseRequest");
+  return Forward<Method_ReleaseRequest>::call(&point, this->internal, hServerListRequest);
 }
 
 
 gameserveritem_t * ISteamMatchmakingServers_::GetServerDetails(HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerListRequest )%p, (int )%d)\n", this, hRequest, iServer);
-  gameserveritem_t * result = this->internal->GetServerDetails(hRequest, iServer);
-  TRACE("() = (gameserveritem_t *)%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::GetServerDetails");
+  return Forward<Method_GetServerDetails>::call(&point, this->internal, hRequest, iServer);
 }
 
 
 void  ISteamMatchmakingServers_::CancelQuery(HServerListRequest  hRequest)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerListRequest )%p)\n", this, hRequest);
-  this->internal->CancelQuery(hRequest);
-  
+  static ProfilePoint point("ISteamMatchmakingServers::CancelQuery");
+  return Forward<Method_CancelQuery>::call(&point, this->internal, hRequest);
 }
 
 
 void  ISteamMatchmakingServers_::RefreshQuery(HServerListRequest  hRequest)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerListRequest )%p)\n", this, hRequest);
-  this->internal->RefreshQuery(hRequest);
-  
+  static ProfilePoint point("ISteamMatchmakingServers::RefreshQuery");
+  return Forward<Method_RefreshQuery>::call(&point, this->internal, hRequest);
 }
 
 
 bool  ISteamMatchmakingServers_::IsRefreshing(HServerListRequest  hRequest)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerListRequest )%p)\n", this, hRequest);
-  bool  result = this->internal->IsRefreshing(hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::IsRefreshing");
+  return Forward<Method_IsRefreshing>::call(&point, this->internal, hRequest);
 }
 
 
 int  ISteamMatchmakingServers_::GetServerCount(HServerListRequest  hRequest)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerListRequest )%p)\n", this, hRequest);
-  int  result = this->internal->GetServerCount(hRequest);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::GetServerCount");
+  return Forward<Method_GetServerCount>::call(&point, this->internal, hRequest);
 }
 
 
 void  ISteamMatchmakingServers_::RefreshServer(HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerListRequest )%p, (int )%d)\n", this, hRequest, iServer);
-  this->internal->RefreshServer(hRequest, iServer);
-  
+  static ProfilePoint point("ISteamMatchmakingServers::RefreshServer");
+  return Forward<Method_RefreshServer>::call(&point, this->internal, hRequest, iServer);
 }
 
 
 HServerQuery  ISteamMatchmakingServers_::PingServer(uint32  unIP, uint16  usPort, ISteamMatchmakingPingResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (uint32 )%d, (uint16 )%d, (ISteamMatchmakingPingResponse *)%p)\n", this, unIP, usPort, pRequestServersResponse);
-  HServerQuery  result = this->internal->PingServer(unIP, usPort, pRequestServersResponse);
-  TRACE("() = (HServerQuery )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::PingServer");
+  return Forward<Method_PingServer>::call(&point, this->internal, unIP, usPort, pRequestServersResponse);
 }
 
 
 HServerQuery  ISteamMatchmakingServers_::PlayerDetails(uint32  unIP, uint16  usPort, ISteamMatchmakingPlayersResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (uint32 )%d, (uint16 )%d, (ISteamMatchmakingPlayersResponse *)%p)\n", this, unIP, usPort, pRequestServersResponse);
-  HServerQuery  result = this->internal->PlayerDetails(unIP, usPort, pRequestServersResponse);
-  TRACE("() = (HServerQuery )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::PlayerDetails");
+  return Forward<Method_PlayerDetails>::call(&point, this->internal, unIP, usPort, pRequestServersResponse);
 }
 
 
 HServerQuery  ISteamMatchmakingServers_::ServerRules(uint32  unIP, uint16  usPort, ISteamMatchmakingRulesResponse * pRequestServersResponse)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (uint32 )%d, (uint16 )%d, (ISteamMatchmakingRulesResponse *)%p)\n", this, unIP, usPort, pRequestServersResponse);
-  HServerQuery  result = this->internal->ServerRules(unIP, usPort, pRequestServersResponse);
-  TRACE("() = (HServerQuery )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMatchmakingServers::ServerRules");
+  return Forward<Method_ServerRules>::call(&point, this->internal, unIP, usPort, pRequestServersResponse);
 }
 
 
 void  ISteamMatchmakingServers_::CancelServerQuery(HServerQuery  hServerQuery)
 {
-  TRACE("((ISteamMatchmakingServers *)%p, (HServerQuery )%p)\n", this, hServerQuery);
-  this->internal->CancelServerQuery(hServerQuery);
-  
+  static ProfilePoint point("ISteamMatchmakingServers::CancelServerQuery");
+  return Forward<Method_CancelServerQuery>::call(&point, this->internal, hServerQuery);
 }
 ISteamMatchmakingServers_::ISteamMatchmakingServers_(ISteamMatchmakingServers * towrap)
 {
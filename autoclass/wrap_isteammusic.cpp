@@ -1,82 +1,75 @@
 #include <steam_api_.h>
+FORWARD_METHOD(BIsEnabled);
+FORWARD_METHOD(BIsPlaying);
+FORWARD_METHOD(GetPlaybackStatus);
+FORWARD_METHOD(Play);
+FORWARD_METHOD(Pause);
+FORWARD_METHOD(PlayPrevious);
+FORWARD_METHOD(PlayNext);
+FORWARD_METHOD(SetVolume);
+FORWARD_METHOD(GetVolume);
+
 
 bool  ISteamMusic_::BIsEnabled()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  bool  result = this->internal->BIsEnabled();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusic::BIsEnabled");
+  return Forward<Method_BIsEnabled>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusic_::BIsPlaying()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  bool  result = this->internal->BIsPlaying();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusic::BIsPlaying");
+  return Forward<Method_BIsPlaying>::call(&point, this->internal);
 }
 
 
 AudioPlayback_Status  ISteamMusic_::GetPlaybackStatus()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  AudioPlayback_Status  result = this->internal->GetPlaybackStatus();
-  TRACE("() = (AudioPlayback_Status )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusic::GetPlaybackStatus");
+  return Forward<Method_GetPlaybackStatus>::call(&point, this->internal);
 }
 
 
 void  ISteamMusic_::Play()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  this->internal->Play();
-  
+  static ProfilePoint point("ISteamMusic::Play");
+  return Forward<Method_Play>::call(&point, this->internal);
 }
 
 
 void  ISteamMusic_::Pause()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  this->internal->Pause();
-  
+  static ProfilePoint point("ISteamMusic::Pause");
+  return Forward<Method_Pause>::call(&point, this->internal);
 }
 
 
 void  ISteamMusic_::PlayPrevious()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  this->internal->PlayPrevious();
-  
+  static ProfilePoint point("ISteamMusic::PlayPrevious");
+  return Forward<Method_PlayPrevious>::call(&point, this->internal);
 }
 
 
 void  ISteamMusic_::PlayNext()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  this->internal->PlayNext();
-  
+  static ProfilePoint point("ISteamMusic::PlayNext");
+  return Forward<Method_PlayNext>::call(&point, this->internal);
 }
 
 
 void  ISteamMusic_::SetVolume(float  flVolume)
 {
-  TRACE("((ISteamMusic *)%p, (float )%f)\n", this, flVolume);
-  this->internal->SetVolume(flVolume);
-  
+  static ProfilePoint point("ISteamMusic::SetVolume");
+  return Forward<Method_SetVolume>::call(&point, this->internal, flVolume);
 }
 
 
 float  ISteamMusic_::GetVolume()
 {
-  TRACE("((ISteamMusic *)%p)\n", this);
-  float  result = this->internal->GetVolume();
-  TRACE("() = (float )%f\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusic::GetVolume");
+  return Forward<Method_GetVolume>::call(&point, this->internal);
 }
 ISteamMusic_::ISteamMusic_(ISteamMusic * towrap)
 {
@@ -1,322 +1,259 @@
 #include <steam_api_.h>
+FORWARD_METHOD(RegisterSteamMusicRemote);
+FORWARD_METHOD(DeregisterSteamMusicRemote);
+FORWARD_METHOD(BIsCurrentMusicRemote);
+FORWARD_METHOD(BActivationSuccess);
+FORWARD_METHOD(SetDisplayName);
+FORWARD_METHOD(SetPNGIcon_64x64);
+FORWARD_METHOD(EnablePlayPrevious);
+FORWARD_METHOD(EnablePlayNext);
+FORWARD_METHOD(EnableShuffled);
+FORWARD_METHOD(EnableLooped);
+FORWARD_METHOD(EnableQueue);
+FORWARD_METHOD(EnablePlaylists);
+FORWARD_METHOD(UpdatePlaybackStatus);
+FORWARD_METHOD(UpdateShuffled);
+FORWARD_METHOD(UpdateLooped);
+FORWARD_METHOD(UpdateVolume);
+FORWARD_METHOD(CurrentEntryWillChange);
+FORWARD_METHOD(CurrentEntryIsAvailable);
+FORWARD_METHOD(UpdateCurrentEntryText);
+FORWARD_METHOD(UpdateCurrentEntryElapsedSeconds);
+FORWARD_METHOD(UpdateCurrentEntryCoverArt);
+FORWARD_METHOD(CurrentEntryDidChange);
+FORWARD_METHOD(QueueWillChange);
+FORWARD_METHOD(ResetQueueEntries);
+FORWARD_METHOD(SetQueueEntry);
+FORWARD_METHOD(SetCurrentQueueEntry);
+FORWARD_METHOD(QueueDidChange);
+FORWARD_METHOD(PlaylistWillChange);
+FORWARD_METHOD(ResetPlaylistEntries);
+FORWARD_METHOD(SetPlaylistEntry);
+FORWARD_METHOD(SetCurrentPlaylistEntry);
+FORWARD_METHOD(PlaylistDidChange);
+
 
 bool  ISteamMusicRemote_::RegisterSteamMusicRemote(char * pchName)
 {
-  TRACE("((ISteamMusicRemote *)%p, (char *)\"%s\")\n", this, pchName);
-  bool  result = this->internal->RegisterSteamMusicRemote(pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::RegisterSteamMusicRemote");
+  return Forward<Method_RegisterSteamMusicRemote>::call(&point, this->internal, pchName);
 }
 
 
 bool  ISteamMusicRemote_::DeregisterSteamMusicRemote()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->DeregisterSteamMusicRemote();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::DeregisterSteamMusicRemote");
+  return Forward<Method_DeregisterSteamMusicRemote>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::BIsCurrentMusicRemote()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->BIsCurrentMusicRemote();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::BIsCurrentMusicRemote");
+  return Forward<Method_BIsCurrentMusicRemote>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::BActivationSuccess(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->BActivationSuccess(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::BActivationSuccess");
+  return Forward<Method_BActivationSuccess>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::SetDisplayName(char * pchDisplayName)
 {
-  TRACE("((ISteamMusicRemote *)%p, (char *)\"%s\")\n", this, pchDisplayName);
-  bool  result = this->internal->SetDisplayName(pchDisplayName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::SetDisplayName");
+  return Forward<Method_SetDisplayName>::call(&point, this->internal, pchDisplayName);
 }
 
 
 bool  ISteamMusicRemote_::SetPNGIcon_64x64(void * pvBuffer, uint32  cbBufferLength)
 {
-  TRACE("((ISteamMusicRemote *)%p, (void *)%p, (uint32 )%d)\n", this, pvBuffer, cbBufferLength);
-  bool  result = this->internal->SetPNGIcon_64x64(pvBuffer, cbBufferLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::SetPNGIcon_64x64", "1:2");
+  return Forward<Method_SetPNGIcon_64x64>::call(&point, this->internal, pvBuffer, cbBufferLength);
 }
 
 
 bool  ISteamMusicRemote_::EnablePlayPrevious(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->EnablePlayPrevious(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::EnablePlayPrevious");
+  return Forward<Method_EnablePlayPrevious>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::EnablePlayNext(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->EnablePlayNext(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::EnablePlayNext");
+  return Forward<Method_EnablePlayNext>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::EnableShuffled(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->EnableShuffled(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::EnableShuffled");
+  return Forward<Method_EnableShuffled>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::EnableLooped(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->EnableLooped(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::EnableLooped");
+  return Forward<Method_EnableLooped>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::EnableQueue(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->EnableQueue(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::EnableQueue");
+  return Forward<Method_EnableQueue>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::EnablePlaylists(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->EnablePlaylists(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::EnablePlaylists");
+  return Forward<Method_EnablePlaylists>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::UpdatePlaybackStatus(AudioPlayback_Status  nStatus)
 {
-  TRACE("((ISteamMusicRemote *)%p, (AudioPlayback_Status )%p)\n", this, nStatus);
-  bool  result = this->internal->UpdatePlaybackStatus(nStatus);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::UpdatePlaybackStatus");
+  return Forward<Method_UpdatePlaybackStatus>::call(&point, this->internal, nStatus);
 }
 
 
 bool  ISteamMusicRemote_::UpdateShuffled(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->UpdateShuffled(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::UpdateShuffled");
+  return Forward<Method_UpdateShuffled>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::UpdateLooped(bool  bValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bValue);
-  bool  result = this->internal->UpdateLooped(bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::UpdateLooped");
+  return Forward<Method_UpdateLooped>::call(&point, this->internal, bValue);
 }
 
 
 bool  ISteamMusicRemote_::UpdateVolume(float  flValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (float )%f)\n", this, flValue);
-  bool  result = this->internal->UpdateVolume(flValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::UpdateVolume");
+  return Forward<Method_UpdateVolume>::call(&point, this->internal, flValue);
 }
 
 
 bool  ISteamMusicRemote_::CurrentEntryWillChange()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->CurrentEntryWillChange();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::CurrentEntryWillChange");
+  return Forward<Method_CurrentEntryWillChange>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::CurrentEntryIsAvailable(bool  bAvailable)
 {
-  TRACE("((ISteamMusicRemote *)%p, (bool )%d)\n", this, bAvailable);
-  bool  result = this->internal->CurrentEntryIsAvailable(bAvailable);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::CurrentEntryIsAvailable");
+  return Forward<Method_CurrentEntryIsAvailable>::call(&point, this->internal, bAvailable);
 }
 
 
 bool  ISteamMusicRemote_::UpdateCurrentEntryText(char * pchText)
 {
-  TRACE("((ISteamMusicRemote *)%p, (char *)\"%s\")\n", this, pchText);
-  bool  result = this->internal->UpdateCurrentEntryText(pchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::UpdateCurrentEntryText");
+  return Forward<Method_UpdateCurrentEntryText>::call(&point, this->internal, pchText);
 }
 
 
 bool  ISteamMusicRemote_::UpdateCurrentEntryElapsedSeconds(int  nValue)
 {
-  TRACE("((ISteamMusicRemote *)%p, (int )%d)\n", this, nValue);
-  bool  result = this->internal->UpdateCurrentEntryElapsedSeconds(nValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::UpdateCurrentEntryElapsedSeconds");
+  return Forward<Method_UpdateCurrentEntryElapsedSeconds>::call(&point, this->internal, nValue);
 }
 
 
 bool  ISteamMusicRemote_::UpdateCurrentEntryCoverArt(void * pvBuffer, uint32  cbBufferLength)
 {
-  TRACE("((ISteamMusicRemote *)%p, (void *)%p, (uint32 )%d)\n", this, pvBuffer, cbBufferLength);
-  bool  result = this->internal->UpdateCurrentEntryCoverArt(pvBuffer, cbBufferLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::UpdateCurrentEntryCoverArt", "1:2");
+  return Forward<Method_UpdateCurrentEntryCoverArt>::call(&point, this->internal, pvBuffer, cbBufferLength);
 }
 
 
 bool  ISteamMusicRemote_::CurrentEntryDidChange()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->CurrentEntryDidChange();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::CurrentEntryDidChange");
+  return Forward<Method_CurrentEntryDidChange>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::QueueWillChange()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->QueueWillChange();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::QueueWillChange");
+  return Forward<Method_QueueWillChange>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::ResetQueueEntries()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->ResetQueueEntries();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::ResetQueueEntries");
+  return Forward<Method_ResetQueueEntries>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::SetQueueEntry(int  nID, int  nPosition, char * pchEntryText)
 {
-  TRACE("((ISteamMusicRemote *)%p, (int )%d, (int )%d, (char *)\"%s\")\n", this, nID, nPosition, pchEntryText);
-  bool  result = this->internal->SetQueueEntry(nID, nPosition, pchEntryText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::SetQueueEntry");
+  return Forward<Method_SetQueueEntry>::call(&point, this->internal, nID, nPosition, pchEntryText);
 }
 
 
 bool  ISteamMusicRemote_::SetCurrentQueueEntry(int  nID)
 {
-  TRACE("((ISteamMusicRemote *)%p, (int )%d)\n", this, nID);
-  bool  result = this->internal->SetCurrentQueueEntry(nID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::SetCurrentQueueEntry");
+  return Forward<Method_SetCurrentQueueEntry>::call(&point, this->internal, nID);
 }
 
 
 bool  ISteamMusicRemote_::QueueDidChange()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->QueueDidChange();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::QueueDidChange");
+  return Forward<Method_QueueDidChange>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::PlaylistWillChange()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->PlaylistWillChange();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::PlaylistWillChange");
+  return Forward<Method_PlaylistWillChange>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::ResetPlaylistEntries()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->ResetPlaylistEntries();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::ResetPlaylistEntries");
+  return Forward<Method_ResetPlaylistEntries>::call(&point, this->internal);
 }
 
 
 bool  ISteamMusicRemote_::SetPlaylistEntry(int  nID, int  nPosition, char * pchEntryText)
 {
-  TRACE("((ISteamMusicRemote *)%p, (int )%d, (int )%d, (char *)\"%s\")\n", this, nID, nPosition, pchEntryText);
-  bool  result = this->internal->SetPlaylistEntry(nID, nPosition, pchEntryText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::SetPlaylistEntry");
+  return Forward<Method_SetPlaylistEntry>::call(&point, this->internal, nID, nPosition, pchEntryText);
 }
 
 
 bool  ISteamMusicRemote_::SetCurrentPlaylistEntry(int  nID)
 {
-  TRACE("((ISteamMusicRemote *)%p, (int )%d)\n", this, nID);
-  bool  result = this->internal->SetCurrentPlaylistEntry(nID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::SetCurrentPlaylistEntry");
+  return Forward<Method_SetCurrentPlaylistEntry>::call(&point, this->internal, nID);
 }
 
 
 bool  ISteamMusicRemote_::PlaylistDidChange()
 {
-  TRACE("((ISteamMusicRemote *)%p)\n", this);
-  bool  result = this->internal->PlaylistDidChange();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamMusicRemote::PlaylistDidChange");
+  return Forward<Method_PlaylistDidChange>::call(&point, this->internal);
 }
 ISteamMusicRemote_::ISteamMusicRemote_(ISteamMusicRemote * towrap)
 {
@@ -1,222 +1,211 @@
 #include <steam_api_.h>
+FORWARD_METHOD(SendP2PPacket);
+FORWARD_METHOD(IsP2PPacketAvailable);
+FORWARD_METHOD(ReadP2PPacket);
+FORWARD_METHOD(AcceptP2PSessionWithUser);
+FORWARD_METHOD(CloseP2PSessionWithUser);
+FORWARD_METHOD(CloseP2PChannelWithUser);
+FORWARD_METHOD(GetP2PSessionState);
+FORWARD_METHOD(AllowP2PPacketRelay);
+FORWARD_METHOD(CreateListenSocket);
+FORWARD_METHOD(CreateP2PConnectionSocket);
+FORWARD_METHOD(CreateConnectionSocket);
+FORWARD_METHOD(DestroySocket);
+FORWARD_METHOD(DestroyListenSocket);
+FORWARD_METHOD(SendDataOnSocket);
+FORWARD_METHOD(IsDataAvailableOnSocket);
+FORWARD_METHOD(RetrieveDataFromSocket);
+FORWARD_METHOD(IsDataAvailable);
+FORWARD_METHOD(RetrieveData);
+FORWARD_METHOD(GetSocketInfo);
+FORWARD_METHOD(GetListenSocketInfo);
+FORWARD_METHOD(GetSocketConnectionType);
+FORWARD_METHOD(GetMaxPacketSize);
+
 
 bool  ISteamNetworking_::SendP2PPacket(CSteamID  steamIDRemote, void * pubData, uint32  cubData, EP2PSend  eP2PSendType, int  nChannel)
 {
-  TRACE("((ISteamNetworking *)%p, (CSteamID )%p, (void *)%p, (uint32 )%d, (EP2PSend )%p, (int )%d)\n", this, steamIDRemote, pubData, cubData, eP2PSendType, nChannel);
-  bool  result = this->internal->SendP2PPacket(steamIDRemote, pubData, cubData, eP2PSendType, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
+  static ProfilePoint point("ISteamNetworking::SendP2PPacket", "2:3");
+  bool result = Forward<Method_SendP2PPacket, true>::call(&point, this->internal, steamIDRemote, pubData, cubData, eP2PSendType, nChannel);
+  if (netStatsEnabled || captureEnabled)
+    netSendP2PPacket(steamIDRemote, pubData, cubData, eP2PSendType, nChannel, result);
   return result;
 }
 
 
 bool  ISteamNetworking_::IsP2PPacketAvailable(uint32 * pcubMsgSize, int  nChannel)
 {
-  TRACE("((ISteamNetworking *)%p, (uint32 *)%d, (int )%d)\n", this, pcubMsgSize, nChannel);
-  bool  result = this->internal->IsP2PPacketAvailable(pcubMsgSize, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::IsP2PPacketAvailable");
+  if (p2pBatchEnabled)
+    return p2pIsPacketAvailable(&point, this->internal, pcubMsgSize, nChannel);
+  return Forward<Method_IsP2PPacketAvailable, true>::call(&point, this->internal, pcubMsgSize, nChannel);
 }
 
 
 bool  ISteamNetworking_::ReadP2PPacket(void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, CSteamID * psteamIDRemote, int  nChannel)
 {
-  TRACE("((ISteamNetworking *)%p, (void *)%p, (uint32 )%d, (uint32 *)%d, (CSteamID *)%p, (int )%d)\n", this, pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
-  bool  result = this->internal->ReadP2PPacket(pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
+  static ProfilePoint point("ISteamNetworking::ReadP2PPacket", "1:2");
+  if (p2pBatchEnabled)
+    return p2pReadPacket(&point, this->internal, pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
+  bool result = Forward<Method_ReadP2PPacket, true>::call(&point, this->internal, pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
+  if (netStatsEnabled || captureEnabled)
+    netReadP2PPacket(pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel, result);
   return result;
 }
 
 
 bool  ISteamNetworking_::AcceptP2PSessionWithUser(CSteamID  steamIDRemote)
 {
-  TRACE("((ISteamNetworking *)%p, (CSteamID )%p)\n", this, steamIDRemote);
-  bool  result = this->internal->AcceptP2PSessionWithUser(steamIDRemote);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::AcceptP2PSessionWithUser");
+  if (sessionCacheEnabled)
+    return sessionAcceptP2PSessionWithUser(&point, this->internal, steamIDRemote);
+  return Forward<Method_AcceptP2PSessionWithUser, true>::call(&point, this->internal, steamIDRemote);
 }
 
 
 bool  ISteamNetworking_::CloseP2PSessionWithUser(CSteamID  steamIDRemote)
 {
-  TRACE("((ISteamNetworking *)%p, (CSteamID )%p)\n", this, steamIDRemote);
-  bool  result = this->internal->CloseP2PSessionWithUser(steamIDRemote);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::CloseP2PSessionWithUser");
+  if (sessionCacheEnabled)
+    return sessionCloseP2PSessionWithUser(&point, this->internal, steamIDRemote);
+  return Forward<Method_CloseP2PSessionWithUser, true>::call(&point, this->internal, steamIDRemote);
 }
 
 
 bool  ISteamNetworking_::CloseP2PChannelWithUser(CSteamID  steamIDRemote, int  nChannel)
 {
-  TRACE("((ISteamNetworking *)%p, (CSteamID )%p, (int )%d)\n", this, steamIDRemote, nChannel);
-  bool  result = this->internal->CloseP2PChannelWithUser(steamIDRemote, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::CloseP2PChannelWithUser");
+  if (sessionCacheEnabled)
+    return sessionCloseP2PChannelWithUser(&point, this->internal, steamIDRemote, nChannel);
+  return Forward<Method_CloseP2PChannelWithUser, true>::call(&point, this->internal, steamIDRemote, nChannel);
 }
 
 
 bool  ISteamNetworking_::GetP2PSessionState(CSteamID  steamIDRemote, P2PSessionState_t * pConnectionState)
 {
-  TRACE("((ISteamNetworking *)%p, (CSteamID )%p, (P2PSessionState_t *)%p)\n", this, steamIDRemote, pConnectionState);
-  bool  result = this->internal->GetP2PSessionState(steamIDRemote, pConnectionState);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::GetP2PSessionState");
+  if (sessionCacheEnabled)
+    return sessionGetP2PSessionState(&point, this->internal, steamIDRemote, pConnectionState);
+  return Forward<Method_GetP2PSessionState, true>::call(&point, this->internal, steamIDRemote, pConnectionState);
 }
 
 
 bool  ISteamNetworking_::AllowP2PPacketRelay(bool  bAllow)
 {
-  TRACE("((ISteamNetworking *)%p, (bool )%d)\n", this, bAllow);
-  bool  result = this->internal->AllowP2PPacketRelay(bAllow);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::AllowP2PPacketRelay");
+  return Forward<Method_AllowP2PPacketRelay, true>::call(&point, this->internal, bAllow);
 }
 
 
 SNetListenSocket_t  ISteamNetworking_::CreateListenSocket(int  nVirtualP2PPort, uint32  nIP, uint16  nPort, bool  bAllowUseOfPacketRelay)
 {
-  TRACE("((ISteamNetworking *)%p, (int )%d, (uint32 )%d, (uint16 )%d, (bool )%d)\n", this, nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
-  SNetListenSocket_t  result = this->internal->CreateListenSocket(nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
-  TRACE("() = (SNetListenSocket_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::CreateListenSocket");
+  if (socketPollEnabled)
+    return socketCreateListenSocket(&point, this->internal, nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
+  return Forward<Method_CreateListenSocket, true>::call(&point, this->internal, nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
 }
 
 
 SNetSocket_t  ISteamNetworking_::CreateP2PConnectionSocket(CSteamID  steamIDTarget, int  nVirtualPort, int  nTimeoutSec, bool  bAllowUseOfPacketRelay)
 {
-  TRACE("((ISteamNetworking *)%p, (CSteamID )%p, (int )%d, (int )%d, (bool )%d)\n", this, steamIDTarget, nVirtualPort, nTimeoutSec, bAllowUseOfPacketRelay);
-  SNetSocket_t  result = this->internal->CreateP2PConnectionSocket(steamIDTarget, nVirtualPort, nTimeoutSec, bAllowUseOfPacketRelay);
-  TRACE("() = (SNetSocket_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::CreateP2PConnectionSocket");
+  return Forward<Method_CreateP2PConnectionSocket, true>::call(&point, this->internal, steamIDTarget, nVirtualPort, nTimeoutSec, bAllowUseOfPacketRelay);
 }
 
 
 SNetSocket_t  ISteamNetworking_::CreateConnectionSocket(uint32  nIP, uint16  nPort, int  nTimeoutSec)
 {
-  TRACE("((ISteamNetworking *)%p, (uint32 )%d, (uint16 )%d, (int )%d)\n", this, nIP, nPort, nTimeoutSec);
-  SNetSocket_t  result = this->internal->CreateConnectionSocket(nIP, nPort, nTimeoutSec);
-  TRACE("() = (SNetSocket_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::CreateConnectionSocket");
+  return Forward<Method_CreateConnectionSocket, true>::call(&point, this->internal, nIP, nPort, nTimeoutSec);
 }
 
 
 bool  ISteamNetworking_::DestroySocket(SNetSocket_t  hSocket, bool  bNotifyRemoteEnd)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetSocket_t )%p, (bool )%d)\n", this, hSocket, bNotifyRemoteEnd);
-  bool  result = this->internal->DestroySocket(hSocket, bNotifyRemoteEnd);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::DestroySocket");
+  if (socketPollEnabled)
+    return socketDestroySocket(&point, this->internal, hSocket, bNotifyRemoteEnd);
+  return Forward<Method_DestroySocket, true>::call(&point, this->internal, hSocket, bNotifyRemoteEnd);
 }
 
 
 bool  ISteamNetworking_::DestroyListenSocket(SNetListenSocket_t  hSocket, bool  bNotifyRemoteEnd)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetListenSocket_t )%p, (bool )%d)\n", this, hSocket, bNotifyRemoteEnd);
-  bool  result = this->internal->DestroyListenSocket(hSocket, bNotifyRemoteEnd);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::DestroyListenSocket");
+  if (socketPollEnabled)
+    return socketDestroyListenSocket(&point, this->internal, hSocket, bNotifyRemoteEnd);
+  return Forward<Method_DestroyListenSocket, true>::call(&point, this->internal, hSocket, bNotifyRemoteEnd);
 }
 
 
 bool  ISteamNetworking_::SendDataOnSocket(SNetSocket_t  hSocket, void * pubData, uint32  cubData, bool  bReliable)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetSocket_t )%p, (void *)%p, (uint32 )%d, (bool )%d)\n", this, hSocket, pubData, cubData, bReliable);
-  bool  result = this->internal->SendDataOnSocket(hSocket, pubData, cubData, bReliable);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::SendDataOnSocket", "2:3");
+  return Forward<Method_SendDataOnSocket, true>::call(&point, this->internal, hSocket, pubData, cubData, bReliable);
 }
 
 
 bool  ISteamNetworking_::IsDataAvailableOnSocket(SNetSocket_t  hSocket, uint32 * pcubMsgSize)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetSocket_t )%p, (uint32 *)%d)\n", this, hSocket, pcubMsgSize);
-  bool  result = this->internal->IsDataAvailableOnSocket(hSocket, pcubMsgSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::IsDataAvailableOnSocket");
+  if (socketPollEnabled)
+    return socketIsDataAvailableOnSocket(&point, this->internal, hSocket, pcubMsgSize);
+  return Forward<Method_IsDataAvailableOnSocket, true>::call(&point, this->internal, hSocket, pcubMsgSize);
 }
 
 
 bool  ISteamNetworking_::RetrieveDataFromSocket(SNetSocket_t  hSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetSocket_t )%p, (void *)%p, (uint32 )%d, (uint32 *)%d)\n", this, hSocket, pubDest, cubDest, pcubMsgSize);
-  bool  result = this->internal->RetrieveDataFromSocket(hSocket, pubDest, cubDest, pcubMsgSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::RetrieveDataFromSocket", "2:3");
+  if (socketPollEnabled)
+    return socketRetrieveDataFromSocket(&point, this->internal, hSocket, pubDest, cubDest, pcubMsgSize);
+  return Forward<Method_RetrieveDataFromSocket, true>::call(&point, this->internal, hSocket, pubDest, cubDest, pcubMsgSize);
 }
 
 
 bool  ISteamNetworking_::IsDataAvailable(SNetListenSocket_t  hListenSocket, uint32 * pcubMsgSize, SNetSocket_t * phSocket)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetListenSocket_t )%p, (uint32 *)%d, (SNetSocket_t *)%p)\n", this, hListenSocket, pcubMsgSize, phSocket);
-  bool  result = this->internal->IsDataAvailable(hListenSocket, pcubMsgSize, phSocket);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::IsDataAvailable");
+  if (socketPollEnabled)
+    return socketIsDataAvailable(&point, this->internal, hListenSocket, pcubMsgSize, phSocket);
+  return Forward<Method_IsDataAvailable, true>::call(&point, this->internal, hListenSocket, pcubMsgSize, phSocket);
 }
 
 
 bool  ISteamNetworking_::RetrieveData(SNetListenSocket_t  hListenSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, SNetSocket_t * phSocket)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetListenSocket_t )%p, (void *)%p, (uint32 )%d, (uint32 *)%d, (SNetSocket_t *)%p)\n", this, hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
-  bool  result = this->internal->RetrieveData(hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::RetrieveData", "2:3");
+  if (socketPollEnabled)
+    return socketRetrieveData(&point, this->internal, hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
+  return Forward<Method_RetrieveData, true>::call(&point, this->internal, hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
 }
 
 
 bool  ISteamNetworking_::GetSocketInfo(SNetSocket_t  hSocket, CSteamID * pSteamIDRemote, int * peSocketStatus, uint32 * punIPRemote, uint16 * punPortRemote)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetSocket_t )%p, (CSteamID *)%p, (int *)%d, (uint32 *)%d, (uint16 *)%d)\n", this, hSocket, pSteamIDRemote, peSocketStatus, punIPRemote, punPortRemote);
-  bool  result = this->internal->GetSocketInfo(hSocket, pSteamIDRemote, peSocketStatus, punIPRemote, punPortRemote);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::GetSocketInfo");
+  return Forward<Method_GetSocketInfo, true>::call(&point, this->internal, hSocket, pSteamIDRemote, peSocketStatus, punIPRemote, punPortRemote);
 }
 
 
 bool  ISteamNetworking_::GetListenSocketInfo(SNetListenSocket_t  hListenSocket, uint32 * pnIP, uint16 * pnPort)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetListenSocket_t )%p, (uint32 *)%d, (uint16 *)%d)\n", this, hListenSocket, pnIP, pnPort);
-  bool  result = this->internal->GetListenSocketInfo(hListenSocket, pnIP, pnPort);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::GetListenSocketInfo");
+  return Forward<Method_GetListenSocketInfo, true>::call(&point, this->internal, hListenSocket, pnIP, pnPort);
 }
 
 
 ESNetSocketConnectionType  ISteamNetworking_::GetSocketConnectionType(SNetSocket_t  hSocket)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetSocket_t )%p)\n", this, hSocket);
-  ESNetSocketConnectionType  result = this->internal->GetSocketConnectionType(hSocket);
-  TRACE("() = (ESNetSocketConnectionType )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::GetSocketConnectionType");
+  return Forward<Method_GetSocketConnectionType, true>::call(&point, this->internal, hSocket);
 }
 
 
 int  ISteamNetworking_::GetMaxPacketSize(SNetSocket_t  hSocket)
 {
-  TRACE("((ISteamNetworking *)%p, (SNetSocket_t )%p)\n", this, hSocket);
-  int  result = this->internal->GetMaxPacketSize(hSocket);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamNetworking::GetMaxPacketSize");
+  return Forward<Method_GetMaxPacketSize, true>::call(&point, this->internal, hSocket);
 }
 ISteamNetworking_::ISteamNetworking_(ISteamNetworking * towrap)
 {
@@ -1,88 +1,75 @@
 #include <steam_api_.h>
+FORWARD_METHOD(WriteScreenshot);
+FORWARD_METHOD(AddScreenshotToLibrary);
+FORWARD_METHOD(TriggerScreenshot);
+FORWARD_METHOD(HookScreenshots);
+FORWARD_METHOD(SetLocation);
+FORWARD_METHOD(TagUser);
+FORWARD_METHOD(TagPublishedFile);
+FORWARD_METHOD(IsScreenshotsHooked);
+FORWARD_METHOD(AddVRScreenshotToLibrary);
+
 
 ScreenshotHandle  ISteamScreenshots_::WriteScreenshot(void * pubRGB, uint32  cubRGB, int  nWidth, int  nHeight)
 {
-  TRACE("((ISteamScreenshots *)%p, (void *)%p, (uint32 )%d, (int )%d, (int )%d)\n", this, pubRGB, cubRGB, nWidth, nHeight);
-  ScreenshotHandle  result = this->internal->WriteScreenshot(pubRGB, cubRGB, nWidth, nHeight);
-  TRACE("() = (ScreenshotHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamScreenshots::WriteScreenshot", "1:2");
+  return Forward<Method_WriteScreenshot>::call(&point, this->internal, pubRGB, cubRGB, nWidth, nHeight);
 }
 
 
 ScreenshotHandle  ISteamScreenshots_::AddScreenshotToLibrary(char * pchFilename, char * pchThumbnailFilename, int  nWidth, int  nHeight)
 {
-  TRACE("((ISteamScreenshots *)%p, (char *)\"%s\", (char *)\"%s\", (int )%d, (int )%d)\n", this, pchFilename, pchThumbnailFilename, nWidth, nHeight);
-  ScreenshotHandle  result = this->internal->AddScreenshotToLibrary(pchFilename, pchThumbnailFilename, nWidth, nHeight);
-  TRACE("() = (ScreenshotHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamScreenshots::AddScreenshotToLibrary");
+  return Forward<Method_AddScreenshotToLibrary>::call(&point, this->internal, pchFilename, pchThumbnailFilename, nWidth, nHeight);
 }
 
 
 void  ISteamScreenshots_::TriggerScreenshot()
 {
-  TRACE("((ISteamScreenshots *)%p)\n", this);
-  this->internal->TriggerScreenshot();
-  
+  static ProfilePoint point("ISteamScreenshots::TriggerScreenshot");
+  return Forward<Method_TriggerScreenshot>::call(&point, this->internal);
 }
 
 
 void  ISteamScreenshots_::HookScreenshots(bool  bHook)
 {
-  TRACE("((ISteamScreenshots *)%p, (bool )%d)\n", this, bHook);
-  this->internal->HookScreenshots(bHook);
-  
+  static ProfilePoint point("ISteamScreenshots::HookScreenshots");
+  return Forward<Method_HookScreenshots>::call(&point, this->internal, bHook);
 }
 
 
 bool  ISteamScreenshots_::SetLocation(ScreenshotHandle  hScreenshot, char * pchLocation)
 {
-  TRACE("((ISteamScreenshots *)%p, (ScreenshotHandle )%p, (char *)\"%s\")\n", this, hScreenshot, pchLocation);
-  bool  result = this->internal->SetLocation(hScreenshot, pchLocation);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamScreenshots::SetLocation");
+  return Forward<Method_SetLocation>::call(&point, this->internal, hScreenshot, pchLocation);
 }
 
 
 bool  ISteamScreenshots_::TagUser(ScreenshotHandle  hScreenshot, CSteamID  steamID)
 {
-  TRACE("((ISteamScreenshots *)%p, (ScreenshotHandle )%p, (CSteamID )%p)\n", this, hScreenshot, steamID);
-  bool  result = this->internal->TagUser(hScreenshot, steamID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamScreenshots::TagUser");
+  return Forward<Method_TagUser>::call(&point, this->internal, hScreenshot, steamID);
 }
 
 
 bool  ISteamScreenshots_::TagPublishedFile(ScreenshotHandle  hScreenshot, PublishedFileId_t  unPublishedFileID)
 {
-  TRACE("((ISteamScreenshots *)%p, (ScreenshotHandle )%p, (PublishedFileId_t )%p)\n", this, hScreenshot, unPublishedFileID);
-  bool  result = this->internal->TagPublishedFile(hScreenshot, unPublishedFileID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamScreenshots::TagPublishedFile");
+  return Forward<Method_TagPublishedFile>::call(&point, this->internal, hScreenshot, unPublishedFileID);
 }
 
 
 bool  ISteamScreenshots_::IsScreenshotsHooked()
 {
-  TRACE("((ISteamScreenshots *)%p)\n", this);
-  bool  result = this->internal->IsScreenshotsHooked();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamScreenshots::IsScreenshotsHooked");
+  return Forward<Method_IsScreenshotsHooked>::call(&point, this->internal);
 }
 
 
 ScreenshotHandle  ISteamScreenshots_::AddVRScreenshotToLibrary(EVRScreenshotType  eType, char * pchFilename, char * pchVRFilename)
 {
-  TRACE("((ISteamScreenshots *)%p, (EVRScreenshotType )%p, (char *)\"%s\", (char *)\"%s\")\n", this, eType, pchFilename, pchVRFilename);
-  ScreenshotHandle  result = this->internal->AddVRScreenshotToLibrary(eType, pchFilename, pchVRFilename);
-  TRACE("() = (ScreenshotHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamScreenshots::AddVRScreenshotToLibrary");
+  return Forward<Method_AddVRScreenshotToLibrary>::call(&point, this->internal, eType, pchFilename, pchVRFilename);
 }
 ISteamScreenshots_::ISteamScreenshots_(ISteamScreenshots * towrap)
 {
@@ -1,670 +1,539 @@
 #include <steam_api_.h>
+FORWARD_METHOD(CreateQueryUserUGCRequest);
+FORWARD_METHOD(CreateQueryAllUGCRequest);
+FORWARD_METHOD(CreateQueryUGCDetailsRequest);
+FORWARD_METHOD(SendQueryUGCRequest);
+FORWARD_METHOD(GetQueryUGCResult);
+FORWARD_METHOD(GetQueryUGCPreviewURL);
+FORWARD_METHOD(GetQueryUGCMetadata);
+FORWARD_METHOD(GetQueryUGCChildren);
+FORWARD_METHOD(GetQueryUGCStatistic);
+FORWARD_METHOD(GetQueryUGCNumAdditionalPreviews);
+FORWARD_METHOD(GetQueryUGCAdditionalPreview);
+FORWARD_METHOD(GetQueryUGCNumKeyValueTags);
+FORWARD_METHOD(GetQueryUGCKeyValueTag);
+FORWARD_METHOD(ReleaseQueryUGCRequest);
+FORWARD_METHOD(AddRequiredTag);
+FORWARD_METHOD(AddExcludedTag);
+FORWARD_METHOD(SetReturnOnlyIDs);
+FORWARD_METHOD(SetReturnKeyValueTags);
+FORWARD_METHOD(SetReturnLongDescription);
+FORWARD_METHOD(SetReturnMetadata);
+FORWARD_METHOD(SetReturnChildren);
+FORWARD_METHOD(SetReturnAdditionalPreviews);
+FORWARD_METHOD(SetReturnTotalOnly);
+FORWARD_METHOD(SetLanguage);
+FORWARD_METHOD(SetAllowCachedResponse);
+FORWARD_METHOD(SetCloudFileNameFilter);
+FORWARD_METHOD(SetMatchAnyTag);
+FORWARD_METHOD(SetSearchText);
+FORWARD_METHOD(SetRankedByTrendDays);
+FORWARD_METHOD(AddRequiredKeyValueTag);
+FORWARD_METHOD(RequestUGCDetails);
+FORWARD_METHOD(CreateItem);
+FORWARD_METHOD(StartItemUpdate);
+FORWARD_METHOD(SetItemTitle);
+FORWARD_METHOD(SetItemDescription);
+FORWARD_METHOD(SetItemUpdateLanguage);
+FORWARD_METHOD(SetItemMetadata);
+FORWARD_METHOD(SetItemVisibility);
+FORWARD_METHOD(SetItemTags);
+FORWARD_METHOD(SetItemContent);
+FORWARD_METHOD(SetItemPreview);
+FORWARD_METHOD(RemoveItemKeyValueTags);
+FORWARD_METHOD(AddItemKeyValueTag);
+FORWARD_METHOD(AddItemPreviewFile);
+FORWARD_METHOD(AddItemPreviewVideo);
+FORWARD_METHOD(UpdateItemPreviewFile);
+FORWARD_METHOD(UpdateItemPreviewVideo);
+FORWARD_METHOD(RemoveItemPreview);
+FORWARD_METHOD(SubmitItemUpdate);
+FORWARD_METHOD(GetItemUpdateProgress);
+FORWARD_METHOD(SetUserItemVote);
+FORWARD_METHOD(GetUserItemVote);
+FORWARD_METHOD(AddItemToFavorites);
+FORWARD_METHOD(RemoveItemFromFavorites);
+FORWARD_METHOD(SubscribeItem);
+FORWARD_METHOD(UnsubscribeItem);
+FORWARD_METHOD(GetNumSubscribedItems);
+FORWARD_METHOD(GetSubscribedItems);
+FORWARD_METHOD(GetItemState);
+FORWARD_METHOD(GetItemInstallInfo);
+FORWARD_METHOD(GetItemDownloadInfo);
+FORWARD_METHOD(DownloadItem);
+FORWARD_METHOD(BInitWorkshopForGameServer);
+FORWARD_METHOD(SuspendDownloads);
+FORWARD_METHOD(StartPlaytimeTracking);
+FORWARD_METHOD(StopPlaytimeTracking);
+FORWARD_METHOD(StopPlaytimeTrackingForAllItems);
+
 
 UGCQueryHandle_t  ISteamUGC_::CreateQueryUserUGCRequest(AccountID_t  unAccountID, EUserUGCList  eListType, EUGCMatchingUGCType  eMatchingUGCType, EUserUGCListSortOrder  eSortOrder, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
 {
-  TRACE("((ISteamUGC *)%p, (AccountID_t )%p, (EUserUGCList )%p, (EUGCMatchingUGCType )%p, (EUserUGCListSortOrder )%p, (AppId_t )%p, (AppId_t )%p, (uint32 )%d)\n", this, unAccountID, eListType, eMatchingUGCType, eSortOrder, nCreatorAppID, nConsumerAppID, unPage);
-  UGCQueryHandle_t  result = this->internal->CreateQueryUserUGCRequest(unAccountID, eListType, eMatchingUGCType, eSortOrder, nCreatorAppID, nConsumerAppID, unPage);
-  TRACE("() = (UGCQueryHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::CreateQueryUserUGCRequest");
+  return Forward<Method_CreateQueryUserUGCRequest>::call(&point, this->internal, unAccountID, eListType, eMatchingUGCType, eSortOrder, nCreatorAppID, nConsumerAppID, unPage);
 }
 
 
 UGCQueryHandle_t  ISteamUGC_::CreateQueryAllUGCRequest(EUGCQuery  eQueryType, EUGCMatchingUGCType  eMatchingeMatchingUGCTypeFileType, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
 {
-  TRACE("((ISteamUGC *)%p, (EUGCQuery )%p, (EUGCMatchingUGCType )%p, (AppId_t )%p, (AppId_t )%p, (uint32 )%d)\n", this, eQueryType, eMatchingeMatchingUGCTypeFileType, nCreatorAppID, nConsumerAppID, unPage);
-  UGCQueryHandle_t  result = this->internal->CreateQueryAllUGCRequest(eQueryType, eMatchingeMatchingUGCTypeFileType, nCreatorAppID, nConsumerAppID, unPage);
-  TRACE("() = (UGCQueryHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::CreateQueryAllUGCRequest");
+  return Forward<Method_CreateQueryAllUGCRequest>::call(&point, this->internal, eQueryType, eMatchingeMatchingUGCTypeFileType, nCreatorAppID, nConsumerAppID, unPage);
 }
 
 
 UGCQueryHandle_t  ISteamUGC_::CreateQueryUGCDetailsRequest(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t *)%p, (uint32 )%d)\n", this, pvecPublishedFileID, unNumPublishedFileIDs);
-  UGCQueryHandle_t  result = this->internal->CreateQueryUGCDetailsRequest(pvecPublishedFileID, unNumPublishedFileIDs);
-  TRACE("() = (UGCQueryHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::CreateQueryUGCDetailsRequest");
+  return Forward<Method_CreateQueryUGCDetailsRequest>::call(&point, this->internal, pvecPublishedFileID, unNumPublishedFileIDs);
 }
 
 
 SteamAPICall_t  ISteamUGC_::SendQueryUGCRequest(UGCQueryHandle_t  handle)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p)\n", this, handle);
-  SteamAPICall_t  result = this->internal->SendQueryUGCRequest(handle);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SendQueryUGCRequest");
+  return Forward<Method_SendQueryUGCRequest>::call(&point, this->internal, handle);
 }
 
 
 bool  ISteamUGC_::GetQueryUGCResult(UGCQueryHandle_t  handle, uint32  index, SteamUGCDetails_t * pDetails)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d, (SteamUGCDetails_t *)%p)\n", this, handle, index, pDetails);
-  bool  result = this->internal->GetQueryUGCResult(handle, index, pDetails);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCResult");
+  return Forward<Method_GetQueryUGCResult>::call(&point, this->internal, handle, index, pDetails);
 }
 
 
 bool  ISteamUGC_::GetQueryUGCPreviewURL(UGCQueryHandle_t  handle, uint32  index, char * pchURL, uint32  cchURLSize)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d, (char *)\"%s\", (uint32 )%d)\n", this, handle, index, pchURL, cchURLSize);
-  bool  result = this->internal->GetQueryUGCPreviewURL(handle, index, pchURL, cchURLSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCPreviewURL", "3:4");
+  return Forward<Method_GetQueryUGCPreviewURL>::call(&point, this->internal, handle, index, pchURL, cchURLSize);
 }
 
 
 bool  ISteamUGC_::GetQueryUGCMetadata(UGCQueryHandle_t  handle, uint32  index, char * pchMetadata, uint32  cchMetadatasize)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d, (char *)\"%s\", (uint32 )%d)\n", this, handle, index, pchMetadata, cchMetadatasize);
-  bool  result = this->internal->GetQueryUGCMetadata(handle, index, pchMetadata, cchMetadatasize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCMetadata", "3:4");
+  return Forward<Method_GetQueryUGCMetadata>::call(&point, this->internal, handle, index, pchMetadata, cchMetadatasize);
 }
 
 
 bool  ISteamUGC_::GetQueryUGCChildren(UGCQueryHandle_t  handle, uint32  index, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d, (PublishedFileId_t *)%p, (uint32 )%d)\n", this, handle, index, pvecPublishedFileID, cMaxEntries);
-  bool  result = this->internal->GetQueryUGCChildren(handle, index, pvecPublishedFileID, cMaxEntries);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCChildren");
+  return Forward<Method_GetQueryUGCChildren>::call(&point, this->internal, handle, index, pvecPublishedFileID, cMaxEntries);
 }
 
 
 bool  ISteamUGC_::GetQueryUGCStatistic(UGCQueryHandle_t  handle, uint32  index, EItemStatistic  eStatType, uint64 * pStatValue)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d, (EItemStatistic )%p, (uint64 *)%d)\n", this, handle, index, eStatType, pStatValue);
-  bool  result = this->internal->GetQueryUGCStatistic(handle, index, eStatType, pStatValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCStatistic");
+  return Forward<Method_GetQueryUGCStatistic>::call(&point, this->internal, handle, index, eStatType, pStatValue);
 }
 
 
 uint32  ISteamUGC_::GetQueryUGCNumAdditionalPreviews(UGCQueryHandle_t  handle, uint32  index)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d)\n", this, handle, index);
-  uint32  result = this->internal->GetQueryUGCNumAdditionalPreviews(handle, index);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCNumAdditionalPreviews");
+  return Forward<Method_GetQueryUGCNumAdditionalPreviews>::call(&point, this->internal, handle, index);
 }
 
 
 bool  ISteamUGC_::GetQueryUGCAdditionalPreview(UGCQueryHandle_t  handle, uint32  index, uint32  previewIndex, char * pchURLOrVideoID, uint32  cchURLSize, char * pchOriginalFileName, uint32  cchOriginalFileNameSize, EItemPreviewType * pPreviewType)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d, (uint32 )%d, (char *)\"%s\", (uint32 )%d, (char *)\"%s\", (uint32 )%d, (EItemPreviewType *)%p)\n", this, handle, index, previewIndex, pchURLOrVideoID, cchURLSize, pchOriginalFileName, cchOriginalFileNameSize, pPreviewType);
-  bool  result = this->internal->GetQueryUGCAdditionalPreview(handle, index, previewIndex, pchURLOrVideoID, cchURLSize, pchOriginalFileName, cchOriginalFileNameSize, pPreviewType);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCAdditionalPreview", "4:5 6:7");
+  return Forward<Method_GetQueryUGCAdditionalPreview>::call(&point, this->internal, handle, index, previewIndex, pchURLOrVideoID, cchURLSize, pchOriginalFileName, cchOriginalFileNameSize, pPreviewType);
 }
 
 
 uint32  ISteamUGC_::GetQueryUGCNumKeyValueTags(UGCQueryHandle_t  handle, uint32  index)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d)\n", this, handle, index);
-  uint32  result = this->internal->GetQueryUGCNumKeyValueTags(handle, index);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCNumKeyValueTags");
+  return Forward<Method_GetQueryUGCNumKeyValueTags>::call(&point, this->internal, handle, index);
 }
 
 
 bool  ISteamUGC_::GetQueryUGCKeyValueTag(UGCQueryHandle_t  handle, uint32  index, uint32  keyValueTagIndex, char * pchKey, uint32  cchKeySize, char * pchValue, uint32  cchValueSize)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d, (uint32 )%d, (char *)\"%s\", (uint32 )%d, (char *)\"%s\", (uint32 )%d)\n", this, handle, index, keyValueTagIndex, pchKey, cchKeySize, pchValue, cchValueSize);
-  bool  result = this->internal->GetQueryUGCKeyValueTag(handle, index, keyValueTagIndex, pchKey, cchKeySize, pchValue, cchValueSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetQueryUGCKeyValueTag", "4:5 6:7");
+  return Forward<Method_GetQueryUGCKeyValueTag>::call(&point, this->internal, handle, index, keyValueTagIndex, pchKey, cchKeySize, pchValue, cchValueSize);
 }
 
 
 bool  ISteamUGC_::ReleaseQueryUGCRequest(UGCQueryHandle_t  handle)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p)\n", this, handle);
-  bool  result = this->internal->ReleaseQueryUGCRequest(handle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::ReleaseQueryUGCRequest");
+  return Forward<Method_ReleaseQueryUGCRequest>::call(&point, this->internal, handle);
 }
 
 
 bool  ISteamUGC_::AddRequiredTag(UGCQueryHandle_t  handle, char * pTagName)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", this, handle, pTagName);
-  bool  result = this->internal->AddRequiredTag(handle, pTagName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::AddRequiredTag");
+  return Forward<Method_AddRequiredTag>::call(&point, this->internal, handle, pTagName);
 }
 
 
 bool  ISteamUGC_::AddExcludedTag(UGCQueryHandle_t  handle, char * pTagName)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", this, handle, pTagName);
-  bool  result = this->internal->AddExcludedTag(handle, pTagName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::AddExcludedTag");
+  return Forward<Method_AddExcludedTag>::call(&point, this->internal, handle, pTagName);
 }
 
 
 bool  ISteamUGC_::SetReturnOnlyIDs(UGCQueryHandle_t  handle, bool  bReturnOnlyIDs)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bReturnOnlyIDs);
-  bool  result = this->internal->SetReturnOnlyIDs(handle, bReturnOnlyIDs);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetReturnOnlyIDs");
+  return Forward<Method_SetReturnOnlyIDs>::call(&point, this->internal, handle, bReturnOnlyIDs);
 }
 
 
 bool  ISteamUGC_::SetReturnKeyValueTags(UGCQueryHandle_t  handle, bool  bReturnKeyValueTags)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bReturnKeyValueTags);
-  bool  result = this->internal->SetReturnKeyValueTags(handle, bReturnKeyValueTags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetReturnKeyValueTags");
+  return Forward<Method_SetReturnKeyValueTags>::call(&point, this->internal, handle, bReturnKeyValueTags);
 }
 
 
 bool  ISteamUGC_::SetReturnLongDescription(UGCQueryHandle_t  handle, bool  bReturnLongDescription)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bReturnLongDescription);
-  bool  result = this->internal->SetReturnLongDescription(handle, bReturnLongDescription);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetReturnLongDescription");
+  return Forward<Method_SetReturnLongDescription>::call(&point, this->internal, handle, bReturnLongDescription);
 }
 
 
 bool  ISteamUGC_::SetReturnMetadata(UGCQueryHandle_t  handle, bool  bReturnMetadata)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bReturnMetadata);
-  bool  result = this->internal->SetReturnMetadata(handle, bReturnMetadata);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetReturnMetadata");
+  return Forward<Method_SetReturnMetadata>::call(&point, this->internal, handle, bReturnMetadata);
 }
 
 
 bool  ISteamUGC_::SetReturnChildren(UGCQueryHandle_t  handle, bool  bReturnChildren)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bReturnChildren);
-  bool  result = this->internal->SetReturnChildren(handle, bReturnChildren);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetReturnChildren");
+  return Forward<Method_SetReturnChildren>::call(&point, this->internal, handle, bReturnChildren);
 }
 
 
 bool  ISteamUGC_::SetReturnAdditionalPreviews(UGCQueryHandle_t  handle, bool  bReturnAdditionalPreviews)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bReturnAdditionalPreviews);
-  bool  result = this->internal->SetReturnAdditionalPreviews(handle, bReturnAdditionalPreviews);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetReturnAdditionalPreviews");
+  return Forward<Method_SetReturnAdditionalPreviews>::call(&point, this->internal, handle, bReturnAdditionalPreviews);
 }
 
 
 bool  ISteamUGC_::SetReturnTotalOnly(UGCQueryHandle_t  handle, bool  bReturnTotalOnly)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bReturnTotalOnly);
-  bool  result = this->internal->SetReturnTotalOnly(handle, bReturnTotalOnly);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetReturnTotalOnly");
+  return Forward<Method_SetReturnTotalOnly>::call(&point, this->internal, handle, bReturnTotalOnly);
 }
 
 
 bool  ISteamUGC_::SetLanguage(UGCQueryHandle_t  handle, char * pchLanguage)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", this, handle, pchLanguage);
-  bool  result = this->internal->SetLanguage(handle, pchLanguage);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetLanguage");
+  return Forward<Method_SetLanguage>::call(&point, this->internal, handle, pchLanguage);
 }
 
 
 bool  ISteamUGC_::SetAllowCachedResponse(UGCQueryHandle_t  handle, uint32  unMaxAgeSeconds)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d)\n", this, handle, unMaxAgeSeconds);
-  bool  result = this->internal->SetAllowCachedResponse(handle, unMaxAgeSeconds);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetAllowCachedResponse");
+  return Forward<Method_SetAllowCachedResponse>::call(&point, this->internal, handle, unMaxAgeSeconds);
 }
 
 
 bool  ISteamUGC_::SetCloudFileNameFilter(UGCQueryHandle_t  handle, char * pMatchCloudFileName)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", this, handle, pMatchCloudFileName);
-  bool  result = this->internal->SetCloudFileNameFilter(handle, pMatchCloudFileName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetCloudFileNameFilter");
+  return Forward<Method_SetCloudFileNameFilter>::call(&point, this->internal, handle, pMatchCloudFileName);
 }
 
 
 bool  ISteamUGC_::SetMatchAnyTag(UGCQueryHandle_t  handle, bool  bMatchAnyTag)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (bool )%d)\n", this, handle, bMatchAnyTag);
-  bool  result = this->internal->SetMatchAnyTag(handle, bMatchAnyTag);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetMatchAnyTag");
+  return Forward<Method_SetMatchAnyTag>::call(&point, this->internal, handle, bMatchAnyTag);
 }
 
 
 bool  ISteamUGC_::SetSearchText(UGCQueryHandle_t  handle, char * pSearchText)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", this, handle, pSearchText);
-  bool  result = this->internal->SetSearchText(handle, pSearchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetSearchText");
+  return Forward<Method_SetSearchText>::call(&point, this->internal, handle, pSearchText);
 }
 
 
 bool  ISteamUGC_::SetRankedByTrendDays(UGCQueryHandle_t  handle, uint32  unDays)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (uint32 )%d)\n", this, handle, unDays);
-  bool  result = this->internal->SetRankedByTrendDays(handle, unDays);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetRankedByTrendDays");
+  return Forward<Method_SetRankedByTrendDays>::call(&point, this->internal, handle, unDays);
 }
 
 
 bool  ISteamUGC_::AddRequiredKeyValueTag(UGCQueryHandle_t  handle, char * pKey, char * pValue)
 {
-  TRACE("((ISteamUGC *)%p, (UGCQueryHandle_t )%p, (char *)\"%s\", (char *)\"%s\")\n", this, handle, pKey, pValue);
-  bool  result = this->internal->AddRequiredKeyValueTag(handle, pKey, pValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::AddRequiredKeyValueTag");
+  return Forward<Method_AddRequiredKeyValueTag>::call(&point, this->internal, handle, pKey, pValue);
 }
 
 
 SteamAPICall_t  ISteamUGC_::RequestUGCDetails(PublishedFileId_t  nPublishedFileID, uint32  unMaxAgeSeconds)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p, (uint32 )%d)\n", this, nPublishedFileID, unMaxAgeSeconds);
-  SteamAPICall_t  result = this->internal->RequestUGCDetails(nPublishedFileID, unMaxAgeSeconds);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::RequestUGCDetails");
+  return Forward<Method_RequestUGCDetails>::call(&point, this->internal, nPublishedFileID, unMaxAgeSeconds);
 }
 
 
 SteamAPICall_t  ISteamUGC_::CreateItem(AppId_t  nConsumerAppId, EWorkshopFileType  eFileType)
 {
-  TRACE("((ISteamUGC *)%p, (AppId_t )%p, (EWorkshopFileType )%p)\n", this, nConsumerAppId, eFileType);
-  SteamAPICall_t  result = this->internal->CreateItem(nConsumerAppId, eFileType);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::CreateItem");
+  return Forward<Method_CreateItem>::call(&point, this->internal, nConsumerAppId, eFileType);
 }
 
 
 UGCUpdateHandle_t  ISteamUGC_::StartItemUpdate(AppId_t  nConsumerAppId, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((ISteamUGC *)%p, (AppId_t )%p, (PublishedFileId_t )%p)\n", this, nConsumerAppId, nPublishedFileID);
-  UGCUpdateHandle_t  result = this->internal->StartItemUpdate(nConsumerAppId, nPublishedFileID);
-  TRACE("() = (UGCUpdateHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::StartItemUpdate");
+  return Forward<Method_StartItemUpdate>::call(&point, this->internal, nConsumerAppId, nPublishedFileID);
 }
 
 
 bool  ISteamUGC_::SetItemTitle(UGCUpdateHandle_t  handle, char * pchTitle)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pchTitle);
-  bool  result = this->internal->SetItemTitle(handle, pchTitle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemTitle");
+  return Forward<Method_SetItemTitle>::call(&point, this->internal, handle, pchTitle);
 }
 
 
 bool  ISteamUGC_::SetItemDescription(UGCUpdateHandle_t  handle, char * pchDescription)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pchDescription);
-  bool  result = this->internal->SetItemDescription(handle, pchDescription);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemDescription");
+  return Forward<Method_SetItemDescription>::call(&point, this->internal, handle, pchDescription);
 }
 
 
 bool  ISteamUGC_::SetItemUpdateLanguage(UGCUpdateHandle_t  handle, char * pchLanguage)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pchLanguage);
-  bool  result = this->internal->SetItemUpdateLanguage(handle, pchLanguage);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemUpdateLanguage");
+  return Forward<Method_SetItemUpdateLanguage>::call(&point, this->internal, handle, pchLanguage);
 }
 
 
 bool  ISteamUGC_::SetItemMetadata(UGCUpdateHandle_t  handle, char * pchMetaData)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pchMetaData);
-  bool  result = this->internal->SetItemMetadata(handle, pchMetaData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemMetadata");
+  return Forward<Method_SetItemMetadata>::call(&point, this->internal, handle, pchMetaData);
 }
 
 
 bool  ISteamUGC_::SetItemVisibility(UGCUpdateHandle_t  handle, ERemoteStoragePublishedFileVisibility  eVisibility)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (ERemoteStoragePublishedFileVisibility )%p)\n", this, handle, eVisibility);
-  bool  result = this->internal->SetItemVisibility(handle, eVisibility);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemVisibility");
+  return Forward<Method_SetItemVisibility>::call(&point, this->internal, handle, eVisibility);
 }
 
 
 bool  ISteamUGC_::SetItemTags(UGCUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (SteamParamStringArray_t *)%p)\n", this, updateHandle, pTags);
-  bool  result = this->internal->SetItemTags(updateHandle, pTags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemTags");
+  return Forward<Method_SetItemTags>::call(&point, this->internal, updateHandle, pTags);
 }
 
 
 bool  ISteamUGC_::SetItemContent(UGCUpdateHandle_t  handle, char * pszContentFolder)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pszContentFolder);
-  bool  result = this->internal->SetItemContent(handle, pszContentFolder);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemContent");
+  return Forward<Method_SetItemContent>::call(&point, this->internal, handle, pszContentFolder);
 }
 
 
 bool  ISteamUGC_::SetItemPreview(UGCUpdateHandle_t  handle, char * pszPreviewFile)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pszPreviewFile);
-  bool  result = this->internal->SetItemPreview(handle, pszPreviewFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetItemPreview");
+  return Forward<Method_SetItemPreview>::call(&point, this->internal, handle, pszPreviewFile);
 }
 
 
 bool  ISteamUGC_::RemoveItemKeyValueTags(UGCUpdateHandle_t  handle, char * pchKey)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pchKey);
-  bool  result = this->internal->RemoveItemKeyValueTags(handle, pchKey);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::RemoveItemKeyValueTags");
+  return Forward<Method_RemoveItemKeyValueTags>::call(&point, this->internal, handle, pchKey);
 }
 
 
 bool  ISteamUGC_::AddItemKeyValueTag(UGCUpdateHandle_t  handle, char * pchKey, char * pchValue)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\", (char *)\"%s\")\n", this, handle, pchKey, pchValue);
-  bool  result = this->internal->AddItemKeyValueTag(handle, pchKey, pchValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::AddItemKeyValueTag");
+  return Forward<Method_AddItemKeyValueTag>::call(&point, this->internal, handle, pchKey, pchValue);
 }
 
 
 bool  ISteamUGC_::AddItemPreviewFile(UGCUpdateHandle_t  handle, char * pszPreviewFile, EItemPreviewType  type)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\", (EItemPreviewType )%p)\n", this, handle, pszPreviewFile, type);
-  bool  result = this->internal->AddItemPreviewFile(handle, pszPreviewFile, type);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::AddItemPreviewFile");
+  return Forward<Method_AddItemPreviewFile>::call(&point, this->internal, handle, pszPreviewFile, type);
 }
 
 
 bool  ISteamUGC_::AddItemPreviewVideo(UGCUpdateHandle_t  handle, char * pszVideoID)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pszVideoID);
-  bool  result = this->internal->AddItemPreviewVideo(handle, pszVideoID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::AddItemPreviewVideo");
+  return Forward<Method_AddItemPreviewVideo>::call(&point, this->internal, handle, pszVideoID);
 }
 
 
 bool  ISteamUGC_::UpdateItemPreviewFile(UGCUpdateHandle_t  handle, uint32  index, char * pszPreviewFile)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (uint32 )%d, (char *)\"%s\")\n", this, handle, index, pszPreviewFile);
-  bool  result = this->internal->UpdateItemPreviewFile(handle, index, pszPreviewFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::UpdateItemPreviewFile");
+  return Forward<Method_UpdateItemPreviewFile>::call(&point, this->internal, handle, index, pszPreviewFile);
 }
 
 
 bool  ISteamUGC_::UpdateItemPreviewVideo(UGCUpdateHandle_t  handle, uint32  index, char * pszVideoID)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (uint32 )%d, (char *)\"%s\")\n", this, handle, index, pszVideoID);
-  bool  result = this->internal->UpdateItemPreviewVideo(handle, index, pszVideoID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::UpdateItemPreviewVideo");
+  return Forward<Method_UpdateItemPreviewVideo>::call(&point, this->internal, handle, index, pszVideoID);
 }
 
 
 bool  ISteamUGC_::RemoveItemPreview(UGCUpdateHandle_t  handle, uint32  index)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (uint32 )%d)\n", this, handle, index);
-  bool  result = this->internal->RemoveItemPreview(handle, index);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::RemoveItemPreview");
+  return Forward<Method_RemoveItemPreview>::call(&point, this->internal, handle, index);
 }
 
 
 SteamAPICall_t  ISteamUGC_::SubmitItemUpdate(UGCUpdateHandle_t  handle, char * pchChangeNote)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", this, handle, pchChangeNote);
-  SteamAPICall_t  result = this->internal->SubmitItemUpdate(handle, pchChangeNote);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SubmitItemUpdate");
+  return Forward<Method_SubmitItemUpdate>::call(&point, this->internal, handle, pchChangeNote);
 }
 
 
 EItemUpdateStatus  ISteamUGC_::GetItemUpdateProgress(UGCUpdateHandle_t  handle, uint64 * punBytesProcessed, uint64 * punBytesTotal)
 {
-  TRACE("((ISteamUGC *)%p, (UGCUpdateHandle_t )%p, (uint64 *)%d, (uint64 *)%d)\n", this, handle, punBytesProcessed, punBytesTotal);
-  EItemUpdateStatus  result = this->internal->GetItemUpdateProgress(handle, punBytesProcessed, punBytesTotal);
-  TRACE("() = (EItemUpdateStatus )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetItemUpdateProgress");
+  return Forward<Method_GetItemUpdateProgress>::call(&point, this->internal, handle, punBytesProcessed, punBytesTotal);
 }
 
 
 SteamAPICall_t  ISteamUGC_::SetUserItemVote(PublishedFileId_t  nPublishedFileID, bool  bVoteUp)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p, (bool )%d)\n", this, nPublishedFileID, bVoteUp);
-  SteamAPICall_t  result = this->internal->SetUserItemVote(nPublishedFileID, bVoteUp);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SetUserItemVote");
+  return Forward<Method_SetUserItemVote>::call(&point, this->internal, nPublishedFileID, bVoteUp);
 }
 
 
 SteamAPICall_t  ISteamUGC_::GetUserItemVote(PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p)\n", this, nPublishedFileID);
-  SteamAPICall_t  result = this->internal->GetUserItemVote(nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetUserItemVote");
+  return Forward<Method_GetUserItemVote>::call(&point, this->internal, nPublishedFileID);
 }
 
 
 SteamAPICall_t  ISteamUGC_::AddItemToFavorites(AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((ISteamUGC *)%p, (AppId_t )%p, (PublishedFileId_t )%p)\n", this, nAppId, nPublishedFileID);
-  SteamAPICall_t  result = this->internal->AddItemToFavorites(nAppId, nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::AddItemToFavorites");
+  return Forward<Method_AddItemToFavorites>::call(&point, this->internal, nAppId, nPublishedFileID);
 }
 
 
 SteamAPICall_t  ISteamUGC_::RemoveItemFromFavorites(AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((ISteamUGC *)%p, (AppId_t )%p, (PublishedFileId_t )%p)\n", this, nAppId, nPublishedFileID);
-  SteamAPICall_t  result = this->internal->RemoveItemFromFavorites(nAppId, nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::RemoveItemFromFavorites");
+  return Forward<Method_RemoveItemFromFavorites>::call(&point, this->internal, nAppId, nPublishedFileID);
 }
 
 
 SteamAPICall_t  ISteamUGC_::SubscribeItem(PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p)\n", this, nPublishedFileID);
-  SteamAPICall_t  result = this->internal->SubscribeItem(nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::SubscribeItem");
+  return Forward<Method_SubscribeItem>::call(&point, this->internal, nPublishedFileID);
 }
 
 
 SteamAPICall_t  ISteamUGC_::UnsubscribeItem(PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p)\n", this, nPublishedFileID);
-  SteamAPICall_t  result = this->internal->UnsubscribeItem(nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::UnsubscribeItem");
+  return Forward<Method_UnsubscribeItem>::call(&point, this->internal, nPublishedFileID);
 }
 
 
 uint32  ISteamUGC_::GetNumSubscribedItems()
 {
-  TRACE("((ISteamUGC *)%p)\n", this);
-  uint32  result = this->internal->GetNumSubscribedItems();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetNumSubscribedItems");
+  return Forward<Method_GetNumSubscribedItems>::call(&point, this->internal);
 }
 
 
 uint32  ISteamUGC_::GetSubscribedItems(PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t *)%p, (uint32 )%d)\n", this, pvecPublishedFileID, cMaxEntries);
-  uint32  result = this->internal->GetSubscribedItems(pvecPublishedFileID, cMaxEntries);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetSubscribedItems");
+  return Forward<Method_GetSubscribedItems>::call(&point, this->internal, pvecPublishedFileID, cMaxEntries);
 }
 
 
 uint32  ISteamUGC_::GetItemState(PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p)\n", this, nPublishedFileID);
-  uint32  result = this->internal->GetItemState(nPublishedFileID);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetItemState");
+  return Forward<Method_GetItemState>::call(&point, this->internal, nPublishedFileID);
 }
 
 
 bool  ISteamUGC_::GetItemInstallInfo(PublishedFileId_t  nPublishedFileID, uint64 * punSizeOnDisk, char * pchFolder, uint32  cchFolderSize, uint32 * punTimeStamp)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p, (uint64 *)%d, (char *)\"%s\", (uint32 )%d, (uint32 *)%d)\n", this, nPublishedFileID, punSizeOnDisk, pchFolder, cchFolderSize, punTimeStamp);
-  bool  result = this->internal->GetItemInstallInfo(nPublishedFileID, punSizeOnDisk, pchFolder, cchFolderSize, punTimeStamp);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetItemInstallInfo", "3:4");
+  return Forward<Method_GetItemInstallInfo>::call(&point, this->internal, nPublishedFileID, punSizeOnDisk, pchFolder, cchFolderSize, punTimeStamp);
 }
 
 
 bool  ISteamUGC_::GetItemDownloadInfo(PublishedFileId_t  nPublishedFileID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p, (uint64 *)%d, (uint64 *)%d)\n", this, nPublishedFileID, punBytesDownloaded, punBytesTotal);
-  bool  result = this->internal->GetItemDownloadInfo(nPublishedFileID, punBytesDownloaded, punBytesTotal);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::GetItemDownloadInfo");
+  return Forward<Method_GetItemDownloadInfo>::call(&point, this->internal, nPublishedFileID, punBytesDownloaded, punBytesTotal);
 }
 
 
 bool  ISteamUGC_::DownloadItem(PublishedFileId_t  nPublishedFileID, bool  bHighPriority)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t )%p, (bool )%d)\n", this, nPublishedFileID, bHighPriority);
-  bool  result = this->internal->DownloadItem(nPublishedFileID, bHighPriority);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::DownloadItem");
+  return Forward<Method_DownloadItem>::call(&point, this->internal, nPublishedFileID, bHighPriority);
 }
 
 
 bool  ISteamUGC_::BInitWorkshopForGameServer(DepotId_t  unWorkshopDepotID, char * pszFolder)
 {
-  TRACE("((ISteamUGC *)%p, (DepotId_t )%p, (char *)\"%s\")\n", this, unWorkshopDepotID, pszFolder);
-  bool  result = this->internal->BInitWorkshopForGameServer(unWorkshopDepotID, pszFolder);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::BInitWorkshopForGameServer");
+  return Forward<Method_BInitWorkshopForGameServer>::call(&point, this->internal, unWorkshopDepotID, pszFolder);
 }
 
 
 void  ISteamUGC_::SuspendDownloads(bool  bSuspend)
 {
-  TRACE("((ISteamUGC *)%p, (bool )%d)\n", this, bSuspend);
-  this->internal->SuspendDownloads(bSuspend);
-  
+  static ProfilePoint point("ISteamUGC::SuspendDownloads");
+  return Forward<Method_SuspendDownloads>::call(&point, this->internal, bSuspend);
 }
 
 
 SteamAPICall_t  ISteamUGC_::StartPlaytimeTracking(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t *)%p, (uint32 )%d)\n", this, pvecPublishedFileID, unNumPublishedFileIDs);
-  SteamAPICall_t  result = this->internal->StartPlaytimeTracking(pvecPublishedFileID, unNumPublishedFileIDs);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::StartPlaytimeTracking");
+  return Forward<Method_StartPlaytimeTracking>::call(&point, this->internal, pvecPublishedFileID, unNumPublishedFileIDs);
 }
 
 
 SteamAPICall_t  ISteamUGC_::StopPlaytimeTracking(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
 {
-  TRACE("((ISteamUGC *)%p, (PublishedFileId_t *)%p, (uint32 )%d)\n", this, pvecPublishedFileID, unNumPublishedFileIDs);
-  SteamAPICall_t  result = this->internal->StopPlaytimeTracking(pvecPublishedFileID, unNumPublishedFileIDs);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::StopPlaytimeTracking");
+  return Forward<Method_StopPlaytimeTracking>::call(&point, this->internal, pvecPublishedFileID, unNumPublishedFileIDs);
 }
 
 
 SteamAPICall_t  ISteamUGC_::StopPlaytimeTrackingForAllItems()
 {
-  TRACE("((ISteamUGC *)%p)\n", this);
-  SteamAPICall_t  result = this->internal->StopPlaytimeTrackingForAllItems();
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUGC::StopPlaytimeTrackingForAllItems");
+  return Forward<Method_StopPlaytimeTrackingForAllItems>::call(&point, this->internal);
 }
 ISteamUGC_::ISteamUGC_(ISteamUGC * towrap)
 {
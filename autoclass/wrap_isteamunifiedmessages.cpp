@@ -1,52 +1,43 @@
 #include <steam_api_.h>
+FORWARD_METHOD(SendMethod);
+FORWARD_METHOD(GetMethodResponseInfo);
+FORWARD_METHOD(GetMethodResponseData);
+FORWARD_METHOD(ReleaseMethod);
+FORWARD_METHOD(SendNotification);
+
 
 ClientUnifiedMessageHandle  ISteamUnifiedMessages_::SendMethod(char * pchServiceMethod, void * pRequestBuffer, uint32  unRequestBufferSize, uint64  unContext)
 {
-  TRACE("((ISteamUnifiedMessages *)%p, (char *)\"%s\", (void *)%p, (uint32 )%d, (uint64 )%d)\n", this, pchServiceMethod, pRequestBuffer, unRequestBufferSize, unContext);
-  ClientUnifiedMessageHandle  result = this->internal->SendMethod(pchServiceMethod, pRequestBuffer, unRequestBufferSize, unContext);
-  TRACE("() = (ClientUnifiedMessageHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUnifiedMessages::SendMethod", "2:3");
+  return Forward<Method_SendMethod>::call(&point, this->internal, pchServiceMethod, pRequestBuffer, unRequestBufferSize, unContext);
 }
 
 
 bool  ISteamUnifiedMessages_::GetMethodResponseInfo(ClientUnifiedMessageHandle  hHandle, uint32 * punResponseSize, EResult * peResult)
 {
-  TRACE("((ISteamUnifiedMessages *)%p, (ClientUnifiedMessageHandle )%p, (uint32 *)%d, (EResult *)%p)\n", this, hHandle, punResponseSize, peResult);
-  bool  result = this->internal->GetMethodResponseInfo(hHandle, punResponseSize, peResult);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUnifiedMessages::GetMethodResponseInfo");
+  return Forward<Method_GetMethodResponseInfo>::call(&point, this->internal, hHandle, punResponseSize, peResult);
 }
 
 
 bool  ISteamUnifiedMessages_::GetMethodResponseData(ClientUnifiedMessageHandle  hHandle, void * pResponseBuffer, uint32  unResponseBufferSize, bool  bAutoRelease)
 {
-  TRACE("((ISteamUnifiedMessages *)%p, (ClientUnifiedMessageHandle )%p, (void *)%p, (uint32 )%d, (bool )%d)\n", this, hHandle, pResponseBuffer, unResponseBufferSize, bAutoRelease);
-  bool  result = this->internal->GetMethodResponseData(hHandle, pResponseBuffer, unResponseBufferSize, bAutoRelease);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUnifiedMessages::GetMethodResponseData", "2:3");
+  return Forward<Method_GetMethodResponseData>::call(&point, this->internal, hHandle, pResponseBuffer, unResponseBufferSize, bAutoRelease);
 }
 
 
 bool  ISteamUnifiedMessages_::ReleaseMethod(ClientUnifiedMessageHandle  hHandle)
 {
-  TRACE("((ISteamUnifiedMessages *)%p, (ClientUnifiedMessageHandle )%p)\n", this, hHandle);
-  bool  result = this->internal->ReleaseMethod(hHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUnifiedMessages::ReleaseMethod");
+  return Forward<Method_ReleaseMethod>::call(&point, this->internal, hHandle);
 }
 
 
 bool  ISteamUnifiedMessages_::SendNotification(char * pchServiceNotification, void * pNotificationBuffer, uint32  unNotificationBufferSize)
 {
-  TRACE("((ISteamUnifiedMessages *)%p, (char *)\"%s\", (void *)%p, (uint32 )%d)\n", this, pchServiceNotification, pNotificationBuffer, unNotificationBufferSize);
-  bool  result = this->internal->SendNotification(pchServiceNotification, pNotificationBuffer, unNotificationBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUnifiedMessages::SendNotification", "2:3");
+  return Forward<Method_SendNotification>::call(&point, this->internal, pchServiceNotification, pNotificationBuffer, unNotificationBufferSize);
 }
 ISteamUnifiedMessages_::ISteamUnifiedMessages_(ISteamUnifiedMessages * towrap)
 {
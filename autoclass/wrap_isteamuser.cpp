@@ -1,276 +1,235 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetHSteamUser);
+FORWARD_METHOD(BLoggedOn);
+FORWARD_METHOD(GetSteamID);
+FORWARD_METHOD(InitiateGameConnection);
+FORWARD_METHOD(TerminateGameConnection);
+FORWARD_METHOD(TrackAppUsageEvent);
+FORWARD_METHOD(GetUserDataFolder);
+FORWARD_METHOD(StartVoiceRecording);
+FORWARD_METHOD(StopVoiceRecording);
+FORWARD_METHOD(GetAvailableVoice);
+FORWARD_METHOD(GetVoice);
+FORWARD_METHOD(DecompressVoice);
+FORWARD_METHOD(GetVoiceOptimalSampleRate);
+FORWARD_METHOD(GetAuthSessionTicket);
+FORWARD_METHOD(BeginAuthSession);
+FORWARD_METHOD(EndAuthSession);
+FORWARD_METHOD(CancelAuthTicket);
+FORWARD_METHOD(UserHasLicenseForApp);
+FORWARD_METHOD(BIsBehindNAT);
+FORWARD_METHOD(AdvertiseGame);
+FORWARD_METHOD(RequestEncryptedAppTicket);
+FORWARD_METHOD(GetEncryptedAppTicket);
+FORWARD_METHOD(GetGameBadgeLevel);
+FORWARD_METHOD(GetPlayerSteamLevel);
+FORWARD_METHOD(RequestStoreAuthURL);
+FORWARD_METHOD(BIsPhoneVerified);
+FORWARD_METHOD(BIsTwoFactorEnabled);
+FORWARD_METHOD(BIsPhoneIdentifying);
+FORWARD_METHOD(BIsPhoneRequiringVerification);
+
 
 HSteamUser  ISteamUser_::GetHSteamUser()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  HSteamUser  result = this->internal->GetHSteamUser();
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetHSteamUser");
+  return Forward<Method_GetHSteamUser, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUser_::BLoggedOn()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  bool  result = this->internal->BLoggedOn();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::BLoggedOn");
+  return Forward<Method_BLoggedOn, true>::call(&point, this->internal);
 }
 
 
 CSteamID * ISteamUser_::GetSteamID(CSteamID * hidden)
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  *hidden = this->internal->GetSteamID();
-  return hidden;
+  static ProfilePoint point("ISteamUser::GetSteamID");
+  return Forward<Method_GetSteamID, true>::hidden(&point, hidden, this->internal);
 }
 
 
 int  ISteamUser_::InitiateGameConnection(void * pAuthBlob, int  cbMaxAuthBlob, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer, bool  bSecure)
 {
-  TRACE("((ISteamUser *)%p, (void *)%p, (int )%d, (CSteamID )%p, (uint32 )%d, (uint16 )%d, (bool )%d)\n", this, pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure);
-  int  result = this->internal->InitiateGameConnection(pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::InitiateGameConnection", "1:2");
+  return Forward<Method_InitiateGameConnection, true>::call(&point, this->internal, pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure);
 }
 
 
 void  ISteamUser_::TerminateGameConnection(uint32  unIPServer, uint16  usPortServer)
 {
-  TRACE("((ISteamUser *)%p, (uint32 )%d, (uint16 )%d)\n", this, unIPServer, usPortServer);
-  this->internal->TerminateGameConnection(unIPServer, usPortServer);
-  
+  static ProfilePoint point("ISteamUser::TerminateGameConnection");
+  return Forward<Method_TerminateGameConnection, true>::call(&point, this->internal, unIPServer, usPortServer);
 }
 
 
 void  ISteamUser_::TrackAppUsageEvent(CGameID  gameID, int  eAppUsageEvent, char * pchExtraInfo)
 {
-  TRACE("((ISteamUser *)%p, (CGameID )%p, (int )%d, (char *)\"%s\")\n", this, gameID, eAppUsageEvent, pchExtraInfo);
-  this->internal->TrackAppUsageEvent(gameID, eAppUsageEvent, pchExtraInfo);
-  
+  static ProfilePoint point("ISteamUser::TrackAppUsageEvent");
+  return Forward<Method_TrackAppUsageEvent, true>::call(&point, this->internal, gameID, eAppUsageEvent, pchExtraInfo);
 }
 
 
 bool  ISteamUser_::GetUserDataFolder(char * pchBuffer, int  cubBuffer)
 {
-  TRACE("((ISteamUser *)%p, (char *)\"%s\", (int )%d)\n", this, pchBuffer, cubBuffer);
-  bool  result = this->internal->GetUserDataFolder(pchBuffer, cubBuffer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetUserDataFolder", "1:2");
+  return Forward<Method_GetUserDataFolder, true>::call(&point, this->internal, pchBuffer, cubBuffer);
 }
 
 
 void  ISteamUser_::StartVoiceRecording()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  this->internal->StartVoiceRecording();
-  
+  static ProfilePoint point("ISteamUser::StartVoiceRecording");
+  return Forward<Method_StartVoiceRecording, true>::call(&point, this->internal);
 }
 
 
 void  ISteamUser_::StopVoiceRecording()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  this->internal->StopVoiceRecording();
-  
+  static ProfilePoint point("ISteamUser::StopVoiceRecording");
+  return Forward<Method_StopVoiceRecording, true>::call(&point, this->internal);
 }
 
 
 EVoiceResult  ISteamUser_::GetAvailableVoice(uint32 * pcbCompressed, uint32 * pcbUncompressed, uint32  nUncompressedVoiceDesiredSampleRate)
 {
-  TRACE("((ISteamUser *)%p, (uint32 *)%d, (uint32 *)%d, (uint32 )%d)\n", this, pcbCompressed, pcbUncompressed, nUncompressedVoiceDesiredSampleRate);
-  EVoiceResult  result = this->internal->GetAvailableVoice(pcbCompressed, pcbUncompressed, nUncompressedVoiceDesiredSampleRate);
-  TRACE("() = (EVoiceResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetAvailableVoice");
+  return Forward<Method_GetAvailableVoice, true>::call(&point, this->internal, pcbCompressed, pcbUncompressed, nUncompressedVoiceDesiredSampleRate);
 }
 
 
 EVoiceResult  ISteamUser_::GetVoice(bool  bWantCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, bool  bWantUncompressed, void * pUncompressedDestBuffer, uint32  cbUncompressedDestBufferSize, uint32 * nUncompressBytesWritten, uint32  nUncompressedVoiceDesiredSampleRate)
 {
-  TRACE("((ISteamUser *)%p, (bool )%d, (void *)%p, (uint32 )%d, (uint32 *)%d, (bool )%d, (void *)%p, (uint32 )%d, (uint32 *)%d, (uint32 )%d)\n", this, bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, bWantUncompressed, pUncompressedDestBuffer, cbUncompressedDestBufferSize, nUncompressBytesWritten, nUncompressedVoiceDesiredSampleRate);
-  EVoiceResult  result = this->internal->GetVoice(bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, bWantUncompressed, pUncompressedDestBuffer, cbUncompressedDestBufferSize, nUncompressBytesWritten, nUncompressedVoiceDesiredSampleRate);
-  TRACE("() = (EVoiceResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetVoice", "2:3 6:7");
+  return Forward<Method_GetVoice, true>::call(&point, this->internal, bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, bWantUncompressed, pUncompressedDestBuffer, cbUncompressedDestBufferSize, nUncompressBytesWritten, nUncompressedVoiceDesiredSampleRate);
 }
 
 
 EVoiceResult  ISteamUser_::DecompressVoice(void * pCompressed, uint32  cbCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, uint32  nDesiredSampleRate)
 {
-  TRACE("((ISteamUser *)%p, (void *)%p, (uint32 )%d, (void *)%p, (uint32 )%d, (uint32 *)%d, (uint32 )%d)\n", this, pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate);
-  EVoiceResult  result = this->internal->DecompressVoice(pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate);
-  TRACE("() = (EVoiceResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::DecompressVoice", "1:2 3:4");
+  return Forward<Method_DecompressVoice, true>::call(&point, this->internal, pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate);
 }
 
 
 uint32  ISteamUser_::GetVoiceOptimalSampleRate()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  uint32  result = this->internal->GetVoiceOptimalSampleRate();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetVoiceOptimalSampleRate");
+  return Forward<Method_GetVoiceOptimalSampleRate, true>::call(&point, this->internal);
 }
 
 
 HAuthTicket  ISteamUser_::GetAuthSessionTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
 {
-  TRACE("((ISteamUser *)%p, (void *)%p, (int )%d, (uint32 *)%d)\n", this, pTicket, cbMaxTicket, pcbTicket);
-  HAuthTicket  result = this->internal->GetAuthSessionTicket(pTicket, cbMaxTicket, pcbTicket);
-  TRACE("() = (HAuthTicket )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetAuthSessionTicket", "1:2");
+  return Forward<Method_GetAuthSessionTicket, true>::call(&point, this->internal, pTicket, cbMaxTicket, pcbTicket);
 }
 
 
 EBeginAuthSessionResult  ISteamUser_::BeginAuthSession(void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
 {
-  TRACE("((ISteamUser *)%p, (void *)%p, (int )%d, (CSteamID )%p)\n", this, pAuthTicket, cbAuthTicket, steamID);
-  EBeginAuthSessionResult  result = this->internal->BeginAuthSession(pAuthTicket, cbAuthTicket, steamID);
-  TRACE("() = (EBeginAuthSessionResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::BeginAuthSession", "1:2");
+  return Forward<Method_BeginAuthSession, true>::call(&point, this->internal, pAuthTicket, cbAuthTicket, steamID);
 }
 
 
 void  ISteamUser_::EndAuthSession(CSteamID  steamID)
 {
-  TRACE("((ISteamUser *)%p, (CSteamID )%p)\n", this, steamID);
-  this->internal->EndAuthSession(steamID);
-  
+  static ProfilePoint point("ISteamUser::EndAuthSession");
+  return Forward<Method_EndAuthSession, true>::call(&point, this->internal, steamID);
 }
 
 
 void  ISteamUser_::CancelAuthTicket(HAuthTicket  hAuthTicket)
 {
-  TRACE("((ISteamUser *)%p, (HAuthTicket )%p)\n", this, hAuthTicket);
-  this->internal->CancelAuthTicket(hAuthTicket);
-  
+  static ProfilePoint point("ISteamUser::CancelAuthTicket");
+  return Forward<Method_CancelAuthTicket, true>::call(&point, this->internal, hAuthTicket);
 }
 
 
 EUserHasLicenseForAppResult  ISteamUser_::UserHasLicenseForApp(CSteamID  steamID, AppId_t  appID)
 {
-  TRACE("((ISteamUser *)%p, (CSteamID )%p, (AppId_t )%p)\n", this, steamID, appID);
-  EUserHasLicenseForAppResult  result = this->internal->UserHasLicenseForApp(steamID, appID);
-  TRACE("() = (EUserHasLicenseForAppResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::UserHasLicenseForApp");
+  return Forward<Method_UserHasLicenseForApp, true>::call(&point, this->internal, steamID, appID);
 }
 
 
 bool  ISteamUser_::BIsBehindNAT()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  bool  result = this->internal->BIsBehindNAT();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::BIsBehindNAT");
+  return Forward<Method_BIsBehindNAT, true>::call(&point, this->internal);
 }
 
 
 void  ISteamUser_::AdvertiseGame(CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer)
 {
-  TRACE("((ISteamUser *)%p, (CSteamID )%p, (uint32 )%d, (uint16 )%d)\n", this, steamIDGameServer, unIPServer, usPortServer);
-  this->internal->AdvertiseGame(steamIDGameServer, unIPServer, usPortServer);
-  
+  static ProfilePoint point("ISteamUser::AdvertiseGame");
+  return Forward<Method_AdvertiseGame, true>::call(&point, this->internal, steamIDGameServer, unIPServer, usPortServer);
 }
 
 
 SteamAPICall_t  ISteamUser_::RequestEncryptedAppTicket(void * pDataToInclude, int  cbDataToInclude)
 {
-  TRACE("((ISteamUser *)%p, (void *)%p, (int )%d)\n", this, pDataToInclude, cbDataToInclude);
-  SteamAPICall_t  result = this->internal->RequestEncryptedAppTicket(pDataToInclude, cbDataToInclude);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::RequestEncryptedAppTicket", "1:2");
+  return Forward<Method_RequestEncryptedAppTicket, true>::call(&point, this->internal, pDataToInclude, cbDataToInclude);
 }
 
 
 bool  ISteamUser_::GetEncryptedAppTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
 {
-  TRACE("((ISteamUser *)%p, (void *)%p, (int )%d, (uint32 *)%d)\n", this, pTicket, cbMaxTicket, pcbTicket);
-  bool  result = this->internal->GetEncryptedAppTicket(pTicket, cbMaxTicket, pcbTicket);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetEncryptedAppTicket", "1:2");
+  return Forward<Method_GetEncryptedAppTicket, true>::call(&point, this->internal, pTicket, cbMaxTicket, pcbTicket);
 }
 
 
 int  ISteamUser_::GetGameBadgeLevel(int  nSeries, bool  bFoil)
 {
-  TRACE("((ISteamUser *)%p, (int )%d, (bool )%d)\n", this, nSeries, bFoil);
-  int  result = this->internal->GetGameBadgeLevel(nSeries, bFoil);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetGameBadgeLevel");
+  return Forward<Method_GetGameBadgeLevel, true>::call(&point, this->internal, nSeries, bFoil);
 }
 
 
 int  ISteamUser_::GetPlayerSteamLevel()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  int  result = this->internal->GetPlayerSteamLevel();
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::GetPlayerSteamLevel");
+  return Forward<Method_GetPlayerSteamLevel, true>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamUser_::RequestStoreAuthURL(char * pchRedirectURL)
 {
-  TRACE("((ISteamUser *)%p, (char *)\"%s\")\n", this, pchRedirectURL);
-  SteamAPICall_t  result = this->internal->RequestStoreAuthURL(pchRedirectURL);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::RequestStoreAuthURL");
+  return Forward<Method_RequestStoreAuthURL, true>::call(&point, this->internal, pchRedirectURL);
 }
 
 
 bool  ISteamUser_::BIsPhoneVerified()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  bool  result = this->internal->BIsPhoneVerified();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::BIsPhoneVerified");
+  return Forward<Method_BIsPhoneVerified, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUser_::BIsTwoFactorEnabled()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  bool  result = this->internal->BIsTwoFactorEnabled();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::BIsTwoFactorEnabled");
+  return Forward<Method_BIsTwoFactorEnabled, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUser_::BIsPhoneIdentifying()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  bool  result = this->internal->BIsPhoneIdentifying();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::BIsPhoneIdentifying");
+  return Forward<Method_BIsPhoneIdentifying, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUser_::BIsPhoneRequiringVerification()
 {
-  TRACE("((ISteamUser *)%p)\n", this);
-  bool  result = this->internal->BIsPhoneRequiringVerification();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUser::BIsPhoneRequiringVerification");
+  return Forward<Method_BIsPhoneRequiringVerification, true>::call(&point, this->internal);
 }
 ISteamUser_::ISteamUser_(ISteamUser * towrap)
 {
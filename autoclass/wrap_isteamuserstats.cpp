@@ -1,432 +1,342 @@
 #include <steam_api_.h>
+FORWARD_METHOD(RequestCurrentStats);
+FORWARD_METHOD(GetStat);
+FORWARD_METHOD(SetStat);
+FORWARD_METHOD(UpdateAvgRateStat);
+FORWARD_METHOD(GetAchievement);
+FORWARD_METHOD(SetAchievement);
+FORWARD_METHOD(ClearAchievement);
+FORWARD_METHOD(GetAchievementAndUnlockTime);
+FORWARD_METHOD(StoreStats);
+FORWARD_METHOD(GetAchievementIcon);
+FORWARD_METHOD(GetAchievementDisplayAttribute);
+FORWARD_METHOD(IndicateAchievementProgress);
+FORWARD_METHOD(GetNumAchievements);
+FORWARD_METHOD(GetAchievementName);
+FORWARD_METHOD(RequestUserStats);
+FORWARD_METHOD(GetUserStat);
+FORWARD_METHOD(GetUserAchievement);
+FORWARD_METHOD(GetUserAchievementAndUnlockTime);
+FORWARD_METHOD(ResetAllStats);
+FORWARD_METHOD(FindOrCreateLeaderboard);
+FORWARD_METHOD(FindLeaderboard);
+FORWARD_METHOD(GetLeaderboardName);
+FORWARD_METHOD(GetLeaderboardEntryCount);
+FORWARD_METHOD(GetLeaderboardSortMethod);
+FORWARD_METHOD(GetLeaderboardDisplayType);
+FORWARD_METHOD(DownloadLeaderboardEntries);
+FORWARD_METHOD(DownloadLeaderboardEntriesForUsers);
+FORWARD_METHOD(GetDownloadedLeaderboardEntry);
+FORWARD_METHOD(UploadLeaderboardScore);
+FORWARD_METHOD(AttachLeaderboardUGC);
+FORWARD_METHOD(GetNumberOfCurrentPlayers);
+FORWARD_METHOD(RequestGlobalAchievementPercentages);
+FORWARD_METHOD(GetMostAchievedAchievementInfo);
+FORWARD_METHOD(GetNextMostAchievedAchievementInfo);
+FORWARD_METHOD(GetAchievementAchievedPercent);
+FORWARD_METHOD(RequestGlobalStats);
+FORWARD_METHOD(GetGlobalStat);
+FORWARD_METHOD(GetGlobalStatHistory);
+
 
 bool  ISteamUserStats_::RequestCurrentStats()
 {
-  TRACE("((ISteamUserStats *)%p)\n", this);
-  bool  result = this->internal->RequestCurrentStats();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::RequestCurrentStats");
+  return Forward<Method_RequestCurrentStats>::call(&point, this->internal);
 }
 
 
 bool  ISteamUserStats_::GetStat(char * pchName, int32 * pData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (int32 *)%d)\n", this, pchName, pData);
-  bool  result = this->internal->GetStat(pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetStat");
+  return Forward<Method_GetStat>::call(&point, this->internal, pchName, pData);
 }
 
 
 bool  ISteamUserStats_::GetStat(char * pchName, float * pData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (float *)%f)\n", this, pchName, pData);
-  bool  result = this->internal->GetStat(pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetStat");
+  return Forward<Method_GetStat>::call(&point, this->internal, pchName, pData);
 }
 
 
 bool  ISteamUserStats_::SetStat(char * pchName, int32  nData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (int32 )%d)\n", this, pchName, nData);
-  bool  result = this->internal->SetStat(pchName, nData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::SetStat");
+  return Forward<Method_SetStat>::call(&point, this->internal, pchName, nData);
 }
 
 
 bool  ISteamUserStats_::SetStat(char * pchName, float  fData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (float )%f)\n", this, pchName, fData);
-  bool  result = this->internal->SetStat(pchName, fData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::SetStat");
+  return Forward<Method_SetStat>::call(&point, this->internal, pchName, fData);
 }
 
 
 bool  ISteamUserStats_::UpdateAvgRateStat(char * pchName, float  flCountThisSession, double  dSessionLength)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (float )%f, (double )%f)\n", this, pchName, flCountThisSession, dSessionLength);
-  bool  result = this->internal->UpdateAvgRateStat(pchName, flCountThisSession, dSessionLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::UpdateAvgRateStat");
+  return Forward<Method_UpdateAvgRateStat>::call(&point, this->internal, pchName, flCountThisSession, dSessionLength);
 }
 
 
 bool  ISteamUserStats_::GetAchievement(char * pchName, bool * pbAchieved)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (bool *)%d)\n", this, pchName, pbAchieved);
-  bool  result = this->internal->GetAchievement(pchName, pbAchieved);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetAchievement");
+  return Forward<Method_GetAchievement>::call(&point, this->internal, pchName, pbAchieved);
 }
 
 
 bool  ISteamUserStats_::SetAchievement(char * pchName)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\")\n", this, pchName);
-  bool  result = this->internal->SetAchievement(pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::SetAchievement");
+  return Forward<Method_SetAchievement>::call(&point, this->internal, pchName);
 }
 
 
 bool  ISteamUserStats_::ClearAchievement(char * pchName)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\")\n", this, pchName);
-  bool  result = this->internal->ClearAchievement(pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::ClearAchievement");
+  return Forward<Method_ClearAchievement>::call(&point, this->internal, pchName);
 }
 
 
 bool  ISteamUserStats_::GetAchievementAndUnlockTime(char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (bool *)%d, (uint32 *)%d)\n", this, pchName, pbAchieved, punUnlockTime);
-  bool  result = this->internal->GetAchievementAndUnlockTime(pchName, pbAchieved, punUnlockTime);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetAchievementAndUnlockTime");
+  return Forward<Method_GetAchievementAndUnlockTime>::call(&point, this->internal, pchName, pbAchieved, punUnlockTime);
 }
 
 
 bool  ISteamUserStats_::StoreStats()
 {
-  TRACE("((ISteamUserStats *)%p)\n", this);
-  bool  result = this->internal->StoreStats();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::StoreStats");
+  return Forward<Method_StoreStats>::call(&point, this->internal);
 }
 
 
 int  ISteamUserStats_::GetAchievementIcon(char * pchName)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\")\n", this, pchName);
-  int  result = this->internal->GetAchievementIcon(pchName);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetAchievementIcon");
+  return Forward<Method_GetAchievementIcon>::call(&point, this->internal, pchName);
 }
 
 
 char * ISteamUserStats_::GetAchievementDisplayAttribute(char * pchName, char * pchKey)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (char *)\"%s\")\n", this, pchName, pchKey);
-  char * result = this->internal->GetAchievementDisplayAttribute(pchName, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetAchievementDisplayAttribute");
+  return Forward<Method_GetAchievementDisplayAttribute>::call(&point, this->internal, pchName, pchKey);
 }
 
 
 bool  ISteamUserStats_::IndicateAchievementProgress(char * pchName, uint32  nCurProgress, uint32  nMaxProgress)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (uint32 )%d, (uint32 )%d)\n", this, pchName, nCurProgress, nMaxProgress);
-  bool  result = this->internal->IndicateAchievementProgress(pchName, nCurProgress, nMaxProgress);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::IndicateAchievementProgress");
+  return Forward<Method_IndicateAchievementProgress>::call(&point, this->internal, pchName, nCurProgress, nMaxProgress);
 }
 
 
 uint32  ISteamUserStats_::GetNumAchievements()
 {
-  TRACE("((ISteamUserStats *)%p)\n", this);
-  uint32  result = this->internal->GetNumAchievements();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetNumAchievements");
+  return Forward<Method_GetNumAchievements>::call(&point, this->internal);
 }
 
 
 char * ISteamUserStats_::GetAchievementName(uint32  iAchievement)
 {
-  TRACE("((ISteamUserStats *)%p, (uint32 )%d)\n", this, iAchievement);
-  char * result = this->internal->GetAchievementName(iAchievement);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetAchievementName");
+  return Forward<Method_GetAchievementName>::call(&point, this->internal, iAchievement);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::RequestUserStats(CSteamID  steamIDUser)
 {
-  TRACE("((ISteamUserStats *)%p, (CSteamID )%p)\n", this, steamIDUser);
-  SteamAPICall_t  result = this->internal->RequestUserStats(steamIDUser);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::RequestUserStats");
+  return Forward<Method_RequestUserStats>::call(&point, this->internal, steamIDUser);
 }
 
 
 bool  ISteamUserStats_::GetUserStat(CSteamID  steamIDUser, char * pchName, int32 * pData)
 {
-  TRACE("((ISteamUserStats *)%p, (CSteamID )%p, (char *)\"%s\", (int32 *)%d)\n", this, steamIDUser, pchName, pData);
-  bool  result = this->internal->GetUserStat(steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetUserStat");
+  return Forward<Method_GetUserStat>::call(&point, this->internal, steamIDUser, pchName, pData);
 }
 
 
 bool  ISteamUserStats_::GetUserStat(CSteamID  steamIDUser, char * pchName, float * pData)
 {
-  TRACE("((ISteamUserStats *)%p, (CSteamID )%p, (char *)\"%s\", (float *)%f)\n", this, steamIDUser, pchName, pData);
-  bool  result = this->internal->GetUserStat(steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetUserStat");
+  return Forward<Method_GetUserStat>::call(&point, this->internal, steamIDUser, pchName, pData);
 }
 
 
 bool  ISteamUserStats_::GetUserAchievement(CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
 {
-  TRACE("((ISteamUserStats *)%p, (CSteamID )%p, (char *)\"%s\", (bool *)%d)\n", this, steamIDUser, pchName, pbAchieved);
-  bool  result = this->internal->GetUserAchievement(steamIDUser, pchName, pbAchieved);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetUserAchievement");
+  return Forward<Method_GetUserAchievement>::call(&point, this->internal, steamIDUser, pchName, pbAchieved);
 }
 
 
 bool  ISteamUserStats_::GetUserAchievementAndUnlockTime(CSteamID  steamIDUser, char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
 {
-  TRACE("((ISteamUserStats *)%p, (CSteamID )%p, (char *)\"%s\", (bool *)%d, (uint32 *)%d)\n", this, steamIDUser, pchName, pbAchieved, punUnlockTime);
-  bool  result = this->internal->GetUserAchievementAndUnlockTime(steamIDUser, pchName, pbAchieved, punUnlockTime);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetUserAchievementAndUnlockTime");
+  return Forward<Method_GetUserAchievementAndUnlockTime>::call(&point, this->internal, steamIDUser, pchName, pbAchieved, punUnlockTime);
 }
 
 
 bool  ISteamUserStats_::ResetAllStats(bool  bAchievementsToo)
 {
-  TRACE("((ISteamUserStats *)%p, (bool )%d)\n", this, bAchievementsToo);
-  bool  result = this->internal->ResetAllStats(bAchievementsToo);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::ResetAllStats");
+  return Forward<Method_ResetAllStats>::call(&point, this->internal, bAchievementsToo);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::FindOrCreateLeaderboard(char * pchLeaderboardName, ELeaderboardSortMethod  eLeaderboardSortMethod, ELeaderboardDisplayType  eLeaderboardDisplayType)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (ELeaderboardSortMethod )%p, (ELeaderboardDisplayType )%p)\n", this, pchLeaderboardName, eLeaderboardSortMethod, eLeaderboardDisplayType);
-  SteamAPICall_t  result = this->internal->FindOrCreateLeaderboard(pchLeaderboardName, eLeaderboardSortMethod, eLeaderboardDisplayType);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::FindOrCreateLeaderboard");
+  return Forward<Method_FindOrCreateLeaderboard>::call(&point, this->internal, pchLeaderboardName, eLeaderboardSortMethod, eLeaderboardDisplayType);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::FindLeaderboard(char * pchLeaderboardName)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\")\n", this, pchLeaderboardName);
-  SteamAPICall_t  result = this->internal->FindLeaderboard(pchLeaderboardName);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::FindLeaderboard");
+  return Forward<Method_FindLeaderboard>::call(&point, this->internal, pchLeaderboardName);
 }
 
 
 char * ISteamUserStats_::GetLeaderboardName(SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p)\n", this, hSteamLeaderboard);
-  char * result = this->internal->GetLeaderboardName(hSteamLeaderboard);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetLeaderboardName");
+  return Forward<Method_GetLeaderboardName>::call(&point, this->internal, hSteamLeaderboard);
 }
 
 
 int  ISteamUserStats_::GetLeaderboardEntryCount(SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p)\n", this, hSteamLeaderboard);
-  int  result = this->internal->GetLeaderboardEntryCount(hSteamLeaderboard);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetLeaderboardEntryCount");
+  return Forward<Method_GetLeaderboardEntryCount>::call(&point, this->internal, hSteamLeaderboard);
 }
 
 
 ELeaderboardSortMethod  ISteamUserStats_::GetLeaderboardSortMethod(SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p)\n", this, hSteamLeaderboard);
-  ELeaderboardSortMethod  result = this->internal->GetLeaderboardSortMethod(hSteamLeaderboard);
-  TRACE("() = (ELeaderboardSortMethod )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetLeaderboardSortMethod");
+  return Forward<Method_GetLeaderboardSortMethod>::call(&point, this->internal, hSteamLeaderboard);
 }
 
 
 ELeaderboardDisplayType  ISteamUserStats_::GetLeaderboardDisplayType(SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p)\n", this, hSteamLeaderboard);
-  ELeaderboardDisplayType  result = this->internal->GetLeaderboardDisplayType(hSteamLeaderboard);
-  TRACE("() = (ELeaderboardDisplayType )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetLeaderboardDisplayType");
+  return Forward<Method_GetLeaderboardDisplayType>::call(&point, this->internal, hSteamLeaderboard);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::DownloadLeaderboardEntries(SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardDataRequest  eLeaderboardDataRequest, int  nRangeStart, int  nRangeEnd)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p, (ELeaderboardDataRequest )%p, (int )%d, (int )%d)\n", this, hSteamLeaderboard, eLeaderboardDataRequest, nRangeStart, nRangeEnd);
-  SteamAPICall_t  result = this->internal->DownloadLeaderboardEntries(hSteamLeaderboard, eLeaderboardDataRequest, nRangeStart, nRangeEnd);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::DownloadLeaderboardEntries");
+  return Forward<Method_DownloadLeaderboardEntries>::call(&point, this->internal, hSteamLeaderboard, eLeaderboardDataRequest, nRangeStart, nRangeEnd);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::DownloadLeaderboardEntriesForUsers(SteamLeaderboard_t  hSteamLeaderboard, CSteamID * prgUsers, int  cUsers)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p, (CSteamID *)%p, (int )%d)\n", this, hSteamLeaderboard, prgUsers, cUsers);
-  SteamAPICall_t  result = this->internal->DownloadLeaderboardEntriesForUsers(hSteamLeaderboard, prgUsers, cUsers);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::DownloadLeaderboardEntriesForUsers");
+  return Forward<Method_DownloadLeaderboardEntriesForUsers>::call(&point, this->internal, hSteamLeaderboard, prgUsers, cUsers);
 }
 
 
 bool  ISteamUserStats_::GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t  hSteamLeaderboardEntries, int  index, LeaderboardEntry_t * pLeaderboardEntry, int32 * pDetails, int  cDetailsMax)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboardEntries_t )%p, (int )%d, (LeaderboardEntry_t *)%p, (int32 *)%d, (int )%d)\n", this, hSteamLeaderboardEntries, index, pLeaderboardEntry, pDetails, cDetailsMax);
-  bool  result = this->internal->GetDownloadedLeaderboardEntry(hSteamLeaderboardEntries, index, pLeaderboardEntry, pDetails, cDetailsMax);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetDownloadedLeaderboardEntry");
+  return Forward<Method_GetDownloadedLeaderboardEntry>::call(&point, this->internal, hSteamLeaderboardEntries, index, pLeaderboardEntry, pDetails, cDetailsMax);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::UploadLeaderboardScore(SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardUploadScoreMethod  eLeaderboardUploadScoreMethod, int32  nScore, int32 * pScoreDetails, int  cScoreDetailsCount)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p, (ELeaderboardUploadScoreMethod )%p, (int32 )%d, (int32 *)%d, (int )%d)\n", this, hSteamLeaderboard, eLeaderboardUploadScoreMethod, nScore, pScoreDetails, cScoreDetailsCount);
-  SteamAPICall_t  result = this->internal->UploadLeaderboardScore(hSteamLeaderboard, eLeaderboardUploadScoreMethod, nScore, pScoreDetails, cScoreDetailsCount);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::UploadLeaderboardScore");
+  return Forward<Method_UploadLeaderboardScore>::call(&point, this->internal, hSteamLeaderboard, eLeaderboardUploadScoreMethod, nScore, pScoreDetails, cScoreDetailsCount);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::AttachLeaderboardUGC(SteamLeaderboard_t  hSteamLeaderboard, UGCHandle_t  hUGC)
 {
-  TRACE("((ISteamUserStats *)%p, (SteamLeaderboard_t )%p, (UGCHandle_t )%p)\n", this, hSteamLeaderboard, hUGC);
-  SteamAPICall_t  result = this->internal->AttachLeaderboardUGC(hSteamLeaderboard, hUGC);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::AttachLeaderboardUGC");
+  return Forward<Method_AttachLeaderboardUGC>::call(&point, this->internal, hSteamLeaderboard, hUGC);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::GetNumberOfCurrentPlayers()
 {
-  TRACE("((ISteamUserStats *)%p)\n", this);
-  SteamAPICall_t  result = this->internal->GetNumberOfCurrentPlayers();
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetNumberOfCurrentPlayers");
+  return Forward<Method_GetNumberOfCurrentPlayers>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::RequestGlobalAchievementPercentages()
 {
-  TRACE("((ISteamUserStats *)%p)\n", this);
-  SteamAPICall_t  result = this->internal->RequestGlobalAchievementPercentages();
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::RequestGlobalAchievementPercentages");
+  return Forward<Method_RequestGlobalAchievementPercentages>::call(&point, this->internal);
 }
 
 
 int  ISteamUserStats_::GetMostAchievedAchievementInfo(char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (uint32 )%d, (float *)%f, (bool *)%d)\n", this, pchName, unNameBufLen, pflPercent, pbAchieved);
-  int  result = this->internal->GetMostAchievedAchievementInfo(pchName, unNameBufLen, pflPercent, pbAchieved);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetMostAchievedAchievementInfo");
+  return Forward<Method_GetMostAchievedAchievementInfo>::call(&point, this->internal, pchName, unNameBufLen, pflPercent, pbAchieved);
 }
 
 
 int  ISteamUserStats_::GetNextMostAchievedAchievementInfo(int  iIteratorPrevious, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
 {
-  TRACE("((ISteamUserStats *)%p, (int )%d, (char *)\"%s\", (uint32 )%d, (float *)%f, (bool *)%d)\n", this, iIteratorPrevious, pchName, unNameBufLen, pflPercent, pbAchieved);
-  int  result = this->internal->GetNextMostAchievedAchievementInfo(iIteratorPrevious, pchName, unNameBufLen, pflPercent, pbAchieved);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetNextMostAchievedAchievementInfo");
+  return Forward<Method_GetNextMostAchievedAchievementInfo>::call(&point, this->internal, iIteratorPrevious, pchName, unNameBufLen, pflPercent, pbAchieved);
 }
 
 
 bool  ISteamUserStats_::GetAchievementAchievedPercent(char * pchName, float * pflPercent)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (float *)%f)\n", this, pchName, pflPercent);
-  bool  result = this->internal->GetAchievementAchievedPercent(pchName, pflPercent);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetAchievementAchievedPercent");
+  return Forward<Method_GetAchievementAchievedPercent>::call(&point, this->internal, pchName, pflPercent);
 }
 
 
 SteamAPICall_t  ISteamUserStats_::RequestGlobalStats(int  nHistoryDays)
 {
-  TRACE("((ISteamUserStats *)%p, (int )%d)\n", this, nHistoryDays);
-  SteamAPICall_t  result = this->internal->RequestGlobalStats(nHistoryDays);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::RequestGlobalStats");
+  return Forward<Method_RequestGlobalStats>::call(&point, this->internal, nHistoryDays);
 }
 
 
 bool  ISteamUserStats_::GetGlobalStat(char * pchStatName, int64 * pData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (int64 *)%d)\n", this, pchStatName, pData);
-  bool  result = this->internal->GetGlobalStat(pchStatName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetGlobalStat");
+  return Forward<Method_GetGlobalStat>::call(&point, this->internal, pchStatName, pData);
 }
 
 
 bool  ISteamUserStats_::GetGlobalStat(char * pchStatName, double * pData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (double *)%f)\n", this, pchStatName, pData);
-  bool  result = this->internal->GetGlobalStat(pchStatName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetGlobalStat");
+  return Forward<Method_GetGlobalStat>::call(&point, this->internal, pchStatName, pData);
 }
 
 
 int32  ISteamUserStats_::GetGlobalStatHistory(char * pchStatName, int64 * pData, uint32  cubData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (int64 *)%d, (uint32 )%d)\n", this, pchStatName, pData, cubData);
-  int32  result = this->internal->GetGlobalStatHistory(pchStatName, pData, cubData);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetGlobalStatHistory", "2:3");
+  return Forward<Method_GetGlobalStatHistory>::call(&point, this->internal, pchStatName, pData, cubData);
 }
 
 
 int32  ISteamUserStats_::GetGlobalStatHistory(char * pchStatName, double * pData, uint32  cubData)
 {
-  TRACE("((ISteamUserStats *)%p, (char *)\"%s\", (double *)%f, (uint32 )%d)\n", this, pchStatName, pData, cubData);
-  int32  result = this->internal->GetGlobalStatHistory(pchStatName, pData, cubData);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUserStats::GetGlobalStatHistory", "2:3");
+  return Forward<Method_GetGlobalStatHistory>::call(&point, this->internal, pchStatName, pData, cubData);
 }
 ISteamUserStats_::ISteamUserStats_(ISteamUserStats * towrap)
 {
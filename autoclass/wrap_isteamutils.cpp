@@ -1,146 +1,135 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetSecondsSinceAppActive);
+FORWARD_METHOD(GetSecondsSinceComputerActive);
+FORWARD_METHOD(GetConnectedUniverse);
+FORWARD_METHOD(GetServerRealTime);
+FORWARD_METHOD(GetIPCountry);
+FORWARD_METHOD(GetImageSize);
+FORWARD_METHOD(GetImageRGBA);
+FORWARD_METHOD(GetCSERIPPort);
+FORWARD_METHOD(GetCurrentBatteryPower);
+FORWARD_METHOD(GetAppID);
+FORWARD_METHOD(SetOverlayNotificationPosition);
+FORWARD_METHOD(IsAPICallCompleted);
+FORWARD_METHOD(GetAPICallFailureReason);
+FORWARD_METHOD(GetAPICallResult);
+FORWARD_METHOD(GetIPCCallCount);
+FORWARD_METHOD(SetWarningMessageHook);
+FORWARD_METHOD(IsOverlayEnabled);
+FORWARD_METHOD(BOverlayNeedsPresent);
+FORWARD_METHOD(CheckFileSignature);
+FORWARD_METHOD(ShowGamepadTextInput);
+FORWARD_METHOD(GetEnteredGamepadTextLength);
+FORWARD_METHOD(GetEnteredGamepadTextInput);
+FORWARD_METHOD(GetSteamUILanguage);
+FORWARD_METHOD(IsSteamRunningInVR);
+FORWARD_METHOD(SetOverlayNotificationInset);
+FORWARD_METHOD(IsSteamInBigPictureMode);
+FORWARD_METHOD(StartVRDashboard);
+
 
 uint32  ISteamUtils_::GetSecondsSinceAppActive()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  uint32  result = this->internal->GetSecondsSinceAppActive();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetSecondsSinceAppActive");
+  return Forward<Method_GetSecondsSinceAppActive, true>::call(&point, this->internal);
 }
 
 
 uint32  ISteamUtils_::GetSecondsSinceComputerActive()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  uint32  result = this->internal->GetSecondsSinceComputerActive();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetSecondsSinceComputerActive");
+  return Forward<Method_GetSecondsSinceComputerActive, true>::call(&point, this->internal);
 }
 
 
 EUniverse  ISteamUtils_::GetConnectedUniverse()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  EUniverse  result = this->internal->GetConnectedUniverse();
-  TRACE("() = (EUniverse )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetConnectedUniverse");
+  return Forward<Method_GetConnectedUniverse, true>::call(&point, this->internal);
 }
 
 
 uint32  ISteamUtils_::GetServerRealTime()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  uint32  result = this->internal->GetServerRealTime();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetServerRealTime");
+  return Forward<Method_GetServerRealTime, true>::call(&point, this->internal);
 }
 
 
 char * ISteamUtils_::GetIPCountry()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  char * result = this->internal->GetIPCountry();
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetIPCountry");
+  return Forward<Method_GetIPCountry, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUtils_::GetImageSize(int  iImage, uint32 * pnWidth, uint32 * pnHeight)
 {
-  TRACE("((ISteamUtils *)%p, (int )%d, (uint32 *)%d, (uint32 *)%d)\n", this, iImage, pnWidth, pnHeight);
-  bool  result = this->internal->GetImageSize(iImage, pnWidth, pnHeight);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetImageSize");
+  return Forward<Method_GetImageSize, true>::call(&point, this->internal, iImage, pnWidth, pnHeight);
 }
 
 
 bool  ISteamUtils_::GetImageRGBA(int  iImage, uint8 * pubDest, int  nDestBufferSize)
 {
-  TRACE("((ISteamUtils *)%p, (int )%d, (uint8 *)%p, (int )%d)\n", this, iImage, pubDest, nDestBufferSize);
-  bool  result = this->internal->GetImageRGBA(iImage, pubDest, nDestBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetImageRGBA", "2:3");
+  return Forward<Method_GetImageRGBA, true>::call(&point, this->internal, iImage, pubDest, nDestBufferSize);
 }
 
 
 bool  ISteamUtils_::GetCSERIPPort(uint32 * unIP, uint16 * usPort)
 {
-  TRACE("((ISteamUtils *)%p, (uint32 *)%d, (uint16 *)%d)\n", this, unIP, usPort);
-  bool  result = this->internal->GetCSERIPPort(unIP, usPort);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetCSERIPPort");
+  return Forward<Method_GetCSERIPPort, true>::call(&point, this->internal, unIP, usPort);
 }
 
 
 uint8  ISteamUtils_::GetCurrentBatteryPower()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  uint8  result = this->internal->GetCurrentBatteryPower();
-  TRACE("() = (uint8 )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetCurrentBatteryPower");
+  return Forward<Method_GetCurrentBatteryPower, true>::call(&point, this->internal);
 }
 
 
 uint32  ISteamUtils_::GetAppID()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  uint32  result = this->internal->GetAppID();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetAppID");
+  return Forward<Method_GetAppID, true>::call(&point, this->internal);
 }
 
 
 void  ISteamUtils_::SetOverlayNotificationPosition(ENotificationPosition  eNotificationPosition)
 {
-  TRACE("((ISteamUtils *)%p, (ENotificationPosition )%p)\n", this, eNotificationPosition);
-  this->internal->SetOverlayNotificationPosition(eNotificationPosition);
-  
+  static ProfilePoint point("ISteamUtils::SetOverlayNotificationPosition");
+  return Forward<Method_SetOverlayNotificationPosition, true>::call(&point, this->internal, eNotificationPosition);
 }
 
 
 bool  ISteamUtils_::IsAPICallCompleted(SteamAPICall_t  hSteamAPICall, bool * pbFailed)
 {
-  TRACE("((ISteamUtils *)%p, (SteamAPICall_t )%p, (bool *)%d)\n", this, hSteamAPICall, pbFailed);
-  bool  result = this->internal->IsAPICallCompleted(hSteamAPICall, pbFailed);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::IsAPICallCompleted");
+  return Forward<Method_IsAPICallCompleted, true>::call(&point, this->internal, hSteamAPICall, pbFailed);
 }
 
 
 ESteamAPICallFailure  ISteamUtils_::GetAPICallFailureReason(SteamAPICall_t  hSteamAPICall)
 {
-  TRACE("((ISteamUtils *)%p, (SteamAPICall_t )%p)\n", this, hSteamAPICall);
-  ESteamAPICallFailure  result = this->internal->GetAPICallFailureReason(hSteamAPICall);
-  TRACE("() = (ESteamAPICallFailure )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetAPICallFailureReason");
+  return Forward<Method_GetAPICallFailureReason, true>::call(&point, this->internal, hSteamAPICall);
 }
 
 
 bool  ISteamUtils_::GetAPICallResult(SteamAPICall_t  hSteamAPICall, void * pCallback, int  cubCallback, int  iCallbackExpected, bool * pbFailed)
 {
-  TRACE("((ISteamUtils *)%p, (SteamAPICall_t )%p, (void *)%p, (int )%d, (int )%d, (bool *)%d)\n", this, hSteamAPICall, pCallback, cubCallback, iCallbackExpected, pbFailed);
-  bool  result = this->internal->GetAPICallResult(hSteamAPICall, pCallback, cubCallback, iCallbackExpected, pbFailed);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetAPICallResult", "2:3");
+  return Forward<Method_GetAPICallResult, true>::call(&point, this->internal, hSteamAPICall, pCallback, cubCallback, iCallbackExpected, pbFailed);
 }
 
 
 void  ISteamUtils_::RunFrame()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
+  PROFILE("ISteamUtils::RunFrame");
+  TRACE_HOT("((ISteamUtils *)%p)\n", this);
   
   
 }
@@ -148,125 +137,92 @@ void  ISteamUtils_::RunFrame()
 
 uint32  ISteamUtils_::GetIPCCallCount()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  uint32  result = this->internal->GetIPCCallCount();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetIPCCallCount");
+  return Forward<Method_GetIPCCallCount, true>::call(&point, this->internal);
 }
 
 
 void  ISteamUtils_::SetWarningMessageHook(SteamAPIWarningMessageHook_t  pFunction)
 {
-  TRACE("((ISteamUtils *)%p, (SteamAPIWarningMessageHook_t )%p)\n", this, pFunction);
-  this->internal->SetWarningMessageHook(pFunction);
-  
+  static ProfilePoint point("ISteamUtils::SetWarningMessageHook");
+  return Forward<Method_SetWarningMessageHook, true>::call(&point, this->internal, pFunction);
 }
 
 
 bool  ISteamUtils_::IsOverlayEnabled()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  bool  result = this->internal->IsOverlayEnabled();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::IsOverlayEnabled");
+  return Forward<Method_IsOverlayEnabled, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUtils_::BOverlayNeedsPresent()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  bool  result = this->internal->BOverlayNeedsPresent();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::BOverlayNeedsPresent");
+  return Forward<Method_BOverlayNeedsPresent, true>::call(&point, this->internal);
 }
 
 
 SteamAPICall_t  ISteamUtils_::CheckFileSignature(char * szFileName)
 {
-  TRACE("((ISteamUtils *)%p, (char *)\"%s\")\n", this, szFileName);
-  SteamAPICall_t  result = this->internal->CheckFileSignature(szFileName);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::CheckFileSignature");
+  return Forward<Method_CheckFileSignature, true>::call(&point, this->internal, szFileName);
 }
 
 
 bool  ISteamUtils_::ShowGamepadTextInput(EGamepadTextInputMode  eInputMode, EGamepadTextInputLineMode  eLineInputMode, char * pchDescription, uint32  unCharMax, char * pchExistingText)
 {
-  TRACE("((ISteamUtils *)%p, (EGamepadTextInputMode )%p, (EGamepadTextInputLineMode )%p, (char *)\"%s\", (uint32 )%d, (char *)\"%s\")\n", this, eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText);
-  bool  result = this->internal->ShowGamepadTextInput(eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::ShowGamepadTextInput");
+  return Forward<Method_ShowGamepadTextInput, true>::call(&point, this->internal, eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText);
 }
 
 
 uint32  ISteamUtils_::GetEnteredGamepadTextLength()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  uint32  result = this->internal->GetEnteredGamepadTextLength();
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetEnteredGamepadTextLength");
+  return Forward<Method_GetEnteredGamepadTextLength, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUtils_::GetEnteredGamepadTextInput(char * pchText, uint32  cchText)
 {
-  TRACE("((ISteamUtils *)%p, (char *)\"%s\", (uint32 )%d)\n", this, pchText, cchText);
-  bool  result = this->internal->GetEnteredGamepadTextInput(pchText, cchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetEnteredGamepadTextInput", "1:2");
+  return Forward<Method_GetEnteredGamepadTextInput, true>::call(&point, this->internal, pchText, cchText);
 }
 
 
 char * ISteamUtils_::GetSteamUILanguage()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  char * result = this->internal->GetSteamUILanguage();
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::GetSteamUILanguage");
+  return Forward<Method_GetSteamUILanguage, true>::call(&point, this->internal);
 }
 
 
 bool  ISteamUtils_::IsSteamRunningInVR()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  bool  result = this->internal->IsSteamRunningInVR();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::IsSteamRunningInVR");
+  return Forward<Method_IsSteamRunningInVR, true>::call(&point, this->internal);
 }
 
 
 void  ISteamUtils_::SetOverlayNotificationInset(int  nHorizontalInset, int  nVerticalInset)
 {
-  TRACE("((ISteamUtils *)%p, (int )%d, (int )%d)\n", this, nHorizontalInset, nVerticalInset);
-  this->internal->SetOverlayNotificationInset(nHorizontalInset, nVerticalInset);
-  
+  static ProfilePoint point("ISteamUtils::SetOverlayNotificationInset");
+  return Forward<Method_SetOverlayNotificationInset, true>::call(&point, this->internal, nHorizontalInset, nVerticalInset);
 }
 
 
 bool  ISteamUtils_::IsSteamInBigPictureMode()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  bool  result = this->internal->IsSteamInBigPictureMode();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamUtils::IsSteamInBigPictureMode");
+  return Forward<Method_IsSteamInBigPictureMode, true>::call(&point, this->internal);
 }
 
 
 void  ISteamUtils_::StartVRDashboard()
 {
-  TRACE("((ISteamUtils *)%p)\n", this);
-  this->internal->StartVRDashboard();
-  
+  static ProfilePoint point("ISteamUtils::StartVRDashboard");
+  return Forward<Method_StartVRDashboard, true>::call(&point, this->internal);
 }
 ISteamUtils_::ISteamUtils_(ISteamUtils * towrap)
 {
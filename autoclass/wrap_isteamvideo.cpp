@@ -1,20 +1,19 @@
 #include <steam_api_.h>
+FORWARD_METHOD(GetVideoURL);
+FORWARD_METHOD(IsBroadcasting);
+
 
 void  ISteamVideo_::GetVideoURL(AppId_t  unVideoAppID)
 {
-  TRACE("((ISteamVideo *)%p, (AppId_t )%p)\n", this, unVideoAppID);
-  this->internal->GetVideoURL(unVideoAppID);
-  
+  static ProfilePoint point("ISteamVideo::GetVideoURL");
+  return Forward<Method_GetVideoURL>::call(&point, this->internal, unVideoAppID);
 }
 
 
 bool  ISteamVideo_::IsBroadcasting(int * pnNumViewers)
 {
-  TRACE("((ISteamVideo *)%p, (int *)%d)\n", this, pnNumViewers);
-  bool  result = this->internal->IsBroadcasting(pnNumViewers);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("ISteamVideo::IsBroadcasting");
+  return Forward<Method_IsBroadcasting>::call(&point, this->internal, pnNumViewers);
 }
 ISteamVideo_::ISteamVideo_(ISteamVideo * towrap)
 {
@@ -0,0 +1,158 @@
+// Startup cost of an engine fetching all its interfaces through
+// ISteamClient_::GetISteamGenericInterface, now that each result is wrapped
+// through the version table (wrapGenericInterface() in versions.h), against
+// handing out the raw pointer as before. Every startup runs in a fresh
+// child process, so the wrappers are created and interned from scratch.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <sys/wait.h>
+#include <unistd.h>
+#define INTERFACE_WRAPPERS 256
+#define INTERFACE_SLOT_SIZE (2 * sizeof(void *))
+#define INTERN_REGISTRY_SIZE 16
+#define TRACE(...) do { } while (0)
+#define WARN(...) do { } while (0)
+#include "bench/version_table.h"
+
+// What intern.cpp provides, without its wine dependencies
+InterfaceSlot interfaceSlots[INTERFACE_WRAPPERS];
+std::atomic<intptr_t> interfaceInternals[INTERFACE_WRAPPERS];
+static std::mutex slotsLock;
+static unsigned slotsUsed = 0;
+
+InternedType::InternedType(const char *name): name(name), live(0), next(NULL) {}
+
+void *allocateInterfaceSlot(void *internal)
+{
+  std::lock_guard<std::mutex> guard(slotsLock);
+  if (slotsUsed == INTERFACE_WRAPPERS)
+    return NULL;
+  interfaceInternals[slotsUsed].store((intptr_t)internal, std::memory_order_release);
+  return interfaceSlots[slotsUsed++].storage;
+}
+
+void releaseInterfaceSlot(void *slot) {}
+
+// As many distinct interfaces as a large engine asks for
+#define INTERFACES 48
+
+template <int N> struct Interface
+{
+  virtual ~Interface() {}
+};
+
+template <int N> struct Wrapper
+{
+  Wrapper(Interface<N> *internal): internal(internal) {}
+  virtual void *get() { return internal; }
+  Interface<N> *internal;
+};
+
+template <int N> static void *wrapAs(void *internal, const char *version)
+{
+  return internInterface<Wrapper<N>, Interface<N> >("ISteamSomething",
+                                                    (Interface<N> *)internal, version);
+}
+
+template <int N> struct Fill
+{
+  static void into(std::vector<InterfaceWrap> &wraps)
+  {
+    Fill<N - 1>::into(wraps);
+    wraps.push_back(wrapAs<N - 1>);
+  }
+};
+template <> struct Fill<0>
+{
+  static void into(std::vector<InterfaceWrap> &wraps) {}
+};
+
+static Built built;
+static Built &versions()
+{
+  char name[64];
+  for (int i = 0; i < INTERFACES; i++)
+  {
+    snprintf(name, sizeof(name), "SteamSomething%02dInterface%03d", i, i % 20 + 1);
+    built.keys.push_back(name);
+  }
+  Fill<INTERFACES>::into(built.wraps);
+  build(built);
+  return built;
+}
+const VersionTable interfaceVersions = versions().table;
+
+// Stands in for the Linux GetISteamGenericInterface
+static void *internals[INTERFACES];
+__attribute__((noinline)) static void *genericInterface(int i, const char *version)
+{
+  return version != NULL ? internals[i] : NULL;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+// Nanoseconds for a first and a second round of queries
+static void startup(bool wrap, double *times)
+{
+  for (int round = 0; round < 2; round++)
+  {
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < INTERFACES; i++)
+    {
+      const char *version = built.keys[i].c_str();
+      void *result = genericInterface(i, version);
+      if (wrap)
+        result = wrapGenericInterface(result, version);
+      if (result == NULL)
+        abort();
+    }
+    times[round] = std::chrono::duration<double>(Clock::now() - start).count() * 1e9;
+  }
+}
+
+static void measure(bool wrap, int runs, double *best)
+{
+  best[0] = best[1] = 1e18;
+  for (int r = 0; r < runs; r++)
+  {
+    int fds[2];
+    if (pipe(fds) != 0)
+      abort();
+    pid_t child = fork();
+    if (child == 0)
+    {
+      double times[2];
+      startup(wrap, times);
+      if (write(fds[1], times, sizeof(times)) != sizeof(times))
+        _exit(1);
+      _exit(0);
+    }
+    double times[2];
+    if (read(fds[0], times, sizeof(times)) != sizeof(times))
+      abort();
+    waitpid(child, NULL, 0);
+    close(fds[0]);
+    close(fds[1]);
+    for (int i = 0; i < 2; i++)
+      if (times[i] < best[i])
+        best[i] = times[i];
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int runs = argc > 1 ? atoi(argv[1]) : 50;
+  for (int i = 0; i < INTERFACES; i++)
+    internals[i] = new char[16];
+  double raw[2], wrapped[2];
+  measure(false, runs, raw);
+  measure(true, runs, wrapped);
+  printf("%d interfaces by version string, best of %d startups\n", INTERFACES, runs);
+  printf("unwrapped       first %8.0f ns, again %6.0f ns\n", raw[0], raw[1]);
+  printf("wrapped         first %8.0f ns, again %6.0f ns\n", wrapped[0], wrapped[1]);
+  printf("per interface   first %8.1f ns, again %6.1f ns more\n",
+         (wrapped[0] - raw[0]) / INTERFACES, (wrapped[1] - raw[1]) / INTERFACES);
+  return 0;
+}
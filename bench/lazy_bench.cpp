@@ -0,0 +1,204 @@
+// Load time of a library standing in for steam_api.dll.so, linked against a
+// stand-in libsteam_api with a thousand functions as by default, and bound
+// to it through the LAZY_STEAM_API stubs of lazy.h. Each load runs in a
+// fresh child process. The real libsteam_api also pulls in its own
+// dependencies, which a lazy build spares processes that never use Steam;
+// pass its path to time that part as well.
+//
+// The same file builds the stand-ins (BENCH_LIBRARY, BENCH_EAGER and
+// BENCH_LAZY), see the Makefile.
+#define REPEAT10(m, p) m(p##0) m(p##1) m(p##2) m(p##3) m(p##4) \
+                       m(p##5) m(p##6) m(p##7) m(p##8) m(p##9)
+#define REPEAT100(m, p) REPEAT10(m, p##0) REPEAT10(m, p##1) REPEAT10(m, p##2) \
+  REPEAT10(m, p##3) REPEAT10(m, p##4) REPEAT10(m, p##5) REPEAT10(m, p##6) \
+  REPEAT10(m, p##7) REPEAT10(m, p##8) REPEAT10(m, p##9)
+// steam_1000 to steam_1999, so the number is also a decimal index
+#define FUNCTIONS(m) REPEAT100(m, 10) REPEAT100(m, 11) REPEAT100(m, 12) \
+  REPEAT100(m, 13) REPEAT100(m, 14) REPEAT100(m, 15) REPEAT100(m, 16) \
+  REPEAT100(m, 17) REPEAT100(m, 18) REPEAT100(m, 19)
+#define FIRST 1000
+#define LAST 1999
+
+#if defined(BENCH_LIBRARY)
+// Floating point arguments check that the lazy resolver keeps them
+#define DEFINE(n) extern "C" int steam_##n(int a, double b) { return a + (int)b + n; }
+FUNCTIONS(DEFINE)
+
+#elif defined(BENCH_EAGER) || defined(BENCH_LAZY)
+#ifdef BENCH_LAZY
+#include <dlfcn.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include "lazy.h"
+
+LAZY_RESOLVER;
+#define STUB(n) LAZY_SYMBOL(n, steam_##n)
+FUNCTIONS(STUB)
+void *steamSymbols[LAST + 1];
+const unsigned steamSymbolCount = LAST + 1;
+
+__attribute__((constructor)) static void fillSymbols()
+{
+#define ENTRY(n) steamSymbols[n] = LAZY_ENTRY(steam_##n);
+  FUNCTIONS(ENTRY)
+}
+
+static void *library = NULL;
+static std::once_flag opened;
+
+static unsigned long long missing()
+{
+  return 0;
+}
+
+// As lazy.cpp, with the library named by the benchmark
+void *bindSteamSymbol(unsigned index)
+{
+  std::call_once(opened, [] { library = dlopen(getenv("LAZY_BENCH_LIBRARY"), RTLD_NOW | RTLD_LOCAL); });
+  char name[32];
+  snprintf(name, sizeof(name), "steam_%u", index);
+  void *address = library != NULL ? dlsym(library, name) : NULL;
+  if (address == NULL)
+    address = (void *)missing;
+  __atomic_store_n(&steamSymbols[index], address, __ATOMIC_RELEASE);
+  return address;
+}
+#endif
+
+#define DECLARE(n) extern "C" int steam_##n(int a, double b);
+FUNCTIONS(DECLARE)
+// Every function is referenced, like the generated wrappers do
+#define REFERENCE(n) steam_##n,
+static int (*const functions[])(int, double) = { FUNCTIONS(REFERENCE) };
+
+// Stands in for SteamAPI_Init_ and a first call of the game
+extern "C" int dllInit(int index)
+{
+  return functions[index](1, 2.5);
+}
+
+#else
+#include <chrono>
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+typedef std::chrono::steady_clock Clock;
+
+static double since(Clock::time_point start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count() * 1e6;
+}
+
+// Microseconds to load the library and for its first call, which is when a
+// lazy build loads libsteam_api. Negative when the library did not load.
+static void startup(const char *path, double *times)
+{
+  Clock::time_point start = Clock::now();
+  void *dll = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  times[0] = since(start);
+  times[1] = -1;
+  if (dll == NULL)
+  {
+    times[0] = -1;
+    return;
+  }
+  int (*init)(int) = (int (*)(int))dlsym(dll, "dllInit");
+  times[2] = 0;
+  if (init == NULL)
+    return;
+  start = Clock::now();
+  int result = init(7);
+  times[1] = since(start);
+  // 1 + 2 + 1007 from steam_1007, 0 from the stub of a missing library
+  if (result != 1 + 2 + FIRST + 7 && result != 0)
+    abort();
+  times[2] = result;
+}
+
+static void measure(const char *path, int runs, double *best)
+{
+  best[0] = best[1] = 1e18;
+  best[2] = 0;
+  for (int r = 0; r < runs; r++)
+  {
+    int fds[2];
+    if (pipe(fds) != 0)
+      abort();
+    pid_t child = fork();
+    if (child == 0)
+    {
+      double times[3];
+      startup(path, times);
+      if (write(fds[1], times, sizeof(times)) != sizeof(times))
+        _exit(1);
+      _exit(0);
+    }
+    close(fds[1]);
+    double times[3];
+    if (read(fds[0], times, sizeof(times)) != sizeof(times))
+      abort();
+    waitpid(child, NULL, 0);
+    close(fds[0]);
+    for (int i = 0; i < 2; i++)
+      if (times[i] < 0 || (best[i] >= 0 && times[i] < best[i]))
+        best[i] = times[i];
+    best[2] = times[2];
+  }
+}
+
+static void report(const char *mode, const double *times)
+{
+  if (times[0] < 0)
+    printf("%-30s fails to load\n", mode);
+  else if (times[1] < 0)
+    printf("%-30s load %8.1f us\n", mode, times[0]);
+  else
+    printf("%-30s load %8.1f us, first call %8.1f us%s\n", mode, times[0], times[1],
+           times[2] == 0 ? " (returned 0)" : "");
+}
+
+int main(int argc, char **argv)
+{
+  int runs = argc > 2 ? atoi(argv[2]) : 50;
+  std::string dir = argv[0];
+  dir = dir.substr(0, dir.rfind('/') + 1);
+  if (dir.empty() || dir[0] != '/')
+  {
+    char cwd[4096];
+    if (getcwd(cwd, sizeof(cwd)) == NULL)
+      abort();
+    dir = std::string(cwd) + "/" + dir;
+  }
+  std::string library = dir + "lazy_steam_api.so";
+  std::string eager = dir + "lazy_eager.so", lazy = dir + "lazy_lazy.so";
+  setenv("LAZY_BENCH_LIBRARY", library.c_str(), 1);
+
+  double times[3];
+  printf("%d functions, best of %d startups\n", LAST - FIRST + 1, runs);
+  measure(eager.c_str(), runs, times);
+  report("linked", times);
+  measure(lazy.c_str(), runs, times);
+  report("LAZY_STEAM_API", times);
+  if (argc > 1)
+  {
+    measure(argv[1], runs, times);
+    report(argv[1], times);
+  }
+  // Without the library the linked build can not load at all
+  std::string moved = library + ".away";
+  if (rename(library.c_str(), moved.c_str()) == 0)
+  {
+    measure(eager.c_str(), 1, times);
+    report("linked, library missing", times);
+    measure(lazy.c_str(), 1, times);
+    report("LAZY_STEAM_API, library missing", times);
+    rename(moved.c_str(), library.c_str());
+  }
+  return 0;
+}
+#endif
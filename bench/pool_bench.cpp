@@ -0,0 +1,60 @@
+// Compares the WrappedCallback slab pool with plain new/delete for the
+// one-CCallResult-per-request pattern: a window of live wrappers is kept
+// while older ones are released and new ones allocated.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "pool.h"
+
+struct Wrapper
+{
+  Wrapper(void *p): internal(p), flags(0), id(0) {}
+  virtual ~Wrapper() {}
+  void *internal;
+  unsigned char flags;
+  int id;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+template <class Alloc, class Free>
+double churn(Alloc alloc, Free release, int window, long iterations)
+{
+  Wrapper **live = new Wrapper*[window]();
+  Clock::time_point start = Clock::now();
+  for (long i = 0; i < iterations; i++)
+  {
+    Wrapper *&slot = live[i % window];
+    if (slot != NULL)
+      release(slot);
+    slot = alloc((void *)i);
+  }
+  double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+  for (int i = 0; i < window; i++)
+    if (live[i] != NULL)
+      release(live[i]);
+  delete[] live;
+  return elapsed * 1e9 / iterations;
+}
+
+int main(int argc, char **argv)
+{
+  long iterations = argc > 1 ? atol(argv[1]) : 10000000;
+  for (int window = 16; window <= 4096; window *= 16)
+  {
+    SlabPool<Wrapper, 64> pool;
+    double pooled = churn([&](void *p) { return pool.create(p); },
+                          [&](Wrapper *w) { pool.release(w); }, window, iterations);
+    // As callbacks.cpp uses it
+    SlabPool<Wrapper, 64, 64> quarantined;
+    double delayed = churn([&](void *p) { return quarantined.create(p); },
+                           [&](Wrapper *w) { quarantined.release(w); }, window, iterations);
+    double heap = churn([](void *p) { return new Wrapper(p); },
+                        [](Wrapper *w) { delete w; }, window, iterations);
+    SlabPool<Wrapper, 64>::Stats stats = pool.stats();
+    printf("window %4d: pool %6.1f ns, quarantined pool %6.1f ns, new/delete %6.1f ns per allocation; "
+           "pool peak %u, %u slabs, %lu recycled\n",
+           window, pooled, delayed, heap, stats.peak, stats.slabs, stats.recycled);
+  }
+  return 0;
+}
@@ -0,0 +1,80 @@
+// Stress benchmark for the callback registry: several threads churn
+// register/unregister pairs while another one keeps looking entries up,
+// the way loader threads race with SteamAPI_RunCallbacks_.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <thread>
+#include <vector>
+#include "registry.h"
+
+struct Callback { int id; };
+
+struct LockedMap
+{
+  std::map<Callback*, Callback*> map;
+  std::mutex lock;
+  Callback *find(Callback *k) { std::lock_guard<std::mutex> g(lock); auto i = map.find(k); return i == map.end() ? NULL : i->second; }
+  Callback *insert(Callback *k, Callback *v) { std::lock_guard<std::mutex> g(lock); return map.insert(std::make_pair(k, v)).first->second; }
+  Callback *remove(Callback *k) { std::lock_guard<std::mutex> g(lock); Callback *v = map[k]; map.erase(k); return v; }
+};
+
+template <class Registry>
+void run(const char *name, Registry &registry, int writers, int perThread, double seconds)
+{
+  std::vector<Callback> callbacks(writers * perThread);
+  std::atomic<bool> stop(false);
+  std::atomic<long> churned(0), lookups(0), hits(0);
+  std::vector<std::thread> threads;
+  for (int w = 0; w < writers; w++)
+    threads.push_back(std::thread([&, w]() {
+      Callback *mine = &callbacks[w * perThread];
+      long n = 0;
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        for (int i = 0; i < perThread; i++)
+          registry.insert(&mine[i], &mine[i]);
+        for (int i = 0; i < perThread; i++)
+          registry.remove(&mine[i]);
+        n += perThread;
+      }
+      churned += n;
+    }));
+  threads.push_back(std::thread([&]() {
+    long n = 0, h = 0;
+    unsigned seed = 1;
+    while (!stop.load(std::memory_order_relaxed))
+    {
+      seed = seed * 1103515245 + 12345;
+      Callback *k = &callbacks[(seed >> 8) % callbacks.size()];
+      Callback *v = registry.find(k);
+      if (v != NULL && v != k)
+        abort();
+      h += v != NULL;
+      n++;
+    }
+    lookups += n;
+    hits += h;
+  }));
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  stop = true;
+  for (auto &t: threads)
+    t.join();
+  printf("%-18s %2d writers: %10.0f registrations/s %12.0f lookups/s (%.0f%% hits)\n",
+         name, writers, churned / seconds, lookups / seconds,
+         lookups ? 100.0 * hits / lookups : 0.0);
+}
+
+int main(int argc, char **argv)
+{
+  double seconds = argc > 1 ? atof(argv[1]) : 1.0;
+  for (int writers = 1; writers <= 4; writers *= 2)
+  {
+    PointerRegistry<Callback, Callback> registry(256);
+    LockedMap locked;
+    run("PointerRegistry", registry, writers, 512, seconds);
+    run("std::map + mutex", locked, writers, 512, seconds);
+  }
+  return 0;
+}
@@ -0,0 +1,73 @@
+// Per-call cost of a generated wrapper at each TRACE_LEVEL. TRACE mirrors
+// wine/debug.h: with the channel off it costs a flag test, and
+// WINE_NO_TRACE_MSGS (TRACE_LEVEL=0) drops the statement entirely.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+
+static volatile unsigned char channelFlags = 0;
+static FILE *sink;
+#define TRACE(...) do { if (channelFlags & 1) fprintf(sink, __VA_ARGS__); } while (0)
+#define NOTRACE(...) do { } while (0)
+
+struct Networking
+{
+  __attribute__((noinline)) bool SendP2PPacket(uint64_t steamID, const void *data, uint32_t size, int type, int channel)
+  {
+    return size > 0 && data != NULL && steamID != 0 && type + channel >= 0;
+  }
+};
+
+// Body of ISteamNetworking_::SendP2PPacket as the codegen emits it
+template <bool traced>
+struct Networking_
+{
+  Networking *internal;
+  __attribute__((noinline)) bool SendP2PPacket(uint64_t steamID, const void *data, uint32_t size, int type, int channel)
+  {
+    if (traced)
+      TRACE("((ISteamNetworking *)%p, (CSteamID )%llu, (void *)%p, (uint32 )%d, (EP2PSend )%d, (int )%d)\n",
+            this, (unsigned long long)steamID, data, size, type, channel);
+    else
+      NOTRACE();
+    bool result = this->internal->SendP2PPacket(steamID, data, size, type, channel);
+    if (traced)
+      TRACE("() = (bool )%d\n", result);
+    return result;
+  }
+};
+
+typedef std::chrono::steady_clock Clock;
+
+template <bool traced>
+double perCall(long iterations)
+{
+  Networking internal;
+  Networking_<traced> wrapper = {&internal};
+  char packet[64] = {0};
+  long sent = 0;
+  Clock::time_point start = Clock::now();
+  for (long i = 0; i < iterations; i++)
+    sent += wrapper.SendP2PPacket(76561197960265728ULL + (i & 7), packet, sizeof(packet), 2, (int)(i & 1));
+  double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+  if (sent != iterations)
+    abort();
+  return elapsed * 1e9 / iterations;
+}
+
+int main(int argc, char **argv)
+{
+  long iterations = argc > 1 ? atol(argv[1]) : 20000000;
+  sink = fopen("/dev/null", "w");
+  double untraced = perCall<false>(iterations);
+  double traced = perCall<true>(iterations);
+  channelFlags = 1;
+  double logging = perCall<true>(iterations / 20);
+  printf("TRACE_LEVEL=0: %6.2f ns per call, every interface\n", untraced);
+  printf("TRACE_LEVEL=1: %6.2f ns per call on hot interfaces, %6.2f ns on the others\n",
+         untraced, traced);
+  printf("TRACE_LEVEL=2: %6.2f ns per call, every interface\n", traced);
+  printf("WINEDEBUG=trace+steam_api: %6.2f ns per call (formatted to /dev/null)\n", logging);
+  return 0;
+}
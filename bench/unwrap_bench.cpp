@@ -0,0 +1,61 @@
+// Per-call cost of translating the instancePtr of a flat SteamAPI_ISteam*_
+// export from our wrapper to the internal interface, against passing it
+// through untouched and against a hash table lookup.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#define INTERFACE_WRAPPERS 256
+#define INTERFACE_SLOT_SIZE (2 * sizeof(void *))
+#define INTERN_REGISTRY_SIZE 16
+#define TRACE(...) do { } while (0)
+#define WARN(...) do { } while (0)
+#include "intern.h"
+
+InterfaceSlot interfaceSlots[INTERFACE_WRAPPERS];
+std::atomic<intptr_t> interfaceInternals[INTERFACE_WRAPPERS];
+
+// Stands in for the Linux flat export
+__attribute__((noinline)) static bool BLoggedOn(intptr_t instancePtr)
+{
+  return instancePtr != 0;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+template <class Translate>
+double perCall(Translate translate, intptr_t *instances, long iterations)
+{
+  long loggedOn = 0;
+  Clock::time_point start = Clock::now();
+  for (long i = 0; i < iterations; i++)
+    loggedOn += BLoggedOn(translate(instances[i & 15]));
+  double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+  if (loggedOn != iterations)
+    abort();
+  return elapsed * 1e9 / iterations;
+}
+
+int main(int argc, char **argv)
+{
+  long iterations = argc > 1 ? atol(argv[1]) : 100000000;
+  static long internals[16];
+  intptr_t wrappers[16], foreign[16];
+  PointerRegistry<void, void> table(INTERN_REGISTRY_SIZE);
+  for (int i = 0; i < 16; i++)
+  {
+    interfaceInternals[i * 3].store((intptr_t)&internals[i]);
+    wrappers[i] = (intptr_t)interfaceSlots[i * 3].storage;
+    foreign[i] = (intptr_t)&internals[i];
+    table.insert((void *)wrappers[i], &internals[i]);
+  }
+  double raw = perCall([](intptr_t p) { return p; }, wrappers, iterations);
+  double dense = perCall([](intptr_t p) { return unwrapInstance(p); }, wrappers, iterations);
+  double passed = perCall([](intptr_t p) { return unwrapInstance(p); }, foreign, iterations);
+  double hashed = perCall([&](intptr_t p) { return (intptr_t)table.find((void *)p); },
+                          wrappers, iterations);
+  printf("pass-through            %6.2f ns per call\n", raw);
+  printf("unwrapInstance, wrapper %6.2f ns per call (%+.2f)\n", dense, dense - raw);
+  printf("unwrapInstance, foreign %6.2f ns per call (%+.2f)\n", passed, passed - raw);
+  printf("PointerRegistry::find   %6.2f ns per call (%+.2f)\n", hashed, hashed - raw);
+  return 0;
+}
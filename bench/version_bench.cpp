@@ -0,0 +1,98 @@
+// Per-lookup cost of resolving the pchVersion of ISteamClient_::GetISteam*
+// to its wrapper through the generated perfect hash table (versions.h),
+// against a linear strcmp scan and a std::unordered_map.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#define INTERFACE_WRAPPERS 256
+#define INTERFACE_SLOT_SIZE (2 * sizeof(void *))
+#define INTERN_REGISTRY_SIZE 16
+#define TRACE(...) do { } while (0)
+#define WARN(...) do { } while (0)
+#include "bench/version_table.h"
+
+// Shaped like the version strings of a dozen SDK drops
+static const struct { const char *name; int first, last; } families[] = {
+  {"SteamClient%03d", 6, 17}, {"SteamUser%03d", 9, 19},
+  {"SteamFriends%03d", 1, 15}, {"SteamUtils%03d", 1, 7},
+  {"SteamMatchMaking%03d", 1, 9}, {"SteamMatchMakingServers%03d", 1, 2},
+  {"STEAMUSERSTATS_INTERFACE_VERSION%03d", 1, 11},
+  {"STEAMAPPS_INTERFACE_VERSION%03d", 1, 8}, {"SteamNetworking%03d", 1, 5},
+  {"STEAMREMOTESTORAGE_INTERFACE_VERSION%03d", 1, 13},
+  {"STEAMSCREENSHOTS_INTERFACE_VERSION%03d", 1, 2},
+  {"STEAMHTTP_INTERFACE_VERSION%03d", 1, 2}, {"SteamController%03d", 1, 3},
+  {"STEAMUGC_INTERFACE_VERSION%03d", 1, 7}, {"SteamGameServer%03d", 4, 12},
+  {"STEAMHTMLSURFACE_INTERFACE_VERSION_%03d", 1, 3},
+};
+
+typedef std::chrono::steady_clock Clock;
+
+template <class Find>
+double perLookup(Find find, const std::vector<const char *> &queries, long iterations)
+{
+  long found = 0;
+  Clock::time_point start = Clock::now();
+  for (long i = 0; i < iterations; i++)
+    found += find(queries[i % queries.size()]);
+  double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+  if (found == 0)
+    abort();
+  return elapsed * 1e9 / iterations;
+}
+
+int main(int argc, char **argv)
+{
+  long iterations = argc > 1 ? atol(argv[1]) : 10000000;
+  Built built;
+  char name[64];
+  for (auto &f: families)
+    for (int v = f.first; v <= f.last; v++)
+    {
+      snprintf(name, sizeof(name), f.name, v);
+      built.keys.push_back(name);
+    }
+  Clock::time_point started = Clock::now();
+  build(built);
+  double buildUs = std::chrono::duration<double>(Clock::now() - started).count() * 1e6;
+
+  std::unordered_map<std::string, const char *> map;
+  for (auto &k: built.keys)
+    map[k] = k.c_str();
+  // Copies, so no lookup can stop at a pointer comparison
+  std::vector<std::string> copies(built.keys);
+  copies.push_back("SteamUser999");
+  copies.push_back("SteamNotAnInterface001");
+  std::vector<const char *> queries;
+  for (auto &c: copies)
+    queries.push_back(c.c_str());
+  std::random_shuffle(queries.begin(), queries.end());
+
+  for (auto &k: built.keys)
+    if (findVersion(&built.table, k.c_str()) == NULL)
+      abort();
+  if (findVersion(&built.table, "SteamUser999") != NULL)
+    abort();
+
+  double hashed = perLookup([&](const char *v) {
+    return findVersion(&built.table, v) != NULL;
+  }, queries, iterations);
+  double scanned = perLookup([&](const char *v) {
+    for (auto &k: built.keys)
+      if (strcmp(k.c_str(), v) == 0)
+        return true;
+    return false;
+  }, queries, iterations / 10);
+  double mapped = perLookup([&](const char *v) {
+    return map.find(v) != map.end();
+  }, queries, iterations);
+  printf("%zu versions, table of %u slots and %u seeds built in %.1f us\n",
+         built.keys.size(), built.table.size, built.table.buckets, buildUs);
+  printf("perfect hash    %6.2f ns per lookup\n", hashed);
+  printf("strcmp scan     %6.2f ns per lookup\n", scanned);
+  printf("unordered_map   %6.2f ns per lookup\n", mapped);
+  return 0;
+}
@@ -0,0 +1,75 @@
+#ifndef STEAM_FORWARDER_BENCH_VERSION_TABLE
+#define STEAM_FORWARDER_BENCH_VERSION_TABLE
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "versions.h"
+
+// Builds a VersionTable the way buildVersionTable() does (versions.cpp),
+// without the wine headers it needs, for the benchmarks
+
+struct Built
+{
+  std::vector<std::string> keys;
+  // One per key, wrapNothing when empty
+  std::vector<InterfaceWrap> wraps;
+  std::vector<uint32_t> seeds;
+  std::vector<InterfaceVersion> slots;
+  VersionTable table;
+};
+
+static void *wrapNothing(void *internal, const char *version) { return internal; }
+
+static uint32_t nextPow2(uint32_t n)
+{
+  uint32_t result = 1;
+  while (result < n)
+    result *= 2;
+  return result;
+}
+
+static void build(Built &built)
+{
+  std::vector<std::string> &keys = built.keys;
+  uint32_t size = nextPow2(keys.size() * 2), buckets = nextPow2(keys.size() / 2);
+  std::vector<std::vector<int> > members(buckets);
+  for (size_t k = 0; k < keys.size(); k++)
+    members[versionHash(keys[k].c_str(), keys[k].size()) & (buckets - 1)].push_back(k);
+  std::vector<int> order(buckets);
+  for (uint32_t b = 0; b < buckets; b++)
+    order[b] = b;
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return members[a].size() > members[b].size();
+  });
+  std::vector<int> slots(size, -1);
+  built.seeds.assign(buckets, 0);
+  for (int b: order)
+  {
+    for (uint32_t seed = 1; !members[b].empty(); seed++)
+    {
+      std::vector<uint32_t> taken;
+      for (int k: members[b])
+      {
+        uint32_t slot = versionSlot(versionHash(keys[k].c_str(), keys[k].size()), seed) & (size - 1);
+        if (slots[slot] >= 0 || std::find(taken.begin(), taken.end(), slot) != taken.end())
+          break;
+        taken.push_back(slot);
+      }
+      if (taken.size() != members[b].size())
+        continue;
+      for (size_t i = 0; i < taken.size(); i++)
+        slots[taken[i]] = members[b][i];
+      built.seeds[b] = seed;
+      break;
+    }
+  }
+  for (int k: slots)
+  {
+    InterfaceWrap wrap = k < 0 || built.wraps.empty() ? wrapNothing : built.wraps[k];
+    InterfaceVersion slot = {k < 0 ? NULL : keys[k].c_str(), "ISteamSomething", wrap};
+    built.slots.push_back(slot);
+  }
+  VersionTable table = {built.seeds.data(), buckets, built.slots.data(), size};
+  built.table = table;
+}
+#endif
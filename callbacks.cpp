@@ -1,6 +1,29 @@
-#include <map>
+#include <deque>
+#include <mutex>
+#include <windows.h>
 #include "callbacks.h"
-std::map<WinCallback*, WrappedCallback*> callbackHolder;
+#include "callbackstats.h"
+#include "forwarder.h"
+#include "profiler.h"
+#include "recorder.h"
+#include "registry.h"
+#include "ring.h"
+#include "timer.h"
+PointerRegistry<WinCallback, WrappedCallback> callbackHolder(CALLBACK_REGISTRY_SIZE);
+CallbackPool callbackPool;
+
+static inline uint64_t shapeOf(int iCallback, int size)
+{
+  return (uint64_t)(uint32_t)iCallback << 32 | (uint32_t)size;
+}
+static inline int shapeCallback(uint64_t shape)
+{
+  return (int)(uint32_t)(shape >> 32);
+}
+static inline int shapeSize(uint64_t shape)
+{
+  return (int)(uint32_t)shape;
+}
 
 WrappedCallback::WrappedCallback(WinCallback *wc)
 {
@@ -8,70 +31,400 @@ WrappedCallback::WrappedCallback(WinCallback *wc)
   internal = wc;
   m_nCallbackFlags = wc->m_nCallbackFlags;
   m_iCallback = wc->m_iCallback;
+  // Cached here because the pump thread must not call into the game
+  shape.store(shapeOf(wc->m_iCallback, wc->GetCallbackSizeBytes()), std::memory_order_relaxed);
+  registeredAt = 0;
+  generation = CallbackPool::generation(this);
 }
 
 #define ARGSBACK this->internal->m_nCallbackFlags = this->m_nCallbackFlags; this->internal->m_iCallback = this->m_iCallback;
 
+// The whole generation, a slot released twice is odd again
+#define CHECKLIVE if (!CallbackPool::isLive(this, this->generation)) { ERR("((WrappedCallback*)%p) was released, callback %d dropped\n", this, shapeCallback(this->shape.load(std::memory_order_relaxed))); return; }
+
+static void routeCallback(WrappedCallback *wrapper, int iCallback, int size, void *pvParam,
+                          bool bCallResult, bool bIOFailure, SteamAPICall_t hSteamAPICall);
+
 void WrappedCallback::Run(void *pvParams)
 {
   TRACE("((WrappedCallback*)%p, (void*)%p)\n", this, pvParams);
-  ARGSBACK;
-  this->internal->Run(pvParams);
+  CHECKLIVE;
+  uint64_t shape = this->shape.load(std::memory_order_relaxed);
+  routeCallback(this, shapeCallback(shape), shapeSize(shape), pvParams, false, false, 0);
 }
 void WrappedCallback::Run(void *pvParams, bool onIOFailure, SteamAPICall_t hSteamAPICall)
 {
   TRACE("((WrappedCallback*)%p, (void*)%p), (bool)%d, (SteamAPICall_t)%p\n", this, pvParams, onIOFailure, hSteamAPICall);
+  CHECKLIVE;
+  uint64_t shape = this->shape.load(std::memory_order_relaxed);
+  routeCallback(this, shapeCallback(shape), shapeSize(shape), pvParams, true, onIOFailure,
+                hSteamAPICall);
+}
+void WrappedCallback::Deliver(void *pvParams, bool bCallResult, bool onIOFailure, SteamAPICall_t hSteamAPICall)
+{
   ARGSBACK;
-  this->internal->Run(pvParams, onIOFailure, hSteamAPICall);
+  if (recorderEnabled)
+    recordDelivery(this->m_iCallback, pvParams, shapeSize(this->shape.load(std::memory_order_relaxed)),
+                   bCallResult, onIOFailure, hSteamAPICall);
+  uint64_t start = callbackStatsEnabled ? monotonicNs() : 0;
+  if (bCallResult)
+    this->internal->Run(pvParams, onIOFailure, hSteamAPICall);
+  else
+    this->internal->Run(pvParams);
+  if (callbackStatsEnabled)
+  {
+    if (bCallResult && this->registeredAt != 0)
+      recordCallResultWait(this->m_iCallback, start - this->registeredAt);
+    recordCallback(this->m_iCallback, monotonicNs() - start);
+  }
+}
+void WrappedCallback::SetRegistered(uint64_t when)
+{
+  this->registeredAt = when;
 }
 int WrappedCallback::GetCallbackSizeBytes()
 {
   TRACE("((WrappedCallback)%p)\n", this);
-  int result = this->internal->GetCallbackSizeBytes();
-  TRACE("() = %d\n", result);
-  return result;
+  if (!CallbackPool::isLive(this, this->generation))
+  {
+    ERR("((WrappedCallback*)%p) was released\n", this);
+    return 0;
+  }
+  int bytes = shapeSize(this->shape.load(std::memory_order_relaxed));
+  TRACE("() = %d\n", bytes);
+  return bytes;
+}
+void WrappedCallback::Refresh()
+{
+  m_iCallback = internal->m_iCallback;
+  shape.store(shapeOf(m_iCallback, internal->GetCallbackSizeBytes()), std::memory_order_relaxed);
 }
 WrappedCallback *wrap(WinCallback *p)
 {
-  WrappedCallback *result= callbackHolder[p];
+  WrappedCallback *result = callbackHolder.find(p);
   if (result == NULL)
   {
-    result = new WrappedCallback(p);
-    callbackHolder[p] = result;
+    WrappedCallback *created = callbackPool.create(p);
+    result = callbackHolder.insert(p, created);
+    // Another thread may have registered the same callback meanwhile
+    if (result != created)
+      callbackPool.release(created);
+    else if (TRACE_ON(steam_api))
+      traceCallbackPool();
   }
+  else
+    result->Refresh();
   TRACE("Wrapper for (WinCallback*)%p is (WrappedCallback*)%p\n", p, result);
   return result;
 }
+void traceCallbackPool()
+{
+  CallbackPool::Stats stats = callbackPool.stats();
+  TRACE("Callback pool: %u live, %u peak, %u slots in %u slabs, %lu allocations (%lu recycled)\n",
+        stats.live, stats.peak, stats.capacity, stats.slabs, stats.allocations, stats.recycled);
+}
+WrappedCallback *wrapped(WinCallback *p)
+{
+  WrappedCallback *result = callbackHolder.find(p);
+  if (result == NULL)
+    WARN("(WinCallback*)%p was never registered\n", p);
+  return result;
+}
+
+// Callback pump: with STEAMFORWARDER_CALLBACK_THREAD=<ms> set, a separate
+// thread runs SteamAPI_RunCallbacks() every <ms> milliseconds and queues what
+// Steam delivers. SteamAPI_RunCallbacks_ then only hands the queued callbacks
+// over to the game.
+struct PendingCallback
+{
+  WrappedCallback *wrapper;
+  uint32_t generation;
+  int iCallback;
+  bool callResult;
+  bool ioFailure;
+  SteamAPICall_t hSteamAPICall;
+  int size;
+  void *heap;
+  unsigned char buffer[CALLBACK_PAYLOAD_INLINE];
+  void *payload() { return heap != NULL ? heap : buffer; }
+};
+
+static SpscRing<PendingCallback> *pending = NULL;
+// Used once the ring is full, until the game thread catches up
+static std::deque<PendingCallback> overflow;
+static std::mutex overflowLock;
+static std::atomic<bool> overflowUsed(false);
+static std::atomic<bool> pumpRunning(false);
+static HANDLE pumpThread = NULL;
+static DWORD pumpInterval;
+static __thread bool onPumpThread = false;
+
+// Frame budget: with STEAMFORWARDER_CALLBACK_BUDGET=<us> set, SteamAPI_RunCallbacks_
+// stops delivering once <us> microseconds are spent and carries the remaining
+// callbacks over to the next call in their original order. Call results and
+// connection state changes are always delivered at once.
+static const int urgentCallbacks[] = {
+  SteamServersConnected_t::k_iCallback,
+  SteamServerConnectFailure_t::k_iCallback,
+  SteamServersDisconnected_t::k_iCallback,
+  IPCFailure_t::k_iCallback,
+  SocketStatusCallback_t::k_iCallback,
+  P2PSessionRequest_t::k_iCallback,
+  P2PSessionConnectFail_t::k_iCallback,
+};
+// Only touched by the game thread
+static std::deque<PendingCallback> carried;
+static uint64_t budgetNs = CALLBACK_BUDGET_US * 1000ull;
+static uint64_t frameStart;
+static bool inFrame = false;
+static bool callbacksConfigured = false;
+
+static bool withinBudget()
+{
+  return budgetNs == 0 || monotonicNs() - frameStart < budgetNs;
+}
+
+static bool mayDeliverNow(bool bCallResult, int iCallback)
+{
+  if (bCallResult)
+    return true;
+  for (size_t i = 0; i < sizeof(urgentCallbacks) / sizeof(urgentCallbacks[0]); i++)
+    if (urgentCallbacks[i] == iCallback)
+      return true;
+  // Anything delivered before the carried callbacks would break their order
+  if (!carried.empty())
+    return false;
+  return !inFrame || withinBudget();
+}
+
+static void fillPending(PendingCallback *p, WrappedCallback *wrapper, int iCallback, int size, void *pvParam,
+                        bool bCallResult, bool bIOFailure, SteamAPICall_t hSteamAPICall)
+{
+  p->wrapper = wrapper;
+  p->generation = CallbackPool::generation(wrapper);
+  p->iCallback = iCallback;
+  p->callResult = bCallResult;
+  p->ioFailure = bIOFailure;
+  p->hSteamAPICall = hSteamAPICall;
+  p->size = size;
+  p->heap = size > CALLBACK_PAYLOAD_INLINE ? malloc(size) : NULL;
+  if (size > 0)
+    memcpy(p->payload(), pvParam, size);
+}
+
+static void queueCallback(WrappedCallback *wrapper, int iCallback, int size, void *pvParam,
+                          bool bCallResult, bool bIOFailure, SteamAPICall_t hSteamAPICall)
+{
+  PendingCallback *slot;
+  if (!overflowUsed.load(std::memory_order_acquire) && (slot = pending->reserve()) != NULL)
+  {
+    fillPending(slot, wrapper, iCallback, size, pvParam, bCallResult, bIOFailure, hSteamAPICall);
+    pending->commit();
+    return;
+  }
+  std::lock_guard<std::mutex> guard(overflowLock);
+  overflow.push_back(PendingCallback());
+  fillPending(&overflow.back(), wrapper, iCallback, size, pvParam, bCallResult, bIOFailure, hSteamAPICall);
+  overflowUsed.store(true, std::memory_order_release);
+}
+
+static void deliverPending(PendingCallback *p)
+{
+  if (CallbackPool::isLive(p->wrapper, p->generation))
+    p->wrapper->Deliver(p->payload(), p->callResult, p->ioFailure, p->hSteamAPICall);
+  else
+    TRACE("(WrappedCallback*)%p was released before delivery, dropped\n", p->wrapper);
+  free(p->heap);
+}
+
+static void routeCallback(WrappedCallback *wrapper, int iCallback, int size, void *pvParam,
+                          bool bCallResult, bool bIOFailure, SteamAPICall_t hSteamAPICall)
+{
+  if (onPumpThread)
+    queueCallback(wrapper, iCallback, size, pvParam, bCallResult, bIOFailure, hSteamAPICall);
+  else if (mayDeliverNow(bCallResult, iCallback))
+    wrapper->Deliver(pvParam, bCallResult, bIOFailure, hSteamAPICall);
+  else
+  {
+    carried.push_back(PendingCallback());
+    fillPending(&carried.back(), wrapper, iCallback, size, pvParam, bCallResult, bIOFailure, hSteamAPICall);
+  }
+}
+
+static void dispatchQueued(PendingCallback *p)
+{
+  if (mayDeliverNow(p->callResult, p->iCallback))
+    deliverPending(p);
+  else
+    carried.push_back(*p);
+}
+
+static void deliverCarried()
+{
+  while (!carried.empty() && withinBudget())
+  {
+    PendingCallback p = carried.front();
+    carried.pop_front();
+    deliverPending(&p);
+  }
+  if (!carried.empty())
+    TRACE("Frame budget spent, %u callbacks carried over\n", (unsigned)carried.size());
+}
+
+static void dispatchPending()
+{
+  PendingCallback *p;
+  while ((p = pending->front()) != NULL)
+  {
+    dispatchQueued(p);
+    pending->release();
+  }
+  if (overflowUsed.load(std::memory_order_acquire))
+  {
+    std::deque<PendingCallback> late;
+    {
+      std::lock_guard<std::mutex> guard(overflowLock);
+      late.swap(overflow);
+      overflowUsed.store(false, std::memory_order_release);
+    }
+    for (size_t i = 0; i < late.size(); i++)
+      dispatchQueued(&late[i]);
+  }
+}
+
+static DWORD WINAPI callbackPump(void *arg)
+{
+  onPumpThread = true;
+  while (pumpRunning.load(std::memory_order_acquire))
+  {
+    SteamAPI_RunCallbacks();
+    Sleep(pumpInterval);
+  }
+  return 0;
+}
+
+static void startCallbackPump()
+{
+  const char *interval = getenv("STEAMFORWARDER_CALLBACK_THREAD");
+  if (interval == NULL || atoi(interval) <= 0)
+    return;
+  pumpInterval = atoi(interval);
+  pending = new SpscRing<PendingCallback>(CALLBACK_QUEUE_SIZE);
+  pumpRunning.store(true, std::memory_order_release);
+  pumpThread = CreateThread(NULL, 0, callbackPump, NULL, 0, NULL);
+  if (pumpThread == NULL)
+  {
+    ERR("Cannot start callback pump thread, callbacks are run by the game thread\n");
+    pumpRunning.store(false, std::memory_order_release);
+    delete pending;
+    pending = NULL;
+    return;
+  }
+  TRACE("Callback pump started, runs every %lu ms\n", pumpInterval);
+}
+
+static void configureCallbacks()
+{
+  callbacksConfigured = true;
+  const char *budget = getenv("STEAMFORWARDER_CALLBACK_BUDGET");
+  if (budget != NULL)
+    budgetNs = atoi(budget) * 1000ull;
+  if (budgetNs > 0)
+    TRACE("Callbacks are delivered within %llu us per frame\n", budgetNs / 1000);
+  startCallbackPump();
+}
+
+void callbacksShutdown()
+{
+  if (pumpThread != NULL)
+  {
+    pumpRunning.store(false, std::memory_order_release);
+    WaitForSingleObject(pumpThread, INFINITE);
+    CloseHandle(pumpThread);
+    pumpThread = NULL;
+    // Steam is going away, nothing queued will be delivered
+    PendingCallback *p;
+    while ((p = pending->front()) != NULL)
+    {
+      free(p->heap);
+      pending->release();
+    }
+    for (size_t i = 0; i < overflow.size(); i++)
+      free(overflow[i].heap);
+    overflow.clear();
+    overflowUsed.store(false, std::memory_order_release);
+    delete pending;
+    pending = NULL;
+  }
+  for (size_t i = 0; i < carried.size(); i++)
+    free(carried[i].heap);
+  carried.clear();
+  callbacksConfigured = false;
+  if (TRACE_ON(steam_api))
+    traceCallbackPool();
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
+void SteamAPI_RunCallbacks_()
+{
+  PROFILE("SteamAPI_RunCallbacks");
+  if (!callbacksConfigured)
+    configureCallbacks();
+  callbackStatsPoll();
+  forwarderNewFrame();
+  frameStart = monotonicNs();
+  inFrame = true;
+  deliverCarried();
+  if (pending != NULL)
+    dispatchPending();
+  else
+    SteamAPI_RunCallbacks();
+  inFrame = false;
+  // Not a Forward<> wrapper, so the replay (replay.h) learns about the frames here
+  if (recorderEnabled)
+    recordCall(&profilePoint, "", NULL, '\0', 0, frameStart, monotonicNs() - frameStart);
+}
 void SteamAPI_RegisterCallback_(class WinCallback * pCallback, int iCallback)
 {
+  PROFILE("SteamAPI_RegisterCallback");
   TRACE("((class WinCallback *)%p, (int)%d)\n", pCallback, iCallback);
   WrappedCallback* cw = wrap(pCallback);
   SteamAPI_RegisterCallback(cw, iCallback);
 }
 void SteamAPI_UnregisterCallback_(class WinCallback * pCallback)
 {
+  PROFILE("SteamAPI_UnregisterCallback");
   TRACE("((class WinCallback *)%p)\n", pCallback);
-  WrappedCallback* cw = wrap(pCallback);
+  WrappedCallback* cw = wrapped(pCallback);
+  if (cw == NULL)
+    return;
   SteamAPI_UnregisterCallback(cw);
-  callbackHolder.erase(pCallback);
-  delete cw;
+  // Only the thread which took it out of the registry gives the slot back
+  if (callbackHolder.remove(pCallback) == cw)
+    callbackPool.release(cw);
 }
 void SteamAPI_RegisterCallResult_(class WinCallback * pCallback, SteamAPICall_t hAPICall)
 {
+  PROFILE("SteamAPI_RegisterCallResult");
   TRACE("((class WinCallback *)%p, (SteamAPICall_t)%p)\n", pCallback, hAPICall);
   WrappedCallback* cw = wrap(pCallback);
+  if (callbackStatsEnabled)
+    cw->SetRegistered(monotonicNs());
   SteamAPI_RegisterCallResult(cw, hAPICall);
 }
 void SteamAPI_UnregisterCallResult_(class WinCallback * pCallback, SteamAPICall_t hAPICall)
 {
+  PROFILE("SteamAPI_UnregisterCallResult");
   TRACE("((class WinCallback *)%p, (SteamAPICall_t)%p)\n", pCallback, hAPICall);
-  WrappedCallback* cw = wrap(pCallback);
+  WrappedCallback* cw = wrapped(pCallback);
+  if (cw == NULL)
+    return;
   SteamAPI_UnregisterCallResult(cw, hAPICall);
-  callbackHolder.erase(pCallback);
-  delete cw;
+  // Only the thread which took it out of the registry gives the slot back
+  if (callbackHolder.remove(pCallback) == cw)
+    callbackPool.release(cw);
 }
 #ifdef __cplusplus
 }
@@ -1,4 +1,5 @@
 #include "config.h"
+#include "pool.h"
 
 class WinCallback
 {
@@ -17,7 +18,24 @@ public:
   virtual void Run(void *pvParam);
   virtual void Run(void *pvParam, bool bIOFailure, SteamAPICall_t hSteamAPICall);
   virtual int GetCallbackSizeBytes();
+  void Deliver(void *pvParam, bool bCallResult, bool bIOFailure, SteamAPICall_t hSteamAPICall);
+  void SetRegistered(uint64_t when);
+  // A wrapper outlives a completed call result and is reused when the game
+  // registers the same object again, maybe for another callback type
+  void Refresh();
+  // Generation of the pool slot while this wrapper is live
+  uint32_t generation;
 private:
   WinCallback *internal;
+  // Callback ID in the high half, size in the low one: read together by
+  // the pump thread, which must not call into the game, while Refresh()
+  // changes them
+  std::atomic<uint64_t> shape;
+  uint64_t registeredAt;
 };
 
+
+typedef SlabPool<WrappedCallback, CALLBACK_POOL_SLAB, CALLBACK_POOL_QUARANTINE> CallbackPool;
+extern CallbackPool callbackPool;
+void traceCallbackPool();
+void callbacksShutdown();
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <signal.h>
+#include <stdio.h>
+#include <vector>
+#include "config.h"
+#include "callbackstats.h"
+#include "histogram.h"
+
+// STEAMFORWARDER_CALLBACK_STATS=<file> enables the statistics and names the
+// file they are appended to, "-" stands for stderr. They are written on
+// SteamAPI_Shutdown_ and, with STEAMFORWARDER_STATS_SIGNAL=<signal number>,
+// on the first SteamAPI_RunCallbacks_ after that signal arrived.
+struct CallbackStats
+{
+  std::atomic<int> id;
+  Histogram run;
+  Histogram wait;
+};
+
+// Zero initialized, id 0 marks a free slot
+static CallbackStats table[CALLBACK_STATS_SIZE];
+// Shared by all callback IDs which did not fit into the table
+static CallbackStats other;
+static const char *statsPath = NULL;
+static volatile sig_atomic_t dumpRequested = 0;
+
+static void requestDump(int sig)
+{
+  dumpRequested = 1;
+}
+
+static bool callbackStatsInit()
+{
+  statsPath = getenv("STEAMFORWARDER_CALLBACK_STATS");
+  if (statsPath == NULL)
+    return false;
+  const char *sig = getenv("STEAMFORWARDER_STATS_SIGNAL");
+  if (sig != NULL && atoi(sig) > 0)
+  {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = requestDump;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(atoi(sig), &action, NULL) != 0)
+      ERR("Cannot install handler for signal %d\n", atoi(sig));
+  }
+  return true;
+}
+
+bool callbackStatsEnabled = callbackStatsInit();
+
+static CallbackStats *statsFor(int iCallback)
+{
+  unsigned i = ((unsigned)iCallback * 2654435761u) % CALLBACK_STATS_SIZE;
+  for (unsigned n = 0; n < CALLBACK_STATS_SIZE; n++, i = (i + 1) % CALLBACK_STATS_SIZE)
+  {
+    int seen = table[i].id.load(std::memory_order_acquire);
+    if (seen == iCallback)
+      return &table[i];
+    if (seen == 0)
+    {
+      if (table[i].id.compare_exchange_strong(seen, iCallback, std::memory_order_acq_rel) ||
+          seen == iCallback)
+        return &table[i];
+    }
+  }
+  return &other;
+}
+
+void recordCallback(int iCallback, uint64_t runNs)
+{
+  statsFor(iCallback)->run.add(runNs);
+}
+
+void recordCallResultWait(int iCallback, uint64_t waitNs)
+{
+  statsFor(iCallback)->wait.add(waitNs);
+}
+
+void callbackStatsPoll()
+{
+  if (dumpRequested)
+  {
+    dumpRequested = 0;
+    callbackStatsDump();
+  }
+}
+
+static bool byRunTime(const CallbackStats *a, const CallbackStats *b)
+{
+  return a->run.total.load(std::memory_order_relaxed) > b->run.total.load(std::memory_order_relaxed);
+}
+
+static void dumpHistogram(FILE *out, const Histogram &h)
+{
+  fprintf(out, " %9llu %9.1f %9.1f %9.1f %9.1f", (unsigned long long)h.count.load(std::memory_order_relaxed),
+          h.mean() / 1000.0, h.percentile(0.5) / 1000.0, h.percentile(0.99) / 1000.0,
+          h.max.load(std::memory_order_relaxed) / 1000.0);
+}
+
+void callbackStatsDump()
+{
+  if (!callbackStatsEnabled)
+    return;
+  std::vector<const CallbackStats*> entries;
+  for (unsigned i = 0; i < CALLBACK_STATS_SIZE; i++)
+    if (table[i].id.load(std::memory_order_acquire) != 0)
+      entries.push_back(&table[i]);
+  if (other.run.count.load(std::memory_order_relaxed) != 0)
+    entries.push_back(&other);
+  std::sort(entries.begin(), entries.end(), byRunTime);
+  bool toStderr = strcmp(statsPath, "-") == 0;
+  FILE *out = toStderr ? stderr : fopen(statsPath, "a");
+  if (out == NULL)
+  {
+    ERR("Cannot open %s\n", statsPath);
+    return;
+  }
+  fprintf(out, "%-9s %9s %9s %9s %9s %9s %9s %9s %9s %9s %9s\n", "callback",
+          "runs", "run avg", "run p50", "run p99", "run max",
+          "results", "wait avg", "wait p50", "wait p99", "wait max");
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+    int id = entries[i]->id.load(std::memory_order_relaxed);
+    if (entries[i] == &other)
+      fprintf(out, "%-9s", "other");
+    else
+      fprintf(out, "%-9d", id);
+    dumpHistogram(out, entries[i]->run);
+    dumpHistogram(out, entries[i]->wait);
+    fprintf(out, "\n");
+  }
+  fprintf(out, "(times in microseconds, percentiles are bucket upper bounds)\n");
+  if (toStderr)
+    fflush(out);
+  else
+    fclose(out);
+}
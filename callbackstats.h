@@ -0,0 +1,13 @@
+#ifndef STEAM_FORWARDER_CALLBACKSTATS
+#define STEAM_FORWARDER_CALLBACKSTATS
+#include <stdint.h>
+
+// Per callback ID delivery statistics, collected when
+// STEAMFORWARDER_CALLBACK_STATS is set
+extern bool callbackStatsEnabled;
+void recordCallback(int iCallback, uint64_t runNs);
+void recordCallResultWait(int iCallback, uint64_t waitNs);
+// Dumps the statistics if the dump signal arrived since the last call
+void callbackStatsPoll();
+void callbackStatsDump();
+#endif
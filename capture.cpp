@@ -0,0 +1,301 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <time.h>
+#include "capture.h"
+#include "config.h"
+#include "timer.h"
+
+// pcapng block types and options
+#define PCAPNG_SECTION_HEADER 0x0a0d0d0a
+#define PCAPNG_INTERFACE_DESCRIPTION 1
+#define PCAPNG_INTERFACE_STATISTICS 5
+#define PCAPNG_ENHANCED_PACKET 6
+#define PCAPNG_BYTE_ORDER 0x1a2b3c4d
+#define PCAPNG_OPT_END 0
+#define PCAPNG_SHB_USERAPPL 4
+#define PCAPNG_IF_NAME 2
+#define PCAPNG_IF_TSRESOL 9
+#define PCAPNG_ISB_IFRECV 4
+#define PCAPNG_ISB_IFDROP 5
+
+// Filled by one producer, then handed to the writer by the sequence: a
+// slot at ring position p is free while its sequence is p, and written
+// when it is p + 1. The writer makes it free for position p + slots.
+struct CaptureSlot
+{
+  std::atomic<uint32_t> sequence;
+  uint32_t length;
+  uint64_t time;
+  CapturePacketHeader header;
+  unsigned char bytes[CAPTURE_SNAP_LENGTH];
+};
+
+static FILE *captureFile = NULL;
+static CaptureSlot *slots = NULL;
+static uint32_t mask = 0;
+alignas(64) static std::atomic<uint32_t> enqueueAt(0);
+alignas(64) static uint32_t dequeueAt = 0;
+static std::atomic<uint64_t> dropped(0);
+static uint64_t written = 0;
+// CLOCK_REALTIME - CLOCK_MONOTONIC when the capture started
+static uint64_t wallOffset = 0;
+
+// The writer thread is started by the first packet, not while the dll loads
+static std::mutex writerLock;
+static std::thread writer;
+static std::atomic<bool> writerStarted(false);
+static std::atomic<bool> stopping(false);
+
+static void putBlock(uint32_t type, const void *body, uint32_t size)
+{
+  uint32_t total = 12 + size;
+  fwrite(&type, 4, 1, captureFile);
+  fwrite(&total, 4, 1, captureFile);
+  fwrite(body, 1, size, captureFile);
+  fwrite(&total, 4, 1, captureFile);
+}
+
+// Options are padded to 4 bytes, bodies hold at most a few of them
+static void putOption(unsigned char *&p, uint16_t code, const void *value, uint16_t length)
+{
+  memcpy(p, &code, 2);
+  memcpy(p + 2, &length, 2);
+  memcpy(p + 4, value, length);
+  uint16_t padded = (length + 3) & ~3;
+  memset(p + 4 + length, 0, padded - length);
+  p += 4 + padded;
+}
+
+static void putOptionEnd(unsigned char *&p)
+{
+  memset(p, 0, 4);
+  p += 4;
+}
+
+static void putHeaders()
+{
+  unsigned char body[128];
+  unsigned char *p = body;
+  uint32_t byteOrder = PCAPNG_BYTE_ORDER;
+  uint16_t version[2] = {1, 0};
+  int64_t sectionLength = -1;
+  memcpy(p, &byteOrder, 4);
+  memcpy(p + 4, version, 4);
+  memcpy(p + 8, &sectionLength, 8);
+  p += 16;
+  const char *application = "steam_api forwarder";
+  putOption(p, PCAPNG_SHB_USERAPPL, application, strlen(application));
+  putOptionEnd(p);
+  putBlock(PCAPNG_SECTION_HEADER, body, p - body);
+
+  p = body;
+  uint16_t linkType[2] = {CAPTURE_LINKTYPE, 0};
+  uint32_t snapLength = sizeof(CapturePacketHeader) + CAPTURE_SNAP_LENGTH;
+  memcpy(p, linkType, 4);
+  memcpy(p + 4, &snapLength, 4);
+  p += 8;
+  const char *name = "ISteamNetworking";
+  putOption(p, PCAPNG_IF_NAME, name, strlen(name));
+  // 10^-9 seconds
+  unsigned char resolution = 9;
+  putOption(p, PCAPNG_IF_TSRESOL, &resolution, 1);
+  putOptionEnd(p);
+  putBlock(PCAPNG_INTERFACE_DESCRIPTION, body, p - body);
+}
+
+static void putTime(unsigned char *p, uint64_t time)
+{
+  uint64_t wall = time + wallOffset;
+  uint32_t parts[2] = {(uint32_t)(wall >> 32), (uint32_t)wall};
+  memcpy(p, parts, 8);
+}
+
+static void putPacket(const CaptureSlot *slot)
+{
+  uint32_t captured = slot->length < CAPTURE_SNAP_LENGTH ? slot->length : CAPTURE_SNAP_LENGTH;
+  uint32_t data = sizeof(CapturePacketHeader) + captured;
+  uint32_t padded = (data + 3) & ~3;
+  unsigned char head[20];
+  uint32_t interfaceId = 0;
+  uint32_t original = sizeof(CapturePacketHeader) + slot->length;
+  memcpy(head, &interfaceId, 4);
+  putTime(head + 4, slot->time);
+  memcpy(head + 12, &data, 4);
+  memcpy(head + 16, &original, 4);
+  uint32_t type = PCAPNG_ENHANCED_PACKET;
+  uint32_t total = 12 + sizeof(head) + padded;
+  static const unsigned char zeros[4] = {0};
+  fwrite(&type, 4, 1, captureFile);
+  fwrite(&total, 4, 1, captureFile);
+  fwrite(head, 1, sizeof(head), captureFile);
+  fwrite(&slot->header, 1, sizeof(CapturePacketHeader), captureFile);
+  fwrite(slot->bytes, 1, captured, captureFile);
+  fwrite(zeros, 1, padded - data, captureFile);
+  fwrite(&total, 4, 1, captureFile);
+}
+
+static void putStatistics()
+{
+  unsigned char body[64];
+  unsigned char *p = body;
+  uint32_t interfaceId = 0;
+  memcpy(p, &interfaceId, 4);
+  putTime(p + 4, monotonicNs());
+  p += 12;
+  uint64_t drops = dropped.load(std::memory_order_relaxed);
+  uint64_t packets = written + drops;
+  putOption(p, PCAPNG_ISB_IFRECV, &packets, 8);
+  putOption(p, PCAPNG_ISB_IFDROP, &drops, 8);
+  putOptionEnd(p);
+  putBlock(PCAPNG_INTERFACE_STATISTICS, body, p - body);
+}
+
+static bool captureInit()
+{
+  const char *path = getenv("STEAMFORWARDER_CAPTURE");
+  if (path == NULL || path[0] == '\0')
+    return false;
+  captureFile = fopen(path, "wb");
+  if (captureFile == NULL)
+  {
+    ERR("Cannot capture into %s\n", path);
+    return false;
+  }
+  setvbuf(captureFile, NULL, _IOFBF, CAPTURE_FILE_BUFFER);
+  uint32_t size = 2;
+  while (size < CAPTURE_RING_SLOTS)
+    size <<= 1;
+  mask = size - 1;
+  slots = new CaptureSlot[size];
+  for (uint32_t i = 0; i < size; i++)
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  wallOffset = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec - monotonicNs();
+  putHeaders();
+  TRACE("Capturing P2P packets into %s\n", path);
+  return true;
+}
+
+bool captureEnabled = captureInit();
+
+// Writes the slots filled so far, false if there were none
+static bool drain()
+{
+  bool any = false;
+  for (;;)
+  {
+    CaptureSlot *slot = &slots[dequeueAt & mask];
+    if (slot->sequence.load(std::memory_order_acquire) != dequeueAt + 1)
+      return any;
+    putPacket(slot);
+    written++;
+    slot->sequence.store(dequeueAt + mask + 1, std::memory_order_release);
+    dequeueAt++;
+    any = true;
+  }
+}
+
+static void writeLoop()
+{
+  while (!stopping.load(std::memory_order_acquire))
+  {
+    // An idle ring means a quiet moment for the disk
+    if (!drain())
+    {
+      fflush(captureFile);
+      std::this_thread::sleep_for(std::chrono::microseconds(CAPTURE_WRITER_SLEEP_US));
+    }
+  }
+  drain();
+}
+
+static void startWriter()
+{
+  std::lock_guard<std::mutex> guard(writerLock);
+  if (writerStarted.load(std::memory_order_relaxed) || stopping.load(std::memory_order_relaxed))
+    return;
+  writer = std::thread(writeLoop);
+  writerStarted.store(true, std::memory_order_release);
+}
+
+static void capture(CSteamID remote, int nChannel, uint8_t direction, uint8_t sendType,
+                    uint8_t flags, const void *data, uint32_t size)
+{
+  if (slots == NULL)
+    return;
+  if (!writerStarted.load(std::memory_order_acquire))
+    startWriter();
+  uint64_t now = monotonicNs();
+  uint32_t position = enqueueAt.load(std::memory_order_relaxed);
+  CaptureSlot *slot;
+  for (;;)
+  {
+    slot = &slots[position & mask];
+    int32_t lag = (int32_t)(slot->sequence.load(std::memory_order_acquire) - position);
+    if (lag == 0)
+    {
+      if (enqueueAt.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (lag < 0)
+    {
+      // The writer has not emptied this slot yet
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    else
+      position = enqueueAt.load(std::memory_order_relaxed);
+  }
+  slot->length = size;
+  slot->time = now;
+  slot->header.remote = remote.ConvertToUint64();
+  slot->header.channel = nChannel;
+  slot->header.direction = direction;
+  slot->header.sendType = sendType;
+  slot->header.flags = flags;
+  slot->header.reserved = 0;
+  if (data != NULL)
+    memcpy(slot->bytes, data, size < CAPTURE_SNAP_LENGTH ? size : CAPTURE_SNAP_LENGTH);
+  else
+    slot->length = 0;
+  slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+void captureSent(CSteamID remote, int nChannel, int eP2PSendType, const void *data, uint32_t size,
+                 bool sent)
+{
+  capture(remote, nChannel, CAPTURE_SENT, (uint8_t)eP2PSendType, sent ? 0 : CAPTURE_SEND_FAILED,
+          data, size);
+}
+
+void captureReceived(CSteamID remote, int nChannel, const void *data, uint32_t size)
+{
+  capture(remote, nChannel, CAPTURE_RECEIVED, CAPTURE_NO_SEND_TYPE, 0, data, size);
+}
+
+void captureShutdown()
+{
+  if (captureFile == NULL)
+    return;
+  {
+    std::lock_guard<std::mutex> guard(writerLock);
+    stopping.store(true, std::memory_order_release);
+  }
+  if (writer.joinable())
+    writer.join();
+  else
+    drain();
+  // Packets of threads still inside a networking call stay in the ring,
+  // which nobody empties any more
+  putStatistics();
+  fclose(captureFile);
+  captureFile = NULL;
+  TRACE("%llu P2P packets captured, %llu dropped\n", (unsigned long long)written,
+        (unsigned long long)dropped.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,52 @@
+#ifndef STEAM_FORWARDER_CAPTURE
+#define STEAM_FORWARDER_CAPTURE
+#include <stdint.h>
+
+// P2P packet capture, switched on with STEAMFORWARDER_CAPTURE=<file>.
+//
+// Every packet the game sends with SendP2PPacket or reads with
+// ReadP2PPacket is written to <file> in pcapng format, one interface of
+// link type LINKTYPE_USER0 (147) with nanosecond timestamps. The game's
+// threads only copy the packet into a lock-free ring; a writer thread of
+// the forwarder empties it into the file, so capturing costs a copy per
+// packet and never waits for the disk. When the ring is full the packet is
+// dropped, the drops are written in the interface statistics at shutdown.
+//
+// The data of every packet starts with a CapturePacketHeader, little
+// endian, followed by at most CAPTURE_SNAP_LENGTH bytes of the payload;
+// the original length is that of the whole payload. Sends are stamped when
+// SendP2PPacket returned, reads when the game got the packet, which with
+// STEAMFORWARDER_P2P_BATCH=1 is after it waited in a ring (p2p.h).
+#define CAPTURE_LINKTYPE 147
+enum
+{
+  CAPTURE_RECEIVED = 0,
+  CAPTURE_SENT = 1
+};
+// CapturePacketHeader::flags, SendP2PPacket returned false
+#define CAPTURE_SEND_FAILED 1
+// CapturePacketHeader::sendType of received packets
+#define CAPTURE_NO_SEND_TYPE 0xff
+
+struct CapturePacketHeader
+{
+  uint64_t remote;
+  int32_t channel;
+  uint8_t direction;
+  // EP2PSend of sent packets
+  uint8_t sendType;
+  uint8_t flags;
+  uint8_t reserved;
+};
+
+class CSteamID;
+
+extern bool captureEnabled;
+// Called by netSendP2PPacket(), netReadP2PPacket() and p2pReadPacket()
+// (netstats.h, p2p.h)
+void captureSent(CSteamID remote, int nChannel, int eP2PSendType, const void *data, uint32_t size,
+                 bool sent);
+void captureReceived(CSteamID remote, int nChannel, const void *data, uint32_t size);
+// Writes what the ring still holds and closes the file
+void captureShutdown();
+#endif
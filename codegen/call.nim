@@ -1,5 +1,6 @@
-from strutils import `%`, join
-from sequtils import map, mapIt, foldl
+from strutils import `%`, join, startsWith, endsWith, strip, Digits
+from sequtils import map, mapIt, foldl, anyIt
+from tables import toTable, hasKey, `[]`
 from streams import Stream
 from arg import Arg, TheType, toDeclaration, parseArgs, parseType,
                 to_format, isVoid, isException, isClass, toSpecArg
@@ -84,6 +85,11 @@ proc makeHead(self: CallInfo): string =
 $1 $2($3)""" % [fixed.returntype.to_declaration(), name,
                 fixed.args.to_declaration(), inline_declaration]  
 
+# As the Linux interface declares it
+proc toInterfaceMethod*(self: CallInfo): string =
+  "virtual $1 $2($3) = 0;" % [self.returntype.to_declaration(), self.name,
+                              self.args.to_declaration()]
+
 proc makeDeclaration*(self: CallInfo): string {.procvar.} =
   let fixed = fixcall(self)
   let convention =
@@ -95,34 +101,80 @@ proc makeDeclaration*(self: CallInfo): string {.procvar.} =
   "$1 $2 $3($4) $5;" % [virtual, fixed.returntype.to_declaration(), self.name,
                         fixed.args.to_declaration(), convention]
 
+# Interfaces called every frame. Their tracing is compiled out unless
+# TRACE_LEVEL is 2, see TRACE_HOT in config.h
+var hotInterfaces* = @["ISteamNetworking", "ISteamController", "ISteamUser",
+                       "ISteamUtils"]
+proc isHot(self: CallInfo): bool =
+  # Older versions of an interface are named like ISteamUser017
+  if self.class.len > 0: self.class.strip(leading = false,
+                                          chars = Digits) in hotInterfaces
+  else: hotInterfaces.anyIt(self.name.startsWith("SteamAPI_" & it & "_"))
+
+proc traceMacro(self: CallInfo): string =
+  if self.isHot(): "TRACE_HOT" else: "TRACE"
+
+# The arguments as traced and recorded, methods with the interface first
+proc traceArgs(self: CallInfo, firstarg: string = "this"): seq[Arg] =
+  if self.class.len > 0:
+    (name: firstarg, thetype: (base: self.class, reference: "*")) & self.args
+  else: self.args
+
 proc makeTraceArgs(self: CallInfo, firstarg: string = "this"): string =
   # RunCallbacks is being called to often and tracing it may cause
   # performance degradation
   if unlikely(self.name == "SteamAPI_RunCallbacks"): ""
   else:
-    let args =
-      if self.class.len > 0:
-        (name: firstarg, thetype: (base: self.class, reference: "*")) &
-          self.args
-      else: self.args
+    let args = self.traceArgs(firstarg)
     let trace_args = args.mapIt(it.name).join(", ")
     let final_trace_args = if trace_args.len > 0: ", " & trace_args else: ""
     let format_args = args.mapIt(it.thetype).map(to_format).join(", ")
-    let tracer = if firstarg == "this": "TRACE(\"" else: ""
+    let tracer = if firstarg == "this": self.traceMacro() & "(\"" else: ""
     """$3($1)\n"$2);""" % [format_args, final_trace_args, tracer]
 
+# Pointer arguments followed by their size, like pubData, cubData, whose
+# contents the recorder keeps. "2:3" means argument 2 points to as many bytes
+# as argument 3 says, counted like traceArgs(), see ProfilePoint in profiler.h
+let sizere = re"^(cub|cch|cb)[A-Z]|Size$"
+proc recordBuffers(self: CallInfo): string =
+  let args = self.traceArgs()
+  var pairs = newSeq[string]()
+  for i in 0..<args.len - 1:
+    let (data, size) = (args[i].thetype, args[i + 1])
+    if '*' in data.reference and not data.isClass() and
+       size.thetype.reference == "" and size.name.contains(sizere):
+      pairs.add("$1:$2" % [$i, $(i + 1)])
+  pairs.join(" ")
+
 proc makeTraceResult*(self: CallInfo): string =
   case self.returntype.base
   of "void": ""
   else:
-    """TRACE("() = $1\n", result);""" % self.returntype.to_format()
+    """$2("() = $1\n", result);""" % [self.returntype.to_format(),
+                                      self.traceMacro()]
+
+# Flat exports take the interface first: intptr_t instancePtr in the
+# steam_api_flat.h of older SDKs, ISteamX *self in steam_api.json
+proc instanceIndex*(self: CallInfo): int =
+  if self.class.len == 0 and self.args.len > 0 and
+     self.args[0].name in ["instancePtr", "self"]: 0
+  else: -1
+
+# The internal interface behind our wrapper, see unwrapInstance()
+proc unwrapped(a: Arg): string =
+  if a.thetype.base == "intptr_t": "unwrapInstance($1)" % a.name
+  else: "($1)unwrapInstance((intptr_t)$2)" % [a.thetype.toDeclaration().strip(),
+                                              a.name]
 
 proc makeRealCall(self: CallInfo): string =
   let arglist = self.args.mapIt(it.name).join(", ")
   if self.class.len > 0:
     """this->internal->$1($2)""" % [self.name, arglist]
   else:
-    """$1($2)""" % [self.name, arglist]
+    var flatargs = self.args.mapIt(it.name)
+    if self.instanceIndex() == 0:
+      flatargs[0] = self.args[0].unwrapped()
+    """$1($2)""" % [self.name, flatargs.join(", ")]
 
 proc makeResult(self: CallInfo, test: bool = false): string =
   if self.private:
@@ -140,7 +192,7 @@ proc makeResult(self: CallInfo, test: bool = false): string =
       TRACE("() = NULL!\n");
       return saved_$1;
     }
-    saved_$1 = ($1 *) new $1_(internal);
+    saved_$1 = ($1 *) internInterface<$1_, $1>("$1", internal, NULL);
     TRACE("(): ($1 *)%p wrapped as ($1_ *)%p\n", internal, saved_$1);
   }
   TRACE("() = ($1_ *)%p\n", saved_$1);
@@ -150,21 +202,170 @@ proc makeResult(self: CallInfo, test: bool = false): string =
   $1_* result = new $1_(NULL);
   $2
 """ % [self.returntype.base, self.makeTraceResult()]
-    else:
+    elif test:
       """$1_* result = new $1_($2);
   $3
 """ % [self.returntype.base, realcall, self.makeTraceResult()]
+    else:
+      # The same internal interface always gets the same wrapper, see intern.h
+      let version =
+        if self.args.anyIt(it.name == "pchVersion"): "pchVersion"
+        else: "NULL"
+      """$1_* result = internInterface<$1_, $1>("$1", $2, $4);
+  $3
+""" % [self.returntype.base, realcall, self.makeTraceResult(), version]
   else:
     """$3 result = $1;
   $2
 """ % [self.makeRealCall(), self.makeTraceResult(),
        self.returntype.toDeclaration()]
 
-let callbackre = re"""^SteamAPI_(Un)?[Rr]egisterCall(back|Result)$"""
+# Structs whose packing differs between the Windows and the Linux ABI,
+# methods taking or returning them by value need a full wrapper
+const packedStructs = ["ControllerAnalogActionData_t",
+                       "ControllerDigitalActionData_t",
+                       "ControllerMotionData_t", "gameserveritem_t",
+                       "MatchMakingKeyValuePair_t", "LeaderboardEntry_t",
+                       "SteamUGCDetails_t"]
+# Served by the forwarder when the switch is on: the batched P2P receive,
+# see p2p.h, the socket polling, see sockets.h, and the P2P session cache,
+# see sessions.h
+let networkHooks = {
+  "IsP2PPacketAvailable": ("p2pBatchEnabled", "p2pIsPacketAvailable"),
+  "ReadP2PPacket": ("p2pBatchEnabled", "p2pReadPacket"),
+  "GetP2PSessionState": ("sessionCacheEnabled", "sessionGetP2PSessionState"),
+  "AcceptP2PSessionWithUser": ("sessionCacheEnabled", "sessionAcceptP2PSessionWithUser"),
+  "CloseP2PSessionWithUser": ("sessionCacheEnabled", "sessionCloseP2PSessionWithUser"),
+  "CloseP2PChannelWithUser": ("sessionCacheEnabled", "sessionCloseP2PChannelWithUser"),
+  "CreateListenSocket": ("socketPollEnabled", "socketCreateListenSocket"),
+  "DestroySocket": ("socketPollEnabled", "socketDestroySocket"),
+  "DestroyListenSocket": ("socketPollEnabled", "socketDestroyListenSocket"),
+  "IsDataAvailableOnSocket": ("socketPollEnabled", "socketIsDataAvailableOnSocket"),
+  "RetrieveDataFromSocket": ("socketPollEnabled", "socketRetrieveDataFromSocket"),
+  "IsDataAvailable": ("socketPollEnabled", "socketIsDataAvailable"),
+  "RetrieveData": ("socketPollEnabled", "socketRetrieveData")}.toTable()
+# Shown the arguments and the result of the forwarded call when the switch
+# is on, which is traced and recorded as without it: the network
+# statistics, see netstats.h, and the packet capture, see capture.h
+let networkPosthooks = {
+  "ReadP2PPacket": ("netStatsEnabled || captureEnabled", "netReadP2PPacket"),
+  "SendP2PPacket": ("netStatsEnabled || captureEnabled", "netSendP2PPacket")}.toTable()
+proc hookedName(self: CallInfo): string =
+  const flat = "SteamAPI_ISteamNetworking_"
+  if self.class == "ISteamNetworking": self.name
+  elif self.class.len == 0 and self.name.startsWith(flat): self.name[flat.len .. ^1]
+  else: ""
+proc isHooked(self: CallInfo): bool =
+  networkHooks.hasKey(self.hookedName()) or networkPosthooks.hasKey(self.hookedName())
+
+# Set by --trampolines: methods which need no marshalling are emitted
+# as a bare re-dispatch, without tracing or profiling
+var trampolines* = false
+proc isTransparent(self: CallInfo): bool =
+  proc byValueStruct(t: TheType): bool =
+    t.reference == "" and t.base in packedStructs
+  self.class.len > 0 and not self.private and not self.isHooked() and
+    not self.returntype.isException() and not self.returntype.isClass() and
+    not self.returntype.byValueStruct() and
+    not self.args.anyIt(it.thetype.byValueStruct())
+
+proc makeTrampoline(self: CallInfo): string =
+  # On x86_64 the compiler turns this into a tail jump through the Linux
+  # vtable. The i386 thiscall frame has to be rebuilt for the Linux
+  # convention, so there it is a plain call without any other overhead,
+  # see bench/trampoline_bench.cpp for what that costs.
+  """
+$1
+{
+  return $2;
+}
+""" % [self.makeHead(), self.makeRealCall()]
+
+# Everything but private methods and the inline accessors is a one line
+# Forward<> instantiation, which does the tracing and profiling, see forward.h
+proc isForwarded*(self: CallInfo): bool =
+  not self.private and not self.inline and
+    not (trampolines and self.isTransparent())
+
+proc makeForward(self: CallInfo): string =
+  let callee =
+    if self.class.len > 0: "Method_" & self.name
+    else: "FORWARD_FUNCTION($1)" % self.name
+  let hot = if self.isHot(): ", true" else: ""
+  let entry = if self.returntype.isException(): "hidden" else: "call"
+  var args = @["&point"]
+  if self.returntype.isException():
+    args.add("hidden")
+  if self.class.len > 0:
+    args.add("this->internal")
+  for i, a in self.args:
+    args.add(if i == self.instanceIndex(): a.unwrapped() else: a.name)
+  let forward = "Forward<$1$2>::$3($4)" % [callee, hot, entry, args.join(", ")]
+  if networkPosthooks.hasKey(self.hookedName()):
+    var seen = newSeq[string]()
+    for i, a in self.args:
+      if i != self.instanceIndex():
+        seen.add(a.name)
+    seen.add("result")
+    let (flag, hook) = networkPosthooks[self.hookedName()]
+    "$1 result = $2;\n  if ($3)\n    $4($5);\n  return result;" %
+      [self.returntype.to_declaration().strip(), forward, flag, hook, seen.join(", ")]
+  elif self.returntype.isClass() and self.args.anyIt(it.name == "pchVersion"):
+    # Older interface versions get their own wrapper, see versions.h
+    """return ($1)wrapVersion<$2_, $2>("$2", $3, pchVersion);""" %
+      [self.returntype.to_declaration(), self.returntype.base, forward]
+  elif self.name.endsWith("GetISteamGenericInterface"):
+    # Only the version string tells what it is, see versions.h
+    "return wrapGenericInterface($1, pchVersion);" % forward
+  elif self.returntype.isClass():
+    # The same internal interface always gets the same wrapper, see intern.h
+    """return ($1)internInterface<$2_, $2>("$2", $3, NULL);""" %
+      [self.returntype.to_declaration(), self.returntype.base, forward]
+  else:
+    "return $1;" % forward
+
+proc profiledName(self: CallInfo): string =
+  if self.class.len > 0: self.class & "::" & self.name
+  else: self.name
+
+proc makeNetworkHook(self: CallInfo): string =
+  if not networkHooks.hasKey(self.hookedName()):
+    return ""
+  var args = @["&point"]
+  if self.class.len > 0:
+    args.add("this->internal")
+  for i, a in self.args:
+    args.add(if i == self.instanceIndex():
+               "(ISteamNetworking *)unwrapInstance((intptr_t)$1)" % a.name
+             else: a.name)
+  let (flag, hook) = networkHooks[self.hookedName()]
+  "if ($1)\n    return $2($3);\n  " % [flag, hook, args.join(", ")]
+
+let callbackre = re"""^SteamAPI_((Un)?[Rr]egisterCall(back|Result)|RunCallbacks)$"""
+# Forwarder work to do before the real call: tear down, end the frame
+let prehooks = {"SteamAPI_Shutdown": "forwarderShutdown();\n  ",
+                "Steam_RunCallbacks": "forwarderNewFrame();\n  "}.toTable()
 proc makeBody*(self: CallInfo): string {.procvar.} =
   if unlikely(self.name.match(callbackre)):
     # Callbacks are handled in callbacks.cpp in a special way
     ""
+  elif trampolines and self.isTransparent():
+    self.makeTrampoline()
+  elif self.isForwarded():
+    let prehook =
+      if self.class.len == 0 and prehooks.hasKey(self.name): prehooks[self.name]
+      else: ""
+    let buffers = self.recordBuffers()
+    let point =
+      if buffers.len > 0: "\"$1\", \"$2\"" % [self.profiledName(), buffers]
+      else: "\"$1\"" % self.profiledName()
+    """
+$1
+{
+  static ProfilePoint point($2);
+  $3$4$5
+}
+""" % [self.makeHead(), point, prehook, self.makeNetworkHook(), self.makeForward()]
   else:
     let returnstmt =
       if self.returntype.isVoid(): ""
@@ -175,14 +376,75 @@ proc makeBody*(self: CallInfo): string {.procvar.} =
         else:
           """return ($1)result;""" % self.returntype.to_declaration()
       else: "return result;"
+    let prehook =
+      if self.class.len == 0 and prehooks.hasKey(self.name): prehooks[self.name]
+      else: ""
     """
 $1
 {
+  PROFILE("$6");
   $2
-  $3
+  $5$3
   $4
 }
-""" % [self.makeHead(), self.makeTraceArgs(), self.makeResult(), returnstmt]
+""" % [self.makeHead(), self.makeTraceArgs(), self.makeResult(), returnstmt,
+       prehook, self.profiledName()]
+
+# Recordings are replayed through the wrappers of the forwarded functions,
+# and SteamAPI_RunCallbacks records itself, see replay.h
+proc isReplayed*(self: CallInfo): bool =
+  self.isForwarded() and
+    (self.name == "SteamAPI_RunCallbacks" or not self.name.match(callbackre))
+
+# Declares the wrapper of a flat function for steam_replay.cpp
+proc makePrototype*(self: CallInfo): string =
+  let fixed = fixcall(self)
+  "$1 $2_($3);" % [fixed.returntype.to_declaration(), self.name,
+                   fixed.args.toDeclaration()]
+
+# accessor is the function returning the wrapper of the class, or NULL
+proc makeReplayer*(self: CallInfo, index: int, accessor: string): string =
+  let first = if self.class.len > 0: 1 else: 0
+  var args = newSeq[string]()
+  if self.returntype.isException():
+    args.add("&hidden")
+  for i, a in self.args:
+    args.add(
+      # The flat export gets the interface the way it declares it
+      if i == self.instanceIndex(): "($1)self" % a.thetype.toDeclaration().strip()
+      else: "r.arg<$1>($2)" % [a.thetype.toDeclaration().strip(), $(i + first)])
+  let callee =
+    if self.class.len > 0: "self->" & self.name
+    else: self.name & '_'
+  let call = "$1($2)" % [callee, args.join(", ")]
+  let statement =
+    if self.returntype.isVoid(): call & ";"
+    elif self.returntype.isException(): "r.result(*$1);" % call
+    else: "r.result($1);" % call
+  let hidden = if self.returntype.isException(): "CSteamID hidden;\n  " else: ""
+  let instance = self.instanceIndex()
+  let self_type = if self.class.len > 0: self.class & "_ *" else: "void *"
+  if self.class.len > 0 or instance >= 0:
+    """
+static void replay$1(Replay &r)
+{
+  $2$3self = ($3)r.object($4, $5);
+  if (self != NULL)
+    $6
+}
+""" % [$index, hidden, self_type, $(if instance >= 0: instance else: 0),
+       accessor, statement]
+  else:
+    """
+static void replay$1(Replay &r)
+{
+  $2$3
+}
+""" % [$index, hidden, statement]
+
+proc makeReplayEntry*(self: CallInfo, index: int): string =
+  """{"$1", "$2", $3, replay$4}""" % [self.profiledName(),
+    self.recordBuffers(), $self.traceArgs().len, $index]
 
 proc makeTest*(self: CallInfo): string {.procvar.} =
   proc makeDeclaration(a: Arg): string =
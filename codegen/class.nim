@@ -1,13 +1,13 @@
 from call import CallInfo, parseMethods, makeDeclaration, makeBody,
-                 makeTest, makeTestBody
-from sequtils import mapIt, foldl, map
+                 makeTest, makeTestBody, isForwarded
+from sequtils import mapIt, foldl, map, filterIt, deduplicate
 from strutils import join, `%`
 from re import re, find, reMultiline
 from streams import Stream, newStringStream, getPosition, setPosition
 from parser import parseTill
 
 type
-  Class = tuple
+  Class* = tuple
     name: string
     methods: seq[CallInfo]
 
@@ -67,6 +67,15 @@ $1_::~$1_()
 }
 """ % self.name
 
+# The Method_* callers used by the Forward<> bodies of these classes, see
+# FORWARD_METHOD in forward.h
+proc toInvokers*(classes: seq[Class]): string =
+  var names = newSeq[string]()
+  for c in classes:
+    for m in c.methods.filterIt(it.isForwarded()):
+      names.add(m.name)
+  names.deduplicate().mapIt("FORWARD_METHOD($1);\n" % it).join("")
+
 proc toImplementation*(self: Class): string {.procvar.} =
   self.methods.map(makeBody).join("\n") & self.makeConDestructor()
 
@@ -1,26 +1,78 @@
-from strutils import rfind, `%`, splitLines, join
-from sequtils import map, mapIt
+from strutils import rfind, `%`, splitLines, join, split, toLowerAscii
+from sequtils import map, mapIt, anyIt
 from parseopt import getopt, cmdShortOption, cmdArgument, cmdLongOption
-from os import walkFiles, extractFilename, changeFileExt, parentDir, `/`
-from osproc import execProcess
+from os import walkFiles, extractFilename, changeFileExt, parentDir, `/`,
+               fileExists, createDir, removeFile
+from osproc import execProcesses
+from hashes import Hash, hash, `!&`, `!$`
+from marshal import `$$`, to
+from times import epochTime
 from re import re, match
 from spec import parseSpec, writeSpec, filterSpec
-from call import parseFuncs, makeBody, makeTestBody
-from class import parseClasses, toDeclaration, toImplementation,
-                  toTestImplementation, makeTest
+from call import CallInfo, parseFuncs, makeBody, makeTestBody,
+                 hotInterfaces, trampolines
+from class import Class, parseClasses, toDeclaration, toImplementation,
+                  toTestImplementation, makeTest, toInvokers
+from jsonapi import Api, parseApiJson, reportLayouts
+from tables import initTable, hasKey, `[]`, `[]=`
+from versions import InterfaceVersion, interfaceVersions, versionOf,
+                     versionDefine,
+                     versionedName, layoutKey, renamed, toInterfaceDeclaration,
+                     toVersionTable
+from symbols import toLazySymbols
+from replay import toReplayTable
+from standin import toStandInDeclarations, toStandInImplementation
 
 const headerHead = """
 #include <steam_api_.h>
 """
 
+# Preprocessed headers and the functions and classes parsed from them are
+# kept here, keyed by the content of the whole header folder
+const cachedir = "codegen_cache"
+const preprocessflags = "-DUSE_BREAKPAD_HANDLER " &
+                        "-DVERSION_SAFE_STEAM_API_INTERFACES"
+
+# Parser changes invalidate the cache as well
+const parserHash = hash(staticRead("arg.nim") & staticRead("call.nim") &
+                        staticRead("class.nim") & staticRead("parser.nim"))
+
+proc headersHash(sourcedir: string): Hash =
+  result = parserHash !& hash(preprocessflags)
+  for f in walkFiles(sourcedir / "*.h"):
+    result = result !& hash(f.extractFilename()) !& hash(readFile(f))
+  result = !$result
+
+proc cached(filename: string, key: Hash, ext: string): string =
+  cachedir / ("$1-$2.$3" % [filename.extractFilename(), $key, ext])
+
+# Runs gcc -E on all headers which have no parsed cache yet, in parallel
+proc preprocess(filenames: seq[string], key: Hash) =
+  var commands = newSeq[string]()
+  for f in filenames:
+    let parsed = f.cached(key, "parsed")
+    let output = f.cached(key, "i")
+    if not fileExists(parsed) and not fileExists(output):
+      commands.add("gcc $1 -I$2 -E $3 -o $4.tmp && mv $4.tmp $4" %
+                   [preprocessflags, f.parentDir(), f, output])
+  if commands.len > 0:
+    echo "Preprocessing $1 headers..." % $commands.len
+    if execProcesses(commands) != 0:
+      quit("Cannot preprocess steam headers")
+
+proc writeIfChanged(filename: string, content: string) =
+  # Untouched files keep their timestamps, so make rebuilds only what changed
+  if fileExists(filename) and readFile(filename) == content:
+    return
+  filename.writeFile(content)
+  echo "Updated $1" % filename
+
 let includere = re"""^\#\s+([0-9]+)\s+"(.*?)"\s+([0-9])\s*$"""
-proc getFileContent(filename: string, includes: seq[string] = @[]): string =
+proc getFileContent(filename: string, key: Hash,
+                    includes: seq[string] = @[]): string =
   let basename = extractFilename(filename)
   let exceptions = includes & basename
-  let preprocessed = execProcess("gcc -DUSE_BREAKPAD_HANDLER " &
-                                 "-DVERSION_SAFE_STEAM_API_INTERFACES " &
-                                 "-I$2 -E $1" %
-                                 [filename, filename.parentDir()])
+  let preprocessed = readFile(filename.cached(key, "i"))
   var matches = newSeq[string](3)
   var skipping = false
   result = ""
@@ -36,13 +88,32 @@ proc getFileContent(filename: string, includes: seq[string] = @[]): string =
         skipping = true
     elif not skipping:
       result &= line & "\n"
-  #("codegen_tmp" / basename).writeFile(result)
+
+proc cachedFuncs(filename: string, key: Hash,
+                 includes: seq[string] = @[]): seq[CallInfo] =
+  let parsed = filename.cached(key, "parsed")
+  if fileExists(parsed):
+    return to[seq[CallInfo]](readFile(parsed))
+  result = filename.getFileContent(key, includes).parseFuncs()
+  parsed.writeFile($$result)
+  removeFile(filename.cached(key, "i"))
+
+proc cachedClasses(filename: string, key: Hash): seq[Class] =
+  let parsed = filename.cached(key, "parsed")
+  if fileExists(parsed):
+    return to[seq[Class]](readFile(parsed))
+  result = filename.getFileContent(key).parseClasses()
+  parsed.writeFile($$result)
+  removeFile(filename.cached(key, "i"))
 
 var
   sourcedir = ""
   target = ""
   testtarget = ""
   specfile = ""
+  jsonfile = ""
+  layouts = false
+  versiondirs = newSeq[string]()
 const helpmsg = "Use -h switch to get help"
 for t, k, v in getopt():
   case t
@@ -56,10 +127,25 @@ for t, k, v in getopt():
       testtarget = v
     of "spec":
       specfile = v
+    of "hotpath":
+      hotInterfaces = v.split(',')
+    of "trampolines":
+      trampolines = true
+    of "json":
+      jsonfile = v
+    of "layouts":
+      layouts = true
+    of "versions":
+      versiondirs = v.split(',')
     of "h", "help":
       echo "-s, --source - set steamapi headers folder"
       echo "--spec       - set spec file location"
       echo "-t, --target - set classes destination folder"
+      echo "--trampolines - emit methods which need no marshalling as bare re-dispatch"
+      echo "--json       - read interfaces from steam_api.json instead of the headers"
+      echo "--layouts    - with --json, list structs packed differently on Windows and Linux"
+      echo "--hotpath    - comma separated interfaces traced only with TRACE_LEVEL=2"
+      echo "--versions   - comma separated folders of older steamapi headers to wrap as well"
       echo "--testtarget - set destination of test files (test code will be generated instead of real working code"
     else:
       echo helpmsg
@@ -71,9 +157,42 @@ if sourcedir.len == 0 or target.len == 0 or specfile == "":
        " and target folders")
 var thespec = parseSpec(specfile)
 echo "Read spec file with $1 entries" % $thespec.names.len
-let funcs = getFileContent(sourcedir / "steam_api.h", @["steam_api_internal.h"])
-              .parseFuncs() & getFileContent(sourcedir / "steam_api_flat.h")
-              .parseFuncs()
+let forbidden_files = [
+  "isteammasterserverupdater.h",
+  #"isteamappticket.h",
+  #"isteamgamecoordinator.h",
+  "isteamps3overlayrenderer.h"
+]
+let key = headersHash(sourcedir)
+createDir(cachedir)
+let started = epochTime()
+var funcs: seq[CallInfo]
+var units = newSeq[tuple[header: string, classes: seq[Class]]]()
+if jsonfile != "":
+  # steam_api.json describes the interfaces and the flat API, but not the
+  # SteamAPI_* functions of steam_api.h itself
+  preprocess(@[sourcedir / "steam_api.h"], key)
+  let api = parseApiJson(jsonfile, sourcedir, forbidden_files)
+  funcs = cachedFuncs(sourcedir / "steam_api.h", key,
+                      @["steam_api_internal.h"]) & api.funcs
+  units = api.classes
+  if layouts:
+    api.reportLayouts()
+else:
+  var interfaces = newSeq[string]()
+  for f in walkFiles(sourcedir / "isteam*.h"):
+    if f.extractFilename() notin forbidden_files:
+      interfaces.add(f)
+  preprocess(@[sourcedir / "steam_api.h", sourcedir / "steam_api_flat.h"] &
+             interfaces, key)
+  funcs = cachedFuncs(sourcedir / "steam_api.h", key,
+                      @["steam_api_internal.h"]) &
+          cachedFuncs(sourcedir / "steam_api_flat.h", key)
+  for f in interfaces:
+    echo "Parsing $1..." % f.extractFilename()
+    units.add((header: f.extractFilename(), classes: f.cachedClasses(key)))
+echo "Read the $1 in $2 s" % [if jsonfile != "": "json" else: "headers",
+                              $(epochTime() - started)]
 echo "Found $1 functions in top level headers" % $funcs.len
 let filtered_funcs = thespec.filterSpec(funcs)
 echo "$1 functions left after comparsion with spec file" % $filtered_funcs.len
@@ -85,41 +204,54 @@ extern "C" {
 $1
 }
 """ % filtered_funcs.map(bodyMaker).join("\n")
-"steam_api.cpp".writeFile(cpp_body)
-let head = open(target / "steam_api_.h", fmWrite)
-let forbidden_files = [
-  "isteammasterserverupdater.h",
-  #"isteamappticket.h",
-  #"isteamgamecoordinator.h",
-  "isteamps3overlayrenderer.h"
-]
-head.writeLine """
+"steam_api.cpp".writeIfChanged(cpp_body)
+# Used only when built with LAZY_STEAM_API
+(target / "symbols.cpp").writeIfChanged(funcs.toLazySymbols())
+var generated = newSeq[string]()
+# Every wrapper class, for the replay table
+var replayed = newSeq[Class]()
+var head = """
 #ifndef STEAM_FORWARDER_HEADER
 #define STEAM_FORWARDER_HEADER
 #include <steam_api.h>
 #include <config.h>
+#include <forwarder.h>
+#include <intern.h>
+#include <versions.h>
+#include <profiler.h>
+#include <forward.h>
+#include <capture.h>
+#include <netstats.h>
+#include <p2p.h>
+#include <sessions.h>
+#include <sockets.h>
+
 """
 
-for f in walkFiles(sourcedir / "isteam*.h"):
-  let filename = f.extractFilename()
-  if filename in forbidden_files:
-    continue
-  echo "Parsing $1..." % filename
+for unit in units:
+  let filename = unit.header
+  let classes = unit.classes
   let wrapped_name = "wrap_" & filename
   let wrapped_cpp_name = wrapped_name.changeFileExt(".cpp")
-  let classes = f.getFileContent().parseClasses()
-  echo "Found $1 classes" % $classes.len
+  echo "Found $1 classes in $2" % [$classes.len, filename]
+  replayed.add(classes)
   let header_content = classes.map(toDeclaration).join("\n")
   let steam_header = """
 #include <$1>
 """ % filename
-  (target / wrapped_name).writeFile(headerHead & steam_header & header_content)
-  head.writeLine """#include <$1>""" % wrapped_name
+  (target / wrapped_name).writeIfChanged(headerHead & steam_header &
+                                         header_content)
+  head &= """#include <$1>
+""" % wrapped_name
   let impl_generator =
     if testtarget == "": toImplementation
     else: toTestImplementation
-  let implementation = headerHead & classes.map(impl_generator).join("\n\n")
-  (target / wrapped_cpp_name).writeFile(implementation)
+  let invokers = if testtarget == "": classes.toInvokers() & "\n" else: ""
+  let implementation = headerHead & invokers &
+                       classes.map(impl_generator).join("\n\n")
+  (target / wrapped_cpp_name).writeIfChanged(implementation)
+  generated.add(target / wrapped_name)
+  generated.add(target / wrapped_cpp_name)
   if testtarget != "":
     let testbody = classes.map(makeTest).join("\n")
     let testexcludes = classes.mapIt("$1 *$2();" % [it.name, it.name[1..^1]])
@@ -138,11 +270,74 @@ int main() {
   $1
 }
 """ % [testbody, filename, testexcludes]
-    (testtarget / "call_" & wrapped_cpp_name).writeFile(test)
-head.writeLine """
+    (testtarget / "call_" & wrapped_cpp_name).writeIfChanged(test)
+# Every interface version string, the older ones with a wrapper of their own
+# unless their vtable equals one already generated, see versions.nim
+var knownVersions = newSeq[InterfaceVersion]()
+var layoutWrappers = initTable[string, string]()
+let currentVersions = interfaceVersions(sourcedir)
+for unit in units:
+  for c in unit.classes:
+    layoutWrappers[c.name & "\n" & c.layoutKey()] = c.name
+    let version = currentVersions.versionOf(c.name)
+    if version != "":
+      knownVersions.add((version: version, base: c.name, wrapper: c.name,
+                         define: c.name.versionDefine()))
+for dir in versiondirs:
+  let dirkey = headersHash(dir)
+  var interfaces = newSeq[string]()
+  for f in walkFiles(dir / "isteam*.h"):
+    if f.extractFilename() notin forbidden_files:
+      interfaces.add(f)
+  preprocess(interfaces, dirkey)
+  let dirVersions = interfaceVersions(dir)
+  for f in interfaces:
+    for c in f.cachedClasses(dirkey):
+      let version = dirVersions.versionOf(c.name)
+      let name = versionedName(c.name, version)
+      if version == "" or name == c.name or
+         knownVersions.anyIt(it.version == version):
+        continue
+      let layout = c.name & "\n" & c.layoutKey()
+      if not layoutWrappers.hasKey(layout):
+        echo "Wrapping $1 as $2" % [version, name]
+        let versioned = c.renamed(name)
+        replayed.add(versioned)
+        let wrapped_name = "wrap_" & name.toLowerAscii() & ".h"
+        (target / wrapped_name).writeIfChanged(headerHead &
+          versioned.toInterfaceDeclaration() & versioned.toDeclaration())
+        (target / wrapped_name.changeFileExt(".cpp")).writeIfChanged(
+          headerHead & @[versioned].toInvokers() & "\n" &
+          versioned.toImplementation())
+        head &= """#include <$1>
+""" % wrapped_name
+        generated.add(target / wrapped_name)
+        generated.add(target / wrapped_name.changeFileExt(".cpp"))
+        layoutWrappers[layout] = name
+      knownVersions.add((version: version, base: c.name,
+                         wrapper: layoutWrappers[layout], define: ""))
+echo "Found $1 interface versions" % $knownVersions.len
+(target / "versions.cpp").writeIfChanged(knownVersions.toVersionTable())
+if testtarget == "":
+  "steam_replay.cpp".writeIfChanged(filtered_funcs.toReplayTable(replayed))
+  # The stand-in libsteam_api implements the current interfaces only
+  var current = newSeq[Class]()
+  for unit in units:
+    current.add(unit.classes)
+  ("standin" / "interfaces.h").writeIfChanged(current.toStandInDeclarations())
+  ("standin" / "interfaces.cpp").writeIfChanged(
+    current.toStandInImplementation(funcs, currentVersions))
+
+head &= """
 #endif
+
 """
-head.close()
+(target / "steam_api_.h").writeIfChanged(head)
+# Wrappers of interfaces the new headers no longer have
+for f in walkFiles(target / "wrap_*"):
+  if f notin generated:
+    echo "Removing $1" % f
+    removeFile(f)
 writeSpec(specfile.changeFileExt("auto.spec"), thespec)
 
 
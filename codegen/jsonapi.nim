@@ -0,0 +1,199 @@
+from strutils import `%`, strip, find, parseInt, toLowerAscii
+from sequtils import mapIt
+from tables import Table, initTable, `[]`, `[]=`, hasKey
+from os import walkFiles, extractFilename, `/`
+from re import re, find, reMultiline
+from json import JsonNode, parseFile, hasKey, `[]`, items
+from arg import Arg, TheType, parseType
+from call import CallInfo
+from class import Class
+
+# Alternative frontend reading the steam_api.json shipped with newer SDKs
+# instead of regex parsing the preprocessed headers. It produces the same
+# CallInfo/Class model, plus the field layout of structs and callbacks.
+
+type
+  StructInfo* = tuple
+    name: string
+    callback: int # callback id, 0 for plain structs
+    fields: seq[Arg]
+  FieldLayout* = tuple
+    field: Arg
+    offset: int
+  Layout* = tuple
+    size: int
+    align: int
+    fields: seq[FieldLayout]
+  Api* = tuple
+    funcs: seq[CallInfo]
+    classes: seq[tuple[header: string, classes: seq[Class]]]
+    structs: seq[StructInfo]
+    typedefs: Table[string, string]
+
+proc text(node: JsonNode, key: string): string =
+  if node.hasKey(key): node[key].str else: ""
+
+proc toArgs(params: JsonNode): seq[Arg] =
+  result = newSeq[Arg]()
+  if params == nil:
+    return
+  for p in params.items():
+    var a: Arg
+    a.name = p.text("paramname")
+    a.thetype = p.text("paramtype").parseType()
+    result.add(a)
+
+proc toCall(m: JsonNode, class: string): CallInfo =
+  result.name = m.text("methodname")
+  result.class = class
+  result.inline = false
+  result.private = false
+  result.returntype = m.text("returntype").parseType()
+  result.args = if m.hasKey("params"): m["params"].toArgs() else: @[]
+
+proc toFlat(m: JsonNode, class: string): CallInfo =
+  result = m.toCall("")
+  result.name =
+    if m.hasKey("methodname_flat"): m.text("methodname_flat")
+    else: "SteamAPI_$1_$2" % [class, m.text("methodname")]
+  # As steam_api_flat.h of these SDKs declares it
+  let instance = (name: "self", thetype: (base: class, reference: "*"))
+  result.args = instance & result.args
+
+# Which header declares which interface, found without preprocessing
+let classre = re("""^\s*class\s+(ISteam\w+)\s*(:[^{;]*)?$""", {reMultiline})
+proc interfaceHeaders(sourcedir: string): Table[string, string] =
+  result = initTable[string, string]()
+  for f in walkFiles(sourcedir / "isteam*.h"):
+    let raw = readFile(f)
+    var matches = newSeq[string](2)
+    var i = 0
+    while (i = raw.find(classre, matches, i); i >= 0):
+      result[matches[0]] = f.extractFilename()
+      i += 1
+
+proc toStruct(s: JsonNode): StructInfo =
+  result.name = s.text("struct")
+  result.callback = if s.hasKey("callback_id"): int(s["callback_id"].num)
+                    else: 0
+  result.fields = newSeq[Arg]()
+  if s.hasKey("fields"):
+    for f in s["fields"].items():
+      var a: Arg
+      a.name = f.text("fieldname")
+      # Arrays keep their bounds in the reference part, e.g. "char [128]"
+      let fieldtype = f.text("fieldtype")
+      let bracket = fieldtype.find('[')
+      if bracket >= 0:
+        a.thetype = fieldtype[0..<bracket].parseType()
+        a.thetype.reference &= fieldtype[bracket..^1].strip()
+      else:
+        a.thetype = fieldtype.parseType()
+      result.fields.add(a)
+
+proc parseApiJson*(filename: string, sourcedir: string,
+                   forbidden: openArray[string]): Api =
+  let root = parseFile(filename)
+  let headers = interfaceHeaders(sourcedir)
+  result.funcs = newSeq[CallInfo]()
+  result.classes = @[]
+  result.structs = newSeq[StructInfo]()
+  var byheader = initTable[string, seq[Class]]()
+  var order = newSeq[string]()
+  for i in root["interfaces"].items():
+    let name = i.text("classname")
+    var theclass: Class
+    theclass.name = name
+    theclass.methods = newSeq[CallInfo]()
+    if i.hasKey("methods"):
+      for m in i["methods"].items():
+        theclass.methods.add(m.toCall(name))
+        result.funcs.add(m.toFlat(name))
+    let header =
+      if headers.hasKey(name): headers[name]
+      else: name.toLowerAscii() & ".h"
+    if header in forbidden:
+      continue
+    if not byheader.hasKey(header):
+      byheader[header] = newSeq[Class]()
+      order.add(header)
+    var classes = byheader[header]
+    classes.add(theclass)
+    byheader[header] = classes
+  for h in order:
+    result.classes.add((header: h, classes: byheader[h]))
+  result.typedefs = initTable[string, string]()
+  if root.hasKey("typedefs"):
+    for t in root["typedefs"].items():
+      result.typedefs[t.text("typedef")] = t.text("type").strip()
+  for key in ["structs", "callback_structs"]:
+    if root.hasKey(key):
+      for s in root[key].items():
+        result.structs.add(s.toStruct())
+
+# Sizes on i386, where the forwarder runs. Everything not listed here or in
+# the typedefs of the json is an enum, a struct of the json or unknown.
+const primitives = [("bool", 1), ("char", 1), ("signed char", 1),
+                    ("unsigned char", 1), ("int8", 1), ("uint8", 1),
+                    ("short", 2), ("unsigned short", 2), ("int16", 2),
+                    ("uint16", 2), ("int", 4), ("unsigned int", 4),
+                    ("long", 4), ("unsigned long", 4), ("int32", 4),
+                    ("uint32", 4), ("float", 4), ("intptr_t", 4),
+                    ("long long", 8), ("unsigned long long", 8),
+                    ("int64", 8), ("uint64", 8), ("double", 8),
+                    ("CSteamID", 8), ("CGameID", 8)]
+
+proc arrayLength(reference: string): int =
+  result = 1
+  var rest = reference
+  var open = rest.find('[')
+  while open >= 0:
+    let close = rest.find(']')
+    result *= rest[open+1..<close].strip().parseInt()
+    rest = rest[close+1..^1]
+    open = rest.find('[')
+
+# Field layout of a struct under #pragma pack(pack): steam_api uses 8 on
+# Windows and 4 on Linux and OSX (VALVE_CALLBACK_PACK_LARGE/SMALL)
+proc layout*(self: StructInfo, pack: int, structs: seq[StructInfo],
+             typedefs: Table[string, string] = initTable[string, string]()): Layout =
+  proc scalar(base: string): tuple[size: int, align: int] =
+    var base = base
+    while typedefs.hasKey(base) and typedefs[base] != base:
+      base = typedefs[base]
+    for p in primitives:
+      if p[0] == base:
+        return (size: p[1], align: min(p[1], pack))
+    for s in structs:
+      if s.name == base:
+        let inner = s.layout(pack, structs, typedefs)
+        return (size: inner.size, align: inner.align)
+    # Enums and anything else 4 bytes wide
+    (size: 4, align: min(4, pack))
+  result.fields = @[]
+  result.size = 0
+  result.align = 1
+  for f in self.fields:
+    let pointer = '*' in f.thetype.reference or '&' in f.thetype.reference
+    let element =
+      if pointer: (size: 4, align: min(4, pack))
+      else: f.thetype.base.scalar()
+    let count = f.thetype.reference.arrayLength()
+    result.size = (result.size + element.align - 1) div element.align *
+                  element.align
+    result.fields.add((field: f, offset: result.size))
+    result.size += element.size * count
+    result.align = max(result.align, element.align)
+  result.size = (result.size + result.align - 1) div result.align * result.align
+
+# Structs whose layout differs between the Windows and the Linux build, so
+# passing them between the two needs repacking
+proc reportLayouts*(api: Api) =
+  for s in api.structs:
+    let windows = s.layout(8, api.structs, api.typedefs)
+    let linux = s.layout(4, api.structs, api.typedefs)
+    if windows.size != linux.size or
+       windows.fields.mapIt(it.offset) != linux.fields.mapIt(it.offset):
+      let id = if s.callback != 0: " (callback $1)" % $s.callback else: ""
+      echo "$1$2: $3 bytes on Windows, $4 on Linux" %
+        [s.name, id, $windows.size, $linux.size]
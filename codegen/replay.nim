@@ -0,0 +1,49 @@
+from strutils import `%`, join, startsWith, split
+from sequtils import mapIt, filterIt
+from tables import initTable, hasKey, `[]`, `[]=`
+from call import CallInfo, isReplayed, makePrototype, makeReplayer,
+                 makeReplayEntry
+from arg import isClass
+from class import Class
+
+# steam_replay.cpp, the replayers of every forwarded function and method
+# which steamreplay.exe looks up by the names in a recording, see replay.h
+proc toReplayTable*(funcs: seq[CallInfo], classes: seq[Class]): string =
+  # Interfaces the game gets from SteamUser() and the like
+  var accessors = initTable[string, string]()
+  for f in funcs:
+    if f.inline and f.returntype.isClass():
+      accessors[f.returntype.base] = "(ReplayAccessor)&$1_" % f.name
+  var calls = funcs.filterIt(it.isReplayed())
+  let prototypes = calls.mapIt(it.makePrototype()) &
+    funcs.filterIt(it.inline and it.returntype.isClass())
+         .mapIt(it.makePrototype())
+  for c in classes:
+    calls.add(c.methods.filterIt(it.isReplayed()))
+  var replayers = newSeq[string]()
+  var entries = newSeq[string]()
+  for i, call in calls:
+    # SteamAPI_ISteamUser_GetHSteamUser belongs to ISteamUser as well
+    let owner =
+      if call.class.len > 0: call.class
+      elif call.name.startsWith("SteamAPI_ISteam"): call.name.split('_')[1]
+      else: ""
+    let accessor =
+      if accessors.hasKey(owner): accessors[owner]
+      else: "NULL"
+    replayers.add(call.makeReplayer(i, accessor))
+    entries.add(call.makeReplayEntry(i))
+  """
+#include <steam_api_.h>
+#include <steam_api_flat.h>
+#include <replay.h>
+extern "C" {
+$1
+}
+$2
+const ReplayEntry replayEntries[] = {
+  $3
+};
+const unsigned replayEntryCount = $4;
+""" % [prototypes.join("\n"), replayers.join(""), entries.join(",\n  "),
+       $entries.len]
@@ -0,0 +1,166 @@
+from strutils import `%`, join, startsWith, split, endsWith, strip,
+                     toUpperAscii
+from sequtils import mapIt, filterIt
+from tables import Table
+from arg import Arg, TheType, toDeclaration, isVoid, isClass, isException
+from call import CallInfo, instanceIndex
+from class import Class
+from versions import versionOf
+
+# The stand-in libsteam_api.so, see standin/standin.h. Every interface gets
+# a class with the layout of the Linux one, standin/interfaces.h, and every
+# method and flat export a default body in standin/interfaces.cpp, except
+# these, which standin/*.cpp model by hand
+const modeledMethods = [
+  "ISteamClient::GetISteamGenericInterface",
+  "ISteamUtils::IsAPICallCompleted", "ISteamUtils::GetAPICallResult",
+  "ISteamNetworking::SendP2PPacket", "ISteamNetworking::IsP2PPacketAvailable",
+  "ISteamNetworking::ReadP2PPacket",
+  "ISteamNetworking::AcceptP2PSessionWithUser",
+  "ISteamNetworking::CloseP2PSessionWithUser",
+  "ISteamNetworking::CloseP2PChannelWithUser",
+  "ISteamNetworking::GetP2PSessionState",
+  "ISteamNetworking::CreateListenSocket",
+  "ISteamNetworking::CreateP2PConnectionSocket",
+  "ISteamNetworking::CreateConnectionSocket", "ISteamNetworking::DestroySocket",
+  "ISteamNetworking::DestroyListenSocket", "ISteamNetworking::SendDataOnSocket",
+  "ISteamNetworking::IsDataAvailableOnSocket",
+  "ISteamNetworking::RetrieveDataFromSocket", "ISteamNetworking::IsDataAvailable",
+  "ISteamNetworking::RetrieveData", "ISteamNetworking::GetSocketInfo",
+  "ISteamNetworking::GetListenSocketInfo",
+  "ISteamNetworking::GetSocketConnectionType",
+  "ISteamNetworking::GetMaxPacketSize",
+  "ISteamRemoteStorage::FileWrite", "ISteamRemoteStorage::FileRead",
+  "ISteamRemoteStorage::FileDelete", "ISteamRemoteStorage::FileExists",
+  "ISteamRemoteStorage::GetFileSize", "ISteamRemoteStorage::GetFileCount",
+  "ISteamRemoteStorage::GetFileNameAndSize", "ISteamRemoteStorage::GetQuota",
+  "ISteamUserStats::FindOrCreateLeaderboard",
+  "ISteamUserStats::FindLeaderboard", "ISteamUserStats::GetLeaderboardName",
+  "ISteamUserStats::GetLeaderboardEntryCount",
+  "ISteamUserStats::GetLeaderboardSortMethod",
+  "ISteamUserStats::GetLeaderboardDisplayType",
+  "ISteamUserStats::DownloadLeaderboardEntries",
+  "ISteamUserStats::GetDownloadedLeaderboardEntry",
+  "ISteamUserStats::UploadLeaderboardScore"]
+const modeledFunctions = [
+  "SteamAPI_Init", "SteamAPI_InitSafe", "SteamAPI_Shutdown",
+  "SteamAPI_IsSteamRunning", "SteamAPI_RestartAppIfNecessary",
+  "SteamAPI_RunCallbacks", "Steam_RunCallbacks", "SteamAPI_RegisterCallback",
+  "SteamAPI_UnregisterCallback", "SteamAPI_RegisterCallResult",
+  "SteamAPI_UnregisterCallResult"]
+
+proc declaration(args: seq[Arg]): string =
+  args.mapIt(it.toDeclaration()).join(", ")
+
+proc standin(class: string): string = class & "StandIn"
+
+# What a method or export does unless it is modeled
+proc defaultBody(returntype: TheType, classes: seq[string]): string =
+  let wait = "standinLatency();"
+  if returntype.isVoid():
+    wait
+  elif returntype.isClass() and returntype.reference == "*":
+    if returntype.base in classes:
+      "$1\n  return ($2 *)standinInterface<$3>();" %
+        [wait, returntype.base, returntype.base.standin()]
+    else: "$1\n  return NULL;" % wait
+  elif returntype.isException():
+    "$1\n  return standinSteamID();" % wait
+  elif returntype.base == "SteamAPICall_t" and returntype.reference == "":
+    "$1\n  return standinCallResult(NULL, 0, 0);" % wait
+  elif returntype.base in ["HSteamPipe", "HSteamUser"] and
+       returntype.reference == "":
+    "$1\n  return 1;" % wait
+  else:
+    "$1\n  return StandInDefault<$2>::value();" %
+      [wait, returntype.toDeclaration().strip()]
+
+# standin/interfaces.h
+proc toStandInDeclarations*(classes: seq[Class]): string =
+  let declarations = classes.mapIt("""
+class $1
+{
+public:
+  $2
+};
+""" % [it.name.standin(), it.methods.mapIt(
+    "virtual $1 $2($3);" % [it.returntype.toDeclaration(), it.name,
+                            it.args.declaration()]).join("\n  ")])
+  """
+#ifndef STEAM_STANDIN_INTERFACES
+#define STEAM_STANDIN_INTERFACES
+#include "standin.h"
+$1
+#endif
+""" % declarations.join("")
+
+# standin/interfaces.cpp. GetISteamGenericInterface knows the interfaces
+# versions has a STEAM*_INTERFACE_VERSION for
+proc toStandInImplementation*(classes: seq[Class], funcs: seq[CallInfo],
+                              versions: Table[string, string]): string =
+  let names = classes.mapIt(it.name)
+  var methods = newSeq[string]()
+  for c in classes:
+    for m in c.methods:
+      if "$1::$2" % [c.name, m.name] in modeledMethods:
+        continue
+      methods.add("""
+$1 $2::$3($4)
+{
+  $5
+}
+""" % [m.returntype.toDeclaration(), c.name.standin(), m.name,
+       m.args.declaration(), m.returntype.defaultBody(names)])
+  var exports = newSeq[string]()
+  var exported = newSeq[string]()
+  for f in funcs:
+    if f.inline or f.name in modeledFunctions or f.name in exported:
+      continue
+    exported.add(f.name)
+    # SteamAPI_ISteamUser_GetSteamID calls ISteamUserStandIn::GetSteamID
+    let parts = f.name.split('_')
+    var body = f.returntype.defaultBody(names)
+    if f.name.startsWith("SteamAPI_ISteam") and parts.len > 2 and
+       f.instanceIndex() == 0:
+      let class = parts[1]
+      let name = parts[2..^1].join("_")
+      for c in classes.filterIt(it.name == class):
+        for m in c.methods.filterIt(it.name == name and not it.private and
+                                    it.args.len == f.args.len - 1):
+          let call = "(($1 *)$2)->$3($4)" % [class.standin(), f.args[0].name, name,
+            f.args[1..^1].mapIt(it.name).join(", ")]
+          body =
+            if f.returntype.isVoid(): call & ";"
+            else: "return StandInResult<$1>::of($2);" %
+                    [f.returntype.toDeclaration().strip(), call]
+          break
+    elif f.name.endsWith("CreateInterface") and f.args.len == 1:
+      body = "return ($1)standinGenericInterface($2);" %
+             [f.returntype.toDeclaration(), f.args[0].name]
+    let head = "$1 standin_$2($3)" % [f.returntype.toDeclaration(), f.name,
+                                      f.args.declaration()]
+    exports.add("""
+$1 STANDIN_EXPORT($2);
+$1
+{
+  $3
+}
+""" % [head, f.name, body])
+  var generic = newSeq[string]()
+  for c in classes:
+    if versions.versionOf(c.name) != "":
+      generic.add("""  if (strcmp(version, $1_INTERFACE_VERSION) == 0)
+    return standinInterface<$2>();
+""" % [c.name[1..^1].toUpperAscii(), c.name.standin()])
+  """
+#include <string.h>
+#include "interfaces.h"
+$1
+$2
+void *standinGenericInterface(const char *version)
+{
+  if (version == NULL)
+    return NULL;
+$3  return NULL;
+}
+""" % [methods.join(""), exports.join(""), generic.join("")]
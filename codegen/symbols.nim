@@ -0,0 +1,30 @@
+from strutils import `%`, join
+from sequtils import mapIt, filterIt, deduplicate
+from call import CallInfo
+
+# Stubs and the function pointer table for LAZY_STEAM_API, see lazy.h.
+# Every function the headers declare gets one, including those only called
+# from the inline functions of the headers.
+proc toLazySymbols*(funcs: seq[CallInfo]): string =
+  let names = funcs.filterIt(not it.inline).mapIt(it.name).deduplicate()
+  var stubs = newSeq[string]()
+  for i, name in names:
+    stubs.add("LAZY_SYMBOL($1, $2)" % [$i, name])
+  """
+#include <lazy.h>
+#ifdef LAZY_STEAM_API
+LAZY_RESOLVER;
+$1
+
+extern "C" {
+void *steamSymbols[] = {
+  $2
+};
+const char *const steamSymbolNames[] = {
+  $3
+};
+}
+const unsigned steamSymbolCount = $4;
+#endif
+""" % [stubs.join("\n"), names.mapIt("LAZY_ENTRY($1)" % it).join(",\n  "),
+       names.mapIt("\"$1\"" % it).join(",\n  "), $names.len]
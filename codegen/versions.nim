@@ -0,0 +1,99 @@
+from strutils import `%`, join, toUpperAscii, Digits
+from sequtils import mapIt, filterIt
+from tables import Table, initTable, `[]`, `[]=`, hasKey
+from os import walkFiles
+from re import re, find, reMultiline
+from call import toInterfaceMethod
+from class import Class
+
+# Interface versions: the version string every isteam*.h defines for its
+# interfaces, older header drops given by --versions, and the list of them
+# in autoclass/versions.cpp which the forwarder hashes into the table
+# mapping a version string to its wrapper, see versions.h
+
+type
+  InterfaceVersion* = tuple
+    version: string
+    base: string    # the interface without version, e.g. ISteamUser
+    wrapper: string # the interface the wrapper is generated for
+    define: string  # STEAMUSER_INTERFACE_VERSION for the current headers
+
+let versionre = re("""^\s*#define\s+STEAM(\w+?)_INTERFACE_VERSION\s+"([^"]+)"""",
+                   {reMultiline})
+
+# STEAMUSER_INTERFACE_VERSION belongs to ISteamUser and so on
+proc interfaceVersions*(sourcedir: string): Table[string, string] =
+  result = initTable[string, string]()
+  for f in walkFiles(sourcedir & "/isteam*.h"):
+    let raw = readFile(f)
+    var matches = newSeq[string](2)
+    var i = 0
+    while (i = raw.find(versionre, matches, i); i >= 0):
+      result["STEAM" & matches[0]] = matches[1]
+      i += 1
+
+proc versionOf*(versions: Table[string, string], class: string): string =
+  let key = class[1..^1].toUpperAscii()
+  if versions.hasKey(key): versions[key] else: ""
+
+proc versionDefine*(class: string): string =
+  class[1..^1].toUpperAscii() & "_INTERFACE_VERSION"
+
+# Name of the interface generated for an older version, ISteamUser017 for
+# SteamUser017
+proc versionedName*(class: string, version: string): string =
+  var digits = ""
+  for c in version:
+    if c in Digits: digits &= c
+    else: digits = ""
+  if digits == "": digits = version.filterIt(it in Digits).join("")
+  class & digits
+
+# Methods in vtable order; equal layouts share one wrapper
+proc layoutKey*(self: Class): string =
+  self.methods.mapIt(it.toInterfaceMethod()).join("\n")
+
+proc renamed*(self: Class, name: string): Class =
+  result.name = name
+  result.methods = self.methods
+  for m in result.methods.mitems():
+    m.class = name
+
+# The Linux side of an older interface, its header being gone
+proc toInterfaceDeclaration*(self: Class): string =
+  """
+class $1
+{
+public:
+  $2
+};
+""" % [self.name, self.methods.mapIt(it.toInterfaceMethod()).join("\n  ")]
+
+# Versions of the current headers are listed by their #define, so the
+# table matches the headers the dll is built against even when they are
+# newer than the generated code; the forwarder hashes them when it loads
+proc toVersionTable*(versions: seq[InterfaceVersion]): string =
+  var wrappers = newSeq[string]()
+  for v in versions:
+    if v.wrapper notin wrappers:
+      wrappers.add(v.wrapper)
+  let wraps = wrappers.mapIt("""
+static void *wrap$1(void *internal, const char *version)
+{
+  return internInterface<$1_, $1>("$1", ($1 *)internal, version);
+}
+""" % it).join("\n")
+  let entries = versions.mapIt(
+    if it.define != "":
+      "#ifdef $1\n  {$1, \"$2\", wrap$3},\n#endif" %
+        [it.define, it.base, it.wrapper]
+    else: """  {"$1", "$2", wrap$3},""" % [it.version, it.base, it.wrapper])
+  """
+#include <steam_api_.h>
+
+$1
+const InterfaceVersion knownVersions[] = {
+$2
+};
+const uint32_t knownVersionCount = sizeof(knownVersions) / sizeof(knownVersions[0]);
+""" % [wraps, entries.join("\n")]
@@ -6,3 +6,84 @@
 #include "steam_gameserver.h"
 #include "wine/debug.h"
 WINE_DEFAULT_DEBUG_CHANNEL(steam_api);
+
+// Initial number of slots in the WinCallback -> WrappedCallback registry
+#define CALLBACK_REGISTRY_SIZE 256
+// Number of WrappedCallback objects allocated at once
+#define CALLBACK_POOL_SLAB 64
+// Released WrappedCallback slots wait for this many later releases before reuse,
+// so a stale wrapper pointer is caught as released, see pool.h
+#define CALLBACK_POOL_QUARANTINE 64
+// Callbacks queued by the callback pump thread before it spills to a slower list
+#define CALLBACK_QUEUE_SIZE 1024
+// Callback payloads up to this size are copied without allocating
+#define CALLBACK_PAYLOAD_INLINE 256
+// Time SteamAPI_RunCallbacks_ may spend delivering callbacks, 0 means unlimited
+#define CALLBACK_BUDGET_US 0
+// Distinct callback IDs tracked by the callback statistics
+#define CALLBACK_STATS_SIZE 512
+// Initial number of slots in each internal interface -> wrapper table
+#define INTERN_REGISTRY_SIZE 16
+// Tracing of the interfaces marked hot by the codegen (--hotpath), compiled
+// in only with TRACE_LEVEL 2. TRACE_LEVEL 0 drops all tracing, see Makefile
+#if defined(TRACE_LEVEL) && TRACE_LEVEL < 2
+#define TRACE_HOT(...) do { } while (0)
+#define TRACE_HOT_ON 0
+#else
+#define TRACE_HOT TRACE
+#define TRACE_HOT_ON 1
+#endif
+// Distinct functions the profiler can count (STEAMFORWARDER_PROFILE)
+#define PROFILE_POINTS 2048
+// Threads with their own profiler counters at a time, calls from further threads
+// are not counted; rows of threads which exited are reused
+#define PROFILE_THREADS 32
+// Interned interface wrappers the flat exports can translate back, see intern.h
+#define INTERFACE_WRAPPERS 256
+// Room for a wrapper: its vtable and internal pointer
+#define INTERFACE_SLOT_SIZE (2 * sizeof(void *))
+// Library loaded on the first call with LAZY_STEAM_API, see lazy.h. The
+// Makefile names it after the one it would link otherwise
+#ifndef STEAM_API_LIBRARY
+#define STEAM_API_LIBRARY "libsteam_api.so"
+#endif
+// Bytes of a string or buffer argument kept by the call recorder, see recorder.h
+#define RECORD_BUFFER_CAP 4096
+// stdio buffer of the recording
+#define RECORD_FILE_BUFFER (1 << 20)
+// Scratch memory the replay passes for pointer arguments without a recorded size
+#define REPLAY_SCRATCH_SIZE (64 * 1024)
+// Largest recorded size argument the replay allocates a buffer for
+#define REPLAY_BUFFER_MAX (16 * 1024 * 1024)
+// Calls steambench.exe times per run of a method, see steambench.cpp
+#define STEAMBENCH_ITERATIONS 1000000
+// Runs of every steambench.exe case, the best and the median are reported
+#define STEAMBENCH_REPEAT 5
+// Channels of a networking interface the batched P2P receive keeps rings for, see p2p.h
+#define P2P_BATCH_CHANNELS 16
+// Bytes of every ring of the batched P2P receive, a multiple of 8
+#define P2P_BATCH_RING (256 * 1024)
+// Networking interfaces with batched receive, the client's and the game server's
+#define P2P_BATCH_INTERFACES 4
+// A frame of the game ends after this long even when neither SteamAPI_RunCallbacks
+// nor Steam_RunCallbacks ended it, see frames.h
+#define FRAME_TIMEOUT_US 50000
+// Networking interfaces with socket polling, see sockets.h
+#define SOCKET_POLL_INTERFACES 4
+// Peers per networking interface the P2P session cache has room for, a
+// power of two; half of them are cached, see sessions.h
+#define SESSION_CACHE_PEERS 256
+// Networking interfaces with a P2P session cache
+#define SESSION_CACHE_INTERFACES 4
+// Peer and channel pairs the P2P statistics have room for, three quarters
+// of them are used, see netstats.h
+#define NET_STATS_ENTRIES 1024
+// Packets the P2P capture can hold before its writer thread catches up,
+// further ones are dropped, see capture.h
+#define CAPTURE_RING_SLOTS 4096
+// Payload bytes of a captured P2P packet, longer ones are cut
+#define CAPTURE_SNAP_LENGTH 1200
+// stdio buffer of the capture file
+#define CAPTURE_FILE_BUFFER (1 << 20)
+// Sleep of the capture writer when the ring is empty
+#define CAPTURE_WRITER_SLEEP_US 1000
@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include "config.h"
+#include "forward.h"
+#include "recorder.h"
+
+// Trace lines longer than this are cut
+#define TRACE_LINE_SIZE 1024
+
+static int formatTraceValue(char *out, size_t size, char code, uint64_t value)
+{
+  switch (code)
+  {
+  case 'b':
+  case 'i':
+    return snprintf(out, size, "%lld", (long long)value);
+  case 'u':
+    return snprintf(out, size, "%llu", (unsigned long long)value);
+  case 'c':
+    return snprintf(out, size, "steamid:%llu", (unsigned long long)value);
+  case 'f':
+  {
+    double d;
+    memcpy(&d, &value, sizeof(d));
+    return snprintf(out, size, "%f", d);
+  }
+  case 's':
+    if (value == 0)
+      return snprintf(out, size, "NULL");
+    return snprintf(out, size, "\"%s\"", (const char *)(uintptr_t)value);
+  case 'p':
+    return snprintf(out, size, "%p", (void *)(uintptr_t)value);
+  default:
+    return snprintf(out, size, "{...}");
+  }
+}
+
+void traceCall(const char *name, const char *codes, const uint64_t *values)
+{
+  char line[TRACE_LINE_SIZE];
+  size_t used = 0;
+  line[0] = '\0';
+  for (int i = 0; codes[i] != '\0' && used < sizeof(line); i++)
+  {
+    if (i > 0)
+      used += snprintf(line + used, sizeof(line) - used, ", ");
+    if (used < sizeof(line))
+      used += formatTraceValue(line + used, sizeof(line) - used, codes[i],
+                               values[i]);
+  }
+  // Logged under the name of the forwarded function, TRACE would name this one
+  wine_dbg_log(__WINE_DBCL_TRACE, &__wine_dbch_steam_api, name, "(%s)\n", line);
+}
+
+void traceResult(const char *name, char code, uint64_t value)
+{
+  char result[TRACE_LINE_SIZE];
+  formatTraceValue(result, sizeof(result), code, value);
+  wine_dbg_log(__WINE_DBCL_TRACE, &__wine_dbch_steam_api, name, "() = %s\n", result);
+}
+
+// Kept out of forwardCall(), whose frame would otherwise hold the values
+// on every call
+static __attribute__((noinline)) void forwardDescribed(ProfilePoint *point, bool traced,
+                                                       bool recorded, ForwardInvoke invoke,
+                                                       ForwardDescribe describe,
+                                                       void **args, void *result)
+{
+  uint64_t values[FORWARD_MAX_ARGS];
+  const char *codes = describe(args, NULL, values);
+  if (traced)
+    traceCall(point->name, codes, values);
+  uint64_t start = recorded ? monotonicNs() : 0;
+  invoke(args, result);
+  uint64_t duration = recorded ? monotonicNs() - start : 0;
+  char resultCode = '\0';
+  uint64_t resultValue = 0;
+  if (result != NULL)
+  {
+    resultCode = describe(args, result, &resultValue)[0];
+    if (traced)
+      traceResult(point->name, resultCode, resultValue);
+  }
+  if (recorded)
+    recordCall(point, codes, values, resultCode, resultValue, start, duration);
+}
+
+void forwardCall(ProfilePoint *point, bool hot, ForwardInvoke invoke,
+                 ForwardDescribe describe, void **args, void *result)
+{
+  ProfileScope scope(point);
+  bool traced = (!hot || TRACE_HOT_ON) && TRACE_ON(steam_api);
+  bool recorded = recorderEnabled && describe != NULL;
+  if (traced || recorded)
+    forwardDescribed(point, traced, recorded, invoke, describe, args, result);
+  else
+    invoke(args, result);
+}
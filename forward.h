@@ -0,0 +1,268 @@
+#ifndef STEAM_FORWARDER_FORWARD
+#define STEAM_FORWARDER_FORWARD
+#include <string.h>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include "profiler.h"
+
+// The one body behind every generated wrapper: profiling, tracing of the
+// arguments and the result, and the call itself. The wrapper passes its
+// arguments on unchanged, so their types, and with them the trace format,
+// are known at compile time. Only the call is compiled for every wrapper,
+// the rest is shared, see forwardCall() in forward.cpp.
+//
+//   FORWARD_METHOD(BLoggedOn);
+//   bool ISteamUser_::BLoggedOn()
+//   {
+//     static ProfilePoint point("ISteamUser::BLoggedOn");
+//     return Forward<Method_BLoggedOn, true>::call(&point, this->internal);
+//   }
+
+// How a value of type T shows up in a trace, see formatTraceValue()
+template <class T, class Enable = void>
+struct TraceCode
+{
+  static constexpr char code = 'x';
+  static uint64_t pack(const T &) { return 0; }
+};
+
+template <>
+struct TraceCode<bool>
+{
+  static constexpr char code = 'b';
+  static uint64_t pack(bool value) { return value; }
+};
+
+template <class T>
+struct TraceCode<T, typename std::enable_if<std::is_enum<T>::value ||
+                                            (std::is_integral<T>::value &&
+                                             std::is_signed<T>::value)>::type>
+{
+  static constexpr char code = 'i';
+  static uint64_t pack(T value) { return (uint64_t)(int64_t)value; }
+};
+
+template <class T>
+struct TraceCode<T, typename std::enable_if<std::is_integral<T>::value &&
+                                            std::is_unsigned<T>::value>::type>
+{
+  static constexpr char code = 'u';
+  static uint64_t pack(T value) { return value; }
+};
+
+template <class T>
+struct TraceCode<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+  static constexpr char code = 'f';
+  static uint64_t pack(T value)
+  {
+    double d = value;
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+  }
+};
+
+template <class T>
+struct TraceCode<T *>
+{
+  static constexpr char code = 'p';
+  static uint64_t pack(T *value) { return (uintptr_t)value; }
+};
+
+template <>
+struct TraceCode<char *>
+{
+  static constexpr char code = 's';
+  static uint64_t pack(const char *value) { return (uintptr_t)value; }
+};
+
+template <>
+struct TraceCode<const char *>: TraceCode<char *> {};
+
+template <>
+struct TraceCode<CSteamID>
+{
+  static constexpr char code = 'c';
+  static uint64_t pack(const CSteamID &value) { return value.ConvertToUint64(); }
+};
+
+template <class T>
+using TraceCodeOf = TraceCode<typename std::decay<T>::type>;
+
+// codes holds one TraceCode::code per value
+void traceCall(const char *name, const char *codes, const uint64_t *values);
+void traceResult(const char *name, char code, uint64_t value);
+
+// The arguments of a call are passed around as an array of their addresses,
+// so everything but the call itself is done by a single function
+typedef void (*ForwardInvoke)(void **args, void *result);
+// Packs the arguments, or the result if it is not NULL, into values and
+// returns their codes. Used for tracing and recording (recorder.h).
+typedef const char *(*ForwardDescribe)(void **args, void *result, uint64_t *values);
+#define FORWARD_MAX_ARGS 32
+void forwardCall(ProfilePoint *point, bool hot, ForwardInvoke invoke,
+                 ForwardDescribe describe, void **args, void *result);
+
+template <size_t... I> struct Indices {};
+template <size_t N, size_t... I>
+struct MakeIndices: MakeIndices<N - 1, N - 1, I...> {};
+template <size_t... I>
+struct MakeIndices<0, I...> { typedef Indices<I...> type; };
+
+template <class T>
+static inline T &frameArg(void **args, size_t i)
+{
+  return *(T *)args[i];
+}
+
+template <class R>
+struct TraceFrameResult
+{
+  static const char *describe(void *result, uint64_t *values)
+  {
+    static const char codes[] = {TraceCodeOf<R>::code, '\0'};
+    values[0] = TraceCodeOf<R>::pack(*(R *)result);
+    return codes;
+  }
+};
+
+template <>
+struct TraceFrameResult<void>
+{
+  static const char *describe(void *, uint64_t *) { return ""; }
+};
+
+// One per distinct signature, only called when tracing or recording
+template <class R, class Indices, class... A>
+struct TraceFrame;
+
+template <class R, size_t... I, class... A>
+struct TraceFrame<R, Indices<I...>, A...>
+{
+  static_assert(sizeof...(A) <= FORWARD_MAX_ARGS, "raise FORWARD_MAX_ARGS");
+
+  static const char *describe(void **args, void *result, uint64_t *values)
+  {
+    if (result != NULL)
+      return TraceFrameResult<R>::describe(result, values);
+    static const char codes[] = {TraceCodeOf<A>::code..., '\0'};
+    const uint64_t packed[] = {TraceCodeOf<A>::pack(frameArg<A>(args, I))..., 0};
+    memcpy(values, packed, sizeof...(A) * sizeof(uint64_t));
+    return codes;
+  }
+};
+
+// The part which differs for every wrapper
+template <class Call, class R, class Indices, class... A>
+struct InvokeFrame;
+
+template <class Call, class R, size_t... I, class... A>
+struct InvokeFrame<Call, R, Indices<I...>, A...>
+{
+  static void invoke(void **args, void *result)
+  {
+    *(R *)result = Call::call(std::forward<A>(
+      frameArg<typename std::remove_reference<A>::type>(args, I))...);
+  }
+};
+
+template <class Call, size_t... I, class... A>
+struct InvokeFrame<Call, void, Indices<I...>, A...>
+{
+  static void invoke(void **args, void *)
+  {
+    Call::call(std::forward<A>(
+      frameArg<typename std::remove_reference<A>::type>(args, I))...);
+  }
+};
+
+// Without trace messages the TraceFrame functions are never referenced,
+// which leaves nothing to record either
+template <class Trace>
+static inline ForwardDescribe forwardDescribe()
+{
+#ifdef WINE_NO_TRACE_MSGS
+  return NULL;
+#else
+  return &Trace::describe;
+#endif
+}
+
+template <class R>
+struct ForwardResult
+{
+  template <class Invoke, class Trace>
+  static R run(ProfilePoint *point, bool hot, void **args)
+  {
+    R result;
+    forwardCall(point, hot, &Invoke::invoke, forwardDescribe<Trace>(), args,
+                &result);
+    return result;
+  }
+};
+
+template <>
+struct ForwardResult<void>
+{
+  template <class Invoke, class Trace>
+  static void run(ProfilePoint *point, bool hot, void **args)
+  {
+    forwardCall(point, hot, &Invoke::invoke, forwardDescribe<Trace>(), args,
+                NULL);
+  }
+};
+
+// Call is a Method_* or Function<> below; hot wrappers are traced only
+// with TRACE_LEVEL 2 like TRACE_HOT
+template <class Call, bool hot = false>
+struct Forward
+{
+  template <class... A>
+  static auto call(ProfilePoint *point, A &&... args)
+    -> decltype(Call::call(std::forward<A>(args)...))
+  {
+    typedef decltype(Call::call(std::forward<A>(args)...)) R;
+    typedef typename MakeIndices<sizeof...(A)>::type I;
+    void *frame[] = {const_cast<void *>((const void *)&args)..., NULL};
+    return ForwardResult<R>::template run<
+      InvokeFrame<Call, R, I, A &&...>,
+      TraceFrame<R, I, typename std::decay<A>::type...> >(point, hot, frame);
+  }
+
+  // CSteamID is returned through a hidden pointer, see fixcall in the codegen
+  template <class... A>
+  static CSteamID *hidden(ProfilePoint *point, CSteamID *hidden, A &&... args)
+  {
+    *hidden = call(point, std::forward<A>(args)...);
+    return hidden;
+  }
+};
+
+// Calls the method of that name on the internal interface. Resolving it at
+// the call, like the textual wrappers did, picks the right overload for
+// the wrapper's argument types.
+#define FORWARD_METHOD(method) \
+  struct Method_##method \
+  { \
+    template <class I, class... A> \
+    static auto call(I *self, A &&... args) \
+      -> decltype(self->method(std::forward<A>(args)...)) \
+    { \
+      return self->method(std::forward<A>(args)...); \
+    } \
+  }
+
+// Calls a function of the Linux steam_api, for the flat exports
+template <class F, F function>
+struct Function
+{
+  template <class... A>
+  static auto call(A &&... args) -> decltype(function(std::forward<A>(args)...))
+  {
+    return function(std::forward<A>(args)...);
+  }
+};
+#define FORWARD_FUNCTION(function) Function<decltype(&function), &function>
+#endif
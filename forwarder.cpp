@@ -0,0 +1,36 @@
+#include "callbacks.h"
+#include "callbackstats.h"
+#include "capture.h"
+#include "forwarder.h"
+#include "intern.h"
+#include "netstats.h"
+#include "p2p.h"
+#include "profiler.h"
+#include "recorder.h"
+#include "sessions.h"
+#include "sockets.h"
+
+void forwarderShutdown()
+{
+  TRACE("()\n");
+  callbacksShutdown();
+  callbackStatsDump();
+  p2pShutdown();
+  socketPollShutdown();
+  sessionCacheShutdown();
+  netStatsShutdown();
+  captureShutdown();
+  traceInterned();
+  profilerShutdown();
+  recorderShutdown();
+}
+
+void forwarderNewFrame()
+{
+  if (p2pBatchEnabled)
+    p2pNewFrame();
+  if (socketPollEnabled)
+    socketPollNewFrame();
+  if (sessionCacheEnabled)
+    sessionCacheNewFrame();
+}
@@ -0,0 +1,7 @@
+#ifndef STEAM_FORWARDER_HOOKS
+#define STEAM_FORWARDER_HOOKS
+// Called by SteamAPI_Shutdown_ before Steam itself is shut down
+void forwarderShutdown();
+// Called by SteamAPI_RunCallbacks_ and Steam_RunCallbacks_, see frames.h
+void forwarderNewFrame();
+#endif
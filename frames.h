@@ -0,0 +1,44 @@
+#ifndef STEAM_FORWARDER_FRAMES
+#define STEAM_FORWARDER_FRAMES
+#include <atomic>
+#include <stdint.h>
+#include "timer.h"
+
+// The frames of the game, for what is read from Steam once per frame
+// (p2p.h, sockets.h). forwarderNewFrame() ends a frame, which
+// SteamAPI_RunCallbacks_ and Steam_RunCallbacks_ call. A game pumping
+// Steam some other way, or not at all, never gets there, so a frame lasting
+// FRAME_TIMEOUT_US ends when it is next looked at.
+class FrameCounter
+{
+public:
+  FrameCounter(): frame(1), startedAt(monotonicNs()) {}
+
+  void next()
+  {
+    startedAt.store(monotonicNs(), std::memory_order_relaxed);
+    frame.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // The current frame, for a reader which last read Steam in frame seen
+  uint32_t current(uint32_t seen)
+  {
+    uint32_t now = frame.load(std::memory_order_relaxed);
+    if (now != seen)
+      return now;
+    uint64_t time = monotonicNs();
+    uint64_t started = startedAt.load(std::memory_order_relaxed);
+    if (time - started < FRAME_TIMEOUT_US * 1000ull)
+      return now;
+    // One reader ends the frame, the others see it ended
+    if (startedAt.compare_exchange_strong(started, time, std::memory_order_relaxed))
+      frame.fetch_add(1, std::memory_order_relaxed);
+    return frame.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<uint32_t> frame;
+  // monotonicNs() when the frame started
+  std::atomic<uint64_t> startedAt;
+};
+#endif
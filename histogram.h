@@ -0,0 +1,52 @@
+#ifndef STEAM_FORWARDER_HISTOGRAM
+#define STEAM_FORWARDER_HISTOGRAM
+#include <atomic>
+#include <stdint.h>
+
+// Histogram of durations with power of two buckets, updated lock-free.
+// Bucket n counts samples in [2^(n-1), 2^n) nanoseconds.
+struct Histogram
+{
+  static const int BUCKETS = 40;
+  std::atomic<uint32_t> buckets[BUCKETS];
+  std::atomic<uint64_t> count;
+  std::atomic<uint64_t> total;
+  std::atomic<uint64_t> max;
+
+  void add(uint64_t ns)
+  {
+    int bucket = ns == 0 ? 0 : 64 - __builtin_clzll(ns);
+    if (bucket >= BUCKETS)
+      bucket = BUCKETS - 1;
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t seen = max.load(std::memory_order_relaxed);
+    while (ns > seen && !max.compare_exchange_weak(seen, ns, std::memory_order_relaxed))
+      ;
+  }
+
+  // Upper bound of the bucket holding the given fraction of samples,
+  // capped by the largest sample
+  uint64_t percentile(double fraction) const
+  {
+    uint64_t n = count.load(std::memory_order_relaxed);
+    uint64_t wanted = (uint64_t)(n * fraction), seen = 0;
+    int i;
+    for (i = 0; i < BUCKETS - 1; i++)
+    {
+      seen += buckets[i].load(std::memory_order_relaxed);
+      if (seen > wanted)
+        break;
+    }
+    uint64_t bound = i == 0 ? 0 : 1ull << i, highest = max.load(std::memory_order_relaxed);
+    return bound < highest ? bound : highest;
+  }
+
+  uint64_t mean() const
+  {
+    uint64_t n = count.load(std::memory_order_relaxed);
+    return n == 0 ? 0 : total.load(std::memory_order_relaxed) / n;
+  }
+};
+#endif
@@ -0,0 +1,53 @@
+#include <mutex>
+#include <vector>
+#include "config.h"
+#include "intern.h"
+
+InterfaceSlot interfaceSlots[INTERFACE_WRAPPERS];
+std::atomic<intptr_t> interfaceInternals[INTERFACE_WRAPPERS];
+static std::mutex slotsLock;
+static unsigned slotsUsed = 0;
+static std::vector<unsigned> freeSlots;
+
+static std::mutex typesLock;
+static InternedType *types = NULL;
+
+InternedType::InternedType(const char *name): name(name), live(0)
+{
+  std::lock_guard<std::mutex> guard(typesLock);
+  next = types;
+  types = this;
+}
+
+void traceInterned()
+{
+  std::lock_guard<std::mutex> guard(typesLock);
+  for (InternedType *t = types; t != NULL; t = t->next)
+    TRACE("%u live %s_ wrappers\n", t->live.load(std::memory_order_relaxed), t->name);
+}
+
+void *allocateInterfaceSlot(void *internal)
+{
+  std::lock_guard<std::mutex> guard(slotsLock);
+  unsigned i;
+  if (!freeSlots.empty())
+  {
+    i = freeSlots.back();
+    freeSlots.pop_back();
+  }
+  else if (slotsUsed < INTERFACE_WRAPPERS)
+    i = slotsUsed++;
+  else
+    return NULL;
+  // Published before the wrapper can reach the game
+  interfaceInternals[i].store((intptr_t)internal, std::memory_order_release);
+  return interfaceSlots[i].storage;
+}
+
+void releaseInterfaceSlot(void *slot)
+{
+  std::lock_guard<std::mutex> guard(slotsLock);
+  unsigned i = (InterfaceSlot *)slot - interfaceSlots;
+  interfaceInternals[i].store(0, std::memory_order_release);
+  freeSlots.push_back(i);
+}
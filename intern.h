@@ -0,0 +1,78 @@
+#ifndef STEAM_FORWARDER_INTERN
+#define STEAM_FORWARDER_INTERN
+#include <atomic>
+#include <new>
+#include <stdint.h>
+#include "registry.h"
+
+// Wrappers created for one interface type, listed by traceInterned()
+struct InternedType
+{
+  InternedType(const char *name);
+  const char *name;
+  std::atomic<unsigned> live;
+  InternedType *next;
+};
+void traceInterned();
+
+// Interned wrappers live in one dense array, so the flat SteamAPI_ISteam*_
+// exports turn a wrapper pointer back into the internal interface with a
+// range check and an array load, see unwrapInstance()
+struct InterfaceSlot
+{
+  alignas(void *) unsigned char storage[INTERFACE_SLOT_SIZE];
+};
+extern InterfaceSlot interfaceSlots[INTERFACE_WRAPPERS];
+extern std::atomic<intptr_t> interfaceInternals[INTERFACE_WRAPPERS];
+// NULL when every slot is taken
+void *allocateInterfaceSlot(void *internal);
+void releaseInterfaceSlot(void *slot);
+
+static inline intptr_t unwrapInstance(intptr_t instancePtr)
+{
+  uintptr_t offset = (uintptr_t)instancePtr - (uintptr_t)interfaceSlots;
+  if (offset < sizeof(interfaceSlots))
+    return interfaceInternals[offset / sizeof(InterfaceSlot)].load(std::memory_order_acquire);
+  // Not one of our wrappers, pass it on as it is
+  return instancePtr;
+}
+
+// Returns the one wrapper of type W for the internal interface, so games
+// asking for the same interface every frame neither leak wrappers nor get a
+// different pointer on each call. Steam hands out a distinct object for every
+// interface version, so the internal pointer already identifies the version.
+template <class W, class I>
+W *internInterface(const char *type, I *internal, const char *version)
+{
+  static PointerRegistry<I, W> interned(INTERN_REGISTRY_SIZE);
+  static InternedType counter(type);
+  if (internal == NULL)
+    return NULL;
+  W *result = interned.find(internal);
+  if (result == NULL)
+  {
+    static_assert(sizeof(W) <= sizeof(InterfaceSlot), "wrapper does not fit INTERFACE_SLOT_SIZE");
+    void *slot = allocateInterfaceSlot(internal);
+    if (slot == NULL)
+      WARN("No interface slot left for %s, raise INTERFACE_WRAPPERS\n", type);
+    W *created = slot != NULL ? new (slot) W(internal) : new W(internal);
+    result = interned.insert(internal, created);
+    // Another thread may have wrapped the same interface meanwhile.
+    // ~W() would delete the shared internal interface, so only the memory is freed.
+    if (result != created)
+    {
+      if (slot != NULL)
+        releaseInterfaceSlot(slot);
+      else
+        ::operator delete(created);
+    }
+    else
+    {
+      counter.live.fetch_add(1, std::memory_order_relaxed);
+      TRACE("(%s *)%p (%s) wrapped as (%s_ *)%p\n", type, internal,
+            version ? version : "default", type, result);
+    }
+  }
+  return result;
+}
+#endif
@@ -0,0 +1,41 @@
+#include "config.h"
+#ifdef LAZY_STEAM_API
+#include <dlfcn.h>
+#include <mutex>
+#include "lazy.h"
+
+static void *library = NULL;
+static std::once_flag opened;
+
+// Stands in for whatever the library lacks. Returning 0 makes
+// SteamAPI_Init fail and every interface accessor return NULL, so a game
+// never gets far enough to call something returning a float or a struct.
+static unsigned long long missingSteamSymbol()
+{
+  return 0;
+}
+
+static void openSteamApi()
+{
+  library = dlopen(STEAM_API_LIBRARY, RTLD_NOW | RTLD_LOCAL);
+  if (library == NULL)
+    ERR("Could not load %s, Steam is unavailable: %s\n", STEAM_API_LIBRARY, dlerror());
+  else
+    TRACE("Loaded %s\n", STEAM_API_LIBRARY);
+}
+
+void *bindSteamSymbol(unsigned index)
+{
+  std::call_once(opened, openSteamApi);
+  void *address = library != NULL ? dlsym(library, steamSymbolNames[index]) : NULL;
+  if (address == NULL)
+  {
+    if (library != NULL)
+      WARN("%s is missing from %s\n", steamSymbolNames[index], STEAM_API_LIBRARY);
+    address = (void *)missingSteamSymbol;
+  }
+  // Threads binding the same symbol at once store the same address
+  __atomic_store_n(&steamSymbols[index], address, __ATOMIC_RELEASE);
+  return address;
+}
+#endif
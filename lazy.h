@@ -0,0 +1,83 @@
+#ifndef STEAM_FORWARDER_LAZY
+#define STEAM_FORWARDER_LAZY
+// With LAZY_STEAM_API (make LAZY_STEAM_API=1) libsteam_api is not linked.
+// Every function of it the forwarder calls gets a stub of the same name,
+// generated into autoclass/symbols.cpp, which jumps through steamSymbols.
+// An entry first points to a resolver which loads the library on the first
+// real call, looks the function up and patches the entry, so later calls
+// cost one indirect jump. The stubs take no signature, so calls from the
+// inline functions of the steam headers are covered as well.
+
+#define LAZY_HIDDEN __attribute__((visibility("hidden")))
+
+extern "C" {
+extern void *steamSymbols[] LAZY_HIDDEN;
+extern const char *const steamSymbolNames[] LAZY_HIDDEN;
+// Loads the library if needed and returns the entry of that symbol
+void *bindSteamSymbol(unsigned index) LAZY_HIDDEN;
+}
+extern const unsigned steamSymbolCount;
+
+#define LAZY_STRING(x) #x
+
+#if defined(__x86_64__)
+#define LAZY_JUMP(index) \
+  "  jmp *steamSymbols+8*" LAZY_STRING(index) "(%rip)\n"
+#define LAZY_PUSH(index) "  pushq $" LAZY_STRING(index) "\n"
+// Arguments may be in rdi, rsi, rdx, rcx, r8, r9, xmm0-7 and the vector
+// count of a varargs call in rax
+#define LAZY_RESOLVER \
+  asm(".pushsection .text\n" \
+      ".type steamLazyResolve,@function\n" \
+      "steamLazyResolve:\n" \
+      "  pushq %rbp\n  movq %rsp, %rbp\n" \
+      "  pushq %rdi\n  pushq %rsi\n  pushq %rdx\n  pushq %rcx\n" \
+      "  pushq %r8\n  pushq %r9\n  pushq %rax\n" \
+      "  andq $-16, %rsp\n  subq $128, %rsp\n" \
+      "  movdqu %xmm0, 0(%rsp)\n  movdqu %xmm1, 16(%rsp)\n" \
+      "  movdqu %xmm2, 32(%rsp)\n  movdqu %xmm3, 48(%rsp)\n" \
+      "  movdqu %xmm4, 64(%rsp)\n  movdqu %xmm5, 80(%rsp)\n" \
+      "  movdqu %xmm6, 96(%rsp)\n  movdqu %xmm7, 112(%rsp)\n" \
+      "  movq 8(%rbp), %rdi\n  call bindSteamSymbol\n  movq %rax, %r11\n" \
+      "  movdqu 0(%rsp), %xmm0\n  movdqu 16(%rsp), %xmm1\n" \
+      "  movdqu 32(%rsp), %xmm2\n  movdqu 48(%rsp), %xmm3\n" \
+      "  movdqu 64(%rsp), %xmm4\n  movdqu 80(%rsp), %xmm5\n" \
+      "  movdqu 96(%rsp), %xmm6\n  movdqu 112(%rsp), %xmm7\n" \
+      "  leaq -56(%rbp), %rsp\n" \
+      "  popq %rax\n  popq %r9\n  popq %r8\n  popq %rcx\n" \
+      "  popq %rdx\n  popq %rsi\n  popq %rdi\n" \
+      "  popq %rbp\n  addq $8, %rsp\n  jmp *%r11\n" \
+      ".popsection\n")
+#elif defined(__i386__)
+// Position independent without touching ebx, eax is free on entry
+#define LAZY_JUMP(index) \
+  "  call 1f\n1:\n  popl %eax\n" \
+  "  jmp *steamSymbols+4*" LAZY_STRING(index) "-1b(%eax)\n"
+#define LAZY_PUSH(index) "  pushl $" LAZY_STRING(index) "\n"
+// Arguments are all on the stack. Windows callers may leave it aligned to
+// 4 bytes only, so it is realigned for bindSteamSymbol.
+#define LAZY_RESOLVER \
+  asm(".pushsection .text\n" \
+      ".type steamLazyResolve,@function\n" \
+      "steamLazyResolve:\n" \
+      "  pushl %ebp\n  movl %esp, %ebp\n" \
+      "  andl $-16, %esp\n  subl $12, %esp\n" \
+      "  pushl 4(%ebp)\n  call bindSteamSymbol\n" \
+      "  movl %ebp, %esp\n  popl %ebp\n  addl $4, %esp\n  jmp *%eax\n" \
+      ".popsection\n")
+#elif defined(LAZY_STEAM_API)
+#error "LAZY_STEAM_API needs an x86 or x86_64 build"
+#endif
+
+// The stub for the function name, whose entry is steamSymbols[index], and
+// lazy_name which binds it. index has to be a literal number.
+#define LAZY_SYMBOL(index, name) \
+  asm(".pushsection .text\n" \
+      ".globl " #name "\n.hidden " #name "\n.type " #name ",@function\n" \
+      #name ":\n" LAZY_JUMP(index) \
+      ".globl lazy_" #name "\n.hidden lazy_" #name "\n" \
+      "lazy_" #name ":\n" LAZY_PUSH(index) "  jmp steamLazyResolve\n" \
+      ".popsection\n"); \
+  extern "C" void lazy_##name() LAZY_HIDDEN;
+#define LAZY_ENTRY(name) (void *)lazy_##name
+#endif
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <fcntl.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+#include "capture.h"
+#include "config.h"
+#include "netstats.h"
+#include "profiler.h"
+
+// STEAMFORWARDER_NET_STATS=<file> enables the statistics
+static NetStatsHeader *segment = NULL;
+static char segmentName[64];
+static const char *statsPath = NULL;
+// Entries are added under the lock and found without it
+static std::mutex entriesLock;
+
+static bool netStatsInit()
+{
+  statsPath = getenv("STEAMFORWARDER_NET_STATS");
+  if (statsPath == NULL)
+    return false;
+  snprintf(segmentName, sizeof(segmentName), "/steamnet-%d", (int)getpid());
+  size_t size = netStatsSize(NET_STATS_ENTRIES);
+  int fd = shm_open(segmentName, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    ERR("Cannot create shared memory segment %s\n", segmentName);
+    return false;
+  }
+  void *p = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+    p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+  {
+    ERR("Cannot map %lu bytes of %s\n", (unsigned long)size, segmentName);
+    shm_unlink(segmentName);
+    return false;
+  }
+  segment = (NetStatsHeader *)p;
+  segment->entries = NET_STATS_ENTRIES;
+  segment->layout = NET_STATS_LAYOUT;
+  NetStatsEntry *other = netStatsEntry(segment, 0);
+  other->channel = -1;
+  other->ready.store(1, std::memory_order_relaxed);
+  segment->usedEntries.store(1, std::memory_order_relaxed);
+  // Readers ignore the segment until the magic is there
+  std::atomic_thread_fence(std::memory_order_release);
+  segment->magic = NET_STATS_MAGIC;
+  TRACE("P2P statistics into /dev/shm%s\n", segmentName);
+  return true;
+}
+
+bool netStatsEnabled = netStatsInit();
+
+static inline uint32_t slotOf(uint64_t remote, int channel)
+{
+  uint64_t hash = (remote ^ ((uint64_t)(uint32_t)channel << 40)) * 0x9e3779b97f4a7c15ull;
+  return 1 + (uint32_t)(hash >> 32) % (NET_STATS_ENTRIES - 1);
+}
+
+// The entry of the peer's channel, entry 0 once the table is full
+static NetStatsEntry *entryOf(uint64_t remote, int channel)
+{
+  uint32_t slot = slotOf(remote, channel);
+  for (uint32_t i = 0; i < NET_STATS_ENTRIES - 1; i++)
+  {
+    NetStatsEntry *entry = netStatsEntry(segment, 1 + (slot - 1 + i) % (NET_STATS_ENTRIES - 1));
+    if (entry->ready.load(std::memory_order_acquire) == 0)
+      break;
+    if (entry->remote == remote && entry->channel == channel)
+      return entry;
+  }
+  std::lock_guard<std::mutex> guard(entriesLock);
+  for (uint32_t i = 0; i < NET_STATS_ENTRIES - 1; i++)
+  {
+    NetStatsEntry *entry = netStatsEntry(segment, 1 + (slot - 1 + i) % (NET_STATS_ENTRIES - 1));
+    if (entry->ready.load(std::memory_order_relaxed) == 0)
+    {
+      // Kept a quarter empty, so a lookup ends at a free entry soon
+      if (segment->usedEntries.load(std::memory_order_relaxed) >= NET_STATS_ENTRIES / 4 * 3)
+        break;
+      entry->remote = remote;
+      entry->channel = channel;
+      entry->ready.store(1, std::memory_order_release);
+      segment->usedEntries.fetch_add(1, std::memory_order_relaxed);
+      return entry;
+    }
+    if (entry->remote == remote && entry->channel == channel)
+      return entry;
+  }
+  return netStatsEntry(segment, 0);
+}
+
+void netStatsReceived(CSteamID remote, int nChannel, uint32 size, uint64_t arrival)
+{
+  if (segment == NULL)
+    return;
+  NetStatsEntry *entry = entryOf(remote.ConvertToUint64(), nChannel);
+  entry->receivedPackets.fetch_add(1, std::memory_order_relaxed);
+  entry->receivedBytes.fetch_add(size, std::memory_order_relaxed);
+  uint64_t last = entry->lastArrival.exchange(arrival, std::memory_order_relaxed);
+  if (last == 0 || arrival < last)
+    return;
+  uint64_t interval = arrival - last;
+  uint64_t previous = entry->lastInterval.exchange(interval, std::memory_order_relaxed);
+  if (previous == 0)
+    return;
+  uint64_t difference = interval > previous ? interval - previous : previous - interval;
+  entry->jitters.add(difference);
+  // J += (|D| - J) / 16; racing readers of one channel may lose an update
+  uint64_t jitter = entry->jitter.load(std::memory_order_relaxed);
+  entry->jitter.store(jitter + ((int64_t)difference - (int64_t)jitter) / 16, std::memory_order_relaxed);
+}
+
+void netSendP2PPacket(CSteamID steamIDRemote, const void *pubData, uint32 cubData, int eP2PSendType,
+                      int nChannel, bool sent)
+{
+  if (captureEnabled)
+    captureSent(steamIDRemote, nChannel, eP2PSendType, pubData, cubData, sent);
+  if (segment == NULL)
+    return;
+  NetStatsEntry *entry = entryOf(steamIDRemote.ConvertToUint64(), nChannel);
+  if (!sent)
+  {
+    entry->failedSends.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  entry->sentPackets.fetch_add(1, std::memory_order_relaxed);
+  entry->sentBytes.fetch_add(cubData, std::memory_order_relaxed);
+  if (eP2PSendType >= 0 && eP2PSendType < NET_STATS_SEND_TYPES)
+    entry->sendTypes[eP2PSendType].fetch_add(1, std::memory_order_relaxed);
+}
+
+void netReadP2PPacket(const void *pubDest, uint32 cubDest, const uint32 *pcubMsgSize,
+                      const CSteamID *psteamIDRemote, int nChannel, bool read)
+{
+  if (!read || pcubMsgSize == NULL || psteamIDRemote == NULL)
+    return;
+  uint32 size = *pcubMsgSize < cubDest ? *pcubMsgSize : cubDest;
+  if (netStatsEnabled)
+    netStatsReceived(*psteamIDRemote, nChannel, size, monotonicNs());
+  if (captureEnabled)
+    captureReceived(*psteamIDRemote, nChannel, pubDest, size);
+}
+
+static uint64_t traffic(const NetStatsEntry *entry)
+{
+  return entry->sentBytes.load(std::memory_order_relaxed) +
+    entry->receivedBytes.load(std::memory_order_relaxed);
+}
+
+// The channels of a peer together, the busiest first
+static bool byPeerThenTraffic(const NetStatsEntry *a, const NetStatsEntry *b)
+{
+  if (a->remote != b->remote)
+    return a->remote < b->remote;
+  return traffic(a) > traffic(b);
+}
+
+static void dumpEntry(FILE *out, const NetStatsEntry *entry)
+{
+  const Histogram &h = entry->jitters;
+  fprintf(out, " %9llu %9.1f %7llu %7llu %7llu %7llu %7llu %9llu %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+          (unsigned long long)entry->sentPackets.load(std::memory_order_relaxed),
+          entry->sentBytes.load(std::memory_order_relaxed) / 1024.0,
+          (unsigned long long)entry->failedSends.load(std::memory_order_relaxed),
+          (unsigned long long)entry->sendTypes[0].load(std::memory_order_relaxed),
+          (unsigned long long)entry->sendTypes[1].load(std::memory_order_relaxed),
+          (unsigned long long)entry->sendTypes[2].load(std::memory_order_relaxed),
+          (unsigned long long)entry->sendTypes[3].load(std::memory_order_relaxed),
+          (unsigned long long)entry->receivedPackets.load(std::memory_order_relaxed),
+          entry->receivedBytes.load(std::memory_order_relaxed) / 1024.0,
+          entry->jitter.load(std::memory_order_relaxed) / 1000.0, h.percentile(0.5) / 1000.0,
+          h.percentile(0.99) / 1000.0, h.max.load(std::memory_order_relaxed) / 1000.0);
+}
+
+void netStatsDump()
+{
+  if (segment == NULL)
+    return;
+  std::vector<const NetStatsEntry *> entries;
+  for (uint32_t i = 1; i < NET_STATS_ENTRIES; i++)
+    if (netStatsEntry(segment, i)->ready.load(std::memory_order_acquire) != 0)
+      entries.push_back(netStatsEntry(segment, i));
+  std::sort(entries.begin(), entries.end(), byPeerThenTraffic);
+  const NetStatsEntry *other = netStatsEntry(segment, 0);
+  if (traffic(other) != 0 || other->failedSends.load(std::memory_order_relaxed) != 0)
+    entries.push_back(other);
+  bool toStderr = strcmp(statsPath, "-") == 0;
+  FILE *out = toStderr ? stderr : fopen(statsPath, "a");
+  if (out == NULL)
+  {
+    ERR("Cannot open %s\n", statsPath);
+    return;
+  }
+  fprintf(out, "%-20s %7s %9s %9s %7s %7s %7s %7s %7s %9s %9s %9s %9s %9s %9s\n", "peer", "channel",
+          "sent", "sent KB", "failed", "unrel", "nodelay", "rel", "relbuf", "received", "recv KB",
+          "jitter", "jit p50", "jit p99", "jit max");
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+    if (entries[i] == other)
+      fprintf(out, "%-20s %7s", "other", "");
+    else
+      fprintf(out, "%-20llu %7d", (unsigned long long)entries[i]->remote, entries[i]->channel);
+    dumpEntry(out, entries[i]);
+  }
+  fprintf(out, "(jitter in microseconds, percentiles are bucket upper bounds)\n");
+  if (toStderr)
+    fflush(out);
+  else
+    fclose(out);
+}
+
+void netStatsShutdown()
+{
+  netStatsDump();
+  // The mapping stays valid for threads still inside a networking call;
+  // a running steamnet keeps its own mapping of the unlinked segment
+  if (segment != NULL)
+    shm_unlink(segmentName);
+}
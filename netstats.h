@@ -0,0 +1,79 @@
+#ifndef STEAM_FORWARDER_NETSTATS
+#define STEAM_FORWARDER_NETSTATS
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include "histogram.h"
+
+// P2P traffic counters per remote Steam ID and channel, kept when
+// STEAMFORWARDER_NET_STATS=<file> is set, in a shared memory segment
+// /dev/shm/steamnet-<pid> which tools/steamnet reads. The table is written
+// to <file> ("-" for stderr) on SteamAPI_Shutdown.
+//
+// Jitter is the difference between two consecutive inter-arrival times of
+// a peer's channel; the histogram holds every sample, the estimate is the
+// smoothed one of RFC 3550. A packet arrives when the forwarder reads it
+// from Steam, which with STEAMFORWARDER_P2P_BATCH=1 is when p2p.cpp drains
+// the channel, not when the game takes it from the ring (p2p.h).
+//
+// Segment layout: NetStatsHeader, then entries[NetStatsHeader::entries].
+// Entry 0 counts the traffic which did not fit into the table.
+#define NET_STATS_MAGIC 0x5346504e
+#define NET_STATS_LAYOUT 1
+// k_EP2PSendUnreliable to k_EP2PSendReliableWithBuffering
+#define NET_STATS_SEND_TYPES 4
+
+struct NetStatsHeader
+{
+  uint32_t magic;
+  uint32_t layout;
+  uint32_t entries;
+  std::atomic<uint32_t> usedEntries;
+};
+
+struct NetStatsEntry
+{
+  // Set before the entry is published, readers skip entries not ready yet
+  uint64_t remote;
+  int32_t channel;
+  std::atomic<uint32_t> ready;
+  std::atomic<uint64_t> sentPackets;
+  std::atomic<uint64_t> sentBytes;
+  std::atomic<uint64_t> failedSends;
+  std::atomic<uint64_t> sendTypes[NET_STATS_SEND_TYPES];
+  std::atomic<uint64_t> receivedPackets;
+  std::atomic<uint64_t> receivedBytes;
+  std::atomic<uint64_t> lastArrival;
+  std::atomic<uint64_t> lastInterval;
+  // RFC 3550 estimate in nanoseconds
+  std::atomic<uint64_t> jitter;
+  Histogram jitters;
+};
+
+static inline size_t netStatsSize(uint32_t entries)
+{
+  return sizeof(NetStatsHeader) + (size_t)entries * sizeof(NetStatsEntry);
+}
+
+static inline NetStatsEntry *netStatsEntry(NetStatsHeader *h, uint32_t entry)
+{
+  return (NetStatsEntry *)(h + 1) + entry;
+}
+
+class CSteamID;
+
+extern bool netStatsEnabled;
+// arrival is the monotonicNs() of the read from Steam
+void netStatsReceived(CSteamID remote, int nChannel, uint32_t size, uint64_t arrival);
+void netStatsDump();
+void netStatsShutdown();
+
+// What the ISteamNetworking_ wrappers and the flat exports call after the
+// forwarded call with the statistics or the packet capture (capture.h) on,
+// so the call is traced and recorded as without them. Packets the batched
+// receive serves from its rings are counted in p2pReadPacket(), see p2p.h.
+void netSendP2PPacket(CSteamID steamIDRemote, const void *pubData, uint32_t cubData, int eP2PSendType,
+                      int nChannel, bool sent);
+void netReadP2PPacket(const void *pubDest, uint32_t cubDest, const uint32_t *pcubMsgSize,
+                      const CSteamID *psteamIDRemote, int nChannel, bool read);
+#endif
@@ -0,0 +1,324 @@
+#include <atomic>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "capture.h"
+#include "config.h"
+#include "frames.h"
+#include "netstats.h"
+#include "p2p.h"
+#include "profiler.h"
+#include "timer.h"
+
+static bool p2pBatchInit()
+{
+  const char *enabled = getenv("STEAMFORWARDER_P2P_BATCH");
+  if (enabled == NULL || atoi(enabled) == 0)
+    return false;
+  TRACE("P2P packets are received in batches of a frame\n");
+  return true;
+}
+
+bool p2pBatchEnabled = p2pBatchInit();
+
+// Every packet in a ring starts at a multiple of 8 with this header.
+// A header with skip set, or less room than a header before the end of the
+// ring, sends the reader back to the start.
+struct PacketHeader
+{
+  uint32 size;
+  uint32 skip;
+  uint64 remote;
+  // monotonicNs() when it was read from Steam, for the network statistics
+  uint64 arrival;
+};
+
+static inline size_t recordSize(uint32 size)
+{
+  return (sizeof(PacketHeader) + size + 7) & ~(size_t)7;
+}
+
+class PacketRing
+{
+public:
+  PacketRing(): head(0), tail(0), used(0) {}
+
+  bool empty() const { return used == 0; }
+
+  // Where a packet of size bytes goes, NULL if it does not fit now
+  unsigned char *reserve(uint32 size)
+  {
+    size_t record = recordSize(size);
+    if (record > P2P_BATCH_RING)
+      return NULL;
+    if (bytes.empty())
+      bytes.resize(P2P_BATCH_RING);
+    if (used == 0)
+      head = tail = 0;
+    if (tail > head || used == 0)
+    {
+      if (P2P_BATCH_RING - tail >= record)
+        return &bytes[tail];
+      return head >= record ? &bytes[0] : NULL;
+    }
+    return tail < head && head - tail >= record ? &bytes[tail] : NULL;
+  }
+
+  // The packet reserve() made room for has been read
+  void commit(unsigned char *at, uint32 size, uint64 remote, uint64 arrival)
+  {
+    size_t offset = at - &bytes[0];
+    if (offset != tail)
+    {
+      // Wrapped, the rest of the ring is skipped
+      if (P2P_BATCH_RING - tail >= sizeof(PacketHeader))
+        ((PacketHeader *)&bytes[tail])->skip = 1;
+      used += P2P_BATCH_RING - tail;
+    }
+    PacketHeader *header = (PacketHeader *)at;
+    header->size = size;
+    header->skip = 0;
+    header->remote = remote;
+    header->arrival = arrival;
+    tail = offset + recordSize(size);
+    used += recordSize(size);
+  }
+
+  // NULL when empty
+  const PacketHeader *front()
+  {
+    if (used == 0)
+      return NULL;
+    if (P2P_BATCH_RING - head < sizeof(PacketHeader) || ((PacketHeader *)&bytes[head])->skip)
+    {
+      used -= P2P_BATCH_RING - head;
+      head = 0;
+    }
+    return (const PacketHeader *)&bytes[head];
+  }
+
+  void pop()
+  {
+    size_t record = recordSize(((PacketHeader *)&bytes[head])->size);
+    head += record;
+    used -= record;
+  }
+
+private:
+  std::vector<unsigned char> bytes;
+  size_t head, tail;
+  // Bytes between head and tail, skipped ones included
+  size_t used;
+};
+
+struct Channel
+{
+  int channel;
+  // Frame of the last drain
+  uint32_t drained;
+  // Steam held packets the ring had no room for at the last drain
+  bool stalled;
+  PacketRing ring;
+};
+
+struct Receiver
+{
+  std::atomic<ISteamNetworking *> internal;
+  std::mutex lock;
+  unsigned channelCount;
+  Channel channels[P2P_BATCH_CHANNELS];
+  // Statistics for the trace at shutdown
+  uint64_t drains, packets, served;
+};
+
+static Receiver receivers[P2P_BATCH_INTERFACES];
+static std::mutex receiversLock;
+static FrameCounter frames;
+
+void p2pNewFrame()
+{
+  frames.next();
+}
+
+// NULL when every receiver is taken
+static Receiver *receiverOf(ISteamNetworking *internal)
+{
+  for (unsigned i = 0; i < P2P_BATCH_INTERFACES; i++)
+    if (receivers[i].internal.load(std::memory_order_acquire) == internal)
+      return &receivers[i];
+  std::lock_guard<std::mutex> guard(receiversLock);
+  for (unsigned i = 0; i < P2P_BATCH_INTERFACES; i++)
+  {
+    ISteamNetworking *owner = receivers[i].internal.load(std::memory_order_relaxed);
+    if (owner == internal)
+      return &receivers[i];
+    if (owner == NULL)
+    {
+      receivers[i].channelCount = 0;
+      receivers[i].drains = receivers[i].packets = receivers[i].served = 0;
+      receivers[i].internal.store(internal, std::memory_order_release);
+      return &receivers[i];
+    }
+  }
+  return NULL;
+}
+
+// With the receiver locked, NULL when the channel is not batched
+static Channel *channelOf(Receiver *receiver, int channel)
+{
+  for (unsigned i = 0; i < receiver->channelCount; i++)
+    if (receiver->channels[i].channel == channel)
+      return &receiver->channels[i];
+  if (receiver->channelCount == P2P_BATCH_CHANNELS)
+    return NULL;
+  Channel *added = &receiver->channels[receiver->channelCount++];
+  added->channel = channel;
+  added->drained = 0;
+  added->stalled = false;
+  return added;
+}
+
+// With the receiver locked
+static void drainChannel(Receiver *receiver, Channel *channel, uint32_t frame)
+{
+  ISteamNetworking *internal = receiver->internal.load(std::memory_order_relaxed);
+  channel->drained = frame;
+  channel->stalled = false;
+  uint32 size;
+  while (internal->IsP2PPacketAvailable(&size, channel->channel))
+  {
+    unsigned char *at = channel->ring.reserve(size);
+    if (at == NULL)
+    {
+      channel->stalled = true;
+      return;
+    }
+    uint32 read;
+    CSteamID remote;
+    if (!internal->ReadP2PPacket(at + sizeof(PacketHeader), size, &read, &remote,
+                                 channel->channel))
+      return;
+    // The game reads a whole frame's packets in one burst, so the intervals
+    // between them are taken here
+    channel->ring.commit(at, read, remote.ConvertToUint64(), netStatsEnabled ? monotonicNs() : 0);
+    receiver->packets++;
+  }
+}
+
+// With the receiver locked: the ring of the channel refilled if the frame
+// has not drained it yet, or if it stalled
+static void refill(Receiver *receiver, Channel *channel)
+{
+  if (!channel->ring.empty())
+    return;
+  uint32_t frame = frames.current(channel->drained);
+  if (channel->drained == frame && !channel->stalled)
+    return;
+  if (channel->drained != frame)
+  {
+    // Every channel at once, so the rest of the frame needs no Steam calls
+    receiver->drains++;
+    for (unsigned i = 0; i < receiver->channelCount; i++)
+      if (receiver->channels[i].drained != frame)
+        drainChannel(receiver, &receiver->channels[i], frame);
+  }
+  if (channel->ring.empty() && channel->stalled)
+    drainChannel(receiver, channel, frame);
+}
+
+bool p2pIsPacketAvailable(ProfilePoint *point, ISteamNetworking *internal, uint32 *pcubMsgSize,
+                          int nChannel)
+{
+  ProfileScope scope(point);
+  Receiver *receiver = internal != NULL ? receiverOf(internal) : NULL;
+  if (receiver != NULL)
+  {
+    std::lock_guard<std::mutex> guard(receiver->lock);
+    Channel *channel = channelOf(receiver, nChannel);
+    if (channel != NULL)
+    {
+      refill(receiver, channel);
+      const PacketHeader *header = channel->ring.front();
+      if (header != NULL)
+      {
+        *pcubMsgSize = header->size;
+        return true;
+      }
+      // Only a packet larger than the ring is left with Steam
+      if (!channel->stalled)
+        return false;
+    }
+  }
+  return internal != NULL && internal->IsP2PPacketAvailable(pcubMsgSize, nChannel);
+}
+
+bool p2pReadPacket(ProfilePoint *point, ISteamNetworking *internal, void *pubDest, uint32 cubDest,
+                   uint32 *pcubMsgSize, CSteamID *psteamIDRemote, int nChannel)
+{
+  ProfileScope scope(point);
+  bool read = false;
+  CSteamID remote;
+  uint32 size = 0;
+  uint64_t arrival = 0;
+  Receiver *receiver = p2pBatchEnabled && internal != NULL ? receiverOf(internal) : NULL;
+  if (receiver != NULL)
+  {
+    std::lock_guard<std::mutex> guard(receiver->lock);
+    Channel *channel = channelOf(receiver, nChannel);
+    if (channel != NULL)
+    {
+      refill(receiver, channel);
+      const PacketHeader *header = channel->ring.front();
+      if (header != NULL)
+      {
+        // Like Steam, a short buffer gets the start of the packet
+        size = header->size < cubDest ? header->size : cubDest;
+        memcpy(pubDest, header + 1, size);
+        remote = CSteamID((uint64)header->remote);
+        arrival = header->arrival;
+        channel->ring.pop();
+        receiver->served++;
+        read = true;
+      }
+      else if (!channel->stalled)
+        return false;
+    }
+  }
+  if (!read)
+  {
+    read = internal != NULL && internal->ReadP2PPacket(pubDest, cubDest, &size, &remote, nChannel);
+    if (netStatsEnabled)
+      arrival = monotonicNs();
+  }
+  if (!read)
+    return false;
+  *pcubMsgSize = size;
+  if (psteamIDRemote != NULL)
+    *psteamIDRemote = remote;
+  if (netStatsEnabled)
+    netStatsReceived(remote, nChannel, size, arrival);
+  if (captureEnabled)
+    captureReceived(remote, nChannel, pubDest, size);
+  return true;
+}
+
+void p2pShutdown()
+{
+  std::lock_guard<std::mutex> guard(receiversLock);
+  for (unsigned i = 0; i < P2P_BATCH_INTERFACES; i++)
+  {
+    Receiver &receiver = receivers[i];
+    if (receiver.internal.load(std::memory_order_relaxed) == NULL)
+      continue;
+    std::lock_guard<std::mutex> lock(receiver.lock);
+    TRACE("P2P batch of %p: %llu drains read %llu packets, %llu served\n",
+          receiver.internal.load(std::memory_order_relaxed), (unsigned long long)receiver.drains,
+          (unsigned long long)receiver.packets, (unsigned long long)receiver.served);
+    // Steam is going away, whatever is left in the rings with it
+    for (unsigned c = 0; c < receiver.channelCount; c++)
+      receiver.channels[c].ring = PacketRing();
+    receiver.channelCount = 0;
+    receiver.internal.store(NULL, std::memory_order_release);
+  }
+}
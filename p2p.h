@@ -0,0 +1,43 @@
+#ifndef STEAM_FORWARDER_P2P
+#define STEAM_FORWARDER_P2P
+#include <stdint.h>
+#include <stddef.h>
+
+// Batched P2P receive, switched on with STEAMFORWARDER_P2P_BATCH=1.
+//
+// Games drain their channels with
+//
+//   while (IsP2PPacketAvailable(&size, channel))
+//     ReadP2PPacket(buffer, size, &size, &remote, channel);
+//
+// every frame, which is two forwarded calls per packet and one per empty
+// channel. With the batch on, the first of these calls in a frame reads
+// whatever Steam holds for every channel the game polled so far into a
+// ring per channel; the rest of the frame is served from the rings without
+// calling Steam. Packets arriving later in the frame wait for the next one,
+// which SteamAPI_RunCallbacks or Steam_RunCallbacks starts, or at the
+// latest FRAME_TIMEOUT_US after this one started (frames.h). Served calls
+// are profiled, but neither traced nor recorded.
+//
+// A ring never drops a packet: when it is full, or a packet is larger than
+// the ring, the rest stays with Steam and is read once the ring is empty,
+// the large packet straight into the game's buffer. Channels beyond
+// P2P_BATCH_CHANNELS are not batched.
+
+class ISteamNetworking;
+class CSteamID;
+struct ProfilePoint;
+
+extern bool p2pBatchEnabled;
+// Called by forwarderNewFrame(), the rings are refilled once per frame
+void p2pNewFrame();
+void p2pShutdown();
+
+// What the ISteamNetworking_ wrappers and the flat exports call instead of
+// Forward<> with the batch on; the network statistics and the packet
+// capture see the packets p2pReadPacket() returns (netstats.h, capture.h)
+bool p2pIsPacketAvailable(ProfilePoint *point, ISteamNetworking *internal, uint32_t *pcubMsgSize,
+                          int nChannel);
+bool p2pReadPacket(ProfilePoint *point, ISteamNetworking *internal, void *pubDest, uint32_t cubDest,
+                   uint32_t *pcubMsgSize, CSteamID *psteamIDRemote, int nChannel);
+#endif
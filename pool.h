@@ -0,0 +1,139 @@
+#ifndef STEAM_FORWARDER_POOL
+#define STEAM_FORWARDER_POOL
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <stdint.h>
+
+// Fixed-size slab allocator with recycling.
+// Every slot carries a generation counter which is odd while the slot is in
+// use. Released objects are not destroyed, so a stale virtual call still
+// lands in T, which can then ask isLive() whether it has been released.
+// Free slots queue up oldest first, and the last Quarantine of them are
+// never handed out, so a stale pointer keeps pointing at a released slot
+// for a while instead of at a new object at once. Past that, only a caller
+// which kept the generation can tell.
+template <class T, unsigned SlabSize, unsigned Quarantine = 0>
+class SlabPool
+{
+public:
+  struct Stats
+  {
+    unsigned live;
+    unsigned peak;
+    unsigned capacity;
+    unsigned slabs;
+    unsigned long allocations;
+    unsigned long recycled;
+  };
+
+  SlabPool(): freelist(NULL), freeTail(NULL), freeSlots(0)
+  {
+    counters.live = counters.peak = counters.capacity = counters.slabs = 0;
+    counters.allocations = counters.recycled = 0;
+  }
+
+  void *allocate()
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    if (freeSlots <= Quarantine)
+      addSlab();
+    Slot *slot = freelist;
+    freelist = slot->next;
+    if (freelist == NULL)
+      freeTail = NULL;
+    freeSlots--;
+    if (slot->generation.fetch_add(1, std::memory_order_release) != 0)
+      counters.recycled++;
+    counters.allocations++;
+    if (++counters.live > counters.peak)
+      counters.peak = counters.live;
+    return slot->storage;
+  }
+
+  template <class A>
+  T *create(A arg)
+  {
+    return new (allocate()) T(arg);
+  }
+
+  void release(T *p)
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    Slot *slot = toSlot(p);
+    slot->generation.fetch_add(1, std::memory_order_release);
+    append(slot);
+    counters.live--;
+  }
+
+  static uint32_t generation(const T *p)
+  {
+    return toSlot(p)->generation.load(std::memory_order_acquire);
+  }
+
+  static bool isLive(const T *p)
+  {
+    return generation(p) & 1;
+  }
+
+  // True only if p has not been released or recycled since generation was read
+  static bool isLive(const T *p, uint32_t generation)
+  {
+    return toSlot(p)->generation.load(std::memory_order_acquire) == generation;
+  }
+
+  Stats stats()
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    return counters;
+  }
+
+private:
+  struct Slot
+  {
+    // storage must stay the first member, see toSlot()
+    alignas(T) unsigned char storage[sizeof(T)];
+    std::atomic<uint32_t> generation;
+    Slot *next;
+  };
+
+  static Slot *toSlot(const T *p)
+  {
+    return (Slot *)p;
+  }
+
+  // With the lock held, the slot goes to the back of the queue
+  void append(Slot *slot)
+  {
+    slot->next = NULL;
+    if (freeTail != NULL)
+      freeTail->next = slot;
+    else
+      freelist = slot;
+    freeTail = slot;
+    freeSlots++;
+  }
+
+  void addSlab()
+  {
+    Slot *slab = new Slot[SlabSize];
+    for (unsigned i = 0; i < SlabSize; i++)
+    {
+      slab[i].generation.store(0, std::memory_order_relaxed);
+      append(&slab[i]);
+    }
+    slabs.push_back(slab);
+    counters.slabs++;
+    counters.capacity += SlabSize;
+  }
+
+  std::mutex lock;
+  // Oldest released slot first
+  Slot *freelist;
+  Slot *freeTail;
+  unsigned freeSlots;
+  std::vector<Slot*> slabs;
+  Stats counters;
+};
+#endif
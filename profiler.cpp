@@ -0,0 +1,131 @@
+#include <fcntl.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "config.h"
+#include "profiler.h"
+
+// STEAMFORWARDER_PROFILE=1 enables the profiler
+static ProfileHeader *segment = NULL;
+static char segmentName[64];
+static std::mutex pointsLock;
+static __thread ProfileCounter *threadRow = NULL;
+static __thread bool threadRowClaimed = false;
+// Rows of threads which exited. A row keeps its counts, the next thread
+// adds to them; a fixed array, threads may exit after static destructors
+static std::mutex rowsLock;
+static uint32_t freeRows[PROFILE_THREADS];
+static unsigned freeRowCount = 0;
+
+static bool profilerInit()
+{
+  const char *enabled = getenv("STEAMFORWARDER_PROFILE");
+  if (enabled == NULL || atoi(enabled) == 0)
+    return false;
+  snprintf(segmentName, sizeof(segmentName), "/steamforwarder-%d", (int)getpid());
+  size_t size = profileSize(PROFILE_POINTS, PROFILE_THREADS);
+  int fd = shm_open(segmentName, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    ERR("Cannot create shared memory segment %s\n", segmentName);
+    return false;
+  }
+  void *p = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+    p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+  {
+    ERR("Cannot map %lu bytes of %s\n", (unsigned long)size, segmentName);
+    shm_unlink(segmentName);
+    return false;
+  }
+  segment = (ProfileHeader *)p;
+  segment->points = PROFILE_POINTS;
+  segment->threads = PROFILE_THREADS;
+  segment->layout = PROFILE_LAYOUT;
+  segment->usedPoints.store(1, std::memory_order_relaxed);
+  segment->usedThreads.store(0, std::memory_order_relaxed);
+  // Readers ignore the segment until the magic is there
+  std::atomic_thread_fence(std::memory_order_release);
+  segment->magic = PROFILE_MAGIC;
+  TRACE("Profiling into /dev/shm%s\n", segmentName);
+  return true;
+}
+
+bool profilerEnabled = profilerInit();
+
+static uint32_t registerPoint(ProfilePoint *point)
+{
+  std::lock_guard<std::mutex> guard(pointsLock);
+  uint32_t index = point->index.load(std::memory_order_relaxed);
+  if (index != 0)
+    return index;
+  index = segment->usedPoints.load(std::memory_order_relaxed);
+  if (index == segment->points)
+  {
+    WARN("No profiler point left for %s, raise PROFILE_POINTS\n", point->name);
+    return 0;
+  }
+  snprintf(profileName(segment, index), PROFILE_NAME_SIZE, "%s", point->name);
+  segment->usedPoints.store(index + 1, std::memory_order_release);
+  point->index.store(index, std::memory_order_release);
+  return index;
+}
+
+// Gives the row back when its thread exits
+struct RowOwner
+{
+  uint32_t row;
+  bool owned;
+  ~RowOwner()
+  {
+    if (!owned)
+      return;
+    std::lock_guard<std::mutex> guard(rowsLock);
+    freeRows[freeRowCount++] = row;
+  }
+};
+static thread_local RowOwner rowOwner;
+
+static ProfileCounter *claimRow()
+{
+  threadRowClaimed = true;
+  uint32_t thread;
+  {
+    std::lock_guard<std::mutex> guard(rowsLock);
+    if (freeRowCount > 0)
+      thread = freeRows[--freeRowCount];
+    else if ((thread = segment->usedThreads.load(std::memory_order_relaxed)) < segment->threads)
+      segment->usedThreads.store(thread + 1, std::memory_order_release);
+    else
+    {
+      WARN("No profiler row left for this thread, raise PROFILE_THREADS\n");
+      return NULL;
+    }
+  }
+  rowOwner.row = thread;
+  rowOwner.owned = true;
+  return profileRow(segment, thread);
+}
+
+ProfileCounter *profileCounter(ProfilePoint *point)
+{
+  uint32_t index = point->index.load(std::memory_order_acquire);
+  if (index == 0 && (index = registerPoint(point)) == 0)
+    return NULL;
+  if (!threadRowClaimed)
+    threadRow = claimRow();
+  return threadRow == NULL ? NULL : &threadRow[index];
+}
+
+void profilerShutdown()
+{
+  // The mapping stays valid for threads still inside a forwarded call;
+  // a running steamtop keeps its own mapping of the unlinked segment
+  if (segment != NULL)
+    shm_unlink(segmentName);
+}
@@ -0,0 +1,100 @@
+#ifndef STEAM_FORWARDER_PROFILER
+#define STEAM_FORWARDER_PROFILER
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include "timer.h"
+
+// Call counts and wall time of every forwarded function, kept in a shared
+// memory segment /dev/shm/steamforwarder-<pid> which tools/steamtop reads.
+// Every thread owns a row of counters, so recording a call needs no atomic
+// read-modify-write; readers add the rows up. Rows of threads which exited
+// go to the next new thread.
+//
+// Segment layout: ProfileHeader, then names[points][PROFILE_NAME_SIZE],
+// then counters[threads][points].
+#define PROFILE_MAGIC 0x53465046
+#define PROFILE_LAYOUT 1
+#define PROFILE_NAME_SIZE 64
+
+struct ProfileHeader
+{
+  uint32_t magic;
+  uint32_t layout;
+  uint32_t points;
+  uint32_t threads;
+  std::atomic<uint32_t> usedPoints;
+  std::atomic<uint32_t> usedThreads;
+};
+
+struct ProfileCounter
+{
+  std::atomic<uint64_t> calls;
+  std::atomic<uint64_t> ns;
+};
+
+static inline size_t profileSize(uint32_t points, uint32_t threads)
+{
+  return sizeof(ProfileHeader) + (size_t)points * PROFILE_NAME_SIZE +
+    (size_t)points * threads * sizeof(ProfileCounter);
+}
+
+static inline char *profileName(ProfileHeader *h, uint32_t point)
+{
+  return (char *)(h + 1) + (size_t)point * PROFILE_NAME_SIZE;
+}
+
+static inline ProfileCounter *profileRow(ProfileHeader *h, uint32_t thread)
+{
+  char *counters = profileName(h, h->points);
+  return (ProfileCounter *)counters + (size_t)thread * h->points;
+}
+
+// One per generated function. Index 0 means not registered yet, so the
+// first row of names is never used. buffers lists which pointer arguments
+// the recorder copies and which argument holds their size, see recorder.h.
+struct ProfilePoint
+{
+  constexpr ProfilePoint(const char *name, const char *buffers = NULL):
+    name(name), buffers(buffers), index(0), recordId(0) {}
+  const char *name;
+  const char *buffers;
+  std::atomic<uint32_t> index;
+  std::atomic<uint32_t> recordId;
+};
+
+extern bool profilerEnabled;
+// NULL if the profiler ran out of points or threads
+ProfileCounter *profileCounter(ProfilePoint *point);
+void profilerShutdown();
+
+class ProfileScope
+{
+public:
+  ProfileScope(ProfilePoint *point): counter(NULL)
+  {
+    if (profilerEnabled && (counter = profileCounter(point)) != NULL)
+      start = monotonicNs();
+  }
+
+  ~ProfileScope()
+  {
+    if (counter == NULL)
+      return;
+    uint64_t elapsed = monotonicNs() - start;
+    // Only this thread writes its row
+    counter->calls.store(counter->calls.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+    counter->ns.store(counter->ns.load(std::memory_order_relaxed) + elapsed,
+                      std::memory_order_relaxed);
+  }
+
+private:
+  ProfileCounter *counter;
+  uint64_t start;
+};
+
+#define PROFILE(name) \
+  static ProfilePoint profilePoint(name); \
+  ProfileScope profileScope(&profilePoint)
+#endif
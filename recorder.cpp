@@ -0,0 +1,159 @@
+#include <atomic>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <string.h>
+#include <vector>
+#include "config.h"
+#include "profiler.h"
+#include "recorder.h"
+#include "timer.h"
+
+static FILE *recording = NULL;
+static std::mutex recordingLock;
+static uint64_t recordingStart = 0;
+static uint32_t recordIds = 0;
+static std::atomic<uint32_t> recordThreads(0);
+static __thread uint32_t recordThread = 0;
+
+static bool recorderInit()
+{
+  const char *path = getenv("STEAMFORWARDER_RECORD");
+  if (path == NULL || path[0] == '\0')
+    return false;
+  recording = fopen(path, "wb");
+  if (recording == NULL)
+  {
+    ERR("Cannot record into %s\n", path);
+    return false;
+  }
+  setvbuf(recording, NULL, _IOFBF, RECORD_FILE_BUFFER);
+  fwrite(RECORD_MAGIC, 1, RECORD_MAGIC_SIZE, recording);
+  recordingStart = monotonicNs();
+  TRACE("Recording into %s\n", path);
+  return true;
+}
+
+bool recorderEnabled = recorderInit();
+
+static void putNumber(std::string &out, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    out += (char)(value | 0x80);
+    value >>= 7;
+  }
+  out += (char)value;
+}
+
+static void putBuffer(std::string &out, unsigned argument, const void *bytes, size_t length)
+{
+  out += (char)argument;
+  putNumber(out, length);
+  out.append((const char *)bytes, length);
+}
+
+static uint32_t threadId()
+{
+  if (recordThread == 0)
+    recordThread = recordThreads.fetch_add(1, std::memory_order_relaxed) + 1;
+  return recordThread;
+}
+
+static void putBuffers(std::string &out, ProfilePoint *point, const char *codes,
+                       const uint64_t *values, unsigned count)
+{
+  std::vector<bool> paired(count);
+  std::string buffers;
+  unsigned number = 0;
+  const char *pairs = point->buffers != NULL ? point->buffers : "";
+  unsigned pointer, size;
+  while (readBufferPair(pairs, pointer, size))
+  {
+    if (pointer >= count || size >= count || values[pointer] == 0)
+      continue;
+    paired[pointer] = true;
+    size_t length = values[size] < RECORD_BUFFER_CAP ? values[size] : RECORD_BUFFER_CAP;
+    const char *bytes = (const char *)(uintptr_t)values[pointer];
+    if (codes[pointer] == 's')
+      length = strnlen(bytes, length);
+    putBuffer(buffers, pointer, bytes, length);
+    number++;
+  }
+  for (unsigned i = 0; i < count; i++)
+    if (codes[i] == 's' && !paired[i] && values[i] != 0)
+    {
+      const char *string = (const char *)(uintptr_t)values[i];
+      putBuffer(buffers, i, string, strnlen(string, RECORD_BUFFER_CAP));
+      number++;
+    }
+  putNumber(out, number);
+  out += buffers;
+}
+
+void recordCall(ProfilePoint *point, const char *codes, const uint64_t *values,
+                char resultCode, uint64_t result, uint64_t start, uint64_t duration)
+{
+  unsigned count = strlen(codes);
+  std::string out;
+  out.reserve(64);
+  out += (char)RECORD_CALL;
+  // The id is filled in under the lock, it may need a name record first
+  size_t idAt = out.size();
+  putNumber(out, threadId());
+  putNumber(out, start - recordingStart);
+  putNumber(out, duration);
+  out += (char)count;
+  out.append(codes, count);
+  for (unsigned i = 0; i < count; i++)
+    putNumber(out, codes[i] == 'i' ? zigzag((int64_t)values[i]) : values[i]);
+  out += resultCode;
+  putNumber(out, resultCode == 'i' ? zigzag((int64_t)result) : result);
+  putBuffers(out, point, codes, values, count);
+
+  std::lock_guard<std::mutex> guard(recordingLock);
+  uint32_t id = point->recordId.load(std::memory_order_relaxed);
+  if (id == 0)
+  {
+    id = ++recordIds;
+    point->recordId.store(id, std::memory_order_relaxed);
+    std::string name;
+    name += (char)RECORD_NAME;
+    putNumber(name, id);
+    putNumber(name, strlen(point->name));
+    name += point->name;
+    fwrite(name.data(), 1, name.size(), recording);
+  }
+  std::string idBytes;
+  putNumber(idBytes, id);
+  out.insert(idAt, idBytes);
+  fwrite(out.data(), 1, out.size(), recording);
+}
+
+void recordDelivery(int iCallback, const void *payload, int size, bool callResult,
+                    bool ioFailure, uint64_t hSteamAPICall)
+{
+  std::string out;
+  out.reserve(32 + (size > 0 ? size : 0));
+  out += (char)RECORD_CALLBACK;
+  putNumber(out, threadId());
+  putNumber(out, monotonicNs() - recordingStart);
+  putNumber(out, iCallback);
+  out += (char)((callResult ? RECORD_CALL_RESULT : 0) | (ioFailure ? RECORD_IO_FAILURE : 0));
+  putNumber(out, hSteamAPICall);
+  int length = size > 0 && payload != NULL ? size : 0;
+  putNumber(out, length);
+  out.append((const char *)payload, length);
+  std::lock_guard<std::mutex> guard(recordingLock);
+  fwrite(out.data(), 1, out.size(), recording);
+}
+
+void recorderShutdown()
+{
+  if (!recorderEnabled)
+    return;
+  std::lock_guard<std::mutex> guard(recordingLock);
+  fflush(recording);
+  TRACE("%u functions recorded\n", recordIds);
+}
@@ -0,0 +1,99 @@
+#ifndef STEAM_FORWARDER_RECORDER
+#define STEAM_FORWARDER_RECORDER
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// With STEAMFORWARDER_RECORD=<file> every forwarded call and every callback
+// delivered to the game is appended to <file>, which steamreplay.exe plays
+// back (replay.h) and tools/steamrecord prints.
+//
+// The log starts with RECORD_MAGIC. Every record is a type byte followed by
+// numbers (v, unsigned LEB128), single bytes (u8) and raw bytes:
+//   RECORD_NAME      v id, v length, name
+//   RECORD_CALL      v id, v thread, v start, v duration, u8 count,
+//                    count codes, count v values, u8 result code, v result,
+//                    v buffers, per buffer: u8 argument, v length, bytes
+//   RECORD_CALLBACK  v thread, v time, v callback, u8 flags, v api call,
+//                    v size, payload
+// Times are nanoseconds since the log was opened. Codes and values are
+// those of TraceCode (forward.h), signed values zigzag encoded. The result
+// code is 0 for void. Buffers hold what pointer arguments pointed to after
+// the call, at most RECORD_BUFFER_CAP bytes: strings, and the buffers the
+// codegen paired with a size argument (ProfilePoint::buffers, "1:2" means
+// argument 1 points to as many bytes as argument 2 says).
+#define RECORD_MAGIC "SFREC01\n"
+#define RECORD_MAGIC_SIZE 8
+enum
+{
+  RECORD_NAME = 1,
+  RECORD_CALL = 2,
+  RECORD_CALLBACK = 3
+};
+#define RECORD_CALL_RESULT 1
+#define RECORD_IO_FAILURE 2
+// Ids are handed out one per forwarded function, a larger one is damage
+#define RECORD_MAX_ID (1 << 20)
+
+struct ProfilePoint;
+extern bool recorderEnabled;
+// values as filled by ForwardDescribe, before the call
+void recordCall(ProfilePoint *point, const char *codes, const uint64_t *values,
+                char resultCode, uint64_t result, uint64_t start, uint64_t duration);
+void recordDelivery(int iCallback, const void *payload, int size, bool callResult,
+                    bool ioFailure, uint64_t hSteamAPICall);
+void recorderShutdown();
+
+static inline uint64_t zigzag(int64_t value)
+{
+  return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t unzigzag(uint64_t value)
+{
+  return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+// Reading, false at the end of the data
+static inline bool readNumber(const unsigned char *&p, const unsigned char *end,
+                              uint64_t &value)
+{
+  value = 0;
+  for (unsigned shift = 0; p < end && shift < 64; shift += 7)
+  {
+    unsigned char byte = *p++;
+    value |= (uint64_t)(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0)
+      return true;
+  }
+  return false;
+}
+
+// "1:2 4:5", see ProfilePoint::buffers
+static inline bool readBufferPair(const char *&buffers, unsigned &pointer,
+                                  unsigned &size)
+{
+  char *end;
+  pointer = strtoul(buffers, &end, 10);
+  if (end == buffers || *end != ':')
+    return false;
+  buffers = end + 1;
+  size = strtoul(buffers, &end, 10);
+  if (end == buffers)
+    return false;
+  buffers = end;
+  while (*buffers == ' ')
+    buffers++;
+  return true;
+}
+
+static inline bool readBytes(const unsigned char *&p, const unsigned char *end,
+                             size_t length, const unsigned char *&bytes)
+{
+  if ((size_t)(end - p) < length)
+    return false;
+  bytes = p;
+  p += length;
+  return true;
+}
+#endif
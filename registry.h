@@ -0,0 +1,205 @@
+#ifndef STEAM_FORWARDER_REGISTRY
+#define STEAM_FORWARDER_REGISTRY
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <stdint.h>
+
+// Open addressing hash table keyed by pointers.
+// find() is lock-free and may run concurrently with insert() and remove(),
+// which are serialized by a mutex. A slot is written once: removal leaves a
+// tombstone which is only cleared by copying the live entries into a new
+// table, so a reader which matched a key always loads that key's value.
+// Readers count themselves in one of two epochs; a table replaced by
+// insert() is freed once the readers of the epoch it was current in are
+// gone.
+template <class K, class V>
+class PointerRegistry
+{
+public:
+  PointerRegistry(unsigned capacity)
+  {
+    unsigned size = 16;
+    while (size < capacity)
+      size <<= 1;
+    epoch.store(0, std::memory_order_relaxed);
+    readers[0].count.store(0, std::memory_order_relaxed);
+    readers[1].count.store(0, std::memory_order_relaxed);
+    current.store(newTable(size), std::memory_order_release);
+  }
+
+  ~PointerRegistry()
+  {
+    freeTable(current.load(std::memory_order_relaxed));
+  }
+
+  V *find(K *key) const
+  {
+    // The table is loaded after the reader is counted, see grow()
+    std::atomic<unsigned> &count = readers[epoch.load(std::memory_order_seq_cst) & 1].count;
+    count.fetch_add(1, std::memory_order_seq_cst);
+    const Table *t = current.load(std::memory_order_seq_cst);
+    uintptr_t k = (uintptr_t)key;
+    V *value = NULL;
+    for (unsigned i = hash(k) & t->mask, n = 0; n <= t->mask; i = (i + 1) & t->mask, n++)
+    {
+      uintptr_t found = t->slots[i].key.load(std::memory_order_acquire);
+      if (found == k)
+      {
+        value = t->slots[i].value.load(std::memory_order_acquire);
+        break;
+      }
+      if (found == EMPTY)
+        break;
+    }
+    count.fetch_sub(1, std::memory_order_release);
+    return value;
+  }
+
+  // Returns the value already registered for the key, or the new one.
+  V *insert(K *key, V *value)
+  {
+    std::lock_guard<std::mutex> guard(writer);
+    Table *t = current.load(std::memory_order_relaxed);
+    Slot *existing = lookup(t, (uintptr_t)key);
+    if (existing != NULL)
+      return existing->value.load(std::memory_order_relaxed);
+    if ((t->used + 1) * 4 > (t->mask + 1) * 3)
+      t = grow(t);
+    place(t, (uintptr_t)key, value);
+    return value;
+  }
+
+  // Returns the removed value, NULL if the key was not registered.
+  V *remove(K *key)
+  {
+    std::lock_guard<std::mutex> guard(writer);
+    Table *t = current.load(std::memory_order_relaxed);
+    Slot *slot = lookup(t, (uintptr_t)key);
+    if (slot == NULL)
+      return NULL;
+    V *result = slot->value.load(std::memory_order_relaxed);
+    slot->key.store(TOMBSTONE, std::memory_order_release);
+    t->live--;
+    return result;
+  }
+
+  unsigned size() const
+  {
+    std::lock_guard<std::mutex> guard(writer);
+    return current.load(std::memory_order_relaxed)->live;
+  }
+
+private:
+  static const uintptr_t EMPTY = 0;
+  static const uintptr_t TOMBSTONE = 1;
+  struct Slot
+  {
+    std::atomic<uintptr_t> key;
+    std::atomic<V*> value;
+  };
+  struct Table
+  {
+    unsigned mask;
+    unsigned used; // live entries and tombstones
+    unsigned live;
+    Slot *slots;
+  };
+  struct Readers
+  {
+    alignas(64) std::atomic<unsigned> count;
+  };
+
+  static unsigned hash(uintptr_t k)
+  {
+    uint64_t h = (uint64_t)(k >> 3) * 0x9E3779B97F4A7C15ULL;
+    return (unsigned)(h >> 32);
+  }
+
+  Table *newTable(unsigned size)
+  {
+    Table *t = new Table;
+    t->mask = size - 1;
+    t->used = 0;
+    t->live = 0;
+    t->slots = new Slot[size];
+    for (unsigned i = 0; i < size; i++)
+    {
+      t->slots[i].key.store(EMPTY, std::memory_order_relaxed);
+      t->slots[i].value.store(NULL, std::memory_order_relaxed);
+    }
+    return t;
+  }
+
+  static void freeTable(Table *t)
+  {
+    delete[] t->slots;
+    delete t;
+  }
+
+  static Slot *lookup(Table *t, uintptr_t k)
+  {
+    for (unsigned i = hash(k) & t->mask, n = 0; n <= t->mask; i = (i + 1) & t->mask, n++)
+    {
+      uintptr_t found = t->slots[i].key.load(std::memory_order_relaxed);
+      if (found == k)
+        return &t->slots[i];
+      if (found == EMPTY)
+        break;
+    }
+    return NULL;
+  }
+
+  // Tombstones are not reused: a reader which loaded the old key could
+  // otherwise load the value of the new one
+  static void place(Table *t, uintptr_t k, V *value)
+  {
+    unsigned i = hash(k) & t->mask;
+    while (t->slots[i].key.load(std::memory_order_relaxed) != EMPTY)
+      i = (i + 1) & t->mask;
+    // The value must be visible before a reader can match the key
+    t->slots[i].value.store(value, std::memory_order_release);
+    t->slots[i].key.store(k, std::memory_order_release);
+    t->used++;
+    t->live++;
+  }
+
+  // Returns once no reader can still be probing a table which was replaced
+  // before the call. Readers counted in the old epoch are waited for; those
+  // counting themselves from now on load the current table.
+  void synchronize()
+  {
+    unsigned old = epoch.load(std::memory_order_relaxed);
+    epoch.store(old + 1, std::memory_order_seq_cst);
+    while (readers[old & 1].count.load(std::memory_order_seq_cst) != 0)
+      std::this_thread::yield();
+  }
+
+  Table *grow(Table *old)
+  {
+    unsigned size = old->mask + 1;
+    // Only double when the table is really full, not just littered with tombstones
+    if ((old->live + 1) * 2 > size)
+      size <<= 1;
+    Table *t = newTable(size);
+    for (unsigned i = 0; i <= old->mask; i++)
+    {
+      uintptr_t k = old->slots[i].key.load(std::memory_order_relaxed);
+      if (k != EMPTY && k != TOMBSTONE)
+        place(t, k, old->slots[i].value.load(std::memory_order_relaxed));
+    }
+    current.store(t, std::memory_order_seq_cst);
+    // A reader counted in the previous epoch may have loaded the old table
+    // before the new one was stored; two grace periods cover both epochs
+    synchronize();
+    synchronize();
+    freeTable(old);
+    return t;
+  }
+
+  std::atomic<Table*> current;
+  mutable std::mutex writer;
+  std::atomic<unsigned> epoch;
+  mutable Readers readers[2];
+};
+#endif
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <string>
+#include <string.h>
+#include <time.h>
+#include "config.h"
+#include "replay.h"
+#include "timer.h"
+
+// Usage: steamreplay.exe [--paced] <recording>
+// Without --paced the calls are issued back to back
+
+// Flat exports get the interface as a signed intptr_t, methods as a pointer
+static inline uint64_t objectKey(uint64_t value)
+{
+  return (uintptr_t)value;
+}
+
+void *Replay::object(unsigned i, ReplayAccessor accessor)
+{
+  void *live = NULL;
+  std::map<uint64_t, void *>::iterator known = objects.find(objectKey(values[i]));
+  if (known != objects.end())
+    live = known->second;
+  else if (accessor != NULL && values[i] != 0)
+  {
+    live = accessor();
+    if (live != NULL)
+      objects[objectKey(values[i])] = live;
+  }
+  if (live == NULL)
+    unresolved++;
+  return live;
+}
+
+void *Replay::pointer(unsigned i)
+{
+  if (values[i] == 0)
+    return NULL;
+  std::map<uint64_t, void *>::iterator known = objects.find(objectKey(values[i]));
+  if (known != objects.end())
+    return known->second;
+  size_t size = REPLAY_SCRATCH_SIZE;
+  const char *pairs = entry->buffers;
+  unsigned pointer, length;
+  while (readBufferPair(pairs, pointer, length))
+    if (pointer == i && length < FORWARD_MAX_ARGS)
+      size = values[length] < REPLAY_BUFFER_MAX ? values[length] : REPLAY_BUFFER_MAX;
+  const ReplayBuffer *recorded = NULL;
+  for (size_t b = 0; b < buffers.size(); b++)
+    if (buffers[b].argument == i)
+      recorded = &buffers[b];
+  // Room for the terminating zero of strings
+  if (recorded != NULL && recorded->length >= size)
+    size = recorded->length + 1;
+  if (scratchUsed == scratch.size())
+    scratch.push_back(std::vector<unsigned char>());
+  std::vector<unsigned char> &memory = scratch[scratchUsed++];
+  memory.assign(size, 0);
+  if (recorded != NULL)
+    memcpy(&memory[0], recorded->bytes, recorded->length);
+  return &memory[0];
+}
+
+void Replay::settle(char code, uint64_t value)
+{
+  if (code == 'p' && resultCode == 'p')
+  {
+    // Interfaces returned by GetISteam* and the like
+    if (recordedResult != 0 && value != 0)
+      objects[objectKey(recordedResult)] = (void *)(uintptr_t)value;
+  }
+  else if (code != 'x' && code != 's' && value != recordedResult)
+    diverged++;
+}
+
+void Replay::release()
+{
+  scratchUsed = 0;
+  buffers.clear();
+}
+
+static bool readByte(const unsigned char *&p, const unsigned char *end, unsigned char &value)
+{
+  const unsigned char *byte;
+  if (!readBytes(p, end, 1, byte))
+    return false;
+  value = *byte;
+  return true;
+}
+
+static bool readFile(const char *path, std::vector<unsigned char> &data)
+{
+  FILE *file = fopen(path, "rb");
+  if (file == NULL)
+    return false;
+  unsigned char chunk[65536];
+  size_t read;
+  while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    data.insert(data.end(), chunk, chunk + read);
+  fclose(file);
+  return true;
+}
+
+static void waitUntil(uint64_t when)
+{
+  uint64_t now = monotonicNs();
+  if (now >= when)
+    return;
+  struct timespec ts;
+  ts.tv_sec = (when - now) / 1000000000ull;
+  ts.tv_nsec = (when - now) % 1000000000ull;
+  nanosleep(&ts, NULL);
+}
+
+int main(int argc, char *argv[])
+{
+  bool paced = argc > 2 && strcmp(argv[1], "--paced") == 0;
+  const char *path = argv[argc - 1];
+  std::vector<unsigned char> data;
+  if (argc < 2 || argc > 3 || (argc == 3 && !paced))
+  {
+    fprintf(stderr, "Usage: %s [--paced] <recording>\n", argv[0]);
+    return 2;
+  }
+  if (!readFile(path, data) || data.size() < RECORD_MAGIC_SIZE ||
+      memcmp(&data[0], RECORD_MAGIC, RECORD_MAGIC_SIZE) != 0)
+  {
+    fprintf(stderr, "%s is not a recording\n", path);
+    return 1;
+  }
+  std::map<std::string, const ReplayEntry *> byName;
+  for (unsigned i = 0; i < replayEntryCount; i++)
+    byName.insert(std::make_pair(std::string(replayEntries[i].name), &replayEntries[i]));
+  // Record id -> replayer, NULL for functions this build has none for
+  std::vector<const ReplayEntry *> entries;
+  Replay replay;
+  uint64_t calls = 0, missing = 0, callbacks = 0, ns = 0, firstStart = 0;
+  uint64_t started = monotonicNs();
+  const unsigned char *p = &data[0] + RECORD_MAGIC_SIZE;
+  const unsigned char *end = &data[0] + data.size();
+  bool complete = true;
+  while (p < end && complete)
+  {
+    unsigned char type = *p++;
+    uint64_t id, thread, start, duration, number, length;
+    unsigned char count, flag;
+    const unsigned char *bytes;
+    complete = false;
+    if (type == RECORD_NAME)
+    {
+      if (!readNumber(p, end, id) || id > RECORD_MAX_ID || !readNumber(p, end, length) ||
+          !readBytes(p, end, length, bytes))
+        break;
+      std::map<std::string, const ReplayEntry *>::iterator found =
+        byName.find(std::string((const char *)bytes, length));
+      if (found == byName.end())
+        fprintf(stderr, "No replayer for %.*s, its calls are skipped\n", (int)length, bytes);
+      if (entries.size() <= id)
+        entries.resize(id + 1);
+      entries[id] = found != byName.end() ? found->second : NULL;
+    }
+    else if (type == RECORD_CALL)
+    {
+      if (!readNumber(p, end, id) || !readNumber(p, end, thread) ||
+          !readNumber(p, end, start) || !readNumber(p, end, duration) ||
+          !readByte(p, end, count) || count > FORWARD_MAX_ARGS ||
+          !readBytes(p, end, count, bytes))
+        break;
+      replay.codes = (const char *)bytes;
+      unsigned i = 0;
+      for (; i < count && readNumber(p, end, replay.values[i]); i++)
+        if (replay.codes[i] == 'i')
+          replay.values[i] = (uint64_t)unzigzag(replay.values[i]);
+      unsigned char resultCode;
+      if (i < count || !readByte(p, end, resultCode) ||
+          !readNumber(p, end, replay.recordedResult) || !readNumber(p, end, number))
+        break;
+      replay.resultCode = resultCode;
+      if (resultCode == 'i')
+        replay.recordedResult = (uint64_t)unzigzag(replay.recordedResult);
+      for (i = 0; i < number; i++)
+      {
+        ReplayBuffer buffer;
+        if (!readByte(p, end, flag) || !readNumber(p, end, length) ||
+            !readBytes(p, end, length, buffer.bytes))
+          break;
+        buffer.argument = flag;
+        buffer.length = length;
+        replay.buffers.push_back(buffer);
+      }
+      if (i < number)
+        break;
+      replay.entry = id < entries.size() ? entries[id] : NULL;
+      // A recording of a build with other headers may disagree on the arguments
+      if (replay.entry == NULL || replay.entry->args != count)
+        missing++;
+      else
+      {
+        if (calls == 0)
+          firstStart = start;
+        if (paced)
+          waitUntil(started + (start - firstStart));
+        uint64_t before = monotonicNs();
+        replay.entry->replay(replay);
+        ns += monotonicNs() - before;
+        calls++;
+      }
+      replay.release();
+    }
+    else if (type == RECORD_CALLBACK)
+    {
+      // The stand-in libsteam_api delivers callbacks of its own
+      if (!readNumber(p, end, thread) || !readNumber(p, end, start) ||
+          !readNumber(p, end, id) || !readByte(p, end, flag) ||
+          !readNumber(p, end, number) || !readNumber(p, end, length) ||
+          !readBytes(p, end, length, bytes))
+        break;
+      callbacks++;
+    }
+    else
+      break;
+    complete = true;
+  }
+  if (!complete)
+    fprintf(stderr, "%s is cut off or damaged, replayed what came before\n", path);
+  printf("%llu calls replayed in %.3f s, %.0f ns per call\n",
+         (unsigned long long)calls, (monotonicNs() - started) / 1e9,
+         calls != 0 ? (double)ns / calls : 0.0);
+  printf("%llu calls without replayer, %llu on unknown interfaces, %llu results differ\n",
+         (unsigned long long)missing, (unsigned long long)replay.unresolved,
+         (unsigned long long)replay.diverged);
+  printf("%llu recorded callbacks not replayed\n", (unsigned long long)callbacks);
+  return 0;
+}
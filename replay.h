@@ -0,0 +1,137 @@
+#ifndef STEAM_FORWARDER_REPLAY
+#define STEAM_FORWARDER_REPLAY
+#include <map>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include <vector>
+#include "forward.h"
+#include "recorder.h"
+
+// steamreplay.exe issues the calls of a recording (recorder.h) again
+// through the same wrappers the game called, on a single thread. The code
+// generator writes one replayer per forwarded function into steam_replay.cpp:
+//
+//   static void replay12(Replay &r)
+//   {
+//     ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+//     if (self != NULL)
+//       r.result(self->BLoggedOn());
+//   }
+//
+// Argument i is values[i] as ForwardDescribe packed it, argument 0 being
+// the internal interface for methods.
+
+class Replay;
+typedef void (*Replayer)(Replay &r);
+// SteamUser_() and the like, for interfaces the game got without a
+// forwarded call, so the recording never saw where they came from
+typedef void *(*ReplayAccessor)();
+
+struct ReplayEntry
+{
+  const char *name;
+  // As ProfilePoint::buffers
+  const char *buffers;
+  unsigned args;
+  Replayer replay;
+};
+extern const ReplayEntry replayEntries[];
+extern const unsigned replayEntryCount;
+
+struct ReplayBuffer
+{
+  unsigned argument;
+  const unsigned char *bytes;
+  size_t length;
+};
+
+// Structs passed by value are not recorded
+template <class T, class Enable = void>
+struct ReplayValue
+{
+  static T unpack(Replay &, unsigned) { return T(); }
+};
+
+class Replay
+{
+public:
+  Replay(): entry(NULL), unresolved(0), diverged(0), scratchUsed(0) {}
+
+  // The call being replayed
+  const ReplayEntry *entry;
+  const char *codes;
+  uint64_t values[FORWARD_MAX_ARGS];
+  char resultCode;
+  uint64_t recordedResult;
+  std::vector<ReplayBuffer> buffers;
+
+  // Calls skipped because their interface is unknown
+  uint64_t unresolved;
+  // Calls whose scalar result differs from the recorded one
+  uint64_t diverged;
+
+  template <class T>
+  T arg(unsigned i)
+  {
+    return ReplayValue<typename std::decay<T>::type>::unpack(*this, i);
+  }
+
+  // The interface the recorded internal pointer stands for, NULL if unknown
+  void *object(unsigned i, ReplayAccessor accessor);
+  // The recorded buffer copied to scratch memory, or an interface
+  void *pointer(unsigned i);
+
+  template <class R>
+  void result(const R &value)
+  {
+    settle(TraceCodeOf<R>::code, TraceCodeOf<R>::pack(value));
+  }
+
+  // Called after every call
+  void release();
+
+private:
+  void settle(char code, uint64_t value);
+  // Recorded internal interface -> what the wrappers returned this time
+  std::map<uint64_t, void *> objects;
+  std::vector<std::vector<unsigned char> > scratch;
+  size_t scratchUsed;
+};
+
+template <>
+struct ReplayValue<bool>
+{
+  static bool unpack(Replay &r, unsigned i) { return r.values[i] != 0; }
+};
+
+template <class T>
+struct ReplayValue<T, typename std::enable_if<std::is_enum<T>::value ||
+                                              std::is_integral<T>::value>::type>
+{
+  static T unpack(Replay &r, unsigned i) { return (T)r.values[i]; }
+};
+
+template <class T>
+struct ReplayValue<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+  static T unpack(Replay &r, unsigned i)
+  {
+    double d;
+    memcpy(&d, &r.values[i], sizeof(d));
+    return (T)d;
+  }
+};
+
+template <class T>
+struct ReplayValue<T *>
+{
+  static T *unpack(Replay &r, unsigned i) { return (T *)r.pointer(i); }
+};
+
+template <>
+struct ReplayValue<CSteamID>
+{
+  static CSteamID unpack(Replay &r, unsigned i) { return CSteamID((uint64)r.values[i]); }
+};
+#endif
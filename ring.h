@@ -0,0 +1,88 @@
+#ifndef STEAM_FORWARDER_RING
+#define STEAM_FORWARDER_RING
+#include <atomic>
+#include <stdint.h>
+
+// Bounded single-producer single-consumer queue.
+// push() is only called from one thread and pop() from one other thread;
+// neither of them ever blocks.
+template <class T>
+class SpscRing
+{
+public:
+  SpscRing(unsigned capacity): head(0), tail(0)
+  {
+    unsigned size = 2;
+    while (size < capacity)
+      size <<= 1;
+    mask = size - 1;
+    slots = new T[size];
+  }
+
+  ~SpscRing()
+  {
+    delete[] slots;
+  }
+
+  // Returns the slot to fill, NULL if the ring is full. The slot is handed
+  // to the consumer by commit().
+  T *reserve()
+  {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) > mask)
+      return NULL;
+    return &slots[t & mask];
+  }
+
+  void commit()
+  {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  bool push(const T &value)
+  {
+    T *slot = reserve();
+    if (slot == NULL)
+      return false;
+    *slot = value;
+    commit();
+    return true;
+  }
+
+  // Returns the oldest slot, NULL if the ring is empty. The slot stays
+  // owned by the consumer until release().
+  T *front()
+  {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire))
+      return NULL;
+    return &slots[h & mask];
+  }
+
+  void release()
+  {
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  bool pop(T &value)
+  {
+    T *slot = front();
+    if (slot == NULL)
+      return false;
+    value = *slot;
+    release();
+    return true;
+  }
+
+  unsigned size() const
+  {
+    return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+  }
+
+private:
+  T *slots;
+  uint32_t mask;
+  alignas(64) std::atomic<uint32_t> head;
+  alignas(64) std::atomic<uint32_t> tail;
+};
+#endif
@@ -0,0 +1,360 @@
+#include <atomic>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include "config.h"
+#include "profiler.h"
+#include "sessions.h"
+#include "timer.h"
+
+static uint64_t refreshNs = 0;
+
+static bool sessionCacheInit()
+{
+  const char *interval = getenv("STEAMFORWARDER_P2P_SESSIONS");
+  if (interval == NULL || atoi(interval) <= 0)
+    return false;
+  refreshNs = (uint64_t)atoi(interval) * 1000000;
+  TRACE("P2P session states are cached, refreshed every %d ms\n", atoi(interval));
+  return true;
+}
+
+bool sessionCacheEnabled = sessionCacheInit();
+
+#define SESSION_WORDS ((sizeof(P2PSessionState_t) + 7) / 8)
+
+// Written under the lock of its table, read without one: the sequence is
+// odd while the state is written, a reader which saw it change tries again
+struct SessionEntry
+{
+  // Steam ID of the peer, 0 for a free entry; set once
+  std::atomic<uint64_t> remote;
+  std::atomic<uint32_t> sequence;
+  std::atomic<bool> found;
+  std::atomic<uint64_t> state[SESSION_WORDS];
+  // Steam has to be asked on the next read
+  std::atomic<bool> stale;
+  // Read since the last refresh
+  std::atomic<bool> polled;
+};
+
+struct SessionTable
+{
+  std::atomic<ISteamNetworking *> internal;
+  // SteamGameServerNetworking(), its sessions are named by the game server's callbacks
+  bool gameServer;
+  std::mutex lock;
+  SessionEntry entries[SESSION_CACHE_PEERS];
+  unsigned peers;
+  uint64_t refreshedAt;
+  // Statistics for the trace at shutdown
+  uint64_t steamCalls;
+};
+
+static SessionTable tables[SESSION_CACHE_INTERFACES];
+static std::mutex tablesLock;
+
+static void invalidateSide(CSteamID remote, bool gameServer);
+
+// One per callback and side: Steam delivers what concerns the sessions of
+// the game server only to callbacks flagged for it
+class SessionListener: public CCallbackBase
+{
+public:
+  SessionListener(int callback, bool gameServer): registered(false), gameServer(gameServer)
+  {
+    m_iCallback = callback;
+    if (gameServer)
+      m_nCallbackFlags |= k_ECallbackFlagsGameServer;
+  }
+  bool registered;
+  bool gameServer;
+
+  void registerFor()
+  {
+    SteamAPI_RegisterCallback(this, m_iCallback);
+    registered = true;
+  }
+  void unregister()
+  {
+    if (registered)
+      SteamAPI_UnregisterCallback(this);
+    registered = false;
+  }
+  // Both callbacks start with the Steam ID of the peer
+  virtual void Run(void *pvParam)
+  {
+    if (pvParam != NULL)
+      invalidateSide(((P2PSessionRequest_t *)pvParam)->m_steamIDRemote, gameServer);
+  }
+  virtual void Run(void *pvParam, bool bIOFailure, SteamAPICall_t hSteamAPICall)
+  {
+    Run(pvParam);
+  }
+  virtual int GetCallbackSizeBytes()
+  {
+    return m_iCallback == P2PSessionRequest_t::k_iCallback ? sizeof(P2PSessionRequest_t)
+                                                           : sizeof(P2PSessionConnectFail_t);
+  }
+};
+
+static SessionListener listeners[] = {
+  SessionListener(P2PSessionRequest_t::k_iCallback, false),
+  SessionListener(P2PSessionConnectFail_t::k_iCallback, false),
+  SessionListener(P2PSessionRequest_t::k_iCallback, true),
+  SessionListener(P2PSessionConnectFail_t::k_iCallback, true),
+};
+#define SESSION_LISTENERS (sizeof(listeners) / sizeof(listeners[0]))
+
+// NULL when every table is taken
+static SessionTable *tableOf(ISteamNetworking *internal)
+{
+  for (unsigned i = 0; i < SESSION_CACHE_INTERFACES; i++)
+    if (tables[i].internal.load(std::memory_order_acquire) == internal)
+      return &tables[i];
+  bool gameServer = internal == SteamGameServerNetworking();
+  std::lock_guard<std::mutex> guard(tablesLock);
+  if (!listeners[0].registered)
+    for (unsigned i = 0; i < SESSION_LISTENERS; i++)
+      listeners[i].registerFor();
+  for (unsigned i = 0; i < SESSION_CACHE_INTERFACES; i++)
+  {
+    ISteamNetworking *owner = tables[i].internal.load(std::memory_order_relaxed);
+    if (owner == internal)
+      return &tables[i];
+    if (owner == NULL)
+    {
+      for (unsigned e = 0; e < SESSION_CACHE_PEERS; e++)
+        tables[i].entries[e].remote.store(0, std::memory_order_relaxed);
+      tables[i].peers = 0;
+      tables[i].gameServer = gameServer;
+      tables[i].refreshedAt = monotonicNs();
+      tables[i].steamCalls = 0;
+      tables[i].internal.store(internal, std::memory_order_release);
+      return &tables[i];
+    }
+  }
+  return NULL;
+}
+
+static inline unsigned slotOf(uint64_t remote)
+{
+  return (unsigned)((remote * 0x9e3779b97f4a7c15ull) >> 32) & (SESSION_CACHE_PEERS - 1);
+}
+
+// Without a lock, NULL when the peer is not cached
+static SessionEntry *find(SessionTable *table, uint64_t remote)
+{
+  unsigned slot = slotOf(remote);
+  for (unsigned i = 0; i < SESSION_CACHE_PEERS; i++)
+  {
+    SessionEntry *entry = &table->entries[(slot + i) & (SESSION_CACHE_PEERS - 1)];
+    uint64_t key = entry->remote.load(std::memory_order_acquire);
+    if (key == remote)
+      return entry;
+    if (key == 0)
+      return NULL;
+  }
+  return NULL;
+}
+
+static void invalidateIn(SessionTable *table, CSteamID remote)
+{
+  uint64_t key = remote.ConvertToUint64();
+  if (key == 0)
+    return;
+  SessionEntry *entry = find(table, key);
+  if (entry != NULL)
+    entry->stale.store(true, std::memory_order_release);
+}
+
+// The peer in the tables of one side
+static void invalidateSide(CSteamID remote, bool gameServer)
+{
+  for (unsigned i = 0; i < SESSION_CACHE_INTERFACES; i++)
+    if (tables[i].internal.load(std::memory_order_acquire) != NULL &&
+        tables[i].gameServer == gameServer)
+      invalidateIn(&tables[i], remote);
+}
+
+// The peer in the table of the interface, if it has one
+static void invalidate(CSteamID remote, ISteamNetworking *internal)
+{
+  for (unsigned i = 0; i < SESSION_CACHE_INTERFACES; i++)
+    if (tables[i].internal.load(std::memory_order_acquire) == internal)
+      invalidateIn(&tables[i], remote);
+}
+
+// With the table locked
+static void store(SessionEntry *entry, bool found, const P2PSessionState_t &state)
+{
+  uint64_t words[SESSION_WORDS] = {0};
+  memcpy(words, &state, sizeof(state));
+  uint32_t sequence = entry->sequence.load(std::memory_order_relaxed);
+  entry->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  entry->found.store(found, std::memory_order_relaxed);
+  for (unsigned i = 0; i < SESSION_WORDS; i++)
+    entry->state[i].store(words[i], std::memory_order_relaxed);
+  entry->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Without a lock
+static bool load(SessionEntry *entry, P2PSessionState_t *state)
+{
+  uint64_t words[SESSION_WORDS];
+  bool found;
+  uint32_t before, after;
+  do
+  {
+    before = entry->sequence.load(std::memory_order_acquire);
+    found = entry->found.load(std::memory_order_relaxed);
+    for (unsigned i = 0; i < SESSION_WORDS; i++)
+      words[i] = entry->state[i].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = entry->sequence.load(std::memory_order_relaxed);
+  } while ((before & 1) != 0 || before != after);
+  memcpy(state, words, sizeof(*state));
+  return found;
+}
+
+// With the table locked. A callback arriving while Steam is asked marks
+// the entry stale again.
+static bool refresh(SessionTable *table, SessionEntry *entry, CSteamID remote, P2PSessionState_t *state)
+{
+  ISteamNetworking *internal = table->internal.load(std::memory_order_relaxed);
+  entry->stale.store(false, std::memory_order_relaxed);
+  memset(state, 0, sizeof(*state));
+  bool found = internal->GetP2PSessionState(remote, state);
+  table->steamCalls++;
+  store(entry, found, *state);
+  return found;
+}
+
+// With the table locked, NULL when the table is full
+static SessionEntry *insert(SessionTable *table, uint64_t remote)
+{
+  unsigned slot = slotOf(remote);
+  for (unsigned i = 0; i < SESSION_CACHE_PEERS; i++)
+  {
+    SessionEntry *entry = &table->entries[(slot + i) & (SESSION_CACHE_PEERS - 1)];
+    uint64_t key = entry->remote.load(std::memory_order_relaxed);
+    if (key == remote)
+      return entry;
+    // Kept half empty, so a miss ends at a free entry soon
+    if (key == 0 && table->peers >= SESSION_CACHE_PEERS / 2)
+      return NULL;
+    if (key == 0)
+    {
+      entry->sequence.store(0, std::memory_order_relaxed);
+      entry->stale.store(true, std::memory_order_relaxed);
+      entry->polled.store(true, std::memory_order_relaxed);
+      table->peers++;
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+void sessionCacheNewFrame()
+{
+  uint64_t now = monotonicNs();
+  for (unsigned i = 0; i < SESSION_CACHE_INTERFACES; i++)
+  {
+    SessionTable *table = &tables[i];
+    if (table->internal.load(std::memory_order_acquire) == NULL)
+      continue;
+    std::lock_guard<std::mutex> guard(table->lock);
+    if (now - table->refreshedAt < refreshNs)
+      continue;
+    table->refreshedAt = now;
+    // Peers the game stopped asking for cost nothing
+    for (unsigned e = 0; e < SESSION_CACHE_PEERS; e++)
+    {
+      SessionEntry *entry = &table->entries[e];
+      uint64_t remote = entry->remote.load(std::memory_order_relaxed);
+      if (remote == 0 || !entry->polled.load(std::memory_order_relaxed))
+        continue;
+      entry->polled.store(false, std::memory_order_relaxed);
+      P2PSessionState_t state;
+      refresh(table, entry, CSteamID((uint64)remote), &state);
+    }
+  }
+}
+
+bool sessionGetP2PSessionState(ProfilePoint *point, ISteamNetworking *internal, CSteamID steamIDRemote,
+                               P2PSessionState_t *pConnectionState)
+{
+  ProfileScope scope(point);
+  SessionTable *table = internal != NULL ? tableOf(internal) : NULL;
+  uint64_t remote = steamIDRemote.ConvertToUint64();
+  if (table == NULL || remote == 0 || pConnectionState == NULL)
+    return internal != NULL && internal->GetP2PSessionState(steamIDRemote, pConnectionState);
+  SessionEntry *entry = find(table, remote);
+  if (entry != NULL && !entry->stale.load(std::memory_order_acquire))
+  {
+    if (!entry->polled.load(std::memory_order_relaxed))
+      entry->polled.store(true, std::memory_order_relaxed);
+    return load(entry, pConnectionState);
+  }
+  std::lock_guard<std::mutex> guard(table->lock);
+  entry = insert(table, remote);
+  if (entry == NULL)
+    return internal->GetP2PSessionState(steamIDRemote, pConnectionState);
+  bool found = refresh(table, entry, steamIDRemote, pConnectionState);
+  // Published last, readers never see an entry without a state
+  entry->remote.store(remote, std::memory_order_release);
+  return found;
+}
+
+bool sessionAcceptP2PSessionWithUser(ProfilePoint *point, ISteamNetworking *internal,
+                                     CSteamID steamIDRemote)
+{
+  ProfileScope scope(point);
+  if (internal == NULL)
+    return false;
+  bool accepted = internal->AcceptP2PSessionWithUser(steamIDRemote);
+  invalidate(steamIDRemote, internal);
+  return accepted;
+}
+
+bool sessionCloseP2PSessionWithUser(ProfilePoint *point, ISteamNetworking *internal,
+                                    CSteamID steamIDRemote)
+{
+  ProfileScope scope(point);
+  if (internal == NULL)
+    return false;
+  bool closed = internal->CloseP2PSessionWithUser(steamIDRemote);
+  invalidate(steamIDRemote, internal);
+  return closed;
+}
+
+bool sessionCloseP2PChannelWithUser(ProfilePoint *point, ISteamNetworking *internal,
+                                    CSteamID steamIDRemote, int nChannel)
+{
+  ProfileScope scope(point);
+  if (internal == NULL)
+    return false;
+  // Closing the last channel closes the session
+  bool closed = internal->CloseP2PChannelWithUser(steamIDRemote, nChannel);
+  invalidate(steamIDRemote, internal);
+  return closed;
+}
+
+void sessionCacheShutdown()
+{
+  std::lock_guard<std::mutex> guard(tablesLock);
+  for (unsigned i = 0; i < SESSION_LISTENERS; i++)
+    listeners[i].unregister();
+  for (unsigned i = 0; i < SESSION_CACHE_INTERFACES; i++)
+  {
+    SessionTable &table = tables[i];
+    if (table.internal.load(std::memory_order_relaxed) == NULL)
+      continue;
+    std::lock_guard<std::mutex> lock(table.lock);
+    TRACE("P2P sessions of %p: %u peers, %llu Steam calls\n",
+          table.internal.load(std::memory_order_relaxed), table.peers,
+          (unsigned long long)table.steamCalls);
+    table.internal.store(NULL, std::memory_order_release);
+  }
+}
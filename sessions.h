@@ -0,0 +1,42 @@
+#ifndef STEAM_FORWARDER_SESSIONS
+#define STEAM_FORWARDER_SESSIONS
+#include <stdint.h>
+#include <stddef.h>
+
+// P2P session state cache, switched on with STEAMFORWARDER_P2P_SESSIONS=<ms>.
+//
+// Games ask GetP2PSessionState for every peer every frame to drive their
+// connection UI and timeouts. With the cache on, the state of each peer is
+// kept per networking interface and reads are served from it without a
+// lock. SteamAPI_RunCallbacks_ asks Steam again every <ms> milliseconds
+// for the peers read since, so a session of 16 peers costs 16 Steam calls
+// per interval instead of per frame. A peer is asked at once on the next
+// read after P2PSessionRequest_t or P2PSessionConnectFail_t names it, or
+// after the game accepts or closes its session. The callbacks of the game
+// server's sessions come with its own callbacks and concern the interface
+// of SteamGameServerNetworking() only, those of the client the others. Served calls are profiled,
+// but neither traced nor recorded.
+//
+// Peers beyond SESSION_CACHE_PEERS are not cached.
+
+class ISteamNetworking;
+class CSteamID;
+struct P2PSessionState_t;
+struct ProfilePoint;
+
+extern bool sessionCacheEnabled;
+// Called by SteamAPI_RunCallbacks_, refreshes the peers once per interval
+void sessionCacheNewFrame();
+void sessionCacheShutdown();
+
+// What the ISteamNetworking_ wrappers and the flat exports call instead of
+// Forward<> with the cache on
+bool sessionGetP2PSessionState(ProfilePoint *point, ISteamNetworking *internal, CSteamID steamIDRemote,
+                               P2PSessionState_t *pConnectionState);
+bool sessionAcceptP2PSessionWithUser(ProfilePoint *point, ISteamNetworking *internal,
+                                     CSteamID steamIDRemote);
+bool sessionCloseP2PSessionWithUser(ProfilePoint *point, ISteamNetworking *internal,
+                                    CSteamID steamIDRemote);
+bool sessionCloseP2PChannelWithUser(ProfilePoint *point, ISteamNetworking *internal,
+                                    CSteamID steamIDRemote, int nChannel);
+#endif
@@ -0,0 +1,510 @@
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+#include "config.h"
+#include "frames.h"
+#include "profiler.h"
+#include "sockets.h"
+
+static bool socketPollInit()
+{
+  const char *enabled = getenv("STEAMFORWARDER_SOCKET_POLL");
+  if (enabled == NULL || atoi(enabled) == 0)
+    return false;
+  TRACE("Sockets are polled once per frame\n");
+  return true;
+}
+
+bool socketPollEnabled = socketPollInit();
+
+struct SocketState
+{
+  // 0 for a connection socket of our own
+  SNetListenSocket_t listen;
+  // Disconnected, Steam is not asked for it on its own anymore
+  bool closed;
+  // In the ready list of its poller
+  bool ready;
+  // The buffered messages back to back, the oldest at readAt
+  std::vector<unsigned char> data;
+  size_t readAt;
+  std::deque<uint32> sizes;
+};
+
+struct SocketStatus
+{
+  SNetSocket_t socket;
+  SNetListenSocket_t listen;
+  int state;
+};
+
+struct Poller
+{
+  std::atomic<ISteamNetworking *> internal;
+  // SteamGameServerNetworking(), its statuses come with the game server's callbacks
+  bool gameServer;
+  std::mutex lock;
+  std::unordered_map<SNetSocket_t, SocketState> sockets;
+  std::vector<SNetListenSocket_t> listens;
+  // Sockets with buffered messages, served in turn
+  std::deque<SNetSocket_t> ready;
+  // Frame of the last drain
+  uint32_t drained;
+  std::vector<unsigned char> scratch;
+  // Filled by the status listener under statusLock
+  std::vector<SocketStatus> statuses;
+  // Statistics for the trace at shutdown
+  uint64_t drains, messages, served;
+};
+
+static Poller pollers[SOCKET_POLL_INTERFACES];
+static std::mutex pollersLock;
+static FrameCounter frames;
+// Never held while calling Steam, the listener may run on the callback pump thread
+static std::mutex statusLock;
+
+void socketPollNewFrame()
+{
+  frames.next();
+}
+
+static bool closedState(int state)
+{
+  return state >= k_ESNetSocketStateDisconnecting;
+}
+
+// One per side: Steam delivers the statuses of the game server's sockets
+// only to callbacks flagged for it, and those of the client's to the others
+class StatusListener: public CCallbackBase
+{
+public:
+  StatusListener(bool gameServer): registered(false), gameServer(gameServer)
+  {
+    m_iCallback = SocketStatusCallback_t::k_iCallback;
+    if (gameServer)
+      m_nCallbackFlags |= k_ECallbackFlagsGameServer;
+  }
+  bool registered;
+  bool gameServer;
+
+  void registerFor()
+  {
+    SteamAPI_RegisterCallback(this, m_iCallback);
+    registered = true;
+  }
+  void unregister()
+  {
+    if (registered)
+      SteamAPI_UnregisterCallback(this);
+    registered = false;
+  }
+  virtual void Run(void *pvParam)
+  {
+    const SocketStatusCallback_t *status = (const SocketStatusCallback_t *)pvParam;
+    if (status == NULL || status->m_hSocket == 0)
+      return;
+    SocketStatus queued = {status->m_hSocket, status->m_hListenSocket, status->m_eSNetSocketState};
+    std::lock_guard<std::mutex> guard(statusLock);
+    for (unsigned i = 0; i < SOCKET_POLL_INTERFACES; i++)
+      if (pollers[i].internal.load(std::memory_order_acquire) != NULL &&
+          pollers[i].gameServer == gameServer)
+        pollers[i].statuses.push_back(queued);
+  }
+  virtual void Run(void *pvParam, bool bIOFailure, SteamAPICall_t hSteamAPICall)
+  {
+    Run(pvParam);
+  }
+  virtual int GetCallbackSizeBytes()
+  {
+    return sizeof(SocketStatusCallback_t);
+  }
+};
+
+static StatusListener clientListener(false);
+static StatusListener serverListener(true);
+
+// NULL when every poller is taken
+static Poller *pollerOf(ISteamNetworking *internal)
+{
+  for (unsigned i = 0; i < SOCKET_POLL_INTERFACES; i++)
+    if (pollers[i].internal.load(std::memory_order_acquire) == internal)
+      return &pollers[i];
+  bool gameServer = internal == SteamGameServerNetworking();
+  std::lock_guard<std::mutex> guard(pollersLock);
+  if (!clientListener.registered)
+  {
+    clientListener.registerFor();
+    serverListener.registerFor();
+  }
+  for (unsigned i = 0; i < SOCKET_POLL_INTERFACES; i++)
+  {
+    ISteamNetworking *owner = pollers[i].internal.load(std::memory_order_relaxed);
+    if (owner == internal)
+      return &pollers[i];
+    if (owner == NULL)
+    {
+      pollers[i].drained = 0;
+      pollers[i].gameServer = gameServer;
+      pollers[i].drains = pollers[i].messages = pollers[i].served = 0;
+      pollers[i].internal.store(internal, std::memory_order_release);
+      return &pollers[i];
+    }
+  }
+  return NULL;
+}
+
+// With the poller locked
+static SocketState &stateOf(Poller *poller, SNetSocket_t socket, SNetListenSocket_t listen)
+{
+  std::unordered_map<SNetSocket_t, SocketState>::iterator known = poller->sockets.find(socket);
+  if (known != poller->sockets.end())
+  {
+    if (listen != 0)
+      known->second.listen = listen;
+    return known->second;
+  }
+  SocketState &added = poller->sockets[socket];
+  added.listen = listen;
+  added.closed = false;
+  added.ready = false;
+  added.readAt = 0;
+  return added;
+}
+
+// With the poller locked
+static void learnListen(Poller *poller, SNetListenSocket_t listen)
+{
+  if (std::find(poller->listens.begin(), poller->listens.end(), listen) == poller->listens.end())
+    poller->listens.push_back(listen);
+}
+
+// With the poller locked
+static void buffer(Poller *poller, SNetSocket_t socket, SocketState &state, uint32 size)
+{
+  if (state.readAt == state.data.size())
+  {
+    state.data.clear();
+    state.readAt = 0;
+  }
+  state.data.insert(state.data.end(), poller->scratch.begin(), poller->scratch.begin() + size);
+  state.sizes.push_back(size);
+  if (!state.ready)
+  {
+    state.ready = true;
+    poller->ready.push_back(socket);
+  }
+  poller->messages++;
+}
+
+// With the poller locked
+static void drainListen(Poller *poller, SNetListenSocket_t listen)
+{
+  ISteamNetworking *internal = poller->internal.load(std::memory_order_relaxed);
+  uint32 size;
+  SNetSocket_t socket;
+  while (internal->IsDataAvailable(listen, &size, &socket))
+  {
+    if (poller->scratch.size() < size)
+      poller->scratch.resize(size);
+    uint32 read;
+    if (!internal->RetrieveData(listen, poller->scratch.data(), size, &read, &socket))
+      return;
+    buffer(poller, socket, stateOf(poller, socket, listen), read);
+  }
+}
+
+// With the poller locked
+static void drainSocket(Poller *poller, SNetSocket_t socket, SocketState &state)
+{
+  ISteamNetworking *internal = poller->internal.load(std::memory_order_relaxed);
+  uint32 size;
+  while (internal->IsDataAvailableOnSocket(socket, &size))
+  {
+    if (poller->scratch.size() < size)
+      poller->scratch.resize(size);
+    uint32 read;
+    if (!internal->RetrieveDataFromSocket(socket, poller->scratch.data(), size, &read))
+      return;
+    buffer(poller, socket, state, read);
+  }
+}
+
+// With the poller locked
+static void applyStatuses(Poller *poller)
+{
+  std::vector<SocketStatus> statuses;
+  {
+    std::lock_guard<std::mutex> guard(statusLock);
+    statuses.swap(poller->statuses);
+  }
+  for (size_t i = 0; i < statuses.size(); i++)
+  {
+    const SocketStatus &status = statuses[i];
+    bool closed = closedState(status.state);
+    // A socket which is gone already stays forgotten
+    if (closed && poller->sockets.count(status.socket) == 0)
+      continue;
+    if (status.listen != 0)
+      learnListen(poller, status.listen);
+    stateOf(poller, status.socket, status.listen).closed = closed;
+  }
+}
+
+// With the poller locked: everything Steam holds read once per frame
+static void refill(Poller *poller)
+{
+  uint32_t frame = frames.current(poller->drained);
+  if (poller->drained == frame)
+    return;
+  poller->drained = frame;
+  poller->drains++;
+  applyStatuses(poller);
+  for (size_t i = 0; i < poller->listens.size(); i++)
+    drainListen(poller, poller->listens[i]);
+  std::unordered_map<SNetSocket_t, SocketState>::iterator s = poller->sockets.begin();
+  while (s != poller->sockets.end())
+  {
+    // Closed sockets are forgotten once the game has read them empty
+    if (s->second.closed && s->second.sizes.empty())
+    {
+      s = poller->sockets.erase(s);
+      continue;
+    }
+    if (s->second.listen == 0 && !s->second.closed)
+      drainSocket(poller, s->first, s->second);
+    ++s;
+  }
+}
+
+// With the poller locked: the socket of the listen socket next in turn,
+// NULL when none of them has a message. Sockets which were read empty or
+// destroyed leave the ready list on the way.
+static SocketState *nextReady(Poller *poller, SNetListenSocket_t listen, SNetSocket_t *socket)
+{
+  std::deque<SNetSocket_t>::iterator at = poller->ready.begin();
+  while (at != poller->ready.end())
+  {
+    std::unordered_map<SNetSocket_t, SocketState>::iterator state = poller->sockets.find(*at);
+    if (state == poller->sockets.end() || state->second.sizes.empty())
+    {
+      if (state != poller->sockets.end())
+        state->second.ready = false;
+      at = poller->ready.erase(at);
+      continue;
+    }
+    if (state->second.listen == listen)
+    {
+      *socket = *at;
+      return &state->second;
+    }
+    ++at;
+  }
+  return NULL;
+}
+
+// With the poller locked: copies the oldest message of the socket
+static void serve(Poller *poller, SocketState &state, void *pubDest, uint32 cubDest,
+                  uint32 *pcubMsgSize)
+{
+  uint32 size = state.sizes.front();
+  // Like Steam, a short buffer gets the start of the message
+  uint32 copied = size < cubDest ? size : cubDest;
+  memcpy(pubDest, state.data.data() + state.readAt, copied);
+  *pcubMsgSize = copied;
+  state.readAt += size;
+  state.sizes.pop_front();
+  poller->served++;
+}
+
+SNetListenSocket_t socketCreateListenSocket(ProfilePoint *point, ISteamNetworking *internal,
+                                           int nVirtualP2PPort, uint32 nIP, uint16 nPort,
+                                           bool bAllowUseOfPacketRelay)
+{
+  ProfileScope scope(point);
+  if (internal == NULL)
+    return 0;
+  SNetListenSocket_t listen = internal->CreateListenSocket(nVirtualP2PPort, nIP, nPort,
+                                                           bAllowUseOfPacketRelay);
+  Poller *poller = listen != 0 ? pollerOf(internal) : NULL;
+  if (poller != NULL)
+  {
+    std::lock_guard<std::mutex> guard(poller->lock);
+    learnListen(poller, listen);
+  }
+  return listen;
+}
+
+bool socketDestroySocket(ProfilePoint *point, ISteamNetworking *internal, SNetSocket_t hSocket,
+                         bool bNotifyRemoteEnd)
+{
+  ProfileScope scope(point);
+  if (internal == NULL)
+    return false;
+  Poller *poller = pollerOf(internal);
+  if (poller != NULL)
+  {
+    std::lock_guard<std::mutex> guard(poller->lock);
+    poller->sockets.erase(hSocket);
+  }
+  return internal->DestroySocket(hSocket, bNotifyRemoteEnd);
+}
+
+bool socketDestroyListenSocket(ProfilePoint *point, ISteamNetworking *internal, SNetListenSocket_t hSocket,
+                               bool bNotifyRemoteEnd)
+{
+  ProfileScope scope(point);
+  if (internal == NULL)
+    return false;
+  Poller *poller = pollerOf(internal);
+  if (poller != NULL)
+  {
+    std::lock_guard<std::mutex> guard(poller->lock);
+    poller->listens.erase(std::remove(poller->listens.begin(), poller->listens.end(), hSocket),
+                          poller->listens.end());
+    // Its sockets go with it
+    std::unordered_map<SNetSocket_t, SocketState>::iterator s = poller->sockets.begin();
+    while (s != poller->sockets.end())
+      if (s->second.listen == hSocket)
+        s = poller->sockets.erase(s);
+      else
+        ++s;
+  }
+  return internal->DestroyListenSocket(hSocket, bNotifyRemoteEnd);
+}
+
+// With the poller locked: the state of a socket the game asks for. One we
+// do not know yet is asked at once and learned only when Steam has data
+// for it, so destroyed or invalid handles are not read every frame. NULL
+// when there is nothing to serve.
+static SocketState *polled(Poller *poller, SNetSocket_t socket)
+{
+  refill(poller);
+  std::unordered_map<SNetSocket_t, SocketState>::iterator known = poller->sockets.find(socket);
+  if (known != poller->sockets.end())
+    return known->second.sizes.empty() ? NULL : &known->second;
+  ISteamNetworking *internal = poller->internal.load(std::memory_order_relaxed);
+  uint32 size;
+  if (!internal->IsDataAvailableOnSocket(socket, &size))
+    return NULL;
+  SocketState &state = stateOf(poller, socket, 0);
+  drainSocket(poller, socket, state);
+  return state.sizes.empty() ? NULL : &state;
+}
+
+bool socketIsDataAvailableOnSocket(ProfilePoint *point, ISteamNetworking *internal, SNetSocket_t hSocket,
+                                   uint32 *pcubMsgSize)
+{
+  ProfileScope scope(point);
+  Poller *poller = internal != NULL ? pollerOf(internal) : NULL;
+  if (poller == NULL)
+    return internal != NULL && internal->IsDataAvailableOnSocket(hSocket, pcubMsgSize);
+  std::lock_guard<std::mutex> guard(poller->lock);
+  SocketState *state = polled(poller, hSocket);
+  if (state == NULL)
+    return false;
+  *pcubMsgSize = state->sizes.front();
+  return true;
+}
+
+bool socketRetrieveDataFromSocket(ProfilePoint *point, ISteamNetworking *internal, SNetSocket_t hSocket,
+                                  void *pubDest, uint32 cubDest, uint32 *pcubMsgSize)
+{
+  ProfileScope scope(point);
+  Poller *poller = internal != NULL ? pollerOf(internal) : NULL;
+  if (poller == NULL)
+    return internal != NULL &&
+           internal->RetrieveDataFromSocket(hSocket, pubDest, cubDest, pcubMsgSize);
+  std::lock_guard<std::mutex> guard(poller->lock);
+  SocketState *state = polled(poller, hSocket);
+  if (state == NULL)
+    return false;
+  serve(poller, *state, pubDest, cubDest, pcubMsgSize);
+  return true;
+}
+
+// With the poller locked
+static SocketState *listened(Poller *poller, SNetListenSocket_t listen, SNetSocket_t *socket)
+{
+  refill(poller);
+  if (std::find(poller->listens.begin(), poller->listens.end(), listen) == poller->listens.end())
+  {
+    learnListen(poller, listen);
+    drainListen(poller, listen);
+  }
+  return nextReady(poller, listen, socket);
+}
+
+bool socketIsDataAvailable(ProfilePoint *point, ISteamNetworking *internal, SNetListenSocket_t hListenSocket,
+                           uint32 *pcubMsgSize, SNetSocket_t *phSocket)
+{
+  ProfileScope scope(point);
+  Poller *poller = internal != NULL ? pollerOf(internal) : NULL;
+  if (poller == NULL)
+    return internal != NULL && internal->IsDataAvailable(hListenSocket, pcubMsgSize, phSocket);
+  std::lock_guard<std::mutex> guard(poller->lock);
+  SNetSocket_t socket;
+  SocketState *state = listened(poller, hListenSocket, &socket);
+  if (state == NULL)
+    return false;
+  *pcubMsgSize = state->sizes.front();
+  if (phSocket != NULL)
+    *phSocket = socket;
+  return true;
+}
+
+bool socketRetrieveData(ProfilePoint *point, ISteamNetworking *internal, SNetListenSocket_t hListenSocket,
+                        void *pubDest, uint32 cubDest, uint32 *pcubMsgSize, SNetSocket_t *phSocket)
+{
+  ProfileScope scope(point);
+  Poller *poller = internal != NULL ? pollerOf(internal) : NULL;
+  if (poller == NULL)
+    return internal != NULL &&
+           internal->RetrieveData(hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
+  std::lock_guard<std::mutex> guard(poller->lock);
+  SNetSocket_t socket;
+  SocketState *state = listened(poller, hListenSocket, &socket);
+  if (state == NULL)
+    return false;
+  serve(poller, *state, pubDest, cubDest, pcubMsgSize);
+  if (phSocket != NULL)
+    *phSocket = socket;
+  // The next socket gets its turn
+  poller->ready.erase(std::find(poller->ready.begin(), poller->ready.end(), socket));
+  if (state->sizes.empty())
+    state->ready = false;
+  else
+    poller->ready.push_back(socket);
+  return true;
+}
+
+void socketPollShutdown()
+{
+  std::lock_guard<std::mutex> guard(pollersLock);
+  clientListener.unregister();
+  serverListener.unregister();
+  for (unsigned i = 0; i < SOCKET_POLL_INTERFACES; i++)
+  {
+    Poller &poller = pollers[i];
+    if (poller.internal.load(std::memory_order_relaxed) == NULL)
+      continue;
+    std::lock_guard<std::mutex> lock(poller.lock);
+    TRACE("Socket poll of %p: %llu drains read %llu messages, %llu served\n",
+          poller.internal.load(std::memory_order_relaxed), (unsigned long long)poller.drains,
+          (unsigned long long)poller.messages, (unsigned long long)poller.served);
+    // Steam is going away, whatever is buffered with it
+    poller.sockets.clear();
+    poller.listens.clear();
+    poller.ready.clear();
+    poller.scratch = std::vector<unsigned char>();
+    {
+      std::lock_guard<std::mutex> status(statusLock);
+      poller.statuses.clear();
+    }
+    poller.internal.store(NULL, std::memory_order_release);
+  }
+}
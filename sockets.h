@@ -0,0 +1,60 @@
+#ifndef STEAM_FORWARDER_SOCKETS
+#define STEAM_FORWARDER_SOCKETS
+#include <stdint.h>
+#include <stddef.h>
+
+// Readiness polling of the ISteamNetworking sockets, switched on with
+// STEAMFORWARDER_SOCKET_POLL=1.
+//
+// A server with many connections asks every socket
+//
+//   while (IsDataAvailableOnSocket(socket, &size))
+//     RetrieveDataFromSocket(socket, buffer, size, &size);
+//
+// every frame, which is a forwarded call per socket even when nothing
+// arrived. With polling on, the first of these calls in a frame reads what
+// Steam holds once per listen socket with IsDataAvailable/RetrieveData,
+// which costs a call per message instead of one per socket, and once per
+// connection socket of our own. The messages wait in a buffer per socket,
+// and the sockets which have some in a ready list, so the rest of the frame
+// is served without calling Steam: idle sockets cost a lookup, and
+// IsDataAvailable/RetrieveData on a listen socket take the next ready one
+// in turn. Messages arriving later in the frame wait for the next one,
+// which SteamAPI_RunCallbacks or Steam_RunCallbacks starts, or at the
+// latest FRAME_TIMEOUT_US after this one started (frames.h). Served calls
+// are profiled, but neither traced nor recorded.
+//
+// Sockets are learned from the SocketStatusCallback_t Steam sends, which
+// tells which listen socket they belong to, and from the game's calls on
+// sockets Steam has data for; a call on any other socket goes to Steam.
+// The statuses of SteamGameServerNetworking() come with the game server's
+// callbacks, a listener on each side hands them to its own interface.
+// Destroying a socket drops what was buffered for it, as Steam does, and a
+// socket Steam reports closed is forgotten once it is read empty.
+
+class ISteamNetworking;
+struct ProfilePoint;
+
+extern bool socketPollEnabled;
+// Called by forwarderNewFrame(), the buffers are refilled once per frame
+void socketPollNewFrame();
+void socketPollShutdown();
+
+// What the ISteamNetworking_ wrappers and the flat exports call instead of
+// Forward<> with polling on. The handles are SNetSocket_t and
+// SNetListenSocket_t.
+uint32_t socketCreateListenSocket(ProfilePoint *point, ISteamNetworking *internal, int nVirtualP2PPort,
+                                  uint32_t nIP, uint16_t nPort, bool bAllowUseOfPacketRelay);
+bool socketDestroySocket(ProfilePoint *point, ISteamNetworking *internal, uint32_t hSocket,
+                         bool bNotifyRemoteEnd);
+bool socketDestroyListenSocket(ProfilePoint *point, ISteamNetworking *internal, uint32_t hSocket,
+                               bool bNotifyRemoteEnd);
+bool socketIsDataAvailableOnSocket(ProfilePoint *point, ISteamNetworking *internal, uint32_t hSocket,
+                                   uint32_t *pcubMsgSize);
+bool socketRetrieveDataFromSocket(ProfilePoint *point, ISteamNetworking *internal, uint32_t hSocket,
+                                  void *pubDest, uint32_t cubDest, uint32_t *pcubMsgSize);
+bool socketIsDataAvailable(ProfilePoint *point, ISteamNetworking *internal, uint32_t hListenSocket,
+                           uint32_t *pcubMsgSize, uint32_t *phSocket);
+bool socketRetrieveData(ProfilePoint *point, ISteamNetworking *internal, uint32_t hListenSocket,
+                        void *pubDest, uint32_t cubDest, uint32_t *pcubMsgSize, uint32_t *phSocket);
+#endif
@@ -0,0 +1,392 @@
+#include <atomic>
+#include <errno.h>
+#include <fcntl.h>
+#include <mutex>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "histogram.h"
+#include "interfaces.h"
+
+// The P2P hub of the stand-in: with STEAMSTANDIN_P2P_HUB=<name> the
+// stand-ins of up to STANDIN_HUB_MEMBERS processes on one host exchange
+// P2P packets through the shared memory segment /dev/shm/steamhub-<name>.
+// Every process takes the first free member slot when it first needs its
+// Steam ID or the hub, and is individual account STANDIN_HUB_ACCOUNT + slot
+// from then on. Slots of processes which are gone are taken over. The last
+// process to leave unlinks the segment; a hub whose members were all killed
+// stays until a later process leaves it.
+//
+// Each member has an inbox, a byte ring any member appends records to
+// under the inbox's spin lock and only its owner reads, without the lock:
+//   HubRecord, size bytes, padding to 8 bytes
+// A record which does not fit before the end of the ring starts at the
+// beginning, a size of HUB_WRAP in front of it says so. The lock holds the
+// pid of its holder, so one killed while holding it can be told apart.
+#define HUB_MAGIC 0x42554853
+#define HUB_LAYOUT 2
+#define HUB_WRAP 0xffffffffu
+
+struct HubHeader
+{
+  alignas(64) std::atomic<uint32_t> magic;
+  uint32_t layout;
+  uint32_t members;
+  uint32_t inboxSize;
+  // Set when the last member unlinks the segment, which keeps every slot
+  std::atomic<uint32_t> closed;
+};
+
+struct HubInbox
+{
+  // Owner, 0 for a free slot
+  alignas(64) std::atomic<int32_t> pid;
+  // Pid of the sender appending to the inbox, 0 if none
+  std::atomic<int32_t> lock;
+  // Bytes ever written and read
+  std::atomic<uint64_t> tail;
+  alignas(64) std::atomic<uint64_t> head;
+};
+
+struct HubRecord
+{
+  uint32_t size;
+  int32_t channel;
+  uint64_t from;
+  // monotonicNs() of the sender, the clock is the same for every process
+  uint64_t sentAt;
+};
+
+static inline uint64_t hubAligned(uint64_t size)
+{
+  return (size + 7) & ~(uint64_t)7;
+}
+
+static inline size_t hubSize()
+{
+  return sizeof(HubHeader) + STANDIN_HUB_MEMBERS * (sizeof(HubInbox) + STANDIN_HUB_INBOX);
+}
+
+struct Hub
+{
+  HubHeader *header;
+  int member;
+  int32_t pid;
+  std::atomic<uint64_t> sent;
+  std::atomic<uint64_t> failed;
+  std::atomic<uint64_t> received;
+  // From SendP2PPacket of the sender to ReadP2PPacket of the game
+  Histogram latency;
+
+  HubInbox *inbox(int m)
+  {
+    return (HubInbox *)((char *)(header + 1) + m * (sizeof(HubInbox) + STANDIN_HUB_INBOX));
+  }
+  unsigned char *ring(int m)
+  {
+    return (unsigned char *)(inbox(m) + 1);
+  }
+};
+
+static Hub hub;
+
+static bool alive(int32_t pid)
+{
+  return kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+// Frees the lock of an inbox if its holder is gone
+static void breakLock(HubInbox *inbox)
+{
+  int32_t holder = inbox->lock.load(std::memory_order_relaxed);
+  if (holder != 0 && !alive(holder))
+    inbox->lock.compare_exchange_strong(holder, 0, std::memory_order_relaxed);
+}
+
+static void lockInbox(HubInbox *inbox, int32_t self)
+{
+  // Held for a copy at most, so spinning is cheaper than a shared mutex
+  for (unsigned spins = 1;; spins++)
+  {
+    int32_t free = 0;
+    if (inbox->lock.compare_exchange_weak(free, self, std::memory_order_acquire,
+                                          std::memory_order_relaxed))
+      return;
+    if (spins % 1024 == 0)
+      breakLock(inbox);
+    sched_yield();
+  }
+}
+
+static void unlockInbox(HubInbox *inbox)
+{
+  inbox->lock.store(0, std::memory_order_release);
+}
+
+// Maps the segment, creating it if this is the first process
+static HubHeader *mapHub(const char *name)
+{
+  size_t size = hubSize();
+  bool created = true;
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0 && errno == EEXIST)
+  {
+    created = false;
+    fd = shm_open(name, O_RDWR, 0);
+  }
+  if (fd < 0)
+    return NULL;
+  // The creator may not have sized it yet
+  struct stat st;
+  for (unsigned i = 0; !created && i < 1000 && fstat(fd, &st) == 0 && (size_t)st.st_size < size; i++)
+    usleep(1000);
+  void *p = MAP_FAILED;
+  if (!created || ftruncate(fd, size) == 0)
+    p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+    return NULL;
+  HubHeader *header = (HubHeader *)p;
+  if (created)
+  {
+    header->layout = HUB_LAYOUT;
+    header->members = STANDIN_HUB_MEMBERS;
+    header->inboxSize = STANDIN_HUB_INBOX;
+    header->magic.store(HUB_MAGIC, std::memory_order_release);
+  }
+  for (unsigned i = 0; i < 1000 && header->magic.load(std::memory_order_acquire) != HUB_MAGIC; i++)
+    usleep(1000);
+  if (header->magic.load(std::memory_order_acquire) != HUB_MAGIC || header->layout != HUB_LAYOUT ||
+      header->members != STANDIN_HUB_MEMBERS || header->inboxSize != STANDIN_HUB_INBOX)
+  {
+    munmap(p, size);
+    return NULL;
+  }
+  return header;
+}
+
+// Takes a free slot of the mapped hub
+static bool takeSlot()
+{
+  int32_t self = hub.pid;
+  for (int m = 0; m < STANDIN_HUB_MEMBERS; m++)
+  {
+    HubInbox *inbox = hub.inbox(m);
+    int32_t owner = inbox->pid.load(std::memory_order_acquire);
+    if (owner != 0 && alive(owner))
+      continue;
+    if (!inbox->pid.compare_exchange_strong(owner, self, std::memory_order_acq_rel))
+      continue;
+    // A previous owner killed while sending to some inbox does not hold it
+    // forever; whatever was sent to it is dropped
+    for (int i = 0; i < STANDIN_HUB_MEMBERS; i++)
+      breakLock(hub.inbox(i));
+    inbox->head.store(inbox->tail.load(std::memory_order_acquire), std::memory_order_release);
+    hub.member = m;
+    return true;
+  }
+  return false;
+}
+
+static bool joinHub()
+{
+  const char *name = standinConfig.p2pHub;
+  if (name == NULL || name[0] == '\0')
+    return false;
+  char segment[256];
+  snprintf(segment, sizeof(segment), "/steamhub-%s", name);
+  hub.pid = getpid();
+  // A leaving member holds the free slots while it looks for others, and
+  // the segment it unlinked is replaced by a new one
+  for (unsigned i = 0; i < 1000; i++)
+  {
+    if (hub.header == NULL)
+      hub.header = mapHub(segment);
+    if (hub.header == NULL)
+    {
+      fprintf(stderr, "steam stand-in: cannot use the P2P hub /dev/shm%s\n", segment);
+      return false;
+    }
+    if (takeSlot())
+      return true;
+    if (hub.header->closed.load(std::memory_order_acquire))
+    {
+      munmap(hub.header, hubSize());
+      hub.header = NULL;
+    }
+    usleep(1000);
+  }
+  if (hub.header != NULL)
+  {
+    munmap(hub.header, hubSize());
+    hub.header = NULL;
+  }
+  fprintf(stderr, "steam stand-in: all %d members of the P2P hub /dev/shm%s are taken\n",
+          STANDIN_HUB_MEMBERS, segment);
+  return false;
+}
+
+// Joined on first use, the Steam ID must not change afterwards
+static bool joined()
+{
+  static bool member = joinHub();
+  return member;
+}
+
+// Gives the slot back when the process exits, and unlinks the segment if
+// no other member is left: every slot without a live owner is claimed
+// first, so no process joins meanwhile, and kept if it was the last
+static struct HubLeave
+{
+  ~HubLeave()
+  {
+    if (hub.header == NULL)
+      return;
+    // Not a child forked off a member
+    int32_t self = getpid();
+    int claimed = 0;
+    for (int m = 0; m < STANDIN_HUB_MEMBERS; m++)
+    {
+      int32_t owner = hub.inbox(m)->pid.load(std::memory_order_acquire);
+      if (owner == self || ((owner == 0 || !alive(owner)) &&
+                            hub.inbox(m)->pid.compare_exchange_strong(owner, self,
+                                                                      std::memory_order_acq_rel)))
+        claimed++;
+    }
+    if (claimed == STANDIN_HUB_MEMBERS)
+    {
+      hub.header->closed.store(1, std::memory_order_release);
+      char segment[256];
+      snprintf(segment, sizeof(segment), "/steamhub-%s", standinConfig.p2pHub);
+      shm_unlink(segment);
+      return;
+    }
+    for (int m = 0; m < STANDIN_HUB_MEMBERS; m++)
+    {
+      int32_t owner = self;
+      hub.inbox(m)->pid.compare_exchange_strong(owner, 0, std::memory_order_acq_rel);
+    }
+  }
+} hubLeave;
+
+uint32 standinHubAccount()
+{
+  return joined() ? STANDIN_HUB_ACCOUNT + hub.member : 0;
+}
+
+// The member of a Steam ID, -1 for anyone else
+static int memberOf(CSteamID remote)
+{
+  if (remote.GetEUniverse() != k_EUniversePublic ||
+      remote.GetEAccountType() != k_EAccountTypeIndividual)
+    return -1;
+  uint32 account = remote.GetAccountID();
+  if (account < STANDIN_HUB_ACCOUNT || account >= STANDIN_HUB_ACCOUNT + STANDIN_HUB_MEMBERS)
+    return -1;
+  return account - STANDIN_HUB_ACCOUNT;
+}
+
+bool standinHubIsMember(CSteamID remote)
+{
+  return joined() && memberOf(remote) >= 0;
+}
+
+bool standinHubSend(CSteamID remote, const void *data, uint32 size, int channel)
+{
+  if (!joined())
+    return false;
+  int m = memberOf(remote);
+  uint64_t need = hubAligned(sizeof(HubRecord) + size);
+  HubInbox *inbox = m >= 0 ? hub.inbox(m) : NULL;
+  if (inbox == NULL || inbox->pid.load(std::memory_order_relaxed) == 0 ||
+      need > STANDIN_HUB_INBOX / 2)
+  {
+    hub.failed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  HubRecord record;
+  record.size = size;
+  record.channel = channel;
+  record.from = standinSteamID().ConvertToUint64();
+  record.sentAt = monotonicNs();
+  unsigned char *ring = hub.ring(m);
+  lockInbox(inbox, hub.pid);
+  uint64_t tail = inbox->tail.load(std::memory_order_relaxed);
+  uint64_t offset = tail % STANDIN_HUB_INBOX;
+  uint64_t skip = offset + need > STANDIN_HUB_INBOX ? STANDIN_HUB_INBOX - offset : 0;
+  bool room = tail + skip + need - inbox->head.load(std::memory_order_acquire) <= STANDIN_HUB_INBOX;
+  if (room)
+  {
+    if (skip != 0)
+    {
+      uint32_t wrap = HUB_WRAP;
+      memcpy(ring + offset, &wrap, sizeof(wrap));
+      offset = 0;
+    }
+    memcpy(ring + offset, &record, sizeof(record));
+    if (size > 0)
+      memcpy(ring + offset + sizeof(record), data, size);
+    inbox->tail.store(tail + skip + need, std::memory_order_release);
+  }
+  unlockInbox(inbox);
+  // A full inbox fails the send, the game sees the overload
+  (room ? hub.sent : hub.failed).fetch_add(1, std::memory_order_relaxed);
+  return room;
+}
+
+unsigned standinHubReceive(void (*deliver)(uint64 from, const void *data, uint32 size, int channel,
+                                           uint64_t sentAt))
+{
+  if (!joined())
+    return 0;
+  HubInbox *inbox = hub.inbox(hub.member);
+  unsigned char *ring = hub.ring(hub.member);
+  uint64_t head = inbox->head.load(std::memory_order_relaxed);
+  uint64_t tail = inbox->tail.load(std::memory_order_acquire);
+  unsigned count = 0;
+  while (head != tail)
+  {
+    uint64_t offset = head % STANDIN_HUB_INBOX;
+    uint32_t size;
+    memcpy(&size, ring + offset, sizeof(size));
+    if (size == HUB_WRAP)
+    {
+      head += STANDIN_HUB_INBOX - offset;
+      continue;
+    }
+    HubRecord record;
+    memcpy(&record, ring + offset, sizeof(record));
+    deliver(record.from, ring + offset + sizeof(record), record.size, record.channel,
+            record.sentAt);
+    head += hubAligned(sizeof(record) + record.size);
+    count++;
+  }
+  inbox->head.store(head, std::memory_order_release);
+  hub.received.fetch_add(count, std::memory_order_relaxed);
+  return count;
+}
+
+void standinHubRead(uint64_t sentAt)
+{
+  uint64_t now = monotonicNs();
+  hub.latency.add(now > sentAt ? now - sentAt : 0);
+}
+
+void standinHubReport()
+{
+  if (hub.header == NULL)
+    return;
+  const Histogram &h = hub.latency;
+  fprintf(stderr, "steam stand-in: P2P hub %s, member %d (account %u): %llu sent, %llu failed, "
+          "%llu received, latency to ReadP2PPacket in us: mean %.1f, p50 %.1f, p99 %.1f, max %.1f\n",
+          standinConfig.p2pHub, hub.member, STANDIN_HUB_ACCOUNT + hub.member,
+          (unsigned long long)hub.sent.load(std::memory_order_relaxed),
+          (unsigned long long)hub.failed.load(std::memory_order_relaxed),
+          (unsigned long long)hub.received.load(std::memory_order_relaxed), h.mean() / 1e3,
+          h.percentile(0.5) / 1e3, h.percentile(0.99) / 1e3,
+          h.max.load(std::memory_order_relaxed) / 1e3);
+}
@@ -0,0 +1,7420 @@
+
+#include <string.h>
+#include "interfaces.h"
+
+uint32  ISteamAppListStandIn::GetNumInstalledApps()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+uint32  ISteamAppListStandIn::GetInstalledApps(AppId_t * pvecAppID, uint32  unMaxAppIDs)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+int  ISteamAppListStandIn::GetAppName(AppId_t  nAppID, char * pchName, int  cchNameMax)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+int  ISteamAppListStandIn::GetAppInstallDir(AppId_t  nAppID, char * pchDirectory, int  cchNameMax)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+int  ISteamAppListStandIn::GetAppBuildId(AppId_t  nAppID)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamAppsStandIn::BIsSubscribed()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamAppsStandIn::BIsLowViolence()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamAppsStandIn::BIsCybercafe()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamAppsStandIn::BIsVACBanned()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+char * ISteamAppsStandIn::GetCurrentGameLanguage()
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+char * ISteamAppsStandIn::GetAvailableGameLanguages()
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamAppsStandIn::BIsSubscribedApp(AppId_t  appID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamAppsStandIn::BIsDlcInstalled(AppId_t  appID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint32  ISteamAppsStandIn::GetEarliestPurchaseUnixTime(AppId_t  nAppID)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamAppsStandIn::BIsSubscribedFromFreeWeekend()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamAppsStandIn::GetDLCCount()
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamAppsStandIn::BGetDLCDataByIndex(int  iDLC, AppId_t * pAppID, bool * pbAvailable, char * pchName, int  cchNameBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamAppsStandIn::InstallDLC(AppId_t  nAppID)
+{
+  standinLatency();
+}
+
+void  ISteamAppsStandIn::UninstallDLC(AppId_t  nAppID)
+{
+  standinLatency();
+}
+
+void  ISteamAppsStandIn::RequestAppProofOfPurchaseKey(AppId_t  nAppID)
+{
+  standinLatency();
+}
+
+bool  ISteamAppsStandIn::GetCurrentBetaName(char * pchName, int  cchNameBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamAppsStandIn::MarkContentCorrupt(bool  bMissingFilesOnly)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint32  ISteamAppsStandIn::GetInstalledDepots(AppId_t  appID, DepotId_t * pvecDepots, uint32  cMaxDepots)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+uint32  ISteamAppsStandIn::GetAppInstallDir(AppId_t  appID, char * pchFolder, uint32  cchFolderBufferSize)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamAppsStandIn::BIsAppInstalled(AppId_t  appID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+CSteamID  ISteamAppsStandIn::GetAppOwner()
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+char * ISteamAppsStandIn::GetLaunchQueryParam(char * pchKey)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamAppsStandIn::GetDlcDownloadProgress(AppId_t  nAppID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamAppsStandIn::GetAppBuildId()
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+void  ISteamAppsStandIn::RequestAllProofOfPurchaseKeys()
+{
+  standinLatency();
+}
+
+SteamAPICall_t  ISteamAppsStandIn::GetFileDetails(char * pszFileName)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+uint32  ISteamAppTicketStandIn::GetAppOwnershipTicketData(uint32  nAppID, void * pvBuffer, uint32  cbBufferLength, uint32 * piAppId, uint32 * piSteamId, uint32 * piSignature, uint32 * pcbSignature)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+HSteamPipe  ISteamClientStandIn::CreateSteamPipe()
+{
+  standinLatency();
+  return 1;
+}
+
+bool  ISteamClientStandIn::BReleaseSteamPipe(HSteamPipe  hSteamPipe)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+HSteamUser  ISteamClientStandIn::ConnectToGlobalUser(HSteamPipe  hSteamPipe)
+{
+  standinLatency();
+  return 1;
+}
+
+HSteamUser  ISteamClientStandIn::CreateLocalUser(HSteamPipe * phSteamPipe, EAccountType  eAccountType)
+{
+  standinLatency();
+  return 1;
+}
+
+void  ISteamClientStandIn::ReleaseUser(HSteamPipe  hSteamPipe, HSteamUser  hUser)
+{
+  standinLatency();
+}
+
+ISteamUser * ISteamClientStandIn::GetISteamUser(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamUser *)standinInterface<ISteamUserStandIn>();
+}
+
+ISteamGameServer * ISteamClientStandIn::GetISteamGameServer(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamGameServer *)standinInterface<ISteamGameServerStandIn>();
+}
+
+void  ISteamClientStandIn::SetLocalIPBinding(uint32  unIP, uint16  usPort)
+{
+  standinLatency();
+}
+
+ISteamFriends * ISteamClientStandIn::GetISteamFriends(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamFriends *)standinInterface<ISteamFriendsStandIn>();
+}
+
+ISteamUtils * ISteamClientStandIn::GetISteamUtils(HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamUtils *)standinInterface<ISteamUtilsStandIn>();
+}
+
+ISteamMatchmaking * ISteamClientStandIn::GetISteamMatchmaking(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamMatchmaking *)standinInterface<ISteamMatchmakingStandIn>();
+}
+
+ISteamMatchmakingServers * ISteamClientStandIn::GetISteamMatchmakingServers(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamMatchmakingServers *)standinInterface<ISteamMatchmakingServersStandIn>();
+}
+
+ISteamUserStats * ISteamClientStandIn::GetISteamUserStats(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamUserStats *)standinInterface<ISteamUserStatsStandIn>();
+}
+
+ISteamGameServerStats * ISteamClientStandIn::GetISteamGameServerStats(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamGameServerStats *)standinInterface<ISteamGameServerStatsStandIn>();
+}
+
+ISteamApps * ISteamClientStandIn::GetISteamApps(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamApps *)standinInterface<ISteamAppsStandIn>();
+}
+
+ISteamNetworking * ISteamClientStandIn::GetISteamNetworking(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamNetworking *)standinInterface<ISteamNetworkingStandIn>();
+}
+
+ISteamRemoteStorage * ISteamClientStandIn::GetISteamRemoteStorage(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamRemoteStorage *)standinInterface<ISteamRemoteStorageStandIn>();
+}
+
+ISteamScreenshots * ISteamClientStandIn::GetISteamScreenshots(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamScreenshots *)standinInterface<ISteamScreenshotsStandIn>();
+}
+
+void  ISteamClientStandIn::RunFrame()
+{
+  standinLatency();
+}
+
+uint32  ISteamClientStandIn::GetIPCCallCount()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+void  ISteamClientStandIn::SetWarningMessageHook(SteamAPIWarningMessageHook_t  pFunction)
+{
+  standinLatency();
+}
+
+bool  ISteamClientStandIn::BShutdownIfAllPipesClosed()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+ISteamHTTP * ISteamClientStandIn::GetISteamHTTP(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamHTTP *)standinInterface<ISteamHTTPStandIn>();
+}
+
+ISteamUnifiedMessages * ISteamClientStandIn::GetISteamUnifiedMessages(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamUnifiedMessages *)standinInterface<ISteamUnifiedMessagesStandIn>();
+}
+
+ISteamController * ISteamClientStandIn::GetISteamController(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamController *)standinInterface<ISteamControllerStandIn>();
+}
+
+ISteamUGC * ISteamClientStandIn::GetISteamUGC(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamUGC *)standinInterface<ISteamUGCStandIn>();
+}
+
+ISteamAppList * ISteamClientStandIn::GetISteamAppList(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamAppList *)standinInterface<ISteamAppListStandIn>();
+}
+
+ISteamMusic * ISteamClientStandIn::GetISteamMusic(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamMusic *)standinInterface<ISteamMusicStandIn>();
+}
+
+ISteamMusicRemote * ISteamClientStandIn::GetISteamMusicRemote(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamMusicRemote *)standinInterface<ISteamMusicRemoteStandIn>();
+}
+
+ISteamHTMLSurface * ISteamClientStandIn::GetISteamHTMLSurface(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamHTMLSurface *)standinInterface<ISteamHTMLSurfaceStandIn>();
+}
+
+void  ISteamClientStandIn::DEPRECATED_Set_SteamAPI_CPostAPIResultInProcess()
+{
+  standinLatency();
+}
+
+void  ISteamClientStandIn::DEPRECATED_Remove_SteamAPI_CPostAPIResultInProcess()
+{
+  standinLatency();
+}
+
+void  ISteamClientStandIn::Set_SteamAPI_CCheckCallbackRegisteredInProcess(SteamAPI_CheckCallbackRegistered_t  func)
+{
+  standinLatency();
+}
+
+ISteamInventory * ISteamClientStandIn::GetISteamInventory(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamInventory *)standinInterface<ISteamInventoryStandIn>();
+}
+
+ISteamVideo * ISteamClientStandIn::GetISteamVideo(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  standinLatency();
+  return (ISteamVideo *)standinInterface<ISteamVideoStandIn>();
+}
+
+bool  ISteamControllerStandIn::Init()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamControllerStandIn::Shutdown()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamControllerStandIn::RunFrame()
+{
+  standinLatency();
+}
+
+int  ISteamControllerStandIn::GetConnectedControllers(ControllerHandle_t * handlesOut)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamControllerStandIn::ShowBindingPanel(ControllerHandle_t  controllerHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+ControllerActionSetHandle_t  ISteamControllerStandIn::GetActionSetHandle(char * pszActionSetName)
+{
+  standinLatency();
+  return StandInDefault<ControllerActionSetHandle_t>::value();
+}
+
+void  ISteamControllerStandIn::ActivateActionSet(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle)
+{
+  standinLatency();
+}
+
+ControllerActionSetHandle_t  ISteamControllerStandIn::GetCurrentActionSet(ControllerHandle_t  controllerHandle)
+{
+  standinLatency();
+  return StandInDefault<ControllerActionSetHandle_t>::value();
+}
+
+ControllerDigitalActionHandle_t  ISteamControllerStandIn::GetDigitalActionHandle(char * pszActionName)
+{
+  standinLatency();
+  return StandInDefault<ControllerDigitalActionHandle_t>::value();
+}
+
+ControllerDigitalActionData_t  ISteamControllerStandIn::GetDigitalActionData(ControllerHandle_t  controllerHandle, ControllerDigitalActionHandle_t  digitalActionHandle)
+{
+  standinLatency();
+  return StandInDefault<ControllerDigitalActionData_t>::value();
+}
+
+int  ISteamControllerStandIn::GetDigitalActionOrigins(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle, ControllerDigitalActionHandle_t  digitalActionHandle, EControllerActionOrigin * originsOut)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+ControllerAnalogActionHandle_t  ISteamControllerStandIn::GetAnalogActionHandle(char * pszActionName)
+{
+  standinLatency();
+  return StandInDefault<ControllerAnalogActionHandle_t>::value();
+}
+
+ControllerAnalogActionData_t  ISteamControllerStandIn::GetAnalogActionData(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  analogActionHandle)
+{
+  standinLatency();
+  return StandInDefault<ControllerAnalogActionData_t>::value();
+}
+
+int  ISteamControllerStandIn::GetAnalogActionOrigins(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle, ControllerAnalogActionHandle_t  analogActionHandle, EControllerActionOrigin * originsOut)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+void  ISteamControllerStandIn::StopAnalogActionMomentum(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  eAction)
+{
+  standinLatency();
+}
+
+void  ISteamControllerStandIn::TriggerHapticPulse(ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec)
+{
+  standinLatency();
+}
+
+void  ISteamControllerStandIn::TriggerRepeatedHapticPulse(ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec, unsigned short  usOffMicroSec, unsigned short  unRepeat, int  nFlags)
+{
+  standinLatency();
+}
+
+void  ISteamControllerStandIn::TriggerVibration(ControllerHandle_t  controllerHandle, unsigned short  usLeftSpeed, unsigned short  usRightSpeed)
+{
+  standinLatency();
+}
+
+void  ISteamControllerStandIn::SetLEDColor(ControllerHandle_t  controllerHandle, uint8  nColorR, uint8  nColorG, uint8  nColorB, int  nFlags)
+{
+  standinLatency();
+}
+
+int  ISteamControllerStandIn::GetGamepadIndexForController(ControllerHandle_t  ulControllerHandle)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+ControllerHandle_t  ISteamControllerStandIn::GetControllerForGamepadIndex(int  nIndex)
+{
+  standinLatency();
+  return StandInDefault<ControllerHandle_t>::value();
+}
+
+ControllerMotionData_t  ISteamControllerStandIn::GetMotionData(ControllerHandle_t  controllerHandle)
+{
+  standinLatency();
+  return StandInDefault<ControllerMotionData_t>::value();
+}
+
+bool  ISteamControllerStandIn::ShowDigitalActionOrigins(ControllerHandle_t  controllerHandle, ControllerDigitalActionHandle_t  digitalActionHandle, float  flScale, float  flXPosition, float  flYPosition)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamControllerStandIn::ShowAnalogActionOrigins(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  analogActionHandle, float  flScale, float  flXPosition, float  flYPosition)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+char * ISteamControllerStandIn::GetStringForActionOrigin(EControllerActionOrigin  eOrigin)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+char * ISteamControllerStandIn::GetGlyphForActionOrigin(EControllerActionOrigin  eOrigin)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+char * ISteamFriendsStandIn::GetPersonaName()
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+SteamAPICall_t  ISteamFriendsStandIn::SetPersonaName(char * pchPersonaName)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+EPersonaState  ISteamFriendsStandIn::GetPersonaState()
+{
+  standinLatency();
+  return StandInDefault<EPersonaState>::value();
+}
+
+int  ISteamFriendsStandIn::GetFriendCount(int  iFriendFlags)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+CSteamID  ISteamFriendsStandIn::GetFriendByIndex(int  iFriend, int  iFriendFlags)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+EFriendRelationship  ISteamFriendsStandIn::GetFriendRelationship(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<EFriendRelationship>::value();
+}
+
+EPersonaState  ISteamFriendsStandIn::GetFriendPersonaState(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<EPersonaState>::value();
+}
+
+char * ISteamFriendsStandIn::GetFriendPersonaName(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamFriendsStandIn::GetFriendGamePlayed(CSteamID  steamIDFriend, FriendGameInfo_t * pFriendGameInfo)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+char * ISteamFriendsStandIn::GetFriendPersonaNameHistory(CSteamID  steamIDFriend, int  iPersonaName)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+int  ISteamFriendsStandIn::GetFriendSteamLevel(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+char * ISteamFriendsStandIn::GetPlayerNickname(CSteamID  steamIDPlayer)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+int  ISteamFriendsStandIn::GetFriendsGroupCount()
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+FriendsGroupID_t  ISteamFriendsStandIn::GetFriendsGroupIDByIndex(int  iFG)
+{
+  standinLatency();
+  return StandInDefault<FriendsGroupID_t>::value();
+}
+
+char * ISteamFriendsStandIn::GetFriendsGroupName(FriendsGroupID_t  friendsGroupID)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+int  ISteamFriendsStandIn::GetFriendsGroupMembersCount(FriendsGroupID_t  friendsGroupID)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+void  ISteamFriendsStandIn::GetFriendsGroupMembersList(FriendsGroupID_t  friendsGroupID, CSteamID * pOutSteamIDMembers, int  nMembersCount)
+{
+  standinLatency();
+}
+
+bool  ISteamFriendsStandIn::HasFriend(CSteamID  steamIDFriend, int  iFriendFlags)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamFriendsStandIn::GetClanCount()
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+CSteamID  ISteamFriendsStandIn::GetClanByIndex(int  iClan)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+char * ISteamFriendsStandIn::GetClanName(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+char * ISteamFriendsStandIn::GetClanTag(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamFriendsStandIn::GetClanActivityCounts(CSteamID  steamIDClan, int * pnOnline, int * pnInGame, int * pnChatting)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamFriendsStandIn::DownloadClanActivityCounts(CSteamID * psteamIDClans, int  cClansToRequest)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+int  ISteamFriendsStandIn::GetFriendCountFromSource(CSteamID  steamIDSource)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+CSteamID  ISteamFriendsStandIn::GetFriendFromSourceByIndex(CSteamID  steamIDSource, int  iFriend)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+bool  ISteamFriendsStandIn::IsUserInSource(CSteamID  steamIDUser, CSteamID  steamIDSource)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamFriendsStandIn::SetInGameVoiceSpeaking(CSteamID  steamIDUser, bool  bSpeaking)
+{
+  standinLatency();
+}
+
+void  ISteamFriendsStandIn::ActivateGameOverlay(char * pchDialog)
+{
+  standinLatency();
+}
+
+void  ISteamFriendsStandIn::ActivateGameOverlayToUser(char * pchDialog, CSteamID  steamID)
+{
+  standinLatency();
+}
+
+void  ISteamFriendsStandIn::ActivateGameOverlayToWebPage(char * pchURL)
+{
+  standinLatency();
+}
+
+void  ISteamFriendsStandIn::ActivateGameOverlayToStore(AppId_t  nAppID, EOverlayToStoreFlag  eFlag)
+{
+  standinLatency();
+}
+
+void  ISteamFriendsStandIn::SetPlayedWith(CSteamID  steamIDUserPlayedWith)
+{
+  standinLatency();
+}
+
+void  ISteamFriendsStandIn::ActivateGameOverlayInviteDialog(CSteamID  steamIDLobby)
+{
+  standinLatency();
+}
+
+int  ISteamFriendsStandIn::GetSmallFriendAvatar(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+int  ISteamFriendsStandIn::GetMediumFriendAvatar(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+int  ISteamFriendsStandIn::GetLargeFriendAvatar(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamFriendsStandIn::RequestUserInformation(CSteamID  steamIDUser, bool  bRequireNameOnly)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamFriendsStandIn::RequestClanOfficerList(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+CSteamID  ISteamFriendsStandIn::GetClanOwner(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+int  ISteamFriendsStandIn::GetClanOfficerCount(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+CSteamID  ISteamFriendsStandIn::GetClanOfficerByIndex(CSteamID  steamIDClan, int  iOfficer)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+uint32  ISteamFriendsStandIn::GetUserRestrictions()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamFriendsStandIn::SetRichPresence(char * pchKey, char * pchValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamFriendsStandIn::ClearRichPresence()
+{
+  standinLatency();
+}
+
+char * ISteamFriendsStandIn::GetFriendRichPresence(CSteamID  steamIDFriend, char * pchKey)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+int  ISteamFriendsStandIn::GetFriendRichPresenceKeyCount(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+char * ISteamFriendsStandIn::GetFriendRichPresenceKeyByIndex(CSteamID  steamIDFriend, int  iKey)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+void  ISteamFriendsStandIn::RequestFriendRichPresence(CSteamID  steamIDFriend)
+{
+  standinLatency();
+}
+
+bool  ISteamFriendsStandIn::InviteUserToGame(CSteamID  steamIDFriend, char * pchConnectString)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamFriendsStandIn::GetCoplayFriendCount()
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+CSteamID  ISteamFriendsStandIn::GetCoplayFriend(int  iCoplayFriend)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+int  ISteamFriendsStandIn::GetFriendCoplayTime(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+AppId_t  ISteamFriendsStandIn::GetFriendCoplayGame(CSteamID  steamIDFriend)
+{
+  standinLatency();
+  return StandInDefault<AppId_t>::value();
+}
+
+SteamAPICall_t  ISteamFriendsStandIn::JoinClanChatRoom(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamFriendsStandIn::LeaveClanChatRoom(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamFriendsStandIn::GetClanChatMemberCount(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+CSteamID  ISteamFriendsStandIn::GetChatMemberByIndex(CSteamID  steamIDClan, int  iUser)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+bool  ISteamFriendsStandIn::SendClanChatMessage(CSteamID  steamIDClanChat, char * pchText)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamFriendsStandIn::GetClanChatMessage(CSteamID  steamIDClanChat, int  iMessage, void * prgchText, int  cchTextMax, EChatEntryType * peChatEntryType, CSteamID * psteamidChatter)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamFriendsStandIn::IsClanChatAdmin(CSteamID  steamIDClanChat, CSteamID  steamIDUser)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamFriendsStandIn::IsClanChatWindowOpenInSteam(CSteamID  steamIDClanChat)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamFriendsStandIn::OpenClanChatWindowInSteam(CSteamID  steamIDClanChat)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamFriendsStandIn::CloseClanChatWindowInSteam(CSteamID  steamIDClanChat)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamFriendsStandIn::SetListenForFriendsMessages(bool  bInterceptEnabled)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamFriendsStandIn::ReplyToFriendMessage(CSteamID  steamIDFriend, char * pchMsgToSend)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamFriendsStandIn::GetFriendMessage(CSteamID  steamIDFriend, int  iMessageID, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+SteamAPICall_t  ISteamFriendsStandIn::GetFollowerCount(CSteamID  steamID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamFriendsStandIn::IsFollowing(CSteamID  steamID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamFriendsStandIn::EnumerateFollowingList(uint32  unStartIndex)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+EGCResults  ISteamGameCoordinatorStandIn::SendMessage(uint32  unMsgType, void * pubData, uint32  cubData)
+{
+  standinLatency();
+  return StandInDefault<EGCResults>::value();
+}
+
+bool  ISteamGameCoordinatorStandIn::IsMessageAvailable(uint32 * pcubMsgSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+EGCResults  ISteamGameCoordinatorStandIn::RetrieveMessage(uint32 * punMsgType, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize)
+{
+  standinLatency();
+  return StandInDefault<EGCResults>::value();
+}
+
+bool  ISteamGameServerStandIn::InitGameServer(uint32  unIP, uint16  usGamePort, uint16  usQueryPort, uint32  unFlags, AppId_t  nGameAppId, char * pchVersionString)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamGameServerStandIn::SetProduct(char * pszProduct)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetGameDescription(char * pszGameDescription)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetModDir(char * pszModDir)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetDedicatedServer(bool  bDedicated)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::LogOn(char * pszToken)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::LogOnAnonymous()
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::LogOff()
+{
+  standinLatency();
+}
+
+bool  ISteamGameServerStandIn::BLoggedOn()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStandIn::BSecure()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+CSteamID  ISteamGameServerStandIn::GetSteamID()
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+bool  ISteamGameServerStandIn::WasRestartRequested()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamGameServerStandIn::SetMaxPlayerCount(int  cPlayersMax)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetBotPlayerCount(int  cBotplayers)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetServerName(char * pszServerName)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetMapName(char * pszMapName)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetPasswordProtected(bool  bPasswordProtected)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetSpectatorPort(uint16  unSpectatorPort)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetSpectatorServerName(char * pszSpectatorServerName)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::ClearAllKeyValues()
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetKeyValue(char * pKey, char * pValue)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetGameTags(char * pchGameTags)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetGameData(char * pchGameData)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetRegion(char * pszRegion)
+{
+  standinLatency();
+}
+
+bool  ISteamGameServerStandIn::SendUserConnectAndAuthenticate(uint32  unIPClient, void * pvAuthBlob, uint32  cubAuthBlobSize, CSteamID * pSteamIDUser)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+CSteamID  ISteamGameServerStandIn::CreateUnauthenticatedUserConnection()
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+void  ISteamGameServerStandIn::SendUserDisconnect(CSteamID  steamIDUser)
+{
+  standinLatency();
+}
+
+bool  ISteamGameServerStandIn::BUpdateUserData(CSteamID  steamIDUser, char * pchPlayerName, uint32  uScore)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+HAuthTicket  ISteamGameServerStandIn::GetAuthSessionTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
+{
+  standinLatency();
+  return StandInDefault<HAuthTicket>::value();
+}
+
+EBeginAuthSessionResult  ISteamGameServerStandIn::BeginAuthSession(void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
+{
+  standinLatency();
+  return StandInDefault<EBeginAuthSessionResult>::value();
+}
+
+void  ISteamGameServerStandIn::EndAuthSession(CSteamID  steamID)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::CancelAuthTicket(HAuthTicket  hAuthTicket)
+{
+  standinLatency();
+}
+
+EUserHasLicenseForAppResult  ISteamGameServerStandIn::UserHasLicenseForApp(CSteamID  steamID, AppId_t  appID)
+{
+  standinLatency();
+  return StandInDefault<EUserHasLicenseForAppResult>::value();
+}
+
+bool  ISteamGameServerStandIn::RequestUserGroupStatus(CSteamID  steamIDUser, CSteamID  steamIDGroup)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamGameServerStandIn::GetGameplayStats()
+{
+  standinLatency();
+}
+
+SteamAPICall_t  ISteamGameServerStandIn::GetServerReputation()
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+uint32  ISteamGameServerStandIn::GetPublicIP()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamGameServerStandIn::HandleIncomingPacket(void * pData, int  cbData, uint32  srcIP, uint16  srcPort)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamGameServerStandIn::GetNextOutgoingPacket(void * pOut, int  cbMaxOut, uint32 * pNetAdr, uint16 * pPort)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+void  ISteamGameServerStandIn::EnableHeartbeats(bool  bActive)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::SetHeartbeatInterval(int  iHeartbeatInterval)
+{
+  standinLatency();
+}
+
+void  ISteamGameServerStandIn::ForceHeartbeat()
+{
+  standinLatency();
+}
+
+SteamAPICall_t  ISteamGameServerStandIn::AssociateWithClan(CSteamID  steamIDClan)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamGameServerStandIn::ComputeNewPlayerCompatibility(CSteamID  steamIDNewPlayer)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamGameServerStatsStandIn::RequestUserStats(CSteamID  steamIDUser)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamGameServerStatsStandIn::GetUserStat(CSteamID  steamIDUser, char * pchName, int32 * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStatsStandIn::GetUserStat(CSteamID  steamIDUser, char * pchName, float * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStatsStandIn::GetUserAchievement(CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStatsStandIn::SetUserStat(CSteamID  steamIDUser, char * pchName, int32  nData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStatsStandIn::SetUserStat(CSteamID  steamIDUser, char * pchName, float  fData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStatsStandIn::UpdateUserAvgRateStat(CSteamID  steamIDUser, char * pchName, float  flCountThisSession, double  dSessionLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStatsStandIn::SetUserAchievement(CSteamID  steamIDUser, char * pchName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamGameServerStatsStandIn::ClearUserAchievement(CSteamID  steamIDUser, char * pchName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamGameServerStatsStandIn::StoreUserStats(CSteamID  steamIDUser)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamHTMLSurfaceStandIn::Init()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTMLSurfaceStandIn::Shutdown()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamHTMLSurfaceStandIn::CreateBrowser(char * pchUserAgent, char * pchUserCSS)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+void  ISteamHTMLSurfaceStandIn::RemoveBrowser(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::LoadURL(HHTMLBrowser  unBrowserHandle, char * pchURL, char * pchPostData)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::SetSize(HHTMLBrowser  unBrowserHandle, uint32  unWidth, uint32  unHeight)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::StopLoad(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::Reload(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::GoBack(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::GoForward(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::AddHeader(HHTMLBrowser  unBrowserHandle, char * pchKey, char * pchValue)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::ExecuteJavascript(HHTMLBrowser  unBrowserHandle, char * pchScript)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::MouseUp(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::MouseDown(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::MouseDoubleClick(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::MouseMove(HHTMLBrowser  unBrowserHandle, int  x, int  y)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::MouseWheel(HHTMLBrowser  unBrowserHandle, int32  nDelta)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::KeyDown(HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::KeyUp(HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::KeyChar(HHTMLBrowser  unBrowserHandle, uint32  cUnicodeChar, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::SetHorizontalScroll(HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::SetVerticalScroll(HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::SetKeyFocus(HHTMLBrowser  unBrowserHandle, bool  bHasKeyFocus)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::ViewSource(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::CopyToClipboard(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::PasteFromClipboard(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::Find(HHTMLBrowser  unBrowserHandle, char * pchSearchStr, bool  bCurrentlyInFind, bool  bReverse)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::StopFind(HHTMLBrowser  unBrowserHandle)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::GetLinkAtPosition(HHTMLBrowser  unBrowserHandle, int  x, int  y)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::SetCookie(char * pchHostname, char * pchKey, char * pchValue, char * pchPath)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::SetPageScaleFactor(HHTMLBrowser  unBrowserHandle, float  flZoom, int  nPointX, int  nPointY)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::SetBackgroundMode(HHTMLBrowser  unBrowserHandle, bool  bBackgroundMode)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::AllowStartRequest(HHTMLBrowser  unBrowserHandle, bool  bAllowed)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::JSDialogResponse(HHTMLBrowser  unBrowserHandle, bool  bResult)
+{
+  standinLatency();
+}
+
+void  ISteamHTMLSurfaceStandIn::FileLoadDialogResponse(HHTMLBrowser  unBrowserHandle, char ** pchSelectedFiles)
+{
+  standinLatency();
+}
+
+HTTPRequestHandle  ISteamHTTPStandIn::CreateHTTPRequest(EHTTPMethod  eHTTPRequestMethod, char * pchAbsoluteURL)
+{
+  standinLatency();
+  return StandInDefault<HTTPRequestHandle>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestContextValue(HTTPRequestHandle  hRequest, uint64  ulContextValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestNetworkActivityTimeout(HTTPRequestHandle  hRequest, uint32  unTimeoutSeconds)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestHeaderValue(HTTPRequestHandle  hRequest, char * pchHeaderName, char * pchHeaderValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestGetOrPostParameter(HTTPRequestHandle  hRequest, char * pchParamName, char * pchParamValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SendHTTPRequest(HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SendHTTPRequestAndStreamResponse(HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::DeferHTTPRequest(HTTPRequestHandle  hRequest)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::PrioritizeHTTPRequest(HTTPRequestHandle  hRequest)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::GetHTTPResponseHeaderSize(HTTPRequestHandle  hRequest, char * pchHeaderName, uint32 * unResponseHeaderSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::GetHTTPResponseHeaderValue(HTTPRequestHandle  hRequest, char * pchHeaderName, uint8 * pHeaderValueBuffer, uint32  unBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::GetHTTPResponseBodySize(HTTPRequestHandle  hRequest, uint32 * unBodySize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::GetHTTPResponseBodyData(HTTPRequestHandle  hRequest, uint8 * pBodyDataBuffer, uint32  unBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::GetHTTPStreamingResponseBodyData(HTTPRequestHandle  hRequest, uint32  cOffset, uint8 * pBodyDataBuffer, uint32  unBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::ReleaseHTTPRequest(HTTPRequestHandle  hRequest)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::GetHTTPDownloadProgressPct(HTTPRequestHandle  hRequest, float * pflPercentOut)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestRawPostBody(HTTPRequestHandle  hRequest, char * pchContentType, uint8 * pubBody, uint32  unBodyLen)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+HTTPCookieContainerHandle  ISteamHTTPStandIn::CreateCookieContainer(bool  bAllowResponsesToModify)
+{
+  standinLatency();
+  return StandInDefault<HTTPCookieContainerHandle>::value();
+}
+
+bool  ISteamHTTPStandIn::ReleaseCookieContainer(HTTPCookieContainerHandle  hCookieContainer)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetCookie(HTTPCookieContainerHandle  hCookieContainer, char * pchHost, char * pchUrl, char * pchCookie)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestCookieContainer(HTTPRequestHandle  hRequest, HTTPCookieContainerHandle  hCookieContainer)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestUserAgentInfo(HTTPRequestHandle  hRequest, char * pchUserAgentInfo)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestRequiresVerifiedCertificate(HTTPRequestHandle  hRequest, bool  bRequireVerifiedCertificate)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::SetHTTPRequestAbsoluteTimeoutMS(HTTPRequestHandle  hRequest, uint32  unMilliseconds)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamHTTPStandIn::GetHTTPRequestWasTimedOut(HTTPRequestHandle  hRequest, bool * pbWasTimedOut)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+EResult  ISteamInventoryStandIn::GetResultStatus(SteamInventoryResult_t  resultHandle)
+{
+  standinLatency();
+  return StandInDefault<EResult>::value();
+}
+
+bool  ISteamInventoryStandIn::GetResultItems(SteamInventoryResult_t  resultHandle, SteamItemDetails_t * pOutItemsArray, uint32 * punOutItemsArraySize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint32  ISteamInventoryStandIn::GetResultTimestamp(SteamInventoryResult_t  resultHandle)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamInventoryStandIn::CheckResultSteamID(SteamInventoryResult_t  resultHandle, CSteamID  steamIDExpected)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamInventoryStandIn::DestroyResult(SteamInventoryResult_t  resultHandle)
+{
+  standinLatency();
+}
+
+bool  ISteamInventoryStandIn::GetAllItems(SteamInventoryResult_t * pResultHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::GetItemsByID(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t * pInstanceIDs, uint32  unCountInstanceIDs)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::SerializeResult(SteamInventoryResult_t  resultHandle, void * pOutBuffer, uint32 * punOutBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::DeserializeResult(SteamInventoryResult_t * pOutResultHandle, void * pBuffer, uint32  unBufferSize, bool  bRESERVED_MUST_BE_FALSE)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::GenerateItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32 * punArrayQuantity, uint32  unArrayLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::GrantPromoItems(SteamInventoryResult_t * pResultHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::AddPromoItem(SteamInventoryResult_t * pResultHandle, SteamItemDef_t  itemDef)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::AddPromoItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32  unArrayLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::ConsumeItem(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemConsume, uint32  unQuantity)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::ExchangeItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayGenerate, uint32 * punArrayGenerateQuantity, uint32  unArrayGenerateLength, SteamItemInstanceID_t * pArrayDestroy, uint32 * punArrayDestroyQuantity, uint32  unArrayDestroyLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::TransferItemQuantity(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemIdSource, uint32  unQuantity, SteamItemInstanceID_t  itemIdDest)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamInventoryStandIn::SendItemDropHeartbeat()
+{
+  standinLatency();
+}
+
+bool  ISteamInventoryStandIn::TriggerItemDrop(SteamInventoryResult_t * pResultHandle, SteamItemDef_t  dropListDefinition)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::TradeItems(SteamInventoryResult_t * pResultHandle, CSteamID  steamIDTradePartner, SteamItemInstanceID_t * pArrayGive, uint32 * pArrayGiveQuantity, uint32  nArrayGiveLength, SteamItemInstanceID_t * pArrayGet, uint32 * pArrayGetQuantity, uint32  nArrayGetLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::LoadItemDefinitions()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::GetItemDefinitionIDs(SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamInventoryStandIn::GetItemDefinitionProperty(SteamItemDef_t  iDefinition, char * pchPropertyName, char * pchValueBuffer, uint32 * punValueBufferSizeOut)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamInventoryStandIn::RequestEligiblePromoItemDefinitionsIDs(CSteamID  steamID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamInventoryStandIn::GetEligiblePromoItemDefinitionIDs(CSteamID  steamID, SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamMatchmakingStandIn::GetFavoriteGameCount()
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamMatchmakingStandIn::GetFavoriteGame(int  iGame, AppId_t * pnAppID, uint32 * pnIP, uint16 * pnConnPort, uint16 * pnQueryPort, uint32 * punFlags, uint32 * pRTime32LastPlayedOnServer)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamMatchmakingStandIn::AddFavoriteGame(AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags, uint32  rTime32LastPlayedOnServer)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamMatchmakingStandIn::RemoveFavoriteGame(AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamMatchmakingStandIn::RequestLobbyList()
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+void  ISteamMatchmakingStandIn::AddRequestLobbyListStringFilter(char * pchKeyToMatch, char * pchValueToMatch, ELobbyComparison  eComparisonType)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingStandIn::AddRequestLobbyListNumericalFilter(char * pchKeyToMatch, int  nValueToMatch, ELobbyComparison  eComparisonType)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingStandIn::AddRequestLobbyListNearValueFilter(char * pchKeyToMatch, int  nValueToBeCloseTo)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingStandIn::AddRequestLobbyListFilterSlotsAvailable(int  nSlotsAvailable)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingStandIn::AddRequestLobbyListDistanceFilter(ELobbyDistanceFilter  eLobbyDistanceFilter)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingStandIn::AddRequestLobbyListResultCountFilter(int  cMaxResults)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingStandIn::AddRequestLobbyListCompatibleMembersFilter(CSteamID  steamIDLobby)
+{
+  standinLatency();
+}
+
+CSteamID  ISteamMatchmakingStandIn::GetLobbyByIndex(int  iLobby)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+SteamAPICall_t  ISteamMatchmakingStandIn::CreateLobby(ELobbyType  eLobbyType, int  cMaxMembers)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamMatchmakingStandIn::JoinLobby(CSteamID  steamIDLobby)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+void  ISteamMatchmakingStandIn::LeaveLobby(CSteamID  steamIDLobby)
+{
+  standinLatency();
+}
+
+bool  ISteamMatchmakingStandIn::InviteUserToLobby(CSteamID  steamIDLobby, CSteamID  steamIDInvitee)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamMatchmakingStandIn::GetNumLobbyMembers(CSteamID  steamIDLobby)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+CSteamID  ISteamMatchmakingStandIn::GetLobbyMemberByIndex(CSteamID  steamIDLobby, int  iMember)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+char * ISteamMatchmakingStandIn::GetLobbyData(CSteamID  steamIDLobby, char * pchKey)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamMatchmakingStandIn::SetLobbyData(CSteamID  steamIDLobby, char * pchKey, char * pchValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamMatchmakingStandIn::GetLobbyDataCount(CSteamID  steamIDLobby)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamMatchmakingStandIn::GetLobbyDataByIndex(CSteamID  steamIDLobby, int  iLobbyData, char * pchKey, int  cchKeyBufferSize, char * pchValue, int  cchValueBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMatchmakingStandIn::DeleteLobbyData(CSteamID  steamIDLobby, char * pchKey)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+char * ISteamMatchmakingStandIn::GetLobbyMemberData(CSteamID  steamIDLobby, CSteamID  steamIDUser, char * pchKey)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+void  ISteamMatchmakingStandIn::SetLobbyMemberData(CSteamID  steamIDLobby, char * pchKey, char * pchValue)
+{
+  standinLatency();
+}
+
+bool  ISteamMatchmakingStandIn::SendLobbyChatMsg(CSteamID  steamIDLobby, void * pvMsgBody, int  cubMsgBody)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamMatchmakingStandIn::GetLobbyChatEntry(CSteamID  steamIDLobby, int  iChatID, CSteamID * pSteamIDUser, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamMatchmakingStandIn::RequestLobbyData(CSteamID  steamIDLobby)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamMatchmakingStandIn::SetLobbyGameServer(CSteamID  steamIDLobby, uint32  unGameServerIP, uint16  unGameServerPort, CSteamID  steamIDGameServer)
+{
+  standinLatency();
+}
+
+bool  ISteamMatchmakingStandIn::GetLobbyGameServer(CSteamID  steamIDLobby, uint32 * punGameServerIP, uint16 * punGameServerPort, CSteamID * psteamIDGameServer)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMatchmakingStandIn::SetLobbyMemberLimit(CSteamID  steamIDLobby, int  cMaxMembers)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamMatchmakingStandIn::GetLobbyMemberLimit(CSteamID  steamIDLobby)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamMatchmakingStandIn::SetLobbyType(CSteamID  steamIDLobby, ELobbyType  eLobbyType)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMatchmakingStandIn::SetLobbyJoinable(CSteamID  steamIDLobby, bool  bLobbyJoinable)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+CSteamID  ISteamMatchmakingStandIn::GetLobbyOwner(CSteamID  steamIDLobby)
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+bool  ISteamMatchmakingStandIn::SetLobbyOwner(CSteamID  steamIDLobby, CSteamID  steamIDNewOwner)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMatchmakingStandIn::SetLinkedLobby(CSteamID  steamIDLobby, CSteamID  steamIDLobbyDependent)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamMatchmakingServerListResponseStandIn::ServerResponded(HServerListRequest  hRequest, int  iServer)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingServerListResponseStandIn::ServerFailedToRespond(HServerListRequest  hRequest, int  iServer)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingServerListResponseStandIn::RefreshComplete(HServerListRequest  hRequest, EMatchMakingServerResponse  response)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingPingResponseStandIn::ServerResponded(gameserveritem_t & server)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingPingResponseStandIn::ServerFailedToRespond()
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingPlayersResponseStandIn::AddPlayerToList(char * pchName, int  nScore, float  flTimePlayed)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingPlayersResponseStandIn::PlayersFailedToRespond()
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingPlayersResponseStandIn::PlayersRefreshComplete()
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingRulesResponseStandIn::RulesResponded(char * pchRule, char * pchValue)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingRulesResponseStandIn::RulesFailedToRespond()
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingRulesResponseStandIn::RulesRefreshComplete()
+{
+  standinLatency();
+}
+
+HServerListRequest  ISteamMatchmakingServersStandIn::RequestInternetServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerListRequest>::value();
+}
+
+HServerListRequest  ISteamMatchmakingServersStandIn::RequestLANServerList(AppId_t  iApp, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerListRequest>::value();
+}
+
+HServerListRequest  ISteamMatchmakingServersStandIn::RequestFriendsServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerListRequest>::value();
+}
+
+HServerListRequest  ISteamMatchmakingServersStandIn::RequestFavoritesServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerListRequest>::value();
+}
+
+HServerListRequest  ISteamMatchmakingServersStandIn::RequestHistoryServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerListRequest>::value();
+}
+
+HServerListRequest  ISteamMatchmakingServersStandIn::RequestSpectatorServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerListRequest>::value();
+}
+
+void  ISteamMatchmakingServersStandIn::ReleaseRequest(HServerListRequest  hServerListRequest)
+{
+  standinLatency();
+}
+
+gameserveritem_t * ISteamMatchmakingServersStandIn::GetServerDetails(HServerListRequest  hRequest, int  iServer)
+{
+  standinLatency();
+  return StandInDefault<gameserveritem_t *>::value();
+}
+
+void  ISteamMatchmakingServersStandIn::CancelQuery(HServerListRequest  hRequest)
+{
+  standinLatency();
+}
+
+void  ISteamMatchmakingServersStandIn::RefreshQuery(HServerListRequest  hRequest)
+{
+  standinLatency();
+}
+
+bool  ISteamMatchmakingServersStandIn::IsRefreshing(HServerListRequest  hRequest)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamMatchmakingServersStandIn::GetServerCount(HServerListRequest  hRequest)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+void  ISteamMatchmakingServersStandIn::RefreshServer(HServerListRequest  hRequest, int  iServer)
+{
+  standinLatency();
+}
+
+HServerQuery  ISteamMatchmakingServersStandIn::PingServer(uint32  unIP, uint16  usPort, ISteamMatchmakingPingResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerQuery>::value();
+}
+
+HServerQuery  ISteamMatchmakingServersStandIn::PlayerDetails(uint32  unIP, uint16  usPort, ISteamMatchmakingPlayersResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerQuery>::value();
+}
+
+HServerQuery  ISteamMatchmakingServersStandIn::ServerRules(uint32  unIP, uint16  usPort, ISteamMatchmakingRulesResponse * pRequestServersResponse)
+{
+  standinLatency();
+  return StandInDefault<HServerQuery>::value();
+}
+
+void  ISteamMatchmakingServersStandIn::CancelServerQuery(HServerQuery  hServerQuery)
+{
+  standinLatency();
+}
+
+bool  ISteamMusicStandIn::BIsEnabled()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicStandIn::BIsPlaying()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+AudioPlayback_Status  ISteamMusicStandIn::GetPlaybackStatus()
+{
+  standinLatency();
+  return StandInDefault<AudioPlayback_Status>::value();
+}
+
+void  ISteamMusicStandIn::Play()
+{
+  standinLatency();
+}
+
+void  ISteamMusicStandIn::Pause()
+{
+  standinLatency();
+}
+
+void  ISteamMusicStandIn::PlayPrevious()
+{
+  standinLatency();
+}
+
+void  ISteamMusicStandIn::PlayNext()
+{
+  standinLatency();
+}
+
+void  ISteamMusicStandIn::SetVolume(float  flVolume)
+{
+  standinLatency();
+}
+
+float  ISteamMusicStandIn::GetVolume()
+{
+  standinLatency();
+  return StandInDefault<float>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::RegisterSteamMusicRemote(char * pchName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::DeregisterSteamMusicRemote()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::BIsCurrentMusicRemote()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::BActivationSuccess(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::SetDisplayName(char * pchDisplayName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::SetPNGIcon_64x64(void * pvBuffer, uint32  cbBufferLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::EnablePlayPrevious(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::EnablePlayNext(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::EnableShuffled(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::EnableLooped(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::EnableQueue(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::EnablePlaylists(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::UpdatePlaybackStatus(AudioPlayback_Status  nStatus)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::UpdateShuffled(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::UpdateLooped(bool  bValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::UpdateVolume(float  flValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::CurrentEntryWillChange()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::CurrentEntryIsAvailable(bool  bAvailable)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::UpdateCurrentEntryText(char * pchText)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::UpdateCurrentEntryElapsedSeconds(int  nValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::UpdateCurrentEntryCoverArt(void * pvBuffer, uint32  cbBufferLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::CurrentEntryDidChange()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::QueueWillChange()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::ResetQueueEntries()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::SetQueueEntry(int  nID, int  nPosition, char * pchEntryText)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::SetCurrentQueueEntry(int  nID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::QueueDidChange()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::PlaylistWillChange()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::ResetPlaylistEntries()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::SetPlaylistEntry(int  nID, int  nPosition, char * pchEntryText)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::SetCurrentPlaylistEntry(int  nID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamMusicRemoteStandIn::PlaylistDidChange()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamNetworkingStandIn::AllowP2PPacketRelay(bool  bAllow)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::FileWriteAsync(char * pchFile, void * pvData, uint32  cubData)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::FileReadAsync(char * pchFile, uint32  nOffset, uint32  cubToRead)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamRemoteStorageStandIn::FileReadAsyncComplete(SteamAPICall_t  hReadCall, void * pvBuffer, uint32  cubToRead)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::FileForget(char * pchFile)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::FileShare(char * pchFile)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamRemoteStorageStandIn::SetSyncPlatforms(char * pchFile, ERemoteStoragePlatform  eRemoteStoragePlatform)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+UGCFileWriteStreamHandle_t  ISteamRemoteStorageStandIn::FileWriteStreamOpen(char * pchFile)
+{
+  standinLatency();
+  return StandInDefault<UGCFileWriteStreamHandle_t>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::FileWriteStreamWriteChunk(UGCFileWriteStreamHandle_t  writeHandle, void * pvData, int32  cubData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::FileWriteStreamClose(UGCFileWriteStreamHandle_t  writeHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::FileWriteStreamCancel(UGCFileWriteStreamHandle_t  writeHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::FilePersisted(char * pchFile)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int64  ISteamRemoteStorageStandIn::GetFileTimestamp(char * pchFile)
+{
+  standinLatency();
+  return StandInDefault<int64>::value();
+}
+
+ERemoteStoragePlatform  ISteamRemoteStorageStandIn::GetSyncPlatforms(char * pchFile)
+{
+  standinLatency();
+  return StandInDefault<ERemoteStoragePlatform>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::IsCloudEnabledForAccount()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::IsCloudEnabledForApp()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamRemoteStorageStandIn::SetCloudEnabledForApp(bool  bEnabled)
+{
+  standinLatency();
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::UGCDownload(UGCHandle_t  hContent, uint32  unPriority)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamRemoteStorageStandIn::GetUGCDownloadProgress(UGCHandle_t  hContent, int32 * pnBytesDownloaded, int32 * pnBytesExpected)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::GetUGCDetails(UGCHandle_t  hContent, AppId_t * pnAppID, char ** ppchName, int32 * pnFileSizeInBytes, CSteamID * pSteamIDOwner)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int32  ISteamRemoteStorageStandIn::UGCRead(UGCHandle_t  hContent, void * pvData, int32  cubDataToRead, uint32  cOffset, EUGCReadAction  eAction)
+{
+  standinLatency();
+  return StandInDefault<int32>::value();
+}
+
+int32  ISteamRemoteStorageStandIn::GetCachedUGCCount()
+{
+  standinLatency();
+  return StandInDefault<int32>::value();
+}
+
+UGCHandle_t  ISteamRemoteStorageStandIn::GetCachedUGCHandle(int32  iCachedContent)
+{
+  standinLatency();
+  return StandInDefault<UGCHandle_t>::value();
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::PublishWorkshopFile(char * pchFile, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags, EWorkshopFileType  eWorkshopFileType)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+PublishedFileUpdateHandle_t  ISteamRemoteStorageStandIn::CreatePublishedFileUpdateRequest(PublishedFileId_t  unPublishedFileId)
+{
+  standinLatency();
+  return StandInDefault<PublishedFileUpdateHandle_t>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::UpdatePublishedFileFile(PublishedFileUpdateHandle_t  updateHandle, char * pchFile)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::UpdatePublishedFilePreviewFile(PublishedFileUpdateHandle_t  updateHandle, char * pchPreviewFile)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::UpdatePublishedFileTitle(PublishedFileUpdateHandle_t  updateHandle, char * pchTitle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::UpdatePublishedFileDescription(PublishedFileUpdateHandle_t  updateHandle, char * pchDescription)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::UpdatePublishedFileVisibility(PublishedFileUpdateHandle_t  updateHandle, ERemoteStoragePublishedFileVisibility  eVisibility)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamRemoteStorageStandIn::UpdatePublishedFileTags(PublishedFileUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::CommitPublishedFileUpdate(PublishedFileUpdateHandle_t  updateHandle)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::GetPublishedFileDetails(PublishedFileId_t  unPublishedFileId, uint32  unMaxSecondsOld)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::DeletePublishedFile(PublishedFileId_t  unPublishedFileId)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::EnumerateUserPublishedFiles(uint32  unStartIndex)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::SubscribePublishedFile(PublishedFileId_t  unPublishedFileId)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::EnumerateUserSubscribedFiles(uint32  unStartIndex)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::UnsubscribePublishedFile(PublishedFileId_t  unPublishedFileId)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamRemoteStorageStandIn::UpdatePublishedFileSetChangeDescription(PublishedFileUpdateHandle_t  updateHandle, char * pchChangeDescription)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::GetPublishedItemVoteDetails(PublishedFileId_t  unPublishedFileId)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::UpdateUserPublishedItemVote(PublishedFileId_t  unPublishedFileId, bool  bVoteUp)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::GetUserPublishedItemVoteDetails(PublishedFileId_t  unPublishedFileId)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::EnumerateUserSharedWorkshopFiles(CSteamID  steamId, uint32  unStartIndex, SteamParamStringArray_t * pRequiredTags, SteamParamStringArray_t * pExcludedTags)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::PublishVideo(EWorkshopVideoProvider  eVideoProvider, char * pchVideoAccount, char * pchVideoIdentifier, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::SetUserPublishedFileAction(PublishedFileId_t  unPublishedFileId, EWorkshopFileAction  eAction)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::EnumeratePublishedFilesByUserAction(EWorkshopFileAction  eAction, uint32  unStartIndex)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::EnumeratePublishedWorkshopFiles(EWorkshopEnumerationType  eEnumerationType, uint32  unStartIndex, uint32  unCount, uint32  unDays, SteamParamStringArray_t * pTags, SteamParamStringArray_t * pUserTags)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamRemoteStorageStandIn::UGCDownloadToLocation(UGCHandle_t  hContent, char * pchLocation, uint32  unPriority)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+ScreenshotHandle  ISteamScreenshotsStandIn::WriteScreenshot(void * pubRGB, uint32  cubRGB, int  nWidth, int  nHeight)
+{
+  standinLatency();
+  return StandInDefault<ScreenshotHandle>::value();
+}
+
+ScreenshotHandle  ISteamScreenshotsStandIn::AddScreenshotToLibrary(char * pchFilename, char * pchThumbnailFilename, int  nWidth, int  nHeight)
+{
+  standinLatency();
+  return StandInDefault<ScreenshotHandle>::value();
+}
+
+void  ISteamScreenshotsStandIn::TriggerScreenshot()
+{
+  standinLatency();
+}
+
+void  ISteamScreenshotsStandIn::HookScreenshots(bool  bHook)
+{
+  standinLatency();
+}
+
+bool  ISteamScreenshotsStandIn::SetLocation(ScreenshotHandle  hScreenshot, char * pchLocation)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamScreenshotsStandIn::TagUser(ScreenshotHandle  hScreenshot, CSteamID  steamID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamScreenshotsStandIn::TagPublishedFile(ScreenshotHandle  hScreenshot, PublishedFileId_t  unPublishedFileID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamScreenshotsStandIn::IsScreenshotsHooked()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+ScreenshotHandle  ISteamScreenshotsStandIn::AddVRScreenshotToLibrary(EVRScreenshotType  eType, char * pchFilename, char * pchVRFilename)
+{
+  standinLatency();
+  return StandInDefault<ScreenshotHandle>::value();
+}
+
+UGCQueryHandle_t  ISteamUGCStandIn::CreateQueryUserUGCRequest(AccountID_t  unAccountID, EUserUGCList  eListType, EUGCMatchingUGCType  eMatchingUGCType, EUserUGCListSortOrder  eSortOrder, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
+{
+  standinLatency();
+  return StandInDefault<UGCQueryHandle_t>::value();
+}
+
+UGCQueryHandle_t  ISteamUGCStandIn::CreateQueryAllUGCRequest(EUGCQuery  eQueryType, EUGCMatchingUGCType  eMatchingeMatchingUGCTypeFileType, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
+{
+  standinLatency();
+  return StandInDefault<UGCQueryHandle_t>::value();
+}
+
+UGCQueryHandle_t  ISteamUGCStandIn::CreateQueryUGCDetailsRequest(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
+{
+  standinLatency();
+  return StandInDefault<UGCQueryHandle_t>::value();
+}
+
+SteamAPICall_t  ISteamUGCStandIn::SendQueryUGCRequest(UGCQueryHandle_t  handle)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamUGCStandIn::GetQueryUGCResult(UGCQueryHandle_t  handle, uint32  index, SteamUGCDetails_t * pDetails)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::GetQueryUGCPreviewURL(UGCQueryHandle_t  handle, uint32  index, char * pchURL, uint32  cchURLSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::GetQueryUGCMetadata(UGCQueryHandle_t  handle, uint32  index, char * pchMetadata, uint32  cchMetadatasize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::GetQueryUGCChildren(UGCQueryHandle_t  handle, uint32  index, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::GetQueryUGCStatistic(UGCQueryHandle_t  handle, uint32  index, EItemStatistic  eStatType, uint64 * pStatValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint32  ISteamUGCStandIn::GetQueryUGCNumAdditionalPreviews(UGCQueryHandle_t  handle, uint32  index)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamUGCStandIn::GetQueryUGCAdditionalPreview(UGCQueryHandle_t  handle, uint32  index, uint32  previewIndex, char * pchURLOrVideoID, uint32  cchURLSize, char * pchOriginalFileName, uint32  cchOriginalFileNameSize, EItemPreviewType * pPreviewType)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint32  ISteamUGCStandIn::GetQueryUGCNumKeyValueTags(UGCQueryHandle_t  handle, uint32  index)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamUGCStandIn::GetQueryUGCKeyValueTag(UGCQueryHandle_t  handle, uint32  index, uint32  keyValueTagIndex, char * pchKey, uint32  cchKeySize, char * pchValue, uint32  cchValueSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::ReleaseQueryUGCRequest(UGCQueryHandle_t  handle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::AddRequiredTag(UGCQueryHandle_t  handle, char * pTagName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::AddExcludedTag(UGCQueryHandle_t  handle, char * pTagName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetReturnOnlyIDs(UGCQueryHandle_t  handle, bool  bReturnOnlyIDs)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetReturnKeyValueTags(UGCQueryHandle_t  handle, bool  bReturnKeyValueTags)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetReturnLongDescription(UGCQueryHandle_t  handle, bool  bReturnLongDescription)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetReturnMetadata(UGCQueryHandle_t  handle, bool  bReturnMetadata)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetReturnChildren(UGCQueryHandle_t  handle, bool  bReturnChildren)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetReturnAdditionalPreviews(UGCQueryHandle_t  handle, bool  bReturnAdditionalPreviews)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetReturnTotalOnly(UGCQueryHandle_t  handle, bool  bReturnTotalOnly)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetLanguage(UGCQueryHandle_t  handle, char * pchLanguage)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetAllowCachedResponse(UGCQueryHandle_t  handle, uint32  unMaxAgeSeconds)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetCloudFileNameFilter(UGCQueryHandle_t  handle, char * pMatchCloudFileName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetMatchAnyTag(UGCQueryHandle_t  handle, bool  bMatchAnyTag)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetSearchText(UGCQueryHandle_t  handle, char * pSearchText)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetRankedByTrendDays(UGCQueryHandle_t  handle, uint32  unDays)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::AddRequiredKeyValueTag(UGCQueryHandle_t  handle, char * pKey, char * pValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamUGCStandIn::RequestUGCDetails(PublishedFileId_t  nPublishedFileID, uint32  unMaxAgeSeconds)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::CreateItem(AppId_t  nConsumerAppId, EWorkshopFileType  eFileType)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+UGCUpdateHandle_t  ISteamUGCStandIn::StartItemUpdate(AppId_t  nConsumerAppId, PublishedFileId_t  nPublishedFileID)
+{
+  standinLatency();
+  return StandInDefault<UGCUpdateHandle_t>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemTitle(UGCUpdateHandle_t  handle, char * pchTitle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemDescription(UGCUpdateHandle_t  handle, char * pchDescription)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemUpdateLanguage(UGCUpdateHandle_t  handle, char * pchLanguage)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemMetadata(UGCUpdateHandle_t  handle, char * pchMetaData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemVisibility(UGCUpdateHandle_t  handle, ERemoteStoragePublishedFileVisibility  eVisibility)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemTags(UGCUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemContent(UGCUpdateHandle_t  handle, char * pszContentFolder)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::SetItemPreview(UGCUpdateHandle_t  handle, char * pszPreviewFile)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::RemoveItemKeyValueTags(UGCUpdateHandle_t  handle, char * pchKey)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::AddItemKeyValueTag(UGCUpdateHandle_t  handle, char * pchKey, char * pchValue)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::AddItemPreviewFile(UGCUpdateHandle_t  handle, char * pszPreviewFile, EItemPreviewType  type)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::AddItemPreviewVideo(UGCUpdateHandle_t  handle, char * pszVideoID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::UpdateItemPreviewFile(UGCUpdateHandle_t  handle, uint32  index, char * pszPreviewFile)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::UpdateItemPreviewVideo(UGCUpdateHandle_t  handle, uint32  index, char * pszVideoID)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::RemoveItemPreview(UGCUpdateHandle_t  handle, uint32  index)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamUGCStandIn::SubmitItemUpdate(UGCUpdateHandle_t  handle, char * pchChangeNote)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+EItemUpdateStatus  ISteamUGCStandIn::GetItemUpdateProgress(UGCUpdateHandle_t  handle, uint64 * punBytesProcessed, uint64 * punBytesTotal)
+{
+  standinLatency();
+  return StandInDefault<EItemUpdateStatus>::value();
+}
+
+SteamAPICall_t  ISteamUGCStandIn::SetUserItemVote(PublishedFileId_t  nPublishedFileID, bool  bVoteUp)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::GetUserItemVote(PublishedFileId_t  nPublishedFileID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::AddItemToFavorites(AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::RemoveItemFromFavorites(AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::SubscribeItem(PublishedFileId_t  nPublishedFileID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::UnsubscribeItem(PublishedFileId_t  nPublishedFileID)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+uint32  ISteamUGCStandIn::GetNumSubscribedItems()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+uint32  ISteamUGCStandIn::GetSubscribedItems(PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+uint32  ISteamUGCStandIn::GetItemState(PublishedFileId_t  nPublishedFileID)
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamUGCStandIn::GetItemInstallInfo(PublishedFileId_t  nPublishedFileID, uint64 * punSizeOnDisk, char * pchFolder, uint32  cchFolderSize, uint32 * punTimeStamp)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::GetItemDownloadInfo(PublishedFileId_t  nPublishedFileID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::DownloadItem(PublishedFileId_t  nPublishedFileID, bool  bHighPriority)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUGCStandIn::BInitWorkshopForGameServer(DepotId_t  unWorkshopDepotID, char * pszFolder)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamUGCStandIn::SuspendDownloads(bool  bSuspend)
+{
+  standinLatency();
+}
+
+SteamAPICall_t  ISteamUGCStandIn::StartPlaytimeTracking(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::StopPlaytimeTracking(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUGCStandIn::StopPlaytimeTrackingForAllItems()
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+ClientUnifiedMessageHandle  ISteamUnifiedMessagesStandIn::SendMethod(char * pchServiceMethod, void * pRequestBuffer, uint32  unRequestBufferSize, uint64  unContext)
+{
+  standinLatency();
+  return StandInDefault<ClientUnifiedMessageHandle>::value();
+}
+
+bool  ISteamUnifiedMessagesStandIn::GetMethodResponseInfo(ClientUnifiedMessageHandle  hHandle, uint32 * punResponseSize, EResult * peResult)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUnifiedMessagesStandIn::GetMethodResponseData(ClientUnifiedMessageHandle  hHandle, void * pResponseBuffer, uint32  unResponseBufferSize, bool  bAutoRelease)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUnifiedMessagesStandIn::ReleaseMethod(ClientUnifiedMessageHandle  hHandle)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUnifiedMessagesStandIn::SendNotification(char * pchServiceNotification, void * pNotificationBuffer, uint32  unNotificationBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+HSteamUser  ISteamUserStandIn::GetHSteamUser()
+{
+  standinLatency();
+  return 1;
+}
+
+bool  ISteamUserStandIn::BLoggedOn()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+CSteamID  ISteamUserStandIn::GetSteamID()
+{
+  standinLatency();
+  return standinSteamID();
+}
+
+int  ISteamUserStandIn::InitiateGameConnection(void * pAuthBlob, int  cbMaxAuthBlob, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer, bool  bSecure)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+void  ISteamUserStandIn::TerminateGameConnection(uint32  unIPServer, uint16  usPortServer)
+{
+  standinLatency();
+}
+
+void  ISteamUserStandIn::TrackAppUsageEvent(CGameID  gameID, int  eAppUsageEvent, char * pchExtraInfo)
+{
+  standinLatency();
+}
+
+bool  ISteamUserStandIn::GetUserDataFolder(char * pchBuffer, int  cubBuffer)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamUserStandIn::StartVoiceRecording()
+{
+  standinLatency();
+}
+
+void  ISteamUserStandIn::StopVoiceRecording()
+{
+  standinLatency();
+}
+
+EVoiceResult  ISteamUserStandIn::GetAvailableVoice(uint32 * pcbCompressed, uint32 * pcbUncompressed, uint32  nUncompressedVoiceDesiredSampleRate)
+{
+  standinLatency();
+  return StandInDefault<EVoiceResult>::value();
+}
+
+EVoiceResult  ISteamUserStandIn::GetVoice(bool  bWantCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, bool  bWantUncompressed, void * pUncompressedDestBuffer, uint32  cbUncompressedDestBufferSize, uint32 * nUncompressBytesWritten, uint32  nUncompressedVoiceDesiredSampleRate)
+{
+  standinLatency();
+  return StandInDefault<EVoiceResult>::value();
+}
+
+EVoiceResult  ISteamUserStandIn::DecompressVoice(void * pCompressed, uint32  cbCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, uint32  nDesiredSampleRate)
+{
+  standinLatency();
+  return StandInDefault<EVoiceResult>::value();
+}
+
+uint32  ISteamUserStandIn::GetVoiceOptimalSampleRate()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+HAuthTicket  ISteamUserStandIn::GetAuthSessionTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
+{
+  standinLatency();
+  return StandInDefault<HAuthTicket>::value();
+}
+
+EBeginAuthSessionResult  ISteamUserStandIn::BeginAuthSession(void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
+{
+  standinLatency();
+  return StandInDefault<EBeginAuthSessionResult>::value();
+}
+
+void  ISteamUserStandIn::EndAuthSession(CSteamID  steamID)
+{
+  standinLatency();
+}
+
+void  ISteamUserStandIn::CancelAuthTicket(HAuthTicket  hAuthTicket)
+{
+  standinLatency();
+}
+
+EUserHasLicenseForAppResult  ISteamUserStandIn::UserHasLicenseForApp(CSteamID  steamID, AppId_t  appID)
+{
+  standinLatency();
+  return StandInDefault<EUserHasLicenseForAppResult>::value();
+}
+
+bool  ISteamUserStandIn::BIsBehindNAT()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamUserStandIn::AdvertiseGame(CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer)
+{
+  standinLatency();
+}
+
+SteamAPICall_t  ISteamUserStandIn::RequestEncryptedAppTicket(void * pDataToInclude, int  cbDataToInclude)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamUserStandIn::GetEncryptedAppTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamUserStandIn::GetGameBadgeLevel(int  nSeries, bool  bFoil)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+int  ISteamUserStandIn::GetPlayerSteamLevel()
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+SteamAPICall_t  ISteamUserStandIn::RequestStoreAuthURL(char * pchRedirectURL)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamUserStandIn::BIsPhoneVerified()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStandIn::BIsTwoFactorEnabled()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStandIn::BIsPhoneIdentifying()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStandIn::BIsPhoneRequiringVerification()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::RequestCurrentStats()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetStat(char * pchName, int32 * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetStat(char * pchName, float * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::SetStat(char * pchName, int32  nData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::SetStat(char * pchName, float  fData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::UpdateAvgRateStat(char * pchName, float  flCountThisSession, double  dSessionLength)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetAchievement(char * pchName, bool * pbAchieved)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::SetAchievement(char * pchName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::ClearAchievement(char * pchName)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetAchievementAndUnlockTime(char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::StoreStats()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int  ISteamUserStatsStandIn::GetAchievementIcon(char * pchName)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+char * ISteamUserStatsStandIn::GetAchievementDisplayAttribute(char * pchName, char * pchKey)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamUserStatsStandIn::IndicateAchievementProgress(char * pchName, uint32  nCurProgress, uint32  nMaxProgress)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint32  ISteamUserStatsStandIn::GetNumAchievements()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+char * ISteamUserStatsStandIn::GetAchievementName(uint32  iAchievement)
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+SteamAPICall_t  ISteamUserStatsStandIn::RequestUserStats(CSteamID  steamIDUser)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamUserStatsStandIn::GetUserStat(CSteamID  steamIDUser, char * pchName, int32 * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetUserStat(CSteamID  steamIDUser, char * pchName, float * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetUserAchievement(CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetUserAchievementAndUnlockTime(CSteamID  steamIDUser, char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::ResetAllStats(bool  bAchievementsToo)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamUserStatsStandIn::DownloadLeaderboardEntriesForUsers(SteamLeaderboard_t  hSteamLeaderboard, CSteamID * prgUsers, int  cUsers)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUserStatsStandIn::AttachLeaderboardUGC(SteamLeaderboard_t  hSteamLeaderboard, UGCHandle_t  hUGC)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUserStatsStandIn::GetNumberOfCurrentPlayers()
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+SteamAPICall_t  ISteamUserStatsStandIn::RequestGlobalAchievementPercentages()
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+int  ISteamUserStatsStandIn::GetMostAchievedAchievementInfo(char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+int  ISteamUserStatsStandIn::GetNextMostAchievedAchievementInfo(int  iIteratorPrevious, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
+{
+  standinLatency();
+  return StandInDefault<int>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetAchievementAchievedPercent(char * pchName, float * pflPercent)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamUserStatsStandIn::RequestGlobalStats(int  nHistoryDays)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamUserStatsStandIn::GetGlobalStat(char * pchStatName, int64 * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUserStatsStandIn::GetGlobalStat(char * pchStatName, double * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int32  ISteamUserStatsStandIn::GetGlobalStatHistory(char * pchStatName, int64 * pData, uint32  cubData)
+{
+  standinLatency();
+  return StandInDefault<int32>::value();
+}
+
+int32  ISteamUserStatsStandIn::GetGlobalStatHistory(char * pchStatName, double * pData, uint32  cubData)
+{
+  standinLatency();
+  return StandInDefault<int32>::value();
+}
+
+uint32  ISteamUtilsStandIn::GetSecondsSinceAppActive()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+uint32  ISteamUtilsStandIn::GetSecondsSinceComputerActive()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+EUniverse  ISteamUtilsStandIn::GetConnectedUniverse()
+{
+  standinLatency();
+  return StandInDefault<EUniverse>::value();
+}
+
+uint32  ISteamUtilsStandIn::GetServerRealTime()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+char * ISteamUtilsStandIn::GetIPCountry()
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamUtilsStandIn::GetImageSize(int  iImage, uint32 * pnWidth, uint32 * pnHeight)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUtilsStandIn::GetImageRGBA(int  iImage, uint8 * pubDest, int  nDestBufferSize)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUtilsStandIn::GetCSERIPPort(uint32 * unIP, uint16 * usPort)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint8  ISteamUtilsStandIn::GetCurrentBatteryPower()
+{
+  standinLatency();
+  return StandInDefault<uint8>::value();
+}
+
+uint32  ISteamUtilsStandIn::GetAppID()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+void  ISteamUtilsStandIn::SetOverlayNotificationPosition(ENotificationPosition  eNotificationPosition)
+{
+  standinLatency();
+}
+
+ESteamAPICallFailure  ISteamUtilsStandIn::GetAPICallFailureReason(SteamAPICall_t  hSteamAPICall)
+{
+  standinLatency();
+  return StandInDefault<ESteamAPICallFailure>::value();
+}
+
+void  ISteamUtilsStandIn::RunFrame()
+{
+  standinLatency();
+}
+
+uint32  ISteamUtilsStandIn::GetIPCCallCount()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+void  ISteamUtilsStandIn::SetWarningMessageHook(SteamAPIWarningMessageHook_t  pFunction)
+{
+  standinLatency();
+}
+
+bool  ISteamUtilsStandIn::IsOverlayEnabled()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  ISteamUtilsStandIn::BOverlayNeedsPresent()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+SteamAPICall_t  ISteamUtilsStandIn::CheckFileSignature(char * szFileName)
+{
+  standinLatency();
+  return standinCallResult(NULL, 0, 0);
+}
+
+bool  ISteamUtilsStandIn::ShowGamepadTextInput(EGamepadTextInputMode  eInputMode, EGamepadTextInputLineMode  eLineInputMode, char * pchDescription, uint32  unCharMax, char * pchExistingText)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+uint32  ISteamUtilsStandIn::GetEnteredGamepadTextLength()
+{
+  standinLatency();
+  return StandInDefault<uint32>::value();
+}
+
+bool  ISteamUtilsStandIn::GetEnteredGamepadTextInput(char * pchText, uint32  cchText)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+char * ISteamUtilsStandIn::GetSteamUILanguage()
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+bool  ISteamUtilsStandIn::IsSteamRunningInVR()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamUtilsStandIn::SetOverlayNotificationInset(int  nHorizontalInset, int  nVerticalInset)
+{
+  standinLatency();
+}
+
+bool  ISteamUtilsStandIn::IsSteamInBigPictureMode()
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+void  ISteamUtilsStandIn::StartVRDashboard()
+{
+  standinLatency();
+}
+
+void  ISteamVideoStandIn::GetVideoURL(AppId_t  unVideoAppID)
+{
+  standinLatency();
+}
+
+bool  ISteamVideoStandIn::IsBroadcasting(int * pnNumViewers)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+
+void  standin_SteamAPI_WriteMiniDump(uint32  uStructuredExceptionCode, void * pvExceptionInfo, uint32  uBuildID) STANDIN_EXPORT(SteamAPI_WriteMiniDump);
+void  standin_SteamAPI_WriteMiniDump(uint32  uStructuredExceptionCode, void * pvExceptionInfo, uint32  uBuildID)
+{
+  standinLatency();
+}
+
+void  standin_SteamAPI_SetMiniDumpComment(char * pchMsg) STANDIN_EXPORT(SteamAPI_SetMiniDumpComment);
+void  standin_SteamAPI_SetMiniDumpComment(char * pchMsg)
+{
+  standinLatency();
+}
+
+void  standin_Steam_RegisterInterfaceFuncs(void * hModule) STANDIN_EXPORT(Steam_RegisterInterfaceFuncs);
+void  standin_Steam_RegisterInterfaceFuncs(void * hModule)
+{
+  standinLatency();
+}
+
+HSteamUser  standin_Steam_GetHSteamUserCurrent() STANDIN_EXPORT(Steam_GetHSteamUserCurrent);
+HSteamUser  standin_Steam_GetHSteamUserCurrent()
+{
+  standinLatency();
+  return 1;
+}
+
+char * standin_SteamAPI_GetSteamInstallPath() STANDIN_EXPORT(SteamAPI_GetSteamInstallPath);
+char * standin_SteamAPI_GetSteamInstallPath()
+{
+  standinLatency();
+  return StandInDefault<char *>::value();
+}
+
+HSteamPipe  standin_SteamAPI_GetHSteamPipe() STANDIN_EXPORT(SteamAPI_GetHSteamPipe);
+HSteamPipe  standin_SteamAPI_GetHSteamPipe()
+{
+  standinLatency();
+  return 1;
+}
+
+void  standin_SteamAPI_SetTryCatchCallbacks(bool  bTryCatchCallbacks) STANDIN_EXPORT(SteamAPI_SetTryCatchCallbacks);
+void  standin_SteamAPI_SetTryCatchCallbacks(bool  bTryCatchCallbacks)
+{
+  standinLatency();
+}
+
+HSteamPipe  standin_GetHSteamPipe() STANDIN_EXPORT(GetHSteamPipe);
+HSteamPipe  standin_GetHSteamPipe()
+{
+  standinLatency();
+  return 1;
+}
+
+HSteamUser  standin_GetHSteamUser() STANDIN_EXPORT(GetHSteamUser);
+HSteamUser  standin_GetHSteamUser()
+{
+  standinLatency();
+  return 1;
+}
+
+HSteamUser  standin_SteamAPI_GetHSteamUser() STANDIN_EXPORT(SteamAPI_GetHSteamUser);
+HSteamUser  standin_SteamAPI_GetHSteamUser()
+{
+  standinLatency();
+  return 1;
+}
+
+void  standin_SteamAPI_UseBreakpadCrashHandler(char const * pchVersion, char const * pchDate, char const * pchTime, bool  bFullMemoryDumps, void * pvContext, PFNPreMinidumpCallback  m_pfnPreMinidumpCallback) STANDIN_EXPORT(SteamAPI_UseBreakpadCrashHandler);
+void  standin_SteamAPI_UseBreakpadCrashHandler(char const * pchVersion, char const * pchDate, char const * pchTime, bool  bFullMemoryDumps, void * pvContext, PFNPreMinidumpCallback  m_pfnPreMinidumpCallback)
+{
+  standinLatency();
+}
+
+void  standin_SteamAPI_SetBreakpadAppID(uint32  unAppID) STANDIN_EXPORT(SteamAPI_SetBreakpadAppID);
+void  standin_SteamAPI_SetBreakpadAppID(uint32  unAppID)
+{
+  standinLatency();
+}
+
+HSteamPipe  standin_SteamAPI_ISteamClient_CreateSteamPipe(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamClient_CreateSteamPipe);
+HSteamPipe  standin_SteamAPI_ISteamClient_CreateSteamPipe(intptr_t  instancePtr)
+{
+  return StandInResult<HSteamPipe>::of(((ISteamClientStandIn *)instancePtr)->CreateSteamPipe());
+}
+
+bool  standin_SteamAPI_ISteamClient_BReleaseSteamPipe(intptr_t  instancePtr, HSteamPipe  hSteamPipe) STANDIN_EXPORT(SteamAPI_ISteamClient_BReleaseSteamPipe);
+bool  standin_SteamAPI_ISteamClient_BReleaseSteamPipe(intptr_t  instancePtr, HSteamPipe  hSteamPipe)
+{
+  return StandInResult<bool>::of(((ISteamClientStandIn *)instancePtr)->BReleaseSteamPipe(hSteamPipe));
+}
+
+HSteamUser  standin_SteamAPI_ISteamClient_ConnectToGlobalUser(intptr_t  instancePtr, HSteamPipe  hSteamPipe) STANDIN_EXPORT(SteamAPI_ISteamClient_ConnectToGlobalUser);
+HSteamUser  standin_SteamAPI_ISteamClient_ConnectToGlobalUser(intptr_t  instancePtr, HSteamPipe  hSteamPipe)
+{
+  return StandInResult<HSteamUser>::of(((ISteamClientStandIn *)instancePtr)->ConnectToGlobalUser(hSteamPipe));
+}
+
+HSteamUser  standin_SteamAPI_ISteamClient_CreateLocalUser(intptr_t  instancePtr, HSteamPipe * phSteamPipe, EAccountType  eAccountType) STANDIN_EXPORT(SteamAPI_ISteamClient_CreateLocalUser);
+HSteamUser  standin_SteamAPI_ISteamClient_CreateLocalUser(intptr_t  instancePtr, HSteamPipe * phSteamPipe, EAccountType  eAccountType)
+{
+  return StandInResult<HSteamUser>::of(((ISteamClientStandIn *)instancePtr)->CreateLocalUser(phSteamPipe, eAccountType));
+}
+
+void  standin_SteamAPI_ISteamClient_ReleaseUser(intptr_t  instancePtr, HSteamPipe  hSteamPipe, HSteamUser  hUser) STANDIN_EXPORT(SteamAPI_ISteamClient_ReleaseUser);
+void  standin_SteamAPI_ISteamClient_ReleaseUser(intptr_t  instancePtr, HSteamPipe  hSteamPipe, HSteamUser  hUser)
+{
+  ((ISteamClientStandIn *)instancePtr)->ReleaseUser(hSteamPipe, hUser);
+}
+
+ISteamUser * standin_SteamAPI_ISteamClient_GetISteamUser(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamUser);
+ISteamUser * standin_SteamAPI_ISteamClient_GetISteamUser(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamUser *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamUser(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamGameServer * standin_SteamAPI_ISteamClient_GetISteamGameServer(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamGameServer);
+ISteamGameServer * standin_SteamAPI_ISteamClient_GetISteamGameServer(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamGameServer *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamGameServer(hSteamUser, hSteamPipe, pchVersion));
+}
+
+void  standin_SteamAPI_ISteamClient_SetLocalIPBinding(intptr_t  instancePtr, uint32  unIP, uint16  usPort) STANDIN_EXPORT(SteamAPI_ISteamClient_SetLocalIPBinding);
+void  standin_SteamAPI_ISteamClient_SetLocalIPBinding(intptr_t  instancePtr, uint32  unIP, uint16  usPort)
+{
+  ((ISteamClientStandIn *)instancePtr)->SetLocalIPBinding(unIP, usPort);
+}
+
+ISteamFriends * standin_SteamAPI_ISteamClient_GetISteamFriends(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamFriends);
+ISteamFriends * standin_SteamAPI_ISteamClient_GetISteamFriends(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamFriends *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamFriends(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamUtils * standin_SteamAPI_ISteamClient_GetISteamUtils(intptr_t  instancePtr, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamUtils);
+ISteamUtils * standin_SteamAPI_ISteamClient_GetISteamUtils(intptr_t  instancePtr, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamUtils *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamUtils(hSteamPipe, pchVersion));
+}
+
+ISteamMatchmaking * standin_SteamAPI_ISteamClient_GetISteamMatchmaking(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamMatchmaking);
+ISteamMatchmaking * standin_SteamAPI_ISteamClient_GetISteamMatchmaking(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamMatchmaking *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamMatchmaking(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamMatchmakingServers * standin_SteamAPI_ISteamClient_GetISteamMatchmakingServers(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamMatchmakingServers);
+ISteamMatchmakingServers * standin_SteamAPI_ISteamClient_GetISteamMatchmakingServers(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamMatchmakingServers *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamMatchmakingServers(hSteamUser, hSteamPipe, pchVersion));
+}
+
+void * standin_SteamAPI_ISteamClient_GetISteamGenericInterface(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamGenericInterface);
+void * standin_SteamAPI_ISteamClient_GetISteamGenericInterface(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<void *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamGenericInterface(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamUserStats * standin_SteamAPI_ISteamClient_GetISteamUserStats(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamUserStats);
+ISteamUserStats * standin_SteamAPI_ISteamClient_GetISteamUserStats(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamUserStats *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamUserStats(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamGameServerStats * standin_SteamAPI_ISteamClient_GetISteamGameServerStats(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamGameServerStats);
+ISteamGameServerStats * standin_SteamAPI_ISteamClient_GetISteamGameServerStats(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamGameServerStats *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamGameServerStats(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamApps * standin_SteamAPI_ISteamClient_GetISteamApps(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamApps);
+ISteamApps * standin_SteamAPI_ISteamClient_GetISteamApps(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamApps *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamApps(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamNetworking * standin_SteamAPI_ISteamClient_GetISteamNetworking(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamNetworking);
+ISteamNetworking * standin_SteamAPI_ISteamClient_GetISteamNetworking(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamNetworking *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamNetworking(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamRemoteStorage * standin_SteamAPI_ISteamClient_GetISteamRemoteStorage(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamRemoteStorage);
+ISteamRemoteStorage * standin_SteamAPI_ISteamClient_GetISteamRemoteStorage(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamRemoteStorage *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamRemoteStorage(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamScreenshots * standin_SteamAPI_ISteamClient_GetISteamScreenshots(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamScreenshots);
+ISteamScreenshots * standin_SteamAPI_ISteamClient_GetISteamScreenshots(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamScreenshots *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamScreenshots(hSteamuser, hSteamPipe, pchVersion));
+}
+
+uint32  standin_SteamAPI_ISteamClient_GetIPCCallCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamClient_GetIPCCallCount);
+uint32  standin_SteamAPI_ISteamClient_GetIPCCallCount(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamClientStandIn *)instancePtr)->GetIPCCallCount());
+}
+
+void  standin_SteamAPI_ISteamClient_SetWarningMessageHook(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction) STANDIN_EXPORT(SteamAPI_ISteamClient_SetWarningMessageHook);
+void  standin_SteamAPI_ISteamClient_SetWarningMessageHook(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction)
+{
+  ((ISteamClientStandIn *)instancePtr)->SetWarningMessageHook(pFunction);
+}
+
+bool  standin_SteamAPI_ISteamClient_BShutdownIfAllPipesClosed(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamClient_BShutdownIfAllPipesClosed);
+bool  standin_SteamAPI_ISteamClient_BShutdownIfAllPipesClosed(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamClientStandIn *)instancePtr)->BShutdownIfAllPipesClosed());
+}
+
+ISteamHTTP * standin_SteamAPI_ISteamClient_GetISteamHTTP(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamHTTP);
+ISteamHTTP * standin_SteamAPI_ISteamClient_GetISteamHTTP(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamHTTP *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamHTTP(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamUnifiedMessages * standin_SteamAPI_ISteamClient_GetISteamUnifiedMessages(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamUnifiedMessages);
+ISteamUnifiedMessages * standin_SteamAPI_ISteamClient_GetISteamUnifiedMessages(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamUnifiedMessages *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamUnifiedMessages(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamController * standin_SteamAPI_ISteamClient_GetISteamController(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamController);
+ISteamController * standin_SteamAPI_ISteamClient_GetISteamController(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamController *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamController(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamUGC * standin_SteamAPI_ISteamClient_GetISteamUGC(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamUGC);
+ISteamUGC * standin_SteamAPI_ISteamClient_GetISteamUGC(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamUGC *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamUGC(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamAppList * standin_SteamAPI_ISteamClient_GetISteamAppList(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamAppList);
+ISteamAppList * standin_SteamAPI_ISteamClient_GetISteamAppList(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamAppList *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamAppList(hSteamUser, hSteamPipe, pchVersion));
+}
+
+ISteamMusic * standin_SteamAPI_ISteamClient_GetISteamMusic(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamMusic);
+ISteamMusic * standin_SteamAPI_ISteamClient_GetISteamMusic(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamMusic *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamMusic(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamMusicRemote * standin_SteamAPI_ISteamClient_GetISteamMusicRemote(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamMusicRemote);
+ISteamMusicRemote * standin_SteamAPI_ISteamClient_GetISteamMusicRemote(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamMusicRemote *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamMusicRemote(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamHTMLSurface * standin_SteamAPI_ISteamClient_GetISteamHTMLSurface(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamHTMLSurface);
+ISteamHTMLSurface * standin_SteamAPI_ISteamClient_GetISteamHTMLSurface(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamHTMLSurface *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamHTMLSurface(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamInventory * standin_SteamAPI_ISteamClient_GetISteamInventory(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamInventory);
+ISteamInventory * standin_SteamAPI_ISteamClient_GetISteamInventory(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamInventory *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamInventory(hSteamuser, hSteamPipe, pchVersion));
+}
+
+ISteamVideo * standin_SteamAPI_ISteamClient_GetISteamVideo(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion) STANDIN_EXPORT(SteamAPI_ISteamClient_GetISteamVideo);
+ISteamVideo * standin_SteamAPI_ISteamClient_GetISteamVideo(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
+{
+  return StandInResult<ISteamVideo *>::of(((ISteamClientStandIn *)instancePtr)->GetISteamVideo(hSteamuser, hSteamPipe, pchVersion));
+}
+
+HSteamUser  standin_SteamAPI_ISteamUser_GetHSteamUser(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_GetHSteamUser);
+HSteamUser  standin_SteamAPI_ISteamUser_GetHSteamUser(intptr_t  instancePtr)
+{
+  return StandInResult<HSteamUser>::of(((ISteamUserStandIn *)instancePtr)->GetHSteamUser());
+}
+
+bool  standin_SteamAPI_ISteamUser_BLoggedOn(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_BLoggedOn);
+bool  standin_SteamAPI_ISteamUser_BLoggedOn(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamUserStandIn *)instancePtr)->BLoggedOn());
+}
+
+uint64  standin_SteamAPI_ISteamUser_GetSteamID(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_GetSteamID);
+uint64  standin_SteamAPI_ISteamUser_GetSteamID(intptr_t  instancePtr)
+{
+  return StandInResult<uint64>::of(((ISteamUserStandIn *)instancePtr)->GetSteamID());
+}
+
+int  standin_SteamAPI_ISteamUser_InitiateGameConnection(intptr_t  instancePtr, void * pAuthBlob, int  cbMaxAuthBlob, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer, bool  bSecure) STANDIN_EXPORT(SteamAPI_ISteamUser_InitiateGameConnection);
+int  standin_SteamAPI_ISteamUser_InitiateGameConnection(intptr_t  instancePtr, void * pAuthBlob, int  cbMaxAuthBlob, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer, bool  bSecure)
+{
+  return StandInResult<int>::of(((ISteamUserStandIn *)instancePtr)->InitiateGameConnection(pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure));
+}
+
+void  standin_SteamAPI_ISteamUser_TerminateGameConnection(intptr_t  instancePtr, uint32  unIPServer, uint16  usPortServer) STANDIN_EXPORT(SteamAPI_ISteamUser_TerminateGameConnection);
+void  standin_SteamAPI_ISteamUser_TerminateGameConnection(intptr_t  instancePtr, uint32  unIPServer, uint16  usPortServer)
+{
+  ((ISteamUserStandIn *)instancePtr)->TerminateGameConnection(unIPServer, usPortServer);
+}
+
+void  standin_SteamAPI_ISteamUser_TrackAppUsageEvent(intptr_t  instancePtr, CGameID  gameID, int  eAppUsageEvent, char * pchExtraInfo) STANDIN_EXPORT(SteamAPI_ISteamUser_TrackAppUsageEvent);
+void  standin_SteamAPI_ISteamUser_TrackAppUsageEvent(intptr_t  instancePtr, CGameID  gameID, int  eAppUsageEvent, char * pchExtraInfo)
+{
+  ((ISteamUserStandIn *)instancePtr)->TrackAppUsageEvent(gameID, eAppUsageEvent, pchExtraInfo);
+}
+
+bool  standin_SteamAPI_ISteamUser_GetUserDataFolder(intptr_t  instancePtr, char * pchBuffer, int  cubBuffer) STANDIN_EXPORT(SteamAPI_ISteamUser_GetUserDataFolder);
+bool  standin_SteamAPI_ISteamUser_GetUserDataFolder(intptr_t  instancePtr, char * pchBuffer, int  cubBuffer)
+{
+  return StandInResult<bool>::of(((ISteamUserStandIn *)instancePtr)->GetUserDataFolder(pchBuffer, cubBuffer));
+}
+
+void  standin_SteamAPI_ISteamUser_StartVoiceRecording(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_StartVoiceRecording);
+void  standin_SteamAPI_ISteamUser_StartVoiceRecording(intptr_t  instancePtr)
+{
+  ((ISteamUserStandIn *)instancePtr)->StartVoiceRecording();
+}
+
+void  standin_SteamAPI_ISteamUser_StopVoiceRecording(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_StopVoiceRecording);
+void  standin_SteamAPI_ISteamUser_StopVoiceRecording(intptr_t  instancePtr)
+{
+  ((ISteamUserStandIn *)instancePtr)->StopVoiceRecording();
+}
+
+EVoiceResult  standin_SteamAPI_ISteamUser_GetAvailableVoice(intptr_t  instancePtr, uint32 * pcbCompressed, uint32 * pcbUncompressed, uint32  nUncompressedVoiceDesiredSampleRate) STANDIN_EXPORT(SteamAPI_ISteamUser_GetAvailableVoice);
+EVoiceResult  standin_SteamAPI_ISteamUser_GetAvailableVoice(intptr_t  instancePtr, uint32 * pcbCompressed, uint32 * pcbUncompressed, uint32  nUncompressedVoiceDesiredSampleRate)
+{
+  return StandInResult<EVoiceResult>::of(((ISteamUserStandIn *)instancePtr)->GetAvailableVoice(pcbCompressed, pcbUncompressed, nUncompressedVoiceDesiredSampleRate));
+}
+
+EVoiceResult  standin_SteamAPI_ISteamUser_GetVoice(intptr_t  instancePtr, bool  bWantCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, bool  bWantUncompressed, void * pUncompressedDestBuffer, uint32  cbUncompressedDestBufferSize, uint32 * nUncompressBytesWritten, uint32  nUncompressedVoiceDesiredSampleRate) STANDIN_EXPORT(SteamAPI_ISteamUser_GetVoice);
+EVoiceResult  standin_SteamAPI_ISteamUser_GetVoice(intptr_t  instancePtr, bool  bWantCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, bool  bWantUncompressed, void * pUncompressedDestBuffer, uint32  cbUncompressedDestBufferSize, uint32 * nUncompressBytesWritten, uint32  nUncompressedVoiceDesiredSampleRate)
+{
+  return StandInResult<EVoiceResult>::of(((ISteamUserStandIn *)instancePtr)->GetVoice(bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, bWantUncompressed, pUncompressedDestBuffer, cbUncompressedDestBufferSize, nUncompressBytesWritten, nUncompressedVoiceDesiredSampleRate));
+}
+
+EVoiceResult  standin_SteamAPI_ISteamUser_DecompressVoice(intptr_t  instancePtr, void * pCompressed, uint32  cbCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, uint32  nDesiredSampleRate) STANDIN_EXPORT(SteamAPI_ISteamUser_DecompressVoice);
+EVoiceResult  standin_SteamAPI_ISteamUser_DecompressVoice(intptr_t  instancePtr, void * pCompressed, uint32  cbCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, uint32  nDesiredSampleRate)
+{
+  return StandInResult<EVoiceResult>::of(((ISteamUserStandIn *)instancePtr)->DecompressVoice(pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate));
+}
+
+uint32  standin_SteamAPI_ISteamUser_GetVoiceOptimalSampleRate(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_GetVoiceOptimalSampleRate);
+uint32  standin_SteamAPI_ISteamUser_GetVoiceOptimalSampleRate(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUserStandIn *)instancePtr)->GetVoiceOptimalSampleRate());
+}
+
+HAuthTicket  standin_SteamAPI_ISteamUser_GetAuthSessionTicket(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket) STANDIN_EXPORT(SteamAPI_ISteamUser_GetAuthSessionTicket);
+HAuthTicket  standin_SteamAPI_ISteamUser_GetAuthSessionTicket(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
+{
+  return StandInResult<HAuthTicket>::of(((ISteamUserStandIn *)instancePtr)->GetAuthSessionTicket(pTicket, cbMaxTicket, pcbTicket));
+}
+
+EBeginAuthSessionResult  standin_SteamAPI_ISteamUser_BeginAuthSession(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamUser_BeginAuthSession);
+EBeginAuthSessionResult  standin_SteamAPI_ISteamUser_BeginAuthSession(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
+{
+  return StandInResult<EBeginAuthSessionResult>::of(((ISteamUserStandIn *)instancePtr)->BeginAuthSession(pAuthTicket, cbAuthTicket, steamID));
+}
+
+void  standin_SteamAPI_ISteamUser_EndAuthSession(intptr_t  instancePtr, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamUser_EndAuthSession);
+void  standin_SteamAPI_ISteamUser_EndAuthSession(intptr_t  instancePtr, CSteamID  steamID)
+{
+  ((ISteamUserStandIn *)instancePtr)->EndAuthSession(steamID);
+}
+
+void  standin_SteamAPI_ISteamUser_CancelAuthTicket(intptr_t  instancePtr, HAuthTicket  hAuthTicket) STANDIN_EXPORT(SteamAPI_ISteamUser_CancelAuthTicket);
+void  standin_SteamAPI_ISteamUser_CancelAuthTicket(intptr_t  instancePtr, HAuthTicket  hAuthTicket)
+{
+  ((ISteamUserStandIn *)instancePtr)->CancelAuthTicket(hAuthTicket);
+}
+
+EUserHasLicenseForAppResult  standin_SteamAPI_ISteamUser_UserHasLicenseForApp(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID) STANDIN_EXPORT(SteamAPI_ISteamUser_UserHasLicenseForApp);
+EUserHasLicenseForAppResult  standin_SteamAPI_ISteamUser_UserHasLicenseForApp(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID)
+{
+  return StandInResult<EUserHasLicenseForAppResult>::of(((ISteamUserStandIn *)instancePtr)->UserHasLicenseForApp(steamID, appID));
+}
+
+bool  standin_SteamAPI_ISteamUser_BIsBehindNAT(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_BIsBehindNAT);
+bool  standin_SteamAPI_ISteamUser_BIsBehindNAT(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamUserStandIn *)instancePtr)->BIsBehindNAT());
+}
+
+void  standin_SteamAPI_ISteamUser_AdvertiseGame(intptr_t  instancePtr, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer) STANDIN_EXPORT(SteamAPI_ISteamUser_AdvertiseGame);
+void  standin_SteamAPI_ISteamUser_AdvertiseGame(intptr_t  instancePtr, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer)
+{
+  ((ISteamUserStandIn *)instancePtr)->AdvertiseGame(steamIDGameServer, unIPServer, usPortServer);
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUser_RequestEncryptedAppTicket(intptr_t  instancePtr, void * pDataToInclude, int  cbDataToInclude) STANDIN_EXPORT(SteamAPI_ISteamUser_RequestEncryptedAppTicket);
+SteamAPICall_t  standin_SteamAPI_ISteamUser_RequestEncryptedAppTicket(intptr_t  instancePtr, void * pDataToInclude, int  cbDataToInclude)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStandIn *)instancePtr)->RequestEncryptedAppTicket(pDataToInclude, cbDataToInclude));
+}
+
+bool  standin_SteamAPI_ISteamUser_GetEncryptedAppTicket(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket) STANDIN_EXPORT(SteamAPI_ISteamUser_GetEncryptedAppTicket);
+bool  standin_SteamAPI_ISteamUser_GetEncryptedAppTicket(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
+{
+  return StandInResult<bool>::of(((ISteamUserStandIn *)instancePtr)->GetEncryptedAppTicket(pTicket, cbMaxTicket, pcbTicket));
+}
+
+int  standin_SteamAPI_ISteamUser_GetGameBadgeLevel(intptr_t  instancePtr, int  nSeries, bool  bFoil) STANDIN_EXPORT(SteamAPI_ISteamUser_GetGameBadgeLevel);
+int  standin_SteamAPI_ISteamUser_GetGameBadgeLevel(intptr_t  instancePtr, int  nSeries, bool  bFoil)
+{
+  return StandInResult<int>::of(((ISteamUserStandIn *)instancePtr)->GetGameBadgeLevel(nSeries, bFoil));
+}
+
+int  standin_SteamAPI_ISteamUser_GetPlayerSteamLevel(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUser_GetPlayerSteamLevel);
+int  standin_SteamAPI_ISteamUser_GetPlayerSteamLevel(intptr_t  instancePtr)
+{
+  return StandInResult<int>::of(((ISteamUserStandIn *)instancePtr)->GetPlayerSteamLevel());
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUser_RequestStoreAuthURL(intptr_t  instancePtr, char * pchRedirectURL) STANDIN_EXPORT(SteamAPI_ISteamUser_RequestStoreAuthURL);
+SteamAPICall_t  standin_SteamAPI_ISteamUser_RequestStoreAuthURL(intptr_t  instancePtr, char * pchRedirectURL)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStandIn *)instancePtr)->RequestStoreAuthURL(pchRedirectURL));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetPersonaName(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetPersonaName);
+char * standin_SteamAPI_ISteamFriends_GetPersonaName(intptr_t  instancePtr)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetPersonaName());
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_SetPersonaName(intptr_t  instancePtr, char * pchPersonaName) STANDIN_EXPORT(SteamAPI_ISteamFriends_SetPersonaName);
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_SetPersonaName(intptr_t  instancePtr, char * pchPersonaName)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamFriendsStandIn *)instancePtr)->SetPersonaName(pchPersonaName));
+}
+
+EPersonaState  standin_SteamAPI_ISteamFriends_GetPersonaState(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetPersonaState);
+EPersonaState  standin_SteamAPI_ISteamFriends_GetPersonaState(intptr_t  instancePtr)
+{
+  return StandInResult<EPersonaState>::of(((ISteamFriendsStandIn *)instancePtr)->GetPersonaState());
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendCount(intptr_t  instancePtr, int  iFriendFlags) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendCount);
+int  standin_SteamAPI_ISteamFriends_GetFriendCount(intptr_t  instancePtr, int  iFriendFlags)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendCount(iFriendFlags));
+}
+
+uint64  standin_SteamAPI_ISteamFriends_GetFriendByIndex(intptr_t  instancePtr, int  iFriend, int  iFriendFlags) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendByIndex);
+uint64  standin_SteamAPI_ISteamFriends_GetFriendByIndex(intptr_t  instancePtr, int  iFriend, int  iFriendFlags)
+{
+  return StandInResult<uint64>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendByIndex(iFriend, iFriendFlags));
+}
+
+EFriendRelationship  standin_SteamAPI_ISteamFriends_GetFriendRelationship(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendRelationship);
+EFriendRelationship  standin_SteamAPI_ISteamFriends_GetFriendRelationship(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<EFriendRelationship>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendRelationship(steamIDFriend));
+}
+
+EPersonaState  standin_SteamAPI_ISteamFriends_GetFriendPersonaState(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendPersonaState);
+EPersonaState  standin_SteamAPI_ISteamFriends_GetFriendPersonaState(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<EPersonaState>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendPersonaState(steamIDFriend));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetFriendPersonaName(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendPersonaName);
+char * standin_SteamAPI_ISteamFriends_GetFriendPersonaName(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendPersonaName(steamIDFriend));
+}
+
+bool  standin_SteamAPI_ISteamFriends_GetFriendGamePlayed(intptr_t  instancePtr, CSteamID  steamIDFriend, FriendGameInfo_t * pFriendGameInfo) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendGamePlayed);
+bool  standin_SteamAPI_ISteamFriends_GetFriendGamePlayed(intptr_t  instancePtr, CSteamID  steamIDFriend, FriendGameInfo_t * pFriendGameInfo)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendGamePlayed(steamIDFriend, pFriendGameInfo));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetFriendPersonaNameHistory(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iPersonaName) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendPersonaNameHistory);
+char * standin_SteamAPI_ISteamFriends_GetFriendPersonaNameHistory(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iPersonaName)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendPersonaNameHistory(steamIDFriend, iPersonaName));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendSteamLevel(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendSteamLevel);
+int  standin_SteamAPI_ISteamFriends_GetFriendSteamLevel(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendSteamLevel(steamIDFriend));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetPlayerNickname(intptr_t  instancePtr, CSteamID  steamIDPlayer) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetPlayerNickname);
+char * standin_SteamAPI_ISteamFriends_GetPlayerNickname(intptr_t  instancePtr, CSteamID  steamIDPlayer)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetPlayerNickname(steamIDPlayer));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendsGroupCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendsGroupCount);
+int  standin_SteamAPI_ISteamFriends_GetFriendsGroupCount(intptr_t  instancePtr)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendsGroupCount());
+}
+
+FriendsGroupID_t  standin_SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex(intptr_t  instancePtr, int  iFG) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex);
+FriendsGroupID_t  standin_SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex(intptr_t  instancePtr, int  iFG)
+{
+  return StandInResult<FriendsGroupID_t>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendsGroupIDByIndex(iFG));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetFriendsGroupName(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendsGroupName);
+char * standin_SteamAPI_ISteamFriends_GetFriendsGroupName(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendsGroupName(friendsGroupID));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendsGroupMembersCount(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendsGroupMembersCount);
+int  standin_SteamAPI_ISteamFriends_GetFriendsGroupMembersCount(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendsGroupMembersCount(friendsGroupID));
+}
+
+void  standin_SteamAPI_ISteamFriends_GetFriendsGroupMembersList(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID, CSteamID * pOutSteamIDMembers, int  nMembersCount) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendsGroupMembersList);
+void  standin_SteamAPI_ISteamFriends_GetFriendsGroupMembersList(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID, CSteamID * pOutSteamIDMembers, int  nMembersCount)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->GetFriendsGroupMembersList(friendsGroupID, pOutSteamIDMembers, nMembersCount);
+}
+
+bool  standin_SteamAPI_ISteamFriends_HasFriend(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iFriendFlags) STANDIN_EXPORT(SteamAPI_ISteamFriends_HasFriend);
+bool  standin_SteamAPI_ISteamFriends_HasFriend(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iFriendFlags)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->HasFriend(steamIDFriend, iFriendFlags));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetClanCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanCount);
+int  standin_SteamAPI_ISteamFriends_GetClanCount(intptr_t  instancePtr)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanCount());
+}
+
+uint64  standin_SteamAPI_ISteamFriends_GetClanByIndex(intptr_t  instancePtr, int  iClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanByIndex);
+uint64  standin_SteamAPI_ISteamFriends_GetClanByIndex(intptr_t  instancePtr, int  iClan)
+{
+  return StandInResult<uint64>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanByIndex(iClan));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetClanName(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanName);
+char * standin_SteamAPI_ISteamFriends_GetClanName(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanName(steamIDClan));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetClanTag(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanTag);
+char * standin_SteamAPI_ISteamFriends_GetClanTag(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanTag(steamIDClan));
+}
+
+bool  standin_SteamAPI_ISteamFriends_GetClanActivityCounts(intptr_t  instancePtr, CSteamID  steamIDClan, int * pnOnline, int * pnInGame, int * pnChatting) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanActivityCounts);
+bool  standin_SteamAPI_ISteamFriends_GetClanActivityCounts(intptr_t  instancePtr, CSteamID  steamIDClan, int * pnOnline, int * pnInGame, int * pnChatting)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanActivityCounts(steamIDClan, pnOnline, pnInGame, pnChatting));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_DownloadClanActivityCounts(intptr_t  instancePtr, CSteamID * psteamIDClans, int  cClansToRequest) STANDIN_EXPORT(SteamAPI_ISteamFriends_DownloadClanActivityCounts);
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_DownloadClanActivityCounts(intptr_t  instancePtr, CSteamID * psteamIDClans, int  cClansToRequest)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamFriendsStandIn *)instancePtr)->DownloadClanActivityCounts(psteamIDClans, cClansToRequest));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendCountFromSource(intptr_t  instancePtr, CSteamID  steamIDSource) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendCountFromSource);
+int  standin_SteamAPI_ISteamFriends_GetFriendCountFromSource(intptr_t  instancePtr, CSteamID  steamIDSource)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendCountFromSource(steamIDSource));
+}
+
+uint64  standin_SteamAPI_ISteamFriends_GetFriendFromSourceByIndex(intptr_t  instancePtr, CSteamID  steamIDSource, int  iFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendFromSourceByIndex);
+uint64  standin_SteamAPI_ISteamFriends_GetFriendFromSourceByIndex(intptr_t  instancePtr, CSteamID  steamIDSource, int  iFriend)
+{
+  return StandInResult<uint64>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendFromSourceByIndex(steamIDSource, iFriend));
+}
+
+bool  standin_SteamAPI_ISteamFriends_IsUserInSource(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDSource) STANDIN_EXPORT(SteamAPI_ISteamFriends_IsUserInSource);
+bool  standin_SteamAPI_ISteamFriends_IsUserInSource(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDSource)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->IsUserInSource(steamIDUser, steamIDSource));
+}
+
+void  standin_SteamAPI_ISteamFriends_SetInGameVoiceSpeaking(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bSpeaking) STANDIN_EXPORT(SteamAPI_ISteamFriends_SetInGameVoiceSpeaking);
+void  standin_SteamAPI_ISteamFriends_SetInGameVoiceSpeaking(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bSpeaking)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->SetInGameVoiceSpeaking(steamIDUser, bSpeaking);
+}
+
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlay(intptr_t  instancePtr, char * pchDialog) STANDIN_EXPORT(SteamAPI_ISteamFriends_ActivateGameOverlay);
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlay(intptr_t  instancePtr, char * pchDialog)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->ActivateGameOverlay(pchDialog);
+}
+
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayToUser(intptr_t  instancePtr, char * pchDialog, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamFriends_ActivateGameOverlayToUser);
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayToUser(intptr_t  instancePtr, char * pchDialog, CSteamID  steamID)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->ActivateGameOverlayToUser(pchDialog, steamID);
+}
+
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage(intptr_t  instancePtr, char * pchURL) STANDIN_EXPORT(SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage);
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage(intptr_t  instancePtr, char * pchURL)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->ActivateGameOverlayToWebPage(pchURL);
+}
+
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayToStore(intptr_t  instancePtr, AppId_t  nAppID, EOverlayToStoreFlag  eFlag) STANDIN_EXPORT(SteamAPI_ISteamFriends_ActivateGameOverlayToStore);
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayToStore(intptr_t  instancePtr, AppId_t  nAppID, EOverlayToStoreFlag  eFlag)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->ActivateGameOverlayToStore(nAppID, eFlag);
+}
+
+void  standin_SteamAPI_ISteamFriends_SetPlayedWith(intptr_t  instancePtr, CSteamID  steamIDUserPlayedWith) STANDIN_EXPORT(SteamAPI_ISteamFriends_SetPlayedWith);
+void  standin_SteamAPI_ISteamFriends_SetPlayedWith(intptr_t  instancePtr, CSteamID  steamIDUserPlayedWith)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->SetPlayedWith(steamIDUserPlayedWith);
+}
+
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog);
+void  standin_SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->ActivateGameOverlayInviteDialog(steamIDLobby);
+}
+
+int  standin_SteamAPI_ISteamFriends_GetSmallFriendAvatar(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetSmallFriendAvatar);
+int  standin_SteamAPI_ISteamFriends_GetSmallFriendAvatar(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetSmallFriendAvatar(steamIDFriend));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetMediumFriendAvatar(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetMediumFriendAvatar);
+int  standin_SteamAPI_ISteamFriends_GetMediumFriendAvatar(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetMediumFriendAvatar(steamIDFriend));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetLargeFriendAvatar(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetLargeFriendAvatar);
+int  standin_SteamAPI_ISteamFriends_GetLargeFriendAvatar(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetLargeFriendAvatar(steamIDFriend));
+}
+
+bool  standin_SteamAPI_ISteamFriends_RequestUserInformation(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bRequireNameOnly) STANDIN_EXPORT(SteamAPI_ISteamFriends_RequestUserInformation);
+bool  standin_SteamAPI_ISteamFriends_RequestUserInformation(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bRequireNameOnly)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->RequestUserInformation(steamIDUser, bRequireNameOnly));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_RequestClanOfficerList(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_RequestClanOfficerList);
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_RequestClanOfficerList(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamFriendsStandIn *)instancePtr)->RequestClanOfficerList(steamIDClan));
+}
+
+uint64  standin_SteamAPI_ISteamFriends_GetClanOwner(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanOwner);
+uint64  standin_SteamAPI_ISteamFriends_GetClanOwner(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<uint64>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanOwner(steamIDClan));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetClanOfficerCount(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanOfficerCount);
+int  standin_SteamAPI_ISteamFriends_GetClanOfficerCount(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanOfficerCount(steamIDClan));
+}
+
+uint64  standin_SteamAPI_ISteamFriends_GetClanOfficerByIndex(intptr_t  instancePtr, CSteamID  steamIDClan, int  iOfficer) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanOfficerByIndex);
+uint64  standin_SteamAPI_ISteamFriends_GetClanOfficerByIndex(intptr_t  instancePtr, CSteamID  steamIDClan, int  iOfficer)
+{
+  return StandInResult<uint64>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanOfficerByIndex(steamIDClan, iOfficer));
+}
+
+uint32  standin_SteamAPI_ISteamFriends_GetUserRestrictions(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetUserRestrictions);
+uint32  standin_SteamAPI_ISteamFriends_GetUserRestrictions(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamFriendsStandIn *)instancePtr)->GetUserRestrictions());
+}
+
+bool  standin_SteamAPI_ISteamFriends_SetRichPresence(intptr_t  instancePtr, char * pchKey, char * pchValue) STANDIN_EXPORT(SteamAPI_ISteamFriends_SetRichPresence);
+bool  standin_SteamAPI_ISteamFriends_SetRichPresence(intptr_t  instancePtr, char * pchKey, char * pchValue)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->SetRichPresence(pchKey, pchValue));
+}
+
+void  standin_SteamAPI_ISteamFriends_ClearRichPresence(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamFriends_ClearRichPresence);
+void  standin_SteamAPI_ISteamFriends_ClearRichPresence(intptr_t  instancePtr)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->ClearRichPresence();
+}
+
+char * standin_SteamAPI_ISteamFriends_GetFriendRichPresence(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchKey) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendRichPresence);
+char * standin_SteamAPI_ISteamFriends_GetFriendRichPresence(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchKey)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendRichPresence(steamIDFriend, pchKey));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount);
+int  standin_SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendRichPresenceKeyCount(steamIDFriend));
+}
+
+char * standin_SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iKey) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex);
+char * standin_SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iKey)
+{
+  return StandInResult<char *>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendRichPresenceKeyByIndex(steamIDFriend, iKey));
+}
+
+void  standin_SteamAPI_ISteamFriends_RequestFriendRichPresence(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_RequestFriendRichPresence);
+void  standin_SteamAPI_ISteamFriends_RequestFriendRichPresence(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  ((ISteamFriendsStandIn *)instancePtr)->RequestFriendRichPresence(steamIDFriend);
+}
+
+bool  standin_SteamAPI_ISteamFriends_InviteUserToGame(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchConnectString) STANDIN_EXPORT(SteamAPI_ISteamFriends_InviteUserToGame);
+bool  standin_SteamAPI_ISteamFriends_InviteUserToGame(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchConnectString)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->InviteUserToGame(steamIDFriend, pchConnectString));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetCoplayFriendCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetCoplayFriendCount);
+int  standin_SteamAPI_ISteamFriends_GetCoplayFriendCount(intptr_t  instancePtr)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetCoplayFriendCount());
+}
+
+uint64  standin_SteamAPI_ISteamFriends_GetCoplayFriend(intptr_t  instancePtr, int  iCoplayFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetCoplayFriend);
+uint64  standin_SteamAPI_ISteamFriends_GetCoplayFriend(intptr_t  instancePtr, int  iCoplayFriend)
+{
+  return StandInResult<uint64>::of(((ISteamFriendsStandIn *)instancePtr)->GetCoplayFriend(iCoplayFriend));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendCoplayTime(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendCoplayTime);
+int  standin_SteamAPI_ISteamFriends_GetFriendCoplayTime(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendCoplayTime(steamIDFriend));
+}
+
+AppId_t  standin_SteamAPI_ISteamFriends_GetFriendCoplayGame(intptr_t  instancePtr, CSteamID  steamIDFriend) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendCoplayGame);
+AppId_t  standin_SteamAPI_ISteamFriends_GetFriendCoplayGame(intptr_t  instancePtr, CSteamID  steamIDFriend)
+{
+  return StandInResult<AppId_t>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendCoplayGame(steamIDFriend));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_JoinClanChatRoom(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_JoinClanChatRoom);
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_JoinClanChatRoom(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamFriendsStandIn *)instancePtr)->JoinClanChatRoom(steamIDClan));
+}
+
+bool  standin_SteamAPI_ISteamFriends_LeaveClanChatRoom(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_LeaveClanChatRoom);
+bool  standin_SteamAPI_ISteamFriends_LeaveClanChatRoom(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->LeaveClanChatRoom(steamIDClan));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetClanChatMemberCount(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanChatMemberCount);
+int  standin_SteamAPI_ISteamFriends_GetClanChatMemberCount(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanChatMemberCount(steamIDClan));
+}
+
+uint64  standin_SteamAPI_ISteamFriends_GetChatMemberByIndex(intptr_t  instancePtr, CSteamID  steamIDClan, int  iUser) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetChatMemberByIndex);
+uint64  standin_SteamAPI_ISteamFriends_GetChatMemberByIndex(intptr_t  instancePtr, CSteamID  steamIDClan, int  iUser)
+{
+  return StandInResult<uint64>::of(((ISteamFriendsStandIn *)instancePtr)->GetChatMemberByIndex(steamIDClan, iUser));
+}
+
+bool  standin_SteamAPI_ISteamFriends_SendClanChatMessage(intptr_t  instancePtr, CSteamID  steamIDClanChat, char * pchText) STANDIN_EXPORT(SteamAPI_ISteamFriends_SendClanChatMessage);
+bool  standin_SteamAPI_ISteamFriends_SendClanChatMessage(intptr_t  instancePtr, CSteamID  steamIDClanChat, char * pchText)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->SendClanChatMessage(steamIDClanChat, pchText));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetClanChatMessage(intptr_t  instancePtr, CSteamID  steamIDClanChat, int  iMessage, void * prgchText, int  cchTextMax, EChatEntryType * peChatEntryType, CSteamID * psteamidChatter) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetClanChatMessage);
+int  standin_SteamAPI_ISteamFriends_GetClanChatMessage(intptr_t  instancePtr, CSteamID  steamIDClanChat, int  iMessage, void * prgchText, int  cchTextMax, EChatEntryType * peChatEntryType, CSteamID * psteamidChatter)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetClanChatMessage(steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter));
+}
+
+bool  standin_SteamAPI_ISteamFriends_IsClanChatAdmin(intptr_t  instancePtr, CSteamID  steamIDClanChat, CSteamID  steamIDUser) STANDIN_EXPORT(SteamAPI_ISteamFriends_IsClanChatAdmin);
+bool  standin_SteamAPI_ISteamFriends_IsClanChatAdmin(intptr_t  instancePtr, CSteamID  steamIDClanChat, CSteamID  steamIDUser)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->IsClanChatAdmin(steamIDClanChat, steamIDUser));
+}
+
+bool  standin_SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam(intptr_t  instancePtr, CSteamID  steamIDClanChat) STANDIN_EXPORT(SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam);
+bool  standin_SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam(intptr_t  instancePtr, CSteamID  steamIDClanChat)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->IsClanChatWindowOpenInSteam(steamIDClanChat));
+}
+
+bool  standin_SteamAPI_ISteamFriends_OpenClanChatWindowInSteam(intptr_t  instancePtr, CSteamID  steamIDClanChat) STANDIN_EXPORT(SteamAPI_ISteamFriends_OpenClanChatWindowInSteam);
+bool  standin_SteamAPI_ISteamFriends_OpenClanChatWindowInSteam(intptr_t  instancePtr, CSteamID  steamIDClanChat)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->OpenClanChatWindowInSteam(steamIDClanChat));
+}
+
+bool  standin_SteamAPI_ISteamFriends_CloseClanChatWindowInSteam(intptr_t  instancePtr, CSteamID  steamIDClanChat) STANDIN_EXPORT(SteamAPI_ISteamFriends_CloseClanChatWindowInSteam);
+bool  standin_SteamAPI_ISteamFriends_CloseClanChatWindowInSteam(intptr_t  instancePtr, CSteamID  steamIDClanChat)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->CloseClanChatWindowInSteam(steamIDClanChat));
+}
+
+bool  standin_SteamAPI_ISteamFriends_SetListenForFriendsMessages(intptr_t  instancePtr, bool  bInterceptEnabled) STANDIN_EXPORT(SteamAPI_ISteamFriends_SetListenForFriendsMessages);
+bool  standin_SteamAPI_ISteamFriends_SetListenForFriendsMessages(intptr_t  instancePtr, bool  bInterceptEnabled)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->SetListenForFriendsMessages(bInterceptEnabled));
+}
+
+bool  standin_SteamAPI_ISteamFriends_ReplyToFriendMessage(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchMsgToSend) STANDIN_EXPORT(SteamAPI_ISteamFriends_ReplyToFriendMessage);
+bool  standin_SteamAPI_ISteamFriends_ReplyToFriendMessage(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchMsgToSend)
+{
+  return StandInResult<bool>::of(((ISteamFriendsStandIn *)instancePtr)->ReplyToFriendMessage(steamIDFriend, pchMsgToSend));
+}
+
+int  standin_SteamAPI_ISteamFriends_GetFriendMessage(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iMessageID, void * pvData, int  cubData, EChatEntryType * peChatEntryType) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFriendMessage);
+int  standin_SteamAPI_ISteamFriends_GetFriendMessage(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iMessageID, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
+{
+  return StandInResult<int>::of(((ISteamFriendsStandIn *)instancePtr)->GetFriendMessage(steamIDFriend, iMessageID, pvData, cubData, peChatEntryType));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_GetFollowerCount(intptr_t  instancePtr, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamFriends_GetFollowerCount);
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_GetFollowerCount(intptr_t  instancePtr, CSteamID  steamID)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamFriendsStandIn *)instancePtr)->GetFollowerCount(steamID));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_IsFollowing(intptr_t  instancePtr, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamFriends_IsFollowing);
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_IsFollowing(intptr_t  instancePtr, CSteamID  steamID)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamFriendsStandIn *)instancePtr)->IsFollowing(steamID));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_EnumerateFollowingList(intptr_t  instancePtr, uint32  unStartIndex) STANDIN_EXPORT(SteamAPI_ISteamFriends_EnumerateFollowingList);
+SteamAPICall_t  standin_SteamAPI_ISteamFriends_EnumerateFollowingList(intptr_t  instancePtr, uint32  unStartIndex)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamFriendsStandIn *)instancePtr)->EnumerateFollowingList(unStartIndex));
+}
+
+uint32  standin_SteamAPI_ISteamUtils_GetSecondsSinceAppActive(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetSecondsSinceAppActive);
+uint32  standin_SteamAPI_ISteamUtils_GetSecondsSinceAppActive(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUtilsStandIn *)instancePtr)->GetSecondsSinceAppActive());
+}
+
+uint32  standin_SteamAPI_ISteamUtils_GetSecondsSinceComputerActive(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetSecondsSinceComputerActive);
+uint32  standin_SteamAPI_ISteamUtils_GetSecondsSinceComputerActive(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUtilsStandIn *)instancePtr)->GetSecondsSinceComputerActive());
+}
+
+EUniverse  standin_SteamAPI_ISteamUtils_GetConnectedUniverse(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetConnectedUniverse);
+EUniverse  standin_SteamAPI_ISteamUtils_GetConnectedUniverse(intptr_t  instancePtr)
+{
+  return StandInResult<EUniverse>::of(((ISteamUtilsStandIn *)instancePtr)->GetConnectedUniverse());
+}
+
+uint32  standin_SteamAPI_ISteamUtils_GetServerRealTime(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetServerRealTime);
+uint32  standin_SteamAPI_ISteamUtils_GetServerRealTime(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUtilsStandIn *)instancePtr)->GetServerRealTime());
+}
+
+char * standin_SteamAPI_ISteamUtils_GetIPCountry(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetIPCountry);
+char * standin_SteamAPI_ISteamUtils_GetIPCountry(intptr_t  instancePtr)
+{
+  return StandInResult<char *>::of(((ISteamUtilsStandIn *)instancePtr)->GetIPCountry());
+}
+
+bool  standin_SteamAPI_ISteamUtils_GetImageSize(intptr_t  instancePtr, int  iImage, uint32 * pnWidth, uint32 * pnHeight) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetImageSize);
+bool  standin_SteamAPI_ISteamUtils_GetImageSize(intptr_t  instancePtr, int  iImage, uint32 * pnWidth, uint32 * pnHeight)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->GetImageSize(iImage, pnWidth, pnHeight));
+}
+
+bool  standin_SteamAPI_ISteamUtils_GetImageRGBA(intptr_t  instancePtr, int  iImage, uint8 * pubDest, int  nDestBufferSize) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetImageRGBA);
+bool  standin_SteamAPI_ISteamUtils_GetImageRGBA(intptr_t  instancePtr, int  iImage, uint8 * pubDest, int  nDestBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->GetImageRGBA(iImage, pubDest, nDestBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamUtils_GetCSERIPPort(intptr_t  instancePtr, uint32 * unIP, uint16 * usPort) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetCSERIPPort);
+bool  standin_SteamAPI_ISteamUtils_GetCSERIPPort(intptr_t  instancePtr, uint32 * unIP, uint16 * usPort)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->GetCSERIPPort(unIP, usPort));
+}
+
+uint8  standin_SteamAPI_ISteamUtils_GetCurrentBatteryPower(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetCurrentBatteryPower);
+uint8  standin_SteamAPI_ISteamUtils_GetCurrentBatteryPower(intptr_t  instancePtr)
+{
+  return StandInResult<uint8>::of(((ISteamUtilsStandIn *)instancePtr)->GetCurrentBatteryPower());
+}
+
+uint32  standin_SteamAPI_ISteamUtils_GetAppID(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetAppID);
+uint32  standin_SteamAPI_ISteamUtils_GetAppID(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUtilsStandIn *)instancePtr)->GetAppID());
+}
+
+void  standin_SteamAPI_ISteamUtils_SetOverlayNotificationPosition(intptr_t  instancePtr, ENotificationPosition  eNotificationPosition) STANDIN_EXPORT(SteamAPI_ISteamUtils_SetOverlayNotificationPosition);
+void  standin_SteamAPI_ISteamUtils_SetOverlayNotificationPosition(intptr_t  instancePtr, ENotificationPosition  eNotificationPosition)
+{
+  ((ISteamUtilsStandIn *)instancePtr)->SetOverlayNotificationPosition(eNotificationPosition);
+}
+
+bool  standin_SteamAPI_ISteamUtils_IsAPICallCompleted(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, bool * pbFailed) STANDIN_EXPORT(SteamAPI_ISteamUtils_IsAPICallCompleted);
+bool  standin_SteamAPI_ISteamUtils_IsAPICallCompleted(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, bool * pbFailed)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->IsAPICallCompleted(hSteamAPICall, pbFailed));
+}
+
+ESteamAPICallFailure  standin_SteamAPI_ISteamUtils_GetAPICallFailureReason(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetAPICallFailureReason);
+ESteamAPICallFailure  standin_SteamAPI_ISteamUtils_GetAPICallFailureReason(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall)
+{
+  return StandInResult<ESteamAPICallFailure>::of(((ISteamUtilsStandIn *)instancePtr)->GetAPICallFailureReason(hSteamAPICall));
+}
+
+bool  standin_SteamAPI_ISteamUtils_GetAPICallResult(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, void * pCallback, int  cubCallback, int  iCallbackExpected, bool * pbFailed) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetAPICallResult);
+bool  standin_SteamAPI_ISteamUtils_GetAPICallResult(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, void * pCallback, int  cubCallback, int  iCallbackExpected, bool * pbFailed)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->GetAPICallResult(hSteamAPICall, pCallback, cubCallback, iCallbackExpected, pbFailed));
+}
+
+uint32  standin_SteamAPI_ISteamUtils_GetIPCCallCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetIPCCallCount);
+uint32  standin_SteamAPI_ISteamUtils_GetIPCCallCount(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUtilsStandIn *)instancePtr)->GetIPCCallCount());
+}
+
+void  standin_SteamAPI_ISteamUtils_SetWarningMessageHook(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction) STANDIN_EXPORT(SteamAPI_ISteamUtils_SetWarningMessageHook);
+void  standin_SteamAPI_ISteamUtils_SetWarningMessageHook(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction)
+{
+  ((ISteamUtilsStandIn *)instancePtr)->SetWarningMessageHook(pFunction);
+}
+
+bool  standin_SteamAPI_ISteamUtils_IsOverlayEnabled(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_IsOverlayEnabled);
+bool  standin_SteamAPI_ISteamUtils_IsOverlayEnabled(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->IsOverlayEnabled());
+}
+
+bool  standin_SteamAPI_ISteamUtils_BOverlayNeedsPresent(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_BOverlayNeedsPresent);
+bool  standin_SteamAPI_ISteamUtils_BOverlayNeedsPresent(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->BOverlayNeedsPresent());
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUtils_CheckFileSignature(intptr_t  instancePtr, char * szFileName) STANDIN_EXPORT(SteamAPI_ISteamUtils_CheckFileSignature);
+SteamAPICall_t  standin_SteamAPI_ISteamUtils_CheckFileSignature(intptr_t  instancePtr, char * szFileName)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUtilsStandIn *)instancePtr)->CheckFileSignature(szFileName));
+}
+
+bool  standin_SteamAPI_ISteamUtils_ShowGamepadTextInput(intptr_t  instancePtr, EGamepadTextInputMode  eInputMode, EGamepadTextInputLineMode  eLineInputMode, char * pchDescription, uint32  unCharMax, char * pchExistingText) STANDIN_EXPORT(SteamAPI_ISteamUtils_ShowGamepadTextInput);
+bool  standin_SteamAPI_ISteamUtils_ShowGamepadTextInput(intptr_t  instancePtr, EGamepadTextInputMode  eInputMode, EGamepadTextInputLineMode  eLineInputMode, char * pchDescription, uint32  unCharMax, char * pchExistingText)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->ShowGamepadTextInput(eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText));
+}
+
+uint32  standin_SteamAPI_ISteamUtils_GetEnteredGamepadTextLength(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetEnteredGamepadTextLength);
+uint32  standin_SteamAPI_ISteamUtils_GetEnteredGamepadTextLength(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUtilsStandIn *)instancePtr)->GetEnteredGamepadTextLength());
+}
+
+bool  standin_SteamAPI_ISteamUtils_GetEnteredGamepadTextInput(intptr_t  instancePtr, char * pchText, uint32  cchText) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetEnteredGamepadTextInput);
+bool  standin_SteamAPI_ISteamUtils_GetEnteredGamepadTextInput(intptr_t  instancePtr, char * pchText, uint32  cchText)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->GetEnteredGamepadTextInput(pchText, cchText));
+}
+
+char * standin_SteamAPI_ISteamUtils_GetSteamUILanguage(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_GetSteamUILanguage);
+char * standin_SteamAPI_ISteamUtils_GetSteamUILanguage(intptr_t  instancePtr)
+{
+  return StandInResult<char *>::of(((ISteamUtilsStandIn *)instancePtr)->GetSteamUILanguage());
+}
+
+bool  standin_SteamAPI_ISteamUtils_IsSteamRunningInVR(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUtils_IsSteamRunningInVR);
+bool  standin_SteamAPI_ISteamUtils_IsSteamRunningInVR(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamUtilsStandIn *)instancePtr)->IsSteamRunningInVR());
+}
+
+int  standin_SteamAPI_ISteamMatchmaking_GetFavoriteGameCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetFavoriteGameCount);
+int  standin_SteamAPI_ISteamMatchmaking_GetFavoriteGameCount(intptr_t  instancePtr)
+{
+  return StandInResult<int>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetFavoriteGameCount());
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_GetFavoriteGame(intptr_t  instancePtr, int  iGame, AppId_t * pnAppID, uint32 * pnIP, uint16 * pnConnPort, uint16 * pnQueryPort, uint32 * punFlags, uint32 * pRTime32LastPlayedOnServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetFavoriteGame);
+bool  standin_SteamAPI_ISteamMatchmaking_GetFavoriteGame(intptr_t  instancePtr, int  iGame, AppId_t * pnAppID, uint32 * pnIP, uint16 * pnConnPort, uint16 * pnQueryPort, uint32 * punFlags, uint32 * pRTime32LastPlayedOnServer)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetFavoriteGame(iGame, pnAppID, pnIP, pnConnPort, pnQueryPort, punFlags, pRTime32LastPlayedOnServer));
+}
+
+int  standin_SteamAPI_ISteamMatchmaking_AddFavoriteGame(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags, uint32  rTime32LastPlayedOnServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddFavoriteGame);
+int  standin_SteamAPI_ISteamMatchmaking_AddFavoriteGame(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags, uint32  rTime32LastPlayedOnServer)
+{
+  return StandInResult<int>::of(((ISteamMatchmakingStandIn *)instancePtr)->AddFavoriteGame(nAppID, nIP, nConnPort, nQueryPort, unFlags, rTime32LastPlayedOnServer));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_RemoveFavoriteGame(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_RemoveFavoriteGame);
+bool  standin_SteamAPI_ISteamMatchmaking_RemoveFavoriteGame(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->RemoveFavoriteGame(nAppID, nIP, nConnPort, nQueryPort, unFlags));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamMatchmaking_RequestLobbyList(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_RequestLobbyList);
+SteamAPICall_t  standin_SteamAPI_ISteamMatchmaking_RequestLobbyList(intptr_t  instancePtr)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamMatchmakingStandIn *)instancePtr)->RequestLobbyList());
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter(intptr_t  instancePtr, char * pchKeyToMatch, char * pchValueToMatch, ELobbyComparison  eComparisonType) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter);
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter(intptr_t  instancePtr, char * pchKeyToMatch, char * pchValueToMatch, ELobbyComparison  eComparisonType)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->AddRequestLobbyListStringFilter(pchKeyToMatch, pchValueToMatch, eComparisonType);
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToMatch, ELobbyComparison  eComparisonType) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter);
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToMatch, ELobbyComparison  eComparisonType)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->AddRequestLobbyListNumericalFilter(pchKeyToMatch, nValueToMatch, eComparisonType);
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToBeCloseTo) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter);
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToBeCloseTo)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->AddRequestLobbyListNearValueFilter(pchKeyToMatch, nValueToBeCloseTo);
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable(intptr_t  instancePtr, int  nSlotsAvailable) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable);
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable(intptr_t  instancePtr, int  nSlotsAvailable)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->AddRequestLobbyListFilterSlotsAvailable(nSlotsAvailable);
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter(intptr_t  instancePtr, ELobbyDistanceFilter  eLobbyDistanceFilter) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter);
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter(intptr_t  instancePtr, ELobbyDistanceFilter  eLobbyDistanceFilter)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->AddRequestLobbyListDistanceFilter(eLobbyDistanceFilter);
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter(intptr_t  instancePtr, int  cMaxResults) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter);
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter(intptr_t  instancePtr, int  cMaxResults)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->AddRequestLobbyListResultCountFilter(cMaxResults);
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter);
+void  standin_SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->AddRequestLobbyListCompatibleMembersFilter(steamIDLobby);
+}
+
+uint64  standin_SteamAPI_ISteamMatchmaking_GetLobbyByIndex(intptr_t  instancePtr, int  iLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyByIndex);
+uint64  standin_SteamAPI_ISteamMatchmaking_GetLobbyByIndex(intptr_t  instancePtr, int  iLobby)
+{
+  return StandInResult<uint64>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyByIndex(iLobby));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamMatchmaking_CreateLobby(intptr_t  instancePtr, ELobbyType  eLobbyType, int  cMaxMembers) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_CreateLobby);
+SteamAPICall_t  standin_SteamAPI_ISteamMatchmaking_CreateLobby(intptr_t  instancePtr, ELobbyType  eLobbyType, int  cMaxMembers)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamMatchmakingStandIn *)instancePtr)->CreateLobby(eLobbyType, cMaxMembers));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamMatchmaking_JoinLobby(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_JoinLobby);
+SteamAPICall_t  standin_SteamAPI_ISteamMatchmaking_JoinLobby(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamMatchmakingStandIn *)instancePtr)->JoinLobby(steamIDLobby));
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_LeaveLobby(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_LeaveLobby);
+void  standin_SteamAPI_ISteamMatchmaking_LeaveLobby(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->LeaveLobby(steamIDLobby);
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_InviteUserToLobby(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDInvitee) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_InviteUserToLobby);
+bool  standin_SteamAPI_ISteamMatchmaking_InviteUserToLobby(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDInvitee)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->InviteUserToLobby(steamIDLobby, steamIDInvitee));
+}
+
+int  standin_SteamAPI_ISteamMatchmaking_GetNumLobbyMembers(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetNumLobbyMembers);
+int  standin_SteamAPI_ISteamMatchmaking_GetNumLobbyMembers(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  return StandInResult<int>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetNumLobbyMembers(steamIDLobby));
+}
+
+uint64  standin_SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iMember) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex);
+uint64  standin_SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iMember)
+{
+  return StandInResult<uint64>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyMemberByIndex(steamIDLobby, iMember));
+}
+
+char * standin_SteamAPI_ISteamMatchmaking_GetLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyData);
+char * standin_SteamAPI_ISteamMatchmaking_GetLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey)
+{
+  return StandInResult<char *>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyData(steamIDLobby, pchKey));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLobbyData);
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->SetLobbyData(steamIDLobby, pchKey, pchValue));
+}
+
+int  standin_SteamAPI_ISteamMatchmaking_GetLobbyDataCount(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyDataCount);
+int  standin_SteamAPI_ISteamMatchmaking_GetLobbyDataCount(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  return StandInResult<int>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyDataCount(steamIDLobby));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iLobbyData, char * pchKey, int  cchKeyBufferSize, char * pchValue, int  cchValueBufferSize) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex);
+bool  standin_SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iLobbyData, char * pchKey, int  cchKeyBufferSize, char * pchValue, int  cchValueBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyDataByIndex(steamIDLobby, iLobbyData, pchKey, cchKeyBufferSize, pchValue, cchValueBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_DeleteLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_DeleteLobbyData);
+bool  standin_SteamAPI_ISteamMatchmaking_DeleteLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->DeleteLobbyData(steamIDLobby, pchKey));
+}
+
+char * standin_SteamAPI_ISteamMatchmaking_GetLobbyMemberData(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDUser, char * pchKey) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyMemberData);
+char * standin_SteamAPI_ISteamMatchmaking_GetLobbyMemberData(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDUser, char * pchKey)
+{
+  return StandInResult<char *>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyMemberData(steamIDLobby, steamIDUser, pchKey));
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_SetLobbyMemberData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLobbyMemberData);
+void  standin_SteamAPI_ISteamMatchmaking_SetLobbyMemberData(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->SetLobbyMemberData(steamIDLobby, pchKey, pchValue);
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_SendLobbyChatMsg(intptr_t  instancePtr, CSteamID  steamIDLobby, void * pvMsgBody, int  cubMsgBody) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SendLobbyChatMsg);
+bool  standin_SteamAPI_ISteamMatchmaking_SendLobbyChatMsg(intptr_t  instancePtr, CSteamID  steamIDLobby, void * pvMsgBody, int  cubMsgBody)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->SendLobbyChatMsg(steamIDLobby, pvMsgBody, cubMsgBody));
+}
+
+int  standin_SteamAPI_ISteamMatchmaking_GetLobbyChatEntry(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iChatID, CSteamID * pSteamIDUser, void * pvData, int  cubData, EChatEntryType * peChatEntryType) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyChatEntry);
+int  standin_SteamAPI_ISteamMatchmaking_GetLobbyChatEntry(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iChatID, CSteamID * pSteamIDUser, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
+{
+  return StandInResult<int>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyChatEntry(steamIDLobby, iChatID, pSteamIDUser, pvData, cubData, peChatEntryType));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_RequestLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_RequestLobbyData);
+bool  standin_SteamAPI_ISteamMatchmaking_RequestLobbyData(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->RequestLobbyData(steamIDLobby));
+}
+
+void  standin_SteamAPI_ISteamMatchmaking_SetLobbyGameServer(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32  unGameServerIP, uint16  unGameServerPort, CSteamID  steamIDGameServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLobbyGameServer);
+void  standin_SteamAPI_ISteamMatchmaking_SetLobbyGameServer(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32  unGameServerIP, uint16  unGameServerPort, CSteamID  steamIDGameServer)
+{
+  ((ISteamMatchmakingStandIn *)instancePtr)->SetLobbyGameServer(steamIDLobby, unGameServerIP, unGameServerPort, steamIDGameServer);
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_GetLobbyGameServer(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32 * punGameServerIP, uint16 * punGameServerPort, CSteamID * psteamIDGameServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyGameServer);
+bool  standin_SteamAPI_ISteamMatchmaking_GetLobbyGameServer(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32 * punGameServerIP, uint16 * punGameServerPort, CSteamID * psteamIDGameServer)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyGameServer(steamIDLobby, punGameServerIP, punGameServerPort, psteamIDGameServer));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit(intptr_t  instancePtr, CSteamID  steamIDLobby, int  cMaxMembers) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit);
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit(intptr_t  instancePtr, CSteamID  steamIDLobby, int  cMaxMembers)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->SetLobbyMemberLimit(steamIDLobby, cMaxMembers));
+}
+
+int  standin_SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit);
+int  standin_SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  return StandInResult<int>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyMemberLimit(steamIDLobby));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyType(intptr_t  instancePtr, CSteamID  steamIDLobby, ELobbyType  eLobbyType) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLobbyType);
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyType(intptr_t  instancePtr, CSteamID  steamIDLobby, ELobbyType  eLobbyType)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->SetLobbyType(steamIDLobby, eLobbyType));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyJoinable(intptr_t  instancePtr, CSteamID  steamIDLobby, bool  bLobbyJoinable) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLobbyJoinable);
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyJoinable(intptr_t  instancePtr, CSteamID  steamIDLobby, bool  bLobbyJoinable)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->SetLobbyJoinable(steamIDLobby, bLobbyJoinable));
+}
+
+uint64  standin_SteamAPI_ISteamMatchmaking_GetLobbyOwner(intptr_t  instancePtr, CSteamID  steamIDLobby) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_GetLobbyOwner);
+uint64  standin_SteamAPI_ISteamMatchmaking_GetLobbyOwner(intptr_t  instancePtr, CSteamID  steamIDLobby)
+{
+  return StandInResult<uint64>::of(((ISteamMatchmakingStandIn *)instancePtr)->GetLobbyOwner(steamIDLobby));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyOwner(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDNewOwner) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLobbyOwner);
+bool  standin_SteamAPI_ISteamMatchmaking_SetLobbyOwner(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDNewOwner)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->SetLobbyOwner(steamIDLobby, steamIDNewOwner));
+}
+
+bool  standin_SteamAPI_ISteamMatchmaking_SetLinkedLobby(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDLobbyDependent) STANDIN_EXPORT(SteamAPI_ISteamMatchmaking_SetLinkedLobby);
+bool  standin_SteamAPI_ISteamMatchmaking_SetLinkedLobby(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDLobbyDependent)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingStandIn *)instancePtr)->SetLinkedLobby(steamIDLobby, steamIDLobbyDependent));
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded);
+void  standin_SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
+{
+  ((ISteamMatchmakingServerListResponseStandIn *)instancePtr)->ServerResponded(hRequest, iServer);
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond);
+void  standin_SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
+{
+  ((ISteamMatchmakingServerListResponseStandIn *)instancePtr)->ServerFailedToRespond(hRequest, iServer);
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete(intptr_t  instancePtr, HServerListRequest  hRequest, EMatchMakingServerResponse  response) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete);
+void  standin_SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete(intptr_t  instancePtr, HServerListRequest  hRequest, EMatchMakingServerResponse  response)
+{
+  ((ISteamMatchmakingServerListResponseStandIn *)instancePtr)->RefreshComplete(hRequest, response);
+}
+
+void  standin_SteamAPI_ISteamMatchmakingPingResponse_ServerResponded(intptr_t  instancePtr, gameserveritem_t & server) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingPingResponse_ServerResponded);
+void  standin_SteamAPI_ISteamMatchmakingPingResponse_ServerResponded(intptr_t  instancePtr, gameserveritem_t & server)
+{
+  ((ISteamMatchmakingPingResponseStandIn *)instancePtr)->ServerResponded(server);
+}
+
+void  standin_SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond);
+void  standin_SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond(intptr_t  instancePtr)
+{
+  ((ISteamMatchmakingPingResponseStandIn *)instancePtr)->ServerFailedToRespond();
+}
+
+void  standin_SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList(intptr_t  instancePtr, char * pchName, int  nScore, float  flTimePlayed) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList);
+void  standin_SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList(intptr_t  instancePtr, char * pchName, int  nScore, float  flTimePlayed)
+{
+  ((ISteamMatchmakingPlayersResponseStandIn *)instancePtr)->AddPlayerToList(pchName, nScore, flTimePlayed);
+}
+
+void  standin_SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond);
+void  standin_SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond(intptr_t  instancePtr)
+{
+  ((ISteamMatchmakingPlayersResponseStandIn *)instancePtr)->PlayersFailedToRespond();
+}
+
+void  standin_SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete);
+void  standin_SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete(intptr_t  instancePtr)
+{
+  ((ISteamMatchmakingPlayersResponseStandIn *)instancePtr)->PlayersRefreshComplete();
+}
+
+void  standin_SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded(intptr_t  instancePtr, char * pchRule, char * pchValue) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded);
+void  standin_SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded(intptr_t  instancePtr, char * pchRule, char * pchValue)
+{
+  ((ISteamMatchmakingRulesResponseStandIn *)instancePtr)->RulesResponded(pchRule, pchValue);
+}
+
+void  standin_SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond);
+void  standin_SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond(intptr_t  instancePtr)
+{
+  ((ISteamMatchmakingRulesResponseStandIn *)instancePtr)->RulesFailedToRespond();
+}
+
+void  standin_SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete);
+void  standin_SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete(intptr_t  instancePtr)
+{
+  ((ISteamMatchmakingRulesResponseStandIn *)instancePtr)->RulesRefreshComplete();
+}
+
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestInternetServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RequestInternetServerList);
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestInternetServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerListRequest>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->RequestInternetServerList(iApp, ppchFilters, nFilters, pRequestServersResponse));
+}
+
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestLANServerList(intptr_t  instancePtr, AppId_t  iApp, ISteamMatchmakingServerListResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RequestLANServerList);
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestLANServerList(intptr_t  instancePtr, AppId_t  iApp, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerListRequest>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->RequestLANServerList(iApp, pRequestServersResponse));
+}
+
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList);
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerListRequest>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->RequestFriendsServerList(iApp, ppchFilters, nFilters, pRequestServersResponse));
+}
+
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList);
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerListRequest>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->RequestFavoritesServerList(iApp, ppchFilters, nFilters, pRequestServersResponse));
+}
+
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList);
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerListRequest>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->RequestHistoryServerList(iApp, ppchFilters, nFilters, pRequestServersResponse));
+}
+
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList);
+HServerListRequest  standin_SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerListRequest>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->RequestSpectatorServerList(iApp, ppchFilters, nFilters, pRequestServersResponse));
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServers_ReleaseRequest(intptr_t  instancePtr, HServerListRequest  hServerListRequest) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_ReleaseRequest);
+void  standin_SteamAPI_ISteamMatchmakingServers_ReleaseRequest(intptr_t  instancePtr, HServerListRequest  hServerListRequest)
+{
+  ((ISteamMatchmakingServersStandIn *)instancePtr)->ReleaseRequest(hServerListRequest);
+}
+
+gameserveritem_t * standin_SteamAPI_ISteamMatchmakingServers_GetServerDetails(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_GetServerDetails);
+gameserveritem_t * standin_SteamAPI_ISteamMatchmakingServers_GetServerDetails(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
+{
+  return StandInResult<gameserveritem_t *>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->GetServerDetails(hRequest, iServer));
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServers_CancelQuery(intptr_t  instancePtr, HServerListRequest  hRequest) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_CancelQuery);
+void  standin_SteamAPI_ISteamMatchmakingServers_CancelQuery(intptr_t  instancePtr, HServerListRequest  hRequest)
+{
+  ((ISteamMatchmakingServersStandIn *)instancePtr)->CancelQuery(hRequest);
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServers_RefreshQuery(intptr_t  instancePtr, HServerListRequest  hRequest) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RefreshQuery);
+void  standin_SteamAPI_ISteamMatchmakingServers_RefreshQuery(intptr_t  instancePtr, HServerListRequest  hRequest)
+{
+  ((ISteamMatchmakingServersStandIn *)instancePtr)->RefreshQuery(hRequest);
+}
+
+bool  standin_SteamAPI_ISteamMatchmakingServers_IsRefreshing(intptr_t  instancePtr, HServerListRequest  hRequest) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_IsRefreshing);
+bool  standin_SteamAPI_ISteamMatchmakingServers_IsRefreshing(intptr_t  instancePtr, HServerListRequest  hRequest)
+{
+  return StandInResult<bool>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->IsRefreshing(hRequest));
+}
+
+int  standin_SteamAPI_ISteamMatchmakingServers_GetServerCount(intptr_t  instancePtr, HServerListRequest  hRequest) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_GetServerCount);
+int  standin_SteamAPI_ISteamMatchmakingServers_GetServerCount(intptr_t  instancePtr, HServerListRequest  hRequest)
+{
+  return StandInResult<int>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->GetServerCount(hRequest));
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServers_RefreshServer(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_RefreshServer);
+void  standin_SteamAPI_ISteamMatchmakingServers_RefreshServer(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
+{
+  ((ISteamMatchmakingServersStandIn *)instancePtr)->RefreshServer(hRequest, iServer);
+}
+
+HServerQuery  standin_SteamAPI_ISteamMatchmakingServers_PingServer(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPingResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_PingServer);
+HServerQuery  standin_SteamAPI_ISteamMatchmakingServers_PingServer(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPingResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerQuery>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->PingServer(unIP, usPort, pRequestServersResponse));
+}
+
+HServerQuery  standin_SteamAPI_ISteamMatchmakingServers_PlayerDetails(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPlayersResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_PlayerDetails);
+HServerQuery  standin_SteamAPI_ISteamMatchmakingServers_PlayerDetails(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPlayersResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerQuery>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->PlayerDetails(unIP, usPort, pRequestServersResponse));
+}
+
+HServerQuery  standin_SteamAPI_ISteamMatchmakingServers_ServerRules(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingRulesResponse * pRequestServersResponse) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_ServerRules);
+HServerQuery  standin_SteamAPI_ISteamMatchmakingServers_ServerRules(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingRulesResponse * pRequestServersResponse)
+{
+  return StandInResult<HServerQuery>::of(((ISteamMatchmakingServersStandIn *)instancePtr)->ServerRules(unIP, usPort, pRequestServersResponse));
+}
+
+void  standin_SteamAPI_ISteamMatchmakingServers_CancelServerQuery(intptr_t  instancePtr, HServerQuery  hServerQuery) STANDIN_EXPORT(SteamAPI_ISteamMatchmakingServers_CancelServerQuery);
+void  standin_SteamAPI_ISteamMatchmakingServers_CancelServerQuery(intptr_t  instancePtr, HServerQuery  hServerQuery)
+{
+  ((ISteamMatchmakingServersStandIn *)instancePtr)->CancelServerQuery(hServerQuery);
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWrite(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubData) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileWrite);
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWrite(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubData)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileWrite(pchFile, pvData, cubData));
+}
+
+int32  standin_SteamAPI_ISteamRemoteStorage_FileRead(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubDataToRead) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileRead);
+int32  standin_SteamAPI_ISteamRemoteStorage_FileRead(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubDataToRead)
+{
+  return StandInResult<int32>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileRead(pchFile, pvData, cubDataToRead));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FileForget(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileForget);
+bool  standin_SteamAPI_ISteamRemoteStorage_FileForget(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileForget(pchFile));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FileDelete(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileDelete);
+bool  standin_SteamAPI_ISteamRemoteStorage_FileDelete(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileDelete(pchFile));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_FileShare(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileShare);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_FileShare(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileShare(pchFile));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_SetSyncPlatforms(intptr_t  instancePtr, char * pchFile, ERemoteStoragePlatform  eRemoteStoragePlatform) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_SetSyncPlatforms);
+bool  standin_SteamAPI_ISteamRemoteStorage_SetSyncPlatforms(intptr_t  instancePtr, char * pchFile, ERemoteStoragePlatform  eRemoteStoragePlatform)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->SetSyncPlatforms(pchFile, eRemoteStoragePlatform));
+}
+
+UGCFileWriteStreamHandle_t  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen);
+UGCFileWriteStreamHandle_t  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<UGCFileWriteStreamHandle_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileWriteStreamOpen(pchFile));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle, void * pvData, int32  cubData) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk);
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle, void * pvData, int32  cubData)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileWriteStreamWriteChunk(writeHandle, pvData, cubData));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamClose(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileWriteStreamClose);
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamClose(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileWriteStreamClose(writeHandle));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel);
+bool  standin_SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileWriteStreamCancel(writeHandle));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FileExists(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FileExists);
+bool  standin_SteamAPI_ISteamRemoteStorage_FileExists(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FileExists(pchFile));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_FilePersisted(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_FilePersisted);
+bool  standin_SteamAPI_ISteamRemoteStorage_FilePersisted(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->FilePersisted(pchFile));
+}
+
+int32  standin_SteamAPI_ISteamRemoteStorage_GetFileSize(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetFileSize);
+int32  standin_SteamAPI_ISteamRemoteStorage_GetFileSize(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<int32>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetFileSize(pchFile));
+}
+
+int64  standin_SteamAPI_ISteamRemoteStorage_GetFileTimestamp(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetFileTimestamp);
+int64  standin_SteamAPI_ISteamRemoteStorage_GetFileTimestamp(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<int64>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetFileTimestamp(pchFile));
+}
+
+ERemoteStoragePlatform  standin_SteamAPI_ISteamRemoteStorage_GetSyncPlatforms(intptr_t  instancePtr, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetSyncPlatforms);
+ERemoteStoragePlatform  standin_SteamAPI_ISteamRemoteStorage_GetSyncPlatforms(intptr_t  instancePtr, char * pchFile)
+{
+  return StandInResult<ERemoteStoragePlatform>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetSyncPlatforms(pchFile));
+}
+
+int32  standin_SteamAPI_ISteamRemoteStorage_GetFileCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetFileCount);
+int32  standin_SteamAPI_ISteamRemoteStorage_GetFileCount(intptr_t  instancePtr)
+{
+  return StandInResult<int32>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetFileCount());
+}
+
+char * standin_SteamAPI_ISteamRemoteStorage_GetFileNameAndSize(intptr_t  instancePtr, int  iFile, int32 * pnFileSizeInBytes) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetFileNameAndSize);
+char * standin_SteamAPI_ISteamRemoteStorage_GetFileNameAndSize(intptr_t  instancePtr, int  iFile, int32 * pnFileSizeInBytes)
+{
+  return StandInResult<char *>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetFileNameAndSize(iFile, pnFileSizeInBytes));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_GetQuota(intptr_t  instancePtr, uint64 * pnTotalBytes, uint64 * puAvailableBytes) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetQuota);
+bool  standin_SteamAPI_ISteamRemoteStorage_GetQuota(intptr_t  instancePtr, uint64 * pnTotalBytes, uint64 * puAvailableBytes)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetQuota(pnTotalBytes, puAvailableBytes));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount);
+bool  standin_SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->IsCloudEnabledForAccount());
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp);
+bool  standin_SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->IsCloudEnabledForApp());
+}
+
+void  standin_SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp(intptr_t  instancePtr, bool  bEnabled) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp);
+void  standin_SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp(intptr_t  instancePtr, bool  bEnabled)
+{
+  ((ISteamRemoteStorageStandIn *)instancePtr)->SetCloudEnabledForApp(bEnabled);
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UGCDownload(intptr_t  instancePtr, UGCHandle_t  hContent, uint32  unPriority) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UGCDownload);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UGCDownload(intptr_t  instancePtr, UGCHandle_t  hContent, uint32  unPriority)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UGCDownload(hContent, unPriority));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress(intptr_t  instancePtr, UGCHandle_t  hContent, int32 * pnBytesDownloaded, int32 * pnBytesExpected) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress);
+bool  standin_SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress(intptr_t  instancePtr, UGCHandle_t  hContent, int32 * pnBytesDownloaded, int32 * pnBytesExpected)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetUGCDownloadProgress(hContent, pnBytesDownloaded, pnBytesExpected));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_GetUGCDetails(intptr_t  instancePtr, UGCHandle_t  hContent, AppId_t * pnAppID, char ** ppchName, int32 * pnFileSizeInBytes, CSteamID * pSteamIDOwner) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetUGCDetails);
+bool  standin_SteamAPI_ISteamRemoteStorage_GetUGCDetails(intptr_t  instancePtr, UGCHandle_t  hContent, AppId_t * pnAppID, char ** ppchName, int32 * pnFileSizeInBytes, CSteamID * pSteamIDOwner)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetUGCDetails(hContent, pnAppID, ppchName, pnFileSizeInBytes, pSteamIDOwner));
+}
+
+int32  standin_SteamAPI_ISteamRemoteStorage_UGCRead(intptr_t  instancePtr, UGCHandle_t  hContent, void * pvData, int32  cubDataToRead, uint32  cOffset, EUGCReadAction  eAction) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UGCRead);
+int32  standin_SteamAPI_ISteamRemoteStorage_UGCRead(intptr_t  instancePtr, UGCHandle_t  hContent, void * pvData, int32  cubDataToRead, uint32  cOffset, EUGCReadAction  eAction)
+{
+  return StandInResult<int32>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UGCRead(hContent, pvData, cubDataToRead, cOffset, eAction));
+}
+
+int32  standin_SteamAPI_ISteamRemoteStorage_GetCachedUGCCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetCachedUGCCount);
+int32  standin_SteamAPI_ISteamRemoteStorage_GetCachedUGCCount(intptr_t  instancePtr)
+{
+  return StandInResult<int32>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetCachedUGCCount());
+}
+
+UGCHandle_t  standin_SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle(intptr_t  instancePtr, int32  iCachedContent) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle);
+UGCHandle_t  standin_SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle(intptr_t  instancePtr, int32  iCachedContent)
+{
+  return StandInResult<UGCHandle_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetCachedUGCHandle(iCachedContent));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_PublishWorkshopFile(intptr_t  instancePtr, char * pchFile, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags, EWorkshopFileType  eWorkshopFileType) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_PublishWorkshopFile);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_PublishWorkshopFile(intptr_t  instancePtr, char * pchFile, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags, EWorkshopFileType  eWorkshopFileType)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->PublishWorkshopFile(pchFile, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags, eWorkshopFileType));
+}
+
+PublishedFileUpdateHandle_t  standin_SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest);
+PublishedFileUpdateHandle_t  standin_SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
+{
+  return StandInResult<PublishedFileUpdateHandle_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->CreatePublishedFileUpdateRequest(unPublishedFileId));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile);
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchFile)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdatePublishedFileFile(updateHandle, pchFile));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchPreviewFile) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile);
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchPreviewFile)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdatePublishedFilePreviewFile(updateHandle, pchPreviewFile));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchTitle) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle);
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchTitle)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdatePublishedFileTitle(updateHandle, pchTitle));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchDescription) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription);
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchDescription)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdatePublishedFileDescription(updateHandle, pchDescription));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, ERemoteStoragePublishedFileVisibility  eVisibility) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility);
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, ERemoteStoragePublishedFileVisibility  eVisibility)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdatePublishedFileVisibility(updateHandle, eVisibility));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags);
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdatePublishedFileTags(updateHandle, pTags));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->CommitPublishedFileUpdate(updateHandle));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, uint32  unMaxSecondsOld) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, uint32  unMaxSecondsOld)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetPublishedFileDetails(unPublishedFileId, unMaxSecondsOld));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_DeletePublishedFile(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_DeletePublishedFile);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_DeletePublishedFile(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->DeletePublishedFile(unPublishedFileId));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles(intptr_t  instancePtr, uint32  unStartIndex) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles(intptr_t  instancePtr, uint32  unStartIndex)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->EnumerateUserPublishedFiles(unStartIndex));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_SubscribePublishedFile(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_SubscribePublishedFile);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_SubscribePublishedFile(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->SubscribePublishedFile(unPublishedFileId));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles(intptr_t  instancePtr, uint32  unStartIndex) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles(intptr_t  instancePtr, uint32  unStartIndex)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->EnumerateUserSubscribedFiles(unStartIndex));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UnsubscribePublishedFile(unPublishedFileId));
+}
+
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchChangeDescription) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription);
+bool  standin_SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchChangeDescription)
+{
+  return StandInResult<bool>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdatePublishedFileSetChangeDescription(updateHandle, pchChangeDescription));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetPublishedItemVoteDetails(unPublishedFileId));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, bool  bVoteUp) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, bool  bVoteUp)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UpdateUserPublishedItemVote(unPublishedFileId, bVoteUp));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->GetUserPublishedItemVoteDetails(unPublishedFileId));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles(intptr_t  instancePtr, CSteamID  steamId, uint32  unStartIndex, SteamParamStringArray_t * pRequiredTags, SteamParamStringArray_t * pExcludedTags) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles(intptr_t  instancePtr, CSteamID  steamId, uint32  unStartIndex, SteamParamStringArray_t * pRequiredTags, SteamParamStringArray_t * pExcludedTags)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->EnumerateUserSharedWorkshopFiles(steamId, unStartIndex, pRequiredTags, pExcludedTags));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_PublishVideo(intptr_t  instancePtr, EWorkshopVideoProvider  eVideoProvider, char * pchVideoAccount, char * pchVideoIdentifier, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_PublishVideo);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_PublishVideo(intptr_t  instancePtr, EWorkshopVideoProvider  eVideoProvider, char * pchVideoAccount, char * pchVideoIdentifier, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->PublishVideo(eVideoProvider, pchVideoAccount, pchVideoIdentifier, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, EWorkshopFileAction  eAction) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, EWorkshopFileAction  eAction)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->SetUserPublishedFileAction(unPublishedFileId, eAction));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction(intptr_t  instancePtr, EWorkshopFileAction  eAction, uint32  unStartIndex) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction(intptr_t  instancePtr, EWorkshopFileAction  eAction, uint32  unStartIndex)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->EnumeratePublishedFilesByUserAction(eAction, unStartIndex));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles(intptr_t  instancePtr, EWorkshopEnumerationType  eEnumerationType, uint32  unStartIndex, uint32  unCount, uint32  unDays, SteamParamStringArray_t * pTags, SteamParamStringArray_t * pUserTags) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles(intptr_t  instancePtr, EWorkshopEnumerationType  eEnumerationType, uint32  unStartIndex, uint32  unCount, uint32  unDays, SteamParamStringArray_t * pTags, SteamParamStringArray_t * pUserTags)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->EnumeratePublishedWorkshopFiles(eEnumerationType, unStartIndex, unCount, unDays, pTags, pUserTags));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation(intptr_t  instancePtr, UGCHandle_t  hContent, char * pchLocation, uint32  unPriority) STANDIN_EXPORT(SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation);
+SteamAPICall_t  standin_SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation(intptr_t  instancePtr, UGCHandle_t  hContent, char * pchLocation, uint32  unPriority)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamRemoteStorageStandIn *)instancePtr)->UGCDownloadToLocation(hContent, pchLocation, unPriority));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_RequestCurrentStats(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUserStats_RequestCurrentStats);
+bool  standin_SteamAPI_ISteamUserStats_RequestCurrentStats(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->RequestCurrentStats());
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetStat(intptr_t  instancePtr, char * pchName, int32 * pData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetStat);
+bool  standin_SteamAPI_ISteamUserStats_GetStat(intptr_t  instancePtr, char * pchName, int32 * pData)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetStat(pchName, pData));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetStat0(intptr_t  instancePtr, char * pchName, float * pData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetStat0);
+bool  standin_SteamAPI_ISteamUserStats_GetStat0(intptr_t  instancePtr, char * pchName, float * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  standin_SteamAPI_ISteamUserStats_SetStat(intptr_t  instancePtr, char * pchName, int32  nData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_SetStat);
+bool  standin_SteamAPI_ISteamUserStats_SetStat(intptr_t  instancePtr, char * pchName, int32  nData)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->SetStat(pchName, nData));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_SetStat0(intptr_t  instancePtr, char * pchName, float  fData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_SetStat0);
+bool  standin_SteamAPI_ISteamUserStats_SetStat0(intptr_t  instancePtr, char * pchName, float  fData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  standin_SteamAPI_ISteamUserStats_UpdateAvgRateStat(intptr_t  instancePtr, char * pchName, float  flCountThisSession, double  dSessionLength) STANDIN_EXPORT(SteamAPI_ISteamUserStats_UpdateAvgRateStat);
+bool  standin_SteamAPI_ISteamUserStats_UpdateAvgRateStat(intptr_t  instancePtr, char * pchName, float  flCountThisSession, double  dSessionLength)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->UpdateAvgRateStat(pchName, flCountThisSession, dSessionLength));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetAchievement(intptr_t  instancePtr, char * pchName, bool * pbAchieved) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetAchievement);
+bool  standin_SteamAPI_ISteamUserStats_GetAchievement(intptr_t  instancePtr, char * pchName, bool * pbAchieved)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetAchievement(pchName, pbAchieved));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_SetAchievement(intptr_t  instancePtr, char * pchName) STANDIN_EXPORT(SteamAPI_ISteamUserStats_SetAchievement);
+bool  standin_SteamAPI_ISteamUserStats_SetAchievement(intptr_t  instancePtr, char * pchName)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->SetAchievement(pchName));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_ClearAchievement(intptr_t  instancePtr, char * pchName) STANDIN_EXPORT(SteamAPI_ISteamUserStats_ClearAchievement);
+bool  standin_SteamAPI_ISteamUserStats_ClearAchievement(intptr_t  instancePtr, char * pchName)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->ClearAchievement(pchName));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime(intptr_t  instancePtr, char * pchName, bool * pbAchieved, uint32 * punUnlockTime) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime);
+bool  standin_SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime(intptr_t  instancePtr, char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetAchievementAndUnlockTime(pchName, pbAchieved, punUnlockTime));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_StoreStats(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUserStats_StoreStats);
+bool  standin_SteamAPI_ISteamUserStats_StoreStats(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->StoreStats());
+}
+
+int  standin_SteamAPI_ISteamUserStats_GetAchievementIcon(intptr_t  instancePtr, char * pchName) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetAchievementIcon);
+int  standin_SteamAPI_ISteamUserStats_GetAchievementIcon(intptr_t  instancePtr, char * pchName)
+{
+  return StandInResult<int>::of(((ISteamUserStatsStandIn *)instancePtr)->GetAchievementIcon(pchName));
+}
+
+char * standin_SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute(intptr_t  instancePtr, char * pchName, char * pchKey) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute);
+char * standin_SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute(intptr_t  instancePtr, char * pchName, char * pchKey)
+{
+  return StandInResult<char *>::of(((ISteamUserStatsStandIn *)instancePtr)->GetAchievementDisplayAttribute(pchName, pchKey));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_IndicateAchievementProgress(intptr_t  instancePtr, char * pchName, uint32  nCurProgress, uint32  nMaxProgress) STANDIN_EXPORT(SteamAPI_ISteamUserStats_IndicateAchievementProgress);
+bool  standin_SteamAPI_ISteamUserStats_IndicateAchievementProgress(intptr_t  instancePtr, char * pchName, uint32  nCurProgress, uint32  nMaxProgress)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->IndicateAchievementProgress(pchName, nCurProgress, nMaxProgress));
+}
+
+uint32  standin_SteamAPI_ISteamUserStats_GetNumAchievements(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetNumAchievements);
+uint32  standin_SteamAPI_ISteamUserStats_GetNumAchievements(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUserStatsStandIn *)instancePtr)->GetNumAchievements());
+}
+
+char * standin_SteamAPI_ISteamUserStats_GetAchievementName(intptr_t  instancePtr, uint32  iAchievement) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetAchievementName);
+char * standin_SteamAPI_ISteamUserStats_GetAchievementName(intptr_t  instancePtr, uint32  iAchievement)
+{
+  return StandInResult<char *>::of(((ISteamUserStatsStandIn *)instancePtr)->GetAchievementName(iAchievement));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_RequestUserStats(intptr_t  instancePtr, CSteamID  steamIDUser) STANDIN_EXPORT(SteamAPI_ISteamUserStats_RequestUserStats);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_RequestUserStats(intptr_t  instancePtr, CSteamID  steamIDUser)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->RequestUserStats(steamIDUser));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetUserStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetUserStat);
+bool  standin_SteamAPI_ISteamUserStats_GetUserStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetUserStat(steamIDUser, pchName, pData));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetUserStat0(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetUserStat0);
+bool  standin_SteamAPI_ISteamUserStats_GetUserStat0(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetUserAchievement);
+bool  standin_SteamAPI_ISteamUserStats_GetUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetUserAchievement(steamIDUser, pchName, pbAchieved));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved, uint32 * punUnlockTime) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime);
+bool  standin_SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetUserAchievementAndUnlockTime(steamIDUser, pchName, pbAchieved, punUnlockTime));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_ResetAllStats(intptr_t  instancePtr, bool  bAchievementsToo) STANDIN_EXPORT(SteamAPI_ISteamUserStats_ResetAllStats);
+bool  standin_SteamAPI_ISteamUserStats_ResetAllStats(intptr_t  instancePtr, bool  bAchievementsToo)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->ResetAllStats(bAchievementsToo));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_FindOrCreateLeaderboard(intptr_t  instancePtr, char * pchLeaderboardName, ELeaderboardSortMethod  eLeaderboardSortMethod, ELeaderboardDisplayType  eLeaderboardDisplayType) STANDIN_EXPORT(SteamAPI_ISteamUserStats_FindOrCreateLeaderboard);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_FindOrCreateLeaderboard(intptr_t  instancePtr, char * pchLeaderboardName, ELeaderboardSortMethod  eLeaderboardSortMethod, ELeaderboardDisplayType  eLeaderboardDisplayType)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->FindOrCreateLeaderboard(pchLeaderboardName, eLeaderboardSortMethod, eLeaderboardDisplayType));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_FindLeaderboard(intptr_t  instancePtr, char * pchLeaderboardName) STANDIN_EXPORT(SteamAPI_ISteamUserStats_FindLeaderboard);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_FindLeaderboard(intptr_t  instancePtr, char * pchLeaderboardName)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->FindLeaderboard(pchLeaderboardName));
+}
+
+char * standin_SteamAPI_ISteamUserStats_GetLeaderboardName(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetLeaderboardName);
+char * standin_SteamAPI_ISteamUserStats_GetLeaderboardName(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
+{
+  return StandInResult<char *>::of(((ISteamUserStatsStandIn *)instancePtr)->GetLeaderboardName(hSteamLeaderboard));
+}
+
+int  standin_SteamAPI_ISteamUserStats_GetLeaderboardEntryCount(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetLeaderboardEntryCount);
+int  standin_SteamAPI_ISteamUserStats_GetLeaderboardEntryCount(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
+{
+  return StandInResult<int>::of(((ISteamUserStatsStandIn *)instancePtr)->GetLeaderboardEntryCount(hSteamLeaderboard));
+}
+
+ELeaderboardSortMethod  standin_SteamAPI_ISteamUserStats_GetLeaderboardSortMethod(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetLeaderboardSortMethod);
+ELeaderboardSortMethod  standin_SteamAPI_ISteamUserStats_GetLeaderboardSortMethod(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
+{
+  return StandInResult<ELeaderboardSortMethod>::of(((ISteamUserStatsStandIn *)instancePtr)->GetLeaderboardSortMethod(hSteamLeaderboard));
+}
+
+ELeaderboardDisplayType  standin_SteamAPI_ISteamUserStats_GetLeaderboardDisplayType(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetLeaderboardDisplayType);
+ELeaderboardDisplayType  standin_SteamAPI_ISteamUserStats_GetLeaderboardDisplayType(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
+{
+  return StandInResult<ELeaderboardDisplayType>::of(((ISteamUserStatsStandIn *)instancePtr)->GetLeaderboardDisplayType(hSteamLeaderboard));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_DownloadLeaderboardEntries(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardDataRequest  eLeaderboardDataRequest, int  nRangeStart, int  nRangeEnd) STANDIN_EXPORT(SteamAPI_ISteamUserStats_DownloadLeaderboardEntries);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_DownloadLeaderboardEntries(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardDataRequest  eLeaderboardDataRequest, int  nRangeStart, int  nRangeEnd)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->DownloadLeaderboardEntries(hSteamLeaderboard, eLeaderboardDataRequest, nRangeStart, nRangeEnd));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, CSteamID * prgUsers, int  cUsers) STANDIN_EXPORT(SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, CSteamID * prgUsers, int  cUsers)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->DownloadLeaderboardEntriesForUsers(hSteamLeaderboard, prgUsers, cUsers));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry(intptr_t  instancePtr, SteamLeaderboardEntries_t  hSteamLeaderboardEntries, int  index, LeaderboardEntry_t * pLeaderboardEntry, int32 * pDetails, int  cDetailsMax) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry);
+bool  standin_SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry(intptr_t  instancePtr, SteamLeaderboardEntries_t  hSteamLeaderboardEntries, int  index, LeaderboardEntry_t * pLeaderboardEntry, int32 * pDetails, int  cDetailsMax)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetDownloadedLeaderboardEntry(hSteamLeaderboardEntries, index, pLeaderboardEntry, pDetails, cDetailsMax));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_UploadLeaderboardScore(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardUploadScoreMethod  eLeaderboardUploadScoreMethod, int32  nScore, int32 * pScoreDetails, int  cScoreDetailsCount) STANDIN_EXPORT(SteamAPI_ISteamUserStats_UploadLeaderboardScore);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_UploadLeaderboardScore(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardUploadScoreMethod  eLeaderboardUploadScoreMethod, int32  nScore, int32 * pScoreDetails, int  cScoreDetailsCount)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->UploadLeaderboardScore(hSteamLeaderboard, eLeaderboardUploadScoreMethod, nScore, pScoreDetails, cScoreDetailsCount));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_AttachLeaderboardUGC(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, UGCHandle_t  hUGC) STANDIN_EXPORT(SteamAPI_ISteamUserStats_AttachLeaderboardUGC);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_AttachLeaderboardUGC(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, UGCHandle_t  hUGC)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->AttachLeaderboardUGC(hSteamLeaderboard, hUGC));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers(intptr_t  instancePtr)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->GetNumberOfCurrentPlayers());
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages(intptr_t  instancePtr)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->RequestGlobalAchievementPercentages());
+}
+
+int  standin_SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo(intptr_t  instancePtr, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo);
+int  standin_SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo(intptr_t  instancePtr, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
+{
+  return StandInResult<int>::of(((ISteamUserStatsStandIn *)instancePtr)->GetMostAchievedAchievementInfo(pchName, unNameBufLen, pflPercent, pbAchieved));
+}
+
+int  standin_SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo(intptr_t  instancePtr, int  iIteratorPrevious, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo);
+int  standin_SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo(intptr_t  instancePtr, int  iIteratorPrevious, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
+{
+  return StandInResult<int>::of(((ISteamUserStatsStandIn *)instancePtr)->GetNextMostAchievedAchievementInfo(iIteratorPrevious, pchName, unNameBufLen, pflPercent, pbAchieved));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetAchievementAchievedPercent(intptr_t  instancePtr, char * pchName, float * pflPercent) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetAchievementAchievedPercent);
+bool  standin_SteamAPI_ISteamUserStats_GetAchievementAchievedPercent(intptr_t  instancePtr, char * pchName, float * pflPercent)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetAchievementAchievedPercent(pchName, pflPercent));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_RequestGlobalStats(intptr_t  instancePtr, int  nHistoryDays) STANDIN_EXPORT(SteamAPI_ISteamUserStats_RequestGlobalStats);
+SteamAPICall_t  standin_SteamAPI_ISteamUserStats_RequestGlobalStats(intptr_t  instancePtr, int  nHistoryDays)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUserStatsStandIn *)instancePtr)->RequestGlobalStats(nHistoryDays));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetGlobalStat(intptr_t  instancePtr, char * pchStatName, int64 * pData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetGlobalStat);
+bool  standin_SteamAPI_ISteamUserStats_GetGlobalStat(intptr_t  instancePtr, char * pchStatName, int64 * pData)
+{
+  return StandInResult<bool>::of(((ISteamUserStatsStandIn *)instancePtr)->GetGlobalStat(pchStatName, pData));
+}
+
+bool  standin_SteamAPI_ISteamUserStats_GetGlobalStat0(intptr_t  instancePtr, char * pchStatName, double * pData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetGlobalStat0);
+bool  standin_SteamAPI_ISteamUserStats_GetGlobalStat0(intptr_t  instancePtr, char * pchStatName, double * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+int32  standin_SteamAPI_ISteamUserStats_GetGlobalStatHistory(intptr_t  instancePtr, char * pchStatName, int64 * pData, uint32  cubData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetGlobalStatHistory);
+int32  standin_SteamAPI_ISteamUserStats_GetGlobalStatHistory(intptr_t  instancePtr, char * pchStatName, int64 * pData, uint32  cubData)
+{
+  return StandInResult<int32>::of(((ISteamUserStatsStandIn *)instancePtr)->GetGlobalStatHistory(pchStatName, pData, cubData));
+}
+
+int32  standin_SteamAPI_ISteamUserStats_GetGlobalStatHistory0(intptr_t  instancePtr, char * pchStatName, double * pData, uint32  cubData) STANDIN_EXPORT(SteamAPI_ISteamUserStats_GetGlobalStatHistory0);
+int32  standin_SteamAPI_ISteamUserStats_GetGlobalStatHistory0(intptr_t  instancePtr, char * pchStatName, double * pData, uint32  cubData)
+{
+  standinLatency();
+  return StandInDefault<int32>::value();
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsSubscribed(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsSubscribed);
+bool  standin_SteamAPI_ISteamApps_BIsSubscribed(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsSubscribed());
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsLowViolence(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsLowViolence);
+bool  standin_SteamAPI_ISteamApps_BIsLowViolence(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsLowViolence());
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsCybercafe(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsCybercafe);
+bool  standin_SteamAPI_ISteamApps_BIsCybercafe(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsCybercafe());
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsVACBanned(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsVACBanned);
+bool  standin_SteamAPI_ISteamApps_BIsVACBanned(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsVACBanned());
+}
+
+char * standin_SteamAPI_ISteamApps_GetCurrentGameLanguage(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_GetCurrentGameLanguage);
+char * standin_SteamAPI_ISteamApps_GetCurrentGameLanguage(intptr_t  instancePtr)
+{
+  return StandInResult<char *>::of(((ISteamAppsStandIn *)instancePtr)->GetCurrentGameLanguage());
+}
+
+char * standin_SteamAPI_ISteamApps_GetAvailableGameLanguages(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_GetAvailableGameLanguages);
+char * standin_SteamAPI_ISteamApps_GetAvailableGameLanguages(intptr_t  instancePtr)
+{
+  return StandInResult<char *>::of(((ISteamAppsStandIn *)instancePtr)->GetAvailableGameLanguages());
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsSubscribedApp(intptr_t  instancePtr, AppId_t  appID) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsSubscribedApp);
+bool  standin_SteamAPI_ISteamApps_BIsSubscribedApp(intptr_t  instancePtr, AppId_t  appID)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsSubscribedApp(appID));
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsDlcInstalled(intptr_t  instancePtr, AppId_t  appID) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsDlcInstalled);
+bool  standin_SteamAPI_ISteamApps_BIsDlcInstalled(intptr_t  instancePtr, AppId_t  appID)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsDlcInstalled(appID));
+}
+
+uint32  standin_SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime(intptr_t  instancePtr, AppId_t  nAppID) STANDIN_EXPORT(SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime);
+uint32  standin_SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime(intptr_t  instancePtr, AppId_t  nAppID)
+{
+  return StandInResult<uint32>::of(((ISteamAppsStandIn *)instancePtr)->GetEarliestPurchaseUnixTime(nAppID));
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend);
+bool  standin_SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsSubscribedFromFreeWeekend());
+}
+
+int  standin_SteamAPI_ISteamApps_GetDLCCount(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_GetDLCCount);
+int  standin_SteamAPI_ISteamApps_GetDLCCount(intptr_t  instancePtr)
+{
+  return StandInResult<int>::of(((ISteamAppsStandIn *)instancePtr)->GetDLCCount());
+}
+
+bool  standin_SteamAPI_ISteamApps_BGetDLCDataByIndex(intptr_t  instancePtr, int  iDLC, AppId_t * pAppID, bool * pbAvailable, char * pchName, int  cchNameBufferSize) STANDIN_EXPORT(SteamAPI_ISteamApps_BGetDLCDataByIndex);
+bool  standin_SteamAPI_ISteamApps_BGetDLCDataByIndex(intptr_t  instancePtr, int  iDLC, AppId_t * pAppID, bool * pbAvailable, char * pchName, int  cchNameBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BGetDLCDataByIndex(iDLC, pAppID, pbAvailable, pchName, cchNameBufferSize));
+}
+
+void  standin_SteamAPI_ISteamApps_InstallDLC(intptr_t  instancePtr, AppId_t  nAppID) STANDIN_EXPORT(SteamAPI_ISteamApps_InstallDLC);
+void  standin_SteamAPI_ISteamApps_InstallDLC(intptr_t  instancePtr, AppId_t  nAppID)
+{
+  ((ISteamAppsStandIn *)instancePtr)->InstallDLC(nAppID);
+}
+
+void  standin_SteamAPI_ISteamApps_UninstallDLC(intptr_t  instancePtr, AppId_t  nAppID) STANDIN_EXPORT(SteamAPI_ISteamApps_UninstallDLC);
+void  standin_SteamAPI_ISteamApps_UninstallDLC(intptr_t  instancePtr, AppId_t  nAppID)
+{
+  ((ISteamAppsStandIn *)instancePtr)->UninstallDLC(nAppID);
+}
+
+void  standin_SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey(intptr_t  instancePtr, AppId_t  nAppID) STANDIN_EXPORT(SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey);
+void  standin_SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey(intptr_t  instancePtr, AppId_t  nAppID)
+{
+  ((ISteamAppsStandIn *)instancePtr)->RequestAppProofOfPurchaseKey(nAppID);
+}
+
+bool  standin_SteamAPI_ISteamApps_GetCurrentBetaName(intptr_t  instancePtr, char * pchName, int  cchNameBufferSize) STANDIN_EXPORT(SteamAPI_ISteamApps_GetCurrentBetaName);
+bool  standin_SteamAPI_ISteamApps_GetCurrentBetaName(intptr_t  instancePtr, char * pchName, int  cchNameBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->GetCurrentBetaName(pchName, cchNameBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamApps_MarkContentCorrupt(intptr_t  instancePtr, bool  bMissingFilesOnly) STANDIN_EXPORT(SteamAPI_ISteamApps_MarkContentCorrupt);
+bool  standin_SteamAPI_ISteamApps_MarkContentCorrupt(intptr_t  instancePtr, bool  bMissingFilesOnly)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->MarkContentCorrupt(bMissingFilesOnly));
+}
+
+uint32  standin_SteamAPI_ISteamApps_GetInstalledDepots(intptr_t  instancePtr, AppId_t  appID, DepotId_t * pvecDepots, uint32  cMaxDepots) STANDIN_EXPORT(SteamAPI_ISteamApps_GetInstalledDepots);
+uint32  standin_SteamAPI_ISteamApps_GetInstalledDepots(intptr_t  instancePtr, AppId_t  appID, DepotId_t * pvecDepots, uint32  cMaxDepots)
+{
+  return StandInResult<uint32>::of(((ISteamAppsStandIn *)instancePtr)->GetInstalledDepots(appID, pvecDepots, cMaxDepots));
+}
+
+uint32  standin_SteamAPI_ISteamApps_GetAppInstallDir(intptr_t  instancePtr, AppId_t  appID, char * pchFolder, uint32  cchFolderBufferSize) STANDIN_EXPORT(SteamAPI_ISteamApps_GetAppInstallDir);
+uint32  standin_SteamAPI_ISteamApps_GetAppInstallDir(intptr_t  instancePtr, AppId_t  appID, char * pchFolder, uint32  cchFolderBufferSize)
+{
+  return StandInResult<uint32>::of(((ISteamAppsStandIn *)instancePtr)->GetAppInstallDir(appID, pchFolder, cchFolderBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamApps_BIsAppInstalled(intptr_t  instancePtr, AppId_t  appID) STANDIN_EXPORT(SteamAPI_ISteamApps_BIsAppInstalled);
+bool  standin_SteamAPI_ISteamApps_BIsAppInstalled(intptr_t  instancePtr, AppId_t  appID)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->BIsAppInstalled(appID));
+}
+
+uint64  standin_SteamAPI_ISteamApps_GetAppOwner(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_GetAppOwner);
+uint64  standin_SteamAPI_ISteamApps_GetAppOwner(intptr_t  instancePtr)
+{
+  return StandInResult<uint64>::of(((ISteamAppsStandIn *)instancePtr)->GetAppOwner());
+}
+
+char * standin_SteamAPI_ISteamApps_GetLaunchQueryParam(intptr_t  instancePtr, char * pchKey) STANDIN_EXPORT(SteamAPI_ISteamApps_GetLaunchQueryParam);
+char * standin_SteamAPI_ISteamApps_GetLaunchQueryParam(intptr_t  instancePtr, char * pchKey)
+{
+  return StandInResult<char *>::of(((ISteamAppsStandIn *)instancePtr)->GetLaunchQueryParam(pchKey));
+}
+
+bool  standin_SteamAPI_ISteamApps_GetDlcDownloadProgress(intptr_t  instancePtr, AppId_t  nAppID, uint64 * punBytesDownloaded, uint64 * punBytesTotal) STANDIN_EXPORT(SteamAPI_ISteamApps_GetDlcDownloadProgress);
+bool  standin_SteamAPI_ISteamApps_GetDlcDownloadProgress(intptr_t  instancePtr, AppId_t  nAppID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
+{
+  return StandInResult<bool>::of(((ISteamAppsStandIn *)instancePtr)->GetDlcDownloadProgress(nAppID, punBytesDownloaded, punBytesTotal));
+}
+
+int  standin_SteamAPI_ISteamApps_GetAppBuildId(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamApps_GetAppBuildId);
+int  standin_SteamAPI_ISteamApps_GetAppBuildId(intptr_t  instancePtr)
+{
+  return StandInResult<int>::of(((ISteamAppsStandIn *)instancePtr)->GetAppBuildId());
+}
+
+bool  standin_SteamAPI_ISteamNetworking_SendP2PPacket(intptr_t  instancePtr, CSteamID  steamIDRemote, void * pubData, uint32  cubData, EP2PSend  eP2PSendType, int  nChannel) STANDIN_EXPORT(SteamAPI_ISteamNetworking_SendP2PPacket);
+bool  standin_SteamAPI_ISteamNetworking_SendP2PPacket(intptr_t  instancePtr, CSteamID  steamIDRemote, void * pubData, uint32  cubData, EP2PSend  eP2PSendType, int  nChannel)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->SendP2PPacket(steamIDRemote, pubData, cubData, eP2PSendType, nChannel));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_IsP2PPacketAvailable(intptr_t  instancePtr, uint32 * pcubMsgSize, int  nChannel) STANDIN_EXPORT(SteamAPI_ISteamNetworking_IsP2PPacketAvailable);
+bool  standin_SteamAPI_ISteamNetworking_IsP2PPacketAvailable(intptr_t  instancePtr, uint32 * pcubMsgSize, int  nChannel)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->IsP2PPacketAvailable(pcubMsgSize, nChannel));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_ReadP2PPacket(intptr_t  instancePtr, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, CSteamID * psteamIDRemote, int  nChannel) STANDIN_EXPORT(SteamAPI_ISteamNetworking_ReadP2PPacket);
+bool  standin_SteamAPI_ISteamNetworking_ReadP2PPacket(intptr_t  instancePtr, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, CSteamID * psteamIDRemote, int  nChannel)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->ReadP2PPacket(pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser(intptr_t  instancePtr, CSteamID  steamIDRemote) STANDIN_EXPORT(SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser);
+bool  standin_SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser(intptr_t  instancePtr, CSteamID  steamIDRemote)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->AcceptP2PSessionWithUser(steamIDRemote));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_CloseP2PSessionWithUser(intptr_t  instancePtr, CSteamID  steamIDRemote) STANDIN_EXPORT(SteamAPI_ISteamNetworking_CloseP2PSessionWithUser);
+bool  standin_SteamAPI_ISteamNetworking_CloseP2PSessionWithUser(intptr_t  instancePtr, CSteamID  steamIDRemote)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->CloseP2PSessionWithUser(steamIDRemote));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_CloseP2PChannelWithUser(intptr_t  instancePtr, CSteamID  steamIDRemote, int  nChannel) STANDIN_EXPORT(SteamAPI_ISteamNetworking_CloseP2PChannelWithUser);
+bool  standin_SteamAPI_ISteamNetworking_CloseP2PChannelWithUser(intptr_t  instancePtr, CSteamID  steamIDRemote, int  nChannel)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->CloseP2PChannelWithUser(steamIDRemote, nChannel));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_GetP2PSessionState(intptr_t  instancePtr, CSteamID  steamIDRemote, P2PSessionState_t * pConnectionState) STANDIN_EXPORT(SteamAPI_ISteamNetworking_GetP2PSessionState);
+bool  standin_SteamAPI_ISteamNetworking_GetP2PSessionState(intptr_t  instancePtr, CSteamID  steamIDRemote, P2PSessionState_t * pConnectionState)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->GetP2PSessionState(steamIDRemote, pConnectionState));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_AllowP2PPacketRelay(intptr_t  instancePtr, bool  bAllow) STANDIN_EXPORT(SteamAPI_ISteamNetworking_AllowP2PPacketRelay);
+bool  standin_SteamAPI_ISteamNetworking_AllowP2PPacketRelay(intptr_t  instancePtr, bool  bAllow)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->AllowP2PPacketRelay(bAllow));
+}
+
+SNetListenSocket_t  standin_SteamAPI_ISteamNetworking_CreateListenSocket(intptr_t  instancePtr, int  nVirtualP2PPort, uint32  nIP, uint16  nPort, bool  bAllowUseOfPacketRelay) STANDIN_EXPORT(SteamAPI_ISteamNetworking_CreateListenSocket);
+SNetListenSocket_t  standin_SteamAPI_ISteamNetworking_CreateListenSocket(intptr_t  instancePtr, int  nVirtualP2PPort, uint32  nIP, uint16  nPort, bool  bAllowUseOfPacketRelay)
+{
+  return StandInResult<SNetListenSocket_t>::of(((ISteamNetworkingStandIn *)instancePtr)->CreateListenSocket(nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay));
+}
+
+SNetSocket_t  standin_SteamAPI_ISteamNetworking_CreateP2PConnectionSocket(intptr_t  instancePtr, CSteamID  steamIDTarget, int  nVirtualPort, int  nTimeoutSec, bool  bAllowUseOfPacketRelay) STANDIN_EXPORT(SteamAPI_ISteamNetworking_CreateP2PConnectionSocket);
+SNetSocket_t  standin_SteamAPI_ISteamNetworking_CreateP2PConnectionSocket(intptr_t  instancePtr, CSteamID  steamIDTarget, int  nVirtualPort, int  nTimeoutSec, bool  bAllowUseOfPacketRelay)
+{
+  return StandInResult<SNetSocket_t>::of(((ISteamNetworkingStandIn *)instancePtr)->CreateP2PConnectionSocket(steamIDTarget, nVirtualPort, nTimeoutSec, bAllowUseOfPacketRelay));
+}
+
+SNetSocket_t  standin_SteamAPI_ISteamNetworking_CreateConnectionSocket(intptr_t  instancePtr, uint32  nIP, uint16  nPort, int  nTimeoutSec) STANDIN_EXPORT(SteamAPI_ISteamNetworking_CreateConnectionSocket);
+SNetSocket_t  standin_SteamAPI_ISteamNetworking_CreateConnectionSocket(intptr_t  instancePtr, uint32  nIP, uint16  nPort, int  nTimeoutSec)
+{
+  return StandInResult<SNetSocket_t>::of(((ISteamNetworkingStandIn *)instancePtr)->CreateConnectionSocket(nIP, nPort, nTimeoutSec));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_DestroySocket(intptr_t  instancePtr, SNetSocket_t  hSocket, bool  bNotifyRemoteEnd) STANDIN_EXPORT(SteamAPI_ISteamNetworking_DestroySocket);
+bool  standin_SteamAPI_ISteamNetworking_DestroySocket(intptr_t  instancePtr, SNetSocket_t  hSocket, bool  bNotifyRemoteEnd)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->DestroySocket(hSocket, bNotifyRemoteEnd));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_DestroyListenSocket(intptr_t  instancePtr, SNetListenSocket_t  hSocket, bool  bNotifyRemoteEnd) STANDIN_EXPORT(SteamAPI_ISteamNetworking_DestroyListenSocket);
+bool  standin_SteamAPI_ISteamNetworking_DestroyListenSocket(intptr_t  instancePtr, SNetListenSocket_t  hSocket, bool  bNotifyRemoteEnd)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->DestroyListenSocket(hSocket, bNotifyRemoteEnd));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_SendDataOnSocket(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubData, uint32  cubData, bool  bReliable) STANDIN_EXPORT(SteamAPI_ISteamNetworking_SendDataOnSocket);
+bool  standin_SteamAPI_ISteamNetworking_SendDataOnSocket(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubData, uint32  cubData, bool  bReliable)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->SendDataOnSocket(hSocket, pubData, cubData, bReliable));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_IsDataAvailableOnSocket(intptr_t  instancePtr, SNetSocket_t  hSocket, uint32 * pcubMsgSize) STANDIN_EXPORT(SteamAPI_ISteamNetworking_IsDataAvailableOnSocket);
+bool  standin_SteamAPI_ISteamNetworking_IsDataAvailableOnSocket(intptr_t  instancePtr, SNetSocket_t  hSocket, uint32 * pcubMsgSize)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->IsDataAvailableOnSocket(hSocket, pcubMsgSize));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_RetrieveDataFromSocket(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize) STANDIN_EXPORT(SteamAPI_ISteamNetworking_RetrieveDataFromSocket);
+bool  standin_SteamAPI_ISteamNetworking_RetrieveDataFromSocket(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->RetrieveDataFromSocket(hSocket, pubDest, cubDest, pcubMsgSize));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_IsDataAvailable(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pcubMsgSize, SNetSocket_t * phSocket) STANDIN_EXPORT(SteamAPI_ISteamNetworking_IsDataAvailable);
+bool  standin_SteamAPI_ISteamNetworking_IsDataAvailable(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pcubMsgSize, SNetSocket_t * phSocket)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->IsDataAvailable(hListenSocket, pcubMsgSize, phSocket));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_RetrieveData(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, SNetSocket_t * phSocket) STANDIN_EXPORT(SteamAPI_ISteamNetworking_RetrieveData);
+bool  standin_SteamAPI_ISteamNetworking_RetrieveData(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, SNetSocket_t * phSocket)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->RetrieveData(hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_GetSocketInfo(intptr_t  instancePtr, SNetSocket_t  hSocket, CSteamID * pSteamIDRemote, int * peSocketStatus, uint32 * punIPRemote, uint16 * punPortRemote) STANDIN_EXPORT(SteamAPI_ISteamNetworking_GetSocketInfo);
+bool  standin_SteamAPI_ISteamNetworking_GetSocketInfo(intptr_t  instancePtr, SNetSocket_t  hSocket, CSteamID * pSteamIDRemote, int * peSocketStatus, uint32 * punIPRemote, uint16 * punPortRemote)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->GetSocketInfo(hSocket, pSteamIDRemote, peSocketStatus, punIPRemote, punPortRemote));
+}
+
+bool  standin_SteamAPI_ISteamNetworking_GetListenSocketInfo(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pnIP, uint16 * pnPort) STANDIN_EXPORT(SteamAPI_ISteamNetworking_GetListenSocketInfo);
+bool  standin_SteamAPI_ISteamNetworking_GetListenSocketInfo(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pnIP, uint16 * pnPort)
+{
+  return StandInResult<bool>::of(((ISteamNetworkingStandIn *)instancePtr)->GetListenSocketInfo(hListenSocket, pnIP, pnPort));
+}
+
+ESNetSocketConnectionType  standin_SteamAPI_ISteamNetworking_GetSocketConnectionType(intptr_t  instancePtr, SNetSocket_t  hSocket) STANDIN_EXPORT(SteamAPI_ISteamNetworking_GetSocketConnectionType);
+ESNetSocketConnectionType  standin_SteamAPI_ISteamNetworking_GetSocketConnectionType(intptr_t  instancePtr, SNetSocket_t  hSocket)
+{
+  return StandInResult<ESNetSocketConnectionType>::of(((ISteamNetworkingStandIn *)instancePtr)->GetSocketConnectionType(hSocket));
+}
+
+int  standin_SteamAPI_ISteamNetworking_GetMaxPacketSize(intptr_t  instancePtr, SNetSocket_t  hSocket) STANDIN_EXPORT(SteamAPI_ISteamNetworking_GetMaxPacketSize);
+int  standin_SteamAPI_ISteamNetworking_GetMaxPacketSize(intptr_t  instancePtr, SNetSocket_t  hSocket)
+{
+  return StandInResult<int>::of(((ISteamNetworkingStandIn *)instancePtr)->GetMaxPacketSize(hSocket));
+}
+
+ScreenshotHandle  standin_SteamAPI_ISteamScreenshots_WriteScreenshot(intptr_t  instancePtr, void * pubRGB, uint32  cubRGB, int  nWidth, int  nHeight) STANDIN_EXPORT(SteamAPI_ISteamScreenshots_WriteScreenshot);
+ScreenshotHandle  standin_SteamAPI_ISteamScreenshots_WriteScreenshot(intptr_t  instancePtr, void * pubRGB, uint32  cubRGB, int  nWidth, int  nHeight)
+{
+  return StandInResult<ScreenshotHandle>::of(((ISteamScreenshotsStandIn *)instancePtr)->WriteScreenshot(pubRGB, cubRGB, nWidth, nHeight));
+}
+
+ScreenshotHandle  standin_SteamAPI_ISteamScreenshots_AddScreenshotToLibrary(intptr_t  instancePtr, char * pchFilename, char * pchThumbnailFilename, int  nWidth, int  nHeight) STANDIN_EXPORT(SteamAPI_ISteamScreenshots_AddScreenshotToLibrary);
+ScreenshotHandle  standin_SteamAPI_ISteamScreenshots_AddScreenshotToLibrary(intptr_t  instancePtr, char * pchFilename, char * pchThumbnailFilename, int  nWidth, int  nHeight)
+{
+  return StandInResult<ScreenshotHandle>::of(((ISteamScreenshotsStandIn *)instancePtr)->AddScreenshotToLibrary(pchFilename, pchThumbnailFilename, nWidth, nHeight));
+}
+
+void  standin_SteamAPI_ISteamScreenshots_TriggerScreenshot(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamScreenshots_TriggerScreenshot);
+void  standin_SteamAPI_ISteamScreenshots_TriggerScreenshot(intptr_t  instancePtr)
+{
+  ((ISteamScreenshotsStandIn *)instancePtr)->TriggerScreenshot();
+}
+
+void  standin_SteamAPI_ISteamScreenshots_HookScreenshots(intptr_t  instancePtr, bool  bHook) STANDIN_EXPORT(SteamAPI_ISteamScreenshots_HookScreenshots);
+void  standin_SteamAPI_ISteamScreenshots_HookScreenshots(intptr_t  instancePtr, bool  bHook)
+{
+  ((ISteamScreenshotsStandIn *)instancePtr)->HookScreenshots(bHook);
+}
+
+bool  standin_SteamAPI_ISteamScreenshots_SetLocation(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, char * pchLocation) STANDIN_EXPORT(SteamAPI_ISteamScreenshots_SetLocation);
+bool  standin_SteamAPI_ISteamScreenshots_SetLocation(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, char * pchLocation)
+{
+  return StandInResult<bool>::of(((ISteamScreenshotsStandIn *)instancePtr)->SetLocation(hScreenshot, pchLocation));
+}
+
+bool  standin_SteamAPI_ISteamScreenshots_TagUser(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamScreenshots_TagUser);
+bool  standin_SteamAPI_ISteamScreenshots_TagUser(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, CSteamID  steamID)
+{
+  return StandInResult<bool>::of(((ISteamScreenshotsStandIn *)instancePtr)->TagUser(hScreenshot, steamID));
+}
+
+bool  standin_SteamAPI_ISteamScreenshots_TagPublishedFile(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, PublishedFileId_t  unPublishedFileID) STANDIN_EXPORT(SteamAPI_ISteamScreenshots_TagPublishedFile);
+bool  standin_SteamAPI_ISteamScreenshots_TagPublishedFile(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, PublishedFileId_t  unPublishedFileID)
+{
+  return StandInResult<bool>::of(((ISteamScreenshotsStandIn *)instancePtr)->TagPublishedFile(hScreenshot, unPublishedFileID));
+}
+
+bool  standin_SteamAPI_ISteamMusic_BIsEnabled(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_BIsEnabled);
+bool  standin_SteamAPI_ISteamMusic_BIsEnabled(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicStandIn *)instancePtr)->BIsEnabled());
+}
+
+bool  standin_SteamAPI_ISteamMusic_BIsPlaying(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_BIsPlaying);
+bool  standin_SteamAPI_ISteamMusic_BIsPlaying(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicStandIn *)instancePtr)->BIsPlaying());
+}
+
+AudioPlayback_Status  standin_SteamAPI_ISteamMusic_GetPlaybackStatus(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_GetPlaybackStatus);
+AudioPlayback_Status  standin_SteamAPI_ISteamMusic_GetPlaybackStatus(intptr_t  instancePtr)
+{
+  return StandInResult<AudioPlayback_Status>::of(((ISteamMusicStandIn *)instancePtr)->GetPlaybackStatus());
+}
+
+void  standin_SteamAPI_ISteamMusic_Play(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_Play);
+void  standin_SteamAPI_ISteamMusic_Play(intptr_t  instancePtr)
+{
+  ((ISteamMusicStandIn *)instancePtr)->Play();
+}
+
+void  standin_SteamAPI_ISteamMusic_Pause(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_Pause);
+void  standin_SteamAPI_ISteamMusic_Pause(intptr_t  instancePtr)
+{
+  ((ISteamMusicStandIn *)instancePtr)->Pause();
+}
+
+void  standin_SteamAPI_ISteamMusic_PlayPrevious(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_PlayPrevious);
+void  standin_SteamAPI_ISteamMusic_PlayPrevious(intptr_t  instancePtr)
+{
+  ((ISteamMusicStandIn *)instancePtr)->PlayPrevious();
+}
+
+void  standin_SteamAPI_ISteamMusic_PlayNext(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_PlayNext);
+void  standin_SteamAPI_ISteamMusic_PlayNext(intptr_t  instancePtr)
+{
+  ((ISteamMusicStandIn *)instancePtr)->PlayNext();
+}
+
+void  standin_SteamAPI_ISteamMusic_SetVolume(intptr_t  instancePtr, float  flVolume) STANDIN_EXPORT(SteamAPI_ISteamMusic_SetVolume);
+void  standin_SteamAPI_ISteamMusic_SetVolume(intptr_t  instancePtr, float  flVolume)
+{
+  ((ISteamMusicStandIn *)instancePtr)->SetVolume(flVolume);
+}
+
+float  standin_SteamAPI_ISteamMusic_GetVolume(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusic_GetVolume);
+float  standin_SteamAPI_ISteamMusic_GetVolume(intptr_t  instancePtr)
+{
+  return StandInResult<float>::of(((ISteamMusicStandIn *)instancePtr)->GetVolume());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote(intptr_t  instancePtr, char * pchName) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote);
+bool  standin_SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote(intptr_t  instancePtr, char * pchName)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->RegisterSteamMusicRemote(pchName));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote);
+bool  standin_SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->DeregisterSteamMusicRemote());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote);
+bool  standin_SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->BIsCurrentMusicRemote());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_BActivationSuccess(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_BActivationSuccess);
+bool  standin_SteamAPI_ISteamMusicRemote_BActivationSuccess(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->BActivationSuccess(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_SetDisplayName(intptr_t  instancePtr, char * pchDisplayName) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_SetDisplayName);
+bool  standin_SteamAPI_ISteamMusicRemote_SetDisplayName(intptr_t  instancePtr, char * pchDisplayName)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->SetDisplayName(pchDisplayName));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64);
+bool  standin_SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->SetPNGIcon_64x64(pvBuffer, cbBufferLength));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_EnablePlayPrevious(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_EnablePlayPrevious);
+bool  standin_SteamAPI_ISteamMusicRemote_EnablePlayPrevious(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->EnablePlayPrevious(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_EnablePlayNext(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_EnablePlayNext);
+bool  standin_SteamAPI_ISteamMusicRemote_EnablePlayNext(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->EnablePlayNext(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_EnableShuffled(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_EnableShuffled);
+bool  standin_SteamAPI_ISteamMusicRemote_EnableShuffled(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->EnableShuffled(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_EnableLooped(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_EnableLooped);
+bool  standin_SteamAPI_ISteamMusicRemote_EnableLooped(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->EnableLooped(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_EnableQueue(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_EnableQueue);
+bool  standin_SteamAPI_ISteamMusicRemote_EnableQueue(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->EnableQueue(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_EnablePlaylists(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_EnablePlaylists);
+bool  standin_SteamAPI_ISteamMusicRemote_EnablePlaylists(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->EnablePlaylists(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus(intptr_t  instancePtr, AudioPlayback_Status  nStatus) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus);
+bool  standin_SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus(intptr_t  instancePtr, AudioPlayback_Status  nStatus)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->UpdatePlaybackStatus(nStatus));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateShuffled(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_UpdateShuffled);
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateShuffled(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->UpdateShuffled(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateLooped(intptr_t  instancePtr, bool  bValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_UpdateLooped);
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateLooped(intptr_t  instancePtr, bool  bValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->UpdateLooped(bValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateVolume(intptr_t  instancePtr, float  flValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_UpdateVolume);
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateVolume(intptr_t  instancePtr, float  flValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->UpdateVolume(flValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_CurrentEntryWillChange(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_CurrentEntryWillChange);
+bool  standin_SteamAPI_ISteamMusicRemote_CurrentEntryWillChange(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->CurrentEntryWillChange());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable(intptr_t  instancePtr, bool  bAvailable) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable);
+bool  standin_SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable(intptr_t  instancePtr, bool  bAvailable)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->CurrentEntryIsAvailable(bAvailable));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText(intptr_t  instancePtr, char * pchText) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText);
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText(intptr_t  instancePtr, char * pchText)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->UpdateCurrentEntryText(pchText));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds(intptr_t  instancePtr, int  nValue) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds);
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds(intptr_t  instancePtr, int  nValue)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->UpdateCurrentEntryElapsedSeconds(nValue));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt);
+bool  standin_SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->UpdateCurrentEntryCoverArt(pvBuffer, cbBufferLength));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_CurrentEntryDidChange(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_CurrentEntryDidChange);
+bool  standin_SteamAPI_ISteamMusicRemote_CurrentEntryDidChange(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->CurrentEntryDidChange());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_QueueWillChange(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_QueueWillChange);
+bool  standin_SteamAPI_ISteamMusicRemote_QueueWillChange(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->QueueWillChange());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_ResetQueueEntries(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_ResetQueueEntries);
+bool  standin_SteamAPI_ISteamMusicRemote_ResetQueueEntries(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->ResetQueueEntries());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_SetQueueEntry(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_SetQueueEntry);
+bool  standin_SteamAPI_ISteamMusicRemote_SetQueueEntry(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->SetQueueEntry(nID, nPosition, pchEntryText));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry(intptr_t  instancePtr, int  nID) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry);
+bool  standin_SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry(intptr_t  instancePtr, int  nID)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->SetCurrentQueueEntry(nID));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_QueueDidChange(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_QueueDidChange);
+bool  standin_SteamAPI_ISteamMusicRemote_QueueDidChange(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->QueueDidChange());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_PlaylistWillChange(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_PlaylistWillChange);
+bool  standin_SteamAPI_ISteamMusicRemote_PlaylistWillChange(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->PlaylistWillChange());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_ResetPlaylistEntries(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_ResetPlaylistEntries);
+bool  standin_SteamAPI_ISteamMusicRemote_ResetPlaylistEntries(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->ResetPlaylistEntries());
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_SetPlaylistEntry(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_SetPlaylistEntry);
+bool  standin_SteamAPI_ISteamMusicRemote_SetPlaylistEntry(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->SetPlaylistEntry(nID, nPosition, pchEntryText));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry(intptr_t  instancePtr, int  nID) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry);
+bool  standin_SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry(intptr_t  instancePtr, int  nID)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->SetCurrentPlaylistEntry(nID));
+}
+
+bool  standin_SteamAPI_ISteamMusicRemote_PlaylistDidChange(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamMusicRemote_PlaylistDidChange);
+bool  standin_SteamAPI_ISteamMusicRemote_PlaylistDidChange(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamMusicRemoteStandIn *)instancePtr)->PlaylistDidChange());
+}
+
+HTTPRequestHandle  standin_SteamAPI_ISteamHTTP_CreateHTTPRequest(intptr_t  instancePtr, EHTTPMethod  eHTTPRequestMethod, char * pchAbsoluteURL) STANDIN_EXPORT(SteamAPI_ISteamHTTP_CreateHTTPRequest);
+HTTPRequestHandle  standin_SteamAPI_ISteamHTTP_CreateHTTPRequest(intptr_t  instancePtr, EHTTPMethod  eHTTPRequestMethod, char * pchAbsoluteURL)
+{
+  return StandInResult<HTTPRequestHandle>::of(((ISteamHTTPStandIn *)instancePtr)->CreateHTTPRequest(eHTTPRequestMethod, pchAbsoluteURL));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestContextValue(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint64  ulContextValue) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestContextValue);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestContextValue(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint64  ulContextValue)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestContextValue(hRequest, ulContextValue));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unTimeoutSeconds) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unTimeoutSeconds)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestNetworkActivityTimeout(hRequest, unTimeoutSeconds));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, char * pchHeaderValue) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, char * pchHeaderValue)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestHeaderValue(hRequest, pchHeaderName, pchHeaderValue));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchParamName, char * pchParamValue) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchParamName, char * pchParamValue)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestGetOrPostParameter(hRequest, pchParamName, pchParamValue));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SendHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SendHTTPRequest);
+bool  standin_SteamAPI_ISteamHTTP_SendHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SendHTTPRequest(hRequest, pCallHandle));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse);
+bool  standin_SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SendHTTPRequestAndStreamResponse(hRequest, pCallHandle));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_DeferHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest) STANDIN_EXPORT(SteamAPI_ISteamHTTP_DeferHTTPRequest);
+bool  standin_SteamAPI_ISteamHTTP_DeferHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->DeferHTTPRequest(hRequest));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_PrioritizeHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest) STANDIN_EXPORT(SteamAPI_ISteamHTTP_PrioritizeHTTPRequest);
+bool  standin_SteamAPI_ISteamHTTP_PrioritizeHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->PrioritizeHTTPRequest(hRequest));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint32 * unResponseHeaderSize) STANDIN_EXPORT(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize);
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint32 * unResponseHeaderSize)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->GetHTTPResponseHeaderSize(hRequest, pchHeaderName, unResponseHeaderSize));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint8 * pHeaderValueBuffer, uint32  unBufferSize) STANDIN_EXPORT(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue);
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint8 * pHeaderValueBuffer, uint32  unBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->GetHTTPResponseHeaderValue(hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseBodySize(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32 * unBodySize) STANDIN_EXPORT(SteamAPI_ISteamHTTP_GetHTTPResponseBodySize);
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseBodySize(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32 * unBodySize)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->GetHTTPResponseBodySize(hRequest, unBodySize));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseBodyData(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint8 * pBodyDataBuffer, uint32  unBufferSize) STANDIN_EXPORT(SteamAPI_ISteamHTTP_GetHTTPResponseBodyData);
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPResponseBodyData(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint8 * pBodyDataBuffer, uint32  unBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->GetHTTPResponseBodyData(hRequest, pBodyDataBuffer, unBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  cOffset, uint8 * pBodyDataBuffer, uint32  unBufferSize) STANDIN_EXPORT(SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData);
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  cOffset, uint8 * pBodyDataBuffer, uint32  unBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->GetHTTPStreamingResponseBodyData(hRequest, cOffset, pBodyDataBuffer, unBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_ReleaseHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest) STANDIN_EXPORT(SteamAPI_ISteamHTTP_ReleaseHTTPRequest);
+bool  standin_SteamAPI_ISteamHTTP_ReleaseHTTPRequest(intptr_t  instancePtr, HTTPRequestHandle  hRequest)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->ReleaseHTTPRequest(hRequest));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct(intptr_t  instancePtr, HTTPRequestHandle  hRequest, float * pflPercentOut) STANDIN_EXPORT(SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct);
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct(intptr_t  instancePtr, HTTPRequestHandle  hRequest, float * pflPercentOut)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->GetHTTPDownloadProgressPct(hRequest, pflPercentOut));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchContentType, uint8 * pubBody, uint32  unBodyLen) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchContentType, uint8 * pubBody, uint32  unBodyLen)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestRawPostBody(hRequest, pchContentType, pubBody, unBodyLen));
+}
+
+HTTPCookieContainerHandle  standin_SteamAPI_ISteamHTTP_CreateCookieContainer(intptr_t  instancePtr, bool  bAllowResponsesToModify) STANDIN_EXPORT(SteamAPI_ISteamHTTP_CreateCookieContainer);
+HTTPCookieContainerHandle  standin_SteamAPI_ISteamHTTP_CreateCookieContainer(intptr_t  instancePtr, bool  bAllowResponsesToModify)
+{
+  return StandInResult<HTTPCookieContainerHandle>::of(((ISteamHTTPStandIn *)instancePtr)->CreateCookieContainer(bAllowResponsesToModify));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_ReleaseCookieContainer(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer) STANDIN_EXPORT(SteamAPI_ISteamHTTP_ReleaseCookieContainer);
+bool  standin_SteamAPI_ISteamHTTP_ReleaseCookieContainer(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->ReleaseCookieContainer(hCookieContainer));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetCookie(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer, char * pchHost, char * pchUrl, char * pchCookie) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetCookie);
+bool  standin_SteamAPI_ISteamHTTP_SetCookie(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer, char * pchHost, char * pchUrl, char * pchCookie)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetCookie(hCookieContainer, pchHost, pchUrl, pchCookie));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer(intptr_t  instancePtr, HTTPRequestHandle  hRequest, HTTPCookieContainerHandle  hCookieContainer) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer(intptr_t  instancePtr, HTTPRequestHandle  hRequest, HTTPCookieContainerHandle  hCookieContainer)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestCookieContainer(hRequest, hCookieContainer));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchUserAgentInfo) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchUserAgentInfo)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestUserAgentInfo(hRequest, pchUserAgentInfo));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool  bRequireVerifiedCertificate) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool  bRequireVerifiedCertificate)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestRequiresVerifiedCertificate(hRequest, bRequireVerifiedCertificate));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unMilliseconds) STANDIN_EXPORT(SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS);
+bool  standin_SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unMilliseconds)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->SetHTTPRequestAbsoluteTimeoutMS(hRequest, unMilliseconds));
+}
+
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool * pbWasTimedOut) STANDIN_EXPORT(SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut);
+bool  standin_SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool * pbWasTimedOut)
+{
+  return StandInResult<bool>::of(((ISteamHTTPStandIn *)instancePtr)->GetHTTPRequestWasTimedOut(hRequest, pbWasTimedOut));
+}
+
+ClientUnifiedMessageHandle  standin_SteamAPI_ISteamUnifiedMessages_SendMethod(intptr_t  instancePtr, char * pchServiceMethod, void * pRequestBuffer, uint32  unRequestBufferSize, uint64  unContext) STANDIN_EXPORT(SteamAPI_ISteamUnifiedMessages_SendMethod);
+ClientUnifiedMessageHandle  standin_SteamAPI_ISteamUnifiedMessages_SendMethod(intptr_t  instancePtr, char * pchServiceMethod, void * pRequestBuffer, uint32  unRequestBufferSize, uint64  unContext)
+{
+  return StandInResult<ClientUnifiedMessageHandle>::of(((ISteamUnifiedMessagesStandIn *)instancePtr)->SendMethod(pchServiceMethod, pRequestBuffer, unRequestBufferSize, unContext));
+}
+
+bool  standin_SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, uint32 * punResponseSize, EResult * peResult) STANDIN_EXPORT(SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo);
+bool  standin_SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, uint32 * punResponseSize, EResult * peResult)
+{
+  return StandInResult<bool>::of(((ISteamUnifiedMessagesStandIn *)instancePtr)->GetMethodResponseInfo(hHandle, punResponseSize, peResult));
+}
+
+bool  standin_SteamAPI_ISteamUnifiedMessages_GetMethodResponseData(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, void * pResponseBuffer, uint32  unResponseBufferSize, bool  bAutoRelease) STANDIN_EXPORT(SteamAPI_ISteamUnifiedMessages_GetMethodResponseData);
+bool  standin_SteamAPI_ISteamUnifiedMessages_GetMethodResponseData(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, void * pResponseBuffer, uint32  unResponseBufferSize, bool  bAutoRelease)
+{
+  return StandInResult<bool>::of(((ISteamUnifiedMessagesStandIn *)instancePtr)->GetMethodResponseData(hHandle, pResponseBuffer, unResponseBufferSize, bAutoRelease));
+}
+
+bool  standin_SteamAPI_ISteamUnifiedMessages_ReleaseMethod(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle) STANDIN_EXPORT(SteamAPI_ISteamUnifiedMessages_ReleaseMethod);
+bool  standin_SteamAPI_ISteamUnifiedMessages_ReleaseMethod(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle)
+{
+  return StandInResult<bool>::of(((ISteamUnifiedMessagesStandIn *)instancePtr)->ReleaseMethod(hHandle));
+}
+
+bool  standin_SteamAPI_ISteamUnifiedMessages_SendNotification(intptr_t  instancePtr, char * pchServiceNotification, void * pNotificationBuffer, uint32  unNotificationBufferSize) STANDIN_EXPORT(SteamAPI_ISteamUnifiedMessages_SendNotification);
+bool  standin_SteamAPI_ISteamUnifiedMessages_SendNotification(intptr_t  instancePtr, char * pchServiceNotification, void * pNotificationBuffer, uint32  unNotificationBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamUnifiedMessagesStandIn *)instancePtr)->SendNotification(pchServiceNotification, pNotificationBuffer, unNotificationBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamController_Init(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamController_Init);
+bool  standin_SteamAPI_ISteamController_Init(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamControllerStandIn *)instancePtr)->Init());
+}
+
+bool  standin_SteamAPI_ISteamController_Shutdown(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamController_Shutdown);
+bool  standin_SteamAPI_ISteamController_Shutdown(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamControllerStandIn *)instancePtr)->Shutdown());
+}
+
+void  standin_SteamAPI_ISteamController_RunFrame(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamController_RunFrame);
+void  standin_SteamAPI_ISteamController_RunFrame(intptr_t  instancePtr)
+{
+  ((ISteamControllerStandIn *)instancePtr)->RunFrame();
+}
+
+void  standin_SteamAPI_ISteamController_TriggerHapticPulse(intptr_t  instancePtr, ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec) STANDIN_EXPORT(SteamAPI_ISteamController_TriggerHapticPulse);
+void  standin_SteamAPI_ISteamController_TriggerHapticPulse(intptr_t  instancePtr, ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec)
+{
+  ((ISteamControllerStandIn *)instancePtr)->TriggerHapticPulse(controllerHandle, eTargetPad, usDurationMicroSec);
+}
+
+UGCQueryHandle_t  standin_SteamAPI_ISteamUGC_CreateQueryUserUGCRequest(intptr_t  instancePtr, AccountID_t  unAccountID, EUserUGCList  eListType, EUGCMatchingUGCType  eMatchingUGCType, EUserUGCListSortOrder  eSortOrder, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage) STANDIN_EXPORT(SteamAPI_ISteamUGC_CreateQueryUserUGCRequest);
+UGCQueryHandle_t  standin_SteamAPI_ISteamUGC_CreateQueryUserUGCRequest(intptr_t  instancePtr, AccountID_t  unAccountID, EUserUGCList  eListType, EUGCMatchingUGCType  eMatchingUGCType, EUserUGCListSortOrder  eSortOrder, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
+{
+  return StandInResult<UGCQueryHandle_t>::of(((ISteamUGCStandIn *)instancePtr)->CreateQueryUserUGCRequest(unAccountID, eListType, eMatchingUGCType, eSortOrder, nCreatorAppID, nConsumerAppID, unPage));
+}
+
+UGCQueryHandle_t  standin_SteamAPI_ISteamUGC_CreateQueryAllUGCRequest(intptr_t  instancePtr, EUGCQuery  eQueryType, EUGCMatchingUGCType  eMatchingeMatchingUGCTypeFileType, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage) STANDIN_EXPORT(SteamAPI_ISteamUGC_CreateQueryAllUGCRequest);
+UGCQueryHandle_t  standin_SteamAPI_ISteamUGC_CreateQueryAllUGCRequest(intptr_t  instancePtr, EUGCQuery  eQueryType, EUGCMatchingUGCType  eMatchingeMatchingUGCTypeFileType, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
+{
+  return StandInResult<UGCQueryHandle_t>::of(((ISteamUGCStandIn *)instancePtr)->CreateQueryAllUGCRequest(eQueryType, eMatchingeMatchingUGCTypeFileType, nCreatorAppID, nConsumerAppID, unPage));
+}
+
+UGCQueryHandle_t  standin_SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs) STANDIN_EXPORT(SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest);
+UGCQueryHandle_t  standin_SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
+{
+  return StandInResult<UGCQueryHandle_t>::of(((ISteamUGCStandIn *)instancePtr)->CreateQueryUGCDetailsRequest(pvecPublishedFileID, unNumPublishedFileIDs));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_SendQueryUGCRequest(intptr_t  instancePtr, UGCQueryHandle_t  handle) STANDIN_EXPORT(SteamAPI_ISteamUGC_SendQueryUGCRequest);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_SendQueryUGCRequest(intptr_t  instancePtr, UGCQueryHandle_t  handle)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->SendQueryUGCRequest(handle));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCResult(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, SteamUGCDetails_t * pDetails) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetQueryUGCResult);
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCResult(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, SteamUGCDetails_t * pDetails)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetQueryUGCResult(handle, index, pDetails));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCPreviewURL(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchURL, uint32  cchURLSize) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetQueryUGCPreviewURL);
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCPreviewURL(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchURL, uint32  cchURLSize)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetQueryUGCPreviewURL(handle, index, pchURL, cchURLSize));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCMetadata(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchMetadata, uint32  cchMetadatasize) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetQueryUGCMetadata);
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCMetadata(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchMetadata, uint32  cchMetadatasize)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetQueryUGCMetadata(handle, index, pchMetadata, cchMetadatasize));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCChildren(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetQueryUGCChildren);
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCChildren(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetQueryUGCChildren(handle, index, pvecPublishedFileID, cMaxEntries));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCStatistic(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, EItemStatistic  eStatType, uint64 * pStatValue) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetQueryUGCStatistic);
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCStatistic(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, EItemStatistic  eStatType, uint64 * pStatValue)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetQueryUGCStatistic(handle, index, eStatType, pStatValue));
+}
+
+uint32  standin_SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews);
+uint32  standin_SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index)
+{
+  return StandInResult<uint32>::of(((ISteamUGCStandIn *)instancePtr)->GetQueryUGCNumAdditionalPreviews(handle, index));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, uint32  previewIndex, char * pchURLOrVideoID, uint32  cchURLSize, char * pchOriginalFileName, uint32  cchOriginalFileNameSize, EItemPreviewType * pPreviewType) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview);
+bool  standin_SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, uint32  previewIndex, char * pchURLOrVideoID, uint32  cchURLSize, char * pchOriginalFileName, uint32  cchOriginalFileNameSize, EItemPreviewType * pPreviewType)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetQueryUGCAdditionalPreview(handle, index, previewIndex, pchURLOrVideoID, cchURLSize, pchOriginalFileName, cchOriginalFileNameSize, pPreviewType));
+}
+
+bool  standin_SteamAPI_ISteamUGC_ReleaseQueryUGCRequest(intptr_t  instancePtr, UGCQueryHandle_t  handle) STANDIN_EXPORT(SteamAPI_ISteamUGC_ReleaseQueryUGCRequest);
+bool  standin_SteamAPI_ISteamUGC_ReleaseQueryUGCRequest(intptr_t  instancePtr, UGCQueryHandle_t  handle)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->ReleaseQueryUGCRequest(handle));
+}
+
+bool  standin_SteamAPI_ISteamUGC_AddRequiredTag(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName) STANDIN_EXPORT(SteamAPI_ISteamUGC_AddRequiredTag);
+bool  standin_SteamAPI_ISteamUGC_AddRequiredTag(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->AddRequiredTag(handle, pTagName));
+}
+
+bool  standin_SteamAPI_ISteamUGC_AddExcludedTag(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName) STANDIN_EXPORT(SteamAPI_ISteamUGC_AddExcludedTag);
+bool  standin_SteamAPI_ISteamUGC_AddExcludedTag(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->AddExcludedTag(handle, pTagName));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetReturnLongDescription(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnLongDescription) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetReturnLongDescription);
+bool  standin_SteamAPI_ISteamUGC_SetReturnLongDescription(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnLongDescription)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetReturnLongDescription(handle, bReturnLongDescription));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetReturnMetadata(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnMetadata) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetReturnMetadata);
+bool  standin_SteamAPI_ISteamUGC_SetReturnMetadata(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnMetadata)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetReturnMetadata(handle, bReturnMetadata));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetReturnChildren(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnChildren) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetReturnChildren);
+bool  standin_SteamAPI_ISteamUGC_SetReturnChildren(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnChildren)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetReturnChildren(handle, bReturnChildren));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetReturnAdditionalPreviews(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnAdditionalPreviews) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetReturnAdditionalPreviews);
+bool  standin_SteamAPI_ISteamUGC_SetReturnAdditionalPreviews(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnAdditionalPreviews)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetReturnAdditionalPreviews(handle, bReturnAdditionalPreviews));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetReturnTotalOnly(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnTotalOnly) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetReturnTotalOnly);
+bool  standin_SteamAPI_ISteamUGC_SetReturnTotalOnly(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnTotalOnly)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetReturnTotalOnly(handle, bReturnTotalOnly));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetAllowCachedResponse(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unMaxAgeSeconds) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetAllowCachedResponse);
+bool  standin_SteamAPI_ISteamUGC_SetAllowCachedResponse(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unMaxAgeSeconds)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetAllowCachedResponse(handle, unMaxAgeSeconds));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetCloudFileNameFilter(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pMatchCloudFileName) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetCloudFileNameFilter);
+bool  standin_SteamAPI_ISteamUGC_SetCloudFileNameFilter(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pMatchCloudFileName)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetCloudFileNameFilter(handle, pMatchCloudFileName));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetMatchAnyTag(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bMatchAnyTag) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetMatchAnyTag);
+bool  standin_SteamAPI_ISteamUGC_SetMatchAnyTag(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bMatchAnyTag)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetMatchAnyTag(handle, bMatchAnyTag));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetSearchText(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pSearchText) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetSearchText);
+bool  standin_SteamAPI_ISteamUGC_SetSearchText(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pSearchText)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetSearchText(handle, pSearchText));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetRankedByTrendDays(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unDays) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetRankedByTrendDays);
+bool  standin_SteamAPI_ISteamUGC_SetRankedByTrendDays(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unDays)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetRankedByTrendDays(handle, unDays));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_RequestUGCDetails(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint32  unMaxAgeSeconds) STANDIN_EXPORT(SteamAPI_ISteamUGC_RequestUGCDetails);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_RequestUGCDetails(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint32  unMaxAgeSeconds)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->RequestUGCDetails(nPublishedFileID, unMaxAgeSeconds));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_CreateItem(intptr_t  instancePtr, AppId_t  nConsumerAppId, EWorkshopFileType  eFileType) STANDIN_EXPORT(SteamAPI_ISteamUGC_CreateItem);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_CreateItem(intptr_t  instancePtr, AppId_t  nConsumerAppId, EWorkshopFileType  eFileType)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->CreateItem(nConsumerAppId, eFileType));
+}
+
+UGCUpdateHandle_t  standin_SteamAPI_ISteamUGC_StartItemUpdate(intptr_t  instancePtr, AppId_t  nConsumerAppId, PublishedFileId_t  nPublishedFileID) STANDIN_EXPORT(SteamAPI_ISteamUGC_StartItemUpdate);
+UGCUpdateHandle_t  standin_SteamAPI_ISteamUGC_StartItemUpdate(intptr_t  instancePtr, AppId_t  nConsumerAppId, PublishedFileId_t  nPublishedFileID)
+{
+  return StandInResult<UGCUpdateHandle_t>::of(((ISteamUGCStandIn *)instancePtr)->StartItemUpdate(nConsumerAppId, nPublishedFileID));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetItemTitle(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchTitle) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetItemTitle);
+bool  standin_SteamAPI_ISteamUGC_SetItemTitle(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchTitle)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetItemTitle(handle, pchTitle));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetItemDescription(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchDescription) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetItemDescription);
+bool  standin_SteamAPI_ISteamUGC_SetItemDescription(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchDescription)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetItemDescription(handle, pchDescription));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetItemMetadata(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchMetaData) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetItemMetadata);
+bool  standin_SteamAPI_ISteamUGC_SetItemMetadata(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchMetaData)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetItemMetadata(handle, pchMetaData));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetItemVisibility(intptr_t  instancePtr, UGCUpdateHandle_t  handle, ERemoteStoragePublishedFileVisibility  eVisibility) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetItemVisibility);
+bool  standin_SteamAPI_ISteamUGC_SetItemVisibility(intptr_t  instancePtr, UGCUpdateHandle_t  handle, ERemoteStoragePublishedFileVisibility  eVisibility)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetItemVisibility(handle, eVisibility));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetItemTags(intptr_t  instancePtr, UGCUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetItemTags);
+bool  standin_SteamAPI_ISteamUGC_SetItemTags(intptr_t  instancePtr, UGCUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetItemTags(updateHandle, pTags));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetItemContent(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszContentFolder) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetItemContent);
+bool  standin_SteamAPI_ISteamUGC_SetItemContent(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszContentFolder)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetItemContent(handle, pszContentFolder));
+}
+
+bool  standin_SteamAPI_ISteamUGC_SetItemPreview(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszPreviewFile) STANDIN_EXPORT(SteamAPI_ISteamUGC_SetItemPreview);
+bool  standin_SteamAPI_ISteamUGC_SetItemPreview(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszPreviewFile)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->SetItemPreview(handle, pszPreviewFile));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_SubmitItemUpdate(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchChangeNote) STANDIN_EXPORT(SteamAPI_ISteamUGC_SubmitItemUpdate);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_SubmitItemUpdate(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchChangeNote)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->SubmitItemUpdate(handle, pchChangeNote));
+}
+
+EItemUpdateStatus  standin_SteamAPI_ISteamUGC_GetItemUpdateProgress(intptr_t  instancePtr, UGCUpdateHandle_t  handle, uint64 * punBytesProcessed, uint64 * punBytesTotal) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetItemUpdateProgress);
+EItemUpdateStatus  standin_SteamAPI_ISteamUGC_GetItemUpdateProgress(intptr_t  instancePtr, UGCUpdateHandle_t  handle, uint64 * punBytesProcessed, uint64 * punBytesTotal)
+{
+  return StandInResult<EItemUpdateStatus>::of(((ISteamUGCStandIn *)instancePtr)->GetItemUpdateProgress(handle, punBytesProcessed, punBytesTotal));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_AddItemToFavorites(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID) STANDIN_EXPORT(SteamAPI_ISteamUGC_AddItemToFavorites);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_AddItemToFavorites(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->AddItemToFavorites(nAppId, nPublishedFileID));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_RemoveItemFromFavorites(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID) STANDIN_EXPORT(SteamAPI_ISteamUGC_RemoveItemFromFavorites);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_RemoveItemFromFavorites(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->RemoveItemFromFavorites(nAppId, nPublishedFileID));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_SubscribeItem(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID) STANDIN_EXPORT(SteamAPI_ISteamUGC_SubscribeItem);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_SubscribeItem(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->SubscribeItem(nPublishedFileID));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_UnsubscribeItem(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID) STANDIN_EXPORT(SteamAPI_ISteamUGC_UnsubscribeItem);
+SteamAPICall_t  standin_SteamAPI_ISteamUGC_UnsubscribeItem(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamUGCStandIn *)instancePtr)->UnsubscribeItem(nPublishedFileID));
+}
+
+uint32  standin_SteamAPI_ISteamUGC_GetNumSubscribedItems(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetNumSubscribedItems);
+uint32  standin_SteamAPI_ISteamUGC_GetNumSubscribedItems(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamUGCStandIn *)instancePtr)->GetNumSubscribedItems());
+}
+
+uint32  standin_SteamAPI_ISteamUGC_GetSubscribedItems(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetSubscribedItems);
+uint32  standin_SteamAPI_ISteamUGC_GetSubscribedItems(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
+{
+  return StandInResult<uint32>::of(((ISteamUGCStandIn *)instancePtr)->GetSubscribedItems(pvecPublishedFileID, cMaxEntries));
+}
+
+uint32  standin_SteamAPI_ISteamUGC_GetItemState(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetItemState);
+uint32  standin_SteamAPI_ISteamUGC_GetItemState(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID)
+{
+  return StandInResult<uint32>::of(((ISteamUGCStandIn *)instancePtr)->GetItemState(nPublishedFileID));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetItemInstallInfo(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punSizeOnDisk, char * pchFolder, uint32  cchFolderSize, uint32 * punTimeStamp) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetItemInstallInfo);
+bool  standin_SteamAPI_ISteamUGC_GetItemInstallInfo(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punSizeOnDisk, char * pchFolder, uint32  cchFolderSize, uint32 * punTimeStamp)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetItemInstallInfo(nPublishedFileID, punSizeOnDisk, pchFolder, cchFolderSize, punTimeStamp));
+}
+
+bool  standin_SteamAPI_ISteamUGC_GetItemDownloadInfo(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punBytesDownloaded, uint64 * punBytesTotal) STANDIN_EXPORT(SteamAPI_ISteamUGC_GetItemDownloadInfo);
+bool  standin_SteamAPI_ISteamUGC_GetItemDownloadInfo(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->GetItemDownloadInfo(nPublishedFileID, punBytesDownloaded, punBytesTotal));
+}
+
+bool  standin_SteamAPI_ISteamUGC_DownloadItem(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, bool  bHighPriority) STANDIN_EXPORT(SteamAPI_ISteamUGC_DownloadItem);
+bool  standin_SteamAPI_ISteamUGC_DownloadItem(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, bool  bHighPriority)
+{
+  return StandInResult<bool>::of(((ISteamUGCStandIn *)instancePtr)->DownloadItem(nPublishedFileID, bHighPriority));
+}
+
+uint32  standin_SteamAPI_ISteamAppList_GetNumInstalledApps(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamAppList_GetNumInstalledApps);
+uint32  standin_SteamAPI_ISteamAppList_GetNumInstalledApps(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamAppListStandIn *)instancePtr)->GetNumInstalledApps());
+}
+
+uint32  standin_SteamAPI_ISteamAppList_GetInstalledApps(intptr_t  instancePtr, AppId_t * pvecAppID, uint32  unMaxAppIDs) STANDIN_EXPORT(SteamAPI_ISteamAppList_GetInstalledApps);
+uint32  standin_SteamAPI_ISteamAppList_GetInstalledApps(intptr_t  instancePtr, AppId_t * pvecAppID, uint32  unMaxAppIDs)
+{
+  return StandInResult<uint32>::of(((ISteamAppListStandIn *)instancePtr)->GetInstalledApps(pvecAppID, unMaxAppIDs));
+}
+
+int  standin_SteamAPI_ISteamAppList_GetAppName(intptr_t  instancePtr, AppId_t  nAppID, char * pchName, int  cchNameMax) STANDIN_EXPORT(SteamAPI_ISteamAppList_GetAppName);
+int  standin_SteamAPI_ISteamAppList_GetAppName(intptr_t  instancePtr, AppId_t  nAppID, char * pchName, int  cchNameMax)
+{
+  return StandInResult<int>::of(((ISteamAppListStandIn *)instancePtr)->GetAppName(nAppID, pchName, cchNameMax));
+}
+
+int  standin_SteamAPI_ISteamAppList_GetAppInstallDir(intptr_t  instancePtr, AppId_t  nAppID, char * pchDirectory, int  cchNameMax) STANDIN_EXPORT(SteamAPI_ISteamAppList_GetAppInstallDir);
+int  standin_SteamAPI_ISteamAppList_GetAppInstallDir(intptr_t  instancePtr, AppId_t  nAppID, char * pchDirectory, int  cchNameMax)
+{
+  return StandInResult<int>::of(((ISteamAppListStandIn *)instancePtr)->GetAppInstallDir(nAppID, pchDirectory, cchNameMax));
+}
+
+int  standin_SteamAPI_ISteamAppList_GetAppBuildId(intptr_t  instancePtr, AppId_t  nAppID) STANDIN_EXPORT(SteamAPI_ISteamAppList_GetAppBuildId);
+int  standin_SteamAPI_ISteamAppList_GetAppBuildId(intptr_t  instancePtr, AppId_t  nAppID)
+{
+  return StandInResult<int>::of(((ISteamAppListStandIn *)instancePtr)->GetAppBuildId(nAppID));
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface);
+void  standin_SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface(intptr_t  instancePtr)
+{
+  standinLatency();
+}
+
+bool  standin_SteamAPI_ISteamHTMLSurface_Init(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_Init);
+bool  standin_SteamAPI_ISteamHTMLSurface_Init(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamHTMLSurfaceStandIn *)instancePtr)->Init());
+}
+
+bool  standin_SteamAPI_ISteamHTMLSurface_Shutdown(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_Shutdown);
+bool  standin_SteamAPI_ISteamHTMLSurface_Shutdown(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamHTMLSurfaceStandIn *)instancePtr)->Shutdown());
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamHTMLSurface_CreateBrowser(intptr_t  instancePtr, char * pchUserAgent, char * pchUserCSS) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_CreateBrowser);
+SteamAPICall_t  standin_SteamAPI_ISteamHTMLSurface_CreateBrowser(intptr_t  instancePtr, char * pchUserAgent, char * pchUserCSS)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamHTMLSurfaceStandIn *)instancePtr)->CreateBrowser(pchUserAgent, pchUserCSS));
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_RemoveBrowser(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_RemoveBrowser);
+void  standin_SteamAPI_ISteamHTMLSurface_RemoveBrowser(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->RemoveBrowser(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_LoadURL(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchURL, char * pchPostData) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_LoadURL);
+void  standin_SteamAPI_ISteamHTMLSurface_LoadURL(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchURL, char * pchPostData)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->LoadURL(unBrowserHandle, pchURL, pchPostData);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_SetSize(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  unWidth, uint32  unHeight) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_SetSize);
+void  standin_SteamAPI_ISteamHTMLSurface_SetSize(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  unWidth, uint32  unHeight)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->SetSize(unBrowserHandle, unWidth, unHeight);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_StopLoad(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_StopLoad);
+void  standin_SteamAPI_ISteamHTMLSurface_StopLoad(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->StopLoad(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_Reload(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_Reload);
+void  standin_SteamAPI_ISteamHTMLSurface_Reload(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->Reload(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_GoBack(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_GoBack);
+void  standin_SteamAPI_ISteamHTMLSurface_GoBack(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->GoBack(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_GoForward(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_GoForward);
+void  standin_SteamAPI_ISteamHTMLSurface_GoForward(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->GoForward(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_AddHeader(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchKey, char * pchValue) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_AddHeader);
+void  standin_SteamAPI_ISteamHTMLSurface_AddHeader(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchKey, char * pchValue)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->AddHeader(unBrowserHandle, pchKey, pchValue);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_ExecuteJavascript(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchScript) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_ExecuteJavascript);
+void  standin_SteamAPI_ISteamHTMLSurface_ExecuteJavascript(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchScript)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->ExecuteJavascript(unBrowserHandle, pchScript);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_MouseUp(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_MouseUp);
+void  standin_SteamAPI_ISteamHTMLSurface_MouseUp(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->MouseUp(unBrowserHandle, eMouseButton);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_MouseDown(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_MouseDown);
+void  standin_SteamAPI_ISteamHTMLSurface_MouseDown(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->MouseDown(unBrowserHandle, eMouseButton);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_MouseDoubleClick(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_MouseDoubleClick);
+void  standin_SteamAPI_ISteamHTMLSurface_MouseDoubleClick(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->MouseDoubleClick(unBrowserHandle, eMouseButton);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_MouseMove(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_MouseMove);
+void  standin_SteamAPI_ISteamHTMLSurface_MouseMove(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->MouseMove(unBrowserHandle, x, y);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_MouseWheel(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int32  nDelta) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_MouseWheel);
+void  standin_SteamAPI_ISteamHTMLSurface_MouseWheel(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int32  nDelta)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->MouseWheel(unBrowserHandle, nDelta);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_KeyDown(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_KeyDown);
+void  standin_SteamAPI_ISteamHTMLSurface_KeyDown(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->KeyDown(unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_KeyUp(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_KeyUp);
+void  standin_SteamAPI_ISteamHTMLSurface_KeyUp(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->KeyUp(unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_KeyChar(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  cUnicodeChar, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_KeyChar);
+void  standin_SteamAPI_ISteamHTMLSurface_KeyChar(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  cUnicodeChar, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->KeyChar(unBrowserHandle, cUnicodeChar, eHTMLKeyModifiers);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_SetHorizontalScroll(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_SetHorizontalScroll);
+void  standin_SteamAPI_ISteamHTMLSurface_SetHorizontalScroll(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->SetHorizontalScroll(unBrowserHandle, nAbsolutePixelScroll);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_SetVerticalScroll(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_SetVerticalScroll);
+void  standin_SteamAPI_ISteamHTMLSurface_SetVerticalScroll(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->SetVerticalScroll(unBrowserHandle, nAbsolutePixelScroll);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_SetKeyFocus(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bHasKeyFocus) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_SetKeyFocus);
+void  standin_SteamAPI_ISteamHTMLSurface_SetKeyFocus(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bHasKeyFocus)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->SetKeyFocus(unBrowserHandle, bHasKeyFocus);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_ViewSource(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_ViewSource);
+void  standin_SteamAPI_ISteamHTMLSurface_ViewSource(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->ViewSource(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_CopyToClipboard(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_CopyToClipboard);
+void  standin_SteamAPI_ISteamHTMLSurface_CopyToClipboard(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->CopyToClipboard(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_PasteFromClipboard(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_PasteFromClipboard);
+void  standin_SteamAPI_ISteamHTMLSurface_PasteFromClipboard(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->PasteFromClipboard(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_Find(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchSearchStr, bool  bCurrentlyInFind, bool  bReverse) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_Find);
+void  standin_SteamAPI_ISteamHTMLSurface_Find(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchSearchStr, bool  bCurrentlyInFind, bool  bReverse)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->Find(unBrowserHandle, pchSearchStr, bCurrentlyInFind, bReverse);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_StopFind(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_StopFind);
+void  standin_SteamAPI_ISteamHTMLSurface_StopFind(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->StopFind(unBrowserHandle);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_GetLinkAtPosition(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_GetLinkAtPosition);
+void  standin_SteamAPI_ISteamHTMLSurface_GetLinkAtPosition(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->GetLinkAtPosition(unBrowserHandle, x, y);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_SetCookie(intptr_t  instancePtr, char * pchHostname, char * pchKey, char * pchValue, char * pchPath, RTime32  nExpires, bool  bSecure, bool  bHTTPOnly) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_SetCookie);
+void  standin_SteamAPI_ISteamHTMLSurface_SetCookie(intptr_t  instancePtr, char * pchHostname, char * pchKey, char * pchValue, char * pchPath, RTime32  nExpires, bool  bSecure, bool  bHTTPOnly)
+{
+  standinLatency();
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_SetPageScaleFactor(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, float  flZoom, int  nPointX, int  nPointY) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_SetPageScaleFactor);
+void  standin_SteamAPI_ISteamHTMLSurface_SetPageScaleFactor(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, float  flZoom, int  nPointX, int  nPointY)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->SetPageScaleFactor(unBrowserHandle, flZoom, nPointX, nPointY);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_SetBackgroundMode(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bBackgroundMode) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_SetBackgroundMode);
+void  standin_SteamAPI_ISteamHTMLSurface_SetBackgroundMode(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bBackgroundMode)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->SetBackgroundMode(unBrowserHandle, bBackgroundMode);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_AllowStartRequest(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bAllowed) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_AllowStartRequest);
+void  standin_SteamAPI_ISteamHTMLSurface_AllowStartRequest(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bAllowed)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->AllowStartRequest(unBrowserHandle, bAllowed);
+}
+
+void  standin_SteamAPI_ISteamHTMLSurface_JSDialogResponse(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bResult) STANDIN_EXPORT(SteamAPI_ISteamHTMLSurface_JSDialogResponse);
+void  standin_SteamAPI_ISteamHTMLSurface_JSDialogResponse(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bResult)
+{
+  ((ISteamHTMLSurfaceStandIn *)instancePtr)->JSDialogResponse(unBrowserHandle, bResult);
+}
+
+EResult  standin_SteamAPI_ISteamInventory_GetResultStatus(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle) STANDIN_EXPORT(SteamAPI_ISteamInventory_GetResultStatus);
+EResult  standin_SteamAPI_ISteamInventory_GetResultStatus(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle)
+{
+  return StandInResult<EResult>::of(((ISteamInventoryStandIn *)instancePtr)->GetResultStatus(resultHandle));
+}
+
+bool  standin_SteamAPI_ISteamInventory_GetResultItems(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, SteamItemDetails_t * pOutItemsArray, uint32 * punOutItemsArraySize) STANDIN_EXPORT(SteamAPI_ISteamInventory_GetResultItems);
+bool  standin_SteamAPI_ISteamInventory_GetResultItems(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, SteamItemDetails_t * pOutItemsArray, uint32 * punOutItemsArraySize)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->GetResultItems(resultHandle, pOutItemsArray, punOutItemsArraySize));
+}
+
+uint32  standin_SteamAPI_ISteamInventory_GetResultTimestamp(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle) STANDIN_EXPORT(SteamAPI_ISteamInventory_GetResultTimestamp);
+uint32  standin_SteamAPI_ISteamInventory_GetResultTimestamp(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle)
+{
+  return StandInResult<uint32>::of(((ISteamInventoryStandIn *)instancePtr)->GetResultTimestamp(resultHandle));
+}
+
+bool  standin_SteamAPI_ISteamInventory_CheckResultSteamID(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, CSteamID  steamIDExpected) STANDIN_EXPORT(SteamAPI_ISteamInventory_CheckResultSteamID);
+bool  standin_SteamAPI_ISteamInventory_CheckResultSteamID(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, CSteamID  steamIDExpected)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->CheckResultSteamID(resultHandle, steamIDExpected));
+}
+
+void  standin_SteamAPI_ISteamInventory_DestroyResult(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle) STANDIN_EXPORT(SteamAPI_ISteamInventory_DestroyResult);
+void  standin_SteamAPI_ISteamInventory_DestroyResult(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle)
+{
+  ((ISteamInventoryStandIn *)instancePtr)->DestroyResult(resultHandle);
+}
+
+bool  standin_SteamAPI_ISteamInventory_GetAllItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle) STANDIN_EXPORT(SteamAPI_ISteamInventory_GetAllItems);
+bool  standin_SteamAPI_ISteamInventory_GetAllItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->GetAllItems(pResultHandle));
+}
+
+bool  standin_SteamAPI_ISteamInventory_GetItemsByID(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t * pInstanceIDs, uint32  unCountInstanceIDs) STANDIN_EXPORT(SteamAPI_ISteamInventory_GetItemsByID);
+bool  standin_SteamAPI_ISteamInventory_GetItemsByID(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t * pInstanceIDs, uint32  unCountInstanceIDs)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->GetItemsByID(pResultHandle, pInstanceIDs, unCountInstanceIDs));
+}
+
+bool  standin_SteamAPI_ISteamInventory_SerializeResult(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, void * pOutBuffer, uint32 * punOutBufferSize) STANDIN_EXPORT(SteamAPI_ISteamInventory_SerializeResult);
+bool  standin_SteamAPI_ISteamInventory_SerializeResult(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, void * pOutBuffer, uint32 * punOutBufferSize)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->SerializeResult(resultHandle, pOutBuffer, punOutBufferSize));
+}
+
+bool  standin_SteamAPI_ISteamInventory_DeserializeResult(intptr_t  instancePtr, SteamInventoryResult_t * pOutResultHandle, void * pBuffer, uint32  unBufferSize, bool  bRESERVED_MUST_BE_FALSE) STANDIN_EXPORT(SteamAPI_ISteamInventory_DeserializeResult);
+bool  standin_SteamAPI_ISteamInventory_DeserializeResult(intptr_t  instancePtr, SteamInventoryResult_t * pOutResultHandle, void * pBuffer, uint32  unBufferSize, bool  bRESERVED_MUST_BE_FALSE)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->DeserializeResult(pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE));
+}
+
+bool  standin_SteamAPI_ISteamInventory_GenerateItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32 * punArrayQuantity, uint32  unArrayLength) STANDIN_EXPORT(SteamAPI_ISteamInventory_GenerateItems);
+bool  standin_SteamAPI_ISteamInventory_GenerateItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32 * punArrayQuantity, uint32  unArrayLength)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->GenerateItems(pResultHandle, pArrayItemDefs, punArrayQuantity, unArrayLength));
+}
+
+bool  standin_SteamAPI_ISteamInventory_GrantPromoItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle) STANDIN_EXPORT(SteamAPI_ISteamInventory_GrantPromoItems);
+bool  standin_SteamAPI_ISteamInventory_GrantPromoItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->GrantPromoItems(pResultHandle));
+}
+
+bool  standin_SteamAPI_ISteamInventory_AddPromoItem(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  itemDef) STANDIN_EXPORT(SteamAPI_ISteamInventory_AddPromoItem);
+bool  standin_SteamAPI_ISteamInventory_AddPromoItem(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  itemDef)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->AddPromoItem(pResultHandle, itemDef));
+}
+
+bool  standin_SteamAPI_ISteamInventory_AddPromoItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32  unArrayLength) STANDIN_EXPORT(SteamAPI_ISteamInventory_AddPromoItems);
+bool  standin_SteamAPI_ISteamInventory_AddPromoItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32  unArrayLength)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->AddPromoItems(pResultHandle, pArrayItemDefs, unArrayLength));
+}
+
+bool  standin_SteamAPI_ISteamInventory_ConsumeItem(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemConsume, uint32  unQuantity) STANDIN_EXPORT(SteamAPI_ISteamInventory_ConsumeItem);
+bool  standin_SteamAPI_ISteamInventory_ConsumeItem(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemConsume, uint32  unQuantity)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->ConsumeItem(pResultHandle, itemConsume, unQuantity));
+}
+
+bool  standin_SteamAPI_ISteamInventory_ExchangeItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayGenerate, uint32 * punArrayGenerateQuantity, uint32  unArrayGenerateLength, SteamItemInstanceID_t * pArrayDestroy, uint32 * punArrayDestroyQuantity, uint32  unArrayDestroyLength) STANDIN_EXPORT(SteamAPI_ISteamInventory_ExchangeItems);
+bool  standin_SteamAPI_ISteamInventory_ExchangeItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayGenerate, uint32 * punArrayGenerateQuantity, uint32  unArrayGenerateLength, SteamItemInstanceID_t * pArrayDestroy, uint32 * punArrayDestroyQuantity, uint32  unArrayDestroyLength)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->ExchangeItems(pResultHandle, pArrayGenerate, punArrayGenerateQuantity, unArrayGenerateLength, pArrayDestroy, punArrayDestroyQuantity, unArrayDestroyLength));
+}
+
+bool  standin_SteamAPI_ISteamInventory_TransferItemQuantity(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemIdSource, uint32  unQuantity, SteamItemInstanceID_t  itemIdDest) STANDIN_EXPORT(SteamAPI_ISteamInventory_TransferItemQuantity);
+bool  standin_SteamAPI_ISteamInventory_TransferItemQuantity(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemIdSource, uint32  unQuantity, SteamItemInstanceID_t  itemIdDest)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->TransferItemQuantity(pResultHandle, itemIdSource, unQuantity, itemIdDest));
+}
+
+void  standin_SteamAPI_ISteamInventory_SendItemDropHeartbeat(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamInventory_SendItemDropHeartbeat);
+void  standin_SteamAPI_ISteamInventory_SendItemDropHeartbeat(intptr_t  instancePtr)
+{
+  ((ISteamInventoryStandIn *)instancePtr)->SendItemDropHeartbeat();
+}
+
+bool  standin_SteamAPI_ISteamInventory_TriggerItemDrop(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  dropListDefinition) STANDIN_EXPORT(SteamAPI_ISteamInventory_TriggerItemDrop);
+bool  standin_SteamAPI_ISteamInventory_TriggerItemDrop(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  dropListDefinition)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->TriggerItemDrop(pResultHandle, dropListDefinition));
+}
+
+bool  standin_SteamAPI_ISteamInventory_TradeItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, CSteamID  steamIDTradePartner, SteamItemInstanceID_t * pArrayGive, uint32 * pArrayGiveQuantity, uint32  nArrayGiveLength, SteamItemInstanceID_t * pArrayGet, uint32 * pArrayGetQuantity, uint32  nArrayGetLength) STANDIN_EXPORT(SteamAPI_ISteamInventory_TradeItems);
+bool  standin_SteamAPI_ISteamInventory_TradeItems(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, CSteamID  steamIDTradePartner, SteamItemInstanceID_t * pArrayGive, uint32 * pArrayGiveQuantity, uint32  nArrayGiveLength, SteamItemInstanceID_t * pArrayGet, uint32 * pArrayGetQuantity, uint32  nArrayGetLength)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->TradeItems(pResultHandle, steamIDTradePartner, pArrayGive, pArrayGiveQuantity, nArrayGiveLength, pArrayGet, pArrayGetQuantity, nArrayGetLength));
+}
+
+bool  standin_SteamAPI_ISteamInventory_LoadItemDefinitions(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamInventory_LoadItemDefinitions);
+bool  standin_SteamAPI_ISteamInventory_LoadItemDefinitions(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->LoadItemDefinitions());
+}
+
+bool  standin_SteamAPI_ISteamInventory_GetItemDefinitionIDs(intptr_t  instancePtr, SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize) STANDIN_EXPORT(SteamAPI_ISteamInventory_GetItemDefinitionIDs);
+bool  standin_SteamAPI_ISteamInventory_GetItemDefinitionIDs(intptr_t  instancePtr, SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->GetItemDefinitionIDs(pItemDefIDs, punItemDefIDsArraySize));
+}
+
+bool  standin_SteamAPI_ISteamInventory_GetItemDefinitionProperty(intptr_t  instancePtr, SteamItemDef_t  iDefinition, char * pchPropertyName, char * pchValueBuffer, uint32 * punValueBufferSizeOut) STANDIN_EXPORT(SteamAPI_ISteamInventory_GetItemDefinitionProperty);
+bool  standin_SteamAPI_ISteamInventory_GetItemDefinitionProperty(intptr_t  instancePtr, SteamItemDef_t  iDefinition, char * pchPropertyName, char * pchValueBuffer, uint32 * punValueBufferSizeOut)
+{
+  return StandInResult<bool>::of(((ISteamInventoryStandIn *)instancePtr)->GetItemDefinitionProperty(iDefinition, pchPropertyName, pchValueBuffer, punValueBufferSizeOut));
+}
+
+void  standin_SteamAPI_ISteamVideo_GetVideoURL(intptr_t  instancePtr, AppId_t  unVideoAppID) STANDIN_EXPORT(SteamAPI_ISteamVideo_GetVideoURL);
+void  standin_SteamAPI_ISteamVideo_GetVideoURL(intptr_t  instancePtr, AppId_t  unVideoAppID)
+{
+  ((ISteamVideoStandIn *)instancePtr)->GetVideoURL(unVideoAppID);
+}
+
+bool  standin_SteamAPI_ISteamVideo_IsBroadcasting(intptr_t  instancePtr, int * pnNumViewers) STANDIN_EXPORT(SteamAPI_ISteamVideo_IsBroadcasting);
+bool  standin_SteamAPI_ISteamVideo_IsBroadcasting(intptr_t  instancePtr, int * pnNumViewers)
+{
+  return StandInResult<bool>::of(((ISteamVideoStandIn *)instancePtr)->IsBroadcasting(pnNumViewers));
+}
+
+bool  standin_SteamAPI_ISteamGameServer_InitGameServer(intptr_t  instancePtr, uint32  unIP, uint16  usGamePort, uint16  usQueryPort, uint32  unFlags, AppId_t  nGameAppId, char * pchVersionString) STANDIN_EXPORT(SteamAPI_ISteamGameServer_InitGameServer);
+bool  standin_SteamAPI_ISteamGameServer_InitGameServer(intptr_t  instancePtr, uint32  unIP, uint16  usGamePort, uint16  usQueryPort, uint32  unFlags, AppId_t  nGameAppId, char * pchVersionString)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->InitGameServer(unIP, usGamePort, usQueryPort, unFlags, nGameAppId, pchVersionString));
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetProduct(intptr_t  instancePtr, char * pszProduct) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetProduct);
+void  standin_SteamAPI_ISteamGameServer_SetProduct(intptr_t  instancePtr, char * pszProduct)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetProduct(pszProduct);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetGameDescription(intptr_t  instancePtr, char * pszGameDescription) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetGameDescription);
+void  standin_SteamAPI_ISteamGameServer_SetGameDescription(intptr_t  instancePtr, char * pszGameDescription)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetGameDescription(pszGameDescription);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetModDir(intptr_t  instancePtr, char * pszModDir) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetModDir);
+void  standin_SteamAPI_ISteamGameServer_SetModDir(intptr_t  instancePtr, char * pszModDir)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetModDir(pszModDir);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetDedicatedServer(intptr_t  instancePtr, bool  bDedicated) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetDedicatedServer);
+void  standin_SteamAPI_ISteamGameServer_SetDedicatedServer(intptr_t  instancePtr, bool  bDedicated)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetDedicatedServer(bDedicated);
+}
+
+void  standin_SteamAPI_ISteamGameServer_LogOn(intptr_t  instancePtr, char * pszToken) STANDIN_EXPORT(SteamAPI_ISteamGameServer_LogOn);
+void  standin_SteamAPI_ISteamGameServer_LogOn(intptr_t  instancePtr, char * pszToken)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->LogOn(pszToken);
+}
+
+void  standin_SteamAPI_ISteamGameServer_LogOnAnonymous(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_LogOnAnonymous);
+void  standin_SteamAPI_ISteamGameServer_LogOnAnonymous(intptr_t  instancePtr)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->LogOnAnonymous();
+}
+
+void  standin_SteamAPI_ISteamGameServer_LogOff(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_LogOff);
+void  standin_SteamAPI_ISteamGameServer_LogOff(intptr_t  instancePtr)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->LogOff();
+}
+
+bool  standin_SteamAPI_ISteamGameServer_BLoggedOn(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_BLoggedOn);
+bool  standin_SteamAPI_ISteamGameServer_BLoggedOn(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->BLoggedOn());
+}
+
+bool  standin_SteamAPI_ISteamGameServer_BSecure(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_BSecure);
+bool  standin_SteamAPI_ISteamGameServer_BSecure(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->BSecure());
+}
+
+uint64  standin_SteamAPI_ISteamGameServer_GetSteamID(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_GetSteamID);
+uint64  standin_SteamAPI_ISteamGameServer_GetSteamID(intptr_t  instancePtr)
+{
+  return StandInResult<uint64>::of(((ISteamGameServerStandIn *)instancePtr)->GetSteamID());
+}
+
+bool  standin_SteamAPI_ISteamGameServer_WasRestartRequested(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_WasRestartRequested);
+bool  standin_SteamAPI_ISteamGameServer_WasRestartRequested(intptr_t  instancePtr)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->WasRestartRequested());
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetMaxPlayerCount(intptr_t  instancePtr, int  cPlayersMax) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetMaxPlayerCount);
+void  standin_SteamAPI_ISteamGameServer_SetMaxPlayerCount(intptr_t  instancePtr, int  cPlayersMax)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetMaxPlayerCount(cPlayersMax);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetBotPlayerCount(intptr_t  instancePtr, int  cBotplayers) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetBotPlayerCount);
+void  standin_SteamAPI_ISteamGameServer_SetBotPlayerCount(intptr_t  instancePtr, int  cBotplayers)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetBotPlayerCount(cBotplayers);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetServerName(intptr_t  instancePtr, char * pszServerName) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetServerName);
+void  standin_SteamAPI_ISteamGameServer_SetServerName(intptr_t  instancePtr, char * pszServerName)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetServerName(pszServerName);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetMapName(intptr_t  instancePtr, char * pszMapName) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetMapName);
+void  standin_SteamAPI_ISteamGameServer_SetMapName(intptr_t  instancePtr, char * pszMapName)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetMapName(pszMapName);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetPasswordProtected(intptr_t  instancePtr, bool  bPasswordProtected) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetPasswordProtected);
+void  standin_SteamAPI_ISteamGameServer_SetPasswordProtected(intptr_t  instancePtr, bool  bPasswordProtected)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetPasswordProtected(bPasswordProtected);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetSpectatorPort(intptr_t  instancePtr, uint16  unSpectatorPort) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetSpectatorPort);
+void  standin_SteamAPI_ISteamGameServer_SetSpectatorPort(intptr_t  instancePtr, uint16  unSpectatorPort)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetSpectatorPort(unSpectatorPort);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetSpectatorServerName(intptr_t  instancePtr, char * pszSpectatorServerName) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetSpectatorServerName);
+void  standin_SteamAPI_ISteamGameServer_SetSpectatorServerName(intptr_t  instancePtr, char * pszSpectatorServerName)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetSpectatorServerName(pszSpectatorServerName);
+}
+
+void  standin_SteamAPI_ISteamGameServer_ClearAllKeyValues(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_ClearAllKeyValues);
+void  standin_SteamAPI_ISteamGameServer_ClearAllKeyValues(intptr_t  instancePtr)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->ClearAllKeyValues();
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetKeyValue(intptr_t  instancePtr, char * pKey, char * pValue) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetKeyValue);
+void  standin_SteamAPI_ISteamGameServer_SetKeyValue(intptr_t  instancePtr, char * pKey, char * pValue)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetKeyValue(pKey, pValue);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetGameTags(intptr_t  instancePtr, char * pchGameTags) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetGameTags);
+void  standin_SteamAPI_ISteamGameServer_SetGameTags(intptr_t  instancePtr, char * pchGameTags)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetGameTags(pchGameTags);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetGameData(intptr_t  instancePtr, char * pchGameData) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetGameData);
+void  standin_SteamAPI_ISteamGameServer_SetGameData(intptr_t  instancePtr, char * pchGameData)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetGameData(pchGameData);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetRegion(intptr_t  instancePtr, char * pszRegion) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetRegion);
+void  standin_SteamAPI_ISteamGameServer_SetRegion(intptr_t  instancePtr, char * pszRegion)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetRegion(pszRegion);
+}
+
+bool  standin_SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate(intptr_t  instancePtr, uint32  unIPClient, void * pvAuthBlob, uint32  cubAuthBlobSize, CSteamID * pSteamIDUser) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate);
+bool  standin_SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate(intptr_t  instancePtr, uint32  unIPClient, void * pvAuthBlob, uint32  cubAuthBlobSize, CSteamID * pSteamIDUser)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->SendUserConnectAndAuthenticate(unIPClient, pvAuthBlob, cubAuthBlobSize, pSteamIDUser));
+}
+
+uint64  standin_SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection);
+uint64  standin_SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection(intptr_t  instancePtr)
+{
+  return StandInResult<uint64>::of(((ISteamGameServerStandIn *)instancePtr)->CreateUnauthenticatedUserConnection());
+}
+
+void  standin_SteamAPI_ISteamGameServer_SendUserDisconnect(intptr_t  instancePtr, CSteamID  steamIDUser) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SendUserDisconnect);
+void  standin_SteamAPI_ISteamGameServer_SendUserDisconnect(intptr_t  instancePtr, CSteamID  steamIDUser)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SendUserDisconnect(steamIDUser);
+}
+
+bool  standin_SteamAPI_ISteamGameServer_BUpdateUserData(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchPlayerName, uint32  uScore) STANDIN_EXPORT(SteamAPI_ISteamGameServer_BUpdateUserData);
+bool  standin_SteamAPI_ISteamGameServer_BUpdateUserData(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchPlayerName, uint32  uScore)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->BUpdateUserData(steamIDUser, pchPlayerName, uScore));
+}
+
+HAuthTicket  standin_SteamAPI_ISteamGameServer_GetAuthSessionTicket(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket) STANDIN_EXPORT(SteamAPI_ISteamGameServer_GetAuthSessionTicket);
+HAuthTicket  standin_SteamAPI_ISteamGameServer_GetAuthSessionTicket(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
+{
+  return StandInResult<HAuthTicket>::of(((ISteamGameServerStandIn *)instancePtr)->GetAuthSessionTicket(pTicket, cbMaxTicket, pcbTicket));
+}
+
+EBeginAuthSessionResult  standin_SteamAPI_ISteamGameServer_BeginAuthSession(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamGameServer_BeginAuthSession);
+EBeginAuthSessionResult  standin_SteamAPI_ISteamGameServer_BeginAuthSession(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
+{
+  return StandInResult<EBeginAuthSessionResult>::of(((ISteamGameServerStandIn *)instancePtr)->BeginAuthSession(pAuthTicket, cbAuthTicket, steamID));
+}
+
+void  standin_SteamAPI_ISteamGameServer_EndAuthSession(intptr_t  instancePtr, CSteamID  steamID) STANDIN_EXPORT(SteamAPI_ISteamGameServer_EndAuthSession);
+void  standin_SteamAPI_ISteamGameServer_EndAuthSession(intptr_t  instancePtr, CSteamID  steamID)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->EndAuthSession(steamID);
+}
+
+void  standin_SteamAPI_ISteamGameServer_CancelAuthTicket(intptr_t  instancePtr, HAuthTicket  hAuthTicket) STANDIN_EXPORT(SteamAPI_ISteamGameServer_CancelAuthTicket);
+void  standin_SteamAPI_ISteamGameServer_CancelAuthTicket(intptr_t  instancePtr, HAuthTicket  hAuthTicket)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->CancelAuthTicket(hAuthTicket);
+}
+
+EUserHasLicenseForAppResult  standin_SteamAPI_ISteamGameServer_UserHasLicenseForApp(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID) STANDIN_EXPORT(SteamAPI_ISteamGameServer_UserHasLicenseForApp);
+EUserHasLicenseForAppResult  standin_SteamAPI_ISteamGameServer_UserHasLicenseForApp(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID)
+{
+  return StandInResult<EUserHasLicenseForAppResult>::of(((ISteamGameServerStandIn *)instancePtr)->UserHasLicenseForApp(steamID, appID));
+}
+
+bool  standin_SteamAPI_ISteamGameServer_RequestUserGroupStatus(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDGroup) STANDIN_EXPORT(SteamAPI_ISteamGameServer_RequestUserGroupStatus);
+bool  standin_SteamAPI_ISteamGameServer_RequestUserGroupStatus(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDGroup)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->RequestUserGroupStatus(steamIDUser, steamIDGroup));
+}
+
+void  standin_SteamAPI_ISteamGameServer_GetGameplayStats(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_GetGameplayStats);
+void  standin_SteamAPI_ISteamGameServer_GetGameplayStats(intptr_t  instancePtr)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->GetGameplayStats();
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamGameServer_GetServerReputation(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_GetServerReputation);
+SteamAPICall_t  standin_SteamAPI_ISteamGameServer_GetServerReputation(intptr_t  instancePtr)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamGameServerStandIn *)instancePtr)->GetServerReputation());
+}
+
+uint32  standin_SteamAPI_ISteamGameServer_GetPublicIP(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_GetPublicIP);
+uint32  standin_SteamAPI_ISteamGameServer_GetPublicIP(intptr_t  instancePtr)
+{
+  return StandInResult<uint32>::of(((ISteamGameServerStandIn *)instancePtr)->GetPublicIP());
+}
+
+bool  standin_SteamAPI_ISteamGameServer_HandleIncomingPacket(intptr_t  instancePtr, void * pData, int  cbData, uint32  srcIP, uint16  srcPort) STANDIN_EXPORT(SteamAPI_ISteamGameServer_HandleIncomingPacket);
+bool  standin_SteamAPI_ISteamGameServer_HandleIncomingPacket(intptr_t  instancePtr, void * pData, int  cbData, uint32  srcIP, uint16  srcPort)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStandIn *)instancePtr)->HandleIncomingPacket(pData, cbData, srcIP, srcPort));
+}
+
+int  standin_SteamAPI_ISteamGameServer_GetNextOutgoingPacket(intptr_t  instancePtr, void * pOut, int  cbMaxOut, uint32 * pNetAdr, uint16 * pPort) STANDIN_EXPORT(SteamAPI_ISteamGameServer_GetNextOutgoingPacket);
+int  standin_SteamAPI_ISteamGameServer_GetNextOutgoingPacket(intptr_t  instancePtr, void * pOut, int  cbMaxOut, uint32 * pNetAdr, uint16 * pPort)
+{
+  return StandInResult<int>::of(((ISteamGameServerStandIn *)instancePtr)->GetNextOutgoingPacket(pOut, cbMaxOut, pNetAdr, pPort));
+}
+
+void  standin_SteamAPI_ISteamGameServer_EnableHeartbeats(intptr_t  instancePtr, bool  bActive) STANDIN_EXPORT(SteamAPI_ISteamGameServer_EnableHeartbeats);
+void  standin_SteamAPI_ISteamGameServer_EnableHeartbeats(intptr_t  instancePtr, bool  bActive)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->EnableHeartbeats(bActive);
+}
+
+void  standin_SteamAPI_ISteamGameServer_SetHeartbeatInterval(intptr_t  instancePtr, int  iHeartbeatInterval) STANDIN_EXPORT(SteamAPI_ISteamGameServer_SetHeartbeatInterval);
+void  standin_SteamAPI_ISteamGameServer_SetHeartbeatInterval(intptr_t  instancePtr, int  iHeartbeatInterval)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->SetHeartbeatInterval(iHeartbeatInterval);
+}
+
+void  standin_SteamAPI_ISteamGameServer_ForceHeartbeat(intptr_t  instancePtr) STANDIN_EXPORT(SteamAPI_ISteamGameServer_ForceHeartbeat);
+void  standin_SteamAPI_ISteamGameServer_ForceHeartbeat(intptr_t  instancePtr)
+{
+  ((ISteamGameServerStandIn *)instancePtr)->ForceHeartbeat();
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamGameServer_AssociateWithClan(intptr_t  instancePtr, CSteamID  steamIDClan) STANDIN_EXPORT(SteamAPI_ISteamGameServer_AssociateWithClan);
+SteamAPICall_t  standin_SteamAPI_ISteamGameServer_AssociateWithClan(intptr_t  instancePtr, CSteamID  steamIDClan)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamGameServerStandIn *)instancePtr)->AssociateWithClan(steamIDClan));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility(intptr_t  instancePtr, CSteamID  steamIDNewPlayer) STANDIN_EXPORT(SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility);
+SteamAPICall_t  standin_SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility(intptr_t  instancePtr, CSteamID  steamIDNewPlayer)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamGameServerStandIn *)instancePtr)->ComputeNewPlayerCompatibility(steamIDNewPlayer));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamGameServerStats_RequestUserStats(intptr_t  instancePtr, CSteamID  steamIDUser) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_RequestUserStats);
+SteamAPICall_t  standin_SteamAPI_ISteamGameServerStats_RequestUserStats(intptr_t  instancePtr, CSteamID  steamIDUser)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamGameServerStatsStandIn *)instancePtr)->RequestUserStats(steamIDUser));
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_GetUserStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_GetUserStat);
+bool  standin_SteamAPI_ISteamGameServerStats_GetUserStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStatsStandIn *)instancePtr)->GetUserStat(steamIDUser, pchName, pData));
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_GetUserStat0(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_GetUserStat0);
+bool  standin_SteamAPI_ISteamGameServerStats_GetUserStat0(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_GetUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_GetUserAchievement);
+bool  standin_SteamAPI_ISteamGameServerStats_GetUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStatsStandIn *)instancePtr)->GetUserAchievement(steamIDUser, pchName, pbAchieved));
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_SetUserStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32  nData) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_SetUserStat);
+bool  standin_SteamAPI_ISteamGameServerStats_SetUserStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32  nData)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStatsStandIn *)instancePtr)->SetUserStat(steamIDUser, pchName, nData));
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_SetUserStat0(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  fData) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_SetUserStat0);
+bool  standin_SteamAPI_ISteamGameServerStats_SetUserStat0(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  fData)
+{
+  standinLatency();
+  return StandInDefault<bool>::value();
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  flCountThisSession, double  dSessionLength) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat);
+bool  standin_SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  flCountThisSession, double  dSessionLength)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStatsStandIn *)instancePtr)->UpdateUserAvgRateStat(steamIDUser, pchName, flCountThisSession, dSessionLength));
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_SetUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_SetUserAchievement);
+bool  standin_SteamAPI_ISteamGameServerStats_SetUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStatsStandIn *)instancePtr)->SetUserAchievement(steamIDUser, pchName));
+}
+
+bool  standin_SteamAPI_ISteamGameServerStats_ClearUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_ClearUserAchievement);
+bool  standin_SteamAPI_ISteamGameServerStats_ClearUserAchievement(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName)
+{
+  return StandInResult<bool>::of(((ISteamGameServerStatsStandIn *)instancePtr)->ClearUserAchievement(steamIDUser, pchName));
+}
+
+SteamAPICall_t  standin_SteamAPI_ISteamGameServerStats_StoreUserStats(intptr_t  instancePtr, CSteamID  steamIDUser) STANDIN_EXPORT(SteamAPI_ISteamGameServerStats_StoreUserStats);
+SteamAPICall_t  standin_SteamAPI_ISteamGameServerStats_StoreUserStats(intptr_t  instancePtr, CSteamID  steamIDUser)
+{
+  return StandInResult<SteamAPICall_t>::of(((ISteamGameServerStatsStandIn *)instancePtr)->StoreUserStats(steamIDUser));
+}
+
+void *standinGenericInterface(const char *version)
+{
+  if (version == NULL)
+    return NULL;
+  if (strcmp(version, STEAMAPPLIST_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamAppListStandIn>();
+  if (strcmp(version, STEAMAPPS_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamAppsStandIn>();
+  if (strcmp(version, STEAMAPPTICKET_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamAppTicketStandIn>();
+  if (strcmp(version, STEAMCLIENT_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamClientStandIn>();
+  if (strcmp(version, STEAMCONTROLLER_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamControllerStandIn>();
+  if (strcmp(version, STEAMFRIENDS_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamFriendsStandIn>();
+  if (strcmp(version, STEAMGAMECOORDINATOR_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamGameCoordinatorStandIn>();
+  if (strcmp(version, STEAMGAMESERVER_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamGameServerStandIn>();
+  if (strcmp(version, STEAMGAMESERVERSTATS_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamGameServerStatsStandIn>();
+  if (strcmp(version, STEAMHTMLSURFACE_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamHTMLSurfaceStandIn>();
+  if (strcmp(version, STEAMHTTP_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamHTTPStandIn>();
+  if (strcmp(version, STEAMINVENTORY_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamInventoryStandIn>();
+  if (strcmp(version, STEAMMATCHMAKING_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamMatchmakingStandIn>();
+  if (strcmp(version, STEAMMATCHMAKINGSERVERS_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamMatchmakingServersStandIn>();
+  if (strcmp(version, STEAMMUSIC_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamMusicStandIn>();
+  if (strcmp(version, STEAMMUSICREMOTE_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamMusicRemoteStandIn>();
+  if (strcmp(version, STEAMNETWORKING_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamNetworkingStandIn>();
+  if (strcmp(version, STEAMREMOTESTORAGE_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamRemoteStorageStandIn>();
+  if (strcmp(version, STEAMSCREENSHOTS_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamScreenshotsStandIn>();
+  if (strcmp(version, STEAMUGC_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamUGCStandIn>();
+  if (strcmp(version, STEAMUNIFIEDMESSAGES_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamUnifiedMessagesStandIn>();
+  if (strcmp(version, STEAMUSER_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamUserStandIn>();
+  if (strcmp(version, STEAMUSERSTATS_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamUserStatsStandIn>();
+  if (strcmp(version, STEAMUTILS_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamUtilsStandIn>();
+  if (strcmp(version, STEAMVIDEO_INTERFACE_VERSION) == 0)
+    return standinInterface<ISteamVideoStandIn>();
+  return NULL;
+}
@@ -0,0 +1,823 @@
+
+#ifndef STEAM_STANDIN_INTERFACES
+#define STEAM_STANDIN_INTERFACES
+#include "standin.h"
+
+class ISteamAppListStandIn
+{
+public:
+  virtual uint32  GetNumInstalledApps();
+  virtual uint32  GetInstalledApps(AppId_t * pvecAppID, uint32  unMaxAppIDs);
+  virtual int  GetAppName(AppId_t  nAppID, char * pchName, int  cchNameMax);
+  virtual int  GetAppInstallDir(AppId_t  nAppID, char * pchDirectory, int  cchNameMax);
+  virtual int  GetAppBuildId(AppId_t  nAppID);
+};
+
+class ISteamAppsStandIn
+{
+public:
+  virtual bool  BIsSubscribed();
+  virtual bool  BIsLowViolence();
+  virtual bool  BIsCybercafe();
+  virtual bool  BIsVACBanned();
+  virtual char * GetCurrentGameLanguage();
+  virtual char * GetAvailableGameLanguages();
+  virtual bool  BIsSubscribedApp(AppId_t  appID);
+  virtual bool  BIsDlcInstalled(AppId_t  appID);
+  virtual uint32  GetEarliestPurchaseUnixTime(AppId_t  nAppID);
+  virtual bool  BIsSubscribedFromFreeWeekend();
+  virtual int  GetDLCCount();
+  virtual bool  BGetDLCDataByIndex(int  iDLC, AppId_t * pAppID, bool * pbAvailable, char * pchName, int  cchNameBufferSize);
+  virtual void  InstallDLC(AppId_t  nAppID);
+  virtual void  UninstallDLC(AppId_t  nAppID);
+  virtual void  RequestAppProofOfPurchaseKey(AppId_t  nAppID);
+  virtual bool  GetCurrentBetaName(char * pchName, int  cchNameBufferSize);
+  virtual bool  MarkContentCorrupt(bool  bMissingFilesOnly);
+  virtual uint32  GetInstalledDepots(AppId_t  appID, DepotId_t * pvecDepots, uint32  cMaxDepots);
+  virtual uint32  GetAppInstallDir(AppId_t  appID, char * pchFolder, uint32  cchFolderBufferSize);
+  virtual bool  BIsAppInstalled(AppId_t  appID);
+  virtual CSteamID  GetAppOwner();
+  virtual char * GetLaunchQueryParam(char * pchKey);
+  virtual bool  GetDlcDownloadProgress(AppId_t  nAppID, uint64 * punBytesDownloaded, uint64 * punBytesTotal);
+  virtual int  GetAppBuildId();
+  virtual void  RequestAllProofOfPurchaseKeys();
+  virtual SteamAPICall_t  GetFileDetails(char * pszFileName);
+};
+
+class ISteamAppTicketStandIn
+{
+public:
+  virtual uint32  GetAppOwnershipTicketData(uint32  nAppID, void * pvBuffer, uint32  cbBufferLength, uint32 * piAppId, uint32 * piSteamId, uint32 * piSignature, uint32 * pcbSignature);
+};
+
+class ISteamClientStandIn
+{
+public:
+  virtual HSteamPipe  CreateSteamPipe();
+  virtual bool  BReleaseSteamPipe(HSteamPipe  hSteamPipe);
+  virtual HSteamUser  ConnectToGlobalUser(HSteamPipe  hSteamPipe);
+  virtual HSteamUser  CreateLocalUser(HSteamPipe * phSteamPipe, EAccountType  eAccountType);
+  virtual void  ReleaseUser(HSteamPipe  hSteamPipe, HSteamUser  hUser);
+  virtual ISteamUser * GetISteamUser(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamGameServer * GetISteamGameServer(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual void  SetLocalIPBinding(uint32  unIP, uint16  usPort);
+  virtual ISteamFriends * GetISteamFriends(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamUtils * GetISteamUtils(HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamMatchmaking * GetISteamMatchmaking(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamMatchmakingServers * GetISteamMatchmakingServers(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual void * GetISteamGenericInterface(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamUserStats * GetISteamUserStats(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamGameServerStats * GetISteamGameServerStats(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamApps * GetISteamApps(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamNetworking * GetISteamNetworking(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamRemoteStorage * GetISteamRemoteStorage(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamScreenshots * GetISteamScreenshots(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual void  RunFrame();
+  virtual uint32  GetIPCCallCount();
+  virtual void  SetWarningMessageHook(SteamAPIWarningMessageHook_t  pFunction);
+  virtual bool  BShutdownIfAllPipesClosed();
+  virtual ISteamHTTP * GetISteamHTTP(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamUnifiedMessages * GetISteamUnifiedMessages(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamController * GetISteamController(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamUGC * GetISteamUGC(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamAppList * GetISteamAppList(HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamMusic * GetISteamMusic(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamMusicRemote * GetISteamMusicRemote(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamHTMLSurface * GetISteamHTMLSurface(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual void  DEPRECATED_Set_SteamAPI_CPostAPIResultInProcess();
+  virtual void  DEPRECATED_Remove_SteamAPI_CPostAPIResultInProcess();
+  virtual void  Set_SteamAPI_CCheckCallbackRegisteredInProcess(SteamAPI_CheckCallbackRegistered_t  func);
+  virtual ISteamInventory * GetISteamInventory(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+  virtual ISteamVideo * GetISteamVideo(HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+};
+
+class ISteamControllerStandIn
+{
+public:
+  virtual bool  Init();
+  virtual bool  Shutdown();
+  virtual void  RunFrame();
+  virtual int  GetConnectedControllers(ControllerHandle_t * handlesOut);
+  virtual bool  ShowBindingPanel(ControllerHandle_t  controllerHandle);
+  virtual ControllerActionSetHandle_t  GetActionSetHandle(char * pszActionSetName);
+  virtual void  ActivateActionSet(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle);
+  virtual ControllerActionSetHandle_t  GetCurrentActionSet(ControllerHandle_t  controllerHandle);
+  virtual ControllerDigitalActionHandle_t  GetDigitalActionHandle(char * pszActionName);
+  virtual ControllerDigitalActionData_t  GetDigitalActionData(ControllerHandle_t  controllerHandle, ControllerDigitalActionHandle_t  digitalActionHandle);
+  virtual int  GetDigitalActionOrigins(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle, ControllerDigitalActionHandle_t  digitalActionHandle, EControllerActionOrigin * originsOut);
+  virtual ControllerAnalogActionHandle_t  GetAnalogActionHandle(char * pszActionName);
+  virtual ControllerAnalogActionData_t  GetAnalogActionData(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  analogActionHandle);
+  virtual int  GetAnalogActionOrigins(ControllerHandle_t  controllerHandle, ControllerActionSetHandle_t  actionSetHandle, ControllerAnalogActionHandle_t  analogActionHandle, EControllerActionOrigin * originsOut);
+  virtual void  StopAnalogActionMomentum(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  eAction);
+  virtual void  TriggerHapticPulse(ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec);
+  virtual void  TriggerRepeatedHapticPulse(ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec, unsigned short  usOffMicroSec, unsigned short  unRepeat, int  nFlags);
+  virtual void  TriggerVibration(ControllerHandle_t  controllerHandle, unsigned short  usLeftSpeed, unsigned short  usRightSpeed);
+  virtual void  SetLEDColor(ControllerHandle_t  controllerHandle, uint8  nColorR, uint8  nColorG, uint8  nColorB, int  nFlags);
+  virtual int  GetGamepadIndexForController(ControllerHandle_t  ulControllerHandle);
+  virtual ControllerHandle_t  GetControllerForGamepadIndex(int  nIndex);
+  virtual ControllerMotionData_t  GetMotionData(ControllerHandle_t  controllerHandle);
+  virtual bool  ShowDigitalActionOrigins(ControllerHandle_t  controllerHandle, ControllerDigitalActionHandle_t  digitalActionHandle, float  flScale, float  flXPosition, float  flYPosition);
+  virtual bool  ShowAnalogActionOrigins(ControllerHandle_t  controllerHandle, ControllerAnalogActionHandle_t  analogActionHandle, float  flScale, float  flXPosition, float  flYPosition);
+  virtual char * GetStringForActionOrigin(EControllerActionOrigin  eOrigin);
+  virtual char * GetGlyphForActionOrigin(EControllerActionOrigin  eOrigin);
+};
+
+class ISteamFriendsStandIn
+{
+public:
+  virtual char * GetPersonaName();
+  virtual SteamAPICall_t  SetPersonaName(char * pchPersonaName);
+  virtual EPersonaState  GetPersonaState();
+  virtual int  GetFriendCount(int  iFriendFlags);
+  virtual CSteamID  GetFriendByIndex(int  iFriend, int  iFriendFlags);
+  virtual EFriendRelationship  GetFriendRelationship(CSteamID  steamIDFriend);
+  virtual EPersonaState  GetFriendPersonaState(CSteamID  steamIDFriend);
+  virtual char * GetFriendPersonaName(CSteamID  steamIDFriend);
+  virtual bool  GetFriendGamePlayed(CSteamID  steamIDFriend, FriendGameInfo_t * pFriendGameInfo);
+  virtual char * GetFriendPersonaNameHistory(CSteamID  steamIDFriend, int  iPersonaName);
+  virtual int  GetFriendSteamLevel(CSteamID  steamIDFriend);
+  virtual char * GetPlayerNickname(CSteamID  steamIDPlayer);
+  virtual int  GetFriendsGroupCount();
+  virtual FriendsGroupID_t  GetFriendsGroupIDByIndex(int  iFG);
+  virtual char * GetFriendsGroupName(FriendsGroupID_t  friendsGroupID);
+  virtual int  GetFriendsGroupMembersCount(FriendsGroupID_t  friendsGroupID);
+  virtual void  GetFriendsGroupMembersList(FriendsGroupID_t  friendsGroupID, CSteamID * pOutSteamIDMembers, int  nMembersCount);
+  virtual bool  HasFriend(CSteamID  steamIDFriend, int  iFriendFlags);
+  virtual int  GetClanCount();
+  virtual CSteamID  GetClanByIndex(int  iClan);
+  virtual char * GetClanName(CSteamID  steamIDClan);
+  virtual char * GetClanTag(CSteamID  steamIDClan);
+  virtual bool  GetClanActivityCounts(CSteamID  steamIDClan, int * pnOnline, int * pnInGame, int * pnChatting);
+  virtual SteamAPICall_t  DownloadClanActivityCounts(CSteamID * psteamIDClans, int  cClansToRequest);
+  virtual int  GetFriendCountFromSource(CSteamID  steamIDSource);
+  virtual CSteamID  GetFriendFromSourceByIndex(CSteamID  steamIDSource, int  iFriend);
+  virtual bool  IsUserInSource(CSteamID  steamIDUser, CSteamID  steamIDSource);
+  virtual void  SetInGameVoiceSpeaking(CSteamID  steamIDUser, bool  bSpeaking);
+  virtual void  ActivateGameOverlay(char * pchDialog);
+  virtual void  ActivateGameOverlayToUser(char * pchDialog, CSteamID  steamID);
+  virtual void  ActivateGameOverlayToWebPage(char * pchURL);
+  virtual void  ActivateGameOverlayToStore(AppId_t  nAppID, EOverlayToStoreFlag  eFlag);
+  virtual void  SetPlayedWith(CSteamID  steamIDUserPlayedWith);
+  virtual void  ActivateGameOverlayInviteDialog(CSteamID  steamIDLobby);
+  virtual int  GetSmallFriendAvatar(CSteamID  steamIDFriend);
+  virtual int  GetMediumFriendAvatar(CSteamID  steamIDFriend);
+  virtual int  GetLargeFriendAvatar(CSteamID  steamIDFriend);
+  virtual bool  RequestUserInformation(CSteamID  steamIDUser, bool  bRequireNameOnly);
+  virtual SteamAPICall_t  RequestClanOfficerList(CSteamID  steamIDClan);
+  virtual CSteamID  GetClanOwner(CSteamID  steamIDClan);
+  virtual int  GetClanOfficerCount(CSteamID  steamIDClan);
+  virtual CSteamID  GetClanOfficerByIndex(CSteamID  steamIDClan, int  iOfficer);
+  virtual uint32  GetUserRestrictions();
+  virtual bool  SetRichPresence(char * pchKey, char * pchValue);
+  virtual void  ClearRichPresence();
+  virtual char * GetFriendRichPresence(CSteamID  steamIDFriend, char * pchKey);
+  virtual int  GetFriendRichPresenceKeyCount(CSteamID  steamIDFriend);
+  virtual char * GetFriendRichPresenceKeyByIndex(CSteamID  steamIDFriend, int  iKey);
+  virtual void  RequestFriendRichPresence(CSteamID  steamIDFriend);
+  virtual bool  InviteUserToGame(CSteamID  steamIDFriend, char * pchConnectString);
+  virtual int  GetCoplayFriendCount();
+  virtual CSteamID  GetCoplayFriend(int  iCoplayFriend);
+  virtual int  GetFriendCoplayTime(CSteamID  steamIDFriend);
+  virtual AppId_t  GetFriendCoplayGame(CSteamID  steamIDFriend);
+  virtual SteamAPICall_t  JoinClanChatRoom(CSteamID  steamIDClan);
+  virtual bool  LeaveClanChatRoom(CSteamID  steamIDClan);
+  virtual int  GetClanChatMemberCount(CSteamID  steamIDClan);
+  virtual CSteamID  GetChatMemberByIndex(CSteamID  steamIDClan, int  iUser);
+  virtual bool  SendClanChatMessage(CSteamID  steamIDClanChat, char * pchText);
+  virtual int  GetClanChatMessage(CSteamID  steamIDClanChat, int  iMessage, void * prgchText, int  cchTextMax, EChatEntryType * peChatEntryType, CSteamID * psteamidChatter);
+  virtual bool  IsClanChatAdmin(CSteamID  steamIDClanChat, CSteamID  steamIDUser);
+  virtual bool  IsClanChatWindowOpenInSteam(CSteamID  steamIDClanChat);
+  virtual bool  OpenClanChatWindowInSteam(CSteamID  steamIDClanChat);
+  virtual bool  CloseClanChatWindowInSteam(CSteamID  steamIDClanChat);
+  virtual bool  SetListenForFriendsMessages(bool  bInterceptEnabled);
+  virtual bool  ReplyToFriendMessage(CSteamID  steamIDFriend, char * pchMsgToSend);
+  virtual int  GetFriendMessage(CSteamID  steamIDFriend, int  iMessageID, void * pvData, int  cubData, EChatEntryType * peChatEntryType);
+  virtual SteamAPICall_t  GetFollowerCount(CSteamID  steamID);
+  virtual SteamAPICall_t  IsFollowing(CSteamID  steamID);
+  virtual SteamAPICall_t  EnumerateFollowingList(uint32  unStartIndex);
+};
+
+class ISteamGameCoordinatorStandIn
+{
+public:
+  virtual EGCResults  SendMessage(uint32  unMsgType, void * pubData, uint32  cubData);
+  virtual bool  IsMessageAvailable(uint32 * pcubMsgSize);
+  virtual EGCResults  RetrieveMessage(uint32 * punMsgType, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize);
+};
+
+class ISteamGameServerStandIn
+{
+public:
+  virtual bool  InitGameServer(uint32  unIP, uint16  usGamePort, uint16  usQueryPort, uint32  unFlags, AppId_t  nGameAppId, char * pchVersionString);
+  virtual void  SetProduct(char * pszProduct);
+  virtual void  SetGameDescription(char * pszGameDescription);
+  virtual void  SetModDir(char * pszModDir);
+  virtual void  SetDedicatedServer(bool  bDedicated);
+  virtual void  LogOn(char * pszToken);
+  virtual void  LogOnAnonymous();
+  virtual void  LogOff();
+  virtual bool  BLoggedOn();
+  virtual bool  BSecure();
+  virtual CSteamID  GetSteamID();
+  virtual bool  WasRestartRequested();
+  virtual void  SetMaxPlayerCount(int  cPlayersMax);
+  virtual void  SetBotPlayerCount(int  cBotplayers);
+  virtual void  SetServerName(char * pszServerName);
+  virtual void  SetMapName(char * pszMapName);
+  virtual void  SetPasswordProtected(bool  bPasswordProtected);
+  virtual void  SetSpectatorPort(uint16  unSpectatorPort);
+  virtual void  SetSpectatorServerName(char * pszSpectatorServerName);
+  virtual void  ClearAllKeyValues();
+  virtual void  SetKeyValue(char * pKey, char * pValue);
+  virtual void  SetGameTags(char * pchGameTags);
+  virtual void  SetGameData(char * pchGameData);
+  virtual void  SetRegion(char * pszRegion);
+  virtual bool  SendUserConnectAndAuthenticate(uint32  unIPClient, void * pvAuthBlob, uint32  cubAuthBlobSize, CSteamID * pSteamIDUser);
+  virtual CSteamID  CreateUnauthenticatedUserConnection();
+  virtual void  SendUserDisconnect(CSteamID  steamIDUser);
+  virtual bool  BUpdateUserData(CSteamID  steamIDUser, char * pchPlayerName, uint32  uScore);
+  virtual HAuthTicket  GetAuthSessionTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket);
+  virtual EBeginAuthSessionResult  BeginAuthSession(void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID);
+  virtual void  EndAuthSession(CSteamID  steamID);
+  virtual void  CancelAuthTicket(HAuthTicket  hAuthTicket);
+  virtual EUserHasLicenseForAppResult  UserHasLicenseForApp(CSteamID  steamID, AppId_t  appID);
+  virtual bool  RequestUserGroupStatus(CSteamID  steamIDUser, CSteamID  steamIDGroup);
+  virtual void  GetGameplayStats();
+  virtual SteamAPICall_t  GetServerReputation();
+  virtual uint32  GetPublicIP();
+  virtual bool  HandleIncomingPacket(void * pData, int  cbData, uint32  srcIP, uint16  srcPort);
+  virtual int  GetNextOutgoingPacket(void * pOut, int  cbMaxOut, uint32 * pNetAdr, uint16 * pPort);
+  virtual void  EnableHeartbeats(bool  bActive);
+  virtual void  SetHeartbeatInterval(int  iHeartbeatInterval);
+  virtual void  ForceHeartbeat();
+  virtual SteamAPICall_t  AssociateWithClan(CSteamID  steamIDClan);
+  virtual SteamAPICall_t  ComputeNewPlayerCompatibility(CSteamID  steamIDNewPlayer);
+};
+
+class ISteamGameServerStatsStandIn
+{
+public:
+  virtual SteamAPICall_t  RequestUserStats(CSteamID  steamIDUser);
+  virtual bool  GetUserStat(CSteamID  steamIDUser, char * pchName, int32 * pData);
+  virtual bool  GetUserStat(CSteamID  steamIDUser, char * pchName, float * pData);
+  virtual bool  GetUserAchievement(CSteamID  steamIDUser, char * pchName, bool * pbAchieved);
+  virtual bool  SetUserStat(CSteamID  steamIDUser, char * pchName, int32  nData);
+  virtual bool  SetUserStat(CSteamID  steamIDUser, char * pchName, float  fData);
+  virtual bool  UpdateUserAvgRateStat(CSteamID  steamIDUser, char * pchName, float  flCountThisSession, double  dSessionLength);
+  virtual bool  SetUserAchievement(CSteamID  steamIDUser, char * pchName);
+  virtual bool  ClearUserAchievement(CSteamID  steamIDUser, char * pchName);
+  virtual SteamAPICall_t  StoreUserStats(CSteamID  steamIDUser);
+};
+
+class ISteamHTMLSurfaceStandIn
+{
+public:
+  virtual bool  Init();
+  virtual bool  Shutdown();
+  virtual SteamAPICall_t  CreateBrowser(char * pchUserAgent, char * pchUserCSS);
+  virtual void  RemoveBrowser(HHTMLBrowser  unBrowserHandle);
+  virtual void  LoadURL(HHTMLBrowser  unBrowserHandle, char * pchURL, char * pchPostData);
+  virtual void  SetSize(HHTMLBrowser  unBrowserHandle, uint32  unWidth, uint32  unHeight);
+  virtual void  StopLoad(HHTMLBrowser  unBrowserHandle);
+  virtual void  Reload(HHTMLBrowser  unBrowserHandle);
+  virtual void  GoBack(HHTMLBrowser  unBrowserHandle);
+  virtual void  GoForward(HHTMLBrowser  unBrowserHandle);
+  virtual void  AddHeader(HHTMLBrowser  unBrowserHandle, char * pchKey, char * pchValue);
+  virtual void  ExecuteJavascript(HHTMLBrowser  unBrowserHandle, char * pchScript);
+  virtual void  MouseUp(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton);
+  virtual void  MouseDown(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton);
+  virtual void  MouseDoubleClick(HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton);
+  virtual void  MouseMove(HHTMLBrowser  unBrowserHandle, int  x, int  y);
+  virtual void  MouseWheel(HHTMLBrowser  unBrowserHandle, int32  nDelta);
+  virtual void  KeyDown(HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers);
+  virtual void  KeyUp(HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers);
+  virtual void  KeyChar(HHTMLBrowser  unBrowserHandle, uint32  cUnicodeChar, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers);
+  virtual void  SetHorizontalScroll(HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll);
+  virtual void  SetVerticalScroll(HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll);
+  virtual void  SetKeyFocus(HHTMLBrowser  unBrowserHandle, bool  bHasKeyFocus);
+  virtual void  ViewSource(HHTMLBrowser  unBrowserHandle);
+  virtual void  CopyToClipboard(HHTMLBrowser  unBrowserHandle);
+  virtual void  PasteFromClipboard(HHTMLBrowser  unBrowserHandle);
+  virtual void  Find(HHTMLBrowser  unBrowserHandle, char * pchSearchStr, bool  bCurrentlyInFind, bool  bReverse);
+  virtual void  StopFind(HHTMLBrowser  unBrowserHandle);
+  virtual void  GetLinkAtPosition(HHTMLBrowser  unBrowserHandle, int  x, int  y);
+  virtual void  SetCookie(char * pchHostname, char * pchKey, char * pchValue, char * pchPath);
+  virtual void  SetPageScaleFactor(HHTMLBrowser  unBrowserHandle, float  flZoom, int  nPointX, int  nPointY);
+  virtual void  SetBackgroundMode(HHTMLBrowser  unBrowserHandle, bool  bBackgroundMode);
+  virtual void  AllowStartRequest(HHTMLBrowser  unBrowserHandle, bool  bAllowed);
+  virtual void  JSDialogResponse(HHTMLBrowser  unBrowserHandle, bool  bResult);
+  virtual void  FileLoadDialogResponse(HHTMLBrowser  unBrowserHandle, char ** pchSelectedFiles);
+};
+
+class ISteamHTTPStandIn
+{
+public:
+  virtual HTTPRequestHandle  CreateHTTPRequest(EHTTPMethod  eHTTPRequestMethod, char * pchAbsoluteURL);
+  virtual bool  SetHTTPRequestContextValue(HTTPRequestHandle  hRequest, uint64  ulContextValue);
+  virtual bool  SetHTTPRequestNetworkActivityTimeout(HTTPRequestHandle  hRequest, uint32  unTimeoutSeconds);
+  virtual bool  SetHTTPRequestHeaderValue(HTTPRequestHandle  hRequest, char * pchHeaderName, char * pchHeaderValue);
+  virtual bool  SetHTTPRequestGetOrPostParameter(HTTPRequestHandle  hRequest, char * pchParamName, char * pchParamValue);
+  virtual bool  SendHTTPRequest(HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle);
+  virtual bool  SendHTTPRequestAndStreamResponse(HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle);
+  virtual bool  DeferHTTPRequest(HTTPRequestHandle  hRequest);
+  virtual bool  PrioritizeHTTPRequest(HTTPRequestHandle  hRequest);
+  virtual bool  GetHTTPResponseHeaderSize(HTTPRequestHandle  hRequest, char * pchHeaderName, uint32 * unResponseHeaderSize);
+  virtual bool  GetHTTPResponseHeaderValue(HTTPRequestHandle  hRequest, char * pchHeaderName, uint8 * pHeaderValueBuffer, uint32  unBufferSize);
+  virtual bool  GetHTTPResponseBodySize(HTTPRequestHandle  hRequest, uint32 * unBodySize);
+  virtual bool  GetHTTPResponseBodyData(HTTPRequestHandle  hRequest, uint8 * pBodyDataBuffer, uint32  unBufferSize);
+  virtual bool  GetHTTPStreamingResponseBodyData(HTTPRequestHandle  hRequest, uint32  cOffset, uint8 * pBodyDataBuffer, uint32  unBufferSize);
+  virtual bool  ReleaseHTTPRequest(HTTPRequestHandle  hRequest);
+  virtual bool  GetHTTPDownloadProgressPct(HTTPRequestHandle  hRequest, float * pflPercentOut);
+  virtual bool  SetHTTPRequestRawPostBody(HTTPRequestHandle  hRequest, char * pchContentType, uint8 * pubBody, uint32  unBodyLen);
+  virtual HTTPCookieContainerHandle  CreateCookieContainer(bool  bAllowResponsesToModify);
+  virtual bool  ReleaseCookieContainer(HTTPCookieContainerHandle  hCookieContainer);
+  virtual bool  SetCookie(HTTPCookieContainerHandle  hCookieContainer, char * pchHost, char * pchUrl, char * pchCookie);
+  virtual bool  SetHTTPRequestCookieContainer(HTTPRequestHandle  hRequest, HTTPCookieContainerHandle  hCookieContainer);
+  virtual bool  SetHTTPRequestUserAgentInfo(HTTPRequestHandle  hRequest, char * pchUserAgentInfo);
+  virtual bool  SetHTTPRequestRequiresVerifiedCertificate(HTTPRequestHandle  hRequest, bool  bRequireVerifiedCertificate);
+  virtual bool  SetHTTPRequestAbsoluteTimeoutMS(HTTPRequestHandle  hRequest, uint32  unMilliseconds);
+  virtual bool  GetHTTPRequestWasTimedOut(HTTPRequestHandle  hRequest, bool * pbWasTimedOut);
+};
+
+class ISteamInventoryStandIn
+{
+public:
+  virtual EResult  GetResultStatus(SteamInventoryResult_t  resultHandle);
+  virtual bool  GetResultItems(SteamInventoryResult_t  resultHandle, SteamItemDetails_t * pOutItemsArray, uint32 * punOutItemsArraySize);
+  virtual uint32  GetResultTimestamp(SteamInventoryResult_t  resultHandle);
+  virtual bool  CheckResultSteamID(SteamInventoryResult_t  resultHandle, CSteamID  steamIDExpected);
+  virtual void  DestroyResult(SteamInventoryResult_t  resultHandle);
+  virtual bool  GetAllItems(SteamInventoryResult_t * pResultHandle);
+  virtual bool  GetItemsByID(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t * pInstanceIDs, uint32  unCountInstanceIDs);
+  virtual bool  SerializeResult(SteamInventoryResult_t  resultHandle, void * pOutBuffer, uint32 * punOutBufferSize);
+  virtual bool  DeserializeResult(SteamInventoryResult_t * pOutResultHandle, void * pBuffer, uint32  unBufferSize, bool  bRESERVED_MUST_BE_FALSE);
+  virtual bool  GenerateItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32 * punArrayQuantity, uint32  unArrayLength);
+  virtual bool  GrantPromoItems(SteamInventoryResult_t * pResultHandle);
+  virtual bool  AddPromoItem(SteamInventoryResult_t * pResultHandle, SteamItemDef_t  itemDef);
+  virtual bool  AddPromoItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32  unArrayLength);
+  virtual bool  ConsumeItem(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemConsume, uint32  unQuantity);
+  virtual bool  ExchangeItems(SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayGenerate, uint32 * punArrayGenerateQuantity, uint32  unArrayGenerateLength, SteamItemInstanceID_t * pArrayDestroy, uint32 * punArrayDestroyQuantity, uint32  unArrayDestroyLength);
+  virtual bool  TransferItemQuantity(SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemIdSource, uint32  unQuantity, SteamItemInstanceID_t  itemIdDest);
+  virtual void  SendItemDropHeartbeat();
+  virtual bool  TriggerItemDrop(SteamInventoryResult_t * pResultHandle, SteamItemDef_t  dropListDefinition);
+  virtual bool  TradeItems(SteamInventoryResult_t * pResultHandle, CSteamID  steamIDTradePartner, SteamItemInstanceID_t * pArrayGive, uint32 * pArrayGiveQuantity, uint32  nArrayGiveLength, SteamItemInstanceID_t * pArrayGet, uint32 * pArrayGetQuantity, uint32  nArrayGetLength);
+  virtual bool  LoadItemDefinitions();
+  virtual bool  GetItemDefinitionIDs(SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize);
+  virtual bool  GetItemDefinitionProperty(SteamItemDef_t  iDefinition, char * pchPropertyName, char * pchValueBuffer, uint32 * punValueBufferSizeOut);
+  virtual SteamAPICall_t  RequestEligiblePromoItemDefinitionsIDs(CSteamID  steamID);
+  virtual bool  GetEligiblePromoItemDefinitionIDs(CSteamID  steamID, SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize);
+};
+
+class ISteamMatchmakingStandIn
+{
+public:
+  virtual int  GetFavoriteGameCount();
+  virtual bool  GetFavoriteGame(int  iGame, AppId_t * pnAppID, uint32 * pnIP, uint16 * pnConnPort, uint16 * pnQueryPort, uint32 * punFlags, uint32 * pRTime32LastPlayedOnServer);
+  virtual int  AddFavoriteGame(AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags, uint32  rTime32LastPlayedOnServer);
+  virtual bool  RemoveFavoriteGame(AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags);
+  virtual SteamAPICall_t  RequestLobbyList();
+  virtual void  AddRequestLobbyListStringFilter(char * pchKeyToMatch, char * pchValueToMatch, ELobbyComparison  eComparisonType);
+  virtual void  AddRequestLobbyListNumericalFilter(char * pchKeyToMatch, int  nValueToMatch, ELobbyComparison  eComparisonType);
+  virtual void  AddRequestLobbyListNearValueFilter(char * pchKeyToMatch, int  nValueToBeCloseTo);
+  virtual void  AddRequestLobbyListFilterSlotsAvailable(int  nSlotsAvailable);
+  virtual void  AddRequestLobbyListDistanceFilter(ELobbyDistanceFilter  eLobbyDistanceFilter);
+  virtual void  AddRequestLobbyListResultCountFilter(int  cMaxResults);
+  virtual void  AddRequestLobbyListCompatibleMembersFilter(CSteamID  steamIDLobby);
+  virtual CSteamID  GetLobbyByIndex(int  iLobby);
+  virtual SteamAPICall_t  CreateLobby(ELobbyType  eLobbyType, int  cMaxMembers);
+  virtual SteamAPICall_t  JoinLobby(CSteamID  steamIDLobby);
+  virtual void  LeaveLobby(CSteamID  steamIDLobby);
+  virtual bool  InviteUserToLobby(CSteamID  steamIDLobby, CSteamID  steamIDInvitee);
+  virtual int  GetNumLobbyMembers(CSteamID  steamIDLobby);
+  virtual CSteamID  GetLobbyMemberByIndex(CSteamID  steamIDLobby, int  iMember);
+  virtual char * GetLobbyData(CSteamID  steamIDLobby, char * pchKey);
+  virtual bool  SetLobbyData(CSteamID  steamIDLobby, char * pchKey, char * pchValue);
+  virtual int  GetLobbyDataCount(CSteamID  steamIDLobby);
+  virtual bool  GetLobbyDataByIndex(CSteamID  steamIDLobby, int  iLobbyData, char * pchKey, int  cchKeyBufferSize, char * pchValue, int  cchValueBufferSize);
+  virtual bool  DeleteLobbyData(CSteamID  steamIDLobby, char * pchKey);
+  virtual char * GetLobbyMemberData(CSteamID  steamIDLobby, CSteamID  steamIDUser, char * pchKey);
+  virtual void  SetLobbyMemberData(CSteamID  steamIDLobby, char * pchKey, char * pchValue);
+  virtual bool  SendLobbyChatMsg(CSteamID  steamIDLobby, void * pvMsgBody, int  cubMsgBody);
+  virtual int  GetLobbyChatEntry(CSteamID  steamIDLobby, int  iChatID, CSteamID * pSteamIDUser, void * pvData, int  cubData, EChatEntryType * peChatEntryType);
+  virtual bool  RequestLobbyData(CSteamID  steamIDLobby);
+  virtual void  SetLobbyGameServer(CSteamID  steamIDLobby, uint32  unGameServerIP, uint16  unGameServerPort, CSteamID  steamIDGameServer);
+  virtual bool  GetLobbyGameServer(CSteamID  steamIDLobby, uint32 * punGameServerIP, uint16 * punGameServerPort, CSteamID * psteamIDGameServer);
+  virtual bool  SetLobbyMemberLimit(CSteamID  steamIDLobby, int  cMaxMembers);
+  virtual int  GetLobbyMemberLimit(CSteamID  steamIDLobby);
+  virtual bool  SetLobbyType(CSteamID  steamIDLobby, ELobbyType  eLobbyType);
+  virtual bool  SetLobbyJoinable(CSteamID  steamIDLobby, bool  bLobbyJoinable);
+  virtual CSteamID  GetLobbyOwner(CSteamID  steamIDLobby);
+  virtual bool  SetLobbyOwner(CSteamID  steamIDLobby, CSteamID  steamIDNewOwner);
+  virtual bool  SetLinkedLobby(CSteamID  steamIDLobby, CSteamID  steamIDLobbyDependent);
+};
+
+class ISteamMatchmakingServerListResponseStandIn
+{
+public:
+  virtual void  ServerResponded(HServerListRequest  hRequest, int  iServer);
+  virtual void  ServerFailedToRespond(HServerListRequest  hRequest, int  iServer);
+  virtual void  RefreshComplete(HServerListRequest  hRequest, EMatchMakingServerResponse  response);
+};
+
+class ISteamMatchmakingPingResponseStandIn
+{
+public:
+  virtual void  ServerResponded(gameserveritem_t & server);
+  virtual void  ServerFailedToRespond();
+};
+
+class ISteamMatchmakingPlayersResponseStandIn
+{
+public:
+  virtual void  AddPlayerToList(char * pchName, int  nScore, float  flTimePlayed);
+  virtual void  PlayersFailedToRespond();
+  virtual void  PlayersRefreshComplete();
+};
+
+class ISteamMatchmakingRulesResponseStandIn
+{
+public:
+  virtual void  RulesResponded(char * pchRule, char * pchValue);
+  virtual void  RulesFailedToRespond();
+  virtual void  RulesRefreshComplete();
+};
+
+class ISteamMatchmakingServersStandIn
+{
+public:
+  virtual HServerListRequest  RequestInternetServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+  virtual HServerListRequest  RequestLANServerList(AppId_t  iApp, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+  virtual HServerListRequest  RequestFriendsServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+  virtual HServerListRequest  RequestFavoritesServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+  virtual HServerListRequest  RequestHistoryServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+  virtual HServerListRequest  RequestSpectatorServerList(AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+  virtual void  ReleaseRequest(HServerListRequest  hServerListRequest);
+  virtual gameserveritem_t * GetServerDetails(HServerListRequest  hRequest, int  iServer);
+  virtual void  CancelQuery(HServerListRequest  hRequest);
+  virtual void  RefreshQuery(HServerListRequest  hRequest);
+  virtual bool  IsRefreshing(HServerListRequest  hRequest);
+  virtual int  GetServerCount(HServerListRequest  hRequest);
+  virtual void  RefreshServer(HServerListRequest  hRequest, int  iServer);
+  virtual HServerQuery  PingServer(uint32  unIP, uint16  usPort, ISteamMatchmakingPingResponse * pRequestServersResponse);
+  virtual HServerQuery  PlayerDetails(uint32  unIP, uint16  usPort, ISteamMatchmakingPlayersResponse * pRequestServersResponse);
+  virtual HServerQuery  ServerRules(uint32  unIP, uint16  usPort, ISteamMatchmakingRulesResponse * pRequestServersResponse);
+  virtual void  CancelServerQuery(HServerQuery  hServerQuery);
+};
+
+class ISteamMusicStandIn
+{
+public:
+  virtual bool  BIsEnabled();
+  virtual bool  BIsPlaying();
+  virtual AudioPlayback_Status  GetPlaybackStatus();
+  virtual void  Play();
+  virtual void  Pause();
+  virtual void  PlayPrevious();
+  virtual void  PlayNext();
+  virtual void  SetVolume(float  flVolume);
+  virtual float  GetVolume();
+};
+
+class ISteamMusicRemoteStandIn
+{
+public:
+  virtual bool  RegisterSteamMusicRemote(char * pchName);
+  virtual bool  DeregisterSteamMusicRemote();
+  virtual bool  BIsCurrentMusicRemote();
+  virtual bool  BActivationSuccess(bool  bValue);
+  virtual bool  SetDisplayName(char * pchDisplayName);
+  virtual bool  SetPNGIcon_64x64(void * pvBuffer, uint32  cbBufferLength);
+  virtual bool  EnablePlayPrevious(bool  bValue);
+  virtual bool  EnablePlayNext(bool  bValue);
+  virtual bool  EnableShuffled(bool  bValue);
+  virtual bool  EnableLooped(bool  bValue);
+  virtual bool  EnableQueue(bool  bValue);
+  virtual bool  EnablePlaylists(bool  bValue);
+  virtual bool  UpdatePlaybackStatus(AudioPlayback_Status  nStatus);
+  virtual bool  UpdateShuffled(bool  bValue);
+  virtual bool  UpdateLooped(bool  bValue);
+  virtual bool  UpdateVolume(float  flValue);
+  virtual bool  CurrentEntryWillChange();
+  virtual bool  CurrentEntryIsAvailable(bool  bAvailable);
+  virtual bool  UpdateCurrentEntryText(char * pchText);
+  virtual bool  UpdateCurrentEntryElapsedSeconds(int  nValue);
+  virtual bool  UpdateCurrentEntryCoverArt(void * pvBuffer, uint32  cbBufferLength);
+  virtual bool  CurrentEntryDidChange();
+  virtual bool  QueueWillChange();
+  virtual bool  ResetQueueEntries();
+  virtual bool  SetQueueEntry(int  nID, int  nPosition, char * pchEntryText);
+  virtual bool  SetCurrentQueueEntry(int  nID);
+  virtual bool  QueueDidChange();
+  virtual bool  PlaylistWillChange();
+  virtual bool  ResetPlaylistEntries();
+  virtual bool  SetPlaylistEntry(int  nID, int  nPosition, char * pchEntryText);
+  virtual bool  SetCurrentPlaylistEntry(int  nID);
+  virtual bool  PlaylistDidChange();
+};
+
+class ISteamNetworkingStandIn
+{
+public:
+  virtual bool  SendP2PPacket(CSteamID  steamIDRemote, void * pubData, uint32  cubData, EP2PSend  eP2PSendType, int  nChannel);
+  virtual bool  IsP2PPacketAvailable(uint32 * pcubMsgSize, int  nChannel);
+  virtual bool  ReadP2PPacket(void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, CSteamID * psteamIDRemote, int  nChannel);
+  virtual bool  AcceptP2PSessionWithUser(CSteamID  steamIDRemote);
+  virtual bool  CloseP2PSessionWithUser(CSteamID  steamIDRemote);
+  virtual bool  CloseP2PChannelWithUser(CSteamID  steamIDRemote, int  nChannel);
+  virtual bool  GetP2PSessionState(CSteamID  steamIDRemote, P2PSessionState_t * pConnectionState);
+  virtual bool  AllowP2PPacketRelay(bool  bAllow);
+  virtual SNetListenSocket_t  CreateListenSocket(int  nVirtualP2PPort, uint32  nIP, uint16  nPort, bool  bAllowUseOfPacketRelay);
+  virtual SNetSocket_t  CreateP2PConnectionSocket(CSteamID  steamIDTarget, int  nVirtualPort, int  nTimeoutSec, bool  bAllowUseOfPacketRelay);
+  virtual SNetSocket_t  CreateConnectionSocket(uint32  nIP, uint16  nPort, int  nTimeoutSec);
+  virtual bool  DestroySocket(SNetSocket_t  hSocket, bool  bNotifyRemoteEnd);
+  virtual bool  DestroyListenSocket(SNetListenSocket_t  hSocket, bool  bNotifyRemoteEnd);
+  virtual bool  SendDataOnSocket(SNetSocket_t  hSocket, void * pubData, uint32  cubData, bool  bReliable);
+  virtual bool  IsDataAvailableOnSocket(SNetSocket_t  hSocket, uint32 * pcubMsgSize);
+  virtual bool  RetrieveDataFromSocket(SNetSocket_t  hSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize);
+  virtual bool  IsDataAvailable(SNetListenSocket_t  hListenSocket, uint32 * pcubMsgSize, SNetSocket_t * phSocket);
+  virtual bool  RetrieveData(SNetListenSocket_t  hListenSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, SNetSocket_t * phSocket);
+  virtual bool  GetSocketInfo(SNetSocket_t  hSocket, CSteamID * pSteamIDRemote, int * peSocketStatus, uint32 * punIPRemote, uint16 * punPortRemote);
+  virtual bool  GetListenSocketInfo(SNetListenSocket_t  hListenSocket, uint32 * pnIP, uint16 * pnPort);
+  virtual ESNetSocketConnectionType  GetSocketConnectionType(SNetSocket_t  hSocket);
+  virtual int  GetMaxPacketSize(SNetSocket_t  hSocket);
+};
+
+class ISteamRemoteStorageStandIn
+{
+public:
+  virtual bool  FileWrite(char * pchFile, void * pvData, int32  cubData);
+  virtual int32  FileRead(char * pchFile, void * pvData, int32  cubDataToRead);
+  virtual SteamAPICall_t  FileWriteAsync(char * pchFile, void * pvData, uint32  cubData);
+  virtual SteamAPICall_t  FileReadAsync(char * pchFile, uint32  nOffset, uint32  cubToRead);
+  virtual bool  FileReadAsyncComplete(SteamAPICall_t  hReadCall, void * pvBuffer, uint32  cubToRead);
+  virtual bool  FileForget(char * pchFile);
+  virtual bool  FileDelete(char * pchFile);
+  virtual SteamAPICall_t  FileShare(char * pchFile);
+  virtual bool  SetSyncPlatforms(char * pchFile, ERemoteStoragePlatform  eRemoteStoragePlatform);
+  virtual UGCFileWriteStreamHandle_t  FileWriteStreamOpen(char * pchFile);
+  virtual bool  FileWriteStreamWriteChunk(UGCFileWriteStreamHandle_t  writeHandle, void * pvData, int32  cubData);
+  virtual bool  FileWriteStreamClose(UGCFileWriteStreamHandle_t  writeHandle);
+  virtual bool  FileWriteStreamCancel(UGCFileWriteStreamHandle_t  writeHandle);
+  virtual bool  FileExists(char * pchFile);
+  virtual bool  FilePersisted(char * pchFile);
+  virtual int32  GetFileSize(char * pchFile);
+  virtual int64  GetFileTimestamp(char * pchFile);
+  virtual ERemoteStoragePlatform  GetSyncPlatforms(char * pchFile);
+  virtual int32  GetFileCount();
+  virtual char * GetFileNameAndSize(int  iFile, int32 * pnFileSizeInBytes);
+  virtual bool  GetQuota(uint64 * pnTotalBytes, uint64 * puAvailableBytes);
+  virtual bool  IsCloudEnabledForAccount();
+  virtual bool  IsCloudEnabledForApp();
+  virtual void  SetCloudEnabledForApp(bool  bEnabled);
+  virtual SteamAPICall_t  UGCDownload(UGCHandle_t  hContent, uint32  unPriority);
+  virtual bool  GetUGCDownloadProgress(UGCHandle_t  hContent, int32 * pnBytesDownloaded, int32 * pnBytesExpected);
+  virtual bool  GetUGCDetails(UGCHandle_t  hContent, AppId_t * pnAppID, char ** ppchName, int32 * pnFileSizeInBytes, CSteamID * pSteamIDOwner);
+  virtual int32  UGCRead(UGCHandle_t  hContent, void * pvData, int32  cubDataToRead, uint32  cOffset, EUGCReadAction  eAction);
+  virtual int32  GetCachedUGCCount();
+  virtual UGCHandle_t  GetCachedUGCHandle(int32  iCachedContent);
+  virtual SteamAPICall_t  PublishWorkshopFile(char * pchFile, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags, EWorkshopFileType  eWorkshopFileType);
+  virtual PublishedFileUpdateHandle_t  CreatePublishedFileUpdateRequest(PublishedFileId_t  unPublishedFileId);
+  virtual bool  UpdatePublishedFileFile(PublishedFileUpdateHandle_t  updateHandle, char * pchFile);
+  virtual bool  UpdatePublishedFilePreviewFile(PublishedFileUpdateHandle_t  updateHandle, char * pchPreviewFile);
+  virtual bool  UpdatePublishedFileTitle(PublishedFileUpdateHandle_t  updateHandle, char * pchTitle);
+  virtual bool  UpdatePublishedFileDescription(PublishedFileUpdateHandle_t  updateHandle, char * pchDescription);
+  virtual bool  UpdatePublishedFileVisibility(PublishedFileUpdateHandle_t  updateHandle, ERemoteStoragePublishedFileVisibility  eVisibility);
+  virtual bool  UpdatePublishedFileTags(PublishedFileUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags);
+  virtual SteamAPICall_t  CommitPublishedFileUpdate(PublishedFileUpdateHandle_t  updateHandle);
+  virtual SteamAPICall_t  GetPublishedFileDetails(PublishedFileId_t  unPublishedFileId, uint32  unMaxSecondsOld);
+  virtual SteamAPICall_t  DeletePublishedFile(PublishedFileId_t  unPublishedFileId);
+  virtual SteamAPICall_t  EnumerateUserPublishedFiles(uint32  unStartIndex);
+  virtual SteamAPICall_t  SubscribePublishedFile(PublishedFileId_t  unPublishedFileId);
+  virtual SteamAPICall_t  EnumerateUserSubscribedFiles(uint32  unStartIndex);
+  virtual SteamAPICall_t  UnsubscribePublishedFile(PublishedFileId_t  unPublishedFileId);
+  virtual bool  UpdatePublishedFileSetChangeDescription(PublishedFileUpdateHandle_t  updateHandle, char * pchChangeDescription);
+  virtual SteamAPICall_t  GetPublishedItemVoteDetails(PublishedFileId_t  unPublishedFileId);
+  virtual SteamAPICall_t  UpdateUserPublishedItemVote(PublishedFileId_t  unPublishedFileId, bool  bVoteUp);
+  virtual SteamAPICall_t  GetUserPublishedItemVoteDetails(PublishedFileId_t  unPublishedFileId);
+  virtual SteamAPICall_t  EnumerateUserSharedWorkshopFiles(CSteamID  steamId, uint32  unStartIndex, SteamParamStringArray_t * pRequiredTags, SteamParamStringArray_t * pExcludedTags);
+  virtual SteamAPICall_t  PublishVideo(EWorkshopVideoProvider  eVideoProvider, char * pchVideoAccount, char * pchVideoIdentifier, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags);
+  virtual SteamAPICall_t  SetUserPublishedFileAction(PublishedFileId_t  unPublishedFileId, EWorkshopFileAction  eAction);
+  virtual SteamAPICall_t  EnumeratePublishedFilesByUserAction(EWorkshopFileAction  eAction, uint32  unStartIndex);
+  virtual SteamAPICall_t  EnumeratePublishedWorkshopFiles(EWorkshopEnumerationType  eEnumerationType, uint32  unStartIndex, uint32  unCount, uint32  unDays, SteamParamStringArray_t * pTags, SteamParamStringArray_t * pUserTags);
+  virtual SteamAPICall_t  UGCDownloadToLocation(UGCHandle_t  hContent, char * pchLocation, uint32  unPriority);
+};
+
+class ISteamScreenshotsStandIn
+{
+public:
+  virtual ScreenshotHandle  WriteScreenshot(void * pubRGB, uint32  cubRGB, int  nWidth, int  nHeight);
+  virtual ScreenshotHandle  AddScreenshotToLibrary(char * pchFilename, char * pchThumbnailFilename, int  nWidth, int  nHeight);
+  virtual void  TriggerScreenshot();
+  virtual void  HookScreenshots(bool  bHook);
+  virtual bool  SetLocation(ScreenshotHandle  hScreenshot, char * pchLocation);
+  virtual bool  TagUser(ScreenshotHandle  hScreenshot, CSteamID  steamID);
+  virtual bool  TagPublishedFile(ScreenshotHandle  hScreenshot, PublishedFileId_t  unPublishedFileID);
+  virtual bool  IsScreenshotsHooked();
+  virtual ScreenshotHandle  AddVRScreenshotToLibrary(EVRScreenshotType  eType, char * pchFilename, char * pchVRFilename);
+};
+
+class ISteamUGCStandIn
+{
+public:
+  virtual UGCQueryHandle_t  CreateQueryUserUGCRequest(AccountID_t  unAccountID, EUserUGCList  eListType, EUGCMatchingUGCType  eMatchingUGCType, EUserUGCListSortOrder  eSortOrder, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage);
+  virtual UGCQueryHandle_t  CreateQueryAllUGCRequest(EUGCQuery  eQueryType, EUGCMatchingUGCType  eMatchingeMatchingUGCTypeFileType, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage);
+  virtual UGCQueryHandle_t  CreateQueryUGCDetailsRequest(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs);
+  virtual SteamAPICall_t  SendQueryUGCRequest(UGCQueryHandle_t  handle);
+  virtual bool  GetQueryUGCResult(UGCQueryHandle_t  handle, uint32  index, SteamUGCDetails_t * pDetails);
+  virtual bool  GetQueryUGCPreviewURL(UGCQueryHandle_t  handle, uint32  index, char * pchURL, uint32  cchURLSize);
+  virtual bool  GetQueryUGCMetadata(UGCQueryHandle_t  handle, uint32  index, char * pchMetadata, uint32  cchMetadatasize);
+  virtual bool  GetQueryUGCChildren(UGCQueryHandle_t  handle, uint32  index, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries);
+  virtual bool  GetQueryUGCStatistic(UGCQueryHandle_t  handle, uint32  index, EItemStatistic  eStatType, uint64 * pStatValue);
+  virtual uint32  GetQueryUGCNumAdditionalPreviews(UGCQueryHandle_t  handle, uint32  index);
+  virtual bool  GetQueryUGCAdditionalPreview(UGCQueryHandle_t  handle, uint32  index, uint32  previewIndex, char * pchURLOrVideoID, uint32  cchURLSize, char * pchOriginalFileName, uint32  cchOriginalFileNameSize, EItemPreviewType * pPreviewType);
+  virtual uint32  GetQueryUGCNumKeyValueTags(UGCQueryHandle_t  handle, uint32  index);
+  virtual bool  GetQueryUGCKeyValueTag(UGCQueryHandle_t  handle, uint32  index, uint32  keyValueTagIndex, char * pchKey, uint32  cchKeySize, char * pchValue, uint32  cchValueSize);
+  virtual bool  ReleaseQueryUGCRequest(UGCQueryHandle_t  handle);
+  virtual bool  AddRequiredTag(UGCQueryHandle_t  handle, char * pTagName);
+  virtual bool  AddExcludedTag(UGCQueryHandle_t  handle, char * pTagName);
+  virtual bool  SetReturnOnlyIDs(UGCQueryHandle_t  handle, bool  bReturnOnlyIDs);
+  virtual bool  SetReturnKeyValueTags(UGCQueryHandle_t  handle, bool  bReturnKeyValueTags);
+  virtual bool  SetReturnLongDescription(UGCQueryHandle_t  handle, bool  bReturnLongDescription);
+  virtual bool  SetReturnMetadata(UGCQueryHandle_t  handle, bool  bReturnMetadata);
+  virtual bool  SetReturnChildren(UGCQueryHandle_t  handle, bool  bReturnChildren);
+  virtual bool  SetReturnAdditionalPreviews(UGCQueryHandle_t  handle, bool  bReturnAdditionalPreviews);
+  virtual bool  SetReturnTotalOnly(UGCQueryHandle_t  handle, bool  bReturnTotalOnly);
+  virtual bool  SetLanguage(UGCQueryHandle_t  handle, char * pchLanguage);
+  virtual bool  SetAllowCachedResponse(UGCQueryHandle_t  handle, uint32  unMaxAgeSeconds);
+  virtual bool  SetCloudFileNameFilter(UGCQueryHandle_t  handle, char * pMatchCloudFileName);
+  virtual bool  SetMatchAnyTag(UGCQueryHandle_t  handle, bool  bMatchAnyTag);
+  virtual bool  SetSearchText(UGCQueryHandle_t  handle, char * pSearchText);
+  virtual bool  SetRankedByTrendDays(UGCQueryHandle_t  handle, uint32  unDays);
+  virtual bool  AddRequiredKeyValueTag(UGCQueryHandle_t  handle, char * pKey, char * pValue);
+  virtual SteamAPICall_t  RequestUGCDetails(PublishedFileId_t  nPublishedFileID, uint32  unMaxAgeSeconds);
+  virtual SteamAPICall_t  CreateItem(AppId_t  nConsumerAppId, EWorkshopFileType  eFileType);
+  virtual UGCUpdateHandle_t  StartItemUpdate(AppId_t  nConsumerAppId, PublishedFileId_t  nPublishedFileID);
+  virtual bool  SetItemTitle(UGCUpdateHandle_t  handle, char * pchTitle);
+  virtual bool  SetItemDescription(UGCUpdateHandle_t  handle, char * pchDescription);
+  virtual bool  SetItemUpdateLanguage(UGCUpdateHandle_t  handle, char * pchLanguage);
+  virtual bool  SetItemMetadata(UGCUpdateHandle_t  handle, char * pchMetaData);
+  virtual bool  SetItemVisibility(UGCUpdateHandle_t  handle, ERemoteStoragePublishedFileVisibility  eVisibility);
+  virtual bool  SetItemTags(UGCUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags);
+  virtual bool  SetItemContent(UGCUpdateHandle_t  handle, char * pszContentFolder);
+  virtual bool  SetItemPreview(UGCUpdateHandle_t  handle, char * pszPreviewFile);
+  virtual bool  RemoveItemKeyValueTags(UGCUpdateHandle_t  handle, char * pchKey);
+  virtual bool  AddItemKeyValueTag(UGCUpdateHandle_t  handle, char * pchKey, char * pchValue);
+  virtual bool  AddItemPreviewFile(UGCUpdateHandle_t  handle, char * pszPreviewFile, EItemPreviewType  type);
+  virtual bool  AddItemPreviewVideo(UGCUpdateHandle_t  handle, char * pszVideoID);
+  virtual bool  UpdateItemPreviewFile(UGCUpdateHandle_t  handle, uint32  index, char * pszPreviewFile);
+  virtual bool  UpdateItemPreviewVideo(UGCUpdateHandle_t  handle, uint32  index, char * pszVideoID);
+  virtual bool  RemoveItemPreview(UGCUpdateHandle_t  handle, uint32  index);
+  virtual SteamAPICall_t  SubmitItemUpdate(UGCUpdateHandle_t  handle, char * pchChangeNote);
+  virtual EItemUpdateStatus  GetItemUpdateProgress(UGCUpdateHandle_t  handle, uint64 * punBytesProcessed, uint64 * punBytesTotal);
+  virtual SteamAPICall_t  SetUserItemVote(PublishedFileId_t  nPublishedFileID, bool  bVoteUp);
+  virtual SteamAPICall_t  GetUserItemVote(PublishedFileId_t  nPublishedFileID);
+  virtual SteamAPICall_t  AddItemToFavorites(AppId_t  nAppId, PublishedFileId_t  nPublishedFileID);
+  virtual SteamAPICall_t  RemoveItemFromFavorites(AppId_t  nAppId, PublishedFileId_t  nPublishedFileID);
+  virtual SteamAPICall_t  SubscribeItem(PublishedFileId_t  nPublishedFileID);
+  virtual SteamAPICall_t  UnsubscribeItem(PublishedFileId_t  nPublishedFileID);
+  virtual uint32  GetNumSubscribedItems();
+  virtual uint32  GetSubscribedItems(PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries);
+  virtual uint32  GetItemState(PublishedFileId_t  nPublishedFileID);
+  virtual bool  GetItemInstallInfo(PublishedFileId_t  nPublishedFileID, uint64 * punSizeOnDisk, char * pchFolder, uint32  cchFolderSize, uint32 * punTimeStamp);
+  virtual bool  GetItemDownloadInfo(PublishedFileId_t  nPublishedFileID, uint64 * punBytesDownloaded, uint64 * punBytesTotal);
+  virtual bool  DownloadItem(PublishedFileId_t  nPublishedFileID, bool  bHighPriority);
+  virtual bool  BInitWorkshopForGameServer(DepotId_t  unWorkshopDepotID, char * pszFolder);
+  virtual void  SuspendDownloads(bool  bSuspend);
+  virtual SteamAPICall_t  StartPlaytimeTracking(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs);
+  virtual SteamAPICall_t  StopPlaytimeTracking(PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs);
+  virtual SteamAPICall_t  StopPlaytimeTrackingForAllItems();
+};
+
+class ISteamUnifiedMessagesStandIn
+{
+public:
+  virtual ClientUnifiedMessageHandle  SendMethod(char * pchServiceMethod, void * pRequestBuffer, uint32  unRequestBufferSize, uint64  unContext);
+  virtual bool  GetMethodResponseInfo(ClientUnifiedMessageHandle  hHandle, uint32 * punResponseSize, EResult * peResult);
+  virtual bool  GetMethodResponseData(ClientUnifiedMessageHandle  hHandle, void * pResponseBuffer, uint32  unResponseBufferSize, bool  bAutoRelease);
+  virtual bool  ReleaseMethod(ClientUnifiedMessageHandle  hHandle);
+  virtual bool  SendNotification(char * pchServiceNotification, void * pNotificationBuffer, uint32  unNotificationBufferSize);
+};
+
+class ISteamUserStandIn
+{
+public:
+  virtual HSteamUser  GetHSteamUser();
+  virtual bool  BLoggedOn();
+  virtual CSteamID  GetSteamID();
+  virtual int  InitiateGameConnection(void * pAuthBlob, int  cbMaxAuthBlob, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer, bool  bSecure);
+  virtual void  TerminateGameConnection(uint32  unIPServer, uint16  usPortServer);
+  virtual void  TrackAppUsageEvent(CGameID  gameID, int  eAppUsageEvent, char * pchExtraInfo);
+  virtual bool  GetUserDataFolder(char * pchBuffer, int  cubBuffer);
+  virtual void  StartVoiceRecording();
+  virtual void  StopVoiceRecording();
+  virtual EVoiceResult  GetAvailableVoice(uint32 * pcbCompressed, uint32 * pcbUncompressed, uint32  nUncompressedVoiceDesiredSampleRate);
+  virtual EVoiceResult  GetVoice(bool  bWantCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, bool  bWantUncompressed, void * pUncompressedDestBuffer, uint32  cbUncompressedDestBufferSize, uint32 * nUncompressBytesWritten, uint32  nUncompressedVoiceDesiredSampleRate);
+  virtual EVoiceResult  DecompressVoice(void * pCompressed, uint32  cbCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, uint32  nDesiredSampleRate);
+  virtual uint32  GetVoiceOptimalSampleRate();
+  virtual HAuthTicket  GetAuthSessionTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket);
+  virtual EBeginAuthSessionResult  BeginAuthSession(void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID);
+  virtual void  EndAuthSession(CSteamID  steamID);
+  virtual void  CancelAuthTicket(HAuthTicket  hAuthTicket);
+  virtual EUserHasLicenseForAppResult  UserHasLicenseForApp(CSteamID  steamID, AppId_t  appID);
+  virtual bool  BIsBehindNAT();
+  virtual void  AdvertiseGame(CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer);
+  virtual SteamAPICall_t  RequestEncryptedAppTicket(void * pDataToInclude, int  cbDataToInclude);
+  virtual bool  GetEncryptedAppTicket(void * pTicket, int  cbMaxTicket, uint32 * pcbTicket);
+  virtual int  GetGameBadgeLevel(int  nSeries, bool  bFoil);
+  virtual int  GetPlayerSteamLevel();
+  virtual SteamAPICall_t  RequestStoreAuthURL(char * pchRedirectURL);
+  virtual bool  BIsPhoneVerified();
+  virtual bool  BIsTwoFactorEnabled();
+  virtual bool  BIsPhoneIdentifying();
+  virtual bool  BIsPhoneRequiringVerification();
+};
+
+class ISteamUserStatsStandIn
+{
+public:
+  virtual bool  RequestCurrentStats();
+  virtual bool  GetStat(char * pchName, int32 * pData);
+  virtual bool  GetStat(char * pchName, float * pData);
+  virtual bool  SetStat(char * pchName, int32  nData);
+  virtual bool  SetStat(char * pchName, float  fData);
+  virtual bool  UpdateAvgRateStat(char * pchName, float  flCountThisSession, double  dSessionLength);
+  virtual bool  GetAchievement(char * pchName, bool * pbAchieved);
+  virtual bool  SetAchievement(char * pchName);
+  virtual bool  ClearAchievement(char * pchName);
+  virtual bool  GetAchievementAndUnlockTime(char * pchName, bool * pbAchieved, uint32 * punUnlockTime);
+  virtual bool  StoreStats();
+  virtual int  GetAchievementIcon(char * pchName);
+  virtual char * GetAchievementDisplayAttribute(char * pchName, char * pchKey);
+  virtual bool  IndicateAchievementProgress(char * pchName, uint32  nCurProgress, uint32  nMaxProgress);
+  virtual uint32  GetNumAchievements();
+  virtual char * GetAchievementName(uint32  iAchievement);
+  virtual SteamAPICall_t  RequestUserStats(CSteamID  steamIDUser);
+  virtual bool  GetUserStat(CSteamID  steamIDUser, char * pchName, int32 * pData);
+  virtual bool  GetUserStat(CSteamID  steamIDUser, char * pchName, float * pData);
+  virtual bool  GetUserAchievement(CSteamID  steamIDUser, char * pchName, bool * pbAchieved);
+  virtual bool  GetUserAchievementAndUnlockTime(CSteamID  steamIDUser, char * pchName, bool * pbAchieved, uint32 * punUnlockTime);
+  virtual bool  ResetAllStats(bool  bAchievementsToo);
+  virtual SteamAPICall_t  FindOrCreateLeaderboard(char * pchLeaderboardName, ELeaderboardSortMethod  eLeaderboardSortMethod, ELeaderboardDisplayType  eLeaderboardDisplayType);
+  virtual SteamAPICall_t  FindLeaderboard(char * pchLeaderboardName);
+  virtual char * GetLeaderboardName(SteamLeaderboard_t  hSteamLeaderboard);
+  virtual int  GetLeaderboardEntryCount(SteamLeaderboard_t  hSteamLeaderboard);
+  virtual ELeaderboardSortMethod  GetLeaderboardSortMethod(SteamLeaderboard_t  hSteamLeaderboard);
+  virtual ELeaderboardDisplayType  GetLeaderboardDisplayType(SteamLeaderboard_t  hSteamLeaderboard);
+  virtual SteamAPICall_t  DownloadLeaderboardEntries(SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardDataRequest  eLeaderboardDataRequest, int  nRangeStart, int  nRangeEnd);
+  virtual SteamAPICall_t  DownloadLeaderboardEntriesForUsers(SteamLeaderboard_t  hSteamLeaderboard, CSteamID * prgUsers, int  cUsers);
+  virtual bool  GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t  hSteamLeaderboardEntries, int  index, LeaderboardEntry_t * pLeaderboardEntry, int32 * pDetails, int  cDetailsMax);
+  virtual SteamAPICall_t  UploadLeaderboardScore(SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardUploadScoreMethod  eLeaderboardUploadScoreMethod, int32  nScore, int32 * pScoreDetails, int  cScoreDetailsCount);
+  virtual SteamAPICall_t  AttachLeaderboardUGC(SteamLeaderboard_t  hSteamLeaderboard, UGCHandle_t  hUGC);
+  virtual SteamAPICall_t  GetNumberOfCurrentPlayers();
+  virtual SteamAPICall_t  RequestGlobalAchievementPercentages();
+  virtual int  GetMostAchievedAchievementInfo(char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved);
+  virtual int  GetNextMostAchievedAchievementInfo(int  iIteratorPrevious, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved);
+  virtual bool  GetAchievementAchievedPercent(char * pchName, float * pflPercent);
+  virtual SteamAPICall_t  RequestGlobalStats(int  nHistoryDays);
+  virtual bool  GetGlobalStat(char * pchStatName, int64 * pData);
+  virtual bool  GetGlobalStat(char * pchStatName, double * pData);
+  virtual int32  GetGlobalStatHistory(char * pchStatName, int64 * pData, uint32  cubData);
+  virtual int32  GetGlobalStatHistory(char * pchStatName, double * pData, uint32  cubData);
+};
+
+class ISteamUtilsStandIn
+{
+public:
+  virtual uint32  GetSecondsSinceAppActive();
+  virtual uint32  GetSecondsSinceComputerActive();
+  virtual EUniverse  GetConnectedUniverse();
+  virtual uint32  GetServerRealTime();
+  virtual char * GetIPCountry();
+  virtual bool  GetImageSize(int  iImage, uint32 * pnWidth, uint32 * pnHeight);
+  virtual bool  GetImageRGBA(int  iImage, uint8 * pubDest, int  nDestBufferSize);
+  virtual bool  GetCSERIPPort(uint32 * unIP, uint16 * usPort);
+  virtual uint8  GetCurrentBatteryPower();
+  virtual uint32  GetAppID();
+  virtual void  SetOverlayNotificationPosition(ENotificationPosition  eNotificationPosition);
+  virtual bool  IsAPICallCompleted(SteamAPICall_t  hSteamAPICall, bool * pbFailed);
+  virtual ESteamAPICallFailure  GetAPICallFailureReason(SteamAPICall_t  hSteamAPICall);
+  virtual bool  GetAPICallResult(SteamAPICall_t  hSteamAPICall, void * pCallback, int  cubCallback, int  iCallbackExpected, bool * pbFailed);
+  virtual void  RunFrame();
+  virtual uint32  GetIPCCallCount();
+  virtual void  SetWarningMessageHook(SteamAPIWarningMessageHook_t  pFunction);
+  virtual bool  IsOverlayEnabled();
+  virtual bool  BOverlayNeedsPresent();
+  virtual SteamAPICall_t  CheckFileSignature(char * szFileName);
+  virtual bool  ShowGamepadTextInput(EGamepadTextInputMode  eInputMode, EGamepadTextInputLineMode  eLineInputMode, char * pchDescription, uint32  unCharMax, char * pchExistingText);
+  virtual uint32  GetEnteredGamepadTextLength();
+  virtual bool  GetEnteredGamepadTextInput(char * pchText, uint32  cchText);
+  virtual char * GetSteamUILanguage();
+  virtual bool  IsSteamRunningInVR();
+  virtual void  SetOverlayNotificationInset(int  nHorizontalInset, int  nVerticalInset);
+  virtual bool  IsSteamInBigPictureMode();
+  virtual void  StartVRDashboard();
+};
+
+class ISteamVideoStandIn
+{
+public:
+  virtual void  GetVideoURL(AppId_t  unVideoAppID);
+  virtual bool  IsBroadcasting(int * pnNumViewers);
+};
+
+#endif
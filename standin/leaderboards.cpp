@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "interfaces.h"
+
+// Leaderboards of the stand-in. FindOrCreateLeaderboard creates boards with
+// STEAMSTANDIN_LEADERBOARD_ENTRIES fake players; the user gets an entry by
+// uploading a score. Results arrive as call results like in Steam.
+
+// Downloaded entries kept for GetDownloadedLeaderboardEntry, older ones
+// are dropped
+#define STANDIN_LEADERBOARD_DOWNLOADS 256
+#define STANDIN_LEADERBOARD_PLAYER 1000
+
+struct Score
+{
+  uint64 user;
+  int32 score;
+  std::vector<int32> details;
+};
+
+struct Leaderboard
+{
+  std::string name;
+  ELeaderboardSortMethod sort;
+  ELeaderboardDisplayType display;
+  // Best first
+  std::vector<Score> scores;
+
+  bool better(int32 a, int32 b) const
+  {
+    return sort == k_ELeaderboardSortMethodAscending ? a < b : a > b;
+  }
+};
+
+struct Download
+{
+  std::vector<LeaderboardEntry_t> entries;
+  std::vector<std::vector<int32> > details;
+};
+
+static std::mutex leaderboardLock;
+// SteamLeaderboard_t is the index plus one
+static std::vector<Leaderboard> leaderboards;
+static std::map<SteamLeaderboardEntries_t, Download> downloads;
+static SteamLeaderboardEntries_t lastDownload = 0;
+
+// With leaderboardLock held
+static Leaderboard *leaderboard(SteamLeaderboard_t handle)
+{
+  return handle > 0 && handle <= leaderboards.size() ? &leaderboards[handle - 1] : NULL;
+}
+
+static SteamLeaderboard_t findLeaderboard(const char *name)
+{
+  for (size_t i = 0; i < leaderboards.size(); i++)
+    if (leaderboards[i].name == name)
+      return i + 1;
+  return 0;
+}
+
+static int rankOf(const Leaderboard &board, uint64 user)
+{
+  for (size_t i = 0; i < board.scores.size(); i++)
+    if (board.scores[i].user == user)
+      return i + 1;
+  return 0;
+}
+
+SteamAPICall_t ISteamUserStatsStandIn::FindOrCreateLeaderboard(char *pchLeaderboardName,
+  ELeaderboardSortMethod eLeaderboardSortMethod, ELeaderboardDisplayType eLeaderboardDisplayType)
+{
+  standinLatency();
+  LeaderboardFindResult_t result;
+  memset(&result, 0, sizeof(result));
+  if (pchLeaderboardName != NULL)
+  {
+    std::lock_guard<std::mutex> guard(leaderboardLock);
+    result.m_hSteamLeaderboard = findLeaderboard(pchLeaderboardName);
+    if (result.m_hSteamLeaderboard == 0)
+    {
+      leaderboards.push_back(Leaderboard());
+      Leaderboard &board = leaderboards.back();
+      board.name = pchLeaderboardName;
+      board.sort = eLeaderboardSortMethod;
+      board.display = eLeaderboardDisplayType;
+      unsigned count = standinConfig.leaderboardEntries;
+      for (unsigned i = 0; i < count; i++)
+      {
+        Score score;
+        score.user = CSteamID(STANDIN_LEADERBOARD_PLAYER + i, k_EUniversePublic,
+                              k_EAccountTypeIndividual).ConvertToUint64();
+        score.score = board.sort == k_ELeaderboardSortMethodAscending ? i + 1 : count - i;
+        board.scores.push_back(score);
+      }
+      result.m_hSteamLeaderboard = leaderboards.size();
+    }
+    result.m_bLeaderboardFound = 1;
+  }
+  return standinCallResult(&result, sizeof(result), LeaderboardFindResult_t::k_iCallback);
+}
+
+SteamAPICall_t ISteamUserStatsStandIn::FindLeaderboard(char *pchLeaderboardName)
+{
+  standinLatency();
+  LeaderboardFindResult_t result;
+  memset(&result, 0, sizeof(result));
+  if (pchLeaderboardName != NULL)
+  {
+    std::lock_guard<std::mutex> guard(leaderboardLock);
+    result.m_hSteamLeaderboard = findLeaderboard(pchLeaderboardName);
+    result.m_bLeaderboardFound = result.m_hSteamLeaderboard != 0;
+  }
+  return standinCallResult(&result, sizeof(result), LeaderboardFindResult_t::k_iCallback);
+}
+
+char *ISteamUserStatsStandIn::GetLeaderboardName(SteamLeaderboard_t hSteamLeaderboard)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(leaderboardLock);
+  Leaderboard *board = leaderboard(hSteamLeaderboard);
+  return board != NULL ? (char *)board->name.c_str() : (char *)"";
+}
+
+int ISteamUserStatsStandIn::GetLeaderboardEntryCount(SteamLeaderboard_t hSteamLeaderboard)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(leaderboardLock);
+  Leaderboard *board = leaderboard(hSteamLeaderboard);
+  return board != NULL ? board->scores.size() : 0;
+}
+
+ELeaderboardSortMethod ISteamUserStatsStandIn::GetLeaderboardSortMethod(SteamLeaderboard_t hSteamLeaderboard)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(leaderboardLock);
+  Leaderboard *board = leaderboard(hSteamLeaderboard);
+  return board != NULL ? board->sort : k_ELeaderboardSortMethodNone;
+}
+
+ELeaderboardDisplayType ISteamUserStatsStandIn::GetLeaderboardDisplayType(SteamLeaderboard_t hSteamLeaderboard)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(leaderboardLock);
+  Leaderboard *board = leaderboard(hSteamLeaderboard);
+  return board != NULL ? board->display : k_ELeaderboardDisplayTypeNone;
+}
+
+// With leaderboardLock held
+static void downloadEntries(LeaderboardScoresDownloaded_t &result, ELeaderboardDataRequest request,
+                            int start, int end)
+{
+  Leaderboard *board = leaderboard(result.m_hSteamLeaderboard);
+  if (board == NULL)
+    return;
+  // Ranks are counted from 1, around the user from the rank of the user
+  int first = start, last = end;
+  int user = rankOf(*board, standinSteamID().ConvertToUint64());
+  if (request == k_ELeaderboardDataRequestGlobalAroundUser)
+  {
+    first = user != 0 ? user + start : 1;
+    last = user != 0 ? user + end : 0;
+  }
+  else if (request != k_ELeaderboardDataRequestGlobal)
+    first = last = user;
+  first = std::max(first, 1);
+  last = std::min(last, (int)board->scores.size());
+  Download &download = downloads[++lastDownload];
+  for (int rank = first; rank <= last; rank++)
+  {
+    const Score &score = board->scores[rank - 1];
+    LeaderboardEntry_t entry = LeaderboardEntry_t();
+    entry.m_steamIDUser = CSteamID(score.user);
+    entry.m_nGlobalRank = rank;
+    entry.m_nScore = score.score;
+    entry.m_cDetails = score.details.size();
+    download.entries.push_back(entry);
+    download.details.push_back(score.details);
+  }
+  if (downloads.size() > STANDIN_LEADERBOARD_DOWNLOADS)
+    downloads.erase(downloads.begin());
+  result.m_hSteamLeaderboardEntries = lastDownload;
+  result.m_cEntryCount = download.entries.size();
+}
+
+// The call results are queued without leaderboardLock, as callbacks may
+// call in here while the callback lock is held
+SteamAPICall_t ISteamUserStatsStandIn::DownloadLeaderboardEntries(SteamLeaderboard_t hSteamLeaderboard,
+  ELeaderboardDataRequest eLeaderboardDataRequest, int nRangeStart, int nRangeEnd)
+{
+  standinLatency();
+  LeaderboardScoresDownloaded_t result;
+  memset(&result, 0, sizeof(result));
+  result.m_hSteamLeaderboard = hSteamLeaderboard;
+  {
+    std::lock_guard<std::mutex> guard(leaderboardLock);
+    downloadEntries(result, eLeaderboardDataRequest, nRangeStart, nRangeEnd);
+  }
+  return standinCallResult(&result, sizeof(result), LeaderboardScoresDownloaded_t::k_iCallback);
+}
+
+bool ISteamUserStatsStandIn::GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t hSteamLeaderboardEntries,
+  int index, LeaderboardEntry_t *pLeaderboardEntry, int32 *pDetails, int cDetailsMax)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(leaderboardLock);
+  std::map<SteamLeaderboardEntries_t, Download>::iterator download =
+    downloads.find(hSteamLeaderboardEntries);
+  if (download == downloads.end() || index < 0 ||
+      (size_t)index >= download->second.entries.size())
+    return false;
+  *pLeaderboardEntry = download->second.entries[index];
+  const std::vector<int32> &details = download->second.details[index];
+  for (int i = 0; i < cDetailsMax && (size_t)i < details.size(); i++)
+    pDetails[i] = details[i];
+  return true;
+}
+
+// With leaderboardLock held
+static void uploadScore(LeaderboardScoreUploaded_t &result, ELeaderboardUploadScoreMethod method,
+                        int32 *details, int count)
+{
+  Leaderboard *board = leaderboard(result.m_hSteamLeaderboard);
+  if (board == NULL || count < 0 || count > STANDIN_LEADERBOARD_DETAILS)
+    return;
+  result.m_bSuccess = 1;
+  uint64 user = standinSteamID().ConvertToUint64();
+  int previous = rankOf(*board, user);
+  result.m_nGlobalRankPrevious = previous;
+  if (previous == 0 || method == k_ELeaderboardUploadScoreMethodForceUpdate ||
+      board->better(result.m_nScore, board->scores[previous - 1].score))
+  {
+    Score score;
+    score.user = user;
+    score.score = result.m_nScore;
+    score.details.assign(details, details + count);
+    if (previous != 0)
+      board->scores.erase(board->scores.begin() + previous - 1);
+    // After the scores which are as good, like a later upload in Steam
+    size_t at = 0;
+    while (at < board->scores.size() && !board->better(score.score, board->scores[at].score))
+      at++;
+    board->scores.insert(board->scores.begin() + at, score);
+    result.m_bScoreChanged = 1;
+  }
+  result.m_nGlobalRankNew = rankOf(*board, user);
+}
+
+SteamAPICall_t ISteamUserStatsStandIn::UploadLeaderboardScore(SteamLeaderboard_t hSteamLeaderboard,
+  ELeaderboardUploadScoreMethod eLeaderboardUploadScoreMethod, int32 nScore,
+  int32 *pScoreDetails, int cScoreDetailsCount)
+{
+  standinLatency();
+  LeaderboardScoreUploaded_t result;
+  memset(&result, 0, sizeof(result));
+  result.m_hSteamLeaderboard = hSteamLeaderboard;
+  result.m_nScore = nScore;
+  {
+    std::lock_guard<std::mutex> guard(leaderboardLock);
+    uploadScore(result, eLeaderboardUploadScoreMethod, pScoreDetails, cScoreDetailsCount);
+  }
+  return standinCallResult(&result, sizeof(result), LeaderboardScoreUploaded_t::k_iCallback);
+}
@@ -0,0 +1,229 @@
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string.h>
+#include <vector>
+#include "interfaces.h"
+
+// P2P networking of the stand-in: packets sent to anyone come back from
+// them (STEAMSTANDIN_P2P_LOOPBACK) and a fake peer sends
+// STEAMSTANDIN_P2P_PACKETS packets per frame, spread over the channels.
+// The first packet of the fake peer asks for a session with
+// P2PSessionRequest_t like Steam does; its packets are queued anyway.
+// Packets to the members of a P2P hub (STEAMSTANDIN_P2P_HUB, hub.cpp) go to
+// their processes instead, whose packets are picked up by the next
+// IsP2PPacketAvailable, ReadP2PPacket or frame.
+
+struct Packet
+{
+  uint64 from;
+  // monotonicNs() of the sender for packets of the hub, else 0
+  uint64_t sentAt;
+  std::vector<unsigned char> data;
+};
+
+static std::mutex networkLock;
+static std::map<int, std::deque<Packet> > channels;
+// Peer -> whether the session was accepted
+static std::map<uint64, bool> sessions;
+static uint64_t synthetic = 0;
+static bool peerRequested = false;
+// Members of the hub which asked for a session, and those not posted yet
+static std::set<uint64> hubRequested;
+static std::vector<uint64> hubRequests;
+
+// With networkLock held
+static void queuePacket(uint64 from, const void *data, uint32 size, int channel,
+                        uint64_t sentAt = 0)
+{
+  std::deque<Packet> &queue = channels[channel];
+  if (queue.size() >= STANDIN_P2P_QUEUE)
+    return;
+  queue.push_back(Packet());
+  queue.back().from = from;
+  queue.back().sentAt = sentAt;
+  queue.back().data.assign((const unsigned char *)data, (const unsigned char *)data + size);
+}
+
+// With networkLock held, by standinHubReceive()
+static void fromHub(uint64 from, const void *data, uint32 size, int channel, uint64_t sentAt)
+{
+  queuePacket(from, data, size, channel, sentAt);
+  if (sessions.count(from) == 0 && hubRequested.insert(from).second)
+    hubRequests.push_back(from);
+}
+
+// With networkLock held; the session requests are posted by postRequests()
+static void pullHub(std::vector<uint64> &requests)
+{
+  if (standinConfig.p2pHub == NULL || standinHubReceive(fromHub) == 0)
+    return;
+  requests.swap(hubRequests);
+}
+
+// Without networkLock, standinPost() takes the callback lock
+static void postRequests(const std::vector<uint64> &requests)
+{
+  for (size_t i = 0; i < requests.size(); i++)
+  {
+    P2PSessionRequest_t session;
+    session.m_steamIDRemote = CSteamID(requests[i]);
+    standinPost(P2PSessionRequest_t::k_iCallback, &session, sizeof(session));
+  }
+}
+
+void standinNetworkingFrame()
+{
+  std::vector<uint64> requests;
+  {
+    std::lock_guard<std::mutex> guard(networkLock);
+    pullHub(requests);
+  }
+  postRequests(requests);
+  unsigned count = standinConfig.p2pPacketsPerFrame;
+  if (count == 0)
+    return;
+  CSteamID peer = standinPeerSteamID();
+  bool request = false;
+  {
+    std::lock_guard<std::mutex> guard(networkLock);
+    std::vector<unsigned char> payload(standinConfig.p2pPacketSize);
+    for (unsigned i = 0; i < count; i++)
+    {
+      // The sequence number up front, the rest a pattern a reader can check
+      uint64_t sequence = synthetic++;
+      for (size_t b = 0; b < payload.size(); b++)
+        payload[b] = (unsigned char)(sequence + b);
+      if (payload.size() >= sizeof(sequence))
+        memcpy(&payload[0], &sequence, sizeof(sequence));
+      queuePacket(peer.ConvertToUint64(), payload.empty() ? NULL : &payload[0],
+                  payload.size(), i % standinConfig.p2pChannels);
+    }
+    request = !peerRequested && sessions.count(peer.ConvertToUint64()) == 0;
+    peerRequested = true;
+  }
+  // standinPost() takes the callback lock, which runFrame() holds around this
+  if (request)
+  {
+    P2PSessionRequest_t session;
+    session.m_steamIDRemote = peer;
+    standinPost(P2PSessionRequest_t::k_iCallback, &session, sizeof(session));
+  }
+}
+
+void standinNetworkingShutdown()
+{
+  standinHubReport();
+  std::lock_guard<std::mutex> guard(networkLock);
+  channels.clear();
+  sessions.clear();
+  peerRequested = false;
+  hubRequested.clear();
+  hubRequests.clear();
+}
+
+bool ISteamNetworkingStandIn::SendP2PPacket(CSteamID steamIDRemote, void *pubData, uint32 cubData,
+                                            EP2PSend eP2PSendType, int nChannel)
+{
+  standinLatency();
+  bool reliable = eP2PSendType == k_EP2PSendReliable ||
+                  eP2PSendType == k_EP2PSendReliableWithBuffering;
+  if (cubData > (reliable ? STANDIN_P2P_RELIABLE_MAX : STANDIN_P2P_UNRELIABLE_MAX) ||
+      !steamIDRemote.IsValid())
+    return false;
+  std::lock_guard<std::mutex> guard(networkLock);
+  sessions[steamIDRemote.ConvertToUint64()] = true;
+  if (standinHubIsMember(steamIDRemote))
+    return standinHubSend(steamIDRemote, pubData, cubData, nChannel);
+  if (standinConfig.p2pLoopback)
+    queuePacket(steamIDRemote.ConvertToUint64(), pubData, cubData, nChannel);
+  return true;
+}
+
+bool ISteamNetworkingStandIn::IsP2PPacketAvailable(uint32 *pcubMsgSize, int nChannel)
+{
+  standinLatency();
+  std::vector<uint64> requests;
+  bool available = false;
+  {
+    std::lock_guard<std::mutex> guard(networkLock);
+    pullHub(requests);
+    std::map<int, std::deque<Packet> >::iterator queue = channels.find(nChannel);
+    if (queue != channels.end() && !queue->second.empty())
+    {
+      if (pcubMsgSize != NULL)
+        *pcubMsgSize = queue->second.front().data.size();
+      available = true;
+    }
+  }
+  postRequests(requests);
+  return available;
+}
+
+bool ISteamNetworkingStandIn::ReadP2PPacket(void *pubDest, uint32 cubDest, uint32 *pcubMsgSize,
+                                            CSteamID *psteamIDRemote, int nChannel)
+{
+  standinLatency();
+  std::vector<uint64> requests;
+  {
+    std::lock_guard<std::mutex> guard(networkLock);
+    pullHub(requests);
+  }
+  postRequests(requests);
+  std::lock_guard<std::mutex> guard(networkLock);
+  std::map<int, std::deque<Packet> >::iterator queue = channels.find(nChannel);
+  if (queue == channels.end() || queue->second.empty())
+    return false;
+  Packet &packet = queue->second.front();
+  if (packet.sentAt != 0)
+    standinHubRead(packet.sentAt);
+  // Like Steam, a short buffer gets the start of the packet, the rest is lost
+  size_t size = packet.data.size() < cubDest ? packet.data.size() : cubDest;
+  if (size > 0)
+    memcpy(pubDest, &packet.data[0], size);
+  if (pcubMsgSize != NULL)
+    *pcubMsgSize = size;
+  if (psteamIDRemote != NULL)
+    *psteamIDRemote = CSteamID(packet.from);
+  queue->second.pop_front();
+  return true;
+}
+
+bool ISteamNetworkingStandIn::AcceptP2PSessionWithUser(CSteamID steamIDRemote)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(networkLock);
+  sessions[steamIDRemote.ConvertToUint64()] = true;
+  return true;
+}
+
+bool ISteamNetworkingStandIn::CloseP2PSessionWithUser(CSteamID steamIDRemote)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(networkLock);
+  return sessions.erase(steamIDRemote.ConvertToUint64()) > 0;
+}
+
+bool ISteamNetworkingStandIn::CloseP2PChannelWithUser(CSteamID steamIDRemote, int nChannel)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(networkLock);
+  return sessions.count(steamIDRemote.ConvertToUint64()) > 0;
+}
+
+bool ISteamNetworkingStandIn::GetP2PSessionState(CSteamID steamIDRemote,
+                                                 P2PSessionState_t *pConnectionState)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(networkLock);
+  std::map<uint64, bool>::iterator session = sessions.find(steamIDRemote.ConvertToUint64());
+  memset(pConnectionState, 0, sizeof(*pConnectionState));
+  if (session == sessions.end())
+    return false;
+  pConnectionState->m_bConnectionActive = session->second;
+  // Everything is delivered at once, so nothing is ever queued for sending
+  pConnectionState->m_eP2PSessionError = k_EP2PSessionErrorNone;
+  pConnectionState->m_nRemoteIP = 0x7f000001;
+  return true;
+}
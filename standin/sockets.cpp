@@ -0,0 +1,317 @@
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string.h>
+#include <vector>
+#include "interfaces.h"
+
+// The socket half of ISteamNetworking in the stand-in. A connection socket
+// to a virtual port somebody listens on is connected at once to a new
+// socket of that listen socket, whatever the target; both ends get a
+// SocketStatusCallback_t on the next frame. Data sent on one end arrives
+// at the other. Connections to ports nobody listens on stay unconnected.
+
+struct Socket
+{
+  SNetListenSocket_t listen;
+  SNetSocket_t peer;
+  CSteamID remote;
+  int state;
+  std::deque<std::vector<unsigned char> > messages;
+};
+
+struct ListenSocket
+{
+  int port;
+  // A socket per message in the order they arrived, see IsDataAvailable
+  std::deque<SNetSocket_t> arrivals;
+};
+
+static std::mutex socketLock;
+// Both kinds of handles are counted together, like Steam does
+static uint32 lastHandle = 0;
+static std::map<SNetSocket_t, Socket> sockets;
+static std::map<SNetListenSocket_t, ListenSocket> listenSockets;
+
+// With socketLock held
+static SNetListenSocket_t listenerOf(int port)
+{
+  for (std::map<SNetListenSocket_t, ListenSocket>::iterator l = listenSockets.begin();
+       l != listenSockets.end(); ++l)
+    if (l->second.port == port)
+      return l->first;
+  return 0;
+}
+
+// With socketLock held
+static Socket *socketOf(SNetSocket_t handle)
+{
+  std::map<SNetSocket_t, Socket>::iterator socket = sockets.find(handle);
+  return socket != sockets.end() ? &socket->second : NULL;
+}
+
+static void postStatus(SNetSocket_t socket, SNetListenSocket_t listen, CSteamID remote, int state)
+{
+  SocketStatusCallback_t status;
+  memset(&status, 0, sizeof(status));
+  status.m_hSocket = socket;
+  status.m_hListenSocket = listen;
+  status.m_steamIDRemote = remote;
+  status.m_eSNetSocketState = state;
+  standinPost(SocketStatusCallback_t::k_iCallback, &status, sizeof(status));
+}
+
+static SNetSocket_t connectSocket(CSteamID remote, int port)
+{
+  SNetSocket_t handle, accepted = 0;
+  SNetListenSocket_t listen;
+  {
+    std::lock_guard<std::mutex> guard(socketLock);
+    handle = ++lastHandle;
+    Socket &socket = sockets[handle];
+    socket.listen = 0;
+    socket.peer = 0;
+    socket.remote = remote;
+    socket.state = k_ESNetSocketStateInitiated;
+    listen = listenerOf(port);
+    if (listen != 0)
+    {
+      accepted = ++lastHandle;
+      Socket &other = sockets[accepted];
+      other.listen = listen;
+      other.peer = handle;
+      other.remote = standinSteamID();
+      other.state = k_ESNetSocketStateConnected;
+      socket.peer = accepted;
+      socket.state = k_ESNetSocketStateConnected;
+    }
+  }
+  // standinPost() takes the callback lock, which runFrame() holds while callbacks run
+  if (accepted != 0)
+  {
+    postStatus(handle, 0, remote, k_ESNetSocketStateConnected);
+    postStatus(accepted, listen, standinSteamID(), k_ESNetSocketStateConnected);
+  }
+  return handle;
+}
+
+SNetListenSocket_t ISteamNetworkingStandIn::CreateListenSocket(int nVirtualP2PPort, uint32 nIP,
+                                                               uint16 nPort, bool bAllowUseOfPacketRelay)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  SNetListenSocket_t handle = ++lastHandle;
+  listenSockets[handle].port = nVirtualP2PPort;
+  return handle;
+}
+
+SNetSocket_t ISteamNetworkingStandIn::CreateP2PConnectionSocket(CSteamID steamIDTarget, int nVirtualPort,
+                                                                int nTimeoutSec, bool bAllowUseOfPacketRelay)
+{
+  standinLatency();
+  return connectSocket(steamIDTarget, nVirtualPort);
+}
+
+SNetSocket_t ISteamNetworkingStandIn::CreateConnectionSocket(uint32 nIP, uint16 nPort, int nTimeoutSec)
+{
+  standinLatency();
+  return connectSocket(CSteamID(), nPort);
+}
+
+bool ISteamNetworkingStandIn::DestroySocket(SNetSocket_t hSocket, bool bNotifyRemoteEnd)
+{
+  standinLatency();
+  SNetSocket_t peer;
+  {
+    std::lock_guard<std::mutex> guard(socketLock);
+    Socket *socket = socketOf(hSocket);
+    if (socket == NULL)
+      return false;
+    peer = socket->peer;
+    sockets.erase(hSocket);
+    Socket *other = socketOf(peer);
+    if (other == NULL)
+      return true;
+    other->peer = 0;
+    other->state = k_ESNetSocketStateRemoteEndDisconnected;
+    if (!bNotifyRemoteEnd)
+      return true;
+  }
+  postStatus(peer, 0, CSteamID(), k_ESNetSocketStateRemoteEndDisconnected);
+  return true;
+}
+
+bool ISteamNetworkingStandIn::DestroyListenSocket(SNetListenSocket_t hSocket, bool bNotifyRemoteEnd)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  if (listenSockets.erase(hSocket) == 0)
+    return false;
+  // Its sockets go with it
+  std::map<SNetSocket_t, Socket>::iterator socket = sockets.begin();
+  while (socket != sockets.end())
+    if (socket->second.listen == hSocket)
+    {
+      Socket *other = socketOf(socket->second.peer);
+      if (other != NULL)
+      {
+        other->peer = 0;
+        other->state = k_ESNetSocketStateRemoteEndDisconnected;
+      }
+      sockets.erase(socket++);
+    }
+    else
+      ++socket;
+  return true;
+}
+
+bool ISteamNetworkingStandIn::SendDataOnSocket(SNetSocket_t hSocket, void *pubData, uint32 cubData,
+                                               bool bReliable)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  Socket *socket = socketOf(hSocket);
+  Socket *other = socket != NULL ? socketOf(socket->peer) : NULL;
+  if (other == NULL || other->messages.size() >= STANDIN_P2P_QUEUE)
+    return false;
+  other->messages.push_back(std::vector<unsigned char>((unsigned char *)pubData,
+                                                       (unsigned char *)pubData + cubData));
+  std::map<SNetListenSocket_t, ListenSocket>::iterator listen = listenSockets.find(other->listen);
+  if (listen != listenSockets.end())
+    listen->second.arrivals.push_back(socket->peer);
+  return true;
+}
+
+bool ISteamNetworkingStandIn::IsDataAvailableOnSocket(SNetSocket_t hSocket, uint32 *pcubMsgSize)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  Socket *socket = socketOf(hSocket);
+  if (socket == NULL || socket->messages.empty())
+    return false;
+  *pcubMsgSize = socket->messages.front().size();
+  return true;
+}
+
+// With socketLock held: copies the oldest message of the socket
+static bool retrieve(Socket *socket, void *pubDest, uint32 cubDest, uint32 *pcubMsgSize)
+{
+  if (socket == NULL || socket->messages.empty())
+    return false;
+  std::vector<unsigned char> &message = socket->messages.front();
+  uint32 size = message.size() < cubDest ? message.size() : cubDest;
+  if (size > 0)
+    memcpy(pubDest, &message[0], size);
+  *pcubMsgSize = size;
+  socket->messages.pop_front();
+  return true;
+}
+
+bool ISteamNetworkingStandIn::RetrieveDataFromSocket(SNetSocket_t hSocket, void *pubDest, uint32 cubDest,
+                                                     uint32 *pcubMsgSize)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  return retrieve(socketOf(hSocket), pubDest, cubDest, pcubMsgSize);
+}
+
+// With socketLock held: the socket with the oldest message. Messages read
+// with RetrieveDataFromSocket leave their arrival behind, it is skipped here.
+static Socket *oldest(SNetListenSocket_t hListenSocket, SNetSocket_t *phSocket)
+{
+  std::map<SNetListenSocket_t, ListenSocket>::iterator listen = listenSockets.find(hListenSocket);
+  if (listen == listenSockets.end())
+    return NULL;
+  std::deque<SNetSocket_t> &arrivals = listen->second.arrivals;
+  while (!arrivals.empty())
+  {
+    Socket *socket = socketOf(arrivals.front());
+    if (socket != NULL && !socket->messages.empty())
+    {
+      *phSocket = arrivals.front();
+      return socket;
+    }
+    arrivals.pop_front();
+  }
+  return NULL;
+}
+
+bool ISteamNetworkingStandIn::IsDataAvailable(SNetListenSocket_t hListenSocket, uint32 *pcubMsgSize,
+                                              SNetSocket_t *phSocket)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  Socket *socket = oldest(hListenSocket, phSocket);
+  if (socket == NULL)
+    return false;
+  *pcubMsgSize = socket->messages.front().size();
+  return true;
+}
+
+bool ISteamNetworkingStandIn::RetrieveData(SNetListenSocket_t hListenSocket, void *pubDest, uint32 cubDest,
+                                           uint32 *pcubMsgSize, SNetSocket_t *phSocket)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  Socket *socket = oldest(hListenSocket, phSocket);
+  if (socket == NULL)
+    return false;
+  listenSockets[hListenSocket].arrivals.pop_front();
+  return retrieve(socket, pubDest, cubDest, pcubMsgSize);
+}
+
+bool ISteamNetworkingStandIn::GetSocketInfo(SNetSocket_t hSocket, CSteamID *pSteamIDRemote,
+                                            int *peSocketStatus, uint32 *punIPRemote,
+                                            uint16 *punPortRemote)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  Socket *socket = socketOf(hSocket);
+  if (socket == NULL)
+    return false;
+  if (pSteamIDRemote != NULL)
+    *pSteamIDRemote = socket->remote;
+  if (peSocketStatus != NULL)
+    *peSocketStatus = socket->state;
+  if (punIPRemote != NULL)
+    *punIPRemote = 0x7f000001;
+  if (punPortRemote != NULL)
+    *punPortRemote = 0;
+  return true;
+}
+
+bool ISteamNetworkingStandIn::GetListenSocketInfo(SNetListenSocket_t hListenSocket, uint32 *pnIP,
+                                                  uint16 *pnPort)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  if (listenSockets.count(hListenSocket) == 0)
+    return false;
+  if (pnIP != NULL)
+    *pnIP = 0x7f000001;
+  if (pnPort != NULL)
+    *pnPort = 0;
+  return true;
+}
+
+ESNetSocketConnectionType ISteamNetworkingStandIn::GetSocketConnectionType(SNetSocket_t hSocket)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(socketLock);
+  Socket *socket = socketOf(hSocket);
+  return socket != NULL && socket->peer != 0 ? k_ESNetSocketConnectionTypeUDP
+                                             : k_ESNetSocketConnectionTypeNotConnected;
+}
+
+int ISteamNetworkingStandIn::GetMaxPacketSize(SNetSocket_t hSocket)
+{
+  standinLatency();
+  return STANDIN_P2P_UNRELIABLE_MAX;
+}
+
+void standinSocketsShutdown()
+{
+  std::lock_guard<std::mutex> guard(socketLock);
+  sockets.clear();
+  listenSockets.clear();
+}
@@ -0,0 +1,292 @@
+#include <map>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "interfaces.h"
+
+// The user, the peer the synthetic P2P packets come from and the first of
+// the fake leaderboard players are individual accounts 1, 2 and 1000 on
+// the public universe; in a P2P hub the user is STANDIN_HUB_ACCOUNT + n
+#define STANDIN_ACCOUNT 1
+#define STANDIN_PEER_ACCOUNT 2
+
+static unsigned configNumber(const char *name, unsigned fallback)
+{
+  const char *value = getenv(name);
+  return value != NULL && value[0] != '\0' ? strtoul(value, NULL, 10) : fallback;
+}
+
+static StandInConfig readConfig()
+{
+  StandInConfig config;
+  config.latencyNs = configNumber("STEAMSTANDIN_LATENCY_NS", 0);
+  config.callbacksPerFrame = configNumber("STEAMSTANDIN_CALLBACKS", 0);
+  config.callResultFrames = configNumber("STEAMSTANDIN_CALL_RESULT_FRAMES",
+                                         STANDIN_CALL_RESULT_FRAMES);
+  config.p2pPacketsPerFrame = configNumber("STEAMSTANDIN_P2P_PACKETS", 0);
+  config.p2pPacketSize = configNumber("STEAMSTANDIN_P2P_PACKET_SIZE", STANDIN_P2P_PACKET_SIZE);
+  config.p2pChannels = configNumber("STEAMSTANDIN_P2P_CHANNELS", STANDIN_P2P_CHANNELS);
+  if (config.p2pChannels == 0)
+    config.p2pChannels = 1;
+  config.p2pLoopback = configNumber("STEAMSTANDIN_P2P_LOOPBACK", 1) != 0;
+  config.p2pHub = getenv("STEAMSTANDIN_P2P_HUB");
+  config.cloudFiles = configNumber("STEAMSTANDIN_CLOUD_FILES", 0);
+  config.cloudFileSize = configNumber("STEAMSTANDIN_CLOUD_FILE_SIZE", STANDIN_CLOUD_FILE_SIZE);
+  config.leaderboardEntries = configNumber("STEAMSTANDIN_LEADERBOARD_ENTRIES",
+                                           STANDIN_LEADERBOARD_ENTRIES);
+  return config;
+}
+
+static StandInConfig config = readConfig();
+const StandInConfig &standinConfig = config;
+
+CSteamID standinSteamID()
+{
+  uint32 account = standinHubAccount();
+  return CSteamID(account != 0 ? account : STANDIN_ACCOUNT, k_EUniversePublic,
+                  k_EAccountTypeIndividual);
+}
+
+CSteamID standinPeerSteamID()
+{
+  return CSteamID(STANDIN_PEER_ACCOUNT, k_EUniversePublic, k_EAccountTypeIndividual);
+}
+
+// CCallbackBase keeps its flags to itself, Steam sets them from outside
+class CallbackFlags: public CCallbackBase
+{
+public:
+  static void set(CCallbackBase *callback, bool registered)
+  {
+    uint8 CCallbackBase::*flags = &CallbackFlags::m_nCallbackFlags;
+    if (registered)
+      callback->*flags |= k_ECallbackFlagsRegistered;
+    else
+      callback->*flags &= ~k_ECallbackFlagsRegistered;
+  }
+};
+
+struct CallResult
+{
+  int callback;
+  uint64_t due;
+  std::vector<unsigned char> payload;
+};
+
+struct Posted
+{
+  int callback;
+  std::vector<unsigned char> payload;
+};
+
+// Callbacks may register and unregister others while they run
+static std::recursive_mutex callbackLock;
+static std::vector<std::pair<CCallbackBase *, int> > callbacks;
+static std::multimap<SteamAPICall_t, CCallbackBase *> callResultWaiters;
+static std::map<SteamAPICall_t, CallResult> callResults;
+static std::vector<Posted> posted;
+static SteamAPICall_t lastCall = 0;
+static uint64_t frames = 0;
+static unsigned nextFake = 0;
+
+uint64_t standinFrame()
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  return frames;
+}
+
+SteamAPICall_t standinCallResult(const void *payload, size_t size, int callback)
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  CallResult &result = callResults[++lastCall];
+  result.callback = callback;
+  result.due = frames + config.callResultFrames;
+  if (payload != NULL)
+    result.payload.assign((const unsigned char *)payload, (const unsigned char *)payload + size);
+  else
+    result.payload.assign(size, 0);
+  return lastCall;
+}
+
+void standinPost(int callback, const void *payload, size_t size)
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  posted.push_back(Posted());
+  posted.back().callback = callback;
+  posted.back().payload.assign((const unsigned char *)payload,
+                               (const unsigned char *)payload + size);
+}
+
+// Room for what the callback expects, a fake payload may be smaller
+static void *payloadFor(CCallbackBase *callback, std::vector<unsigned char> &payload)
+{
+  size_t size = callback->GetCallbackSizeBytes();
+  if (payload.size() < size)
+    payload.resize(size, 0);
+  return payload.empty() ? NULL : &payload[0];
+}
+
+static void runFrame()
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  frames++;
+  standinNetworkingFrame();
+  std::vector<Posted> queued;
+  queued.swap(posted);
+  std::vector<std::pair<CCallbackBase *, int> > registered = callbacks;
+  for (size_t i = 0; i < queued.size(); i++)
+    for (size_t c = 0; c < registered.size(); c++)
+      if (registered[c].second == queued[i].callback)
+        registered[c].first->Run(payloadFor(registered[c].first, queued[i].payload));
+  // Zeroed payloads, spread over whoever registered
+  std::vector<unsigned char> fake;
+  for (unsigned i = 0; i < config.callbacksPerFrame && !registered.empty(); i++)
+  {
+    CCallbackBase *callback = registered[nextFake++ % registered.size()].first;
+    fake.assign(callback->GetCallbackSizeBytes(), 0);
+    callback->Run(fake.empty() ? NULL : &fake[0]);
+  }
+  // Results nobody registered for wait for GetAPICallResult a while
+  std::vector<SteamAPICall_t> due;
+  std::map<SteamAPICall_t, CallResult>::iterator r = callResults.begin();
+  while (r != callResults.end())
+    if (r->second.due > frames)
+      ++r;
+    else if (callResultWaiters.count(r->first) > 0)
+      due.push_back((r++)->first);
+    else if (r->second.due + STANDIN_CALL_RESULT_KEEP < frames)
+      callResults.erase(r++);
+    else
+      ++r;
+  for (size_t i = 0; i < due.size(); i++)
+  {
+    std::vector<unsigned char> payload = callResults[due[i]].payload;
+    callResults.erase(due[i]);
+    std::vector<CCallbackBase *> waiting;
+    std::multimap<SteamAPICall_t, CCallbackBase *>::iterator w =
+      callResultWaiters.lower_bound(due[i]);
+    for (; w != callResultWaiters.end() && w->first == due[i]; ++w)
+      waiting.push_back(w->second);
+    callResultWaiters.erase(due[i]);
+    for (size_t c = 0; c < waiting.size(); c++)
+    {
+      CallbackFlags::set(waiting[c], false);
+      waiting[c]->Run(payloadFor(waiting[c], payload), false, due[i]);
+    }
+  }
+}
+
+bool ISteamUtilsStandIn::IsAPICallCompleted(SteamAPICall_t hSteamAPICall, bool *pbFailed)
+{
+  standinLatency();
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  std::map<SteamAPICall_t, CallResult>::iterator result = callResults.find(hSteamAPICall);
+  if (pbFailed != NULL)
+    *pbFailed = result == callResults.end();
+  return result != callResults.end() && result->second.due <= frames;
+}
+
+bool ISteamUtilsStandIn::GetAPICallResult(SteamAPICall_t hSteamAPICall, void *pCallback,
+                                          int cubCallback, int iCallbackExpected,
+                                          bool *pbFailed)
+{
+  standinLatency();
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  std::map<SteamAPICall_t, CallResult>::iterator result = callResults.find(hSteamAPICall);
+  bool ready = result != callResults.end() && result->second.due <= frames &&
+               (result->second.callback == 0 || result->second.callback == iCallbackExpected);
+  if (pbFailed != NULL)
+    *pbFailed = result == callResults.end();
+  if (!ready)
+    return false;
+  size_t size = result->second.payload.size();
+  if (size > (size_t)cubCallback)
+    size = cubCallback;
+  memset(pCallback, 0, cubCallback);
+  if (size > 0)
+    memcpy(pCallback, &result->second.payload[0], size);
+  callResults.erase(result);
+  return true;
+}
+
+void *ISteamClientStandIn::GetISteamGenericInterface(HSteamUser hSteamUser, HSteamPipe hSteamPipe,
+                                                     char *pchVersion)
+{
+  standinLatency();
+  return standinGenericInterface(pchVersion);
+}
+
+bool SteamAPI_Init()
+{
+  return true;
+}
+
+bool SteamAPI_InitSafe()
+{
+  return true;
+}
+
+void SteamAPI_Shutdown()
+{
+  standinNetworkingShutdown();
+  standinSocketsShutdown();
+}
+
+bool SteamAPI_IsSteamRunning()
+{
+  return true;
+}
+
+bool SteamAPI_RestartAppIfNecessary(uint32 unOwnAppID)
+{
+  return false;
+}
+
+void SteamAPI_RunCallbacks()
+{
+  standinLatency();
+  runFrame();
+}
+
+void Steam_RunCallbacks(HSteamPipe hSteamPipe, bool bGameServerCallbacks)
+{
+  standinLatency();
+  runFrame();
+}
+
+void SteamAPI_RegisterCallback(class CCallbackBase *pCallback, int iCallback)
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  CallbackFlags::set(pCallback, true);
+  callbacks.push_back(std::make_pair(pCallback, iCallback));
+}
+
+void SteamAPI_UnregisterCallback(class CCallbackBase *pCallback)
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  CallbackFlags::set(pCallback, false);
+  for (size_t i = 0; i < callbacks.size(); i++)
+    if (callbacks[i].first == pCallback)
+      callbacks.erase(callbacks.begin() + i--);
+}
+
+void SteamAPI_RegisterCallResult(class CCallbackBase *pCallback, SteamAPICall_t hAPICall)
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  CallbackFlags::set(pCallback, true);
+  callResultWaiters.insert(std::make_pair(hAPICall, pCallback));
+}
+
+void SteamAPI_UnregisterCallResult(class CCallbackBase *pCallback, SteamAPICall_t hAPICall)
+{
+  std::lock_guard<std::recursive_mutex> guard(callbackLock);
+  CallbackFlags::set(pCallback, false);
+  std::multimap<SteamAPICall_t, CCallbackBase *>::iterator w =
+    callResultWaiters.lower_bound(hAPICall);
+  while (w != callResultWaiters.end() && w->first == hAPICall)
+    if (w->second == pCallback)
+      callResultWaiters.erase(w++);
+    else
+      ++w;
+}
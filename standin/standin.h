@@ -0,0 +1,150 @@
+#ifndef STEAM_STANDIN
+#define STEAM_STANDIN
+#include <stddef.h>
+#include <stdint.h>
+#include "steam_api.h"
+#include "steam_gameserver.h"
+#include "timer.h"
+
+// A native libsteam_api.so which needs no Steam client, for benchmarking the
+// forwarder (make standin). It exports every function the steam headers
+// declare and implements every interface; most methods only wait the
+// configured latency and return true, 0 or an empty string. P2P networking
+// and sockets, cloud files, leaderboards, call results and callbacks are
+// modeled: see networking.cpp, sockets.cpp, storage.cpp, leaderboards.cpp
+// and standin.cpp. The stand-ins of several processes can exchange P2P
+// packets, see hub.cpp.
+//
+// The interfaces are classes of their own with the vtable layout of the
+// Linux ones, ISteamNetworkingStandIn for ISteamNetworking and so on. The
+// code generator writes them into interfaces.h and the default methods and
+// the flat exports into interfaces.cpp, leaving out the methods listed in
+// codegen/standin.nim, which are written by hand.
+
+// Defaults of the STEAMSTANDIN_* variables, see README.md
+#define STANDIN_P2P_PACKET_SIZE 1200
+#define STANDIN_P2P_CHANNELS 1
+// Packets kept per channel or socket, further ones are dropped like Steam would
+#define STANDIN_P2P_QUEUE 4096
+// Largest unreliable packet Steam sends, reliable ones may be 1 MB
+#define STANDIN_P2P_UNRELIABLE_MAX 1200
+#define STANDIN_P2P_RELIABLE_MAX (1024 * 1024)
+#define STANDIN_CLOUD_FILE_SIZE 4096
+#define STANDIN_CLOUD_QUOTA (100 * 1024 * 1024)
+#define STANDIN_LEADERBOARD_ENTRIES 100
+// Details kept per leaderboard entry, k_cLeaderboardDetailsMax in the SDK
+#define STANDIN_LEADERBOARD_DETAILS 64
+// Processes sharing a P2P hub, and the bytes of the inbox of each
+#define STANDIN_HUB_MEMBERS 32
+#define STANDIN_HUB_INBOX (1024 * 1024)
+// Account of the first process of a P2P hub, the next one is this + 1
+#define STANDIN_HUB_ACCOUNT 100
+// Frames until a call result is delivered
+#define STANDIN_CALL_RESULT_FRAMES 1
+// Frames a call result nobody registered for is kept for GetAPICallResult
+#define STANDIN_CALL_RESULT_KEEP 1000
+
+struct StandInConfig
+{
+  // Busy wait of every call, in nanoseconds
+  uint64_t latencyNs;
+  // Callbacks delivered per SteamAPI_RunCallbacks, spread over the registered ones
+  unsigned callbacksPerFrame;
+  unsigned callResultFrames;
+  // Packets from a fake peer arriving per SteamAPI_RunCallbacks
+  unsigned p2pPacketsPerFrame;
+  unsigned p2pPacketSize;
+  unsigned p2pChannels;
+  // Packets sent to any peer come back from it
+  bool p2pLoopback;
+  // Name of the P2P hub shared with other processes, NULL for none
+  const char *p2pHub;
+  unsigned cloudFiles;
+  unsigned cloudFileSize;
+  unsigned leaderboardEntries;
+};
+extern const StandInConfig &standinConfig;
+
+static inline void standinLatency()
+{
+  if (standinConfig.latencyNs == 0)
+    return;
+  uint64_t until = monotonicNs() + standinConfig.latencyNs;
+  while (monotonicNs() < until)
+    ;
+}
+
+// Queues a call result delivered after callResultFrames frames. The payload
+// is copied, NULL makes it all zeros.
+SteamAPICall_t standinCallResult(const void *payload, size_t size, int callback);
+// Queues a callback delivered on the next frame to whoever registered for it
+void standinPost(int callback, const void *payload, size_t size);
+// Frames run so far
+uint64_t standinFrame();
+// Called by standin.cpp on every SteamAPI_RunCallbacks and SteamAPI_Shutdown
+void standinNetworkingFrame();
+void standinNetworkingShutdown();
+void standinSocketsShutdown();
+
+// The user and the fake peer of the synthetic P2P packets
+CSteamID standinSteamID();
+CSteamID standinPeerSteamID();
+
+// The P2P hub, see hub.cpp. The account of this process, 0 outside a hub
+uint32 standinHubAccount();
+// Whether packets to the Steam ID go through the hub
+bool standinHubIsMember(CSteamID remote);
+// False if the member is not there or its inbox is full
+bool standinHubSend(CSteamID remote, const void *data, uint32 size, int channel);
+// Hands every packet waiting for this process to deliver, returns how many
+unsigned standinHubReceive(void (*deliver)(uint64 from, const void *data, uint32 size, int channel,
+                                           uint64_t sentAt));
+// The game read a packet of the hub
+void standinHubRead(uint64_t sentAt);
+// Counts and latencies to stderr
+void standinHubReport();
+
+// One instance per interface, which is all Steam has as well
+template <class T>
+T *standinInterface()
+{
+  static T instance;
+  return &instance;
+}
+
+// ISteamUtilsStandIn and the like for a version string, NULL if unknown
+void *standinGenericInterface(const char *version);
+
+// What the generated methods return
+template <class T>
+struct StandInDefault
+{
+  static T value() { return T(); }
+};
+
+template <>
+struct StandInDefault<bool>
+{
+  static bool value() { return true; }
+};
+
+template <>
+struct StandInDefault<char *>
+{
+  static char *value() { return (char *)""; }
+};
+
+// Flat exports return the result of the method, a CSteamID as a number
+template <class R>
+struct StandInResult
+{
+  template <class T>
+  static R of(const T &value) { return (R)value; }
+  static R of(const CSteamID &id) { return (R)id.ConvertToUint64(); }
+};
+
+// The flat exports are defined with the signatures the code generator parsed,
+// which lose const, so they are named through their symbol instead of
+// redeclaring the functions of steam_api_flat.h
+#define STANDIN_EXPORT(name) __asm__(#name) __attribute__((visibility("default")))
+#endif
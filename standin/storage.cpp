@@ -0,0 +1,139 @@
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "interfaces.h"
+
+// Steam Cloud of the stand-in, kept in memory. It starts with
+// STEAMSTANDIN_CLOUD_FILES files named standin0.dat, standin1.dat and so on
+// of STEAMSTANDIN_CLOUD_FILE_SIZE bytes each.
+
+static std::mutex storageLock;
+static std::map<std::string, std::vector<unsigned char> > files;
+static uint64 used = 0;
+static bool filled = false;
+
+// With storageLock held
+static void fill()
+{
+  if (filled)
+    return;
+  filled = true;
+  for (unsigned i = 0; i < standinConfig.cloudFiles; i++)
+  {
+    char name[32];
+    snprintf(name, sizeof(name), "standin%u.dat", i);
+    std::vector<unsigned char> &file = files[name];
+    file.resize(standinConfig.cloudFileSize);
+    for (size_t b = 0; b < file.size(); b++)
+      file[b] = (unsigned char)(i + b);
+    used += file.size();
+  }
+}
+
+bool ISteamRemoteStorageStandIn::FileWrite(char *pchFile, void *pvData, int32 cubData)
+{
+  standinLatency();
+  if (pchFile == NULL || cubData < 0)
+    return false;
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  std::vector<unsigned char> &file = files[pchFile];
+  if (used - file.size() + cubData > STANDIN_CLOUD_QUOTA)
+    return false;
+  used = used - file.size() + cubData;
+  file.assign((const unsigned char *)pvData, (const unsigned char *)pvData + cubData);
+  return true;
+}
+
+int32 ISteamRemoteStorageStandIn::FileRead(char *pchFile, void *pvData, int32 cubDataToRead)
+{
+  standinLatency();
+  if (pchFile == NULL || cubDataToRead < 0)
+    return 0;
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  std::map<std::string, std::vector<unsigned char> >::iterator file = files.find(pchFile);
+  if (file == files.end())
+    return 0;
+  size_t size = file->second.size() < (size_t)cubDataToRead ? file->second.size() : cubDataToRead;
+  if (size > 0)
+    memcpy(pvData, &file->second[0], size);
+  return size;
+}
+
+bool ISteamRemoteStorageStandIn::FileDelete(char *pchFile)
+{
+  standinLatency();
+  if (pchFile == NULL)
+    return false;
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  std::map<std::string, std::vector<unsigned char> >::iterator file = files.find(pchFile);
+  if (file == files.end())
+    return false;
+  used -= file->second.size();
+  files.erase(file);
+  return true;
+}
+
+bool ISteamRemoteStorageStandIn::FileExists(char *pchFile)
+{
+  standinLatency();
+  if (pchFile == NULL)
+    return false;
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  return files.count(pchFile) > 0;
+}
+
+int32 ISteamRemoteStorageStandIn::GetFileSize(char *pchFile)
+{
+  standinLatency();
+  if (pchFile == NULL)
+    return 0;
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  std::map<std::string, std::vector<unsigned char> >::iterator file = files.find(pchFile);
+  return file != files.end() ? file->second.size() : 0;
+}
+
+int32 ISteamRemoteStorageStandIn::GetFileCount()
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  return files.size();
+}
+
+// The name stays valid until the file is deleted, as in Steam
+char *ISteamRemoteStorageStandIn::GetFileNameAndSize(int iFile, int32 *pnFileSizeInBytes)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  if (pnFileSizeInBytes != NULL)
+    *pnFileSizeInBytes = 0;
+  if (iFile < 0 || (size_t)iFile >= files.size())
+    return (char *)"";
+  std::map<std::string, std::vector<unsigned char> >::iterator file = files.begin();
+  std::advance(file, iFile);
+  if (pnFileSizeInBytes != NULL)
+    *pnFileSizeInBytes = file->second.size();
+  return (char *)file->first.c_str();
+}
+
+bool ISteamRemoteStorageStandIn::GetQuota(uint64 *pnTotalBytes, uint64 *puAvailableBytes)
+{
+  standinLatency();
+  std::lock_guard<std::mutex> guard(storageLock);
+  fill();
+  if (pnTotalBytes != NULL)
+    *pnTotalBytes = STANDIN_CLOUD_QUOTA;
+  if (puAvailableBytes != NULL)
+    *puAvailableBytes = STANDIN_CLOUD_QUOTA - used;
+  return true;
+}
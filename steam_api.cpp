@@ -4,50 +4,43 @@ extern "C" {
 
 bool  SteamAPI_Init_()
 {
-  TRACE("()\n");
-  bool  result = SteamAPI_Init();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_Init");
+  return Forward<FORWARD_FUNCTION(SteamAPI_Init)>::call(&point);
 }
 
 
 void  SteamAPI_Shutdown_()
 {
-  TRACE("()\n");
-  SteamAPI_Shutdown();
-  
+  static ProfilePoint point("SteamAPI_Shutdown");
+  forwarderShutdown();
+  return Forward<FORWARD_FUNCTION(SteamAPI_Shutdown)>::call(&point);
 }
 
 
 bool  SteamAPI_RestartAppIfNecessary_(uint32  unOwnAppID)
 {
-  TRACE("((uint32 )%d)\n", unOwnAppID);
-  bool  result = SteamAPI_RestartAppIfNecessary(unOwnAppID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_RestartAppIfNecessary");
+  return Forward<FORWARD_FUNCTION(SteamAPI_RestartAppIfNecessary)>::call(&point, unOwnAppID);
 }
 
 
 void  SteamAPI_WriteMiniDump_(uint32  uStructuredExceptionCode, void * pvExceptionInfo, uint32  uBuildID)
 {
-  TRACE("((uint32 )%d, (void *)%p, (uint32 )%d)\n", uStructuredExceptionCode, pvExceptionInfo, uBuildID);
-  SteamAPI_WriteMiniDump(uStructuredExceptionCode, pvExceptionInfo, uBuildID);
-  
+  static ProfilePoint point("SteamAPI_WriteMiniDump");
+  return Forward<FORWARD_FUNCTION(SteamAPI_WriteMiniDump)>::call(&point, uStructuredExceptionCode, pvExceptionInfo, uBuildID);
 }
 
 
 void  SteamAPI_SetMiniDumpComment_(char * pchMsg)
 {
-  TRACE("((char *)\"%s\")\n", pchMsg);
-  SteamAPI_SetMiniDumpComment(pchMsg);
-  
+  static ProfilePoint point("SteamAPI_SetMiniDumpComment");
+  return Forward<FORWARD_FUNCTION(SteamAPI_SetMiniDumpComment)>::call(&point, pchMsg);
 }
 
 ISteamClient * saved_ISteamClient = NULL;
 ISteamClient * SteamClient_()
 {
+  PROFILE("SteamClient");
   TRACE("()\n");
   if (saved_ISteamClient == NULL) {
     ISteamClient* internal = SteamClient();
@@ -55,7 +48,7 @@ ISteamClient * SteamClient_()
       TRACE("() = NULL!\n");
       return saved_ISteamClient;
     }
-    saved_ISteamClient = (ISteamClient *) new ISteamClient_(internal);
+    saved_ISteamClient = (ISteamClient *) internInterface<ISteamClient_, ISteamClient>("ISteamClient", internal, NULL);
     TRACE("(): (ISteamClient *)%p wrapped as (ISteamClient_ *)%p\n", internal, saved_ISteamClient);
   }
   TRACE("() = (ISteamClient_ *)%p\n", saved_ISteamClient);
@@ -66,6 +59,7 @@ ISteamClient * SteamClient_()
 ISteamUser * saved_ISteamUser = NULL;
 ISteamUser * SteamUser_()
 {
+  PROFILE("SteamUser");
   TRACE("()\n");
   if (saved_ISteamUser == NULL) {
     ISteamUser* internal = SteamUser();
@@ -73,7 +67,7 @@ ISteamUser * SteamUser_()
       TRACE("() = NULL!\n");
       return saved_ISteamUser;
     }
-    saved_ISteamUser = (ISteamUser *) new ISteamUser_(internal);
+    saved_ISteamUser = (ISteamUser *) internInterface<ISteamUser_, ISteamUser>("ISteamUser", internal, NULL);
     TRACE("(): (ISteamUser *)%p wrapped as (ISteamUser_ *)%p\n", internal, saved_ISteamUser);
   }
   TRACE("() = (ISteamUser_ *)%p\n", saved_ISteamUser);
@@ -84,6 +78,7 @@ ISteamUser * SteamUser_()
 ISteamFriends * saved_ISteamFriends = NULL;
 ISteamFriends * SteamFriends_()
 {
+  PROFILE("SteamFriends");
   TRACE("()\n");
   if (saved_ISteamFriends == NULL) {
     ISteamFriends* internal = SteamFriends();
@@ -91,7 +86,7 @@ ISteamFriends * SteamFriends_()
       TRACE("() = NULL!\n");
       return saved_ISteamFriends;
     }
-    saved_ISteamFriends = (ISteamFriends *) new ISteamFriends_(internal);
+    saved_ISteamFriends = (ISteamFriends *) internInterface<ISteamFriends_, ISteamFriends>("ISteamFriends", internal, NULL);
     TRACE("(): (ISteamFriends *)%p wrapped as (ISteamFriends_ *)%p\n", internal, saved_ISteamFriends);
   }
   TRACE("() = (ISteamFriends_ *)%p\n", saved_ISteamFriends);
@@ -102,6 +97,7 @@ ISteamFriends * SteamFriends_()
 ISteamUtils * saved_ISteamUtils = NULL;
 ISteamUtils * SteamUtils_()
 {
+  PROFILE("SteamUtils");
   TRACE("()\n");
   if (saved_ISteamUtils == NULL) {
     ISteamUtils* internal = SteamUtils();
@@ -109,7 +105,7 @@ ISteamUtils * SteamUtils_()
       TRACE("() = NULL!\n");
       return saved_ISteamUtils;
     }
-    saved_ISteamUtils = (ISteamUtils *) new ISteamUtils_(internal);
+    saved_ISteamUtils = (ISteamUtils *) internInterface<ISteamUtils_, ISteamUtils>("ISteamUtils", internal, NULL);
     TRACE("(): (ISteamUtils *)%p wrapped as (ISteamUtils_ *)%p\n", internal, saved_ISteamUtils);
   }
   TRACE("() = (ISteamUtils_ *)%p\n", saved_ISteamUtils);
@@ -120,6 +116,7 @@ ISteamUtils * SteamUtils_()
 ISteamMatchmaking * saved_ISteamMatchmaking = NULL;
 ISteamMatchmaking * SteamMatchmaking_()
 {
+  PROFILE("SteamMatchmaking");
   TRACE("()\n");
   if (saved_ISteamMatchmaking == NULL) {
     ISteamMatchmaking* internal = SteamMatchmaking();
@@ -127,7 +124,7 @@ ISteamMatchmaking * SteamMatchmaking_()
       TRACE("() = NULL!\n");
       return saved_ISteamMatchmaking;
     }
-    saved_ISteamMatchmaking = (ISteamMatchmaking *) new ISteamMatchmaking_(internal);
+    saved_ISteamMatchmaking = (ISteamMatchmaking *) internInterface<ISteamMatchmaking_, ISteamMatchmaking>("ISteamMatchmaking", internal, NULL);
     TRACE("(): (ISteamMatchmaking *)%p wrapped as (ISteamMatchmaking_ *)%p\n", internal, saved_ISteamMatchmaking);
   }
   TRACE("() = (ISteamMatchmaking_ *)%p\n", saved_ISteamMatchmaking);
@@ -138,6 +135,7 @@ ISteamMatchmaking * SteamMatchmaking_()
 ISteamUserStats * saved_ISteamUserStats = NULL;
 ISteamUserStats * SteamUserStats_()
 {
+  PROFILE("SteamUserStats");
   TRACE("()\n");
   if (saved_ISteamUserStats == NULL) {
     ISteamUserStats* internal = SteamUserStats();
@@ -145,7 +143,7 @@ ISteamUserStats * SteamUserStats_()
       TRACE("() = NULL!\n");
       return saved_ISteamUserStats;
     }
-    saved_ISteamUserStats = (ISteamUserStats *) new ISteamUserStats_(internal);
+    saved_ISteamUserStats = (ISteamUserStats *) internInterface<ISteamUserStats_, ISteamUserStats>("ISteamUserStats", internal, NULL);
     TRACE("(): (ISteamUserStats *)%p wrapped as (ISteamUserStats_ *)%p\n", internal, saved_ISteamUserStats);
   }
   TRACE("() = (ISteamUserStats_ *)%p\n", saved_ISteamUserStats);
@@ -156,6 +154,7 @@ ISteamUserStats * SteamUserStats_()
 ISteamApps * saved_ISteamApps = NULL;
 ISteamApps * SteamApps_()
 {
+  PROFILE("SteamApps");
   TRACE("()\n");
   if (saved_ISteamApps == NULL) {
     ISteamApps* internal = SteamApps();
@@ -163,7 +162,7 @@ ISteamApps * SteamApps_()
       TRACE("() = NULL!\n");
       return saved_ISteamApps;
     }
-    saved_ISteamApps = (ISteamApps *) new ISteamApps_(internal);
+    saved_ISteamApps = (ISteamApps *) internInterface<ISteamApps_, ISteamApps>("ISteamApps", internal, NULL);
     TRACE("(): (ISteamApps *)%p wrapped as (ISteamApps_ *)%p\n", internal, saved_ISteamApps);
   }
   TRACE("() = (ISteamApps_ *)%p\n", saved_ISteamApps);
@@ -174,6 +173,7 @@ ISteamApps * SteamApps_()
 ISteamNetworking * saved_ISteamNetworking = NULL;
 ISteamNetworking * SteamNetworking_()
 {
+  PROFILE("SteamNetworking");
   TRACE("()\n");
   if (saved_ISteamNetworking == NULL) {
     ISteamNetworking* internal = SteamNetworking();
@@ -181,7 +181,7 @@ ISteamNetworking * SteamNetworking_()
       TRACE("() = NULL!\n");
       return saved_ISteamNetworking;
     }
-    saved_ISteamNetworking = (ISteamNetworking *) new ISteamNetworking_(internal);
+    saved_ISteamNetworking = (ISteamNetworking *) internInterface<ISteamNetworking_, ISteamNetworking>("ISteamNetworking", internal, NULL);
     TRACE("(): (ISteamNetworking *)%p wrapped as (ISteamNetworking_ *)%p\n", internal, saved_ISteamNetworking);
   }
   TRACE("() = (ISteamNetworking_ *)%p\n", saved_ISteamNetworking);
@@ -192,6 +192,7 @@ ISteamNetworking * SteamNetworking_()
 ISteamMatchmakingServers * saved_ISteamMatchmakingServers = NULL;
 ISteamMatchmakingServers * SteamMatchmakingServers_()
 {
+  PROFILE("SteamMatchmakingServers");
   TRACE("()\n");
   if (saved_ISteamMatchmakingServers == NULL) {
     ISteamMatchmakingServers* internal = SteamMatchmakingServers();
@@ -199,7 +200,7 @@ ISteamMatchmakingServers * SteamMatchmakingServers_()
       TRACE("() = NULL!\n");
       return saved_ISteamMatchmakingServers;
     }
-    saved_ISteamMatchmakingServers = (ISteamMatchmakingServers *) new ISteamMatchmakingServers_(internal);
+    saved_ISteamMatchmakingServers = (ISteamMatchmakingServers *) internInterface<ISteamMatchmakingServers_, ISteamMatchmakingServers>("ISteamMatchmakingServers", internal, NULL);
     TRACE("(): (ISteamMatchmakingServers *)%p wrapped as (ISteamMatchmakingServers_ *)%p\n", internal, saved_ISteamMatchmakingServers);
   }
   TRACE("() = (ISteamMatchmakingServers_ *)%p\n", saved_ISteamMatchmakingServers);
@@ -210,6 +211,7 @@ ISteamMatchmakingServers * SteamMatchmakingServers_()
 ISteamRemoteStorage * saved_ISteamRemoteStorage = NULL;
 ISteamRemoteStorage * SteamRemoteStorage_()
 {
+  PROFILE("SteamRemoteStorage");
   TRACE("()\n");
   if (saved_ISteamRemoteStorage == NULL) {
     ISteamRemoteStorage* internal = SteamRemoteStorage();
@@ -217,7 +219,7 @@ ISteamRemoteStorage * SteamRemoteStorage_()
       TRACE("() = NULL!\n");
       return saved_ISteamRemoteStorage;
     }
-    saved_ISteamRemoteStorage = (ISteamRemoteStorage *) new ISteamRemoteStorage_(internal);
+    saved_ISteamRemoteStorage = (ISteamRemoteStorage *) internInterface<ISteamRemoteStorage_, ISteamRemoteStorage>("ISteamRemoteStorage", internal, NULL);
     TRACE("(): (ISteamRemoteStorage *)%p wrapped as (ISteamRemoteStorage_ *)%p\n", internal, saved_ISteamRemoteStorage);
   }
   TRACE("() = (ISteamRemoteStorage_ *)%p\n", saved_ISteamRemoteStorage);
@@ -228,6 +230,7 @@ ISteamRemoteStorage * SteamRemoteStorage_()
 ISteamScreenshots * saved_ISteamScreenshots = NULL;
 ISteamScreenshots * SteamScreenshots_()
 {
+  PROFILE("SteamScreenshots");
   TRACE("()\n");
   if (saved_ISteamScreenshots == NULL) {
     ISteamScreenshots* internal = SteamScreenshots();
@@ -235,7 +238,7 @@ ISteamScreenshots * SteamScreenshots_()
       TRACE("() = NULL!\n");
       return saved_ISteamScreenshots;
     }
-    saved_ISteamScreenshots = (ISteamScreenshots *) new ISteamScreenshots_(internal);
+    saved_ISteamScreenshots = (ISteamScreenshots *) internInterface<ISteamScreenshots_, ISteamScreenshots>("ISteamScreenshots", internal, NULL);
     TRACE("(): (ISteamScreenshots *)%p wrapped as (ISteamScreenshots_ *)%p\n", internal, saved_ISteamScreenshots);
   }
   TRACE("() = (ISteamScreenshots_ *)%p\n", saved_ISteamScreenshots);
@@ -246,6 +249,7 @@ ISteamScreenshots * SteamScreenshots_()
 ISteamHTTP * saved_ISteamHTTP = NULL;
 ISteamHTTP * SteamHTTP_()
 {
+  PROFILE("SteamHTTP");
   TRACE("()\n");
   if (saved_ISteamHTTP == NULL) {
     ISteamHTTP* internal = SteamHTTP();
@@ -253,7 +257,7 @@ ISteamHTTP * SteamHTTP_()
       TRACE("() = NULL!\n");
       return saved_ISteamHTTP;
     }
-    saved_ISteamHTTP = (ISteamHTTP *) new ISteamHTTP_(internal);
+    saved_ISteamHTTP = (ISteamHTTP *) internInterface<ISteamHTTP_, ISteamHTTP>("ISteamHTTP", internal, NULL);
     TRACE("(): (ISteamHTTP *)%p wrapped as (ISteamHTTP_ *)%p\n", internal, saved_ISteamHTTP);
   }
   TRACE("() = (ISteamHTTP_ *)%p\n", saved_ISteamHTTP);
@@ -264,6 +268,7 @@ ISteamHTTP * SteamHTTP_()
 ISteamUnifiedMessages * saved_ISteamUnifiedMessages = NULL;
 ISteamUnifiedMessages * SteamUnifiedMessages_()
 {
+  PROFILE("SteamUnifiedMessages");
   TRACE("()\n");
   if (saved_ISteamUnifiedMessages == NULL) {
     ISteamUnifiedMessages* internal = SteamUnifiedMessages();
@@ -271,7 +276,7 @@ ISteamUnifiedMessages * SteamUnifiedMessages_()
       TRACE("() = NULL!\n");
       return saved_ISteamUnifiedMessages;
     }
-    saved_ISteamUnifiedMessages = (ISteamUnifiedMessages *) new ISteamUnifiedMessages_(internal);
+    saved_ISteamUnifiedMessages = (ISteamUnifiedMessages *) internInterface<ISteamUnifiedMessages_, ISteamUnifiedMessages>("ISteamUnifiedMessages", internal, NULL);
     TRACE("(): (ISteamUnifiedMessages *)%p wrapped as (ISteamUnifiedMessages_ *)%p\n", internal, saved_ISteamUnifiedMessages);
   }
   TRACE("() = (ISteamUnifiedMessages_ *)%p\n", saved_ISteamUnifiedMessages);
@@ -282,6 +287,7 @@ ISteamUnifiedMessages * SteamUnifiedMessages_()
 ISteamController * saved_ISteamController = NULL;
 ISteamController * SteamController_()
 {
+  PROFILE("SteamController");
   TRACE("()\n");
   if (saved_ISteamController == NULL) {
     ISteamController* internal = SteamController();
@@ -289,7 +295,7 @@ ISteamController * SteamController_()
       TRACE("() = NULL!\n");
       return saved_ISteamController;
     }
-    saved_ISteamController = (ISteamController *) new ISteamController_(internal);
+    saved_ISteamController = (ISteamController *) internInterface<ISteamController_, ISteamController>("ISteamController", internal, NULL);
     TRACE("(): (ISteamController *)%p wrapped as (ISteamController_ *)%p\n", internal, saved_ISteamController);
   }
   TRACE("() = (ISteamController_ *)%p\n", saved_ISteamController);
@@ -300,6 +306,7 @@ ISteamController * SteamController_()
 ISteamUGC * saved_ISteamUGC = NULL;
 ISteamUGC * SteamUGC_()
 {
+  PROFILE("SteamUGC");
   TRACE("()\n");
   if (saved_ISteamUGC == NULL) {
     ISteamUGC* internal = SteamUGC();
@@ -307,7 +314,7 @@ ISteamUGC * SteamUGC_()
       TRACE("() = NULL!\n");
       return saved_ISteamUGC;
     }
-    saved_ISteamUGC = (ISteamUGC *) new ISteamUGC_(internal);
+    saved_ISteamUGC = (ISteamUGC *) internInterface<ISteamUGC_, ISteamUGC>("ISteamUGC", internal, NULL);
     TRACE("(): (ISteamUGC *)%p wrapped as (ISteamUGC_ *)%p\n", internal, saved_ISteamUGC);
   }
   TRACE("() = (ISteamUGC_ *)%p\n", saved_ISteamUGC);
@@ -318,6 +325,7 @@ ISteamUGC * SteamUGC_()
 ISteamAppList * saved_ISteamAppList = NULL;
 ISteamAppList * SteamAppList_()
 {
+  PROFILE("SteamAppList");
   TRACE("()\n");
   if (saved_ISteamAppList == NULL) {
     ISteamAppList* internal = SteamAppList();
@@ -325,7 +333,7 @@ ISteamAppList * SteamAppList_()
       TRACE("() = NULL!\n");
       return saved_ISteamAppList;
     }
-    saved_ISteamAppList = (ISteamAppList *) new ISteamAppList_(internal);
+    saved_ISteamAppList = (ISteamAppList *) internInterface<ISteamAppList_, ISteamAppList>("ISteamAppList", internal, NULL);
     TRACE("(): (ISteamAppList *)%p wrapped as (ISteamAppList_ *)%p\n", internal, saved_ISteamAppList);
   }
   TRACE("() = (ISteamAppList_ *)%p\n", saved_ISteamAppList);
@@ -336,6 +344,7 @@ ISteamAppList * SteamAppList_()
 ISteamMusic * saved_ISteamMusic = NULL;
 ISteamMusic * SteamMusic_()
 {
+  PROFILE("SteamMusic");
   TRACE("()\n");
   if (saved_ISteamMusic == NULL) {
     ISteamMusic* internal = SteamMusic();
@@ -343,7 +352,7 @@ ISteamMusic * SteamMusic_()
       TRACE("() = NULL!\n");
       return saved_ISteamMusic;
     }
-    saved_ISteamMusic = (ISteamMusic *) new ISteamMusic_(internal);
+    saved_ISteamMusic = (ISteamMusic *) internInterface<ISteamMusic_, ISteamMusic>("ISteamMusic", internal, NULL);
     TRACE("(): (ISteamMusic *)%p wrapped as (ISteamMusic_ *)%p\n", internal, saved_ISteamMusic);
   }
   TRACE("() = (ISteamMusic_ *)%p\n", saved_ISteamMusic);
@@ -354,6 +363,7 @@ ISteamMusic * SteamMusic_()
 ISteamMusicRemote * saved_ISteamMusicRemote = NULL;
 ISteamMusicRemote * SteamMusicRemote_()
 {
+  PROFILE("SteamMusicRemote");
   TRACE("()\n");
   if (saved_ISteamMusicRemote == NULL) {
     ISteamMusicRemote* internal = SteamMusicRemote();
@@ -361,7 +371,7 @@ ISteamMusicRemote * SteamMusicRemote_()
       TRACE("() = NULL!\n");
       return saved_ISteamMusicRemote;
     }
-    saved_ISteamMusicRemote = (ISteamMusicRemote *) new ISteamMusicRemote_(internal);
+    saved_ISteamMusicRemote = (ISteamMusicRemote *) internInterface<ISteamMusicRemote_, ISteamMusicRemote>("ISteamMusicRemote", internal, NULL);
     TRACE("(): (ISteamMusicRemote *)%p wrapped as (ISteamMusicRemote_ *)%p\n", internal, saved_ISteamMusicRemote);
   }
   TRACE("() = (ISteamMusicRemote_ *)%p\n", saved_ISteamMusicRemote);
@@ -372,6 +382,7 @@ ISteamMusicRemote * SteamMusicRemote_()
 ISteamHTMLSurface * saved_ISteamHTMLSurface = NULL;
 ISteamHTMLSurface * SteamHTMLSurface_()
 {
+  PROFILE("SteamHTMLSurface");
   TRACE("()\n");
   if (saved_ISteamHTMLSurface == NULL) {
     ISteamHTMLSurface* internal = SteamHTMLSurface();
@@ -379,7 +390,7 @@ ISteamHTMLSurface * SteamHTMLSurface_()
       TRACE("() = NULL!\n");
       return saved_ISteamHTMLSurface;
     }
-    saved_ISteamHTMLSurface = (ISteamHTMLSurface *) new ISteamHTMLSurface_(internal);
+    saved_ISteamHTMLSurface = (ISteamHTMLSurface *) internInterface<ISteamHTMLSurface_, ISteamHTMLSurface>("ISteamHTMLSurface", internal, NULL);
     TRACE("(): (ISteamHTMLSurface *)%p wrapped as (ISteamHTMLSurface_ *)%p\n", internal, saved_ISteamHTMLSurface);
   }
   TRACE("() = (ISteamHTMLSurface_ *)%p\n", saved_ISteamHTMLSurface);
@@ -390,6 +401,7 @@ ISteamHTMLSurface * SteamHTMLSurface_()
 ISteamInventory * saved_ISteamInventory = NULL;
 ISteamInventory * SteamInventory_()
 {
+  PROFILE("SteamInventory");
   TRACE("()\n");
   if (saved_ISteamInventory == NULL) {
     ISteamInventory* internal = SteamInventory();
@@ -397,7 +409,7 @@ ISteamInventory * SteamInventory_()
       TRACE("() = NULL!\n");
       return saved_ISteamInventory;
     }
-    saved_ISteamInventory = (ISteamInventory *) new ISteamInventory_(internal);
+    saved_ISteamInventory = (ISteamInventory *) internInterface<ISteamInventory_, ISteamInventory>("ISteamInventory", internal, NULL);
     TRACE("(): (ISteamInventory *)%p wrapped as (ISteamInventory_ *)%p\n", internal, saved_ISteamInventory);
   }
   TRACE("() = (ISteamInventory_ *)%p\n", saved_ISteamInventory);
@@ -408,6 +420,7 @@ ISteamInventory * SteamInventory_()
 ISteamVideo * saved_ISteamVideo = NULL;
 ISteamVideo * SteamVideo_()
 {
+  PROFILE("SteamVideo");
   TRACE("()\n");
   if (saved_ISteamVideo == NULL) {
     ISteamVideo* internal = SteamVideo();
@@ -415,7 +428,7 @@ ISteamVideo * SteamVideo_()
       TRACE("() = NULL!\n");
       return saved_ISteamVideo;
     }
-    saved_ISteamVideo = (ISteamVideo *) new ISteamVideo_(internal);
+    saved_ISteamVideo = (ISteamVideo *) internInterface<ISteamVideo_, ISteamVideo>("ISteamVideo", internal, NULL);
     TRACE("(): (ISteamVideo *)%p wrapped as (ISteamVideo_ *)%p\n", internal, saved_ISteamVideo);
   }
   TRACE("() = (ISteamVideo_ *)%p\n", saved_ISteamVideo);
@@ -424,13 +437,6 @@ ISteamVideo * SteamVideo_()
 }
 
 
-void  SteamAPI_RunCallbacks_()
-{
-  
-  SteamAPI_RunCallbacks();
-  
-}
-
 
 
 
@@ -438,5917 +444,4353 @@ void  SteamAPI_RunCallbacks_()
 
 bool  SteamAPI_IsSteamRunning_()
 {
-  TRACE("()\n");
-  bool  result = SteamAPI_IsSteamRunning();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_IsSteamRunning");
+  return Forward<FORWARD_FUNCTION(SteamAPI_IsSteamRunning)>::call(&point);
 }
 
 
 void  Steam_RunCallbacks_(HSteamPipe  hSteamPipe, bool  bGameServerCallbacks)
 {
-  TRACE("((HSteamPipe )%p, (bool )%d)\n", hSteamPipe, bGameServerCallbacks);
-  Steam_RunCallbacks(hSteamPipe, bGameServerCallbacks);
-  
+  static ProfilePoint point("Steam_RunCallbacks");
+  forwarderNewFrame();
+  return Forward<FORWARD_FUNCTION(Steam_RunCallbacks)>::call(&point, hSteamPipe, bGameServerCallbacks);
 }
 
 
 void  Steam_RegisterInterfaceFuncs_(void * hModule)
 {
-  TRACE("((void *)%p)\n", hModule);
-  Steam_RegisterInterfaceFuncs(hModule);
-  
+  static ProfilePoint point("Steam_RegisterInterfaceFuncs");
+  return Forward<FORWARD_FUNCTION(Steam_RegisterInterfaceFuncs)>::call(&point, hModule);
 }
 
 
 HSteamUser  Steam_GetHSteamUserCurrent_()
 {
-  TRACE("()\n");
-  HSteamUser  result = Steam_GetHSteamUserCurrent();
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("Steam_GetHSteamUserCurrent");
+  return Forward<FORWARD_FUNCTION(Steam_GetHSteamUserCurrent)>::call(&point);
 }
 
 
 char * SteamAPI_GetSteamInstallPath_()
 {
-  TRACE("()\n");
-  char * result = SteamAPI_GetSteamInstallPath();
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_GetSteamInstallPath");
+  return Forward<FORWARD_FUNCTION(SteamAPI_GetSteamInstallPath)>::call(&point);
 }
 
 
 HSteamPipe  SteamAPI_GetHSteamPipe_()
 {
-  TRACE("()\n");
-  HSteamPipe  result = SteamAPI_GetHSteamPipe();
-  TRACE("() = (HSteamPipe )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_GetHSteamPipe");
+  return Forward<FORWARD_FUNCTION(SteamAPI_GetHSteamPipe)>::call(&point);
 }
 
 
 void  SteamAPI_SetTryCatchCallbacks_(bool  bTryCatchCallbacks)
 {
-  TRACE("((bool )%d)\n", bTryCatchCallbacks);
-  SteamAPI_SetTryCatchCallbacks(bTryCatchCallbacks);
-  
+  static ProfilePoint point("SteamAPI_SetTryCatchCallbacks");
+  return Forward<FORWARD_FUNCTION(SteamAPI_SetTryCatchCallbacks)>::call(&point, bTryCatchCallbacks);
 }
 
 
 HSteamPipe  GetHSteamPipe_()
 {
-  TRACE("()\n");
-  HSteamPipe  result = GetHSteamPipe();
-  TRACE("() = (HSteamPipe )%p\n", result);
-
-  return result;
+  static ProfilePoint point("GetHSteamPipe");
+  return Forward<FORWARD_FUNCTION(GetHSteamPipe)>::call(&point);
 }
 
 
 HSteamUser  GetHSteamUser_()
 {
-  TRACE("()\n");
-  HSteamUser  result = GetHSteamUser();
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("GetHSteamUser");
+  return Forward<FORWARD_FUNCTION(GetHSteamUser)>::call(&point);
 }
 
 
 bool  SteamAPI_InitSafe_()
 {
-  TRACE("()\n");
-  bool  result = SteamAPI_InitSafe();
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_InitSafe");
+  return Forward<FORWARD_FUNCTION(SteamAPI_InitSafe)>::call(&point);
 }
 
 
 HSteamUser  SteamAPI_GetHSteamUser_()
 {
-  TRACE("()\n");
-  HSteamUser  result = SteamAPI_GetHSteamUser();
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_GetHSteamUser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_GetHSteamUser)>::call(&point);
 }
 
 
 void  SteamAPI_UseBreakpadCrashHandler_(char const * pchVersion, char const * pchDate, char const * pchTime, bool  bFullMemoryDumps, void * pvContext, PFNPreMinidumpCallback  m_pfnPreMinidumpCallback)
 {
-  TRACE("((char const *)%p, (char const *)%p, (char const *)%p, (bool )%d, (void *)%p, (PFNPreMinidumpCallback )%p)\n", pchVersion, pchDate, pchTime, bFullMemoryDumps, pvContext, m_pfnPreMinidumpCallback);
-  SteamAPI_UseBreakpadCrashHandler(pchVersion, pchDate, pchTime, bFullMemoryDumps, pvContext, m_pfnPreMinidumpCallback);
-  
+  static ProfilePoint point("SteamAPI_UseBreakpadCrashHandler");
+  return Forward<FORWARD_FUNCTION(SteamAPI_UseBreakpadCrashHandler)>::call(&point, pchVersion, pchDate, pchTime, bFullMemoryDumps, pvContext, m_pfnPreMinidumpCallback);
 }
 
 
 void  SteamAPI_SetBreakpadAppID_(uint32  unAppID)
 {
-  TRACE("((uint32 )%d)\n", unAppID);
-  SteamAPI_SetBreakpadAppID(unAppID);
-  
+  static ProfilePoint point("SteamAPI_SetBreakpadAppID");
+  return Forward<FORWARD_FUNCTION(SteamAPI_SetBreakpadAppID)>::call(&point, unAppID);
 }
 
 
 HSteamPipe  SteamAPI_ISteamClient_CreateSteamPipe_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  HSteamPipe  result = SteamAPI_ISteamClient_CreateSteamPipe(instancePtr);
-  TRACE("() = (HSteamPipe )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamClient_CreateSteamPipe");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_CreateSteamPipe)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamClient_BReleaseSteamPipe_(intptr_t  instancePtr, HSteamPipe  hSteamPipe)
 {
-  TRACE("((intptr_t )%p, (HSteamPipe )%p)\n", instancePtr, hSteamPipe);
-  bool  result = SteamAPI_ISteamClient_BReleaseSteamPipe(instancePtr, hSteamPipe);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamClient_BReleaseSteamPipe");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_BReleaseSteamPipe)>::call(&point, unwrapInstance(instancePtr), hSteamPipe);
 }
 
 
 HSteamUser  SteamAPI_ISteamClient_ConnectToGlobalUser_(intptr_t  instancePtr, HSteamPipe  hSteamPipe)
 {
-  TRACE("((intptr_t )%p, (HSteamPipe )%p)\n", instancePtr, hSteamPipe);
-  HSteamUser  result = SteamAPI_ISteamClient_ConnectToGlobalUser(instancePtr, hSteamPipe);
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamClient_ConnectToGlobalUser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_ConnectToGlobalUser)>::call(&point, unwrapInstance(instancePtr), hSteamPipe);
 }
 
 
 HSteamUser  SteamAPI_ISteamClient_CreateLocalUser_(intptr_t  instancePtr, HSteamPipe * phSteamPipe, EAccountType  eAccountType)
 {
-  TRACE("((intptr_t )%p, (HSteamPipe *)%p, (EAccountType )%p)\n", instancePtr, phSteamPipe, eAccountType);
-  HSteamUser  result = SteamAPI_ISteamClient_CreateLocalUser(instancePtr, phSteamPipe, eAccountType);
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamClient_CreateLocalUser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_CreateLocalUser)>::call(&point, unwrapInstance(instancePtr), phSteamPipe, eAccountType);
 }
 
 
 void  SteamAPI_ISteamClient_ReleaseUser_(intptr_t  instancePtr, HSteamPipe  hSteamPipe, HSteamUser  hUser)
 {
-  TRACE("((intptr_t )%p, (HSteamPipe )%p, (HSteamUser )%p)\n", instancePtr, hSteamPipe, hUser);
-  SteamAPI_ISteamClient_ReleaseUser(instancePtr, hSteamPipe, hUser);
-  
+  static ProfilePoint point("SteamAPI_ISteamClient_ReleaseUser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_ReleaseUser)>::call(&point, unwrapInstance(instancePtr), hSteamPipe, hUser);
 }
 
 
 ISteamUser * SteamAPI_ISteamClient_GetISteamUser_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamUser_* result = new ISteamUser_(SteamAPI_ISteamClient_GetISteamUser(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUser *)%p\n", result);
-
-  return (ISteamUser *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamUser");
+  return (ISteamUser *)wrapVersion<ISteamUser_, ISteamUser>("ISteamUser", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamUser)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamGameServer * SteamAPI_ISteamClient_GetISteamGameServer_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamGameServer_* result = new ISteamGameServer_(SteamAPI_ISteamClient_GetISteamGameServer(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamGameServer *)%p\n", result);
-
-  return (ISteamGameServer *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamGameServer");
+  return (ISteamGameServer *)wrapVersion<ISteamGameServer_, ISteamGameServer>("ISteamGameServer", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamGameServer)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 void  SteamAPI_ISteamClient_SetLocalIPBinding_(intptr_t  instancePtr, uint32  unIP, uint16  usPort)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (uint16 )%d)\n", instancePtr, unIP, usPort);
-  SteamAPI_ISteamClient_SetLocalIPBinding(instancePtr, unIP, usPort);
-  
+  static ProfilePoint point("SteamAPI_ISteamClient_SetLocalIPBinding");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_SetLocalIPBinding)>::call(&point, unwrapInstance(instancePtr), unIP, usPort);
 }
 
 
 ISteamFriends * SteamAPI_ISteamClient_GetISteamFriends_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamFriends_* result = new ISteamFriends_(SteamAPI_ISteamClient_GetISteamFriends(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamFriends *)%p\n", result);
-
-  return (ISteamFriends *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamFriends");
+  return (ISteamFriends *)wrapVersion<ISteamFriends_, ISteamFriends>("ISteamFriends", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamFriends)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUtils * SteamAPI_ISteamClient_GetISteamUtils_(intptr_t  instancePtr, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamPipe, pchVersion);
-  ISteamUtils_* result = new ISteamUtils_(SteamAPI_ISteamClient_GetISteamUtils(instancePtr, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUtils *)%p\n", result);
-
-  return (ISteamUtils *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamUtils");
+  return (ISteamUtils *)wrapVersion<ISteamUtils_, ISteamUtils>("ISteamUtils", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamUtils)>::call(&point, unwrapInstance(instancePtr), hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMatchmaking * SteamAPI_ISteamClient_GetISteamMatchmaking_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamMatchmaking_* result = new ISteamMatchmaking_(SteamAPI_ISteamClient_GetISteamMatchmaking(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMatchmaking *)%p\n", result);
-
-  return (ISteamMatchmaking *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamMatchmaking");
+  return (ISteamMatchmaking *)wrapVersion<ISteamMatchmaking_, ISteamMatchmaking>("ISteamMatchmaking", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamMatchmaking)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMatchmakingServers * SteamAPI_ISteamClient_GetISteamMatchmakingServers_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamMatchmakingServers_* result = new ISteamMatchmakingServers_(SteamAPI_ISteamClient_GetISteamMatchmakingServers(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMatchmakingServers *)%p\n", result);
-
-  return (ISteamMatchmakingServers *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamMatchmakingServers");
+  return (ISteamMatchmakingServers *)wrapVersion<ISteamMatchmakingServers_, ISteamMatchmakingServers>("ISteamMatchmakingServers", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamMatchmakingServers)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 void * SteamAPI_ISteamClient_GetISteamGenericInterface_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  void * result = SteamAPI_ISteamClient_GetISteamGenericInterface(instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamGenericInterface");
+  return wrapGenericInterface(Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamGenericInterface)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUserStats * SteamAPI_ISteamClient_GetISteamUserStats_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamUserStats_* result = new ISteamUserStats_(SteamAPI_ISteamClient_GetISteamUserStats(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUserStats *)%p\n", result);
-
-  return (ISteamUserStats *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamUserStats");
+  return (ISteamUserStats *)wrapVersion<ISteamUserStats_, ISteamUserStats>("ISteamUserStats", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamUserStats)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamGameServerStats * SteamAPI_ISteamClient_GetISteamGameServerStats_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamGameServerStats_* result = new ISteamGameServerStats_(SteamAPI_ISteamClient_GetISteamGameServerStats(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamGameServerStats *)%p\n", result);
-
-  return (ISteamGameServerStats *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamGameServerStats");
+  return (ISteamGameServerStats *)wrapVersion<ISteamGameServerStats_, ISteamGameServerStats>("ISteamGameServerStats", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamGameServerStats)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamApps * SteamAPI_ISteamClient_GetISteamApps_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamApps_* result = new ISteamApps_(SteamAPI_ISteamClient_GetISteamApps(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamApps *)%p\n", result);
-
-  return (ISteamApps *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamApps");
+  return (ISteamApps *)wrapVersion<ISteamApps_, ISteamApps>("ISteamApps", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamApps)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamNetworking * SteamAPI_ISteamClient_GetISteamNetworking_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamNetworking_* result = new ISteamNetworking_(SteamAPI_ISteamClient_GetISteamNetworking(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamNetworking *)%p\n", result);
-
-  return (ISteamNetworking *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamNetworking");
+  return (ISteamNetworking *)wrapVersion<ISteamNetworking_, ISteamNetworking>("ISteamNetworking", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamNetworking)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamRemoteStorage * SteamAPI_ISteamClient_GetISteamRemoteStorage_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamRemoteStorage_* result = new ISteamRemoteStorage_(SteamAPI_ISteamClient_GetISteamRemoteStorage(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamRemoteStorage *)%p\n", result);
-
-  return (ISteamRemoteStorage *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamRemoteStorage");
+  return (ISteamRemoteStorage *)wrapVersion<ISteamRemoteStorage_, ISteamRemoteStorage>("ISteamRemoteStorage", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamRemoteStorage)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamScreenshots * SteamAPI_ISteamClient_GetISteamScreenshots_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamScreenshots_* result = new ISteamScreenshots_(SteamAPI_ISteamClient_GetISteamScreenshots(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamScreenshots *)%p\n", result);
-
-  return (ISteamScreenshots *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamScreenshots");
+  return (ISteamScreenshots *)wrapVersion<ISteamScreenshots_, ISteamScreenshots>("ISteamScreenshots", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamScreenshots)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 uint32  SteamAPI_ISteamClient_GetIPCCallCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamClient_GetIPCCallCount(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetIPCCallCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetIPCCallCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamClient_SetWarningMessageHook_(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction)
 {
-  TRACE("((intptr_t )%p, (SteamAPIWarningMessageHook_t )%p)\n", instancePtr, pFunction);
-  SteamAPI_ISteamClient_SetWarningMessageHook(instancePtr, pFunction);
-  
+  static ProfilePoint point("SteamAPI_ISteamClient_SetWarningMessageHook");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_SetWarningMessageHook)>::call(&point, unwrapInstance(instancePtr), pFunction);
 }
 
 
 bool  SteamAPI_ISteamClient_BShutdownIfAllPipesClosed_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamClient_BShutdownIfAllPipesClosed(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamClient_BShutdownIfAllPipesClosed");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_BShutdownIfAllPipesClosed)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 ISteamHTTP * SteamAPI_ISteamClient_GetISteamHTTP_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamHTTP_* result = new ISteamHTTP_(SteamAPI_ISteamClient_GetISteamHTTP(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamHTTP *)%p\n", result);
-
-  return (ISteamHTTP *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamHTTP");
+  return (ISteamHTTP *)wrapVersion<ISteamHTTP_, ISteamHTTP>("ISteamHTTP", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamHTTP)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUnifiedMessages * SteamAPI_ISteamClient_GetISteamUnifiedMessages_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamUnifiedMessages_* result = new ISteamUnifiedMessages_(SteamAPI_ISteamClient_GetISteamUnifiedMessages(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUnifiedMessages *)%p\n", result);
-
-  return (ISteamUnifiedMessages *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamUnifiedMessages");
+  return (ISteamUnifiedMessages *)wrapVersion<ISteamUnifiedMessages_, ISteamUnifiedMessages>("ISteamUnifiedMessages", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamUnifiedMessages)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamController * SteamAPI_ISteamClient_GetISteamController_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamController_* result = new ISteamController_(SteamAPI_ISteamClient_GetISteamController(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamController *)%p\n", result);
-
-  return (ISteamController *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamController");
+  return (ISteamController *)wrapVersion<ISteamController_, ISteamController>("ISteamController", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamController)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamUGC * SteamAPI_ISteamClient_GetISteamUGC_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamUGC_* result = new ISteamUGC_(SteamAPI_ISteamClient_GetISteamUGC(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamUGC *)%p\n", result);
-
-  return (ISteamUGC *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamUGC");
+  return (ISteamUGC *)wrapVersion<ISteamUGC_, ISteamUGC>("ISteamUGC", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamUGC)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamAppList * SteamAPI_ISteamClient_GetISteamAppList_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamUser, hSteamPipe, pchVersion);
-  ISteamAppList_* result = new ISteamAppList_(SteamAPI_ISteamClient_GetISteamAppList(instancePtr, hSteamUser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamAppList *)%p\n", result);
-
-  return (ISteamAppList *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamAppList");
+  return (ISteamAppList *)wrapVersion<ISteamAppList_, ISteamAppList>("ISteamAppList", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamAppList)>::call(&point, unwrapInstance(instancePtr), hSteamUser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMusic * SteamAPI_ISteamClient_GetISteamMusic_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamMusic_* result = new ISteamMusic_(SteamAPI_ISteamClient_GetISteamMusic(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMusic *)%p\n", result);
-
-  return (ISteamMusic *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamMusic");
+  return (ISteamMusic *)wrapVersion<ISteamMusic_, ISteamMusic>("ISteamMusic", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamMusic)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamMusicRemote * SteamAPI_ISteamClient_GetISteamMusicRemote_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamMusicRemote_* result = new ISteamMusicRemote_(SteamAPI_ISteamClient_GetISteamMusicRemote(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamMusicRemote *)%p\n", result);
-
-  return (ISteamMusicRemote *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamMusicRemote");
+  return (ISteamMusicRemote *)wrapVersion<ISteamMusicRemote_, ISteamMusicRemote>("ISteamMusicRemote", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamMusicRemote)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamHTMLSurface * SteamAPI_ISteamClient_GetISteamHTMLSurface_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamHTMLSurface_* result = new ISteamHTMLSurface_(SteamAPI_ISteamClient_GetISteamHTMLSurface(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamHTMLSurface *)%p\n", result);
-
-  return (ISteamHTMLSurface *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamHTMLSurface");
+  return (ISteamHTMLSurface *)wrapVersion<ISteamHTMLSurface_, ISteamHTMLSurface>("ISteamHTMLSurface", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamHTMLSurface)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamInventory * SteamAPI_ISteamClient_GetISteamInventory_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamInventory_* result = new ISteamInventory_(SteamAPI_ISteamClient_GetISteamInventory(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamInventory *)%p\n", result);
-
-  return (ISteamInventory *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamInventory");
+  return (ISteamInventory *)wrapVersion<ISteamInventory_, ISteamInventory>("ISteamInventory", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamInventory)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 ISteamVideo * SteamAPI_ISteamClient_GetISteamVideo_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion)
 {
-  TRACE("((intptr_t )%p, (HSteamUser )%p, (HSteamPipe )%p, (char *)\"%s\")\n", instancePtr, hSteamuser, hSteamPipe, pchVersion);
-  ISteamVideo_* result = new ISteamVideo_(SteamAPI_ISteamClient_GetISteamVideo(instancePtr, hSteamuser, hSteamPipe, pchVersion));
-  TRACE("() = (ISteamVideo *)%p\n", result);
-
-  return (ISteamVideo *)result;
+  static ProfilePoint point("SteamAPI_ISteamClient_GetISteamVideo");
+  return (ISteamVideo *)wrapVersion<ISteamVideo_, ISteamVideo>("ISteamVideo", Forward<FORWARD_FUNCTION(SteamAPI_ISteamClient_GetISteamVideo)>::call(&point, unwrapInstance(instancePtr), hSteamuser, hSteamPipe, pchVersion), pchVersion);
 }
 
 
 HSteamUser  SteamAPI_ISteamUser_GetHSteamUser_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  HSteamUser  result = SteamAPI_ISteamUser_GetHSteamUser(instancePtr);
-  TRACE("() = (HSteamUser )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetHSteamUser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetHSteamUser), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamUser_BLoggedOn_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamUser_BLoggedOn(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_BLoggedOn");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_BLoggedOn), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint64  SteamAPI_ISteamUser_GetSteamID_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint64  result = SteamAPI_ISteamUser_GetSteamID(instancePtr);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetSteamID");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetSteamID), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 int  SteamAPI_ISteamUser_InitiateGameConnection_(intptr_t  instancePtr, void * pAuthBlob, int  cbMaxAuthBlob, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer, bool  bSecure)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (CSteamID )%p, (uint32 )%d, (uint16 )%d, (bool )%d)\n", instancePtr, pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure);
-  int  result = SteamAPI_ISteamUser_InitiateGameConnection(instancePtr, pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_InitiateGameConnection", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_InitiateGameConnection), true>::call(&point, unwrapInstance(instancePtr), pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure);
 }
 
 
 void  SteamAPI_ISteamUser_TerminateGameConnection_(intptr_t  instancePtr, uint32  unIPServer, uint16  usPortServer)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (uint16 )%d)\n", instancePtr, unIPServer, usPortServer);
-  SteamAPI_ISteamUser_TerminateGameConnection(instancePtr, unIPServer, usPortServer);
-  
+  static ProfilePoint point("SteamAPI_ISteamUser_TerminateGameConnection");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_TerminateGameConnection), true>::call(&point, unwrapInstance(instancePtr), unIPServer, usPortServer);
 }
 
 
 void  SteamAPI_ISteamUser_TrackAppUsageEvent_(intptr_t  instancePtr, CGameID  gameID, int  eAppUsageEvent, char * pchExtraInfo)
 {
-  TRACE("((intptr_t )%p, (CGameID )%p, (int )%d, (char *)\"%s\")\n", instancePtr, gameID, eAppUsageEvent, pchExtraInfo);
-  SteamAPI_ISteamUser_TrackAppUsageEvent(instancePtr, gameID, eAppUsageEvent, pchExtraInfo);
-  
+  static ProfilePoint point("SteamAPI_ISteamUser_TrackAppUsageEvent");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_TrackAppUsageEvent), true>::call(&point, unwrapInstance(instancePtr), gameID, eAppUsageEvent, pchExtraInfo);
 }
 
 
 bool  SteamAPI_ISteamUser_GetUserDataFolder_(intptr_t  instancePtr, char * pchBuffer, int  cubBuffer)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int )%d)\n", instancePtr, pchBuffer, cubBuffer);
-  bool  result = SteamAPI_ISteamUser_GetUserDataFolder(instancePtr, pchBuffer, cubBuffer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetUserDataFolder", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetUserDataFolder), true>::call(&point, unwrapInstance(instancePtr), pchBuffer, cubBuffer);
 }
 
 
 void  SteamAPI_ISteamUser_StartVoiceRecording_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamUser_StartVoiceRecording(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamUser_StartVoiceRecording");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_StartVoiceRecording), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamUser_StopVoiceRecording_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamUser_StopVoiceRecording(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamUser_StopVoiceRecording");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_StopVoiceRecording), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 EVoiceResult  SteamAPI_ISteamUser_GetAvailableVoice_(intptr_t  instancePtr, uint32 * pcbCompressed, uint32 * pcbUncompressed, uint32  nUncompressedVoiceDesiredSampleRate)
 {
-  TRACE("((intptr_t )%p, (uint32 *)%d, (uint32 *)%d, (uint32 )%d)\n", instancePtr, pcbCompressed, pcbUncompressed, nUncompressedVoiceDesiredSampleRate);
-  EVoiceResult  result = SteamAPI_ISteamUser_GetAvailableVoice(instancePtr, pcbCompressed, pcbUncompressed, nUncompressedVoiceDesiredSampleRate);
-  TRACE("() = (EVoiceResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetAvailableVoice");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetAvailableVoice), true>::call(&point, unwrapInstance(instancePtr), pcbCompressed, pcbUncompressed, nUncompressedVoiceDesiredSampleRate);
 }
 
 
 EVoiceResult  SteamAPI_ISteamUser_GetVoice_(intptr_t  instancePtr, bool  bWantCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, bool  bWantUncompressed, void * pUncompressedDestBuffer, uint32  cbUncompressedDestBufferSize, uint32 * nUncompressBytesWritten, uint32  nUncompressedVoiceDesiredSampleRate)
 {
-  TRACE("((intptr_t )%p, (bool )%d, (void *)%p, (uint32 )%d, (uint32 *)%d, (bool )%d, (void *)%p, (uint32 )%d, (uint32 *)%d, (uint32 )%d)\n", instancePtr, bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, bWantUncompressed, pUncompressedDestBuffer, cbUncompressedDestBufferSize, nUncompressBytesWritten, nUncompressedVoiceDesiredSampleRate);
-  EVoiceResult  result = SteamAPI_ISteamUser_GetVoice(instancePtr, bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, bWantUncompressed, pUncompressedDestBuffer, cbUncompressedDestBufferSize, nUncompressBytesWritten, nUncompressedVoiceDesiredSampleRate);
-  TRACE("() = (EVoiceResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetVoice", "2:3 6:7");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetVoice), true>::call(&point, unwrapInstance(instancePtr), bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, bWantUncompressed, pUncompressedDestBuffer, cbUncompressedDestBufferSize, nUncompressBytesWritten, nUncompressedVoiceDesiredSampleRate);
 }
 
 
 EVoiceResult  SteamAPI_ISteamUser_DecompressVoice_(intptr_t  instancePtr, void * pCompressed, uint32  cbCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, uint32  nDesiredSampleRate)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (uint32 )%d, (void *)%p, (uint32 )%d, (uint32 *)%d, (uint32 )%d)\n", instancePtr, pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate);
-  EVoiceResult  result = SteamAPI_ISteamUser_DecompressVoice(instancePtr, pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate);
-  TRACE("() = (EVoiceResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_DecompressVoice", "1:2 3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_DecompressVoice), true>::call(&point, unwrapInstance(instancePtr), pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate);
 }
 
 
 uint32  SteamAPI_ISteamUser_GetVoiceOptimalSampleRate_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUser_GetVoiceOptimalSampleRate(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetVoiceOptimalSampleRate");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetVoiceOptimalSampleRate), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 HAuthTicket  SteamAPI_ISteamUser_GetAuthSessionTicket_(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (uint32 *)%d)\n", instancePtr, pTicket, cbMaxTicket, pcbTicket);
-  HAuthTicket  result = SteamAPI_ISteamUser_GetAuthSessionTicket(instancePtr, pTicket, cbMaxTicket, pcbTicket);
-  TRACE("() = (HAuthTicket )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetAuthSessionTicket", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetAuthSessionTicket), true>::call(&point, unwrapInstance(instancePtr), pTicket, cbMaxTicket, pcbTicket);
 }
 
 
 EBeginAuthSessionResult  SteamAPI_ISteamUser_BeginAuthSession_(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (CSteamID )%p)\n", instancePtr, pAuthTicket, cbAuthTicket, steamID);
-  EBeginAuthSessionResult  result = SteamAPI_ISteamUser_BeginAuthSession(instancePtr, pAuthTicket, cbAuthTicket, steamID);
-  TRACE("() = (EBeginAuthSessionResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_BeginAuthSession", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_BeginAuthSession), true>::call(&point, unwrapInstance(instancePtr), pAuthTicket, cbAuthTicket, steamID);
 }
 
 
 void  SteamAPI_ISteamUser_EndAuthSession_(intptr_t  instancePtr, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamID);
-  SteamAPI_ISteamUser_EndAuthSession(instancePtr, steamID);
-  
+  static ProfilePoint point("SteamAPI_ISteamUser_EndAuthSession");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_EndAuthSession), true>::call(&point, unwrapInstance(instancePtr), steamID);
 }
 
 
 void  SteamAPI_ISteamUser_CancelAuthTicket_(intptr_t  instancePtr, HAuthTicket  hAuthTicket)
 {
-  TRACE("((intptr_t )%p, (HAuthTicket )%p)\n", instancePtr, hAuthTicket);
-  SteamAPI_ISteamUser_CancelAuthTicket(instancePtr, hAuthTicket);
-  
+  static ProfilePoint point("SteamAPI_ISteamUser_CancelAuthTicket");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_CancelAuthTicket), true>::call(&point, unwrapInstance(instancePtr), hAuthTicket);
 }
 
 
 EUserHasLicenseForAppResult  SteamAPI_ISteamUser_UserHasLicenseForApp_(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (AppId_t )%p)\n", instancePtr, steamID, appID);
-  EUserHasLicenseForAppResult  result = SteamAPI_ISteamUser_UserHasLicenseForApp(instancePtr, steamID, appID);
-  TRACE("() = (EUserHasLicenseForAppResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_UserHasLicenseForApp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_UserHasLicenseForApp), true>::call(&point, unwrapInstance(instancePtr), steamID, appID);
 }
 
 
 bool  SteamAPI_ISteamUser_BIsBehindNAT_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamUser_BIsBehindNAT(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_BIsBehindNAT");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_BIsBehindNAT), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamUser_AdvertiseGame_(intptr_t  instancePtr, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (uint32 )%d, (uint16 )%d)\n", instancePtr, steamIDGameServer, unIPServer, usPortServer);
-  SteamAPI_ISteamUser_AdvertiseGame(instancePtr, steamIDGameServer, unIPServer, usPortServer);
-  
+  static ProfilePoint point("SteamAPI_ISteamUser_AdvertiseGame");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_AdvertiseGame), true>::call(&point, unwrapInstance(instancePtr), steamIDGameServer, unIPServer, usPortServer);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUser_RequestEncryptedAppTicket_(intptr_t  instancePtr, void * pDataToInclude, int  cbDataToInclude)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d)\n", instancePtr, pDataToInclude, cbDataToInclude);
-  SteamAPICall_t  result = SteamAPI_ISteamUser_RequestEncryptedAppTicket(instancePtr, pDataToInclude, cbDataToInclude);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_RequestEncryptedAppTicket", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_RequestEncryptedAppTicket), true>::call(&point, unwrapInstance(instancePtr), pDataToInclude, cbDataToInclude);
 }
 
 
 bool  SteamAPI_ISteamUser_GetEncryptedAppTicket_(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (uint32 *)%d)\n", instancePtr, pTicket, cbMaxTicket, pcbTicket);
-  bool  result = SteamAPI_ISteamUser_GetEncryptedAppTicket(instancePtr, pTicket, cbMaxTicket, pcbTicket);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetEncryptedAppTicket", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetEncryptedAppTicket), true>::call(&point, unwrapInstance(instancePtr), pTicket, cbMaxTicket, pcbTicket);
 }
 
 
 int  SteamAPI_ISteamUser_GetGameBadgeLevel_(intptr_t  instancePtr, int  nSeries, bool  bFoil)
 {
-  TRACE("((intptr_t )%p, (int )%d, (bool )%d)\n", instancePtr, nSeries, bFoil);
-  int  result = SteamAPI_ISteamUser_GetGameBadgeLevel(instancePtr, nSeries, bFoil);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetGameBadgeLevel");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetGameBadgeLevel), true>::call(&point, unwrapInstance(instancePtr), nSeries, bFoil);
 }
 
 
 int  SteamAPI_ISteamUser_GetPlayerSteamLevel_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int  result = SteamAPI_ISteamUser_GetPlayerSteamLevel(instancePtr);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_GetPlayerSteamLevel");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_GetPlayerSteamLevel), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUser_RequestStoreAuthURL_(intptr_t  instancePtr, char * pchRedirectURL)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchRedirectURL);
-  SteamAPICall_t  result = SteamAPI_ISteamUser_RequestStoreAuthURL(instancePtr, pchRedirectURL);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUser_RequestStoreAuthURL");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUser_RequestStoreAuthURL), true>::call(&point, unwrapInstance(instancePtr), pchRedirectURL);
 }
 
 
 char * SteamAPI_ISteamFriends_GetPersonaName_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  char * result = SteamAPI_ISteamFriends_GetPersonaName(instancePtr);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetPersonaName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetPersonaName)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamFriends_SetPersonaName_(intptr_t  instancePtr, char * pchPersonaName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchPersonaName);
-  SteamAPICall_t  result = SteamAPI_ISteamFriends_SetPersonaName(instancePtr, pchPersonaName);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_SetPersonaName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_SetPersonaName)>::call(&point, unwrapInstance(instancePtr), pchPersonaName);
 }
 
 
 EPersonaState  SteamAPI_ISteamFriends_GetPersonaState_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  EPersonaState  result = SteamAPI_ISteamFriends_GetPersonaState(instancePtr);
-  TRACE("() = (EPersonaState )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetPersonaState");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetPersonaState)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendCount_(intptr_t  instancePtr, int  iFriendFlags)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, iFriendFlags);
-  int  result = SteamAPI_ISteamFriends_GetFriendCount(instancePtr, iFriendFlags);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendCount)>::call(&point, unwrapInstance(instancePtr), iFriendFlags);
 }
 
 
 uint64  SteamAPI_ISteamFriends_GetFriendByIndex_(intptr_t  instancePtr, int  iFriend, int  iFriendFlags)
 {
-  TRACE("((intptr_t )%p, (int )%d, (int )%d)\n", instancePtr, iFriend, iFriendFlags);
-  uint64  result = SteamAPI_ISteamFriends_GetFriendByIndex(instancePtr, iFriend, iFriendFlags);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendByIndex)>::call(&point, unwrapInstance(instancePtr), iFriend, iFriendFlags);
 }
 
 
 EFriendRelationship  SteamAPI_ISteamFriends_GetFriendRelationship_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  EFriendRelationship  result = SteamAPI_ISteamFriends_GetFriendRelationship(instancePtr, steamIDFriend);
-  TRACE("() = (EFriendRelationship )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendRelationship");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendRelationship)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 EPersonaState  SteamAPI_ISteamFriends_GetFriendPersonaState_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  EPersonaState  result = SteamAPI_ISteamFriends_GetFriendPersonaState(instancePtr, steamIDFriend);
-  TRACE("() = (EPersonaState )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendPersonaState");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendPersonaState)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 char * SteamAPI_ISteamFriends_GetFriendPersonaName_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  char * result = SteamAPI_ISteamFriends_GetFriendPersonaName(instancePtr, steamIDFriend);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendPersonaName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendPersonaName)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 bool  SteamAPI_ISteamFriends_GetFriendGamePlayed_(intptr_t  instancePtr, CSteamID  steamIDFriend, FriendGameInfo_t * pFriendGameInfo)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (FriendGameInfo_t *)%p)\n", instancePtr, steamIDFriend, pFriendGameInfo);
-  bool  result = SteamAPI_ISteamFriends_GetFriendGamePlayed(instancePtr, steamIDFriend, pFriendGameInfo);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendGamePlayed");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendGamePlayed)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, pFriendGameInfo);
 }
 
 
 char * SteamAPI_ISteamFriends_GetFriendPersonaNameHistory_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iPersonaName)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDFriend, iPersonaName);
-  char * result = SteamAPI_ISteamFriends_GetFriendPersonaNameHistory(instancePtr, steamIDFriend, iPersonaName);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendPersonaNameHistory");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendPersonaNameHistory)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, iPersonaName);
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendSteamLevel_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  int  result = SteamAPI_ISteamFriends_GetFriendSteamLevel(instancePtr, steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendSteamLevel");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendSteamLevel)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 char * SteamAPI_ISteamFriends_GetPlayerNickname_(intptr_t  instancePtr, CSteamID  steamIDPlayer)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDPlayer);
-  char * result = SteamAPI_ISteamFriends_GetPlayerNickname(instancePtr, steamIDPlayer);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetPlayerNickname");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetPlayerNickname)>::call(&point, unwrapInstance(instancePtr), steamIDPlayer);
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendsGroupCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int  result = SteamAPI_ISteamFriends_GetFriendsGroupCount(instancePtr);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendsGroupCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendsGroupCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 FriendsGroupID_t  SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex_(intptr_t  instancePtr, int  iFG)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, iFG);
-  FriendsGroupID_t  result = SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex(instancePtr, iFG);
-  TRACE("() = (FriendsGroupID_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex)>::call(&point, unwrapInstance(instancePtr), iFG);
 }
 
 
 char * SteamAPI_ISteamFriends_GetFriendsGroupName_(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID)
 {
-  TRACE("((intptr_t )%p, (FriendsGroupID_t )%p)\n", instancePtr, friendsGroupID);
-  char * result = SteamAPI_ISteamFriends_GetFriendsGroupName(instancePtr, friendsGroupID);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendsGroupName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendsGroupName)>::call(&point, unwrapInstance(instancePtr), friendsGroupID);
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendsGroupMembersCount_(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID)
 {
-  TRACE("((intptr_t )%p, (FriendsGroupID_t )%p)\n", instancePtr, friendsGroupID);
-  int  result = SteamAPI_ISteamFriends_GetFriendsGroupMembersCount(instancePtr, friendsGroupID);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendsGroupMembersCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendsGroupMembersCount)>::call(&point, unwrapInstance(instancePtr), friendsGroupID);
 }
 
 
 void  SteamAPI_ISteamFriends_GetFriendsGroupMembersList_(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID, CSteamID * pOutSteamIDMembers, int  nMembersCount)
 {
-  TRACE("((intptr_t )%p, (FriendsGroupID_t )%p, (CSteamID *)%p, (int )%d)\n", instancePtr, friendsGroupID, pOutSteamIDMembers, nMembersCount);
-  SteamAPI_ISteamFriends_GetFriendsGroupMembersList(instancePtr, friendsGroupID, pOutSteamIDMembers, nMembersCount);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendsGroupMembersList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendsGroupMembersList)>::call(&point, unwrapInstance(instancePtr), friendsGroupID, pOutSteamIDMembers, nMembersCount);
 }
 
 
 bool  SteamAPI_ISteamFriends_HasFriend_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iFriendFlags)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDFriend, iFriendFlags);
-  bool  result = SteamAPI_ISteamFriends_HasFriend(instancePtr, steamIDFriend, iFriendFlags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_HasFriend");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_HasFriend)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, iFriendFlags);
 }
 
 
 int  SteamAPI_ISteamFriends_GetClanCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int  result = SteamAPI_ISteamFriends_GetClanCount(instancePtr);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint64  SteamAPI_ISteamFriends_GetClanByIndex_(intptr_t  instancePtr, int  iClan)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, iClan);
-  uint64  result = SteamAPI_ISteamFriends_GetClanByIndex(instancePtr, iClan);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanByIndex)>::call(&point, unwrapInstance(instancePtr), iClan);
 }
 
 
 char * SteamAPI_ISteamFriends_GetClanName_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  char * result = SteamAPI_ISteamFriends_GetClanName(instancePtr, steamIDClan);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanName)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 char * SteamAPI_ISteamFriends_GetClanTag_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  char * result = SteamAPI_ISteamFriends_GetClanTag(instancePtr, steamIDClan);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanTag");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanTag)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 bool  SteamAPI_ISteamFriends_GetClanActivityCounts_(intptr_t  instancePtr, CSteamID  steamIDClan, int * pnOnline, int * pnInGame, int * pnChatting)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int *)%d, (int *)%d, (int *)%d)\n", instancePtr, steamIDClan, pnOnline, pnInGame, pnChatting);
-  bool  result = SteamAPI_ISteamFriends_GetClanActivityCounts(instancePtr, steamIDClan, pnOnline, pnInGame, pnChatting);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanActivityCounts");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanActivityCounts)>::call(&point, unwrapInstance(instancePtr), steamIDClan, pnOnline, pnInGame, pnChatting);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamFriends_DownloadClanActivityCounts_(intptr_t  instancePtr, CSteamID * psteamIDClans, int  cClansToRequest)
 {
-  TRACE("((intptr_t )%p, (CSteamID *)%p, (int )%d)\n", instancePtr, psteamIDClans, cClansToRequest);
-  SteamAPICall_t  result = SteamAPI_ISteamFriends_DownloadClanActivityCounts(instancePtr, psteamIDClans, cClansToRequest);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_DownloadClanActivityCounts");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_DownloadClanActivityCounts)>::call(&point, unwrapInstance(instancePtr), psteamIDClans, cClansToRequest);
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendCountFromSource_(intptr_t  instancePtr, CSteamID  steamIDSource)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDSource);
-  int  result = SteamAPI_ISteamFriends_GetFriendCountFromSource(instancePtr, steamIDSource);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendCountFromSource");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendCountFromSource)>::call(&point, unwrapInstance(instancePtr), steamIDSource);
 }
 
 
 uint64  SteamAPI_ISteamFriends_GetFriendFromSourceByIndex_(intptr_t  instancePtr, CSteamID  steamIDSource, int  iFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDSource, iFriend);
-  uint64  result = SteamAPI_ISteamFriends_GetFriendFromSourceByIndex(instancePtr, steamIDSource, iFriend);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendFromSourceByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendFromSourceByIndex)>::call(&point, unwrapInstance(instancePtr), steamIDSource, iFriend);
 }
 
 
 bool  SteamAPI_ISteamFriends_IsUserInSource_(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDSource)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (CSteamID )%p)\n", instancePtr, steamIDUser, steamIDSource);
-  bool  result = SteamAPI_ISteamFriends_IsUserInSource(instancePtr, steamIDUser, steamIDSource);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_IsUserInSource");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_IsUserInSource)>::call(&point, unwrapInstance(instancePtr), steamIDUser, steamIDSource);
 }
 
 
 void  SteamAPI_ISteamFriends_SetInGameVoiceSpeaking_(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bSpeaking)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (bool )%d)\n", instancePtr, steamIDUser, bSpeaking);
-  SteamAPI_ISteamFriends_SetInGameVoiceSpeaking(instancePtr, steamIDUser, bSpeaking);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_SetInGameVoiceSpeaking");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_SetInGameVoiceSpeaking)>::call(&point, unwrapInstance(instancePtr), steamIDUser, bSpeaking);
 }
 
 
 void  SteamAPI_ISteamFriends_ActivateGameOverlay_(intptr_t  instancePtr, char * pchDialog)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchDialog);
-  SteamAPI_ISteamFriends_ActivateGameOverlay(instancePtr, pchDialog);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_ActivateGameOverlay");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_ActivateGameOverlay)>::call(&point, unwrapInstance(instancePtr), pchDialog);
 }
 
 
 void  SteamAPI_ISteamFriends_ActivateGameOverlayToUser_(intptr_t  instancePtr, char * pchDialog, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (CSteamID )%p)\n", instancePtr, pchDialog, steamID);
-  SteamAPI_ISteamFriends_ActivateGameOverlayToUser(instancePtr, pchDialog, steamID);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_ActivateGameOverlayToUser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_ActivateGameOverlayToUser)>::call(&point, unwrapInstance(instancePtr), pchDialog, steamID);
 }
 
 
 void  SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage_(intptr_t  instancePtr, char * pchURL)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchURL);
-  SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage(instancePtr, pchURL);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage)>::call(&point, unwrapInstance(instancePtr), pchURL);
 }
 
 
 void  SteamAPI_ISteamFriends_ActivateGameOverlayToStore_(intptr_t  instancePtr, AppId_t  nAppID, EOverlayToStoreFlag  eFlag)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (EOverlayToStoreFlag )%p)\n", instancePtr, nAppID, eFlag);
-  SteamAPI_ISteamFriends_ActivateGameOverlayToStore(instancePtr, nAppID, eFlag);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_ActivateGameOverlayToStore");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_ActivateGameOverlayToStore)>::call(&point, unwrapInstance(instancePtr), nAppID, eFlag);
 }
 
 
 void  SteamAPI_ISteamFriends_SetPlayedWith_(intptr_t  instancePtr, CSteamID  steamIDUserPlayedWith)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDUserPlayedWith);
-  SteamAPI_ISteamFriends_SetPlayedWith(instancePtr, steamIDUserPlayedWith);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_SetPlayedWith");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_SetPlayedWith)>::call(&point, unwrapInstance(instancePtr), steamIDUserPlayedWith);
 }
 
 
 void  SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog(instancePtr, steamIDLobby);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 int  SteamAPI_ISteamFriends_GetSmallFriendAvatar_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  int  result = SteamAPI_ISteamFriends_GetSmallFriendAvatar(instancePtr, steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetSmallFriendAvatar");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetSmallFriendAvatar)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 int  SteamAPI_ISteamFriends_GetMediumFriendAvatar_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  int  result = SteamAPI_ISteamFriends_GetMediumFriendAvatar(instancePtr, steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetMediumFriendAvatar");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetMediumFriendAvatar)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 int  SteamAPI_ISteamFriends_GetLargeFriendAvatar_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  int  result = SteamAPI_ISteamFriends_GetLargeFriendAvatar(instancePtr, steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetLargeFriendAvatar");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetLargeFriendAvatar)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 bool  SteamAPI_ISteamFriends_RequestUserInformation_(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bRequireNameOnly)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (bool )%d)\n", instancePtr, steamIDUser, bRequireNameOnly);
-  bool  result = SteamAPI_ISteamFriends_RequestUserInformation(instancePtr, steamIDUser, bRequireNameOnly);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_RequestUserInformation");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_RequestUserInformation)>::call(&point, unwrapInstance(instancePtr), steamIDUser, bRequireNameOnly);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamFriends_RequestClanOfficerList_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  SteamAPICall_t  result = SteamAPI_ISteamFriends_RequestClanOfficerList(instancePtr, steamIDClan);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_RequestClanOfficerList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_RequestClanOfficerList)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 uint64  SteamAPI_ISteamFriends_GetClanOwner_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  uint64  result = SteamAPI_ISteamFriends_GetClanOwner(instancePtr, steamIDClan);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanOwner");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanOwner)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 int  SteamAPI_ISteamFriends_GetClanOfficerCount_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  int  result = SteamAPI_ISteamFriends_GetClanOfficerCount(instancePtr, steamIDClan);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanOfficerCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanOfficerCount)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 uint64  SteamAPI_ISteamFriends_GetClanOfficerByIndex_(intptr_t  instancePtr, CSteamID  steamIDClan, int  iOfficer)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDClan, iOfficer);
-  uint64  result = SteamAPI_ISteamFriends_GetClanOfficerByIndex(instancePtr, steamIDClan, iOfficer);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanOfficerByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanOfficerByIndex)>::call(&point, unwrapInstance(instancePtr), steamIDClan, iOfficer);
 }
 
 
 uint32  SteamAPI_ISteamFriends_GetUserRestrictions_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamFriends_GetUserRestrictions(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetUserRestrictions");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetUserRestrictions)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamFriends_SetRichPresence_(intptr_t  instancePtr, char * pchKey, char * pchValue)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, pchKey, pchValue);
-  bool  result = SteamAPI_ISteamFriends_SetRichPresence(instancePtr, pchKey, pchValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_SetRichPresence");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_SetRichPresence)>::call(&point, unwrapInstance(instancePtr), pchKey, pchValue);
 }
 
 
 void  SteamAPI_ISteamFriends_ClearRichPresence_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamFriends_ClearRichPresence(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_ClearRichPresence");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_ClearRichPresence)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 char * SteamAPI_ISteamFriends_GetFriendRichPresence_(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchKey)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDFriend, pchKey);
-  char * result = SteamAPI_ISteamFriends_GetFriendRichPresence(instancePtr, steamIDFriend, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendRichPresence");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendRichPresence)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, pchKey);
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  int  result = SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount(instancePtr, steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 char * SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iKey)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDFriend, iKey);
-  char * result = SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex(instancePtr, steamIDFriend, iKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, iKey);
 }
 
 
 void  SteamAPI_ISteamFriends_RequestFriendRichPresence_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  SteamAPI_ISteamFriends_RequestFriendRichPresence(instancePtr, steamIDFriend);
-  
+  static ProfilePoint point("SteamAPI_ISteamFriends_RequestFriendRichPresence");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_RequestFriendRichPresence)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 bool  SteamAPI_ISteamFriends_InviteUserToGame_(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchConnectString)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDFriend, pchConnectString);
-  bool  result = SteamAPI_ISteamFriends_InviteUserToGame(instancePtr, steamIDFriend, pchConnectString);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_InviteUserToGame");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_InviteUserToGame)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, pchConnectString);
 }
 
 
 int  SteamAPI_ISteamFriends_GetCoplayFriendCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int  result = SteamAPI_ISteamFriends_GetCoplayFriendCount(instancePtr);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetCoplayFriendCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetCoplayFriendCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint64  SteamAPI_ISteamFriends_GetCoplayFriend_(intptr_t  instancePtr, int  iCoplayFriend)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, iCoplayFriend);
-  uint64  result = SteamAPI_ISteamFriends_GetCoplayFriend(instancePtr, iCoplayFriend);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetCoplayFriend");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetCoplayFriend)>::call(&point, unwrapInstance(instancePtr), iCoplayFriend);
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendCoplayTime_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  int  result = SteamAPI_ISteamFriends_GetFriendCoplayTime(instancePtr, steamIDFriend);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendCoplayTime");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendCoplayTime)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 AppId_t  SteamAPI_ISteamFriends_GetFriendCoplayGame_(intptr_t  instancePtr, CSteamID  steamIDFriend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDFriend);
-  AppId_t  result = SteamAPI_ISteamFriends_GetFriendCoplayGame(instancePtr, steamIDFriend);
-  TRACE("() = (AppId_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendCoplayGame");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendCoplayGame)>::call(&point, unwrapInstance(instancePtr), steamIDFriend);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamFriends_JoinClanChatRoom_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  SteamAPICall_t  result = SteamAPI_ISteamFriends_JoinClanChatRoom(instancePtr, steamIDClan);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_JoinClanChatRoom");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_JoinClanChatRoom)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 bool  SteamAPI_ISteamFriends_LeaveClanChatRoom_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  bool  result = SteamAPI_ISteamFriends_LeaveClanChatRoom(instancePtr, steamIDClan);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_LeaveClanChatRoom");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_LeaveClanChatRoom)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 int  SteamAPI_ISteamFriends_GetClanChatMemberCount_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  int  result = SteamAPI_ISteamFriends_GetClanChatMemberCount(instancePtr, steamIDClan);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanChatMemberCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanChatMemberCount)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 uint64  SteamAPI_ISteamFriends_GetChatMemberByIndex_(intptr_t  instancePtr, CSteamID  steamIDClan, int  iUser)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDClan, iUser);
-  uint64  result = SteamAPI_ISteamFriends_GetChatMemberByIndex(instancePtr, steamIDClan, iUser);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetChatMemberByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetChatMemberByIndex)>::call(&point, unwrapInstance(instancePtr), steamIDClan, iUser);
 }
 
 
 bool  SteamAPI_ISteamFriends_SendClanChatMessage_(intptr_t  instancePtr, CSteamID  steamIDClanChat, char * pchText)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDClanChat, pchText);
-  bool  result = SteamAPI_ISteamFriends_SendClanChatMessage(instancePtr, steamIDClanChat, pchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_SendClanChatMessage");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_SendClanChatMessage)>::call(&point, unwrapInstance(instancePtr), steamIDClanChat, pchText);
 }
 
 
 int  SteamAPI_ISteamFriends_GetClanChatMessage_(intptr_t  instancePtr, CSteamID  steamIDClanChat, int  iMessage, void * prgchText, int  cchTextMax, EChatEntryType * peChatEntryType, CSteamID * psteamidChatter)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d, (void *)%p, (int )%d, (EChatEntryType *)%p, (CSteamID *)%p)\n", instancePtr, steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter);
-  int  result = SteamAPI_ISteamFriends_GetClanChatMessage(instancePtr, steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetClanChatMessage", "3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetClanChatMessage)>::call(&point, unwrapInstance(instancePtr), steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter);
 }
 
 
 bool  SteamAPI_ISteamFriends_IsClanChatAdmin_(intptr_t  instancePtr, CSteamID  steamIDClanChat, CSteamID  steamIDUser)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (CSteamID )%p)\n", instancePtr, steamIDClanChat, steamIDUser);
-  bool  result = SteamAPI_ISteamFriends_IsClanChatAdmin(instancePtr, steamIDClanChat, steamIDUser);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_IsClanChatAdmin");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_IsClanChatAdmin)>::call(&point, unwrapInstance(instancePtr), steamIDClanChat, steamIDUser);
 }
 
 
 bool  SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam_(intptr_t  instancePtr, CSteamID  steamIDClanChat)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClanChat);
-  bool  result = SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam(instancePtr, steamIDClanChat);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam)>::call(&point, unwrapInstance(instancePtr), steamIDClanChat);
 }
 
 
 bool  SteamAPI_ISteamFriends_OpenClanChatWindowInSteam_(intptr_t  instancePtr, CSteamID  steamIDClanChat)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClanChat);
-  bool  result = SteamAPI_ISteamFriends_OpenClanChatWindowInSteam(instancePtr, steamIDClanChat);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_OpenClanChatWindowInSteam");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_OpenClanChatWindowInSteam)>::call(&point, unwrapInstance(instancePtr), steamIDClanChat);
 }
 
 
 bool  SteamAPI_ISteamFriends_CloseClanChatWindowInSteam_(intptr_t  instancePtr, CSteamID  steamIDClanChat)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClanChat);
-  bool  result = SteamAPI_ISteamFriends_CloseClanChatWindowInSteam(instancePtr, steamIDClanChat);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_CloseClanChatWindowInSteam");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_CloseClanChatWindowInSteam)>::call(&point, unwrapInstance(instancePtr), steamIDClanChat);
 }
 
 
 bool  SteamAPI_ISteamFriends_SetListenForFriendsMessages_(intptr_t  instancePtr, bool  bInterceptEnabled)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bInterceptEnabled);
-  bool  result = SteamAPI_ISteamFriends_SetListenForFriendsMessages(instancePtr, bInterceptEnabled);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_SetListenForFriendsMessages");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_SetListenForFriendsMessages)>::call(&point, unwrapInstance(instancePtr), bInterceptEnabled);
 }
 
 
 bool  SteamAPI_ISteamFriends_ReplyToFriendMessage_(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchMsgToSend)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDFriend, pchMsgToSend);
-  bool  result = SteamAPI_ISteamFriends_ReplyToFriendMessage(instancePtr, steamIDFriend, pchMsgToSend);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_ReplyToFriendMessage");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_ReplyToFriendMessage)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, pchMsgToSend);
 }
 
 
 int  SteamAPI_ISteamFriends_GetFriendMessage_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iMessageID, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d, (void *)%p, (int )%d, (EChatEntryType *)%p)\n", instancePtr, steamIDFriend, iMessageID, pvData, cubData, peChatEntryType);
-  int  result = SteamAPI_ISteamFriends_GetFriendMessage(instancePtr, steamIDFriend, iMessageID, pvData, cubData, peChatEntryType);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFriendMessage", "3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFriendMessage)>::call(&point, unwrapInstance(instancePtr), steamIDFriend, iMessageID, pvData, cubData, peChatEntryType);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamFriends_GetFollowerCount_(intptr_t  instancePtr, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamID);
-  SteamAPICall_t  result = SteamAPI_ISteamFriends_GetFollowerCount(instancePtr, steamID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_GetFollowerCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_GetFollowerCount)>::call(&point, unwrapInstance(instancePtr), steamID);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamFriends_IsFollowing_(intptr_t  instancePtr, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamID);
-  SteamAPICall_t  result = SteamAPI_ISteamFriends_IsFollowing(instancePtr, steamID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_IsFollowing");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_IsFollowing)>::call(&point, unwrapInstance(instancePtr), steamID);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamFriends_EnumerateFollowingList_(intptr_t  instancePtr, uint32  unStartIndex)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d)\n", instancePtr, unStartIndex);
-  SteamAPICall_t  result = SteamAPI_ISteamFriends_EnumerateFollowingList(instancePtr, unStartIndex);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamFriends_EnumerateFollowingList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamFriends_EnumerateFollowingList)>::call(&point, unwrapInstance(instancePtr), unStartIndex);
 }
 
 
 uint32  SteamAPI_ISteamUtils_GetSecondsSinceAppActive_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUtils_GetSecondsSinceAppActive(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetSecondsSinceAppActive");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetSecondsSinceAppActive), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint32  SteamAPI_ISteamUtils_GetSecondsSinceComputerActive_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUtils_GetSecondsSinceComputerActive(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetSecondsSinceComputerActive");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetSecondsSinceComputerActive), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 EUniverse  SteamAPI_ISteamUtils_GetConnectedUniverse_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  EUniverse  result = SteamAPI_ISteamUtils_GetConnectedUniverse(instancePtr);
-  TRACE("() = (EUniverse )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetConnectedUniverse");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetConnectedUniverse), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint32  SteamAPI_ISteamUtils_GetServerRealTime_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUtils_GetServerRealTime(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetServerRealTime");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetServerRealTime), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 char * SteamAPI_ISteamUtils_GetIPCountry_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  char * result = SteamAPI_ISteamUtils_GetIPCountry(instancePtr);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetIPCountry");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetIPCountry), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamUtils_GetImageSize_(intptr_t  instancePtr, int  iImage, uint32 * pnWidth, uint32 * pnHeight)
 {
-  TRACE("((intptr_t )%p, (int )%d, (uint32 *)%d, (uint32 *)%d)\n", instancePtr, iImage, pnWidth, pnHeight);
-  bool  result = SteamAPI_ISteamUtils_GetImageSize(instancePtr, iImage, pnWidth, pnHeight);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetImageSize");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetImageSize), true>::call(&point, unwrapInstance(instancePtr), iImage, pnWidth, pnHeight);
 }
 
 
 bool  SteamAPI_ISteamUtils_GetImageRGBA_(intptr_t  instancePtr, int  iImage, uint8 * pubDest, int  nDestBufferSize)
 {
-  TRACE("((intptr_t )%p, (int )%d, (uint8 *)%p, (int )%d)\n", instancePtr, iImage, pubDest, nDestBufferSize);
-  bool  result = SteamAPI_ISteamUtils_GetImageRGBA(instancePtr, iImage, pubDest, nDestBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetImageRGBA", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetImageRGBA), true>::call(&point, unwrapInstance(instancePtr), iImage, pubDest, nDestBufferSize);
 }
 
 
 bool  SteamAPI_ISteamUtils_GetCSERIPPort_(intptr_t  instancePtr, uint32 * unIP, uint16 * usPort)
 {
-  TRACE("((intptr_t )%p, (uint32 *)%d, (uint16 *)%d)\n", instancePtr, unIP, usPort);
-  bool  result = SteamAPI_ISteamUtils_GetCSERIPPort(instancePtr, unIP, usPort);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetCSERIPPort");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetCSERIPPort), true>::call(&point, unwrapInstance(instancePtr), unIP, usPort);
 }
 
 
 uint8  SteamAPI_ISteamUtils_GetCurrentBatteryPower_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint8  result = SteamAPI_ISteamUtils_GetCurrentBatteryPower(instancePtr);
-  TRACE("() = (uint8 )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetCurrentBatteryPower");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetCurrentBatteryPower), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint32  SteamAPI_ISteamUtils_GetAppID_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUtils_GetAppID(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetAppID");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetAppID), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamUtils_SetOverlayNotificationPosition_(intptr_t  instancePtr, ENotificationPosition  eNotificationPosition)
 {
-  TRACE("((intptr_t )%p, (ENotificationPosition )%p)\n", instancePtr, eNotificationPosition);
-  SteamAPI_ISteamUtils_SetOverlayNotificationPosition(instancePtr, eNotificationPosition);
-  
+  static ProfilePoint point("SteamAPI_ISteamUtils_SetOverlayNotificationPosition");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_SetOverlayNotificationPosition), true>::call(&point, unwrapInstance(instancePtr), eNotificationPosition);
 }
 
 
 bool  SteamAPI_ISteamUtils_IsAPICallCompleted_(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, bool * pbFailed)
 {
-  TRACE("((intptr_t )%p, (SteamAPICall_t )%p, (bool *)%d)\n", instancePtr, hSteamAPICall, pbFailed);
-  bool  result = SteamAPI_ISteamUtils_IsAPICallCompleted(instancePtr, hSteamAPICall, pbFailed);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_IsAPICallCompleted");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_IsAPICallCompleted), true>::call(&point, unwrapInstance(instancePtr), hSteamAPICall, pbFailed);
 }
 
 
 ESteamAPICallFailure  SteamAPI_ISteamUtils_GetAPICallFailureReason_(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall)
 {
-  TRACE("((intptr_t )%p, (SteamAPICall_t )%p)\n", instancePtr, hSteamAPICall);
-  ESteamAPICallFailure  result = SteamAPI_ISteamUtils_GetAPICallFailureReason(instancePtr, hSteamAPICall);
-  TRACE("() = (ESteamAPICallFailure )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetAPICallFailureReason");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetAPICallFailureReason), true>::call(&point, unwrapInstance(instancePtr), hSteamAPICall);
 }
 
 
 bool  SteamAPI_ISteamUtils_GetAPICallResult_(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, void * pCallback, int  cubCallback, int  iCallbackExpected, bool * pbFailed)
 {
-  TRACE("((intptr_t )%p, (SteamAPICall_t )%p, (void *)%p, (int )%d, (int )%d, (bool *)%d)\n", instancePtr, hSteamAPICall, pCallback, cubCallback, iCallbackExpected, pbFailed);
-  bool  result = SteamAPI_ISteamUtils_GetAPICallResult(instancePtr, hSteamAPICall, pCallback, cubCallback, iCallbackExpected, pbFailed);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetAPICallResult", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetAPICallResult), true>::call(&point, unwrapInstance(instancePtr), hSteamAPICall, pCallback, cubCallback, iCallbackExpected, pbFailed);
 }
 
 
 uint32  SteamAPI_ISteamUtils_GetIPCCallCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUtils_GetIPCCallCount(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetIPCCallCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetIPCCallCount), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamUtils_SetWarningMessageHook_(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction)
 {
-  TRACE("((intptr_t )%p, (SteamAPIWarningMessageHook_t )%p)\n", instancePtr, pFunction);
-  SteamAPI_ISteamUtils_SetWarningMessageHook(instancePtr, pFunction);
-  
+  static ProfilePoint point("SteamAPI_ISteamUtils_SetWarningMessageHook");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_SetWarningMessageHook), true>::call(&point, unwrapInstance(instancePtr), pFunction);
 }
 
 
 bool  SteamAPI_ISteamUtils_IsOverlayEnabled_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamUtils_IsOverlayEnabled(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_IsOverlayEnabled");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_IsOverlayEnabled), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamUtils_BOverlayNeedsPresent_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamUtils_BOverlayNeedsPresent(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
-}
+  static ProfilePoint point("SteamAPI_ISteamUtils_BOverlayNeedsPresent");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_BOverlayNeedsPresent), true>::call(&point, unwrapInstance(instancePtr));
+}
 
 
 SteamAPICall_t  SteamAPI_ISteamUtils_CheckFileSignature_(intptr_t  instancePtr, char * szFileName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, szFileName);
-  SteamAPICall_t  result = SteamAPI_ISteamUtils_CheckFileSignature(instancePtr, szFileName);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_CheckFileSignature");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_CheckFileSignature), true>::call(&point, unwrapInstance(instancePtr), szFileName);
 }
 
 
 bool  SteamAPI_ISteamUtils_ShowGamepadTextInput_(intptr_t  instancePtr, EGamepadTextInputMode  eInputMode, EGamepadTextInputLineMode  eLineInputMode, char * pchDescription, uint32  unCharMax, char * pchExistingText)
 {
-  TRACE("((intptr_t )%p, (EGamepadTextInputMode )%p, (EGamepadTextInputLineMode )%p, (char *)\"%s\", (uint32 )%d, (char *)\"%s\")\n", instancePtr, eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText);
-  bool  result = SteamAPI_ISteamUtils_ShowGamepadTextInput(instancePtr, eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_ShowGamepadTextInput");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_ShowGamepadTextInput), true>::call(&point, unwrapInstance(instancePtr), eInputMode, eLineInputMode, pchDescription, unCharMax, pchExistingText);
 }
 
 
 uint32  SteamAPI_ISteamUtils_GetEnteredGamepadTextLength_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUtils_GetEnteredGamepadTextLength(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetEnteredGamepadTextLength");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetEnteredGamepadTextLength), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamUtils_GetEnteredGamepadTextInput_(intptr_t  instancePtr, char * pchText, uint32  cchText)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (uint32 )%d)\n", instancePtr, pchText, cchText);
-  bool  result = SteamAPI_ISteamUtils_GetEnteredGamepadTextInput(instancePtr, pchText, cchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetEnteredGamepadTextInput", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetEnteredGamepadTextInput), true>::call(&point, unwrapInstance(instancePtr), pchText, cchText);
 }
 
 
 char * SteamAPI_ISteamUtils_GetSteamUILanguage_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  char * result = SteamAPI_ISteamUtils_GetSteamUILanguage(instancePtr);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_GetSteamUILanguage");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_GetSteamUILanguage), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamUtils_IsSteamRunningInVR_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamUtils_IsSteamRunningInVR(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUtils_IsSteamRunningInVR");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUtils_IsSteamRunningInVR), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 int  SteamAPI_ISteamMatchmaking_GetFavoriteGameCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int  result = SteamAPI_ISteamMatchmaking_GetFavoriteGameCount(instancePtr);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetFavoriteGameCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetFavoriteGameCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_GetFavoriteGame_(intptr_t  instancePtr, int  iGame, AppId_t * pnAppID, uint32 * pnIP, uint16 * pnConnPort, uint16 * pnQueryPort, uint32 * punFlags, uint32 * pRTime32LastPlayedOnServer)
 {
-  TRACE("((intptr_t )%p, (int )%d, (AppId_t *)%p, (uint32 *)%d, (uint16 *)%d, (uint16 *)%d, (uint32 *)%d, (uint32 *)%d)\n", instancePtr, iGame, pnAppID, pnIP, pnConnPort, pnQueryPort, punFlags, pRTime32LastPlayedOnServer);
-  bool  result = SteamAPI_ISteamMatchmaking_GetFavoriteGame(instancePtr, iGame, pnAppID, pnIP, pnConnPort, pnQueryPort, punFlags, pRTime32LastPlayedOnServer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetFavoriteGame");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetFavoriteGame)>::call(&point, unwrapInstance(instancePtr), iGame, pnAppID, pnIP, pnConnPort, pnQueryPort, punFlags, pRTime32LastPlayedOnServer);
 }
 
 
 int  SteamAPI_ISteamMatchmaking_AddFavoriteGame_(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags, uint32  rTime32LastPlayedOnServer)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (uint32 )%d, (uint16 )%d, (uint16 )%d, (uint32 )%d, (uint32 )%d)\n", instancePtr, nAppID, nIP, nConnPort, nQueryPort, unFlags, rTime32LastPlayedOnServer);
-  int  result = SteamAPI_ISteamMatchmaking_AddFavoriteGame(instancePtr, nAppID, nIP, nConnPort, nQueryPort, unFlags, rTime32LastPlayedOnServer);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddFavoriteGame");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddFavoriteGame)>::call(&point, unwrapInstance(instancePtr), nAppID, nIP, nConnPort, nQueryPort, unFlags, rTime32LastPlayedOnServer);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_RemoveFavoriteGame_(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (uint32 )%d, (uint16 )%d, (uint16 )%d, (uint32 )%d)\n", instancePtr, nAppID, nIP, nConnPort, nQueryPort, unFlags);
-  bool  result = SteamAPI_ISteamMatchmaking_RemoveFavoriteGame(instancePtr, nAppID, nIP, nConnPort, nQueryPort, unFlags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_RemoveFavoriteGame");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_RemoveFavoriteGame)>::call(&point, unwrapInstance(instancePtr), nAppID, nIP, nConnPort, nQueryPort, unFlags);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamMatchmaking_RequestLobbyList_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPICall_t  result = SteamAPI_ISteamMatchmaking_RequestLobbyList(instancePtr);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_RequestLobbyList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_RequestLobbyList)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter_(intptr_t  instancePtr, char * pchKeyToMatch, char * pchValueToMatch, ELobbyComparison  eComparisonType)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\", (ELobbyComparison )%p)\n", instancePtr, pchKeyToMatch, pchValueToMatch, eComparisonType);
-  SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter(instancePtr, pchKeyToMatch, pchValueToMatch, eComparisonType);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter)>::call(&point, unwrapInstance(instancePtr), pchKeyToMatch, pchValueToMatch, eComparisonType);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter_(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToMatch, ELobbyComparison  eComparisonType)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int )%d, (ELobbyComparison )%p)\n", instancePtr, pchKeyToMatch, nValueToMatch, eComparisonType);
-  SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter(instancePtr, pchKeyToMatch, nValueToMatch, eComparisonType);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter)>::call(&point, unwrapInstance(instancePtr), pchKeyToMatch, nValueToMatch, eComparisonType);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter_(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToBeCloseTo)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int )%d)\n", instancePtr, pchKeyToMatch, nValueToBeCloseTo);
-  SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter(instancePtr, pchKeyToMatch, nValueToBeCloseTo);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter)>::call(&point, unwrapInstance(instancePtr), pchKeyToMatch, nValueToBeCloseTo);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable_(intptr_t  instancePtr, int  nSlotsAvailable)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, nSlotsAvailable);
-  SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable(instancePtr, nSlotsAvailable);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable)>::call(&point, unwrapInstance(instancePtr), nSlotsAvailable);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter_(intptr_t  instancePtr, ELobbyDistanceFilter  eLobbyDistanceFilter)
 {
-  TRACE("((intptr_t )%p, (ELobbyDistanceFilter )%p)\n", instancePtr, eLobbyDistanceFilter);
-  SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter(instancePtr, eLobbyDistanceFilter);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter)>::call(&point, unwrapInstance(instancePtr), eLobbyDistanceFilter);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter_(intptr_t  instancePtr, int  cMaxResults)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, cMaxResults);
-  SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter(instancePtr, cMaxResults);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter)>::call(&point, unwrapInstance(instancePtr), cMaxResults);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter(instancePtr, steamIDLobby);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 uint64  SteamAPI_ISteamMatchmaking_GetLobbyByIndex_(intptr_t  instancePtr, int  iLobby)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, iLobby);
-  uint64  result = SteamAPI_ISteamMatchmaking_GetLobbyByIndex(instancePtr, iLobby);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyByIndex)>::call(&point, unwrapInstance(instancePtr), iLobby);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamMatchmaking_CreateLobby_(intptr_t  instancePtr, ELobbyType  eLobbyType, int  cMaxMembers)
 {
-  TRACE("((intptr_t )%p, (ELobbyType )%p, (int )%d)\n", instancePtr, eLobbyType, cMaxMembers);
-  SteamAPICall_t  result = SteamAPI_ISteamMatchmaking_CreateLobby(instancePtr, eLobbyType, cMaxMembers);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_CreateLobby");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_CreateLobby)>::call(&point, unwrapInstance(instancePtr), eLobbyType, cMaxMembers);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamMatchmaking_JoinLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  SteamAPICall_t  result = SteamAPI_ISteamMatchmaking_JoinLobby(instancePtr, steamIDLobby);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_JoinLobby");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_JoinLobby)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_LeaveLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  SteamAPI_ISteamMatchmaking_LeaveLobby(instancePtr, steamIDLobby);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_LeaveLobby");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_LeaveLobby)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_InviteUserToLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDInvitee)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby, steamIDInvitee);
-  bool  result = SteamAPI_ISteamMatchmaking_InviteUserToLobby(instancePtr, steamIDLobby, steamIDInvitee);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_InviteUserToLobby");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_InviteUserToLobby)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, steamIDInvitee);
 }
 
 
 int  SteamAPI_ISteamMatchmaking_GetNumLobbyMembers_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  int  result = SteamAPI_ISteamMatchmaking_GetNumLobbyMembers(instancePtr, steamIDLobby);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetNumLobbyMembers");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetNumLobbyMembers)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 uint64  SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iMember)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDLobby, iMember);
-  uint64  result = SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex(instancePtr, steamIDLobby, iMember);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, iMember);
 }
 
 
 char * SteamAPI_ISteamMatchmaking_GetLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDLobby, pchKey);
-  char * result = SteamAPI_ISteamMatchmaking_GetLobbyData(instancePtr, steamIDLobby, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyData)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, pchKey);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_SetLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, steamIDLobby, pchKey, pchValue);
-  bool  result = SteamAPI_ISteamMatchmaking_SetLobbyData(instancePtr, steamIDLobby, pchKey, pchValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLobbyData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLobbyData)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, pchKey, pchValue);
 }
 
 
 int  SteamAPI_ISteamMatchmaking_GetLobbyDataCount_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  int  result = SteamAPI_ISteamMatchmaking_GetLobbyDataCount(instancePtr, steamIDLobby);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyDataCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyDataCount)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iLobbyData, char * pchKey, int  cchKeyBufferSize, char * pchValue, int  cchValueBufferSize)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d, (char *)\"%s\", (int )%d, (char *)\"%s\", (int )%d)\n", instancePtr, steamIDLobby, iLobbyData, pchKey, cchKeyBufferSize, pchValue, cchValueBufferSize);
-  bool  result = SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex(instancePtr, steamIDLobby, iLobbyData, pchKey, cchKeyBufferSize, pchValue, cchValueBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex", "3:4 5:6");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, iLobbyData, pchKey, cchKeyBufferSize, pchValue, cchValueBufferSize);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_DeleteLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDLobby, pchKey);
-  bool  result = SteamAPI_ISteamMatchmaking_DeleteLobbyData(instancePtr, steamIDLobby, pchKey);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_DeleteLobbyData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_DeleteLobbyData)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, pchKey);
 }
 
 
 char * SteamAPI_ISteamMatchmaking_GetLobbyMemberData_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDUser, char * pchKey)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDLobby, steamIDUser, pchKey);
-  char * result = SteamAPI_ISteamMatchmaking_GetLobbyMemberData(instancePtr, steamIDLobby, steamIDUser, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyMemberData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyMemberData)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, steamIDUser, pchKey);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_SetLobbyMemberData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, steamIDLobby, pchKey, pchValue);
-  SteamAPI_ISteamMatchmaking_SetLobbyMemberData(instancePtr, steamIDLobby, pchKey, pchValue);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLobbyMemberData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLobbyMemberData)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, pchKey, pchValue);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_SendLobbyChatMsg_(intptr_t  instancePtr, CSteamID  steamIDLobby, void * pvMsgBody, int  cubMsgBody)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (void *)%p, (int )%d)\n", instancePtr, steamIDLobby, pvMsgBody, cubMsgBody);
-  bool  result = SteamAPI_ISteamMatchmaking_SendLobbyChatMsg(instancePtr, steamIDLobby, pvMsgBody, cubMsgBody);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SendLobbyChatMsg", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SendLobbyChatMsg)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, pvMsgBody, cubMsgBody);
 }
 
 
 int  SteamAPI_ISteamMatchmaking_GetLobbyChatEntry_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iChatID, CSteamID * pSteamIDUser, void * pvData, int  cubData, EChatEntryType * peChatEntryType)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d, (CSteamID *)%p, (void *)%p, (int )%d, (EChatEntryType *)%p)\n", instancePtr, steamIDLobby, iChatID, pSteamIDUser, pvData, cubData, peChatEntryType);
-  int  result = SteamAPI_ISteamMatchmaking_GetLobbyChatEntry(instancePtr, steamIDLobby, iChatID, pSteamIDUser, pvData, cubData, peChatEntryType);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyChatEntry", "4:5");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyChatEntry)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, iChatID, pSteamIDUser, pvData, cubData, peChatEntryType);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_RequestLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  bool  result = SteamAPI_ISteamMatchmaking_RequestLobbyData(instancePtr, steamIDLobby);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_RequestLobbyData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_RequestLobbyData)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 void  SteamAPI_ISteamMatchmaking_SetLobbyGameServer_(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32  unGameServerIP, uint16  unGameServerPort, CSteamID  steamIDGameServer)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (uint32 )%d, (uint16 )%d, (CSteamID )%p)\n", instancePtr, steamIDLobby, unGameServerIP, unGameServerPort, steamIDGameServer);
-  SteamAPI_ISteamMatchmaking_SetLobbyGameServer(instancePtr, steamIDLobby, unGameServerIP, unGameServerPort, steamIDGameServer);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLobbyGameServer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLobbyGameServer)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, unGameServerIP, unGameServerPort, steamIDGameServer);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_GetLobbyGameServer_(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32 * punGameServerIP, uint16 * punGameServerPort, CSteamID * psteamIDGameServer)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (uint32 *)%d, (uint16 *)%d, (CSteamID *)%p)\n", instancePtr, steamIDLobby, punGameServerIP, punGameServerPort, psteamIDGameServer);
-  bool  result = SteamAPI_ISteamMatchmaking_GetLobbyGameServer(instancePtr, steamIDLobby, punGameServerIP, punGameServerPort, psteamIDGameServer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyGameServer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyGameServer)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, punGameServerIP, punGameServerPort, psteamIDGameServer);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  cMaxMembers)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDLobby, cMaxMembers);
-  bool  result = SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit(instancePtr, steamIDLobby, cMaxMembers);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, cMaxMembers);
 }
 
 
 int  SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  int  result = SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit(instancePtr, steamIDLobby);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_SetLobbyType_(intptr_t  instancePtr, CSteamID  steamIDLobby, ELobbyType  eLobbyType)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (ELobbyType )%p)\n", instancePtr, steamIDLobby, eLobbyType);
-  bool  result = SteamAPI_ISteamMatchmaking_SetLobbyType(instancePtr, steamIDLobby, eLobbyType);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLobbyType");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLobbyType)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, eLobbyType);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_SetLobbyJoinable_(intptr_t  instancePtr, CSteamID  steamIDLobby, bool  bLobbyJoinable)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (bool )%d)\n", instancePtr, steamIDLobby, bLobbyJoinable);
-  bool  result = SteamAPI_ISteamMatchmaking_SetLobbyJoinable(instancePtr, steamIDLobby, bLobbyJoinable);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLobbyJoinable");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLobbyJoinable)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, bLobbyJoinable);
 }
 
 
 uint64  SteamAPI_ISteamMatchmaking_GetLobbyOwner_(intptr_t  instancePtr, CSteamID  steamIDLobby)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby);
-  uint64  result = SteamAPI_ISteamMatchmaking_GetLobbyOwner(instancePtr, steamIDLobby);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_GetLobbyOwner");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_GetLobbyOwner)>::call(&point, unwrapInstance(instancePtr), steamIDLobby);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_SetLobbyOwner_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDNewOwner)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby, steamIDNewOwner);
-  bool  result = SteamAPI_ISteamMatchmaking_SetLobbyOwner(instancePtr, steamIDLobby, steamIDNewOwner);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLobbyOwner");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLobbyOwner)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, steamIDNewOwner);
 }
 
 
 bool  SteamAPI_ISteamMatchmaking_SetLinkedLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDLobbyDependent)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (CSteamID )%p)\n", instancePtr, steamIDLobby, steamIDLobbyDependent);
-  bool  result = SteamAPI_ISteamMatchmaking_SetLinkedLobby(instancePtr, steamIDLobby, steamIDLobbyDependent);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmaking_SetLinkedLobby");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmaking_SetLinkedLobby)>::call(&point, unwrapInstance(instancePtr), steamIDLobby, steamIDLobbyDependent);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p, (int )%d)\n", instancePtr, hRequest, iServer);
-  SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded(instancePtr, hRequest, iServer);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded)>::call(&point, unwrapInstance(instancePtr), hRequest, iServer);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p, (int )%d)\n", instancePtr, hRequest, iServer);
-  SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond(instancePtr, hRequest, iServer);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond)>::call(&point, unwrapInstance(instancePtr), hRequest, iServer);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete_(intptr_t  instancePtr, HServerListRequest  hRequest, EMatchMakingServerResponse  response)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p, (EMatchMakingServerResponse )%p)\n", instancePtr, hRequest, response);
-  SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete(instancePtr, hRequest, response);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete)>::call(&point, unwrapInstance(instancePtr), hRequest, response);
 }
 
 
 void  SteamAPI_ISteamMatchmakingPingResponse_ServerResponded_(intptr_t  instancePtr, gameserveritem_t & server)
 {
-  TRACE("((intptr_t )%p, (gameserveritem_t &)%p)\n", instancePtr, server);
-  SteamAPI_ISteamMatchmakingPingResponse_ServerResponded(instancePtr, server);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingPingResponse_ServerResponded");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingPingResponse_ServerResponded)>::call(&point, unwrapInstance(instancePtr), server);
 }
 
 
 void  SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList_(intptr_t  instancePtr, char * pchName, int  nScore, float  flTimePlayed)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int )%d, (float )%f)\n", instancePtr, pchName, nScore, flTimePlayed);
-  SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList(instancePtr, pchName, nScore, flTimePlayed);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList)>::call(&point, unwrapInstance(instancePtr), pchName, nScore, flTimePlayed);
 }
 
 
 void  SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded_(intptr_t  instancePtr, char * pchRule, char * pchValue)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, pchRule, pchValue);
-  SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded(instancePtr, pchRule, pchValue);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded)>::call(&point, unwrapInstance(instancePtr), pchRule, pchValue);
 }
 
 
 void  SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestInternetServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = SteamAPI_ISteamMatchmakingServers_RequestInternetServerList(instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RequestInternetServerList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RequestInternetServerList)>::call(&point, unwrapInstance(instancePtr), iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestLANServerList_(intptr_t  instancePtr, AppId_t  iApp, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (ISteamMatchmakingServerListResponse *)%p)\n", instancePtr, iApp, pRequestServersResponse);
-  HServerListRequest  result = SteamAPI_ISteamMatchmakingServers_RequestLANServerList(instancePtr, iApp, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RequestLANServerList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RequestLANServerList)>::call(&point, unwrapInstance(instancePtr), iApp, pRequestServersResponse);
 }
 
 
 HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList(instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList)>::call(&point, unwrapInstance(instancePtr), iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList(instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList)>::call(&point, unwrapInstance(instancePtr), iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList(instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList)>::call(&point, unwrapInstance(instancePtr), iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (MatchMakingKeyValuePair_t **)%p, (uint32 )%d, (ISteamMatchmakingServerListResponse *)%p)\n", instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  HServerListRequest  result = SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList(instancePtr, iApp, ppchFilters, nFilters, pRequestServersResponse);
-  TRACE("() = (HServerListRequest )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList)>::call(&point, unwrapInstance(instancePtr), iApp, ppchFilters, nFilters, pRequestServersResponse);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServers_ReleaseRequest_(intptr_t  instancePtr, HServerListRequest  hServerListRequest)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p)\n", instancePtr, hServerListRequest);
-  SteamAPI_ISteamMatchmakingServers_ReleaseRequest(instancePtr, hServerListRequest);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_ReleaseRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_ReleaseRequest)>::call(&point, unwrapInstance(instancePtr), hServerListRequest);
 }
 
 
 gameserveritem_t * SteamAPI_ISteamMatchmakingServers_GetServerDetails_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p, (int )%d)\n", instancePtr, hRequest, iServer);
-  gameserveritem_t * result = SteamAPI_ISteamMatchmakingServers_GetServerDetails(instancePtr, hRequest, iServer);
-  TRACE("() = (gameserveritem_t *)%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_GetServerDetails");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_GetServerDetails)>::call(&point, unwrapInstance(instancePtr), hRequest, iServer);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServers_CancelQuery_(intptr_t  instancePtr, HServerListRequest  hRequest)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p)\n", instancePtr, hRequest);
-  SteamAPI_ISteamMatchmakingServers_CancelQuery(instancePtr, hRequest);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_CancelQuery");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_CancelQuery)>::call(&point, unwrapInstance(instancePtr), hRequest);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServers_RefreshQuery_(intptr_t  instancePtr, HServerListRequest  hRequest)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p)\n", instancePtr, hRequest);
-  SteamAPI_ISteamMatchmakingServers_RefreshQuery(instancePtr, hRequest);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RefreshQuery");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RefreshQuery)>::call(&point, unwrapInstance(instancePtr), hRequest);
 }
 
 
 bool  SteamAPI_ISteamMatchmakingServers_IsRefreshing_(intptr_t  instancePtr, HServerListRequest  hRequest)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p)\n", instancePtr, hRequest);
-  bool  result = SteamAPI_ISteamMatchmakingServers_IsRefreshing(instancePtr, hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_IsRefreshing");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_IsRefreshing)>::call(&point, unwrapInstance(instancePtr), hRequest);
 }
 
 
 int  SteamAPI_ISteamMatchmakingServers_GetServerCount_(intptr_t  instancePtr, HServerListRequest  hRequest)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p)\n", instancePtr, hRequest);
-  int  result = SteamAPI_ISteamMatchmakingServers_GetServerCount(instancePtr, hRequest);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_GetServerCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_GetServerCount)>::call(&point, unwrapInstance(instancePtr), hRequest);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServers_RefreshServer_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer)
 {
-  TRACE("((intptr_t )%p, (HServerListRequest )%p, (int )%d)\n", instancePtr, hRequest, iServer);
-  SteamAPI_ISteamMatchmakingServers_RefreshServer(instancePtr, hRequest, iServer);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_RefreshServer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_RefreshServer)>::call(&point, unwrapInstance(instancePtr), hRequest, iServer);
 }
 
 
 HServerQuery  SteamAPI_ISteamMatchmakingServers_PingServer_(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPingResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (uint16 )%d, (ISteamMatchmakingPingResponse *)%p)\n", instancePtr, unIP, usPort, pRequestServersResponse);
-  HServerQuery  result = SteamAPI_ISteamMatchmakingServers_PingServer(instancePtr, unIP, usPort, pRequestServersResponse);
-  TRACE("() = (HServerQuery )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_PingServer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_PingServer)>::call(&point, unwrapInstance(instancePtr), unIP, usPort, pRequestServersResponse);
 }
 
 
 HServerQuery  SteamAPI_ISteamMatchmakingServers_PlayerDetails_(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPlayersResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (uint16 )%d, (ISteamMatchmakingPlayersResponse *)%p)\n", instancePtr, unIP, usPort, pRequestServersResponse);
-  HServerQuery  result = SteamAPI_ISteamMatchmakingServers_PlayerDetails(instancePtr, unIP, usPort, pRequestServersResponse);
-  TRACE("() = (HServerQuery )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_PlayerDetails");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_PlayerDetails)>::call(&point, unwrapInstance(instancePtr), unIP, usPort, pRequestServersResponse);
 }
 
 
 HServerQuery  SteamAPI_ISteamMatchmakingServers_ServerRules_(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingRulesResponse * pRequestServersResponse)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (uint16 )%d, (ISteamMatchmakingRulesResponse *)%p)\n", instancePtr, unIP, usPort, pRequestServersResponse);
-  HServerQuery  result = SteamAPI_ISteamMatchmakingServers_ServerRules(instancePtr, unIP, usPort, pRequestServersResponse);
-  TRACE("() = (HServerQuery )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_ServerRules");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_ServerRules)>::call(&point, unwrapInstance(instancePtr), unIP, usPort, pRequestServersResponse);
 }
 
 
 void  SteamAPI_ISteamMatchmakingServers_CancelServerQuery_(intptr_t  instancePtr, HServerQuery  hServerQuery)
 {
-  TRACE("((intptr_t )%p, (HServerQuery )%p)\n", instancePtr, hServerQuery);
-  SteamAPI_ISteamMatchmakingServers_CancelServerQuery(instancePtr, hServerQuery);
-  
+  static ProfilePoint point("SteamAPI_ISteamMatchmakingServers_CancelServerQuery");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMatchmakingServers_CancelServerQuery)>::call(&point, unwrapInstance(instancePtr), hServerQuery);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FileWrite_(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (void *)%p, (int32 )%d)\n", instancePtr, pchFile, pvData, cubData);
-  bool  result = SteamAPI_ISteamRemoteStorage_FileWrite(instancePtr, pchFile, pvData, cubData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileWrite", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileWrite)>::call(&point, unwrapInstance(instancePtr), pchFile, pvData, cubData);
 }
 
 
 int32  SteamAPI_ISteamRemoteStorage_FileRead_(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubDataToRead)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (void *)%p, (int32 )%d)\n", instancePtr, pchFile, pvData, cubDataToRead);
-  int32  result = SteamAPI_ISteamRemoteStorage_FileRead(instancePtr, pchFile, pvData, cubDataToRead);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileRead", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileRead)>::call(&point, unwrapInstance(instancePtr), pchFile, pvData, cubDataToRead);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FileForget_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  bool  result = SteamAPI_ISteamRemoteStorage_FileForget(instancePtr, pchFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileForget");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileForget)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FileDelete_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  bool  result = SteamAPI_ISteamRemoteStorage_FileDelete(instancePtr, pchFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileDelete");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileDelete)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_FileShare_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_FileShare(instancePtr, pchFile);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileShare");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileShare)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_SetSyncPlatforms_(intptr_t  instancePtr, char * pchFile, ERemoteStoragePlatform  eRemoteStoragePlatform)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (ERemoteStoragePlatform )%p)\n", instancePtr, pchFile, eRemoteStoragePlatform);
-  bool  result = SteamAPI_ISteamRemoteStorage_SetSyncPlatforms(instancePtr, pchFile, eRemoteStoragePlatform);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_SetSyncPlatforms");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_SetSyncPlatforms)>::call(&point, unwrapInstance(instancePtr), pchFile, eRemoteStoragePlatform);
 }
 
 
 UGCFileWriteStreamHandle_t  SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  UGCFileWriteStreamHandle_t  result = SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen(instancePtr, pchFile);
-  TRACE("() = (UGCFileWriteStreamHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk_(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle, void * pvData, int32  cubData)
 {
-  TRACE("((intptr_t )%p, (UGCFileWriteStreamHandle_t )%p, (void *)%p, (int32 )%d)\n", instancePtr, writeHandle, pvData, cubData);
-  bool  result = SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk(instancePtr, writeHandle, pvData, cubData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk)>::call(&point, unwrapInstance(instancePtr), writeHandle, pvData, cubData);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FileWriteStreamClose_(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle)
 {
-  TRACE("((intptr_t )%p, (UGCFileWriteStreamHandle_t )%p)\n", instancePtr, writeHandle);
-  bool  result = SteamAPI_ISteamRemoteStorage_FileWriteStreamClose(instancePtr, writeHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileWriteStreamClose");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileWriteStreamClose)>::call(&point, unwrapInstance(instancePtr), writeHandle);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel_(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle)
 {
-  TRACE("((intptr_t )%p, (UGCFileWriteStreamHandle_t )%p)\n", instancePtr, writeHandle);
-  bool  result = SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel(instancePtr, writeHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel)>::call(&point, unwrapInstance(instancePtr), writeHandle);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FileExists_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  bool  result = SteamAPI_ISteamRemoteStorage_FileExists(instancePtr, pchFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FileExists");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FileExists)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_FilePersisted_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  bool  result = SteamAPI_ISteamRemoteStorage_FilePersisted(instancePtr, pchFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_FilePersisted");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_FilePersisted)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 int32  SteamAPI_ISteamRemoteStorage_GetFileSize_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  int32  result = SteamAPI_ISteamRemoteStorage_GetFileSize(instancePtr, pchFile);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetFileSize");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetFileSize)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 int64  SteamAPI_ISteamRemoteStorage_GetFileTimestamp_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  int64  result = SteamAPI_ISteamRemoteStorage_GetFileTimestamp(instancePtr, pchFile);
-  TRACE("() = (int64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetFileTimestamp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetFileTimestamp)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 ERemoteStoragePlatform  SteamAPI_ISteamRemoteStorage_GetSyncPlatforms_(intptr_t  instancePtr, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchFile);
-  ERemoteStoragePlatform  result = SteamAPI_ISteamRemoteStorage_GetSyncPlatforms(instancePtr, pchFile);
-  TRACE("() = (ERemoteStoragePlatform )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetSyncPlatforms");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetSyncPlatforms)>::call(&point, unwrapInstance(instancePtr), pchFile);
 }
 
 
 int32  SteamAPI_ISteamRemoteStorage_GetFileCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int32  result = SteamAPI_ISteamRemoteStorage_GetFileCount(instancePtr);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetFileCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetFileCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 char * SteamAPI_ISteamRemoteStorage_GetFileNameAndSize_(intptr_t  instancePtr, int  iFile, int32 * pnFileSizeInBytes)
 {
-  TRACE("((intptr_t )%p, (int )%d, (int32 *)%d)\n", instancePtr, iFile, pnFileSizeInBytes);
-  char * result = SteamAPI_ISteamRemoteStorage_GetFileNameAndSize(instancePtr, iFile, pnFileSizeInBytes);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetFileNameAndSize");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetFileNameAndSize)>::call(&point, unwrapInstance(instancePtr), iFile, pnFileSizeInBytes);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_GetQuota_(intptr_t  instancePtr, uint64 * pnTotalBytes, uint64 * puAvailableBytes)
 {
-  TRACE("((intptr_t )%p, (uint64 *)%d, (uint64 *)%d)\n", instancePtr, pnTotalBytes, puAvailableBytes);
-  bool  result = SteamAPI_ISteamRemoteStorage_GetQuota(instancePtr, pnTotalBytes, puAvailableBytes);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetQuota");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetQuota)>::call(&point, unwrapInstance(instancePtr), pnTotalBytes, puAvailableBytes);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp_(intptr_t  instancePtr, bool  bEnabled)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bEnabled);
-  SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp(instancePtr, bEnabled);
-  
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp)>::call(&point, unwrapInstance(instancePtr), bEnabled);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UGCDownload_(intptr_t  instancePtr, UGCHandle_t  hContent, uint32  unPriority)
 {
-  TRACE("((intptr_t )%p, (UGCHandle_t )%p, (uint32 )%d)\n", instancePtr, hContent, unPriority);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_UGCDownload(instancePtr, hContent, unPriority);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UGCDownload");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UGCDownload)>::call(&point, unwrapInstance(instancePtr), hContent, unPriority);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress_(intptr_t  instancePtr, UGCHandle_t  hContent, int32 * pnBytesDownloaded, int32 * pnBytesExpected)
 {
-  TRACE("((intptr_t )%p, (UGCHandle_t )%p, (int32 *)%d, (int32 *)%d)\n", instancePtr, hContent, pnBytesDownloaded, pnBytesExpected);
-  bool  result = SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress(instancePtr, hContent, pnBytesDownloaded, pnBytesExpected);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress)>::call(&point, unwrapInstance(instancePtr), hContent, pnBytesDownloaded, pnBytesExpected);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_GetUGCDetails_(intptr_t  instancePtr, UGCHandle_t  hContent, AppId_t * pnAppID, char ** ppchName, int32 * pnFileSizeInBytes, CSteamID * pSteamIDOwner)
 {
-  TRACE("((intptr_t )%p, (UGCHandle_t )%p, (AppId_t *)%p, (char **)\"%s\", (int32 *)%d, (CSteamID *)%p)\n", instancePtr, hContent, pnAppID, ppchName, pnFileSizeInBytes, pSteamIDOwner);
-  bool  result = SteamAPI_ISteamRemoteStorage_GetUGCDetails(instancePtr, hContent, pnAppID, ppchName, pnFileSizeInBytes, pSteamIDOwner);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetUGCDetails");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetUGCDetails)>::call(&point, unwrapInstance(instancePtr), hContent, pnAppID, ppchName, pnFileSizeInBytes, pSteamIDOwner);
 }
 
 
 int32  SteamAPI_ISteamRemoteStorage_UGCRead_(intptr_t  instancePtr, UGCHandle_t  hContent, void * pvData, int32  cubDataToRead, uint32  cOffset, EUGCReadAction  eAction)
 {
-  TRACE("((intptr_t )%p, (UGCHandle_t )%p, (void *)%p, (int32 )%d, (uint32 )%d, (EUGCReadAction )%p)\n", instancePtr, hContent, pvData, cubDataToRead, cOffset, eAction);
-  int32  result = SteamAPI_ISteamRemoteStorage_UGCRead(instancePtr, hContent, pvData, cubDataToRead, cOffset, eAction);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UGCRead", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UGCRead)>::call(&point, unwrapInstance(instancePtr), hContent, pvData, cubDataToRead, cOffset, eAction);
 }
 
 
 int32  SteamAPI_ISteamRemoteStorage_GetCachedUGCCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int32  result = SteamAPI_ISteamRemoteStorage_GetCachedUGCCount(instancePtr);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetCachedUGCCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetCachedUGCCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 UGCHandle_t  SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle_(intptr_t  instancePtr, int32  iCachedContent)
 {
-  TRACE("((intptr_t )%p, (int32 )%d)\n", instancePtr, iCachedContent);
-  UGCHandle_t  result = SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle(instancePtr, iCachedContent);
-  TRACE("() = (UGCHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle)>::call(&point, unwrapInstance(instancePtr), iCachedContent);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_PublishWorkshopFile_(intptr_t  instancePtr, char * pchFile, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags, EWorkshopFileType  eWorkshopFileType)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\", (AppId_t )%p, (char *)\"%s\", (char *)\"%s\", (ERemoteStoragePublishedFileVisibility )%p, (SteamParamStringArray_t *)%p, (EWorkshopFileType )%p)\n", instancePtr, pchFile, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags, eWorkshopFileType);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_PublishWorkshopFile(instancePtr, pchFile, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags, eWorkshopFileType);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_PublishWorkshopFile");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_PublishWorkshopFile)>::call(&point, unwrapInstance(instancePtr), pchFile, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags, eWorkshopFileType);
 }
 
 
 PublishedFileUpdateHandle_t  SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, unPublishedFileId);
-  PublishedFileUpdateHandle_t  result = SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest(instancePtr, unPublishedFileId);
-  TRACE("() = (PublishedFileUpdateHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchFile)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, updateHandle, pchFile);
-  bool  result = SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile(instancePtr, updateHandle, pchFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile)>::call(&point, unwrapInstance(instancePtr), updateHandle, pchFile);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchPreviewFile)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, updateHandle, pchPreviewFile);
-  bool  result = SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile(instancePtr, updateHandle, pchPreviewFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile)>::call(&point, unwrapInstance(instancePtr), updateHandle, pchPreviewFile);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchTitle)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, updateHandle, pchTitle);
-  bool  result = SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle(instancePtr, updateHandle, pchTitle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle)>::call(&point, unwrapInstance(instancePtr), updateHandle, pchTitle);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchDescription)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, updateHandle, pchDescription);
-  bool  result = SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription(instancePtr, updateHandle, pchDescription);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription)>::call(&point, unwrapInstance(instancePtr), updateHandle, pchDescription);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, ERemoteStoragePublishedFileVisibility  eVisibility)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p, (ERemoteStoragePublishedFileVisibility )%p)\n", instancePtr, updateHandle, eVisibility);
-  bool  result = SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility(instancePtr, updateHandle, eVisibility);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility)>::call(&point, unwrapInstance(instancePtr), updateHandle, eVisibility);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p, (SteamParamStringArray_t *)%p)\n", instancePtr, updateHandle, pTags);
-  bool  result = SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags(instancePtr, updateHandle, pTags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags)>::call(&point, unwrapInstance(instancePtr), updateHandle, pTags);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p)\n", instancePtr, updateHandle);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate(instancePtr, updateHandle);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate)>::call(&point, unwrapInstance(instancePtr), updateHandle);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, uint32  unMaxSecondsOld)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p, (uint32 )%d)\n", instancePtr, unPublishedFileId, unMaxSecondsOld);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails(instancePtr, unPublishedFileId, unMaxSecondsOld);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId, unMaxSecondsOld);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_DeletePublishedFile_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, unPublishedFileId);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_DeletePublishedFile(instancePtr, unPublishedFileId);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_DeletePublishedFile");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_DeletePublishedFile)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles_(intptr_t  instancePtr, uint32  unStartIndex)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d)\n", instancePtr, unStartIndex);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles(instancePtr, unStartIndex);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles)>::call(&point, unwrapInstance(instancePtr), unStartIndex);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_SubscribePublishedFile_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, unPublishedFileId);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_SubscribePublishedFile(instancePtr, unPublishedFileId);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_SubscribePublishedFile");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_SubscribePublishedFile)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles_(intptr_t  instancePtr, uint32  unStartIndex)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d)\n", instancePtr, unStartIndex);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles(instancePtr, unStartIndex);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles)>::call(&point, unwrapInstance(instancePtr), unStartIndex);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, unPublishedFileId);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile(instancePtr, unPublishedFileId);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId);
 }
 
 
 bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchChangeDescription)
 {
-  TRACE("((intptr_t )%p, (PublishedFileUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, updateHandle, pchChangeDescription);
-  bool  result = SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription(instancePtr, updateHandle, pchChangeDescription);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription)>::call(&point, unwrapInstance(instancePtr), updateHandle, pchChangeDescription);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, unPublishedFileId);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails(instancePtr, unPublishedFileId);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, bool  bVoteUp)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p, (bool )%d)\n", instancePtr, unPublishedFileId, bVoteUp);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote(instancePtr, unPublishedFileId, bVoteUp);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId, bVoteUp);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, unPublishedFileId);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails(instancePtr, unPublishedFileId);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles_(intptr_t  instancePtr, CSteamID  steamId, uint32  unStartIndex, SteamParamStringArray_t * pRequiredTags, SteamParamStringArray_t * pExcludedTags)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (uint32 )%d, (SteamParamStringArray_t *)%p, (SteamParamStringArray_t *)%p)\n", instancePtr, steamId, unStartIndex, pRequiredTags, pExcludedTags);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles(instancePtr, steamId, unStartIndex, pRequiredTags, pExcludedTags);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles)>::call(&point, unwrapInstance(instancePtr), steamId, unStartIndex, pRequiredTags, pExcludedTags);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_PublishVideo_(intptr_t  instancePtr, EWorkshopVideoProvider  eVideoProvider, char * pchVideoAccount, char * pchVideoIdentifier, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags)
 {
-  TRACE("((intptr_t )%p, (EWorkshopVideoProvider )%p, (char *)\"%s\", (char *)\"%s\", (char *)\"%s\", (AppId_t )%p, (char *)\"%s\", (char *)\"%s\", (ERemoteStoragePublishedFileVisibility )%p, (SteamParamStringArray_t *)%p)\n", instancePtr, eVideoProvider, pchVideoAccount, pchVideoIdentifier, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_PublishVideo(instancePtr, eVideoProvider, pchVideoAccount, pchVideoIdentifier, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_PublishVideo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_PublishVideo)>::call(&point, unwrapInstance(instancePtr), eVideoProvider, pchVideoAccount, pchVideoIdentifier, pchPreviewFile, nConsumerAppId, pchTitle, pchDescription, eVisibility, pTags);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, EWorkshopFileAction  eAction)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p, (EWorkshopFileAction )%p)\n", instancePtr, unPublishedFileId, eAction);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction(instancePtr, unPublishedFileId, eAction);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction)>::call(&point, unwrapInstance(instancePtr), unPublishedFileId, eAction);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction_(intptr_t  instancePtr, EWorkshopFileAction  eAction, uint32  unStartIndex)
 {
-  TRACE("((intptr_t )%p, (EWorkshopFileAction )%p, (uint32 )%d)\n", instancePtr, eAction, unStartIndex);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction(instancePtr, eAction, unStartIndex);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction)>::call(&point, unwrapInstance(instancePtr), eAction, unStartIndex);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles_(intptr_t  instancePtr, EWorkshopEnumerationType  eEnumerationType, uint32  unStartIndex, uint32  unCount, uint32  unDays, SteamParamStringArray_t * pTags, SteamParamStringArray_t * pUserTags)
 {
-  TRACE("((intptr_t )%p, (EWorkshopEnumerationType )%p, (uint32 )%d, (uint32 )%d, (uint32 )%d, (SteamParamStringArray_t *)%p, (SteamParamStringArray_t *)%p)\n", instancePtr, eEnumerationType, unStartIndex, unCount, unDays, pTags, pUserTags);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles(instancePtr, eEnumerationType, unStartIndex, unCount, unDays, pTags, pUserTags);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles)>::call(&point, unwrapInstance(instancePtr), eEnumerationType, unStartIndex, unCount, unDays, pTags, pUserTags);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation_(intptr_t  instancePtr, UGCHandle_t  hContent, char * pchLocation, uint32  unPriority)
 {
-  TRACE("((intptr_t )%p, (UGCHandle_t )%p, (char *)\"%s\", (uint32 )%d)\n", instancePtr, hContent, pchLocation, unPriority);
-  SteamAPICall_t  result = SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation(instancePtr, hContent, pchLocation, unPriority);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation)>::call(&point, unwrapInstance(instancePtr), hContent, pchLocation, unPriority);
 }
 
 
 bool  SteamAPI_ISteamUserStats_RequestCurrentStats_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamUserStats_RequestCurrentStats(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_RequestCurrentStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_RequestCurrentStats)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetStat_(intptr_t  instancePtr, char * pchName, int32 * pData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int32 *)%d)\n", instancePtr, pchName, pData);
-  bool  result = SteamAPI_ISteamUserStats_GetStat(instancePtr, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetStat)>::call(&point, unwrapInstance(instancePtr), pchName, pData);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetStat0_(intptr_t  instancePtr, char * pchName, float * pData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (float *)%f)\n", instancePtr, pchName, pData);
-  bool  result = SteamAPI_ISteamUserStats_GetStat0(instancePtr, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetStat0");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetStat0)>::call(&point, unwrapInstance(instancePtr), pchName, pData);
 }
 
 
 bool  SteamAPI_ISteamUserStats_SetStat_(intptr_t  instancePtr, char * pchName, int32  nData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int32 )%d)\n", instancePtr, pchName, nData);
-  bool  result = SteamAPI_ISteamUserStats_SetStat(instancePtr, pchName, nData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_SetStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_SetStat)>::call(&point, unwrapInstance(instancePtr), pchName, nData);
 }
 
 
 bool  SteamAPI_ISteamUserStats_SetStat0_(intptr_t  instancePtr, char * pchName, float  fData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (float )%f)\n", instancePtr, pchName, fData);
-  bool  result = SteamAPI_ISteamUserStats_SetStat0(instancePtr, pchName, fData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_SetStat0");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_SetStat0)>::call(&point, unwrapInstance(instancePtr), pchName, fData);
 }
 
 
 bool  SteamAPI_ISteamUserStats_UpdateAvgRateStat_(intptr_t  instancePtr, char * pchName, float  flCountThisSession, double  dSessionLength)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (float )%f, (double )%f)\n", instancePtr, pchName, flCountThisSession, dSessionLength);
-  bool  result = SteamAPI_ISteamUserStats_UpdateAvgRateStat(instancePtr, pchName, flCountThisSession, dSessionLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_UpdateAvgRateStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_UpdateAvgRateStat)>::call(&point, unwrapInstance(instancePtr), pchName, flCountThisSession, dSessionLength);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetAchievement_(intptr_t  instancePtr, char * pchName, bool * pbAchieved)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (bool *)%d)\n", instancePtr, pchName, pbAchieved);
-  bool  result = SteamAPI_ISteamUserStats_GetAchievement(instancePtr, pchName, pbAchieved);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetAchievement");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetAchievement)>::call(&point, unwrapInstance(instancePtr), pchName, pbAchieved);
 }
 
 
 bool  SteamAPI_ISteamUserStats_SetAchievement_(intptr_t  instancePtr, char * pchName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchName);
-  bool  result = SteamAPI_ISteamUserStats_SetAchievement(instancePtr, pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_SetAchievement");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_SetAchievement)>::call(&point, unwrapInstance(instancePtr), pchName);
 }
 
 
 bool  SteamAPI_ISteamUserStats_ClearAchievement_(intptr_t  instancePtr, char * pchName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchName);
-  bool  result = SteamAPI_ISteamUserStats_ClearAchievement(instancePtr, pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_ClearAchievement");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_ClearAchievement)>::call(&point, unwrapInstance(instancePtr), pchName);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime_(intptr_t  instancePtr, char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (bool *)%d, (uint32 *)%d)\n", instancePtr, pchName, pbAchieved, punUnlockTime);
-  bool  result = SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime(instancePtr, pchName, pbAchieved, punUnlockTime);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime)>::call(&point, unwrapInstance(instancePtr), pchName, pbAchieved, punUnlockTime);
 }
 
 
 bool  SteamAPI_ISteamUserStats_StoreStats_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamUserStats_StoreStats(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_StoreStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_StoreStats)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 int  SteamAPI_ISteamUserStats_GetAchievementIcon_(intptr_t  instancePtr, char * pchName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchName);
-  int  result = SteamAPI_ISteamUserStats_GetAchievementIcon(instancePtr, pchName);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetAchievementIcon");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetAchievementIcon)>::call(&point, unwrapInstance(instancePtr), pchName);
 }
 
 
 char * SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute_(intptr_t  instancePtr, char * pchName, char * pchKey)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, pchName, pchKey);
-  char * result = SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute(instancePtr, pchName, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute)>::call(&point, unwrapInstance(instancePtr), pchName, pchKey);
 }
 
 
 bool  SteamAPI_ISteamUserStats_IndicateAchievementProgress_(intptr_t  instancePtr, char * pchName, uint32  nCurProgress, uint32  nMaxProgress)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (uint32 )%d, (uint32 )%d)\n", instancePtr, pchName, nCurProgress, nMaxProgress);
-  bool  result = SteamAPI_ISteamUserStats_IndicateAchievementProgress(instancePtr, pchName, nCurProgress, nMaxProgress);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_IndicateAchievementProgress");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_IndicateAchievementProgress)>::call(&point, unwrapInstance(instancePtr), pchName, nCurProgress, nMaxProgress);
 }
 
 
 uint32  SteamAPI_ISteamUserStats_GetNumAchievements_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUserStats_GetNumAchievements(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetNumAchievements");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetNumAchievements)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 char * SteamAPI_ISteamUserStats_GetAchievementName_(intptr_t  instancePtr, uint32  iAchievement)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d)\n", instancePtr, iAchievement);
-  char * result = SteamAPI_ISteamUserStats_GetAchievementName(instancePtr, iAchievement);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetAchievementName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetAchievementName)>::call(&point, unwrapInstance(instancePtr), iAchievement);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_RequestUserStats_(intptr_t  instancePtr, CSteamID  steamIDUser)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDUser);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_RequestUserStats(instancePtr, steamIDUser);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_RequestUserStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_RequestUserStats)>::call(&point, unwrapInstance(instancePtr), steamIDUser);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetUserStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (int32 *)%d)\n", instancePtr, steamIDUser, pchName, pData);
-  bool  result = SteamAPI_ISteamUserStats_GetUserStat(instancePtr, steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetUserStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetUserStat)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, pData);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetUserStat0_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (float *)%f)\n", instancePtr, steamIDUser, pchName, pData);
-  bool  result = SteamAPI_ISteamUserStats_GetUserStat0(instancePtr, steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetUserStat0");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetUserStat0)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, pData);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (bool *)%d)\n", instancePtr, steamIDUser, pchName, pbAchieved);
-  bool  result = SteamAPI_ISteamUserStats_GetUserAchievement(instancePtr, steamIDUser, pchName, pbAchieved);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetUserAchievement");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetUserAchievement)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, pbAchieved);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved, uint32 * punUnlockTime)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (bool *)%d, (uint32 *)%d)\n", instancePtr, steamIDUser, pchName, pbAchieved, punUnlockTime);
-  bool  result = SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime(instancePtr, steamIDUser, pchName, pbAchieved, punUnlockTime);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, pbAchieved, punUnlockTime);
 }
 
 
 bool  SteamAPI_ISteamUserStats_ResetAllStats_(intptr_t  instancePtr, bool  bAchievementsToo)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bAchievementsToo);
-  bool  result = SteamAPI_ISteamUserStats_ResetAllStats(instancePtr, bAchievementsToo);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_ResetAllStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_ResetAllStats)>::call(&point, unwrapInstance(instancePtr), bAchievementsToo);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_FindOrCreateLeaderboard_(intptr_t  instancePtr, char * pchLeaderboardName, ELeaderboardSortMethod  eLeaderboardSortMethod, ELeaderboardDisplayType  eLeaderboardDisplayType)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (ELeaderboardSortMethod )%p, (ELeaderboardDisplayType )%p)\n", instancePtr, pchLeaderboardName, eLeaderboardSortMethod, eLeaderboardDisplayType);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_FindOrCreateLeaderboard(instancePtr, pchLeaderboardName, eLeaderboardSortMethod, eLeaderboardDisplayType);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_FindOrCreateLeaderboard");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_FindOrCreateLeaderboard)>::call(&point, unwrapInstance(instancePtr), pchLeaderboardName, eLeaderboardSortMethod, eLeaderboardDisplayType);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_FindLeaderboard_(intptr_t  instancePtr, char * pchLeaderboardName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchLeaderboardName);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_FindLeaderboard(instancePtr, pchLeaderboardName);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_FindLeaderboard");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_FindLeaderboard)>::call(&point, unwrapInstance(instancePtr), pchLeaderboardName);
 }
 
 
 char * SteamAPI_ISteamUserStats_GetLeaderboardName_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p)\n", instancePtr, hSteamLeaderboard);
-  char * result = SteamAPI_ISteamUserStats_GetLeaderboardName(instancePtr, hSteamLeaderboard);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetLeaderboardName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetLeaderboardName)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard);
 }
 
 
 int  SteamAPI_ISteamUserStats_GetLeaderboardEntryCount_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p)\n", instancePtr, hSteamLeaderboard);
-  int  result = SteamAPI_ISteamUserStats_GetLeaderboardEntryCount(instancePtr, hSteamLeaderboard);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetLeaderboardEntryCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetLeaderboardEntryCount)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard);
 }
 
 
 ELeaderboardSortMethod  SteamAPI_ISteamUserStats_GetLeaderboardSortMethod_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p)\n", instancePtr, hSteamLeaderboard);
-  ELeaderboardSortMethod  result = SteamAPI_ISteamUserStats_GetLeaderboardSortMethod(instancePtr, hSteamLeaderboard);
-  TRACE("() = (ELeaderboardSortMethod )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetLeaderboardSortMethod");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetLeaderboardSortMethod)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard);
 }
 
 
 ELeaderboardDisplayType  SteamAPI_ISteamUserStats_GetLeaderboardDisplayType_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p)\n", instancePtr, hSteamLeaderboard);
-  ELeaderboardDisplayType  result = SteamAPI_ISteamUserStats_GetLeaderboardDisplayType(instancePtr, hSteamLeaderboard);
-  TRACE("() = (ELeaderboardDisplayType )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetLeaderboardDisplayType");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetLeaderboardDisplayType)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_DownloadLeaderboardEntries_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardDataRequest  eLeaderboardDataRequest, int  nRangeStart, int  nRangeEnd)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p, (ELeaderboardDataRequest )%p, (int )%d, (int )%d)\n", instancePtr, hSteamLeaderboard, eLeaderboardDataRequest, nRangeStart, nRangeEnd);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_DownloadLeaderboardEntries(instancePtr, hSteamLeaderboard, eLeaderboardDataRequest, nRangeStart, nRangeEnd);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_DownloadLeaderboardEntries");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_DownloadLeaderboardEntries)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard, eLeaderboardDataRequest, nRangeStart, nRangeEnd);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, CSteamID * prgUsers, int  cUsers)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p, (CSteamID *)%p, (int )%d)\n", instancePtr, hSteamLeaderboard, prgUsers, cUsers);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers(instancePtr, hSteamLeaderboard, prgUsers, cUsers);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard, prgUsers, cUsers);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry_(intptr_t  instancePtr, SteamLeaderboardEntries_t  hSteamLeaderboardEntries, int  index, LeaderboardEntry_t * pLeaderboardEntry, int32 * pDetails, int  cDetailsMax)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboardEntries_t )%p, (int )%d, (LeaderboardEntry_t *)%p, (int32 *)%d, (int )%d)\n", instancePtr, hSteamLeaderboardEntries, index, pLeaderboardEntry, pDetails, cDetailsMax);
-  bool  result = SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry(instancePtr, hSteamLeaderboardEntries, index, pLeaderboardEntry, pDetails, cDetailsMax);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboardEntries, index, pLeaderboardEntry, pDetails, cDetailsMax);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_UploadLeaderboardScore_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardUploadScoreMethod  eLeaderboardUploadScoreMethod, int32  nScore, int32 * pScoreDetails, int  cScoreDetailsCount)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p, (ELeaderboardUploadScoreMethod )%p, (int32 )%d, (int32 *)%d, (int )%d)\n", instancePtr, hSteamLeaderboard, eLeaderboardUploadScoreMethod, nScore, pScoreDetails, cScoreDetailsCount);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_UploadLeaderboardScore(instancePtr, hSteamLeaderboard, eLeaderboardUploadScoreMethod, nScore, pScoreDetails, cScoreDetailsCount);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_UploadLeaderboardScore");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_UploadLeaderboardScore)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard, eLeaderboardUploadScoreMethod, nScore, pScoreDetails, cScoreDetailsCount);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_AttachLeaderboardUGC_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, UGCHandle_t  hUGC)
 {
-  TRACE("((intptr_t )%p, (SteamLeaderboard_t )%p, (UGCHandle_t )%p)\n", instancePtr, hSteamLeaderboard, hUGC);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_AttachLeaderboardUGC(instancePtr, hSteamLeaderboard, hUGC);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_AttachLeaderboardUGC");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_AttachLeaderboardUGC)>::call(&point, unwrapInstance(instancePtr), hSteamLeaderboard, hUGC);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers(instancePtr);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages(instancePtr);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 int  SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo_(intptr_t  instancePtr, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (uint32 )%d, (float *)%f, (bool *)%d)\n", instancePtr, pchName, unNameBufLen, pflPercent, pbAchieved);
-  int  result = SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo(instancePtr, pchName, unNameBufLen, pflPercent, pbAchieved);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo)>::call(&point, unwrapInstance(instancePtr), pchName, unNameBufLen, pflPercent, pbAchieved);
 }
 
 
 int  SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo_(intptr_t  instancePtr, int  iIteratorPrevious, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved)
 {
-  TRACE("((intptr_t )%p, (int )%d, (char *)\"%s\", (uint32 )%d, (float *)%f, (bool *)%d)\n", instancePtr, iIteratorPrevious, pchName, unNameBufLen, pflPercent, pbAchieved);
-  int  result = SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo(instancePtr, iIteratorPrevious, pchName, unNameBufLen, pflPercent, pbAchieved);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo)>::call(&point, unwrapInstance(instancePtr), iIteratorPrevious, pchName, unNameBufLen, pflPercent, pbAchieved);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetAchievementAchievedPercent_(intptr_t  instancePtr, char * pchName, float * pflPercent)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (float *)%f)\n", instancePtr, pchName, pflPercent);
-  bool  result = SteamAPI_ISteamUserStats_GetAchievementAchievedPercent(instancePtr, pchName, pflPercent);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetAchievementAchievedPercent");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetAchievementAchievedPercent)>::call(&point, unwrapInstance(instancePtr), pchName, pflPercent);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUserStats_RequestGlobalStats_(intptr_t  instancePtr, int  nHistoryDays)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, nHistoryDays);
-  SteamAPICall_t  result = SteamAPI_ISteamUserStats_RequestGlobalStats(instancePtr, nHistoryDays);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_RequestGlobalStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_RequestGlobalStats)>::call(&point, unwrapInstance(instancePtr), nHistoryDays);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetGlobalStat_(intptr_t  instancePtr, char * pchStatName, int64 * pData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int64 *)%d)\n", instancePtr, pchStatName, pData);
-  bool  result = SteamAPI_ISteamUserStats_GetGlobalStat(instancePtr, pchStatName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetGlobalStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetGlobalStat)>::call(&point, unwrapInstance(instancePtr), pchStatName, pData);
 }
 
 
 bool  SteamAPI_ISteamUserStats_GetGlobalStat0_(intptr_t  instancePtr, char * pchStatName, double * pData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (double *)%f)\n", instancePtr, pchStatName, pData);
-  bool  result = SteamAPI_ISteamUserStats_GetGlobalStat0(instancePtr, pchStatName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetGlobalStat0");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetGlobalStat0)>::call(&point, unwrapInstance(instancePtr), pchStatName, pData);
 }
 
 
 int32  SteamAPI_ISteamUserStats_GetGlobalStatHistory_(intptr_t  instancePtr, char * pchStatName, int64 * pData, uint32  cubData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int64 *)%d, (uint32 )%d)\n", instancePtr, pchStatName, pData, cubData);
-  int32  result = SteamAPI_ISteamUserStats_GetGlobalStatHistory(instancePtr, pchStatName, pData, cubData);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetGlobalStatHistory", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetGlobalStatHistory)>::call(&point, unwrapInstance(instancePtr), pchStatName, pData, cubData);
 }
 
 
 int32  SteamAPI_ISteamUserStats_GetGlobalStatHistory0_(intptr_t  instancePtr, char * pchStatName, double * pData, uint32  cubData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (double *)%f, (uint32 )%d)\n", instancePtr, pchStatName, pData, cubData);
-  int32  result = SteamAPI_ISteamUserStats_GetGlobalStatHistory0(instancePtr, pchStatName, pData, cubData);
-  TRACE("() = (int32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUserStats_GetGlobalStatHistory0", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUserStats_GetGlobalStatHistory0)>::call(&point, unwrapInstance(instancePtr), pchStatName, pData, cubData);
 }
 
 
 bool  SteamAPI_ISteamApps_BIsSubscribed_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamApps_BIsSubscribed(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsSubscribed");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsSubscribed)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamApps_BIsLowViolence_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamApps_BIsLowViolence(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsLowViolence");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsLowViolence)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamApps_BIsCybercafe_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamApps_BIsCybercafe(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsCybercafe");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsCybercafe)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamApps_BIsVACBanned_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamApps_BIsVACBanned(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsVACBanned");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsVACBanned)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 char * SteamAPI_ISteamApps_GetCurrentGameLanguage_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  char * result = SteamAPI_ISteamApps_GetCurrentGameLanguage(instancePtr);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetCurrentGameLanguage");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetCurrentGameLanguage)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 char * SteamAPI_ISteamApps_GetAvailableGameLanguages_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  char * result = SteamAPI_ISteamApps_GetAvailableGameLanguages(instancePtr);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetAvailableGameLanguages");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetAvailableGameLanguages)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamApps_BIsSubscribedApp_(intptr_t  instancePtr, AppId_t  appID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, appID);
-  bool  result = SteamAPI_ISteamApps_BIsSubscribedApp(instancePtr, appID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsSubscribedApp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsSubscribedApp)>::call(&point, unwrapInstance(instancePtr), appID);
 }
 
 
 bool  SteamAPI_ISteamApps_BIsDlcInstalled_(intptr_t  instancePtr, AppId_t  appID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, appID);
-  bool  result = SteamAPI_ISteamApps_BIsDlcInstalled(instancePtr, appID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsDlcInstalled");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsDlcInstalled)>::call(&point, unwrapInstance(instancePtr), appID);
 }
 
 
 uint32  SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime_(intptr_t  instancePtr, AppId_t  nAppID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, nAppID);
-  uint32  result = SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime(instancePtr, nAppID);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime)>::call(&point, unwrapInstance(instancePtr), nAppID);
 }
 
 
 bool  SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 int  SteamAPI_ISteamApps_GetDLCCount_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int  result = SteamAPI_ISteamApps_GetDLCCount(instancePtr);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetDLCCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetDLCCount)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamApps_BGetDLCDataByIndex_(intptr_t  instancePtr, int  iDLC, AppId_t * pAppID, bool * pbAvailable, char * pchName, int  cchNameBufferSize)
 {
-  TRACE("((intptr_t )%p, (int )%d, (AppId_t *)%p, (bool *)%d, (char *)\"%s\", (int )%d)\n", instancePtr, iDLC, pAppID, pbAvailable, pchName, cchNameBufferSize);
-  bool  result = SteamAPI_ISteamApps_BGetDLCDataByIndex(instancePtr, iDLC, pAppID, pbAvailable, pchName, cchNameBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BGetDLCDataByIndex", "4:5");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BGetDLCDataByIndex)>::call(&point, unwrapInstance(instancePtr), iDLC, pAppID, pbAvailable, pchName, cchNameBufferSize);
 }
 
 
 void  SteamAPI_ISteamApps_InstallDLC_(intptr_t  instancePtr, AppId_t  nAppID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, nAppID);
-  SteamAPI_ISteamApps_InstallDLC(instancePtr, nAppID);
-  
+  static ProfilePoint point("SteamAPI_ISteamApps_InstallDLC");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_InstallDLC)>::call(&point, unwrapInstance(instancePtr), nAppID);
 }
 
 
 void  SteamAPI_ISteamApps_UninstallDLC_(intptr_t  instancePtr, AppId_t  nAppID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, nAppID);
-  SteamAPI_ISteamApps_UninstallDLC(instancePtr, nAppID);
-  
+  static ProfilePoint point("SteamAPI_ISteamApps_UninstallDLC");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_UninstallDLC)>::call(&point, unwrapInstance(instancePtr), nAppID);
 }
 
 
 void  SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey_(intptr_t  instancePtr, AppId_t  nAppID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, nAppID);
-  SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey(instancePtr, nAppID);
-  
+  static ProfilePoint point("SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey)>::call(&point, unwrapInstance(instancePtr), nAppID);
 }
 
 
 bool  SteamAPI_ISteamApps_GetCurrentBetaName_(intptr_t  instancePtr, char * pchName, int  cchNameBufferSize)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (int )%d)\n", instancePtr, pchName, cchNameBufferSize);
-  bool  result = SteamAPI_ISteamApps_GetCurrentBetaName(instancePtr, pchName, cchNameBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetCurrentBetaName", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetCurrentBetaName)>::call(&point, unwrapInstance(instancePtr), pchName, cchNameBufferSize);
 }
 
 
 bool  SteamAPI_ISteamApps_MarkContentCorrupt_(intptr_t  instancePtr, bool  bMissingFilesOnly)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bMissingFilesOnly);
-  bool  result = SteamAPI_ISteamApps_MarkContentCorrupt(instancePtr, bMissingFilesOnly);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_MarkContentCorrupt");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_MarkContentCorrupt)>::call(&point, unwrapInstance(instancePtr), bMissingFilesOnly);
 }
 
 
 uint32  SteamAPI_ISteamApps_GetInstalledDepots_(intptr_t  instancePtr, AppId_t  appID, DepotId_t * pvecDepots, uint32  cMaxDepots)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (DepotId_t *)%p, (uint32 )%d)\n", instancePtr, appID, pvecDepots, cMaxDepots);
-  uint32  result = SteamAPI_ISteamApps_GetInstalledDepots(instancePtr, appID, pvecDepots, cMaxDepots);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetInstalledDepots");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetInstalledDepots)>::call(&point, unwrapInstance(instancePtr), appID, pvecDepots, cMaxDepots);
 }
 
 
 uint32  SteamAPI_ISteamApps_GetAppInstallDir_(intptr_t  instancePtr, AppId_t  appID, char * pchFolder, uint32  cchFolderBufferSize)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (char *)\"%s\", (uint32 )%d)\n", instancePtr, appID, pchFolder, cchFolderBufferSize);
-  uint32  result = SteamAPI_ISteamApps_GetAppInstallDir(instancePtr, appID, pchFolder, cchFolderBufferSize);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetAppInstallDir", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetAppInstallDir)>::call(&point, unwrapInstance(instancePtr), appID, pchFolder, cchFolderBufferSize);
 }
 
 
 bool  SteamAPI_ISteamApps_BIsAppInstalled_(intptr_t  instancePtr, AppId_t  appID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, appID);
-  bool  result = SteamAPI_ISteamApps_BIsAppInstalled(instancePtr, appID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_BIsAppInstalled");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_BIsAppInstalled)>::call(&point, unwrapInstance(instancePtr), appID);
 }
 
 
 uint64  SteamAPI_ISteamApps_GetAppOwner_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint64  result = SteamAPI_ISteamApps_GetAppOwner(instancePtr);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetAppOwner");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetAppOwner)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 char * SteamAPI_ISteamApps_GetLaunchQueryParam_(intptr_t  instancePtr, char * pchKey)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchKey);
-  char * result = SteamAPI_ISteamApps_GetLaunchQueryParam(instancePtr, pchKey);
-  TRACE("() = (char *)\"%s\"\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetLaunchQueryParam");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetLaunchQueryParam)>::call(&point, unwrapInstance(instancePtr), pchKey);
 }
 
 
 bool  SteamAPI_ISteamApps_GetDlcDownloadProgress_(intptr_t  instancePtr, AppId_t  nAppID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (uint64 *)%d, (uint64 *)%d)\n", instancePtr, nAppID, punBytesDownloaded, punBytesTotal);
-  bool  result = SteamAPI_ISteamApps_GetDlcDownloadProgress(instancePtr, nAppID, punBytesDownloaded, punBytesTotal);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetDlcDownloadProgress");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetDlcDownloadProgress)>::call(&point, unwrapInstance(instancePtr), nAppID, punBytesDownloaded, punBytesTotal);
 }
 
 
 int  SteamAPI_ISteamApps_GetAppBuildId_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  int  result = SteamAPI_ISteamApps_GetAppBuildId(instancePtr);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamApps_GetAppBuildId");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamApps_GetAppBuildId)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamNetworking_SendP2PPacket_(intptr_t  instancePtr, CSteamID  steamIDRemote, void * pubData, uint32  cubData, EP2PSend  eP2PSendType, int  nChannel)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (void *)%p, (uint32 )%d, (EP2PSend )%p, (int )%d)\n", instancePtr, steamIDRemote, pubData, cubData, eP2PSendType, nChannel);
-  bool  result = SteamAPI_ISteamNetworking_SendP2PPacket(instancePtr, steamIDRemote, pubData, cubData, eP2PSendType, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
+  static ProfilePoint point("SteamAPI_ISteamNetworking_SendP2PPacket", "2:3");
+  bool result = Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_SendP2PPacket), true>::call(&point, unwrapInstance(instancePtr), steamIDRemote, pubData, cubData, eP2PSendType, nChannel);
+  if (netStatsEnabled || captureEnabled)
+    netSendP2PPacket(steamIDRemote, pubData, cubData, eP2PSendType, nChannel, result);
   return result;
 }
 
 
 bool  SteamAPI_ISteamNetworking_IsP2PPacketAvailable_(intptr_t  instancePtr, uint32 * pcubMsgSize, int  nChannel)
 {
-  TRACE("((intptr_t )%p, (uint32 *)%d, (int )%d)\n", instancePtr, pcubMsgSize, nChannel);
-  bool  result = SteamAPI_ISteamNetworking_IsP2PPacketAvailable(instancePtr, pcubMsgSize, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_IsP2PPacketAvailable");
+  if (p2pBatchEnabled)
+    return p2pIsPacketAvailable(&point, (ISteamNetworking *)unwrapInstance(instancePtr), pcubMsgSize, nChannel);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_IsP2PPacketAvailable), true>::call(&point, unwrapInstance(instancePtr), pcubMsgSize, nChannel);
 }
 
 
 bool  SteamAPI_ISteamNetworking_ReadP2PPacket_(intptr_t  instancePtr, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, CSteamID * psteamIDRemote, int  nChannel)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (uint32 )%d, (uint32 *)%d, (CSteamID *)%p, (int )%d)\n", instancePtr, pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
-  bool  result = SteamAPI_ISteamNetworking_ReadP2PPacket(instancePtr, pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
+  static ProfilePoint point("SteamAPI_ISteamNetworking_ReadP2PPacket", "1:2");
+  if (p2pBatchEnabled)
+    return p2pReadPacket(&point, (ISteamNetworking *)unwrapInstance(instancePtr), pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
+  bool result = Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_ReadP2PPacket), true>::call(&point, unwrapInstance(instancePtr), pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel);
+  if (netStatsEnabled || captureEnabled)
+    netReadP2PPacket(pubDest, cubDest, pcubMsgSize, psteamIDRemote, nChannel, result);
   return result;
 }
 
 
 bool  SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser_(intptr_t  instancePtr, CSteamID  steamIDRemote)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDRemote);
-  bool  result = SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser(instancePtr, steamIDRemote);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser");
+  if (sessionCacheEnabled)
+    return sessionAcceptP2PSessionWithUser(&point, (ISteamNetworking *)unwrapInstance(instancePtr), steamIDRemote);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser), true>::call(&point, unwrapInstance(instancePtr), steamIDRemote);
 }
 
 
 bool  SteamAPI_ISteamNetworking_CloseP2PSessionWithUser_(intptr_t  instancePtr, CSteamID  steamIDRemote)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDRemote);
-  bool  result = SteamAPI_ISteamNetworking_CloseP2PSessionWithUser(instancePtr, steamIDRemote);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_CloseP2PSessionWithUser");
+  if (sessionCacheEnabled)
+    return sessionCloseP2PSessionWithUser(&point, (ISteamNetworking *)unwrapInstance(instancePtr), steamIDRemote);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_CloseP2PSessionWithUser), true>::call(&point, unwrapInstance(instancePtr), steamIDRemote);
 }
 
 
 bool  SteamAPI_ISteamNetworking_CloseP2PChannelWithUser_(intptr_t  instancePtr, CSteamID  steamIDRemote, int  nChannel)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d)\n", instancePtr, steamIDRemote, nChannel);
-  bool  result = SteamAPI_ISteamNetworking_CloseP2PChannelWithUser(instancePtr, steamIDRemote, nChannel);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_CloseP2PChannelWithUser");
+  if (sessionCacheEnabled)
+    return sessionCloseP2PChannelWithUser(&point, (ISteamNetworking *)unwrapInstance(instancePtr), steamIDRemote, nChannel);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_CloseP2PChannelWithUser), true>::call(&point, unwrapInstance(instancePtr), steamIDRemote, nChannel);
 }
 
 
 bool  SteamAPI_ISteamNetworking_GetP2PSessionState_(intptr_t  instancePtr, CSteamID  steamIDRemote, P2PSessionState_t * pConnectionState)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (P2PSessionState_t *)%p)\n", instancePtr, steamIDRemote, pConnectionState);
-  bool  result = SteamAPI_ISteamNetworking_GetP2PSessionState(instancePtr, steamIDRemote, pConnectionState);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_GetP2PSessionState");
+  if (sessionCacheEnabled)
+    return sessionGetP2PSessionState(&point, (ISteamNetworking *)unwrapInstance(instancePtr), steamIDRemote, pConnectionState);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_GetP2PSessionState), true>::call(&point, unwrapInstance(instancePtr), steamIDRemote, pConnectionState);
 }
 
 
 bool  SteamAPI_ISteamNetworking_AllowP2PPacketRelay_(intptr_t  instancePtr, bool  bAllow)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bAllow);
-  bool  result = SteamAPI_ISteamNetworking_AllowP2PPacketRelay(instancePtr, bAllow);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_AllowP2PPacketRelay");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_AllowP2PPacketRelay), true>::call(&point, unwrapInstance(instancePtr), bAllow);
 }
 
 
 SNetListenSocket_t  SteamAPI_ISteamNetworking_CreateListenSocket_(intptr_t  instancePtr, int  nVirtualP2PPort, uint32  nIP, uint16  nPort, bool  bAllowUseOfPacketRelay)
 {
-  TRACE("((intptr_t )%p, (int )%d, (uint32 )%d, (uint16 )%d, (bool )%d)\n", instancePtr, nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
-  SNetListenSocket_t  result = SteamAPI_ISteamNetworking_CreateListenSocket(instancePtr, nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
-  TRACE("() = (SNetListenSocket_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_CreateListenSocket");
+  if (socketPollEnabled)
+    return socketCreateListenSocket(&point, (ISteamNetworking *)unwrapInstance(instancePtr), nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_CreateListenSocket), true>::call(&point, unwrapInstance(instancePtr), nVirtualP2PPort, nIP, nPort, bAllowUseOfPacketRelay);
 }
 
 
 SNetSocket_t  SteamAPI_ISteamNetworking_CreateP2PConnectionSocket_(intptr_t  instancePtr, CSteamID  steamIDTarget, int  nVirtualPort, int  nTimeoutSec, bool  bAllowUseOfPacketRelay)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (int )%d, (int )%d, (bool )%d)\n", instancePtr, steamIDTarget, nVirtualPort, nTimeoutSec, bAllowUseOfPacketRelay);
-  SNetSocket_t  result = SteamAPI_ISteamNetworking_CreateP2PConnectionSocket(instancePtr, steamIDTarget, nVirtualPort, nTimeoutSec, bAllowUseOfPacketRelay);
-  TRACE("() = (SNetSocket_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_CreateP2PConnectionSocket");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_CreateP2PConnectionSocket), true>::call(&point, unwrapInstance(instancePtr), steamIDTarget, nVirtualPort, nTimeoutSec, bAllowUseOfPacketRelay);
 }
 
 
 SNetSocket_t  SteamAPI_ISteamNetworking_CreateConnectionSocket_(intptr_t  instancePtr, uint32  nIP, uint16  nPort, int  nTimeoutSec)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (uint16 )%d, (int )%d)\n", instancePtr, nIP, nPort, nTimeoutSec);
-  SNetSocket_t  result = SteamAPI_ISteamNetworking_CreateConnectionSocket(instancePtr, nIP, nPort, nTimeoutSec);
-  TRACE("() = (SNetSocket_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_CreateConnectionSocket");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_CreateConnectionSocket), true>::call(&point, unwrapInstance(instancePtr), nIP, nPort, nTimeoutSec);
 }
 
 
 bool  SteamAPI_ISteamNetworking_DestroySocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, bool  bNotifyRemoteEnd)
 {
-  TRACE("((intptr_t )%p, (SNetSocket_t )%p, (bool )%d)\n", instancePtr, hSocket, bNotifyRemoteEnd);
-  bool  result = SteamAPI_ISteamNetworking_DestroySocket(instancePtr, hSocket, bNotifyRemoteEnd);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_DestroySocket");
+  if (socketPollEnabled)
+    return socketDestroySocket(&point, (ISteamNetworking *)unwrapInstance(instancePtr), hSocket, bNotifyRemoteEnd);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_DestroySocket), true>::call(&point, unwrapInstance(instancePtr), hSocket, bNotifyRemoteEnd);
 }
 
 
 bool  SteamAPI_ISteamNetworking_DestroyListenSocket_(intptr_t  instancePtr, SNetListenSocket_t  hSocket, bool  bNotifyRemoteEnd)
 {
-  TRACE("((intptr_t )%p, (SNetListenSocket_t )%p, (bool )%d)\n", instancePtr, hSocket, bNotifyRemoteEnd);
-  bool  result = SteamAPI_ISteamNetworking_DestroyListenSocket(instancePtr, hSocket, bNotifyRemoteEnd);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_DestroyListenSocket");
+  if (socketPollEnabled)
+    return socketDestroyListenSocket(&point, (ISteamNetworking *)unwrapInstance(instancePtr), hSocket, bNotifyRemoteEnd);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_DestroyListenSocket), true>::call(&point, unwrapInstance(instancePtr), hSocket, bNotifyRemoteEnd);
 }
 
 
 bool  SteamAPI_ISteamNetworking_SendDataOnSocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubData, uint32  cubData, bool  bReliable)
 {
-  TRACE("((intptr_t )%p, (SNetSocket_t )%p, (void *)%p, (uint32 )%d, (bool )%d)\n", instancePtr, hSocket, pubData, cubData, bReliable);
-  bool  result = SteamAPI_ISteamNetworking_SendDataOnSocket(instancePtr, hSocket, pubData, cubData, bReliable);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_SendDataOnSocket", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_SendDataOnSocket), true>::call(&point, unwrapInstance(instancePtr), hSocket, pubData, cubData, bReliable);
 }
 
 
 bool  SteamAPI_ISteamNetworking_IsDataAvailableOnSocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, uint32 * pcubMsgSize)
 {
-  TRACE("((intptr_t )%p, (SNetSocket_t )%p, (uint32 *)%d)\n", instancePtr, hSocket, pcubMsgSize);
-  bool  result = SteamAPI_ISteamNetworking_IsDataAvailableOnSocket(instancePtr, hSocket, pcubMsgSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_IsDataAvailableOnSocket");
+  if (socketPollEnabled)
+    return socketIsDataAvailableOnSocket(&point, (ISteamNetworking *)unwrapInstance(instancePtr), hSocket, pcubMsgSize);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_IsDataAvailableOnSocket), true>::call(&point, unwrapInstance(instancePtr), hSocket, pcubMsgSize);
 }
 
 
 bool  SteamAPI_ISteamNetworking_RetrieveDataFromSocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize)
 {
-  TRACE("((intptr_t )%p, (SNetSocket_t )%p, (void *)%p, (uint32 )%d, (uint32 *)%d)\n", instancePtr, hSocket, pubDest, cubDest, pcubMsgSize);
-  bool  result = SteamAPI_ISteamNetworking_RetrieveDataFromSocket(instancePtr, hSocket, pubDest, cubDest, pcubMsgSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_RetrieveDataFromSocket", "2:3");
+  if (socketPollEnabled)
+    return socketRetrieveDataFromSocket(&point, (ISteamNetworking *)unwrapInstance(instancePtr), hSocket, pubDest, cubDest, pcubMsgSize);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_RetrieveDataFromSocket), true>::call(&point, unwrapInstance(instancePtr), hSocket, pubDest, cubDest, pcubMsgSize);
 }
 
 
 bool  SteamAPI_ISteamNetworking_IsDataAvailable_(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pcubMsgSize, SNetSocket_t * phSocket)
 {
-  TRACE("((intptr_t )%p, (SNetListenSocket_t )%p, (uint32 *)%d, (SNetSocket_t *)%p)\n", instancePtr, hListenSocket, pcubMsgSize, phSocket);
-  bool  result = SteamAPI_ISteamNetworking_IsDataAvailable(instancePtr, hListenSocket, pcubMsgSize, phSocket);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_IsDataAvailable");
+  if (socketPollEnabled)
+    return socketIsDataAvailable(&point, (ISteamNetworking *)unwrapInstance(instancePtr), hListenSocket, pcubMsgSize, phSocket);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_IsDataAvailable), true>::call(&point, unwrapInstance(instancePtr), hListenSocket, pcubMsgSize, phSocket);
 }
 
 
 bool  SteamAPI_ISteamNetworking_RetrieveData_(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, SNetSocket_t * phSocket)
 {
-  TRACE("((intptr_t )%p, (SNetListenSocket_t )%p, (void *)%p, (uint32 )%d, (uint32 *)%d, (SNetSocket_t *)%p)\n", instancePtr, hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
-  bool  result = SteamAPI_ISteamNetworking_RetrieveData(instancePtr, hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_RetrieveData", "2:3");
+  if (socketPollEnabled)
+    return socketRetrieveData(&point, (ISteamNetworking *)unwrapInstance(instancePtr), hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_RetrieveData), true>::call(&point, unwrapInstance(instancePtr), hListenSocket, pubDest, cubDest, pcubMsgSize, phSocket);
 }
 
 
 bool  SteamAPI_ISteamNetworking_GetSocketInfo_(intptr_t  instancePtr, SNetSocket_t  hSocket, CSteamID * pSteamIDRemote, int * peSocketStatus, uint32 * punIPRemote, uint16 * punPortRemote)
 {
-  TRACE("((intptr_t )%p, (SNetSocket_t )%p, (CSteamID *)%p, (int *)%d, (uint32 *)%d, (uint16 *)%d)\n", instancePtr, hSocket, pSteamIDRemote, peSocketStatus, punIPRemote, punPortRemote);
-  bool  result = SteamAPI_ISteamNetworking_GetSocketInfo(instancePtr, hSocket, pSteamIDRemote, peSocketStatus, punIPRemote, punPortRemote);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_GetSocketInfo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_GetSocketInfo), true>::call(&point, unwrapInstance(instancePtr), hSocket, pSteamIDRemote, peSocketStatus, punIPRemote, punPortRemote);
 }
 
 
 bool  SteamAPI_ISteamNetworking_GetListenSocketInfo_(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pnIP, uint16 * pnPort)
 {
-  TRACE("((intptr_t )%p, (SNetListenSocket_t )%p, (uint32 *)%d, (uint16 *)%d)\n", instancePtr, hListenSocket, pnIP, pnPort);
-  bool  result = SteamAPI_ISteamNetworking_GetListenSocketInfo(instancePtr, hListenSocket, pnIP, pnPort);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_GetListenSocketInfo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_GetListenSocketInfo), true>::call(&point, unwrapInstance(instancePtr), hListenSocket, pnIP, pnPort);
 }
 
 
 ESNetSocketConnectionType  SteamAPI_ISteamNetworking_GetSocketConnectionType_(intptr_t  instancePtr, SNetSocket_t  hSocket)
 {
-  TRACE("((intptr_t )%p, (SNetSocket_t )%p)\n", instancePtr, hSocket);
-  ESNetSocketConnectionType  result = SteamAPI_ISteamNetworking_GetSocketConnectionType(instancePtr, hSocket);
-  TRACE("() = (ESNetSocketConnectionType )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_GetSocketConnectionType");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_GetSocketConnectionType), true>::call(&point, unwrapInstance(instancePtr), hSocket);
 }
 
 
 int  SteamAPI_ISteamNetworking_GetMaxPacketSize_(intptr_t  instancePtr, SNetSocket_t  hSocket)
 {
-  TRACE("((intptr_t )%p, (SNetSocket_t )%p)\n", instancePtr, hSocket);
-  int  result = SteamAPI_ISteamNetworking_GetMaxPacketSize(instancePtr, hSocket);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamNetworking_GetMaxPacketSize");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamNetworking_GetMaxPacketSize), true>::call(&point, unwrapInstance(instancePtr), hSocket);
 }
 
 
 ScreenshotHandle  SteamAPI_ISteamScreenshots_WriteScreenshot_(intptr_t  instancePtr, void * pubRGB, uint32  cubRGB, int  nWidth, int  nHeight)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (uint32 )%d, (int )%d, (int )%d)\n", instancePtr, pubRGB, cubRGB, nWidth, nHeight);
-  ScreenshotHandle  result = SteamAPI_ISteamScreenshots_WriteScreenshot(instancePtr, pubRGB, cubRGB, nWidth, nHeight);
-  TRACE("() = (ScreenshotHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamScreenshots_WriteScreenshot", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamScreenshots_WriteScreenshot)>::call(&point, unwrapInstance(instancePtr), pubRGB, cubRGB, nWidth, nHeight);
 }
 
 
 ScreenshotHandle  SteamAPI_ISteamScreenshots_AddScreenshotToLibrary_(intptr_t  instancePtr, char * pchFilename, char * pchThumbnailFilename, int  nWidth, int  nHeight)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\", (int )%d, (int )%d)\n", instancePtr, pchFilename, pchThumbnailFilename, nWidth, nHeight);
-  ScreenshotHandle  result = SteamAPI_ISteamScreenshots_AddScreenshotToLibrary(instancePtr, pchFilename, pchThumbnailFilename, nWidth, nHeight);
-  TRACE("() = (ScreenshotHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamScreenshots_AddScreenshotToLibrary");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamScreenshots_AddScreenshotToLibrary)>::call(&point, unwrapInstance(instancePtr), pchFilename, pchThumbnailFilename, nWidth, nHeight);
 }
 
 
 void  SteamAPI_ISteamScreenshots_TriggerScreenshot_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamScreenshots_TriggerScreenshot(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamScreenshots_TriggerScreenshot");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamScreenshots_TriggerScreenshot)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamScreenshots_HookScreenshots_(intptr_t  instancePtr, bool  bHook)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bHook);
-  SteamAPI_ISteamScreenshots_HookScreenshots(instancePtr, bHook);
-  
+  static ProfilePoint point("SteamAPI_ISteamScreenshots_HookScreenshots");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamScreenshots_HookScreenshots)>::call(&point, unwrapInstance(instancePtr), bHook);
 }
 
 
 bool  SteamAPI_ISteamScreenshots_SetLocation_(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, char * pchLocation)
 {
-  TRACE("((intptr_t )%p, (ScreenshotHandle )%p, (char *)\"%s\")\n", instancePtr, hScreenshot, pchLocation);
-  bool  result = SteamAPI_ISteamScreenshots_SetLocation(instancePtr, hScreenshot, pchLocation);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamScreenshots_SetLocation");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamScreenshots_SetLocation)>::call(&point, unwrapInstance(instancePtr), hScreenshot, pchLocation);
 }
 
 
 bool  SteamAPI_ISteamScreenshots_TagUser_(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (ScreenshotHandle )%p, (CSteamID )%p)\n", instancePtr, hScreenshot, steamID);
-  bool  result = SteamAPI_ISteamScreenshots_TagUser(instancePtr, hScreenshot, steamID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamScreenshots_TagUser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamScreenshots_TagUser)>::call(&point, unwrapInstance(instancePtr), hScreenshot, steamID);
 }
 
 
 bool  SteamAPI_ISteamScreenshots_TagPublishedFile_(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, PublishedFileId_t  unPublishedFileID)
 {
-  TRACE("((intptr_t )%p, (ScreenshotHandle )%p, (PublishedFileId_t )%p)\n", instancePtr, hScreenshot, unPublishedFileID);
-  bool  result = SteamAPI_ISteamScreenshots_TagPublishedFile(instancePtr, hScreenshot, unPublishedFileID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamScreenshots_TagPublishedFile");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamScreenshots_TagPublishedFile)>::call(&point, unwrapInstance(instancePtr), hScreenshot, unPublishedFileID);
 }
 
 
 bool  SteamAPI_ISteamMusic_BIsEnabled_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusic_BIsEnabled(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusic_BIsEnabled");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_BIsEnabled)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusic_BIsPlaying_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusic_BIsPlaying(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusic_BIsPlaying");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_BIsPlaying)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 AudioPlayback_Status  SteamAPI_ISteamMusic_GetPlaybackStatus_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  AudioPlayback_Status  result = SteamAPI_ISteamMusic_GetPlaybackStatus(instancePtr);
-  TRACE("() = (AudioPlayback_Status )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusic_GetPlaybackStatus");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_GetPlaybackStatus)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMusic_Play_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMusic_Play(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMusic_Play");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_Play)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMusic_Pause_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMusic_Pause(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMusic_Pause");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_Pause)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMusic_PlayPrevious_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMusic_PlayPrevious(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMusic_PlayPrevious");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_PlayPrevious)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMusic_PlayNext_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamMusic_PlayNext(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamMusic_PlayNext");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_PlayNext)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamMusic_SetVolume_(intptr_t  instancePtr, float  flVolume)
 {
-  TRACE("((intptr_t )%p, (float )%f)\n", instancePtr, flVolume);
-  SteamAPI_ISteamMusic_SetVolume(instancePtr, flVolume);
-  
+  static ProfilePoint point("SteamAPI_ISteamMusic_SetVolume");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_SetVolume)>::call(&point, unwrapInstance(instancePtr), flVolume);
 }
 
 
 float  SteamAPI_ISteamMusic_GetVolume_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  float  result = SteamAPI_ISteamMusic_GetVolume(instancePtr);
-  TRACE("() = (float )%f\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusic_GetVolume");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusic_GetVolume)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote_(intptr_t  instancePtr, char * pchName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchName);
-  bool  result = SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote(instancePtr, pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote)>::call(&point, unwrapInstance(instancePtr), pchName);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_BActivationSuccess_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_BActivationSuccess(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_BActivationSuccess");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_BActivationSuccess)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_SetDisplayName_(intptr_t  instancePtr, char * pchDisplayName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchDisplayName);
-  bool  result = SteamAPI_ISteamMusicRemote_SetDisplayName(instancePtr, pchDisplayName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_SetDisplayName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_SetDisplayName)>::call(&point, unwrapInstance(instancePtr), pchDisplayName);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64_(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (uint32 )%d)\n", instancePtr, pvBuffer, cbBufferLength);
-  bool  result = SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64(instancePtr, pvBuffer, cbBufferLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64)>::call(&point, unwrapInstance(instancePtr), pvBuffer, cbBufferLength);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_EnablePlayPrevious_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_EnablePlayPrevious(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_EnablePlayPrevious");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_EnablePlayPrevious)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_EnablePlayNext_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_EnablePlayNext(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_EnablePlayNext");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_EnablePlayNext)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_EnableShuffled_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_EnableShuffled(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_EnableShuffled");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_EnableShuffled)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_EnableLooped_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_EnableLooped(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_EnableLooped");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_EnableLooped)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_EnableQueue_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_EnableQueue(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_EnableQueue");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_EnableQueue)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_EnablePlaylists_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_EnablePlaylists(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_EnablePlaylists");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_EnablePlaylists)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus_(intptr_t  instancePtr, AudioPlayback_Status  nStatus)
 {
-  TRACE("((intptr_t )%p, (AudioPlayback_Status )%p)\n", instancePtr, nStatus);
-  bool  result = SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus(instancePtr, nStatus);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus)>::call(&point, unwrapInstance(instancePtr), nStatus);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_UpdateShuffled_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_UpdateShuffled(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_UpdateShuffled");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_UpdateShuffled)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_UpdateLooped_(intptr_t  instancePtr, bool  bValue)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bValue);
-  bool  result = SteamAPI_ISteamMusicRemote_UpdateLooped(instancePtr, bValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_UpdateLooped");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_UpdateLooped)>::call(&point, unwrapInstance(instancePtr), bValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_UpdateVolume_(intptr_t  instancePtr, float  flValue)
 {
-  TRACE("((intptr_t )%p, (float )%f)\n", instancePtr, flValue);
-  bool  result = SteamAPI_ISteamMusicRemote_UpdateVolume(instancePtr, flValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_UpdateVolume");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_UpdateVolume)>::call(&point, unwrapInstance(instancePtr), flValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_CurrentEntryWillChange_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_CurrentEntryWillChange(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_CurrentEntryWillChange");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_CurrentEntryWillChange)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable_(intptr_t  instancePtr, bool  bAvailable)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bAvailable);
-  bool  result = SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable(instancePtr, bAvailable);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable)>::call(&point, unwrapInstance(instancePtr), bAvailable);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText_(intptr_t  instancePtr, char * pchText)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchText);
-  bool  result = SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText(instancePtr, pchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText)>::call(&point, unwrapInstance(instancePtr), pchText);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds_(intptr_t  instancePtr, int  nValue)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, nValue);
-  bool  result = SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds(instancePtr, nValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds)>::call(&point, unwrapInstance(instancePtr), nValue);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt_(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (uint32 )%d)\n", instancePtr, pvBuffer, cbBufferLength);
-  bool  result = SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt(instancePtr, pvBuffer, cbBufferLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt)>::call(&point, unwrapInstance(instancePtr), pvBuffer, cbBufferLength);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_CurrentEntryDidChange_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_CurrentEntryDidChange(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_CurrentEntryDidChange");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_CurrentEntryDidChange)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_QueueWillChange_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_QueueWillChange(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_QueueWillChange");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_QueueWillChange)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_ResetQueueEntries_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_ResetQueueEntries(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_ResetQueueEntries");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_ResetQueueEntries)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_SetQueueEntry_(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText)
 {
-  TRACE("((intptr_t )%p, (int )%d, (int )%d, (char *)\"%s\")\n", instancePtr, nID, nPosition, pchEntryText);
-  bool  result = SteamAPI_ISteamMusicRemote_SetQueueEntry(instancePtr, nID, nPosition, pchEntryText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_SetQueueEntry");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_SetQueueEntry)>::call(&point, unwrapInstance(instancePtr), nID, nPosition, pchEntryText);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry_(intptr_t  instancePtr, int  nID)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, nID);
-  bool  result = SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry(instancePtr, nID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry)>::call(&point, unwrapInstance(instancePtr), nID);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_QueueDidChange_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_QueueDidChange(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_QueueDidChange");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_QueueDidChange)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_PlaylistWillChange_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_PlaylistWillChange(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_PlaylistWillChange");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_PlaylistWillChange)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_ResetPlaylistEntries_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_ResetPlaylistEntries(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_ResetPlaylistEntries");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_ResetPlaylistEntries)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_SetPlaylistEntry_(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText)
 {
-  TRACE("((intptr_t )%p, (int )%d, (int )%d, (char *)\"%s\")\n", instancePtr, nID, nPosition, pchEntryText);
-  bool  result = SteamAPI_ISteamMusicRemote_SetPlaylistEntry(instancePtr, nID, nPosition, pchEntryText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_SetPlaylistEntry");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_SetPlaylistEntry)>::call(&point, unwrapInstance(instancePtr), nID, nPosition, pchEntryText);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry_(intptr_t  instancePtr, int  nID)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, nID);
-  bool  result = SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry(instancePtr, nID);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry)>::call(&point, unwrapInstance(instancePtr), nID);
 }
 
 
 bool  SteamAPI_ISteamMusicRemote_PlaylistDidChange_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamMusicRemote_PlaylistDidChange(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamMusicRemote_PlaylistDidChange");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamMusicRemote_PlaylistDidChange)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 HTTPRequestHandle  SteamAPI_ISteamHTTP_CreateHTTPRequest_(intptr_t  instancePtr, EHTTPMethod  eHTTPRequestMethod, char * pchAbsoluteURL)
 {
-  TRACE("((intptr_t )%p, (EHTTPMethod )%p, (char *)\"%s\")\n", instancePtr, eHTTPRequestMethod, pchAbsoluteURL);
-  HTTPRequestHandle  result = SteamAPI_ISteamHTTP_CreateHTTPRequest(instancePtr, eHTTPRequestMethod, pchAbsoluteURL);
-  TRACE("() = (HTTPRequestHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_CreateHTTPRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_CreateHTTPRequest)>::call(&point, unwrapInstance(instancePtr), eHTTPRequestMethod, pchAbsoluteURL);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestContextValue_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint64  ulContextValue)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (uint64 )%d)\n", instancePtr, hRequest, ulContextValue);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestContextValue(instancePtr, hRequest, ulContextValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestContextValue");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestContextValue)>::call(&point, unwrapInstance(instancePtr), hRequest, ulContextValue);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unTimeoutSeconds)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (uint32 )%d)\n", instancePtr, hRequest, unTimeoutSeconds);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout(instancePtr, hRequest, unTimeoutSeconds);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout)>::call(&point, unwrapInstance(instancePtr), hRequest, unTimeoutSeconds);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, char * pchHeaderValue)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, hRequest, pchHeaderName, pchHeaderValue);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue(instancePtr, hRequest, pchHeaderName, pchHeaderValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue)>::call(&point, unwrapInstance(instancePtr), hRequest, pchHeaderName, pchHeaderValue);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchParamName, char * pchParamValue)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, hRequest, pchParamName, pchParamValue);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter(instancePtr, hRequest, pchParamName, pchParamValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter)>::call(&point, unwrapInstance(instancePtr), hRequest, pchParamName, pchParamValue);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SendHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (SteamAPICall_t *)%p)\n", instancePtr, hRequest, pCallHandle);
-  bool  result = SteamAPI_ISteamHTTP_SendHTTPRequest(instancePtr, hRequest, pCallHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SendHTTPRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SendHTTPRequest)>::call(&point, unwrapInstance(instancePtr), hRequest, pCallHandle);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (SteamAPICall_t *)%p)\n", instancePtr, hRequest, pCallHandle);
-  bool  result = SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse(instancePtr, hRequest, pCallHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse)>::call(&point, unwrapInstance(instancePtr), hRequest, pCallHandle);
 }
 
 
 bool  SteamAPI_ISteamHTTP_DeferHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p)\n", instancePtr, hRequest);
-  bool  result = SteamAPI_ISteamHTTP_DeferHTTPRequest(instancePtr, hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_DeferHTTPRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_DeferHTTPRequest)>::call(&point, unwrapInstance(instancePtr), hRequest);
 }
 
 
 bool  SteamAPI_ISteamHTTP_PrioritizeHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p)\n", instancePtr, hRequest);
-  bool  result = SteamAPI_ISteamHTTP_PrioritizeHTTPRequest(instancePtr, hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_PrioritizeHTTPRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_PrioritizeHTTPRequest)>::call(&point, unwrapInstance(instancePtr), hRequest);
 }
 
 
 bool  SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint32 * unResponseHeaderSize)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (char *)\"%s\", (uint32 *)%d)\n", instancePtr, hRequest, pchHeaderName, unResponseHeaderSize);
-  bool  result = SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize(instancePtr, hRequest, pchHeaderName, unResponseHeaderSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize)>::call(&point, unwrapInstance(instancePtr), hRequest, pchHeaderName, unResponseHeaderSize);
 }
 
 
 bool  SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint8 * pHeaderValueBuffer, uint32  unBufferSize)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (char *)\"%s\", (uint8 *)%p, (uint32 )%d)\n", instancePtr, hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize);
-  bool  result = SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue(instancePtr, hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue", "3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue)>::call(&point, unwrapInstance(instancePtr), hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize);
 }
 
 
 bool  SteamAPI_ISteamHTTP_GetHTTPResponseBodySize_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32 * unBodySize)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (uint32 *)%d)\n", instancePtr, hRequest, unBodySize);
-  bool  result = SteamAPI_ISteamHTTP_GetHTTPResponseBodySize(instancePtr, hRequest, unBodySize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_GetHTTPResponseBodySize");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_GetHTTPResponseBodySize)>::call(&point, unwrapInstance(instancePtr), hRequest, unBodySize);
 }
 
 
 bool  SteamAPI_ISteamHTTP_GetHTTPResponseBodyData_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint8 * pBodyDataBuffer, uint32  unBufferSize)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (uint8 *)%p, (uint32 )%d)\n", instancePtr, hRequest, pBodyDataBuffer, unBufferSize);
-  bool  result = SteamAPI_ISteamHTTP_GetHTTPResponseBodyData(instancePtr, hRequest, pBodyDataBuffer, unBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_GetHTTPResponseBodyData", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_GetHTTPResponseBodyData)>::call(&point, unwrapInstance(instancePtr), hRequest, pBodyDataBuffer, unBufferSize);
 }
 
 
 bool  SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  cOffset, uint8 * pBodyDataBuffer, uint32  unBufferSize)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (uint32 )%d, (uint8 *)%p, (uint32 )%d)\n", instancePtr, hRequest, cOffset, pBodyDataBuffer, unBufferSize);
-  bool  result = SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData(instancePtr, hRequest, cOffset, pBodyDataBuffer, unBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData", "3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData)>::call(&point, unwrapInstance(instancePtr), hRequest, cOffset, pBodyDataBuffer, unBufferSize);
 }
 
 
 bool  SteamAPI_ISteamHTTP_ReleaseHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p)\n", instancePtr, hRequest);
-  bool  result = SteamAPI_ISteamHTTP_ReleaseHTTPRequest(instancePtr, hRequest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_ReleaseHTTPRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_ReleaseHTTPRequest)>::call(&point, unwrapInstance(instancePtr), hRequest);
 }
 
 
 bool  SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, float * pflPercentOut)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (float *)%f)\n", instancePtr, hRequest, pflPercentOut);
-  bool  result = SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct(instancePtr, hRequest, pflPercentOut);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct)>::call(&point, unwrapInstance(instancePtr), hRequest, pflPercentOut);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchContentType, uint8 * pubBody, uint32  unBodyLen)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (char *)\"%s\", (uint8 *)%p, (uint32 )%d)\n", instancePtr, hRequest, pchContentType, pubBody, unBodyLen);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody(instancePtr, hRequest, pchContentType, pubBody, unBodyLen);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody)>::call(&point, unwrapInstance(instancePtr), hRequest, pchContentType, pubBody, unBodyLen);
 }
 
 
 HTTPCookieContainerHandle  SteamAPI_ISteamHTTP_CreateCookieContainer_(intptr_t  instancePtr, bool  bAllowResponsesToModify)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bAllowResponsesToModify);
-  HTTPCookieContainerHandle  result = SteamAPI_ISteamHTTP_CreateCookieContainer(instancePtr, bAllowResponsesToModify);
-  TRACE("() = (HTTPCookieContainerHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_CreateCookieContainer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_CreateCookieContainer)>::call(&point, unwrapInstance(instancePtr), bAllowResponsesToModify);
 }
 
 
 bool  SteamAPI_ISteamHTTP_ReleaseCookieContainer_(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer)
 {
-  TRACE("((intptr_t )%p, (HTTPCookieContainerHandle )%p)\n", instancePtr, hCookieContainer);
-  bool  result = SteamAPI_ISteamHTTP_ReleaseCookieContainer(instancePtr, hCookieContainer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_ReleaseCookieContainer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_ReleaseCookieContainer)>::call(&point, unwrapInstance(instancePtr), hCookieContainer);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetCookie_(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer, char * pchHost, char * pchUrl, char * pchCookie)
 {
-  TRACE("((intptr_t )%p, (HTTPCookieContainerHandle )%p, (char *)\"%s\", (char *)\"%s\", (char *)\"%s\")\n", instancePtr, hCookieContainer, pchHost, pchUrl, pchCookie);
-  bool  result = SteamAPI_ISteamHTTP_SetCookie(instancePtr, hCookieContainer, pchHost, pchUrl, pchCookie);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetCookie");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetCookie)>::call(&point, unwrapInstance(instancePtr), hCookieContainer, pchHost, pchUrl, pchCookie);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, HTTPCookieContainerHandle  hCookieContainer)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (HTTPCookieContainerHandle )%p)\n", instancePtr, hRequest, hCookieContainer);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer(instancePtr, hRequest, hCookieContainer);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer)>::call(&point, unwrapInstance(instancePtr), hRequest, hCookieContainer);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchUserAgentInfo)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (char *)\"%s\")\n", instancePtr, hRequest, pchUserAgentInfo);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo(instancePtr, hRequest, pchUserAgentInfo);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo)>::call(&point, unwrapInstance(instancePtr), hRequest, pchUserAgentInfo);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool  bRequireVerifiedCertificate)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (bool )%d)\n", instancePtr, hRequest, bRequireVerifiedCertificate);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate(instancePtr, hRequest, bRequireVerifiedCertificate);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate)>::call(&point, unwrapInstance(instancePtr), hRequest, bRequireVerifiedCertificate);
 }
 
 
 bool  SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unMilliseconds)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (uint32 )%d)\n", instancePtr, hRequest, unMilliseconds);
-  bool  result = SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS(instancePtr, hRequest, unMilliseconds);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS)>::call(&point, unwrapInstance(instancePtr), hRequest, unMilliseconds);
 }
 
 
 bool  SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool * pbWasTimedOut)
 {
-  TRACE("((intptr_t )%p, (HTTPRequestHandle )%p, (bool *)%d)\n", instancePtr, hRequest, pbWasTimedOut);
-  bool  result = SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut(instancePtr, hRequest, pbWasTimedOut);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut)>::call(&point, unwrapInstance(instancePtr), hRequest, pbWasTimedOut);
 }
 
 
 ClientUnifiedMessageHandle  SteamAPI_ISteamUnifiedMessages_SendMethod_(intptr_t  instancePtr, char * pchServiceMethod, void * pRequestBuffer, uint32  unRequestBufferSize, uint64  unContext)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (void *)%p, (uint32 )%d, (uint64 )%d)\n", instancePtr, pchServiceMethod, pRequestBuffer, unRequestBufferSize, unContext);
-  ClientUnifiedMessageHandle  result = SteamAPI_ISteamUnifiedMessages_SendMethod(instancePtr, pchServiceMethod, pRequestBuffer, unRequestBufferSize, unContext);
-  TRACE("() = (ClientUnifiedMessageHandle )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUnifiedMessages_SendMethod", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUnifiedMessages_SendMethod)>::call(&point, unwrapInstance(instancePtr), pchServiceMethod, pRequestBuffer, unRequestBufferSize, unContext);
 }
 
 
 bool  SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo_(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, uint32 * punResponseSize, EResult * peResult)
 {
-  TRACE("((intptr_t )%p, (ClientUnifiedMessageHandle )%p, (uint32 *)%d, (EResult *)%p)\n", instancePtr, hHandle, punResponseSize, peResult);
-  bool  result = SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo(instancePtr, hHandle, punResponseSize, peResult);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo)>::call(&point, unwrapInstance(instancePtr), hHandle, punResponseSize, peResult);
 }
 
 
 bool  SteamAPI_ISteamUnifiedMessages_GetMethodResponseData_(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, void * pResponseBuffer, uint32  unResponseBufferSize, bool  bAutoRelease)
 {
-  TRACE("((intptr_t )%p, (ClientUnifiedMessageHandle )%p, (void *)%p, (uint32 )%d, (bool )%d)\n", instancePtr, hHandle, pResponseBuffer, unResponseBufferSize, bAutoRelease);
-  bool  result = SteamAPI_ISteamUnifiedMessages_GetMethodResponseData(instancePtr, hHandle, pResponseBuffer, unResponseBufferSize, bAutoRelease);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUnifiedMessages_GetMethodResponseData", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUnifiedMessages_GetMethodResponseData)>::call(&point, unwrapInstance(instancePtr), hHandle, pResponseBuffer, unResponseBufferSize, bAutoRelease);
 }
 
 
 bool  SteamAPI_ISteamUnifiedMessages_ReleaseMethod_(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle)
 {
-  TRACE("((intptr_t )%p, (ClientUnifiedMessageHandle )%p)\n", instancePtr, hHandle);
-  bool  result = SteamAPI_ISteamUnifiedMessages_ReleaseMethod(instancePtr, hHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUnifiedMessages_ReleaseMethod");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUnifiedMessages_ReleaseMethod)>::call(&point, unwrapInstance(instancePtr), hHandle);
 }
 
 
 bool  SteamAPI_ISteamUnifiedMessages_SendNotification_(intptr_t  instancePtr, char * pchServiceNotification, void * pNotificationBuffer, uint32  unNotificationBufferSize)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (void *)%p, (uint32 )%d)\n", instancePtr, pchServiceNotification, pNotificationBuffer, unNotificationBufferSize);
-  bool  result = SteamAPI_ISteamUnifiedMessages_SendNotification(instancePtr, pchServiceNotification, pNotificationBuffer, unNotificationBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUnifiedMessages_SendNotification", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUnifiedMessages_SendNotification)>::call(&point, unwrapInstance(instancePtr), pchServiceNotification, pNotificationBuffer, unNotificationBufferSize);
 }
 
 
 bool  SteamAPI_ISteamController_Init_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamController_Init(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamController_Init");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamController_Init), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamController_Shutdown_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamController_Shutdown(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamController_Shutdown");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamController_Shutdown), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamController_RunFrame_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamController_RunFrame(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamController_RunFrame");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamController_RunFrame), true>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamController_TriggerHapticPulse_(intptr_t  instancePtr, ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec)
 {
-  TRACE("((intptr_t )%p, (ControllerHandle_t )%p, (ESteamControllerPad )%p, (unsigned short )%p)\n", instancePtr, controllerHandle, eTargetPad, usDurationMicroSec);
-  SteamAPI_ISteamController_TriggerHapticPulse(instancePtr, controllerHandle, eTargetPad, usDurationMicroSec);
-  
+  static ProfilePoint point("SteamAPI_ISteamController_TriggerHapticPulse");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamController_TriggerHapticPulse), true>::call(&point, unwrapInstance(instancePtr), controllerHandle, eTargetPad, usDurationMicroSec);
 }
 
 
 UGCQueryHandle_t  SteamAPI_ISteamUGC_CreateQueryUserUGCRequest_(intptr_t  instancePtr, AccountID_t  unAccountID, EUserUGCList  eListType, EUGCMatchingUGCType  eMatchingUGCType, EUserUGCListSortOrder  eSortOrder, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
 {
-  TRACE("((intptr_t )%p, (AccountID_t )%p, (EUserUGCList )%p, (EUGCMatchingUGCType )%p, (EUserUGCListSortOrder )%p, (AppId_t )%p, (AppId_t )%p, (uint32 )%d)\n", instancePtr, unAccountID, eListType, eMatchingUGCType, eSortOrder, nCreatorAppID, nConsumerAppID, unPage);
-  UGCQueryHandle_t  result = SteamAPI_ISteamUGC_CreateQueryUserUGCRequest(instancePtr, unAccountID, eListType, eMatchingUGCType, eSortOrder, nCreatorAppID, nConsumerAppID, unPage);
-  TRACE("() = (UGCQueryHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_CreateQueryUserUGCRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_CreateQueryUserUGCRequest)>::call(&point, unwrapInstance(instancePtr), unAccountID, eListType, eMatchingUGCType, eSortOrder, nCreatorAppID, nConsumerAppID, unPage);
 }
 
 
 UGCQueryHandle_t  SteamAPI_ISteamUGC_CreateQueryAllUGCRequest_(intptr_t  instancePtr, EUGCQuery  eQueryType, EUGCMatchingUGCType  eMatchingeMatchingUGCTypeFileType, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage)
 {
-  TRACE("((intptr_t )%p, (EUGCQuery )%p, (EUGCMatchingUGCType )%p, (AppId_t )%p, (AppId_t )%p, (uint32 )%d)\n", instancePtr, eQueryType, eMatchingeMatchingUGCTypeFileType, nCreatorAppID, nConsumerAppID, unPage);
-  UGCQueryHandle_t  result = SteamAPI_ISteamUGC_CreateQueryAllUGCRequest(instancePtr, eQueryType, eMatchingeMatchingUGCTypeFileType, nCreatorAppID, nConsumerAppID, unPage);
-  TRACE("() = (UGCQueryHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_CreateQueryAllUGCRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_CreateQueryAllUGCRequest)>::call(&point, unwrapInstance(instancePtr), eQueryType, eMatchingeMatchingUGCTypeFileType, nCreatorAppID, nConsumerAppID, unPage);
 }
 
 
 UGCQueryHandle_t  SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest_(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t *)%p, (uint32 )%d)\n", instancePtr, pvecPublishedFileID, unNumPublishedFileIDs);
-  UGCQueryHandle_t  result = SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest(instancePtr, pvecPublishedFileID, unNumPublishedFileIDs);
-  TRACE("() = (UGCQueryHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest)>::call(&point, unwrapInstance(instancePtr), pvecPublishedFileID, unNumPublishedFileIDs);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_SendQueryUGCRequest_(intptr_t  instancePtr, UGCQueryHandle_t  handle)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p)\n", instancePtr, handle);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_SendQueryUGCRequest(instancePtr, handle);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SendQueryUGCRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SendQueryUGCRequest)>::call(&point, unwrapInstance(instancePtr), handle);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetQueryUGCResult_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, SteamUGCDetails_t * pDetails)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d, (SteamUGCDetails_t *)%p)\n", instancePtr, handle, index, pDetails);
-  bool  result = SteamAPI_ISteamUGC_GetQueryUGCResult(instancePtr, handle, index, pDetails);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetQueryUGCResult");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetQueryUGCResult)>::call(&point, unwrapInstance(instancePtr), handle, index, pDetails);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetQueryUGCPreviewURL_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchURL, uint32  cchURLSize)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d, (char *)\"%s\", (uint32 )%d)\n", instancePtr, handle, index, pchURL, cchURLSize);
-  bool  result = SteamAPI_ISteamUGC_GetQueryUGCPreviewURL(instancePtr, handle, index, pchURL, cchURLSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetQueryUGCPreviewURL", "3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetQueryUGCPreviewURL)>::call(&point, unwrapInstance(instancePtr), handle, index, pchURL, cchURLSize);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetQueryUGCMetadata_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchMetadata, uint32  cchMetadatasize)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d, (char *)\"%s\", (uint32 )%d)\n", instancePtr, handle, index, pchMetadata, cchMetadatasize);
-  bool  result = SteamAPI_ISteamUGC_GetQueryUGCMetadata(instancePtr, handle, index, pchMetadata, cchMetadatasize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetQueryUGCMetadata", "3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetQueryUGCMetadata)>::call(&point, unwrapInstance(instancePtr), handle, index, pchMetadata, cchMetadatasize);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetQueryUGCChildren_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d, (PublishedFileId_t *)%p, (uint32 )%d)\n", instancePtr, handle, index, pvecPublishedFileID, cMaxEntries);
-  bool  result = SteamAPI_ISteamUGC_GetQueryUGCChildren(instancePtr, handle, index, pvecPublishedFileID, cMaxEntries);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetQueryUGCChildren");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetQueryUGCChildren)>::call(&point, unwrapInstance(instancePtr), handle, index, pvecPublishedFileID, cMaxEntries);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetQueryUGCStatistic_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, EItemStatistic  eStatType, uint64 * pStatValue)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d, (EItemStatistic )%p, (uint64 *)%d)\n", instancePtr, handle, index, eStatType, pStatValue);
-  bool  result = SteamAPI_ISteamUGC_GetQueryUGCStatistic(instancePtr, handle, index, eStatType, pStatValue);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetQueryUGCStatistic");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetQueryUGCStatistic)>::call(&point, unwrapInstance(instancePtr), handle, index, eStatType, pStatValue);
 }
 
 
 uint32  SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d)\n", instancePtr, handle, index);
-  uint32  result = SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews(instancePtr, handle, index);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews)>::call(&point, unwrapInstance(instancePtr), handle, index);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, uint32  previewIndex, char * pchURLOrVideoID, uint32  cchURLSize, char * pchOriginalFileName, uint32  cchOriginalFileNameSize, EItemPreviewType * pPreviewType)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d, (uint32 )%d, (char *)\"%s\", (uint32 )%d, (char *)\"%s\", (uint32 )%d, (EItemPreviewType *)%p)\n", instancePtr, handle, index, previewIndex, pchURLOrVideoID, cchURLSize, pchOriginalFileName, cchOriginalFileNameSize, pPreviewType);
-  bool  result = SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview(instancePtr, handle, index, previewIndex, pchURLOrVideoID, cchURLSize, pchOriginalFileName, cchOriginalFileNameSize, pPreviewType);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview", "4:5 6:7");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview)>::call(&point, unwrapInstance(instancePtr), handle, index, previewIndex, pchURLOrVideoID, cchURLSize, pchOriginalFileName, cchOriginalFileNameSize, pPreviewType);
 }
 
 
 bool  SteamAPI_ISteamUGC_ReleaseQueryUGCRequest_(intptr_t  instancePtr, UGCQueryHandle_t  handle)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p)\n", instancePtr, handle);
-  bool  result = SteamAPI_ISteamUGC_ReleaseQueryUGCRequest(instancePtr, handle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_ReleaseQueryUGCRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_ReleaseQueryUGCRequest)>::call(&point, unwrapInstance(instancePtr), handle);
 }
 
 
 bool  SteamAPI_ISteamUGC_AddRequiredTag_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pTagName);
-  bool  result = SteamAPI_ISteamUGC_AddRequiredTag(instancePtr, handle, pTagName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_AddRequiredTag");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_AddRequiredTag)>::call(&point, unwrapInstance(instancePtr), handle, pTagName);
 }
 
 
 bool  SteamAPI_ISteamUGC_AddExcludedTag_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pTagName);
-  bool  result = SteamAPI_ISteamUGC_AddExcludedTag(instancePtr, handle, pTagName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_AddExcludedTag");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_AddExcludedTag)>::call(&point, unwrapInstance(instancePtr), handle, pTagName);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetReturnLongDescription_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnLongDescription)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (bool )%d)\n", instancePtr, handle, bReturnLongDescription);
-  bool  result = SteamAPI_ISteamUGC_SetReturnLongDescription(instancePtr, handle, bReturnLongDescription);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetReturnLongDescription");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetReturnLongDescription)>::call(&point, unwrapInstance(instancePtr), handle, bReturnLongDescription);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetReturnMetadata_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnMetadata)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (bool )%d)\n", instancePtr, handle, bReturnMetadata);
-  bool  result = SteamAPI_ISteamUGC_SetReturnMetadata(instancePtr, handle, bReturnMetadata);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetReturnMetadata");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetReturnMetadata)>::call(&point, unwrapInstance(instancePtr), handle, bReturnMetadata);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetReturnChildren_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnChildren)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (bool )%d)\n", instancePtr, handle, bReturnChildren);
-  bool  result = SteamAPI_ISteamUGC_SetReturnChildren(instancePtr, handle, bReturnChildren);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetReturnChildren");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetReturnChildren)>::call(&point, unwrapInstance(instancePtr), handle, bReturnChildren);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetReturnAdditionalPreviews_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnAdditionalPreviews)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (bool )%d)\n", instancePtr, handle, bReturnAdditionalPreviews);
-  bool  result = SteamAPI_ISteamUGC_SetReturnAdditionalPreviews(instancePtr, handle, bReturnAdditionalPreviews);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetReturnAdditionalPreviews");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetReturnAdditionalPreviews)>::call(&point, unwrapInstance(instancePtr), handle, bReturnAdditionalPreviews);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetReturnTotalOnly_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnTotalOnly)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (bool )%d)\n", instancePtr, handle, bReturnTotalOnly);
-  bool  result = SteamAPI_ISteamUGC_SetReturnTotalOnly(instancePtr, handle, bReturnTotalOnly);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetReturnTotalOnly");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetReturnTotalOnly)>::call(&point, unwrapInstance(instancePtr), handle, bReturnTotalOnly);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetAllowCachedResponse_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unMaxAgeSeconds)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d)\n", instancePtr, handle, unMaxAgeSeconds);
-  bool  result = SteamAPI_ISteamUGC_SetAllowCachedResponse(instancePtr, handle, unMaxAgeSeconds);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetAllowCachedResponse");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetAllowCachedResponse)>::call(&point, unwrapInstance(instancePtr), handle, unMaxAgeSeconds);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetCloudFileNameFilter_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pMatchCloudFileName)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pMatchCloudFileName);
-  bool  result = SteamAPI_ISteamUGC_SetCloudFileNameFilter(instancePtr, handle, pMatchCloudFileName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetCloudFileNameFilter");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetCloudFileNameFilter)>::call(&point, unwrapInstance(instancePtr), handle, pMatchCloudFileName);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetMatchAnyTag_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bMatchAnyTag)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (bool )%d)\n", instancePtr, handle, bMatchAnyTag);
-  bool  result = SteamAPI_ISteamUGC_SetMatchAnyTag(instancePtr, handle, bMatchAnyTag);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetMatchAnyTag");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetMatchAnyTag)>::call(&point, unwrapInstance(instancePtr), handle, bMatchAnyTag);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetSearchText_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pSearchText)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pSearchText);
-  bool  result = SteamAPI_ISteamUGC_SetSearchText(instancePtr, handle, pSearchText);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetSearchText");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetSearchText)>::call(&point, unwrapInstance(instancePtr), handle, pSearchText);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetRankedByTrendDays_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unDays)
 {
-  TRACE("((intptr_t )%p, (UGCQueryHandle_t )%p, (uint32 )%d)\n", instancePtr, handle, unDays);
-  bool  result = SteamAPI_ISteamUGC_SetRankedByTrendDays(instancePtr, handle, unDays);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetRankedByTrendDays");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetRankedByTrendDays)>::call(&point, unwrapInstance(instancePtr), handle, unDays);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_RequestUGCDetails_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint32  unMaxAgeSeconds)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p, (uint32 )%d)\n", instancePtr, nPublishedFileID, unMaxAgeSeconds);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_RequestUGCDetails(instancePtr, nPublishedFileID, unMaxAgeSeconds);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_RequestUGCDetails");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_RequestUGCDetails)>::call(&point, unwrapInstance(instancePtr), nPublishedFileID, unMaxAgeSeconds);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_CreateItem_(intptr_t  instancePtr, AppId_t  nConsumerAppId, EWorkshopFileType  eFileType)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (EWorkshopFileType )%p)\n", instancePtr, nConsumerAppId, eFileType);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_CreateItem(instancePtr, nConsumerAppId, eFileType);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_CreateItem");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_CreateItem)>::call(&point, unwrapInstance(instancePtr), nConsumerAppId, eFileType);
 }
 
 
 UGCUpdateHandle_t  SteamAPI_ISteamUGC_StartItemUpdate_(intptr_t  instancePtr, AppId_t  nConsumerAppId, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (PublishedFileId_t )%p)\n", instancePtr, nConsumerAppId, nPublishedFileID);
-  UGCUpdateHandle_t  result = SteamAPI_ISteamUGC_StartItemUpdate(instancePtr, nConsumerAppId, nPublishedFileID);
-  TRACE("() = (UGCUpdateHandle_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_StartItemUpdate");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_StartItemUpdate)>::call(&point, unwrapInstance(instancePtr), nConsumerAppId, nPublishedFileID);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetItemTitle_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchTitle)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pchTitle);
-  bool  result = SteamAPI_ISteamUGC_SetItemTitle(instancePtr, handle, pchTitle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetItemTitle");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetItemTitle)>::call(&point, unwrapInstance(instancePtr), handle, pchTitle);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetItemDescription_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchDescription)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pchDescription);
-  bool  result = SteamAPI_ISteamUGC_SetItemDescription(instancePtr, handle, pchDescription);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetItemDescription");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetItemDescription)>::call(&point, unwrapInstance(instancePtr), handle, pchDescription);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetItemMetadata_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchMetaData)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pchMetaData);
-  bool  result = SteamAPI_ISteamUGC_SetItemMetadata(instancePtr, handle, pchMetaData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetItemMetadata");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetItemMetadata)>::call(&point, unwrapInstance(instancePtr), handle, pchMetaData);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetItemVisibility_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, ERemoteStoragePublishedFileVisibility  eVisibility)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (ERemoteStoragePublishedFileVisibility )%p)\n", instancePtr, handle, eVisibility);
-  bool  result = SteamAPI_ISteamUGC_SetItemVisibility(instancePtr, handle, eVisibility);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetItemVisibility");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetItemVisibility)>::call(&point, unwrapInstance(instancePtr), handle, eVisibility);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetItemTags_(intptr_t  instancePtr, UGCUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (SteamParamStringArray_t *)%p)\n", instancePtr, updateHandle, pTags);
-  bool  result = SteamAPI_ISteamUGC_SetItemTags(instancePtr, updateHandle, pTags);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetItemTags");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetItemTags)>::call(&point, unwrapInstance(instancePtr), updateHandle, pTags);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetItemContent_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszContentFolder)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pszContentFolder);
-  bool  result = SteamAPI_ISteamUGC_SetItemContent(instancePtr, handle, pszContentFolder);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetItemContent");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetItemContent)>::call(&point, unwrapInstance(instancePtr), handle, pszContentFolder);
 }
 
 
 bool  SteamAPI_ISteamUGC_SetItemPreview_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszPreviewFile)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pszPreviewFile);
-  bool  result = SteamAPI_ISteamUGC_SetItemPreview(instancePtr, handle, pszPreviewFile);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SetItemPreview");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SetItemPreview)>::call(&point, unwrapInstance(instancePtr), handle, pszPreviewFile);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_SubmitItemUpdate_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchChangeNote)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (char *)\"%s\")\n", instancePtr, handle, pchChangeNote);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_SubmitItemUpdate(instancePtr, handle, pchChangeNote);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SubmitItemUpdate");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SubmitItemUpdate)>::call(&point, unwrapInstance(instancePtr), handle, pchChangeNote);
 }
 
 
 EItemUpdateStatus  SteamAPI_ISteamUGC_GetItemUpdateProgress_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, uint64 * punBytesProcessed, uint64 * punBytesTotal)
 {
-  TRACE("((intptr_t )%p, (UGCUpdateHandle_t )%p, (uint64 *)%d, (uint64 *)%d)\n", instancePtr, handle, punBytesProcessed, punBytesTotal);
-  EItemUpdateStatus  result = SteamAPI_ISteamUGC_GetItemUpdateProgress(instancePtr, handle, punBytesProcessed, punBytesTotal);
-  TRACE("() = (EItemUpdateStatus )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetItemUpdateProgress");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetItemUpdateProgress)>::call(&point, unwrapInstance(instancePtr), handle, punBytesProcessed, punBytesTotal);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_AddItemToFavorites_(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (PublishedFileId_t )%p)\n", instancePtr, nAppId, nPublishedFileID);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_AddItemToFavorites(instancePtr, nAppId, nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_AddItemToFavorites");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_AddItemToFavorites)>::call(&point, unwrapInstance(instancePtr), nAppId, nPublishedFileID);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_RemoveItemFromFavorites_(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (PublishedFileId_t )%p)\n", instancePtr, nAppId, nPublishedFileID);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_RemoveItemFromFavorites(instancePtr, nAppId, nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_RemoveItemFromFavorites");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_RemoveItemFromFavorites)>::call(&point, unwrapInstance(instancePtr), nAppId, nPublishedFileID);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_SubscribeItem_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, nPublishedFileID);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_SubscribeItem(instancePtr, nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_SubscribeItem");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_SubscribeItem)>::call(&point, unwrapInstance(instancePtr), nPublishedFileID);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamUGC_UnsubscribeItem_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, nPublishedFileID);
-  SteamAPICall_t  result = SteamAPI_ISteamUGC_UnsubscribeItem(instancePtr, nPublishedFileID);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_UnsubscribeItem");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_UnsubscribeItem)>::call(&point, unwrapInstance(instancePtr), nPublishedFileID);
 }
 
 
 uint32  SteamAPI_ISteamUGC_GetNumSubscribedItems_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamUGC_GetNumSubscribedItems(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetNumSubscribedItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetNumSubscribedItems)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint32  SteamAPI_ISteamUGC_GetSubscribedItems_(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t *)%p, (uint32 )%d)\n", instancePtr, pvecPublishedFileID, cMaxEntries);
-  uint32  result = SteamAPI_ISteamUGC_GetSubscribedItems(instancePtr, pvecPublishedFileID, cMaxEntries);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetSubscribedItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetSubscribedItems)>::call(&point, unwrapInstance(instancePtr), pvecPublishedFileID, cMaxEntries);
 }
 
 
 uint32  SteamAPI_ISteamUGC_GetItemState_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p)\n", instancePtr, nPublishedFileID);
-  uint32  result = SteamAPI_ISteamUGC_GetItemState(instancePtr, nPublishedFileID);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetItemState");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetItemState)>::call(&point, unwrapInstance(instancePtr), nPublishedFileID);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetItemInstallInfo_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punSizeOnDisk, char * pchFolder, uint32  cchFolderSize, uint32 * punTimeStamp)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p, (uint64 *)%d, (char *)\"%s\", (uint32 )%d, (uint32 *)%d)\n", instancePtr, nPublishedFileID, punSizeOnDisk, pchFolder, cchFolderSize, punTimeStamp);
-  bool  result = SteamAPI_ISteamUGC_GetItemInstallInfo(instancePtr, nPublishedFileID, punSizeOnDisk, pchFolder, cchFolderSize, punTimeStamp);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetItemInstallInfo", "3:4");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetItemInstallInfo)>::call(&point, unwrapInstance(instancePtr), nPublishedFileID, punSizeOnDisk, pchFolder, cchFolderSize, punTimeStamp);
 }
 
 
 bool  SteamAPI_ISteamUGC_GetItemDownloadInfo_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punBytesDownloaded, uint64 * punBytesTotal)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p, (uint64 *)%d, (uint64 *)%d)\n", instancePtr, nPublishedFileID, punBytesDownloaded, punBytesTotal);
-  bool  result = SteamAPI_ISteamUGC_GetItemDownloadInfo(instancePtr, nPublishedFileID, punBytesDownloaded, punBytesTotal);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_GetItemDownloadInfo");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_GetItemDownloadInfo)>::call(&point, unwrapInstance(instancePtr), nPublishedFileID, punBytesDownloaded, punBytesTotal);
 }
 
 
 bool  SteamAPI_ISteamUGC_DownloadItem_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, bool  bHighPriority)
 {
-  TRACE("((intptr_t )%p, (PublishedFileId_t )%p, (bool )%d)\n", instancePtr, nPublishedFileID, bHighPriority);
-  bool  result = SteamAPI_ISteamUGC_DownloadItem(instancePtr, nPublishedFileID, bHighPriority);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamUGC_DownloadItem");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamUGC_DownloadItem)>::call(&point, unwrapInstance(instancePtr), nPublishedFileID, bHighPriority);
 }
 
 
 uint32  SteamAPI_ISteamAppList_GetNumInstalledApps_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamAppList_GetNumInstalledApps(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamAppList_GetNumInstalledApps");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamAppList_GetNumInstalledApps)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint32  SteamAPI_ISteamAppList_GetInstalledApps_(intptr_t  instancePtr, AppId_t * pvecAppID, uint32  unMaxAppIDs)
 {
-  TRACE("((intptr_t )%p, (AppId_t *)%p, (uint32 )%d)\n", instancePtr, pvecAppID, unMaxAppIDs);
-  uint32  result = SteamAPI_ISteamAppList_GetInstalledApps(instancePtr, pvecAppID, unMaxAppIDs);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamAppList_GetInstalledApps");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamAppList_GetInstalledApps)>::call(&point, unwrapInstance(instancePtr), pvecAppID, unMaxAppIDs);
 }
 
 
 int  SteamAPI_ISteamAppList_GetAppName_(intptr_t  instancePtr, AppId_t  nAppID, char * pchName, int  cchNameMax)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (char *)\"%s\", (int )%d)\n", instancePtr, nAppID, pchName, cchNameMax);
-  int  result = SteamAPI_ISteamAppList_GetAppName(instancePtr, nAppID, pchName, cchNameMax);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamAppList_GetAppName", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamAppList_GetAppName)>::call(&point, unwrapInstance(instancePtr), nAppID, pchName, cchNameMax);
 }
 
 
 int  SteamAPI_ISteamAppList_GetAppInstallDir_(intptr_t  instancePtr, AppId_t  nAppID, char * pchDirectory, int  cchNameMax)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p, (char *)\"%s\", (int )%d)\n", instancePtr, nAppID, pchDirectory, cchNameMax);
-  int  result = SteamAPI_ISteamAppList_GetAppInstallDir(instancePtr, nAppID, pchDirectory, cchNameMax);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamAppList_GetAppInstallDir", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamAppList_GetAppInstallDir)>::call(&point, unwrapInstance(instancePtr), nAppID, pchDirectory, cchNameMax);
 }
 
 
 int  SteamAPI_ISteamAppList_GetAppBuildId_(intptr_t  instancePtr, AppId_t  nAppID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, nAppID);
-  int  result = SteamAPI_ISteamAppList_GetAppBuildId(instancePtr, nAppID);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamAppList_GetAppBuildId");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamAppList_GetAppBuildId)>::call(&point, unwrapInstance(instancePtr), nAppID);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamHTMLSurface_Init_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamHTMLSurface_Init(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_Init");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_Init)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamHTMLSurface_Shutdown_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamHTMLSurface_Shutdown(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_Shutdown");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_Shutdown)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamHTMLSurface_CreateBrowser_(intptr_t  instancePtr, char * pchUserAgent, char * pchUserCSS)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, pchUserAgent, pchUserCSS);
-  SteamAPICall_t  result = SteamAPI_ISteamHTMLSurface_CreateBrowser(instancePtr, pchUserAgent, pchUserCSS);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_CreateBrowser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_CreateBrowser)>::call(&point, unwrapInstance(instancePtr), pchUserAgent, pchUserCSS);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_RemoveBrowser_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_RemoveBrowser(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_RemoveBrowser");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_RemoveBrowser)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_LoadURL_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchURL, char * pchPostData)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, unBrowserHandle, pchURL, pchPostData);
-  SteamAPI_ISteamHTMLSurface_LoadURL(instancePtr, unBrowserHandle, pchURL, pchPostData);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_LoadURL");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_LoadURL)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, pchURL, pchPostData);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_SetSize_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  unWidth, uint32  unHeight)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (uint32 )%d, (uint32 )%d)\n", instancePtr, unBrowserHandle, unWidth, unHeight);
-  SteamAPI_ISteamHTMLSurface_SetSize(instancePtr, unBrowserHandle, unWidth, unHeight);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_SetSize");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_SetSize)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, unWidth, unHeight);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_StopLoad_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_StopLoad(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_StopLoad");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_StopLoad)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_Reload_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_Reload(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_Reload");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_Reload)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_GoBack_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_GoBack(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_GoBack");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_GoBack)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_GoForward_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_GoForward(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_GoForward");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_GoForward)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_AddHeader_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchKey, char * pchValue)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, unBrowserHandle, pchKey, pchValue);
-  SteamAPI_ISteamHTMLSurface_AddHeader(instancePtr, unBrowserHandle, pchKey, pchValue);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_AddHeader");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_AddHeader)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, pchKey, pchValue);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_ExecuteJavascript_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchScript)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (char *)\"%s\")\n", instancePtr, unBrowserHandle, pchScript);
-  SteamAPI_ISteamHTMLSurface_ExecuteJavascript(instancePtr, unBrowserHandle, pchScript);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_ExecuteJavascript");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_ExecuteJavascript)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, pchScript);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_MouseUp_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (ISteamHTMLSurface::EHTMLMouseButton )%p)\n", instancePtr, unBrowserHandle, eMouseButton);
-  SteamAPI_ISteamHTMLSurface_MouseUp(instancePtr, unBrowserHandle, eMouseButton);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_MouseUp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_MouseUp)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, eMouseButton);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_MouseDown_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (ISteamHTMLSurface::EHTMLMouseButton )%p)\n", instancePtr, unBrowserHandle, eMouseButton);
-  SteamAPI_ISteamHTMLSurface_MouseDown(instancePtr, unBrowserHandle, eMouseButton);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_MouseDown");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_MouseDown)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, eMouseButton);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_MouseDoubleClick_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (ISteamHTMLSurface::EHTMLMouseButton )%p)\n", instancePtr, unBrowserHandle, eMouseButton);
-  SteamAPI_ISteamHTMLSurface_MouseDoubleClick(instancePtr, unBrowserHandle, eMouseButton);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_MouseDoubleClick");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_MouseDoubleClick)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, eMouseButton);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_MouseMove_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (int )%d, (int )%d)\n", instancePtr, unBrowserHandle, x, y);
-  SteamAPI_ISteamHTMLSurface_MouseMove(instancePtr, unBrowserHandle, x, y);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_MouseMove");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_MouseMove)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, x, y);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_MouseWheel_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int32  nDelta)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (int32 )%d)\n", instancePtr, unBrowserHandle, nDelta);
-  SteamAPI_ISteamHTMLSurface_MouseWheel(instancePtr, unBrowserHandle, nDelta);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_MouseWheel");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_MouseWheel)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, nDelta);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_KeyDown_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (uint32 )%d, (ISteamHTMLSurface::EHTMLKeyModifiers )%p)\n", instancePtr, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  SteamAPI_ISteamHTMLSurface_KeyDown(instancePtr, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_KeyDown");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_KeyDown)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_KeyUp_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (uint32 )%d, (ISteamHTMLSurface::EHTMLKeyModifiers )%p)\n", instancePtr, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  SteamAPI_ISteamHTMLSurface_KeyUp(instancePtr, unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_KeyUp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_KeyUp)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, nNativeKeyCode, eHTMLKeyModifiers);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_KeyChar_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  cUnicodeChar, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (uint32 )%d, (ISteamHTMLSurface::EHTMLKeyModifiers )%p)\n", instancePtr, unBrowserHandle, cUnicodeChar, eHTMLKeyModifiers);
-  SteamAPI_ISteamHTMLSurface_KeyChar(instancePtr, unBrowserHandle, cUnicodeChar, eHTMLKeyModifiers);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_KeyChar");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_KeyChar)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, cUnicodeChar, eHTMLKeyModifiers);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_SetHorizontalScroll_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (uint32 )%d)\n", instancePtr, unBrowserHandle, nAbsolutePixelScroll);
-  SteamAPI_ISteamHTMLSurface_SetHorizontalScroll(instancePtr, unBrowserHandle, nAbsolutePixelScroll);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_SetHorizontalScroll");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_SetHorizontalScroll)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, nAbsolutePixelScroll);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_SetVerticalScroll_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (uint32 )%d)\n", instancePtr, unBrowserHandle, nAbsolutePixelScroll);
-  SteamAPI_ISteamHTMLSurface_SetVerticalScroll(instancePtr, unBrowserHandle, nAbsolutePixelScroll);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_SetVerticalScroll");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_SetVerticalScroll)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, nAbsolutePixelScroll);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_SetKeyFocus_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bHasKeyFocus)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (bool )%d)\n", instancePtr, unBrowserHandle, bHasKeyFocus);
-  SteamAPI_ISteamHTMLSurface_SetKeyFocus(instancePtr, unBrowserHandle, bHasKeyFocus);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_SetKeyFocus");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_SetKeyFocus)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, bHasKeyFocus);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_ViewSource_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_ViewSource(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_ViewSource");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_ViewSource)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_CopyToClipboard_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_CopyToClipboard(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_CopyToClipboard");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_CopyToClipboard)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_PasteFromClipboard_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_PasteFromClipboard(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_PasteFromClipboard");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_PasteFromClipboard)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_Find_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchSearchStr, bool  bCurrentlyInFind, bool  bReverse)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (char *)\"%s\", (bool )%d, (bool )%d)\n", instancePtr, unBrowserHandle, pchSearchStr, bCurrentlyInFind, bReverse);
-  SteamAPI_ISteamHTMLSurface_Find(instancePtr, unBrowserHandle, pchSearchStr, bCurrentlyInFind, bReverse);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_Find");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_Find)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, pchSearchStr, bCurrentlyInFind, bReverse);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_StopFind_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p)\n", instancePtr, unBrowserHandle);
-  SteamAPI_ISteamHTMLSurface_StopFind(instancePtr, unBrowserHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_StopFind");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_StopFind)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_GetLinkAtPosition_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (int )%d, (int )%d)\n", instancePtr, unBrowserHandle, x, y);
-  SteamAPI_ISteamHTMLSurface_GetLinkAtPosition(instancePtr, unBrowserHandle, x, y);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_GetLinkAtPosition");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_GetLinkAtPosition)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, x, y);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_SetCookie_(intptr_t  instancePtr, char * pchHostname, char * pchKey, char * pchValue, char * pchPath, RTime32  nExpires, bool  bSecure, bool  bHTTPOnly)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\", (char *)\"%s\", (char *)\"%s\", (RTime32 )%p, (bool )%d, (bool )%d)\n", instancePtr, pchHostname, pchKey, pchValue, pchPath, nExpires, bSecure, bHTTPOnly);
-  SteamAPI_ISteamHTMLSurface_SetCookie(instancePtr, pchHostname, pchKey, pchValue, pchPath, nExpires, bSecure, bHTTPOnly);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_SetCookie");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_SetCookie)>::call(&point, unwrapInstance(instancePtr), pchHostname, pchKey, pchValue, pchPath, nExpires, bSecure, bHTTPOnly);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_SetPageScaleFactor_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, float  flZoom, int  nPointX, int  nPointY)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (float )%f, (int )%d, (int )%d)\n", instancePtr, unBrowserHandle, flZoom, nPointX, nPointY);
-  SteamAPI_ISteamHTMLSurface_SetPageScaleFactor(instancePtr, unBrowserHandle, flZoom, nPointX, nPointY);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_SetPageScaleFactor");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_SetPageScaleFactor)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, flZoom, nPointX, nPointY);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_SetBackgroundMode_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bBackgroundMode)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (bool )%d)\n", instancePtr, unBrowserHandle, bBackgroundMode);
-  SteamAPI_ISteamHTMLSurface_SetBackgroundMode(instancePtr, unBrowserHandle, bBackgroundMode);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_SetBackgroundMode");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_SetBackgroundMode)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, bBackgroundMode);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_AllowStartRequest_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bAllowed)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (bool )%d)\n", instancePtr, unBrowserHandle, bAllowed);
-  SteamAPI_ISteamHTMLSurface_AllowStartRequest(instancePtr, unBrowserHandle, bAllowed);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_AllowStartRequest");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_AllowStartRequest)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, bAllowed);
 }
 
 
 void  SteamAPI_ISteamHTMLSurface_JSDialogResponse_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bResult)
 {
-  TRACE("((intptr_t )%p, (HHTMLBrowser )%p, (bool )%d)\n", instancePtr, unBrowserHandle, bResult);
-  SteamAPI_ISteamHTMLSurface_JSDialogResponse(instancePtr, unBrowserHandle, bResult);
-  
+  static ProfilePoint point("SteamAPI_ISteamHTMLSurface_JSDialogResponse");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamHTMLSurface_JSDialogResponse)>::call(&point, unwrapInstance(instancePtr), unBrowserHandle, bResult);
 }
 
 
 EResult  SteamAPI_ISteamInventory_GetResultStatus_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t )%p)\n", instancePtr, resultHandle);
-  EResult  result = SteamAPI_ISteamInventory_GetResultStatus(instancePtr, resultHandle);
-  TRACE("() = (EResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GetResultStatus");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GetResultStatus)>::call(&point, unwrapInstance(instancePtr), resultHandle);
 }
 
 
 bool  SteamAPI_ISteamInventory_GetResultItems_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, SteamItemDetails_t * pOutItemsArray, uint32 * punOutItemsArraySize)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t )%p, (SteamItemDetails_t *)%p, (uint32 *)%d)\n", instancePtr, resultHandle, pOutItemsArray, punOutItemsArraySize);
-  bool  result = SteamAPI_ISteamInventory_GetResultItems(instancePtr, resultHandle, pOutItemsArray, punOutItemsArraySize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GetResultItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GetResultItems)>::call(&point, unwrapInstance(instancePtr), resultHandle, pOutItemsArray, punOutItemsArraySize);
 }
 
 
 uint32  SteamAPI_ISteamInventory_GetResultTimestamp_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t )%p)\n", instancePtr, resultHandle);
-  uint32  result = SteamAPI_ISteamInventory_GetResultTimestamp(instancePtr, resultHandle);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GetResultTimestamp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GetResultTimestamp)>::call(&point, unwrapInstance(instancePtr), resultHandle);
 }
 
 
 bool  SteamAPI_ISteamInventory_CheckResultSteamID_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, CSteamID  steamIDExpected)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t )%p, (CSteamID )%p)\n", instancePtr, resultHandle, steamIDExpected);
-  bool  result = SteamAPI_ISteamInventory_CheckResultSteamID(instancePtr, resultHandle, steamIDExpected);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_CheckResultSteamID");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_CheckResultSteamID)>::call(&point, unwrapInstance(instancePtr), resultHandle, steamIDExpected);
 }
 
 
 void  SteamAPI_ISteamInventory_DestroyResult_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t )%p)\n", instancePtr, resultHandle);
-  SteamAPI_ISteamInventory_DestroyResult(instancePtr, resultHandle);
-  
+  static ProfilePoint point("SteamAPI_ISteamInventory_DestroyResult");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_DestroyResult)>::call(&point, unwrapInstance(instancePtr), resultHandle);
 }
 
 
 bool  SteamAPI_ISteamInventory_GetAllItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p)\n", instancePtr, pResultHandle);
-  bool  result = SteamAPI_ISteamInventory_GetAllItems(instancePtr, pResultHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GetAllItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GetAllItems)>::call(&point, unwrapInstance(instancePtr), pResultHandle);
 }
 
 
 bool  SteamAPI_ISteamInventory_GetItemsByID_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t * pInstanceIDs, uint32  unCountInstanceIDs)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemInstanceID_t *)%p, (uint32 )%d)\n", instancePtr, pResultHandle, pInstanceIDs, unCountInstanceIDs);
-  bool  result = SteamAPI_ISteamInventory_GetItemsByID(instancePtr, pResultHandle, pInstanceIDs, unCountInstanceIDs);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GetItemsByID");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GetItemsByID)>::call(&point, unwrapInstance(instancePtr), pResultHandle, pInstanceIDs, unCountInstanceIDs);
 }
 
 
 bool  SteamAPI_ISteamInventory_SerializeResult_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, void * pOutBuffer, uint32 * punOutBufferSize)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t )%p, (void *)%p, (uint32 *)%d)\n", instancePtr, resultHandle, pOutBuffer, punOutBufferSize);
-  bool  result = SteamAPI_ISteamInventory_SerializeResult(instancePtr, resultHandle, pOutBuffer, punOutBufferSize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_SerializeResult");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_SerializeResult)>::call(&point, unwrapInstance(instancePtr), resultHandle, pOutBuffer, punOutBufferSize);
 }
 
 
 bool  SteamAPI_ISteamInventory_DeserializeResult_(intptr_t  instancePtr, SteamInventoryResult_t * pOutResultHandle, void * pBuffer, uint32  unBufferSize, bool  bRESERVED_MUST_BE_FALSE)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (void *)%p, (uint32 )%d, (bool )%d)\n", instancePtr, pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE);
-  bool  result = SteamAPI_ISteamInventory_DeserializeResult(instancePtr, pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_DeserializeResult", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_DeserializeResult)>::call(&point, unwrapInstance(instancePtr), pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE);
 }
 
 
 bool  SteamAPI_ISteamInventory_GenerateItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32 * punArrayQuantity, uint32  unArrayLength)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t *)%p, (uint32 *)%d, (uint32 )%d)\n", instancePtr, pResultHandle, pArrayItemDefs, punArrayQuantity, unArrayLength);
-  bool  result = SteamAPI_ISteamInventory_GenerateItems(instancePtr, pResultHandle, pArrayItemDefs, punArrayQuantity, unArrayLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GenerateItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GenerateItems)>::call(&point, unwrapInstance(instancePtr), pResultHandle, pArrayItemDefs, punArrayQuantity, unArrayLength);
 }
 
 
 bool  SteamAPI_ISteamInventory_GrantPromoItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p)\n", instancePtr, pResultHandle);
-  bool  result = SteamAPI_ISteamInventory_GrantPromoItems(instancePtr, pResultHandle);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GrantPromoItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GrantPromoItems)>::call(&point, unwrapInstance(instancePtr), pResultHandle);
 }
 
 
 bool  SteamAPI_ISteamInventory_AddPromoItem_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  itemDef)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t )%p)\n", instancePtr, pResultHandle, itemDef);
-  bool  result = SteamAPI_ISteamInventory_AddPromoItem(instancePtr, pResultHandle, itemDef);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_AddPromoItem");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_AddPromoItem)>::call(&point, unwrapInstance(instancePtr), pResultHandle, itemDef);
 }
 
 
 bool  SteamAPI_ISteamInventory_AddPromoItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32  unArrayLength)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t *)%p, (uint32 )%d)\n", instancePtr, pResultHandle, pArrayItemDefs, unArrayLength);
-  bool  result = SteamAPI_ISteamInventory_AddPromoItems(instancePtr, pResultHandle, pArrayItemDefs, unArrayLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_AddPromoItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_AddPromoItems)>::call(&point, unwrapInstance(instancePtr), pResultHandle, pArrayItemDefs, unArrayLength);
 }
 
 
 bool  SteamAPI_ISteamInventory_ConsumeItem_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemConsume, uint32  unQuantity)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemInstanceID_t )%p, (uint32 )%d)\n", instancePtr, pResultHandle, itemConsume, unQuantity);
-  bool  result = SteamAPI_ISteamInventory_ConsumeItem(instancePtr, pResultHandle, itemConsume, unQuantity);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_ConsumeItem");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_ConsumeItem)>::call(&point, unwrapInstance(instancePtr), pResultHandle, itemConsume, unQuantity);
 }
 
 
 bool  SteamAPI_ISteamInventory_ExchangeItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayGenerate, uint32 * punArrayGenerateQuantity, uint32  unArrayGenerateLength, SteamItemInstanceID_t * pArrayDestroy, uint32 * punArrayDestroyQuantity, uint32  unArrayDestroyLength)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t *)%p, (uint32 *)%d, (uint32 )%d, (SteamItemInstanceID_t *)%p, (uint32 *)%d, (uint32 )%d)\n", instancePtr, pResultHandle, pArrayGenerate, punArrayGenerateQuantity, unArrayGenerateLength, pArrayDestroy, punArrayDestroyQuantity, unArrayDestroyLength);
-  bool  result = SteamAPI_ISteamInventory_ExchangeItems(instancePtr, pResultHandle, pArrayGenerate, punArrayGenerateQuantity, unArrayGenerateLength, pArrayDestroy, punArrayDestroyQuantity, unArrayDestroyLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_ExchangeItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_ExchangeItems)>::call(&point, unwrapInstance(instancePtr), pResultHandle, pArrayGenerate, punArrayGenerateQuantity, unArrayGenerateLength, pArrayDestroy, punArrayDestroyQuantity, unArrayDestroyLength);
 }
 
 
 bool  SteamAPI_ISteamInventory_TransferItemQuantity_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemIdSource, uint32  unQuantity, SteamItemInstanceID_t  itemIdDest)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemInstanceID_t )%p, (uint32 )%d, (SteamItemInstanceID_t )%p)\n", instancePtr, pResultHandle, itemIdSource, unQuantity, itemIdDest);
-  bool  result = SteamAPI_ISteamInventory_TransferItemQuantity(instancePtr, pResultHandle, itemIdSource, unQuantity, itemIdDest);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_TransferItemQuantity");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_TransferItemQuantity)>::call(&point, unwrapInstance(instancePtr), pResultHandle, itemIdSource, unQuantity, itemIdDest);
 }
 
 
 void  SteamAPI_ISteamInventory_SendItemDropHeartbeat_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamInventory_SendItemDropHeartbeat(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamInventory_SendItemDropHeartbeat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_SendItemDropHeartbeat)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamInventory_TriggerItemDrop_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  dropListDefinition)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (SteamItemDef_t )%p)\n", instancePtr, pResultHandle, dropListDefinition);
-  bool  result = SteamAPI_ISteamInventory_TriggerItemDrop(instancePtr, pResultHandle, dropListDefinition);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_TriggerItemDrop");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_TriggerItemDrop)>::call(&point, unwrapInstance(instancePtr), pResultHandle, dropListDefinition);
 }
 
 
 bool  SteamAPI_ISteamInventory_TradeItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, CSteamID  steamIDTradePartner, SteamItemInstanceID_t * pArrayGive, uint32 * pArrayGiveQuantity, uint32  nArrayGiveLength, SteamItemInstanceID_t * pArrayGet, uint32 * pArrayGetQuantity, uint32  nArrayGetLength)
 {
-  TRACE("((intptr_t )%p, (SteamInventoryResult_t *)%p, (CSteamID )%p, (SteamItemInstanceID_t *)%p, (uint32 *)%d, (uint32 )%d, (SteamItemInstanceID_t *)%p, (uint32 *)%d, (uint32 )%d)\n", instancePtr, pResultHandle, steamIDTradePartner, pArrayGive, pArrayGiveQuantity, nArrayGiveLength, pArrayGet, pArrayGetQuantity, nArrayGetLength);
-  bool  result = SteamAPI_ISteamInventory_TradeItems(instancePtr, pResultHandle, steamIDTradePartner, pArrayGive, pArrayGiveQuantity, nArrayGiveLength, pArrayGet, pArrayGetQuantity, nArrayGetLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_TradeItems");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_TradeItems)>::call(&point, unwrapInstance(instancePtr), pResultHandle, steamIDTradePartner, pArrayGive, pArrayGiveQuantity, nArrayGiveLength, pArrayGet, pArrayGetQuantity, nArrayGetLength);
 }
 
 
 bool  SteamAPI_ISteamInventory_LoadItemDefinitions_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamInventory_LoadItemDefinitions(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_LoadItemDefinitions");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_LoadItemDefinitions)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamInventory_GetItemDefinitionIDs_(intptr_t  instancePtr, SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize)
 {
-  TRACE("((intptr_t )%p, (SteamItemDef_t *)%p, (uint32 *)%d)\n", instancePtr, pItemDefIDs, punItemDefIDsArraySize);
-  bool  result = SteamAPI_ISteamInventory_GetItemDefinitionIDs(instancePtr, pItemDefIDs, punItemDefIDsArraySize);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GetItemDefinitionIDs");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GetItemDefinitionIDs)>::call(&point, unwrapInstance(instancePtr), pItemDefIDs, punItemDefIDsArraySize);
 }
 
 
 bool  SteamAPI_ISteamInventory_GetItemDefinitionProperty_(intptr_t  instancePtr, SteamItemDef_t  iDefinition, char * pchPropertyName, char * pchValueBuffer, uint32 * punValueBufferSizeOut)
 {
-  TRACE("((intptr_t )%p, (SteamItemDef_t )%p, (char *)\"%s\", (char *)\"%s\", (uint32 *)%d)\n", instancePtr, iDefinition, pchPropertyName, pchValueBuffer, punValueBufferSizeOut);
-  bool  result = SteamAPI_ISteamInventory_GetItemDefinitionProperty(instancePtr, iDefinition, pchPropertyName, pchValueBuffer, punValueBufferSizeOut);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamInventory_GetItemDefinitionProperty");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamInventory_GetItemDefinitionProperty)>::call(&point, unwrapInstance(instancePtr), iDefinition, pchPropertyName, pchValueBuffer, punValueBufferSizeOut);
 }
 
 
 void  SteamAPI_ISteamVideo_GetVideoURL_(intptr_t  instancePtr, AppId_t  unVideoAppID)
 {
-  TRACE("((intptr_t )%p, (AppId_t )%p)\n", instancePtr, unVideoAppID);
-  SteamAPI_ISteamVideo_GetVideoURL(instancePtr, unVideoAppID);
-  
+  static ProfilePoint point("SteamAPI_ISteamVideo_GetVideoURL");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamVideo_GetVideoURL)>::call(&point, unwrapInstance(instancePtr), unVideoAppID);
 }
 
 
 bool  SteamAPI_ISteamVideo_IsBroadcasting_(intptr_t  instancePtr, int * pnNumViewers)
 {
-  TRACE("((intptr_t )%p, (int *)%d)\n", instancePtr, pnNumViewers);
-  bool  result = SteamAPI_ISteamVideo_IsBroadcasting(instancePtr, pnNumViewers);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamVideo_IsBroadcasting");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamVideo_IsBroadcasting)>::call(&point, unwrapInstance(instancePtr), pnNumViewers);
 }
 
 
 bool  SteamAPI_ISteamGameServer_InitGameServer_(intptr_t  instancePtr, uint32  unIP, uint16  usGamePort, uint16  usQueryPort, uint32  unFlags, AppId_t  nGameAppId, char * pchVersionString)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (uint16 )%d, (uint16 )%d, (uint32 )%d, (AppId_t )%p, (char *)\"%s\")\n", instancePtr, unIP, usGamePort, usQueryPort, unFlags, nGameAppId, pchVersionString);
-  bool  result = SteamAPI_ISteamGameServer_InitGameServer(instancePtr, unIP, usGamePort, usQueryPort, unFlags, nGameAppId, pchVersionString);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_InitGameServer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_InitGameServer)>::call(&point, unwrapInstance(instancePtr), unIP, usGamePort, usQueryPort, unFlags, nGameAppId, pchVersionString);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetProduct_(intptr_t  instancePtr, char * pszProduct)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszProduct);
-  SteamAPI_ISteamGameServer_SetProduct(instancePtr, pszProduct);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetProduct");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetProduct)>::call(&point, unwrapInstance(instancePtr), pszProduct);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetGameDescription_(intptr_t  instancePtr, char * pszGameDescription)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszGameDescription);
-  SteamAPI_ISteamGameServer_SetGameDescription(instancePtr, pszGameDescription);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetGameDescription");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetGameDescription)>::call(&point, unwrapInstance(instancePtr), pszGameDescription);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetModDir_(intptr_t  instancePtr, char * pszModDir)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszModDir);
-  SteamAPI_ISteamGameServer_SetModDir(instancePtr, pszModDir);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetModDir");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetModDir)>::call(&point, unwrapInstance(instancePtr), pszModDir);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetDedicatedServer_(intptr_t  instancePtr, bool  bDedicated)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bDedicated);
-  SteamAPI_ISteamGameServer_SetDedicatedServer(instancePtr, bDedicated);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetDedicatedServer");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetDedicatedServer)>::call(&point, unwrapInstance(instancePtr), bDedicated);
 }
 
 
 void  SteamAPI_ISteamGameServer_LogOn_(intptr_t  instancePtr, char * pszToken)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszToken);
-  SteamAPI_ISteamGameServer_LogOn(instancePtr, pszToken);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_LogOn");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_LogOn)>::call(&point, unwrapInstance(instancePtr), pszToken);
 }
 
 
 void  SteamAPI_ISteamGameServer_LogOnAnonymous_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamGameServer_LogOnAnonymous(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_LogOnAnonymous");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_LogOnAnonymous)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamGameServer_LogOff_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamGameServer_LogOff(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_LogOff");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_LogOff)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamGameServer_BLoggedOn_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamGameServer_BLoggedOn(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_BLoggedOn");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_BLoggedOn)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamGameServer_BSecure_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamGameServer_BSecure(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_BSecure");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_BSecure)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint64  SteamAPI_ISteamGameServer_GetSteamID_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint64  result = SteamAPI_ISteamGameServer_GetSteamID(instancePtr);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_GetSteamID");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_GetSteamID)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamGameServer_WasRestartRequested_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  bool  result = SteamAPI_ISteamGameServer_WasRestartRequested(instancePtr);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_WasRestartRequested");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_WasRestartRequested)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamGameServer_SetMaxPlayerCount_(intptr_t  instancePtr, int  cPlayersMax)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, cPlayersMax);
-  SteamAPI_ISteamGameServer_SetMaxPlayerCount(instancePtr, cPlayersMax);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetMaxPlayerCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetMaxPlayerCount)>::call(&point, unwrapInstance(instancePtr), cPlayersMax);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetBotPlayerCount_(intptr_t  instancePtr, int  cBotplayers)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, cBotplayers);
-  SteamAPI_ISteamGameServer_SetBotPlayerCount(instancePtr, cBotplayers);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetBotPlayerCount");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetBotPlayerCount)>::call(&point, unwrapInstance(instancePtr), cBotplayers);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetServerName_(intptr_t  instancePtr, char * pszServerName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszServerName);
-  SteamAPI_ISteamGameServer_SetServerName(instancePtr, pszServerName);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetServerName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetServerName)>::call(&point, unwrapInstance(instancePtr), pszServerName);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetMapName_(intptr_t  instancePtr, char * pszMapName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszMapName);
-  SteamAPI_ISteamGameServer_SetMapName(instancePtr, pszMapName);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetMapName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetMapName)>::call(&point, unwrapInstance(instancePtr), pszMapName);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetPasswordProtected_(intptr_t  instancePtr, bool  bPasswordProtected)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bPasswordProtected);
-  SteamAPI_ISteamGameServer_SetPasswordProtected(instancePtr, bPasswordProtected);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetPasswordProtected");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetPasswordProtected)>::call(&point, unwrapInstance(instancePtr), bPasswordProtected);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetSpectatorPort_(intptr_t  instancePtr, uint16  unSpectatorPort)
 {
-  TRACE("((intptr_t )%p, (uint16 )%d)\n", instancePtr, unSpectatorPort);
-  SteamAPI_ISteamGameServer_SetSpectatorPort(instancePtr, unSpectatorPort);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetSpectatorPort");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetSpectatorPort)>::call(&point, unwrapInstance(instancePtr), unSpectatorPort);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetSpectatorServerName_(intptr_t  instancePtr, char * pszSpectatorServerName)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszSpectatorServerName);
-  SteamAPI_ISteamGameServer_SetSpectatorServerName(instancePtr, pszSpectatorServerName);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetSpectatorServerName");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetSpectatorServerName)>::call(&point, unwrapInstance(instancePtr), pszSpectatorServerName);
 }
 
 
 void  SteamAPI_ISteamGameServer_ClearAllKeyValues_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamGameServer_ClearAllKeyValues(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_ClearAllKeyValues");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_ClearAllKeyValues)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamGameServer_SetKeyValue_(intptr_t  instancePtr, char * pKey, char * pValue)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\", (char *)\"%s\")\n", instancePtr, pKey, pValue);
-  SteamAPI_ISteamGameServer_SetKeyValue(instancePtr, pKey, pValue);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetKeyValue");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetKeyValue)>::call(&point, unwrapInstance(instancePtr), pKey, pValue);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetGameTags_(intptr_t  instancePtr, char * pchGameTags)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchGameTags);
-  SteamAPI_ISteamGameServer_SetGameTags(instancePtr, pchGameTags);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetGameTags");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetGameTags)>::call(&point, unwrapInstance(instancePtr), pchGameTags);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetGameData_(intptr_t  instancePtr, char * pchGameData)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pchGameData);
-  SteamAPI_ISteamGameServer_SetGameData(instancePtr, pchGameData);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetGameData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetGameData)>::call(&point, unwrapInstance(instancePtr), pchGameData);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetRegion_(intptr_t  instancePtr, char * pszRegion)
 {
-  TRACE("((intptr_t )%p, (char *)\"%s\")\n", instancePtr, pszRegion);
-  SteamAPI_ISteamGameServer_SetRegion(instancePtr, pszRegion);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetRegion");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetRegion)>::call(&point, unwrapInstance(instancePtr), pszRegion);
 }
 
 
 bool  SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate_(intptr_t  instancePtr, uint32  unIPClient, void * pvAuthBlob, uint32  cubAuthBlobSize, CSteamID * pSteamIDUser)
 {
-  TRACE("((intptr_t )%p, (uint32 )%d, (void *)%p, (uint32 )%d, (CSteamID *)%p)\n", instancePtr, unIPClient, pvAuthBlob, cubAuthBlobSize, pSteamIDUser);
-  bool  result = SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate(instancePtr, unIPClient, pvAuthBlob, cubAuthBlobSize, pSteamIDUser);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate", "2:3");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate)>::call(&point, unwrapInstance(instancePtr), unIPClient, pvAuthBlob, cubAuthBlobSize, pSteamIDUser);
 }
 
 
 uint64  SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint64  result = SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection(instancePtr);
-  TRACE("() = (uint64 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 void  SteamAPI_ISteamGameServer_SendUserDisconnect_(intptr_t  instancePtr, CSteamID  steamIDUser)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDUser);
-  SteamAPI_ISteamGameServer_SendUserDisconnect(instancePtr, steamIDUser);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SendUserDisconnect");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SendUserDisconnect)>::call(&point, unwrapInstance(instancePtr), steamIDUser);
 }
 
 
 bool  SteamAPI_ISteamGameServer_BUpdateUserData_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchPlayerName, uint32  uScore)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (uint32 )%d)\n", instancePtr, steamIDUser, pchPlayerName, uScore);
-  bool  result = SteamAPI_ISteamGameServer_BUpdateUserData(instancePtr, steamIDUser, pchPlayerName, uScore);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_BUpdateUserData");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_BUpdateUserData)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchPlayerName, uScore);
 }
 
 
 HAuthTicket  SteamAPI_ISteamGameServer_GetAuthSessionTicket_(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (uint32 *)%d)\n", instancePtr, pTicket, cbMaxTicket, pcbTicket);
-  HAuthTicket  result = SteamAPI_ISteamGameServer_GetAuthSessionTicket(instancePtr, pTicket, cbMaxTicket, pcbTicket);
-  TRACE("() = (HAuthTicket )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_GetAuthSessionTicket", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_GetAuthSessionTicket)>::call(&point, unwrapInstance(instancePtr), pTicket, cbMaxTicket, pcbTicket);
 }
 
 
 EBeginAuthSessionResult  SteamAPI_ISteamGameServer_BeginAuthSession_(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (CSteamID )%p)\n", instancePtr, pAuthTicket, cbAuthTicket, steamID);
-  EBeginAuthSessionResult  result = SteamAPI_ISteamGameServer_BeginAuthSession(instancePtr, pAuthTicket, cbAuthTicket, steamID);
-  TRACE("() = (EBeginAuthSessionResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_BeginAuthSession", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_BeginAuthSession)>::call(&point, unwrapInstance(instancePtr), pAuthTicket, cbAuthTicket, steamID);
 }
 
 
 void  SteamAPI_ISteamGameServer_EndAuthSession_(intptr_t  instancePtr, CSteamID  steamID)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamID);
-  SteamAPI_ISteamGameServer_EndAuthSession(instancePtr, steamID);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_EndAuthSession");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_EndAuthSession)>::call(&point, unwrapInstance(instancePtr), steamID);
 }
 
 
 void  SteamAPI_ISteamGameServer_CancelAuthTicket_(intptr_t  instancePtr, HAuthTicket  hAuthTicket)
 {
-  TRACE("((intptr_t )%p, (HAuthTicket )%p)\n", instancePtr, hAuthTicket);
-  SteamAPI_ISteamGameServer_CancelAuthTicket(instancePtr, hAuthTicket);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_CancelAuthTicket");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_CancelAuthTicket)>::call(&point, unwrapInstance(instancePtr), hAuthTicket);
 }
 
 
 EUserHasLicenseForAppResult  SteamAPI_ISteamGameServer_UserHasLicenseForApp_(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (AppId_t )%p)\n", instancePtr, steamID, appID);
-  EUserHasLicenseForAppResult  result = SteamAPI_ISteamGameServer_UserHasLicenseForApp(instancePtr, steamID, appID);
-  TRACE("() = (EUserHasLicenseForAppResult )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_UserHasLicenseForApp");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_UserHasLicenseForApp)>::call(&point, unwrapInstance(instancePtr), steamID, appID);
 }
 
 
 bool  SteamAPI_ISteamGameServer_RequestUserGroupStatus_(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDGroup)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (CSteamID )%p)\n", instancePtr, steamIDUser, steamIDGroup);
-  bool  result = SteamAPI_ISteamGameServer_RequestUserGroupStatus(instancePtr, steamIDUser, steamIDGroup);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_RequestUserGroupStatus");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_RequestUserGroupStatus)>::call(&point, unwrapInstance(instancePtr), steamIDUser, steamIDGroup);
 }
 
 
 void  SteamAPI_ISteamGameServer_GetGameplayStats_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamGameServer_GetGameplayStats(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_GetGameplayStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_GetGameplayStats)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamGameServer_GetServerReputation_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPICall_t  result = SteamAPI_ISteamGameServer_GetServerReputation(instancePtr);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_GetServerReputation");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_GetServerReputation)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 uint32  SteamAPI_ISteamGameServer_GetPublicIP_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  uint32  result = SteamAPI_ISteamGameServer_GetPublicIP(instancePtr);
-  TRACE("() = (uint32 )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_GetPublicIP");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_GetPublicIP)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 bool  SteamAPI_ISteamGameServer_HandleIncomingPacket_(intptr_t  instancePtr, void * pData, int  cbData, uint32  srcIP, uint16  srcPort)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (uint32 )%d, (uint16 )%d)\n", instancePtr, pData, cbData, srcIP, srcPort);
-  bool  result = SteamAPI_ISteamGameServer_HandleIncomingPacket(instancePtr, pData, cbData, srcIP, srcPort);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_HandleIncomingPacket", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_HandleIncomingPacket)>::call(&point, unwrapInstance(instancePtr), pData, cbData, srcIP, srcPort);
 }
 
 
 int  SteamAPI_ISteamGameServer_GetNextOutgoingPacket_(intptr_t  instancePtr, void * pOut, int  cbMaxOut, uint32 * pNetAdr, uint16 * pPort)
 {
-  TRACE("((intptr_t )%p, (void *)%p, (int )%d, (uint32 *)%d, (uint16 *)%d)\n", instancePtr, pOut, cbMaxOut, pNetAdr, pPort);
-  int  result = SteamAPI_ISteamGameServer_GetNextOutgoingPacket(instancePtr, pOut, cbMaxOut, pNetAdr, pPort);
-  TRACE("() = (int )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_GetNextOutgoingPacket", "1:2");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_GetNextOutgoingPacket)>::call(&point, unwrapInstance(instancePtr), pOut, cbMaxOut, pNetAdr, pPort);
 }
 
 
 void  SteamAPI_ISteamGameServer_EnableHeartbeats_(intptr_t  instancePtr, bool  bActive)
 {
-  TRACE("((intptr_t )%p, (bool )%d)\n", instancePtr, bActive);
-  SteamAPI_ISteamGameServer_EnableHeartbeats(instancePtr, bActive);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_EnableHeartbeats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_EnableHeartbeats)>::call(&point, unwrapInstance(instancePtr), bActive);
 }
 
 
 void  SteamAPI_ISteamGameServer_SetHeartbeatInterval_(intptr_t  instancePtr, int  iHeartbeatInterval)
 {
-  TRACE("((intptr_t )%p, (int )%d)\n", instancePtr, iHeartbeatInterval);
-  SteamAPI_ISteamGameServer_SetHeartbeatInterval(instancePtr, iHeartbeatInterval);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_SetHeartbeatInterval");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_SetHeartbeatInterval)>::call(&point, unwrapInstance(instancePtr), iHeartbeatInterval);
 }
 
 
 void  SteamAPI_ISteamGameServer_ForceHeartbeat_(intptr_t  instancePtr)
 {
-  TRACE("((intptr_t )%p)\n", instancePtr);
-  SteamAPI_ISteamGameServer_ForceHeartbeat(instancePtr);
-  
+  static ProfilePoint point("SteamAPI_ISteamGameServer_ForceHeartbeat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_ForceHeartbeat)>::call(&point, unwrapInstance(instancePtr));
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamGameServer_AssociateWithClan_(intptr_t  instancePtr, CSteamID  steamIDClan)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDClan);
-  SteamAPICall_t  result = SteamAPI_ISteamGameServer_AssociateWithClan(instancePtr, steamIDClan);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_AssociateWithClan");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_AssociateWithClan)>::call(&point, unwrapInstance(instancePtr), steamIDClan);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility_(intptr_t  instancePtr, CSteamID  steamIDNewPlayer)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDNewPlayer);
-  SteamAPICall_t  result = SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility(instancePtr, steamIDNewPlayer);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility)>::call(&point, unwrapInstance(instancePtr), steamIDNewPlayer);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamGameServerStats_RequestUserStats_(intptr_t  instancePtr, CSteamID  steamIDUser)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDUser);
-  SteamAPICall_t  result = SteamAPI_ISteamGameServerStats_RequestUserStats(instancePtr, steamIDUser);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_RequestUserStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_RequestUserStats)>::call(&point, unwrapInstance(instancePtr), steamIDUser);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_GetUserStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (int32 *)%d)\n", instancePtr, steamIDUser, pchName, pData);
-  bool  result = SteamAPI_ISteamGameServerStats_GetUserStat(instancePtr, steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_GetUserStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_GetUserStat)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, pData);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_GetUserStat0_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (float *)%f)\n", instancePtr, steamIDUser, pchName, pData);
-  bool  result = SteamAPI_ISteamGameServerStats_GetUserStat0(instancePtr, steamIDUser, pchName, pData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_GetUserStat0");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_GetUserStat0)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, pData);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_GetUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (bool *)%d)\n", instancePtr, steamIDUser, pchName, pbAchieved);
-  bool  result = SteamAPI_ISteamGameServerStats_GetUserAchievement(instancePtr, steamIDUser, pchName, pbAchieved);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_GetUserAchievement");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_GetUserAchievement)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, pbAchieved);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_SetUserStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32  nData)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (int32 )%d)\n", instancePtr, steamIDUser, pchName, nData);
-  bool  result = SteamAPI_ISteamGameServerStats_SetUserStat(instancePtr, steamIDUser, pchName, nData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_SetUserStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_SetUserStat)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, nData);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_SetUserStat0_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  fData)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (float )%f)\n", instancePtr, steamIDUser, pchName, fData);
-  bool  result = SteamAPI_ISteamGameServerStats_SetUserStat0(instancePtr, steamIDUser, pchName, fData);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_SetUserStat0");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_SetUserStat0)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, fData);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  flCountThisSession, double  dSessionLength)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\", (float )%f, (double )%f)\n", instancePtr, steamIDUser, pchName, flCountThisSession, dSessionLength);
-  bool  result = SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat(instancePtr, steamIDUser, pchName, flCountThisSession, dSessionLength);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName, flCountThisSession, dSessionLength);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_SetUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDUser, pchName);
-  bool  result = SteamAPI_ISteamGameServerStats_SetUserAchievement(instancePtr, steamIDUser, pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_SetUserAchievement");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_SetUserAchievement)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName);
 }
 
 
 bool  SteamAPI_ISteamGameServerStats_ClearUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p, (char *)\"%s\")\n", instancePtr, steamIDUser, pchName);
-  bool  result = SteamAPI_ISteamGameServerStats_ClearUserAchievement(instancePtr, steamIDUser, pchName);
-  TRACE("() = (bool )%d\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_ClearUserAchievement");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_ClearUserAchievement)>::call(&point, unwrapInstance(instancePtr), steamIDUser, pchName);
 }
 
 
 SteamAPICall_t  SteamAPI_ISteamGameServerStats_StoreUserStats_(intptr_t  instancePtr, CSteamID  steamIDUser)
 {
-  TRACE("((intptr_t )%p, (CSteamID )%p)\n", instancePtr, steamIDUser);
-  SteamAPICall_t  result = SteamAPI_ISteamGameServerStats_StoreUserStats(instancePtr, steamIDUser);
-  TRACE("() = (SteamAPICall_t )%p\n", result);
-
-  return result;
+  static ProfilePoint point("SteamAPI_ISteamGameServerStats_StoreUserStats");
+  return Forward<FORWARD_FUNCTION(SteamAPI_ISteamGameServerStats_StoreUserStats)>::call(&point, unwrapInstance(instancePtr), steamIDUser);
 }
 
 }
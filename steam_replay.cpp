@@ -0,0 +1,10950 @@
+
+#include <steam_api_.h>
+#include <steam_api_flat.h>
+#include <replay.h>
+extern "C" {
+bool  SteamAPI_Init_();
+void  SteamAPI_Shutdown_();
+bool  SteamAPI_RestartAppIfNecessary_(uint32  unOwnAppID);
+void  SteamAPI_WriteMiniDump_(uint32  uStructuredExceptionCode, void * pvExceptionInfo, uint32  uBuildID);
+void  SteamAPI_SetMiniDumpComment_(char * pchMsg);
+void  SteamAPI_RunCallbacks_();
+bool  SteamAPI_IsSteamRunning_();
+void  Steam_RunCallbacks_(HSteamPipe  hSteamPipe, bool  bGameServerCallbacks);
+void  Steam_RegisterInterfaceFuncs_(void * hModule);
+HSteamUser  Steam_GetHSteamUserCurrent_();
+char * SteamAPI_GetSteamInstallPath_();
+HSteamPipe  SteamAPI_GetHSteamPipe_();
+void  SteamAPI_SetTryCatchCallbacks_(bool  bTryCatchCallbacks);
+HSteamPipe  GetHSteamPipe_();
+HSteamUser  GetHSteamUser_();
+bool  SteamAPI_InitSafe_();
+HSteamUser  SteamAPI_GetHSteamUser_();
+void  SteamAPI_UseBreakpadCrashHandler_(char const * pchVersion, char const * pchDate, char const * pchTime, bool  bFullMemoryDumps, void * pvContext, PFNPreMinidumpCallback  m_pfnPreMinidumpCallback);
+void  SteamAPI_SetBreakpadAppID_(uint32  unAppID);
+HSteamPipe  SteamAPI_ISteamClient_CreateSteamPipe_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamClient_BReleaseSteamPipe_(intptr_t  instancePtr, HSteamPipe  hSteamPipe);
+HSteamUser  SteamAPI_ISteamClient_ConnectToGlobalUser_(intptr_t  instancePtr, HSteamPipe  hSteamPipe);
+HSteamUser  SteamAPI_ISteamClient_CreateLocalUser_(intptr_t  instancePtr, HSteamPipe * phSteamPipe, EAccountType  eAccountType);
+void  SteamAPI_ISteamClient_ReleaseUser_(intptr_t  instancePtr, HSteamPipe  hSteamPipe, HSteamUser  hUser);
+ISteamUser * SteamAPI_ISteamClient_GetISteamUser_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamGameServer * SteamAPI_ISteamClient_GetISteamGameServer_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+void  SteamAPI_ISteamClient_SetLocalIPBinding_(intptr_t  instancePtr, uint32  unIP, uint16  usPort);
+ISteamFriends * SteamAPI_ISteamClient_GetISteamFriends_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamUtils * SteamAPI_ISteamClient_GetISteamUtils_(intptr_t  instancePtr, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamMatchmaking * SteamAPI_ISteamClient_GetISteamMatchmaking_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamMatchmakingServers * SteamAPI_ISteamClient_GetISteamMatchmakingServers_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+void * SteamAPI_ISteamClient_GetISteamGenericInterface_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamUserStats * SteamAPI_ISteamClient_GetISteamUserStats_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamGameServerStats * SteamAPI_ISteamClient_GetISteamGameServerStats_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamApps * SteamAPI_ISteamClient_GetISteamApps_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamNetworking * SteamAPI_ISteamClient_GetISteamNetworking_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamRemoteStorage * SteamAPI_ISteamClient_GetISteamRemoteStorage_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamScreenshots * SteamAPI_ISteamClient_GetISteamScreenshots_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+uint32  SteamAPI_ISteamClient_GetIPCCallCount_(intptr_t  instancePtr);
+void  SteamAPI_ISteamClient_SetWarningMessageHook_(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction);
+bool  SteamAPI_ISteamClient_BShutdownIfAllPipesClosed_(intptr_t  instancePtr);
+ISteamHTTP * SteamAPI_ISteamClient_GetISteamHTTP_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamUnifiedMessages * SteamAPI_ISteamClient_GetISteamUnifiedMessages_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamController * SteamAPI_ISteamClient_GetISteamController_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamUGC * SteamAPI_ISteamClient_GetISteamUGC_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamAppList * SteamAPI_ISteamClient_GetISteamAppList_(intptr_t  instancePtr, HSteamUser  hSteamUser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamMusic * SteamAPI_ISteamClient_GetISteamMusic_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamMusicRemote * SteamAPI_ISteamClient_GetISteamMusicRemote_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamHTMLSurface * SteamAPI_ISteamClient_GetISteamHTMLSurface_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamInventory * SteamAPI_ISteamClient_GetISteamInventory_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+ISteamVideo * SteamAPI_ISteamClient_GetISteamVideo_(intptr_t  instancePtr, HSteamUser  hSteamuser, HSteamPipe  hSteamPipe, char * pchVersion);
+HSteamUser  SteamAPI_ISteamUser_GetHSteamUser_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamUser_BLoggedOn_(intptr_t  instancePtr);
+uint64  SteamAPI_ISteamUser_GetSteamID_(intptr_t  instancePtr);
+int  SteamAPI_ISteamUser_InitiateGameConnection_(intptr_t  instancePtr, void * pAuthBlob, int  cbMaxAuthBlob, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer, bool  bSecure);
+void  SteamAPI_ISteamUser_TerminateGameConnection_(intptr_t  instancePtr, uint32  unIPServer, uint16  usPortServer);
+void  SteamAPI_ISteamUser_TrackAppUsageEvent_(intptr_t  instancePtr, CGameID  gameID, int  eAppUsageEvent, char * pchExtraInfo);
+bool  SteamAPI_ISteamUser_GetUserDataFolder_(intptr_t  instancePtr, char * pchBuffer, int  cubBuffer);
+void  SteamAPI_ISteamUser_StartVoiceRecording_(intptr_t  instancePtr);
+void  SteamAPI_ISteamUser_StopVoiceRecording_(intptr_t  instancePtr);
+EVoiceResult  SteamAPI_ISteamUser_GetAvailableVoice_(intptr_t  instancePtr, uint32 * pcbCompressed, uint32 * pcbUncompressed, uint32  nUncompressedVoiceDesiredSampleRate);
+EVoiceResult  SteamAPI_ISteamUser_GetVoice_(intptr_t  instancePtr, bool  bWantCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, bool  bWantUncompressed, void * pUncompressedDestBuffer, uint32  cbUncompressedDestBufferSize, uint32 * nUncompressBytesWritten, uint32  nUncompressedVoiceDesiredSampleRate);
+EVoiceResult  SteamAPI_ISteamUser_DecompressVoice_(intptr_t  instancePtr, void * pCompressed, uint32  cbCompressed, void * pDestBuffer, uint32  cbDestBufferSize, uint32 * nBytesWritten, uint32  nDesiredSampleRate);
+uint32  SteamAPI_ISteamUser_GetVoiceOptimalSampleRate_(intptr_t  instancePtr);
+HAuthTicket  SteamAPI_ISteamUser_GetAuthSessionTicket_(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket);
+EBeginAuthSessionResult  SteamAPI_ISteamUser_BeginAuthSession_(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID);
+void  SteamAPI_ISteamUser_EndAuthSession_(intptr_t  instancePtr, CSteamID  steamID);
+void  SteamAPI_ISteamUser_CancelAuthTicket_(intptr_t  instancePtr, HAuthTicket  hAuthTicket);
+EUserHasLicenseForAppResult  SteamAPI_ISteamUser_UserHasLicenseForApp_(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID);
+bool  SteamAPI_ISteamUser_BIsBehindNAT_(intptr_t  instancePtr);
+void  SteamAPI_ISteamUser_AdvertiseGame_(intptr_t  instancePtr, CSteamID  steamIDGameServer, uint32  unIPServer, uint16  usPortServer);
+SteamAPICall_t  SteamAPI_ISteamUser_RequestEncryptedAppTicket_(intptr_t  instancePtr, void * pDataToInclude, int  cbDataToInclude);
+bool  SteamAPI_ISteamUser_GetEncryptedAppTicket_(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket);
+int  SteamAPI_ISteamUser_GetGameBadgeLevel_(intptr_t  instancePtr, int  nSeries, bool  bFoil);
+int  SteamAPI_ISteamUser_GetPlayerSteamLevel_(intptr_t  instancePtr);
+SteamAPICall_t  SteamAPI_ISteamUser_RequestStoreAuthURL_(intptr_t  instancePtr, char * pchRedirectURL);
+char * SteamAPI_ISteamFriends_GetPersonaName_(intptr_t  instancePtr);
+SteamAPICall_t  SteamAPI_ISteamFriends_SetPersonaName_(intptr_t  instancePtr, char * pchPersonaName);
+EPersonaState  SteamAPI_ISteamFriends_GetPersonaState_(intptr_t  instancePtr);
+int  SteamAPI_ISteamFriends_GetFriendCount_(intptr_t  instancePtr, int  iFriendFlags);
+uint64  SteamAPI_ISteamFriends_GetFriendByIndex_(intptr_t  instancePtr, int  iFriend, int  iFriendFlags);
+EFriendRelationship  SteamAPI_ISteamFriends_GetFriendRelationship_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+EPersonaState  SteamAPI_ISteamFriends_GetFriendPersonaState_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+char * SteamAPI_ISteamFriends_GetFriendPersonaName_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+bool  SteamAPI_ISteamFriends_GetFriendGamePlayed_(intptr_t  instancePtr, CSteamID  steamIDFriend, FriendGameInfo_t * pFriendGameInfo);
+char * SteamAPI_ISteamFriends_GetFriendPersonaNameHistory_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iPersonaName);
+int  SteamAPI_ISteamFriends_GetFriendSteamLevel_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+char * SteamAPI_ISteamFriends_GetPlayerNickname_(intptr_t  instancePtr, CSteamID  steamIDPlayer);
+int  SteamAPI_ISteamFriends_GetFriendsGroupCount_(intptr_t  instancePtr);
+FriendsGroupID_t  SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex_(intptr_t  instancePtr, int  iFG);
+char * SteamAPI_ISteamFriends_GetFriendsGroupName_(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID);
+int  SteamAPI_ISteamFriends_GetFriendsGroupMembersCount_(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID);
+void  SteamAPI_ISteamFriends_GetFriendsGroupMembersList_(intptr_t  instancePtr, FriendsGroupID_t  friendsGroupID, CSteamID * pOutSteamIDMembers, int  nMembersCount);
+bool  SteamAPI_ISteamFriends_HasFriend_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iFriendFlags);
+int  SteamAPI_ISteamFriends_GetClanCount_(intptr_t  instancePtr);
+uint64  SteamAPI_ISteamFriends_GetClanByIndex_(intptr_t  instancePtr, int  iClan);
+char * SteamAPI_ISteamFriends_GetClanName_(intptr_t  instancePtr, CSteamID  steamIDClan);
+char * SteamAPI_ISteamFriends_GetClanTag_(intptr_t  instancePtr, CSteamID  steamIDClan);
+bool  SteamAPI_ISteamFriends_GetClanActivityCounts_(intptr_t  instancePtr, CSteamID  steamIDClan, int * pnOnline, int * pnInGame, int * pnChatting);
+SteamAPICall_t  SteamAPI_ISteamFriends_DownloadClanActivityCounts_(intptr_t  instancePtr, CSteamID * psteamIDClans, int  cClansToRequest);
+int  SteamAPI_ISteamFriends_GetFriendCountFromSource_(intptr_t  instancePtr, CSteamID  steamIDSource);
+uint64  SteamAPI_ISteamFriends_GetFriendFromSourceByIndex_(intptr_t  instancePtr, CSteamID  steamIDSource, int  iFriend);
+bool  SteamAPI_ISteamFriends_IsUserInSource_(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDSource);
+void  SteamAPI_ISteamFriends_SetInGameVoiceSpeaking_(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bSpeaking);
+void  SteamAPI_ISteamFriends_ActivateGameOverlay_(intptr_t  instancePtr, char * pchDialog);
+void  SteamAPI_ISteamFriends_ActivateGameOverlayToUser_(intptr_t  instancePtr, char * pchDialog, CSteamID  steamID);
+void  SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage_(intptr_t  instancePtr, char * pchURL);
+void  SteamAPI_ISteamFriends_ActivateGameOverlayToStore_(intptr_t  instancePtr, AppId_t  nAppID, EOverlayToStoreFlag  eFlag);
+void  SteamAPI_ISteamFriends_SetPlayedWith_(intptr_t  instancePtr, CSteamID  steamIDUserPlayedWith);
+void  SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+int  SteamAPI_ISteamFriends_GetSmallFriendAvatar_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+int  SteamAPI_ISteamFriends_GetMediumFriendAvatar_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+int  SteamAPI_ISteamFriends_GetLargeFriendAvatar_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+bool  SteamAPI_ISteamFriends_RequestUserInformation_(intptr_t  instancePtr, CSteamID  steamIDUser, bool  bRequireNameOnly);
+SteamAPICall_t  SteamAPI_ISteamFriends_RequestClanOfficerList_(intptr_t  instancePtr, CSteamID  steamIDClan);
+uint64  SteamAPI_ISteamFriends_GetClanOwner_(intptr_t  instancePtr, CSteamID  steamIDClan);
+int  SteamAPI_ISteamFriends_GetClanOfficerCount_(intptr_t  instancePtr, CSteamID  steamIDClan);
+uint64  SteamAPI_ISteamFriends_GetClanOfficerByIndex_(intptr_t  instancePtr, CSteamID  steamIDClan, int  iOfficer);
+uint32  SteamAPI_ISteamFriends_GetUserRestrictions_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamFriends_SetRichPresence_(intptr_t  instancePtr, char * pchKey, char * pchValue);
+void  SteamAPI_ISteamFriends_ClearRichPresence_(intptr_t  instancePtr);
+char * SteamAPI_ISteamFriends_GetFriendRichPresence_(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchKey);
+int  SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+char * SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iKey);
+void  SteamAPI_ISteamFriends_RequestFriendRichPresence_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+bool  SteamAPI_ISteamFriends_InviteUserToGame_(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchConnectString);
+int  SteamAPI_ISteamFriends_GetCoplayFriendCount_(intptr_t  instancePtr);
+uint64  SteamAPI_ISteamFriends_GetCoplayFriend_(intptr_t  instancePtr, int  iCoplayFriend);
+int  SteamAPI_ISteamFriends_GetFriendCoplayTime_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+AppId_t  SteamAPI_ISteamFriends_GetFriendCoplayGame_(intptr_t  instancePtr, CSteamID  steamIDFriend);
+SteamAPICall_t  SteamAPI_ISteamFriends_JoinClanChatRoom_(intptr_t  instancePtr, CSteamID  steamIDClan);
+bool  SteamAPI_ISteamFriends_LeaveClanChatRoom_(intptr_t  instancePtr, CSteamID  steamIDClan);
+int  SteamAPI_ISteamFriends_GetClanChatMemberCount_(intptr_t  instancePtr, CSteamID  steamIDClan);
+uint64  SteamAPI_ISteamFriends_GetChatMemberByIndex_(intptr_t  instancePtr, CSteamID  steamIDClan, int  iUser);
+bool  SteamAPI_ISteamFriends_SendClanChatMessage_(intptr_t  instancePtr, CSteamID  steamIDClanChat, char * pchText);
+int  SteamAPI_ISteamFriends_GetClanChatMessage_(intptr_t  instancePtr, CSteamID  steamIDClanChat, int  iMessage, void * prgchText, int  cchTextMax, EChatEntryType * peChatEntryType, CSteamID * psteamidChatter);
+bool  SteamAPI_ISteamFriends_IsClanChatAdmin_(intptr_t  instancePtr, CSteamID  steamIDClanChat, CSteamID  steamIDUser);
+bool  SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam_(intptr_t  instancePtr, CSteamID  steamIDClanChat);
+bool  SteamAPI_ISteamFriends_OpenClanChatWindowInSteam_(intptr_t  instancePtr, CSteamID  steamIDClanChat);
+bool  SteamAPI_ISteamFriends_CloseClanChatWindowInSteam_(intptr_t  instancePtr, CSteamID  steamIDClanChat);
+bool  SteamAPI_ISteamFriends_SetListenForFriendsMessages_(intptr_t  instancePtr, bool  bInterceptEnabled);
+bool  SteamAPI_ISteamFriends_ReplyToFriendMessage_(intptr_t  instancePtr, CSteamID  steamIDFriend, char * pchMsgToSend);
+int  SteamAPI_ISteamFriends_GetFriendMessage_(intptr_t  instancePtr, CSteamID  steamIDFriend, int  iMessageID, void * pvData, int  cubData, EChatEntryType * peChatEntryType);
+SteamAPICall_t  SteamAPI_ISteamFriends_GetFollowerCount_(intptr_t  instancePtr, CSteamID  steamID);
+SteamAPICall_t  SteamAPI_ISteamFriends_IsFollowing_(intptr_t  instancePtr, CSteamID  steamID);
+SteamAPICall_t  SteamAPI_ISteamFriends_EnumerateFollowingList_(intptr_t  instancePtr, uint32  unStartIndex);
+uint32  SteamAPI_ISteamUtils_GetSecondsSinceAppActive_(intptr_t  instancePtr);
+uint32  SteamAPI_ISteamUtils_GetSecondsSinceComputerActive_(intptr_t  instancePtr);
+EUniverse  SteamAPI_ISteamUtils_GetConnectedUniverse_(intptr_t  instancePtr);
+uint32  SteamAPI_ISteamUtils_GetServerRealTime_(intptr_t  instancePtr);
+char * SteamAPI_ISteamUtils_GetIPCountry_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamUtils_GetImageSize_(intptr_t  instancePtr, int  iImage, uint32 * pnWidth, uint32 * pnHeight);
+bool  SteamAPI_ISteamUtils_GetImageRGBA_(intptr_t  instancePtr, int  iImage, uint8 * pubDest, int  nDestBufferSize);
+bool  SteamAPI_ISteamUtils_GetCSERIPPort_(intptr_t  instancePtr, uint32 * unIP, uint16 * usPort);
+uint8  SteamAPI_ISteamUtils_GetCurrentBatteryPower_(intptr_t  instancePtr);
+uint32  SteamAPI_ISteamUtils_GetAppID_(intptr_t  instancePtr);
+void  SteamAPI_ISteamUtils_SetOverlayNotificationPosition_(intptr_t  instancePtr, ENotificationPosition  eNotificationPosition);
+bool  SteamAPI_ISteamUtils_IsAPICallCompleted_(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, bool * pbFailed);
+ESteamAPICallFailure  SteamAPI_ISteamUtils_GetAPICallFailureReason_(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall);
+bool  SteamAPI_ISteamUtils_GetAPICallResult_(intptr_t  instancePtr, SteamAPICall_t  hSteamAPICall, void * pCallback, int  cubCallback, int  iCallbackExpected, bool * pbFailed);
+uint32  SteamAPI_ISteamUtils_GetIPCCallCount_(intptr_t  instancePtr);
+void  SteamAPI_ISteamUtils_SetWarningMessageHook_(intptr_t  instancePtr, SteamAPIWarningMessageHook_t  pFunction);
+bool  SteamAPI_ISteamUtils_IsOverlayEnabled_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamUtils_BOverlayNeedsPresent_(intptr_t  instancePtr);
+SteamAPICall_t  SteamAPI_ISteamUtils_CheckFileSignature_(intptr_t  instancePtr, char * szFileName);
+bool  SteamAPI_ISteamUtils_ShowGamepadTextInput_(intptr_t  instancePtr, EGamepadTextInputMode  eInputMode, EGamepadTextInputLineMode  eLineInputMode, char * pchDescription, uint32  unCharMax, char * pchExistingText);
+uint32  SteamAPI_ISteamUtils_GetEnteredGamepadTextLength_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamUtils_GetEnteredGamepadTextInput_(intptr_t  instancePtr, char * pchText, uint32  cchText);
+char * SteamAPI_ISteamUtils_GetSteamUILanguage_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamUtils_IsSteamRunningInVR_(intptr_t  instancePtr);
+int  SteamAPI_ISteamMatchmaking_GetFavoriteGameCount_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMatchmaking_GetFavoriteGame_(intptr_t  instancePtr, int  iGame, AppId_t * pnAppID, uint32 * pnIP, uint16 * pnConnPort, uint16 * pnQueryPort, uint32 * punFlags, uint32 * pRTime32LastPlayedOnServer);
+int  SteamAPI_ISteamMatchmaking_AddFavoriteGame_(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags, uint32  rTime32LastPlayedOnServer);
+bool  SteamAPI_ISteamMatchmaking_RemoveFavoriteGame_(intptr_t  instancePtr, AppId_t  nAppID, uint32  nIP, uint16  nConnPort, uint16  nQueryPort, uint32  unFlags);
+SteamAPICall_t  SteamAPI_ISteamMatchmaking_RequestLobbyList_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter_(intptr_t  instancePtr, char * pchKeyToMatch, char * pchValueToMatch, ELobbyComparison  eComparisonType);
+void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter_(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToMatch, ELobbyComparison  eComparisonType);
+void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter_(intptr_t  instancePtr, char * pchKeyToMatch, int  nValueToBeCloseTo);
+void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable_(intptr_t  instancePtr, int  nSlotsAvailable);
+void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter_(intptr_t  instancePtr, ELobbyDistanceFilter  eLobbyDistanceFilter);
+void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter_(intptr_t  instancePtr, int  cMaxResults);
+void  SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+uint64  SteamAPI_ISteamMatchmaking_GetLobbyByIndex_(intptr_t  instancePtr, int  iLobby);
+SteamAPICall_t  SteamAPI_ISteamMatchmaking_CreateLobby_(intptr_t  instancePtr, ELobbyType  eLobbyType, int  cMaxMembers);
+SteamAPICall_t  SteamAPI_ISteamMatchmaking_JoinLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+void  SteamAPI_ISteamMatchmaking_LeaveLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+bool  SteamAPI_ISteamMatchmaking_InviteUserToLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDInvitee);
+int  SteamAPI_ISteamMatchmaking_GetNumLobbyMembers_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+uint64  SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iMember);
+char * SteamAPI_ISteamMatchmaking_GetLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey);
+bool  SteamAPI_ISteamMatchmaking_SetLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue);
+int  SteamAPI_ISteamMatchmaking_GetLobbyDataCount_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+bool  SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iLobbyData, char * pchKey, int  cchKeyBufferSize, char * pchValue, int  cchValueBufferSize);
+bool  SteamAPI_ISteamMatchmaking_DeleteLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey);
+char * SteamAPI_ISteamMatchmaking_GetLobbyMemberData_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDUser, char * pchKey);
+void  SteamAPI_ISteamMatchmaking_SetLobbyMemberData_(intptr_t  instancePtr, CSteamID  steamIDLobby, char * pchKey, char * pchValue);
+bool  SteamAPI_ISteamMatchmaking_SendLobbyChatMsg_(intptr_t  instancePtr, CSteamID  steamIDLobby, void * pvMsgBody, int  cubMsgBody);
+int  SteamAPI_ISteamMatchmaking_GetLobbyChatEntry_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  iChatID, CSteamID * pSteamIDUser, void * pvData, int  cubData, EChatEntryType * peChatEntryType);
+bool  SteamAPI_ISteamMatchmaking_RequestLobbyData_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+void  SteamAPI_ISteamMatchmaking_SetLobbyGameServer_(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32  unGameServerIP, uint16  unGameServerPort, CSteamID  steamIDGameServer);
+bool  SteamAPI_ISteamMatchmaking_GetLobbyGameServer_(intptr_t  instancePtr, CSteamID  steamIDLobby, uint32 * punGameServerIP, uint16 * punGameServerPort, CSteamID * psteamIDGameServer);
+bool  SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit_(intptr_t  instancePtr, CSteamID  steamIDLobby, int  cMaxMembers);
+int  SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+bool  SteamAPI_ISteamMatchmaking_SetLobbyType_(intptr_t  instancePtr, CSteamID  steamIDLobby, ELobbyType  eLobbyType);
+bool  SteamAPI_ISteamMatchmaking_SetLobbyJoinable_(intptr_t  instancePtr, CSteamID  steamIDLobby, bool  bLobbyJoinable);
+uint64  SteamAPI_ISteamMatchmaking_GetLobbyOwner_(intptr_t  instancePtr, CSteamID  steamIDLobby);
+bool  SteamAPI_ISteamMatchmaking_SetLobbyOwner_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDNewOwner);
+bool  SteamAPI_ISteamMatchmaking_SetLinkedLobby_(intptr_t  instancePtr, CSteamID  steamIDLobby, CSteamID  steamIDLobbyDependent);
+void  SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer);
+void  SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer);
+void  SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete_(intptr_t  instancePtr, HServerListRequest  hRequest, EMatchMakingServerResponse  response);
+void  SteamAPI_ISteamMatchmakingPingResponse_ServerResponded_(intptr_t  instancePtr, gameserveritem_t & server);
+void  SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList_(intptr_t  instancePtr, char * pchName, int  nScore, float  flTimePlayed);
+void  SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded_(intptr_t  instancePtr, char * pchRule, char * pchValue);
+void  SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete_(intptr_t  instancePtr);
+HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestInternetServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestLANServerList_(intptr_t  instancePtr, AppId_t  iApp, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+HServerListRequest  SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList_(intptr_t  instancePtr, AppId_t  iApp, MatchMakingKeyValuePair_t ** ppchFilters, uint32  nFilters, ISteamMatchmakingServerListResponse * pRequestServersResponse);
+void  SteamAPI_ISteamMatchmakingServers_ReleaseRequest_(intptr_t  instancePtr, HServerListRequest  hServerListRequest);
+gameserveritem_t * SteamAPI_ISteamMatchmakingServers_GetServerDetails_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer);
+void  SteamAPI_ISteamMatchmakingServers_CancelQuery_(intptr_t  instancePtr, HServerListRequest  hRequest);
+void  SteamAPI_ISteamMatchmakingServers_RefreshQuery_(intptr_t  instancePtr, HServerListRequest  hRequest);
+bool  SteamAPI_ISteamMatchmakingServers_IsRefreshing_(intptr_t  instancePtr, HServerListRequest  hRequest);
+int  SteamAPI_ISteamMatchmakingServers_GetServerCount_(intptr_t  instancePtr, HServerListRequest  hRequest);
+void  SteamAPI_ISteamMatchmakingServers_RefreshServer_(intptr_t  instancePtr, HServerListRequest  hRequest, int  iServer);
+HServerQuery  SteamAPI_ISteamMatchmakingServers_PingServer_(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPingResponse * pRequestServersResponse);
+HServerQuery  SteamAPI_ISteamMatchmakingServers_PlayerDetails_(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingPlayersResponse * pRequestServersResponse);
+HServerQuery  SteamAPI_ISteamMatchmakingServers_ServerRules_(intptr_t  instancePtr, uint32  unIP, uint16  usPort, ISteamMatchmakingRulesResponse * pRequestServersResponse);
+void  SteamAPI_ISteamMatchmakingServers_CancelServerQuery_(intptr_t  instancePtr, HServerQuery  hServerQuery);
+bool  SteamAPI_ISteamRemoteStorage_FileWrite_(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubData);
+int32  SteamAPI_ISteamRemoteStorage_FileRead_(intptr_t  instancePtr, char * pchFile, void * pvData, int32  cubDataToRead);
+bool  SteamAPI_ISteamRemoteStorage_FileForget_(intptr_t  instancePtr, char * pchFile);
+bool  SteamAPI_ISteamRemoteStorage_FileDelete_(intptr_t  instancePtr, char * pchFile);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_FileShare_(intptr_t  instancePtr, char * pchFile);
+bool  SteamAPI_ISteamRemoteStorage_SetSyncPlatforms_(intptr_t  instancePtr, char * pchFile, ERemoteStoragePlatform  eRemoteStoragePlatform);
+UGCFileWriteStreamHandle_t  SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen_(intptr_t  instancePtr, char * pchFile);
+bool  SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk_(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle, void * pvData, int32  cubData);
+bool  SteamAPI_ISteamRemoteStorage_FileWriteStreamClose_(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle);
+bool  SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel_(intptr_t  instancePtr, UGCFileWriteStreamHandle_t  writeHandle);
+bool  SteamAPI_ISteamRemoteStorage_FileExists_(intptr_t  instancePtr, char * pchFile);
+bool  SteamAPI_ISteamRemoteStorage_FilePersisted_(intptr_t  instancePtr, char * pchFile);
+int32  SteamAPI_ISteamRemoteStorage_GetFileSize_(intptr_t  instancePtr, char * pchFile);
+int64  SteamAPI_ISteamRemoteStorage_GetFileTimestamp_(intptr_t  instancePtr, char * pchFile);
+ERemoteStoragePlatform  SteamAPI_ISteamRemoteStorage_GetSyncPlatforms_(intptr_t  instancePtr, char * pchFile);
+int32  SteamAPI_ISteamRemoteStorage_GetFileCount_(intptr_t  instancePtr);
+char * SteamAPI_ISteamRemoteStorage_GetFileNameAndSize_(intptr_t  instancePtr, int  iFile, int32 * pnFileSizeInBytes);
+bool  SteamAPI_ISteamRemoteStorage_GetQuota_(intptr_t  instancePtr, uint64 * pnTotalBytes, uint64 * puAvailableBytes);
+bool  SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp_(intptr_t  instancePtr);
+void  SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp_(intptr_t  instancePtr, bool  bEnabled);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UGCDownload_(intptr_t  instancePtr, UGCHandle_t  hContent, uint32  unPriority);
+bool  SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress_(intptr_t  instancePtr, UGCHandle_t  hContent, int32 * pnBytesDownloaded, int32 * pnBytesExpected);
+bool  SteamAPI_ISteamRemoteStorage_GetUGCDetails_(intptr_t  instancePtr, UGCHandle_t  hContent, AppId_t * pnAppID, char ** ppchName, int32 * pnFileSizeInBytes, CSteamID * pSteamIDOwner);
+int32  SteamAPI_ISteamRemoteStorage_UGCRead_(intptr_t  instancePtr, UGCHandle_t  hContent, void * pvData, int32  cubDataToRead, uint32  cOffset, EUGCReadAction  eAction);
+int32  SteamAPI_ISteamRemoteStorage_GetCachedUGCCount_(intptr_t  instancePtr);
+UGCHandle_t  SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle_(intptr_t  instancePtr, int32  iCachedContent);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_PublishWorkshopFile_(intptr_t  instancePtr, char * pchFile, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags, EWorkshopFileType  eWorkshopFileType);
+PublishedFileUpdateHandle_t  SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId);
+bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchFile);
+bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchPreviewFile);
+bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchTitle);
+bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchDescription);
+bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, ERemoteStoragePublishedFileVisibility  eVisibility);
+bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, uint32  unMaxSecondsOld);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_DeletePublishedFile_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles_(intptr_t  instancePtr, uint32  unStartIndex);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_SubscribePublishedFile_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles_(intptr_t  instancePtr, uint32  unStartIndex);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId);
+bool  SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription_(intptr_t  instancePtr, PublishedFileUpdateHandle_t  updateHandle, char * pchChangeDescription);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, bool  bVoteUp);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles_(intptr_t  instancePtr, CSteamID  steamId, uint32  unStartIndex, SteamParamStringArray_t * pRequiredTags, SteamParamStringArray_t * pExcludedTags);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_PublishVideo_(intptr_t  instancePtr, EWorkshopVideoProvider  eVideoProvider, char * pchVideoAccount, char * pchVideoIdentifier, char * pchPreviewFile, AppId_t  nConsumerAppId, char * pchTitle, char * pchDescription, ERemoteStoragePublishedFileVisibility  eVisibility, SteamParamStringArray_t * pTags);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction_(intptr_t  instancePtr, PublishedFileId_t  unPublishedFileId, EWorkshopFileAction  eAction);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction_(intptr_t  instancePtr, EWorkshopFileAction  eAction, uint32  unStartIndex);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles_(intptr_t  instancePtr, EWorkshopEnumerationType  eEnumerationType, uint32  unStartIndex, uint32  unCount, uint32  unDays, SteamParamStringArray_t * pTags, SteamParamStringArray_t * pUserTags);
+SteamAPICall_t  SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation_(intptr_t  instancePtr, UGCHandle_t  hContent, char * pchLocation, uint32  unPriority);
+bool  SteamAPI_ISteamUserStats_RequestCurrentStats_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamUserStats_GetStat_(intptr_t  instancePtr, char * pchName, int32 * pData);
+bool  SteamAPI_ISteamUserStats_GetStat0_(intptr_t  instancePtr, char * pchName, float * pData);
+bool  SteamAPI_ISteamUserStats_SetStat_(intptr_t  instancePtr, char * pchName, int32  nData);
+bool  SteamAPI_ISteamUserStats_SetStat0_(intptr_t  instancePtr, char * pchName, float  fData);
+bool  SteamAPI_ISteamUserStats_UpdateAvgRateStat_(intptr_t  instancePtr, char * pchName, float  flCountThisSession, double  dSessionLength);
+bool  SteamAPI_ISteamUserStats_GetAchievement_(intptr_t  instancePtr, char * pchName, bool * pbAchieved);
+bool  SteamAPI_ISteamUserStats_SetAchievement_(intptr_t  instancePtr, char * pchName);
+bool  SteamAPI_ISteamUserStats_ClearAchievement_(intptr_t  instancePtr, char * pchName);
+bool  SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime_(intptr_t  instancePtr, char * pchName, bool * pbAchieved, uint32 * punUnlockTime);
+bool  SteamAPI_ISteamUserStats_StoreStats_(intptr_t  instancePtr);
+int  SteamAPI_ISteamUserStats_GetAchievementIcon_(intptr_t  instancePtr, char * pchName);
+char * SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute_(intptr_t  instancePtr, char * pchName, char * pchKey);
+bool  SteamAPI_ISteamUserStats_IndicateAchievementProgress_(intptr_t  instancePtr, char * pchName, uint32  nCurProgress, uint32  nMaxProgress);
+uint32  SteamAPI_ISteamUserStats_GetNumAchievements_(intptr_t  instancePtr);
+char * SteamAPI_ISteamUserStats_GetAchievementName_(intptr_t  instancePtr, uint32  iAchievement);
+SteamAPICall_t  SteamAPI_ISteamUserStats_RequestUserStats_(intptr_t  instancePtr, CSteamID  steamIDUser);
+bool  SteamAPI_ISteamUserStats_GetUserStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData);
+bool  SteamAPI_ISteamUserStats_GetUserStat0_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData);
+bool  SteamAPI_ISteamUserStats_GetUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved);
+bool  SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved, uint32 * punUnlockTime);
+bool  SteamAPI_ISteamUserStats_ResetAllStats_(intptr_t  instancePtr, bool  bAchievementsToo);
+SteamAPICall_t  SteamAPI_ISteamUserStats_FindOrCreateLeaderboard_(intptr_t  instancePtr, char * pchLeaderboardName, ELeaderboardSortMethod  eLeaderboardSortMethod, ELeaderboardDisplayType  eLeaderboardDisplayType);
+SteamAPICall_t  SteamAPI_ISteamUserStats_FindLeaderboard_(intptr_t  instancePtr, char * pchLeaderboardName);
+char * SteamAPI_ISteamUserStats_GetLeaderboardName_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard);
+int  SteamAPI_ISteamUserStats_GetLeaderboardEntryCount_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard);
+ELeaderboardSortMethod  SteamAPI_ISteamUserStats_GetLeaderboardSortMethod_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard);
+ELeaderboardDisplayType  SteamAPI_ISteamUserStats_GetLeaderboardDisplayType_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard);
+SteamAPICall_t  SteamAPI_ISteamUserStats_DownloadLeaderboardEntries_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardDataRequest  eLeaderboardDataRequest, int  nRangeStart, int  nRangeEnd);
+SteamAPICall_t  SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, CSteamID * prgUsers, int  cUsers);
+bool  SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry_(intptr_t  instancePtr, SteamLeaderboardEntries_t  hSteamLeaderboardEntries, int  index, LeaderboardEntry_t * pLeaderboardEntry, int32 * pDetails, int  cDetailsMax);
+SteamAPICall_t  SteamAPI_ISteamUserStats_UploadLeaderboardScore_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, ELeaderboardUploadScoreMethod  eLeaderboardUploadScoreMethod, int32  nScore, int32 * pScoreDetails, int  cScoreDetailsCount);
+SteamAPICall_t  SteamAPI_ISteamUserStats_AttachLeaderboardUGC_(intptr_t  instancePtr, SteamLeaderboard_t  hSteamLeaderboard, UGCHandle_t  hUGC);
+SteamAPICall_t  SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers_(intptr_t  instancePtr);
+SteamAPICall_t  SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages_(intptr_t  instancePtr);
+int  SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo_(intptr_t  instancePtr, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved);
+int  SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo_(intptr_t  instancePtr, int  iIteratorPrevious, char * pchName, uint32  unNameBufLen, float * pflPercent, bool * pbAchieved);
+bool  SteamAPI_ISteamUserStats_GetAchievementAchievedPercent_(intptr_t  instancePtr, char * pchName, float * pflPercent);
+SteamAPICall_t  SteamAPI_ISteamUserStats_RequestGlobalStats_(intptr_t  instancePtr, int  nHistoryDays);
+bool  SteamAPI_ISteamUserStats_GetGlobalStat_(intptr_t  instancePtr, char * pchStatName, int64 * pData);
+bool  SteamAPI_ISteamUserStats_GetGlobalStat0_(intptr_t  instancePtr, char * pchStatName, double * pData);
+int32  SteamAPI_ISteamUserStats_GetGlobalStatHistory_(intptr_t  instancePtr, char * pchStatName, int64 * pData, uint32  cubData);
+int32  SteamAPI_ISteamUserStats_GetGlobalStatHistory0_(intptr_t  instancePtr, char * pchStatName, double * pData, uint32  cubData);
+bool  SteamAPI_ISteamApps_BIsSubscribed_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamApps_BIsLowViolence_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamApps_BIsCybercafe_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamApps_BIsVACBanned_(intptr_t  instancePtr);
+char * SteamAPI_ISteamApps_GetCurrentGameLanguage_(intptr_t  instancePtr);
+char * SteamAPI_ISteamApps_GetAvailableGameLanguages_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamApps_BIsSubscribedApp_(intptr_t  instancePtr, AppId_t  appID);
+bool  SteamAPI_ISteamApps_BIsDlcInstalled_(intptr_t  instancePtr, AppId_t  appID);
+uint32  SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime_(intptr_t  instancePtr, AppId_t  nAppID);
+bool  SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend_(intptr_t  instancePtr);
+int  SteamAPI_ISteamApps_GetDLCCount_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamApps_BGetDLCDataByIndex_(intptr_t  instancePtr, int  iDLC, AppId_t * pAppID, bool * pbAvailable, char * pchName, int  cchNameBufferSize);
+void  SteamAPI_ISteamApps_InstallDLC_(intptr_t  instancePtr, AppId_t  nAppID);
+void  SteamAPI_ISteamApps_UninstallDLC_(intptr_t  instancePtr, AppId_t  nAppID);
+void  SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey_(intptr_t  instancePtr, AppId_t  nAppID);
+bool  SteamAPI_ISteamApps_GetCurrentBetaName_(intptr_t  instancePtr, char * pchName, int  cchNameBufferSize);
+bool  SteamAPI_ISteamApps_MarkContentCorrupt_(intptr_t  instancePtr, bool  bMissingFilesOnly);
+uint32  SteamAPI_ISteamApps_GetInstalledDepots_(intptr_t  instancePtr, AppId_t  appID, DepotId_t * pvecDepots, uint32  cMaxDepots);
+uint32  SteamAPI_ISteamApps_GetAppInstallDir_(intptr_t  instancePtr, AppId_t  appID, char * pchFolder, uint32  cchFolderBufferSize);
+bool  SteamAPI_ISteamApps_BIsAppInstalled_(intptr_t  instancePtr, AppId_t  appID);
+uint64  SteamAPI_ISteamApps_GetAppOwner_(intptr_t  instancePtr);
+char * SteamAPI_ISteamApps_GetLaunchQueryParam_(intptr_t  instancePtr, char * pchKey);
+bool  SteamAPI_ISteamApps_GetDlcDownloadProgress_(intptr_t  instancePtr, AppId_t  nAppID, uint64 * punBytesDownloaded, uint64 * punBytesTotal);
+int  SteamAPI_ISteamApps_GetAppBuildId_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamNetworking_SendP2PPacket_(intptr_t  instancePtr, CSteamID  steamIDRemote, void * pubData, uint32  cubData, EP2PSend  eP2PSendType, int  nChannel);
+bool  SteamAPI_ISteamNetworking_IsP2PPacketAvailable_(intptr_t  instancePtr, uint32 * pcubMsgSize, int  nChannel);
+bool  SteamAPI_ISteamNetworking_ReadP2PPacket_(intptr_t  instancePtr, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, CSteamID * psteamIDRemote, int  nChannel);
+bool  SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser_(intptr_t  instancePtr, CSteamID  steamIDRemote);
+bool  SteamAPI_ISteamNetworking_CloseP2PSessionWithUser_(intptr_t  instancePtr, CSteamID  steamIDRemote);
+bool  SteamAPI_ISteamNetworking_CloseP2PChannelWithUser_(intptr_t  instancePtr, CSteamID  steamIDRemote, int  nChannel);
+bool  SteamAPI_ISteamNetworking_GetP2PSessionState_(intptr_t  instancePtr, CSteamID  steamIDRemote, P2PSessionState_t * pConnectionState);
+bool  SteamAPI_ISteamNetworking_AllowP2PPacketRelay_(intptr_t  instancePtr, bool  bAllow);
+SNetListenSocket_t  SteamAPI_ISteamNetworking_CreateListenSocket_(intptr_t  instancePtr, int  nVirtualP2PPort, uint32  nIP, uint16  nPort, bool  bAllowUseOfPacketRelay);
+SNetSocket_t  SteamAPI_ISteamNetworking_CreateP2PConnectionSocket_(intptr_t  instancePtr, CSteamID  steamIDTarget, int  nVirtualPort, int  nTimeoutSec, bool  bAllowUseOfPacketRelay);
+SNetSocket_t  SteamAPI_ISteamNetworking_CreateConnectionSocket_(intptr_t  instancePtr, uint32  nIP, uint16  nPort, int  nTimeoutSec);
+bool  SteamAPI_ISteamNetworking_DestroySocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, bool  bNotifyRemoteEnd);
+bool  SteamAPI_ISteamNetworking_DestroyListenSocket_(intptr_t  instancePtr, SNetListenSocket_t  hSocket, bool  bNotifyRemoteEnd);
+bool  SteamAPI_ISteamNetworking_SendDataOnSocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubData, uint32  cubData, bool  bReliable);
+bool  SteamAPI_ISteamNetworking_IsDataAvailableOnSocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, uint32 * pcubMsgSize);
+bool  SteamAPI_ISteamNetworking_RetrieveDataFromSocket_(intptr_t  instancePtr, SNetSocket_t  hSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize);
+bool  SteamAPI_ISteamNetworking_IsDataAvailable_(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pcubMsgSize, SNetSocket_t * phSocket);
+bool  SteamAPI_ISteamNetworking_RetrieveData_(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, void * pubDest, uint32  cubDest, uint32 * pcubMsgSize, SNetSocket_t * phSocket);
+bool  SteamAPI_ISteamNetworking_GetSocketInfo_(intptr_t  instancePtr, SNetSocket_t  hSocket, CSteamID * pSteamIDRemote, int * peSocketStatus, uint32 * punIPRemote, uint16 * punPortRemote);
+bool  SteamAPI_ISteamNetworking_GetListenSocketInfo_(intptr_t  instancePtr, SNetListenSocket_t  hListenSocket, uint32 * pnIP, uint16 * pnPort);
+ESNetSocketConnectionType  SteamAPI_ISteamNetworking_GetSocketConnectionType_(intptr_t  instancePtr, SNetSocket_t  hSocket);
+int  SteamAPI_ISteamNetworking_GetMaxPacketSize_(intptr_t  instancePtr, SNetSocket_t  hSocket);
+ScreenshotHandle  SteamAPI_ISteamScreenshots_WriteScreenshot_(intptr_t  instancePtr, void * pubRGB, uint32  cubRGB, int  nWidth, int  nHeight);
+ScreenshotHandle  SteamAPI_ISteamScreenshots_AddScreenshotToLibrary_(intptr_t  instancePtr, char * pchFilename, char * pchThumbnailFilename, int  nWidth, int  nHeight);
+void  SteamAPI_ISteamScreenshots_TriggerScreenshot_(intptr_t  instancePtr);
+void  SteamAPI_ISteamScreenshots_HookScreenshots_(intptr_t  instancePtr, bool  bHook);
+bool  SteamAPI_ISteamScreenshots_SetLocation_(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, char * pchLocation);
+bool  SteamAPI_ISteamScreenshots_TagUser_(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, CSteamID  steamID);
+bool  SteamAPI_ISteamScreenshots_TagPublishedFile_(intptr_t  instancePtr, ScreenshotHandle  hScreenshot, PublishedFileId_t  unPublishedFileID);
+bool  SteamAPI_ISteamMusic_BIsEnabled_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusic_BIsPlaying_(intptr_t  instancePtr);
+AudioPlayback_Status  SteamAPI_ISteamMusic_GetPlaybackStatus_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMusic_Play_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMusic_Pause_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMusic_PlayPrevious_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMusic_PlayNext_(intptr_t  instancePtr);
+void  SteamAPI_ISteamMusic_SetVolume_(intptr_t  instancePtr, float  flVolume);
+float  SteamAPI_ISteamMusic_GetVolume_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote_(intptr_t  instancePtr, char * pchName);
+bool  SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_BActivationSuccess_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_SetDisplayName_(intptr_t  instancePtr, char * pchDisplayName);
+bool  SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64_(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength);
+bool  SteamAPI_ISteamMusicRemote_EnablePlayPrevious_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_EnablePlayNext_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_EnableShuffled_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_EnableLooped_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_EnableQueue_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_EnablePlaylists_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus_(intptr_t  instancePtr, AudioPlayback_Status  nStatus);
+bool  SteamAPI_ISteamMusicRemote_UpdateShuffled_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_UpdateLooped_(intptr_t  instancePtr, bool  bValue);
+bool  SteamAPI_ISteamMusicRemote_UpdateVolume_(intptr_t  instancePtr, float  flValue);
+bool  SteamAPI_ISteamMusicRemote_CurrentEntryWillChange_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable_(intptr_t  instancePtr, bool  bAvailable);
+bool  SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText_(intptr_t  instancePtr, char * pchText);
+bool  SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds_(intptr_t  instancePtr, int  nValue);
+bool  SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt_(intptr_t  instancePtr, void * pvBuffer, uint32  cbBufferLength);
+bool  SteamAPI_ISteamMusicRemote_CurrentEntryDidChange_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_QueueWillChange_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_ResetQueueEntries_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_SetQueueEntry_(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText);
+bool  SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry_(intptr_t  instancePtr, int  nID);
+bool  SteamAPI_ISteamMusicRemote_QueueDidChange_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_PlaylistWillChange_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_ResetPlaylistEntries_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamMusicRemote_SetPlaylistEntry_(intptr_t  instancePtr, int  nID, int  nPosition, char * pchEntryText);
+bool  SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry_(intptr_t  instancePtr, int  nID);
+bool  SteamAPI_ISteamMusicRemote_PlaylistDidChange_(intptr_t  instancePtr);
+HTTPRequestHandle  SteamAPI_ISteamHTTP_CreateHTTPRequest_(intptr_t  instancePtr, EHTTPMethod  eHTTPRequestMethod, char * pchAbsoluteURL);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestContextValue_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint64  ulContextValue);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unTimeoutSeconds);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, char * pchHeaderValue);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchParamName, char * pchParamValue);
+bool  SteamAPI_ISteamHTTP_SendHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle);
+bool  SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, SteamAPICall_t * pCallHandle);
+bool  SteamAPI_ISteamHTTP_DeferHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest);
+bool  SteamAPI_ISteamHTTP_PrioritizeHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest);
+bool  SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint32 * unResponseHeaderSize);
+bool  SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchHeaderName, uint8 * pHeaderValueBuffer, uint32  unBufferSize);
+bool  SteamAPI_ISteamHTTP_GetHTTPResponseBodySize_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32 * unBodySize);
+bool  SteamAPI_ISteamHTTP_GetHTTPResponseBodyData_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint8 * pBodyDataBuffer, uint32  unBufferSize);
+bool  SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  cOffset, uint8 * pBodyDataBuffer, uint32  unBufferSize);
+bool  SteamAPI_ISteamHTTP_ReleaseHTTPRequest_(intptr_t  instancePtr, HTTPRequestHandle  hRequest);
+bool  SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, float * pflPercentOut);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchContentType, uint8 * pubBody, uint32  unBodyLen);
+HTTPCookieContainerHandle  SteamAPI_ISteamHTTP_CreateCookieContainer_(intptr_t  instancePtr, bool  bAllowResponsesToModify);
+bool  SteamAPI_ISteamHTTP_ReleaseCookieContainer_(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer);
+bool  SteamAPI_ISteamHTTP_SetCookie_(intptr_t  instancePtr, HTTPCookieContainerHandle  hCookieContainer, char * pchHost, char * pchUrl, char * pchCookie);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, HTTPCookieContainerHandle  hCookieContainer);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, char * pchUserAgentInfo);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool  bRequireVerifiedCertificate);
+bool  SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, uint32  unMilliseconds);
+bool  SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut_(intptr_t  instancePtr, HTTPRequestHandle  hRequest, bool * pbWasTimedOut);
+ClientUnifiedMessageHandle  SteamAPI_ISteamUnifiedMessages_SendMethod_(intptr_t  instancePtr, char * pchServiceMethod, void * pRequestBuffer, uint32  unRequestBufferSize, uint64  unContext);
+bool  SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo_(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, uint32 * punResponseSize, EResult * peResult);
+bool  SteamAPI_ISteamUnifiedMessages_GetMethodResponseData_(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle, void * pResponseBuffer, uint32  unResponseBufferSize, bool  bAutoRelease);
+bool  SteamAPI_ISteamUnifiedMessages_ReleaseMethod_(intptr_t  instancePtr, ClientUnifiedMessageHandle  hHandle);
+bool  SteamAPI_ISteamUnifiedMessages_SendNotification_(intptr_t  instancePtr, char * pchServiceNotification, void * pNotificationBuffer, uint32  unNotificationBufferSize);
+bool  SteamAPI_ISteamController_Init_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamController_Shutdown_(intptr_t  instancePtr);
+void  SteamAPI_ISteamController_RunFrame_(intptr_t  instancePtr);
+void  SteamAPI_ISteamController_TriggerHapticPulse_(intptr_t  instancePtr, ControllerHandle_t  controllerHandle, ESteamControllerPad  eTargetPad, unsigned short  usDurationMicroSec);
+UGCQueryHandle_t  SteamAPI_ISteamUGC_CreateQueryUserUGCRequest_(intptr_t  instancePtr, AccountID_t  unAccountID, EUserUGCList  eListType, EUGCMatchingUGCType  eMatchingUGCType, EUserUGCListSortOrder  eSortOrder, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage);
+UGCQueryHandle_t  SteamAPI_ISteamUGC_CreateQueryAllUGCRequest_(intptr_t  instancePtr, EUGCQuery  eQueryType, EUGCMatchingUGCType  eMatchingeMatchingUGCTypeFileType, AppId_t  nCreatorAppID, AppId_t  nConsumerAppID, uint32  unPage);
+UGCQueryHandle_t  SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest_(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  unNumPublishedFileIDs);
+SteamAPICall_t  SteamAPI_ISteamUGC_SendQueryUGCRequest_(intptr_t  instancePtr, UGCQueryHandle_t  handle);
+bool  SteamAPI_ISteamUGC_GetQueryUGCResult_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, SteamUGCDetails_t * pDetails);
+bool  SteamAPI_ISteamUGC_GetQueryUGCPreviewURL_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchURL, uint32  cchURLSize);
+bool  SteamAPI_ISteamUGC_GetQueryUGCMetadata_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, char * pchMetadata, uint32  cchMetadatasize);
+bool  SteamAPI_ISteamUGC_GetQueryUGCChildren_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries);
+bool  SteamAPI_ISteamUGC_GetQueryUGCStatistic_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, EItemStatistic  eStatType, uint64 * pStatValue);
+uint32  SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index);
+bool  SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  index, uint32  previewIndex, char * pchURLOrVideoID, uint32  cchURLSize, char * pchOriginalFileName, uint32  cchOriginalFileNameSize, EItemPreviewType * pPreviewType);
+bool  SteamAPI_ISteamUGC_ReleaseQueryUGCRequest_(intptr_t  instancePtr, UGCQueryHandle_t  handle);
+bool  SteamAPI_ISteamUGC_AddRequiredTag_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName);
+bool  SteamAPI_ISteamUGC_AddExcludedTag_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pTagName);
+bool  SteamAPI_ISteamUGC_SetReturnLongDescription_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnLongDescription);
+bool  SteamAPI_ISteamUGC_SetReturnMetadata_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnMetadata);
+bool  SteamAPI_ISteamUGC_SetReturnChildren_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnChildren);
+bool  SteamAPI_ISteamUGC_SetReturnAdditionalPreviews_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnAdditionalPreviews);
+bool  SteamAPI_ISteamUGC_SetReturnTotalOnly_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bReturnTotalOnly);
+bool  SteamAPI_ISteamUGC_SetAllowCachedResponse_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unMaxAgeSeconds);
+bool  SteamAPI_ISteamUGC_SetCloudFileNameFilter_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pMatchCloudFileName);
+bool  SteamAPI_ISteamUGC_SetMatchAnyTag_(intptr_t  instancePtr, UGCQueryHandle_t  handle, bool  bMatchAnyTag);
+bool  SteamAPI_ISteamUGC_SetSearchText_(intptr_t  instancePtr, UGCQueryHandle_t  handle, char * pSearchText);
+bool  SteamAPI_ISteamUGC_SetRankedByTrendDays_(intptr_t  instancePtr, UGCQueryHandle_t  handle, uint32  unDays);
+SteamAPICall_t  SteamAPI_ISteamUGC_RequestUGCDetails_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint32  unMaxAgeSeconds);
+SteamAPICall_t  SteamAPI_ISteamUGC_CreateItem_(intptr_t  instancePtr, AppId_t  nConsumerAppId, EWorkshopFileType  eFileType);
+UGCUpdateHandle_t  SteamAPI_ISteamUGC_StartItemUpdate_(intptr_t  instancePtr, AppId_t  nConsumerAppId, PublishedFileId_t  nPublishedFileID);
+bool  SteamAPI_ISteamUGC_SetItemTitle_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchTitle);
+bool  SteamAPI_ISteamUGC_SetItemDescription_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchDescription);
+bool  SteamAPI_ISteamUGC_SetItemMetadata_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchMetaData);
+bool  SteamAPI_ISteamUGC_SetItemVisibility_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, ERemoteStoragePublishedFileVisibility  eVisibility);
+bool  SteamAPI_ISteamUGC_SetItemTags_(intptr_t  instancePtr, UGCUpdateHandle_t  updateHandle, SteamParamStringArray_t * pTags);
+bool  SteamAPI_ISteamUGC_SetItemContent_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszContentFolder);
+bool  SteamAPI_ISteamUGC_SetItemPreview_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pszPreviewFile);
+SteamAPICall_t  SteamAPI_ISteamUGC_SubmitItemUpdate_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, char * pchChangeNote);
+EItemUpdateStatus  SteamAPI_ISteamUGC_GetItemUpdateProgress_(intptr_t  instancePtr, UGCUpdateHandle_t  handle, uint64 * punBytesProcessed, uint64 * punBytesTotal);
+SteamAPICall_t  SteamAPI_ISteamUGC_AddItemToFavorites_(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID);
+SteamAPICall_t  SteamAPI_ISteamUGC_RemoveItemFromFavorites_(intptr_t  instancePtr, AppId_t  nAppId, PublishedFileId_t  nPublishedFileID);
+SteamAPICall_t  SteamAPI_ISteamUGC_SubscribeItem_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID);
+SteamAPICall_t  SteamAPI_ISteamUGC_UnsubscribeItem_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID);
+uint32  SteamAPI_ISteamUGC_GetNumSubscribedItems_(intptr_t  instancePtr);
+uint32  SteamAPI_ISteamUGC_GetSubscribedItems_(intptr_t  instancePtr, PublishedFileId_t * pvecPublishedFileID, uint32  cMaxEntries);
+uint32  SteamAPI_ISteamUGC_GetItemState_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID);
+bool  SteamAPI_ISteamUGC_GetItemInstallInfo_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punSizeOnDisk, char * pchFolder, uint32  cchFolderSize, uint32 * punTimeStamp);
+bool  SteamAPI_ISteamUGC_GetItemDownloadInfo_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, uint64 * punBytesDownloaded, uint64 * punBytesTotal);
+bool  SteamAPI_ISteamUGC_DownloadItem_(intptr_t  instancePtr, PublishedFileId_t  nPublishedFileID, bool  bHighPriority);
+uint32  SteamAPI_ISteamAppList_GetNumInstalledApps_(intptr_t  instancePtr);
+uint32  SteamAPI_ISteamAppList_GetInstalledApps_(intptr_t  instancePtr, AppId_t * pvecAppID, uint32  unMaxAppIDs);
+int  SteamAPI_ISteamAppList_GetAppName_(intptr_t  instancePtr, AppId_t  nAppID, char * pchName, int  cchNameMax);
+int  SteamAPI_ISteamAppList_GetAppInstallDir_(intptr_t  instancePtr, AppId_t  nAppID, char * pchDirectory, int  cchNameMax);
+int  SteamAPI_ISteamAppList_GetAppBuildId_(intptr_t  instancePtr, AppId_t  nAppID);
+void  SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamHTMLSurface_Init_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamHTMLSurface_Shutdown_(intptr_t  instancePtr);
+SteamAPICall_t  SteamAPI_ISteamHTMLSurface_CreateBrowser_(intptr_t  instancePtr, char * pchUserAgent, char * pchUserCSS);
+void  SteamAPI_ISteamHTMLSurface_RemoveBrowser_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_LoadURL_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchURL, char * pchPostData);
+void  SteamAPI_ISteamHTMLSurface_SetSize_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  unWidth, uint32  unHeight);
+void  SteamAPI_ISteamHTMLSurface_StopLoad_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_Reload_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_GoBack_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_GoForward_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_AddHeader_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchKey, char * pchValue);
+void  SteamAPI_ISteamHTMLSurface_ExecuteJavascript_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchScript);
+void  SteamAPI_ISteamHTMLSurface_MouseUp_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton);
+void  SteamAPI_ISteamHTMLSurface_MouseDown_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton);
+void  SteamAPI_ISteamHTMLSurface_MouseDoubleClick_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, ISteamHTMLSurface::EHTMLMouseButton  eMouseButton);
+void  SteamAPI_ISteamHTMLSurface_MouseMove_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y);
+void  SteamAPI_ISteamHTMLSurface_MouseWheel_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int32  nDelta);
+void  SteamAPI_ISteamHTMLSurface_KeyDown_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers);
+void  SteamAPI_ISteamHTMLSurface_KeyUp_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nNativeKeyCode, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers);
+void  SteamAPI_ISteamHTMLSurface_KeyChar_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  cUnicodeChar, ISteamHTMLSurface::EHTMLKeyModifiers  eHTMLKeyModifiers);
+void  SteamAPI_ISteamHTMLSurface_SetHorizontalScroll_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll);
+void  SteamAPI_ISteamHTMLSurface_SetVerticalScroll_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, uint32  nAbsolutePixelScroll);
+void  SteamAPI_ISteamHTMLSurface_SetKeyFocus_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bHasKeyFocus);
+void  SteamAPI_ISteamHTMLSurface_ViewSource_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_CopyToClipboard_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_PasteFromClipboard_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_Find_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, char * pchSearchStr, bool  bCurrentlyInFind, bool  bReverse);
+void  SteamAPI_ISteamHTMLSurface_StopFind_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle);
+void  SteamAPI_ISteamHTMLSurface_GetLinkAtPosition_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, int  x, int  y);
+void  SteamAPI_ISteamHTMLSurface_SetCookie_(intptr_t  instancePtr, char * pchHostname, char * pchKey, char * pchValue, char * pchPath, RTime32  nExpires, bool  bSecure, bool  bHTTPOnly);
+void  SteamAPI_ISteamHTMLSurface_SetPageScaleFactor_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, float  flZoom, int  nPointX, int  nPointY);
+void  SteamAPI_ISteamHTMLSurface_SetBackgroundMode_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bBackgroundMode);
+void  SteamAPI_ISteamHTMLSurface_AllowStartRequest_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bAllowed);
+void  SteamAPI_ISteamHTMLSurface_JSDialogResponse_(intptr_t  instancePtr, HHTMLBrowser  unBrowserHandle, bool  bResult);
+EResult  SteamAPI_ISteamInventory_GetResultStatus_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle);
+bool  SteamAPI_ISteamInventory_GetResultItems_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, SteamItemDetails_t * pOutItemsArray, uint32 * punOutItemsArraySize);
+uint32  SteamAPI_ISteamInventory_GetResultTimestamp_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle);
+bool  SteamAPI_ISteamInventory_CheckResultSteamID_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, CSteamID  steamIDExpected);
+void  SteamAPI_ISteamInventory_DestroyResult_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle);
+bool  SteamAPI_ISteamInventory_GetAllItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle);
+bool  SteamAPI_ISteamInventory_GetItemsByID_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t * pInstanceIDs, uint32  unCountInstanceIDs);
+bool  SteamAPI_ISteamInventory_SerializeResult_(intptr_t  instancePtr, SteamInventoryResult_t  resultHandle, void * pOutBuffer, uint32 * punOutBufferSize);
+bool  SteamAPI_ISteamInventory_DeserializeResult_(intptr_t  instancePtr, SteamInventoryResult_t * pOutResultHandle, void * pBuffer, uint32  unBufferSize, bool  bRESERVED_MUST_BE_FALSE);
+bool  SteamAPI_ISteamInventory_GenerateItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32 * punArrayQuantity, uint32  unArrayLength);
+bool  SteamAPI_ISteamInventory_GrantPromoItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle);
+bool  SteamAPI_ISteamInventory_AddPromoItem_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  itemDef);
+bool  SteamAPI_ISteamInventory_AddPromoItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayItemDefs, uint32  unArrayLength);
+bool  SteamAPI_ISteamInventory_ConsumeItem_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemConsume, uint32  unQuantity);
+bool  SteamAPI_ISteamInventory_ExchangeItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t * pArrayGenerate, uint32 * punArrayGenerateQuantity, uint32  unArrayGenerateLength, SteamItemInstanceID_t * pArrayDestroy, uint32 * punArrayDestroyQuantity, uint32  unArrayDestroyLength);
+bool  SteamAPI_ISteamInventory_TransferItemQuantity_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemInstanceID_t  itemIdSource, uint32  unQuantity, SteamItemInstanceID_t  itemIdDest);
+void  SteamAPI_ISteamInventory_SendItemDropHeartbeat_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamInventory_TriggerItemDrop_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, SteamItemDef_t  dropListDefinition);
+bool  SteamAPI_ISteamInventory_TradeItems_(intptr_t  instancePtr, SteamInventoryResult_t * pResultHandle, CSteamID  steamIDTradePartner, SteamItemInstanceID_t * pArrayGive, uint32 * pArrayGiveQuantity, uint32  nArrayGiveLength, SteamItemInstanceID_t * pArrayGet, uint32 * pArrayGetQuantity, uint32  nArrayGetLength);
+bool  SteamAPI_ISteamInventory_LoadItemDefinitions_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamInventory_GetItemDefinitionIDs_(intptr_t  instancePtr, SteamItemDef_t * pItemDefIDs, uint32 * punItemDefIDsArraySize);
+bool  SteamAPI_ISteamInventory_GetItemDefinitionProperty_(intptr_t  instancePtr, SteamItemDef_t  iDefinition, char * pchPropertyName, char * pchValueBuffer, uint32 * punValueBufferSizeOut);
+void  SteamAPI_ISteamVideo_GetVideoURL_(intptr_t  instancePtr, AppId_t  unVideoAppID);
+bool  SteamAPI_ISteamVideo_IsBroadcasting_(intptr_t  instancePtr, int * pnNumViewers);
+bool  SteamAPI_ISteamGameServer_InitGameServer_(intptr_t  instancePtr, uint32  unIP, uint16  usGamePort, uint16  usQueryPort, uint32  unFlags, AppId_t  nGameAppId, char * pchVersionString);
+void  SteamAPI_ISteamGameServer_SetProduct_(intptr_t  instancePtr, char * pszProduct);
+void  SteamAPI_ISteamGameServer_SetGameDescription_(intptr_t  instancePtr, char * pszGameDescription);
+void  SteamAPI_ISteamGameServer_SetModDir_(intptr_t  instancePtr, char * pszModDir);
+void  SteamAPI_ISteamGameServer_SetDedicatedServer_(intptr_t  instancePtr, bool  bDedicated);
+void  SteamAPI_ISteamGameServer_LogOn_(intptr_t  instancePtr, char * pszToken);
+void  SteamAPI_ISteamGameServer_LogOnAnonymous_(intptr_t  instancePtr);
+void  SteamAPI_ISteamGameServer_LogOff_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamGameServer_BLoggedOn_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamGameServer_BSecure_(intptr_t  instancePtr);
+uint64  SteamAPI_ISteamGameServer_GetSteamID_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamGameServer_WasRestartRequested_(intptr_t  instancePtr);
+void  SteamAPI_ISteamGameServer_SetMaxPlayerCount_(intptr_t  instancePtr, int  cPlayersMax);
+void  SteamAPI_ISteamGameServer_SetBotPlayerCount_(intptr_t  instancePtr, int  cBotplayers);
+void  SteamAPI_ISteamGameServer_SetServerName_(intptr_t  instancePtr, char * pszServerName);
+void  SteamAPI_ISteamGameServer_SetMapName_(intptr_t  instancePtr, char * pszMapName);
+void  SteamAPI_ISteamGameServer_SetPasswordProtected_(intptr_t  instancePtr, bool  bPasswordProtected);
+void  SteamAPI_ISteamGameServer_SetSpectatorPort_(intptr_t  instancePtr, uint16  unSpectatorPort);
+void  SteamAPI_ISteamGameServer_SetSpectatorServerName_(intptr_t  instancePtr, char * pszSpectatorServerName);
+void  SteamAPI_ISteamGameServer_ClearAllKeyValues_(intptr_t  instancePtr);
+void  SteamAPI_ISteamGameServer_SetKeyValue_(intptr_t  instancePtr, char * pKey, char * pValue);
+void  SteamAPI_ISteamGameServer_SetGameTags_(intptr_t  instancePtr, char * pchGameTags);
+void  SteamAPI_ISteamGameServer_SetGameData_(intptr_t  instancePtr, char * pchGameData);
+void  SteamAPI_ISteamGameServer_SetRegion_(intptr_t  instancePtr, char * pszRegion);
+bool  SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate_(intptr_t  instancePtr, uint32  unIPClient, void * pvAuthBlob, uint32  cubAuthBlobSize, CSteamID * pSteamIDUser);
+uint64  SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection_(intptr_t  instancePtr);
+void  SteamAPI_ISteamGameServer_SendUserDisconnect_(intptr_t  instancePtr, CSteamID  steamIDUser);
+bool  SteamAPI_ISteamGameServer_BUpdateUserData_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchPlayerName, uint32  uScore);
+HAuthTicket  SteamAPI_ISteamGameServer_GetAuthSessionTicket_(intptr_t  instancePtr, void * pTicket, int  cbMaxTicket, uint32 * pcbTicket);
+EBeginAuthSessionResult  SteamAPI_ISteamGameServer_BeginAuthSession_(intptr_t  instancePtr, void * pAuthTicket, int  cbAuthTicket, CSteamID  steamID);
+void  SteamAPI_ISteamGameServer_EndAuthSession_(intptr_t  instancePtr, CSteamID  steamID);
+void  SteamAPI_ISteamGameServer_CancelAuthTicket_(intptr_t  instancePtr, HAuthTicket  hAuthTicket);
+EUserHasLicenseForAppResult  SteamAPI_ISteamGameServer_UserHasLicenseForApp_(intptr_t  instancePtr, CSteamID  steamID, AppId_t  appID);
+bool  SteamAPI_ISteamGameServer_RequestUserGroupStatus_(intptr_t  instancePtr, CSteamID  steamIDUser, CSteamID  steamIDGroup);
+void  SteamAPI_ISteamGameServer_GetGameplayStats_(intptr_t  instancePtr);
+SteamAPICall_t  SteamAPI_ISteamGameServer_GetServerReputation_(intptr_t  instancePtr);
+uint32  SteamAPI_ISteamGameServer_GetPublicIP_(intptr_t  instancePtr);
+bool  SteamAPI_ISteamGameServer_HandleIncomingPacket_(intptr_t  instancePtr, void * pData, int  cbData, uint32  srcIP, uint16  srcPort);
+int  SteamAPI_ISteamGameServer_GetNextOutgoingPacket_(intptr_t  instancePtr, void * pOut, int  cbMaxOut, uint32 * pNetAdr, uint16 * pPort);
+void  SteamAPI_ISteamGameServer_EnableHeartbeats_(intptr_t  instancePtr, bool  bActive);
+void  SteamAPI_ISteamGameServer_SetHeartbeatInterval_(intptr_t  instancePtr, int  iHeartbeatInterval);
+void  SteamAPI_ISteamGameServer_ForceHeartbeat_(intptr_t  instancePtr);
+SteamAPICall_t  SteamAPI_ISteamGameServer_AssociateWithClan_(intptr_t  instancePtr, CSteamID  steamIDClan);
+SteamAPICall_t  SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility_(intptr_t  instancePtr, CSteamID  steamIDNewPlayer);
+SteamAPICall_t  SteamAPI_ISteamGameServerStats_RequestUserStats_(intptr_t  instancePtr, CSteamID  steamIDUser);
+bool  SteamAPI_ISteamGameServerStats_GetUserStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32 * pData);
+bool  SteamAPI_ISteamGameServerStats_GetUserStat0_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float * pData);
+bool  SteamAPI_ISteamGameServerStats_GetUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, bool * pbAchieved);
+bool  SteamAPI_ISteamGameServerStats_SetUserStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, int32  nData);
+bool  SteamAPI_ISteamGameServerStats_SetUserStat0_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  fData);
+bool  SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName, float  flCountThisSession, double  dSessionLength);
+bool  SteamAPI_ISteamGameServerStats_SetUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName);
+bool  SteamAPI_ISteamGameServerStats_ClearUserAchievement_(intptr_t  instancePtr, CSteamID  steamIDUser, char * pchName);
+SteamAPICall_t  SteamAPI_ISteamGameServerStats_StoreUserStats_(intptr_t  instancePtr, CSteamID  steamIDUser);
+ISteamClient * SteamClient_();
+ISteamUser * SteamUser_();
+ISteamFriends * SteamFriends_();
+ISteamUtils * SteamUtils_();
+ISteamMatchmaking * SteamMatchmaking_();
+ISteamUserStats * SteamUserStats_();
+ISteamApps * SteamApps_();
+ISteamNetworking * SteamNetworking_();
+ISteamMatchmakingServers * SteamMatchmakingServers_();
+ISteamRemoteStorage * SteamRemoteStorage_();
+ISteamScreenshots * SteamScreenshots_();
+ISteamHTTP * SteamHTTP_();
+ISteamUnifiedMessages * SteamUnifiedMessages_();
+ISteamController * SteamController_();
+ISteamUGC * SteamUGC_();
+ISteamAppList * SteamAppList_();
+ISteamMusic * SteamMusic_();
+ISteamMusicRemote * SteamMusicRemote_();
+ISteamHTMLSurface * SteamHTMLSurface_();
+ISteamInventory * SteamInventory_();
+ISteamVideo * SteamVideo_();
+}
+
+static void replay0(Replay &r)
+{
+  r.result(SteamAPI_Init_());
+}
+
+static void replay1(Replay &r)
+{
+  SteamAPI_Shutdown_();
+}
+
+static void replay2(Replay &r)
+{
+  r.result(SteamAPI_RestartAppIfNecessary_(r.arg<uint32>(0)));
+}
+
+static void replay3(Replay &r)
+{
+  SteamAPI_WriteMiniDump_(r.arg<uint32>(0), r.arg<void *>(1), r.arg<uint32>(2));
+}
+
+static void replay4(Replay &r)
+{
+  SteamAPI_SetMiniDumpComment_(r.arg<char *>(0));
+}
+
+static void replay5(Replay &r)
+{
+  SteamAPI_RunCallbacks_();
+}
+
+static void replay6(Replay &r)
+{
+  r.result(SteamAPI_IsSteamRunning_());
+}
+
+static void replay7(Replay &r)
+{
+  Steam_RunCallbacks_(r.arg<HSteamPipe>(0), r.arg<bool>(1));
+}
+
+static void replay8(Replay &r)
+{
+  Steam_RegisterInterfaceFuncs_(r.arg<void *>(0));
+}
+
+static void replay9(Replay &r)
+{
+  r.result(Steam_GetHSteamUserCurrent_());
+}
+
+static void replay10(Replay &r)
+{
+  r.result(SteamAPI_GetSteamInstallPath_());
+}
+
+static void replay11(Replay &r)
+{
+  r.result(SteamAPI_GetHSteamPipe_());
+}
+
+static void replay12(Replay &r)
+{
+  SteamAPI_SetTryCatchCallbacks_(r.arg<bool>(0));
+}
+
+static void replay13(Replay &r)
+{
+  r.result(GetHSteamPipe_());
+}
+
+static void replay14(Replay &r)
+{
+  r.result(GetHSteamUser_());
+}
+
+static void replay15(Replay &r)
+{
+  r.result(SteamAPI_InitSafe_());
+}
+
+static void replay16(Replay &r)
+{
+  r.result(SteamAPI_GetHSteamUser_());
+}
+
+static void replay17(Replay &r)
+{
+  SteamAPI_UseBreakpadCrashHandler_(r.arg<char const *>(0), r.arg<char const *>(1), r.arg<char const *>(2), r.arg<bool>(3), r.arg<void *>(4), r.arg<PFNPreMinidumpCallback>(5));
+}
+
+static void replay18(Replay &r)
+{
+  SteamAPI_SetBreakpadAppID_(r.arg<uint32>(0));
+}
+
+static void replay19(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_CreateSteamPipe_((intptr_t)self));
+}
+
+static void replay20(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_BReleaseSteamPipe_((intptr_t)self, r.arg<HSteamPipe>(1)));
+}
+
+static void replay21(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_ConnectToGlobalUser_((intptr_t)self, r.arg<HSteamPipe>(1)));
+}
+
+static void replay22(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_CreateLocalUser_((intptr_t)self, r.arg<HSteamPipe *>(1), r.arg<EAccountType>(2)));
+}
+
+static void replay23(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    SteamAPI_ISteamClient_ReleaseUser_((intptr_t)self, r.arg<HSteamPipe>(1), r.arg<HSteamUser>(2));
+}
+
+static void replay24(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamUser_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay25(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamGameServer_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay26(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    SteamAPI_ISteamClient_SetLocalIPBinding_((intptr_t)self, r.arg<uint32>(1), r.arg<uint16>(2));
+}
+
+static void replay27(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamFriends_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay28(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamUtils_((intptr_t)self, r.arg<HSteamPipe>(1), r.arg<char *>(2)));
+}
+
+static void replay29(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamMatchmaking_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay30(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamMatchmakingServers_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay31(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamGenericInterface_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay32(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamUserStats_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay33(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamGameServerStats_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay34(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamApps_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay35(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamNetworking_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay36(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamRemoteStorage_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay37(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamScreenshots_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay38(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetIPCCallCount_((intptr_t)self));
+}
+
+static void replay39(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    SteamAPI_ISteamClient_SetWarningMessageHook_((intptr_t)self, r.arg<SteamAPIWarningMessageHook_t>(1));
+}
+
+static void replay40(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_BShutdownIfAllPipesClosed_((intptr_t)self));
+}
+
+static void replay41(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamHTTP_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay42(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamUnifiedMessages_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay43(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamController_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay44(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamUGC_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay45(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamAppList_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay46(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamMusic_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay47(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamMusicRemote_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay48(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamHTMLSurface_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay49(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamInventory_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay50(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamClient_GetISteamVideo_((intptr_t)self, r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay51(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetHSteamUser_((intptr_t)self));
+}
+
+static void replay52(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_BLoggedOn_((intptr_t)self));
+}
+
+static void replay53(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetSteamID_((intptr_t)self));
+}
+
+static void replay54(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_InitiateGameConnection_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<CSteamID>(3), r.arg<uint32>(4), r.arg<uint16>(5), r.arg<bool>(6)));
+}
+
+static void replay55(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    SteamAPI_ISteamUser_TerminateGameConnection_((intptr_t)self, r.arg<uint32>(1), r.arg<uint16>(2));
+}
+
+static void replay56(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    SteamAPI_ISteamUser_TrackAppUsageEvent_((intptr_t)self, r.arg<CGameID>(1), r.arg<int>(2), r.arg<char *>(3));
+}
+
+static void replay57(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetUserDataFolder_((intptr_t)self, r.arg<char *>(1), r.arg<int>(2)));
+}
+
+static void replay58(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    SteamAPI_ISteamUser_StartVoiceRecording_((intptr_t)self);
+}
+
+static void replay59(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    SteamAPI_ISteamUser_StopVoiceRecording_((intptr_t)self);
+}
+
+static void replay60(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetAvailableVoice_((intptr_t)self, r.arg<uint32 *>(1), r.arg<uint32 *>(2), r.arg<uint32>(3)));
+}
+
+static void replay61(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetVoice_((intptr_t)self, r.arg<bool>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4), r.arg<bool>(5), r.arg<void *>(6), r.arg<uint32>(7), r.arg<uint32 *>(8), r.arg<uint32>(9)));
+}
+
+static void replay62(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_DecompressVoice_((intptr_t)self, r.arg<void *>(1), r.arg<uint32>(2), r.arg<void *>(3), r.arg<uint32>(4), r.arg<uint32 *>(5), r.arg<uint32>(6)));
+}
+
+static void replay63(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetVoiceOptimalSampleRate_((intptr_t)self));
+}
+
+static void replay64(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetAuthSessionTicket_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay65(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_BeginAuthSession_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<CSteamID>(3)));
+}
+
+static void replay66(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    SteamAPI_ISteamUser_EndAuthSession_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay67(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    SteamAPI_ISteamUser_CancelAuthTicket_((intptr_t)self, r.arg<HAuthTicket>(1));
+}
+
+static void replay68(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_UserHasLicenseForApp_((intptr_t)self, r.arg<CSteamID>(1), r.arg<AppId_t>(2)));
+}
+
+static void replay69(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_BIsBehindNAT_((intptr_t)self));
+}
+
+static void replay70(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    SteamAPI_ISteamUser_AdvertiseGame_((intptr_t)self, r.arg<CSteamID>(1), r.arg<uint32>(2), r.arg<uint16>(3));
+}
+
+static void replay71(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_RequestEncryptedAppTicket_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2)));
+}
+
+static void replay72(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetEncryptedAppTicket_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay73(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetGameBadgeLevel_((intptr_t)self, r.arg<int>(1), r.arg<bool>(2)));
+}
+
+static void replay74(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_GetPlayerSteamLevel_((intptr_t)self));
+}
+
+static void replay75(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUser_RequestStoreAuthURL_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay76(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetPersonaName_((intptr_t)self));
+}
+
+static void replay77(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_SetPersonaName_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay78(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetPersonaState_((intptr_t)self));
+}
+
+static void replay79(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendCount_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay80(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendByIndex_((intptr_t)self, r.arg<int>(1), r.arg<int>(2)));
+}
+
+static void replay81(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendRelationship_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay82(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendPersonaState_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay83(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendPersonaName_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay84(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendGamePlayed_((intptr_t)self, r.arg<CSteamID>(1), r.arg<FriendGameInfo_t *>(2)));
+}
+
+static void replay85(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendPersonaNameHistory_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay86(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendSteamLevel_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay87(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetPlayerNickname_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay88(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendsGroupCount_((intptr_t)self));
+}
+
+static void replay89(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay90(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendsGroupName_((intptr_t)self, r.arg<FriendsGroupID_t>(1)));
+}
+
+static void replay91(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendsGroupMembersCount_((intptr_t)self, r.arg<FriendsGroupID_t>(1)));
+}
+
+static void replay92(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_GetFriendsGroupMembersList_((intptr_t)self, r.arg<FriendsGroupID_t>(1), r.arg<CSteamID *>(2), r.arg<int>(3));
+}
+
+static void replay93(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_HasFriend_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay94(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanCount_((intptr_t)self));
+}
+
+static void replay95(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanByIndex_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay96(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanName_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay97(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanTag_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay98(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanActivityCounts_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int *>(2), r.arg<int *>(3), r.arg<int *>(4)));
+}
+
+static void replay99(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_DownloadClanActivityCounts_((intptr_t)self, r.arg<CSteamID *>(1), r.arg<int>(2)));
+}
+
+static void replay100(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendCountFromSource_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay101(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendFromSourceByIndex_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay102(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_IsUserInSource_((intptr_t)self, r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay103(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_SetInGameVoiceSpeaking_((intptr_t)self, r.arg<CSteamID>(1), r.arg<bool>(2));
+}
+
+static void replay104(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_ActivateGameOverlay_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay105(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_ActivateGameOverlayToUser_((intptr_t)self, r.arg<char *>(1), r.arg<CSteamID>(2));
+}
+
+static void replay106(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay107(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_ActivateGameOverlayToStore_((intptr_t)self, r.arg<AppId_t>(1), r.arg<EOverlayToStoreFlag>(2));
+}
+
+static void replay108(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_SetPlayedWith_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay109(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay110(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetSmallFriendAvatar_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay111(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetMediumFriendAvatar_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay112(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetLargeFriendAvatar_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay113(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_RequestUserInformation_((intptr_t)self, r.arg<CSteamID>(1), r.arg<bool>(2)));
+}
+
+static void replay114(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_RequestClanOfficerList_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay115(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanOwner_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay116(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanOfficerCount_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay117(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanOfficerByIndex_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay118(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetUserRestrictions_((intptr_t)self));
+}
+
+static void replay119(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_SetRichPresence_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2)));
+}
+
+static void replay120(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_ClearRichPresence_((intptr_t)self);
+}
+
+static void replay121(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendRichPresence_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay122(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay123(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay124(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    SteamAPI_ISteamFriends_RequestFriendRichPresence_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay125(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_InviteUserToGame_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay126(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetCoplayFriendCount_((intptr_t)self));
+}
+
+static void replay127(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetCoplayFriend_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay128(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendCoplayTime_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay129(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendCoplayGame_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay130(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_JoinClanChatRoom_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay131(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_LeaveClanChatRoom_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay132(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanChatMemberCount_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay133(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetChatMemberByIndex_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay134(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_SendClanChatMessage_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay135(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetClanChatMessage_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2), r.arg<void *>(3), r.arg<int>(4), r.arg<EChatEntryType *>(5), r.arg<CSteamID *>(6)));
+}
+
+static void replay136(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_IsClanChatAdmin_((intptr_t)self, r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay137(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay138(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_OpenClanChatWindowInSteam_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay139(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_CloseClanChatWindowInSteam_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay140(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_SetListenForFriendsMessages_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay141(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_ReplyToFriendMessage_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay142(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFriendMessage_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2), r.arg<void *>(3), r.arg<int>(4), r.arg<EChatEntryType *>(5)));
+}
+
+static void replay143(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_GetFollowerCount_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay144(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_IsFollowing_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay145(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamFriends_EnumerateFollowingList_((intptr_t)self, r.arg<uint32>(1)));
+}
+
+static void replay146(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetSecondsSinceAppActive_((intptr_t)self));
+}
+
+static void replay147(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetSecondsSinceComputerActive_((intptr_t)self));
+}
+
+static void replay148(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetConnectedUniverse_((intptr_t)self));
+}
+
+static void replay149(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetServerRealTime_((intptr_t)self));
+}
+
+static void replay150(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetIPCountry_((intptr_t)self));
+}
+
+static void replay151(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetImageSize_((intptr_t)self, r.arg<int>(1), r.arg<uint32 *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay152(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetImageRGBA_((intptr_t)self, r.arg<int>(1), r.arg<uint8 *>(2), r.arg<int>(3)));
+}
+
+static void replay153(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetCSERIPPort_((intptr_t)self, r.arg<uint32 *>(1), r.arg<uint16 *>(2)));
+}
+
+static void replay154(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetCurrentBatteryPower_((intptr_t)self));
+}
+
+static void replay155(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetAppID_((intptr_t)self));
+}
+
+static void replay156(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    SteamAPI_ISteamUtils_SetOverlayNotificationPosition_((intptr_t)self, r.arg<ENotificationPosition>(1));
+}
+
+static void replay157(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_IsAPICallCompleted_((intptr_t)self, r.arg<SteamAPICall_t>(1), r.arg<bool *>(2)));
+}
+
+static void replay158(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetAPICallFailureReason_((intptr_t)self, r.arg<SteamAPICall_t>(1)));
+}
+
+static void replay159(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetAPICallResult_((intptr_t)self, r.arg<SteamAPICall_t>(1), r.arg<void *>(2), r.arg<int>(3), r.arg<int>(4), r.arg<bool *>(5)));
+}
+
+static void replay160(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetIPCCallCount_((intptr_t)self));
+}
+
+static void replay161(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    SteamAPI_ISteamUtils_SetWarningMessageHook_((intptr_t)self, r.arg<SteamAPIWarningMessageHook_t>(1));
+}
+
+static void replay162(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_IsOverlayEnabled_((intptr_t)self));
+}
+
+static void replay163(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_BOverlayNeedsPresent_((intptr_t)self));
+}
+
+static void replay164(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_CheckFileSignature_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay165(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_ShowGamepadTextInput_((intptr_t)self, r.arg<EGamepadTextInputMode>(1), r.arg<EGamepadTextInputLineMode>(2), r.arg<char *>(3), r.arg<uint32>(4), r.arg<char *>(5)));
+}
+
+static void replay166(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetEnteredGamepadTextLength_((intptr_t)self));
+}
+
+static void replay167(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetEnteredGamepadTextInput_((intptr_t)self, r.arg<char *>(1), r.arg<uint32>(2)));
+}
+
+static void replay168(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_GetSteamUILanguage_((intptr_t)self));
+}
+
+static void replay169(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUtils_IsSteamRunningInVR_((intptr_t)self));
+}
+
+static void replay170(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetFavoriteGameCount_((intptr_t)self));
+}
+
+static void replay171(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetFavoriteGame_((intptr_t)self, r.arg<int>(1), r.arg<AppId_t *>(2), r.arg<uint32 *>(3), r.arg<uint16 *>(4), r.arg<uint16 *>(5), r.arg<uint32 *>(6), r.arg<uint32 *>(7)));
+}
+
+static void replay172(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_AddFavoriteGame_((intptr_t)self, r.arg<AppId_t>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<uint16>(4), r.arg<uint32>(5), r.arg<uint32>(6)));
+}
+
+static void replay173(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_RemoveFavoriteGame_((intptr_t)self, r.arg<AppId_t>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<uint16>(4), r.arg<uint32>(5)));
+}
+
+static void replay174(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_RequestLobbyList_((intptr_t)self));
+}
+
+static void replay175(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2), r.arg<ELobbyComparison>(3));
+}
+
+static void replay176(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter_((intptr_t)self, r.arg<char *>(1), r.arg<int>(2), r.arg<ELobbyComparison>(3));
+}
+
+static void replay177(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter_((intptr_t)self, r.arg<char *>(1), r.arg<int>(2));
+}
+
+static void replay178(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable_((intptr_t)self, r.arg<int>(1));
+}
+
+static void replay179(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter_((intptr_t)self, r.arg<ELobbyDistanceFilter>(1));
+}
+
+static void replay180(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter_((intptr_t)self, r.arg<int>(1));
+}
+
+static void replay181(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay182(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyByIndex_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay183(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_CreateLobby_((intptr_t)self, r.arg<ELobbyType>(1), r.arg<int>(2)));
+}
+
+static void replay184(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_JoinLobby_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay185(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_LeaveLobby_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay186(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_InviteUserToLobby_((intptr_t)self, r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay187(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetNumLobbyMembers_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay188(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay189(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyData_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay190(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_SetLobbyData_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay191(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyDataCount_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay192(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2), r.arg<char *>(3), r.arg<int>(4), r.arg<char *>(5), r.arg<int>(6)));
+}
+
+static void replay193(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_DeleteLobbyData_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay194(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyMemberData_((intptr_t)self, r.arg<CSteamID>(1), r.arg<CSteamID>(2), r.arg<char *>(3)));
+}
+
+static void replay195(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_SetLobbyMemberData_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<char *>(3));
+}
+
+static void replay196(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_SendLobbyChatMsg_((intptr_t)self, r.arg<CSteamID>(1), r.arg<void *>(2), r.arg<int>(3)));
+}
+
+static void replay197(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyChatEntry_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2), r.arg<CSteamID *>(3), r.arg<void *>(4), r.arg<int>(5), r.arg<EChatEntryType *>(6)));
+}
+
+static void replay198(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_RequestLobbyData_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay199(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmaking_SetLobbyGameServer_((intptr_t)self, r.arg<CSteamID>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<CSteamID>(4));
+}
+
+static void replay200(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyGameServer_((intptr_t)self, r.arg<CSteamID>(1), r.arg<uint32 *>(2), r.arg<uint16 *>(3), r.arg<CSteamID *>(4)));
+}
+
+static void replay201(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay202(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay203(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_SetLobbyType_((intptr_t)self, r.arg<CSteamID>(1), r.arg<ELobbyType>(2)));
+}
+
+static void replay204(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_SetLobbyJoinable_((intptr_t)self, r.arg<CSteamID>(1), r.arg<bool>(2)));
+}
+
+static void replay205(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_GetLobbyOwner_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay206(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_SetLobbyOwner_((intptr_t)self, r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay207(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmaking_SetLinkedLobby_((intptr_t)self, r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay208(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded_((intptr_t)self, r.arg<HServerListRequest>(1), r.arg<int>(2));
+}
+
+static void replay209(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond_((intptr_t)self, r.arg<HServerListRequest>(1), r.arg<int>(2));
+}
+
+static void replay210(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete_((intptr_t)self, r.arg<HServerListRequest>(1), r.arg<EMatchMakingServerResponse>(2));
+}
+
+static void replay211(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingPingResponse_ServerResponded_((intptr_t)self, r.arg<gameserveritem_t &>(1));
+}
+
+static void replay212(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond_((intptr_t)self);
+}
+
+static void replay213(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList_((intptr_t)self, r.arg<char *>(1), r.arg<int>(2), r.arg<float>(3));
+}
+
+static void replay214(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond_((intptr_t)self);
+}
+
+static void replay215(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete_((intptr_t)self);
+}
+
+static void replay216(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2));
+}
+
+static void replay217(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond_((intptr_t)self);
+}
+
+static void replay218(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete_((intptr_t)self);
+}
+
+static void replay219(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_RequestInternetServerList_((intptr_t)self, r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay220(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_RequestLANServerList_((intptr_t)self, r.arg<AppId_t>(1), r.arg<ISteamMatchmakingServerListResponse *>(2)));
+}
+
+static void replay221(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList_((intptr_t)self, r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay222(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList_((intptr_t)self, r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay223(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList_((intptr_t)self, r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay224(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList_((intptr_t)self, r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay225(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServers_ReleaseRequest_((intptr_t)self, r.arg<HServerListRequest>(1));
+}
+
+static void replay226(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_GetServerDetails_((intptr_t)self, r.arg<HServerListRequest>(1), r.arg<int>(2)));
+}
+
+static void replay227(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServers_CancelQuery_((intptr_t)self, r.arg<HServerListRequest>(1));
+}
+
+static void replay228(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServers_RefreshQuery_((intptr_t)self, r.arg<HServerListRequest>(1));
+}
+
+static void replay229(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_IsRefreshing_((intptr_t)self, r.arg<HServerListRequest>(1)));
+}
+
+static void replay230(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_GetServerCount_((intptr_t)self, r.arg<HServerListRequest>(1)));
+}
+
+static void replay231(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServers_RefreshServer_((intptr_t)self, r.arg<HServerListRequest>(1), r.arg<int>(2));
+}
+
+static void replay232(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_PingServer_((intptr_t)self, r.arg<uint32>(1), r.arg<uint16>(2), r.arg<ISteamMatchmakingPingResponse *>(3)));
+}
+
+static void replay233(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_PlayerDetails_((intptr_t)self, r.arg<uint32>(1), r.arg<uint16>(2), r.arg<ISteamMatchmakingPlayersResponse *>(3)));
+}
+
+static void replay234(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMatchmakingServers_ServerRules_((intptr_t)self, r.arg<uint32>(1), r.arg<uint16>(2), r.arg<ISteamMatchmakingRulesResponse *>(3)));
+}
+
+static void replay235(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    SteamAPI_ISteamMatchmakingServers_CancelServerQuery_((intptr_t)self, r.arg<HServerQuery>(1));
+}
+
+static void replay236(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileWrite_((intptr_t)self, r.arg<char *>(1), r.arg<void *>(2), r.arg<int32>(3)));
+}
+
+static void replay237(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileRead_((intptr_t)self, r.arg<char *>(1), r.arg<void *>(2), r.arg<int32>(3)));
+}
+
+static void replay238(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileForget_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay239(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileDelete_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay240(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileShare_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay241(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_SetSyncPlatforms_((intptr_t)self, r.arg<char *>(1), r.arg<ERemoteStoragePlatform>(2)));
+}
+
+static void replay242(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay243(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk_((intptr_t)self, r.arg<UGCFileWriteStreamHandle_t>(1), r.arg<void *>(2), r.arg<int32>(3)));
+}
+
+static void replay244(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileWriteStreamClose_((intptr_t)self, r.arg<UGCFileWriteStreamHandle_t>(1)));
+}
+
+static void replay245(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel_((intptr_t)self, r.arg<UGCFileWriteStreamHandle_t>(1)));
+}
+
+static void replay246(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FileExists_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay247(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_FilePersisted_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay248(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetFileSize_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay249(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetFileTimestamp_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay250(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetSyncPlatforms_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay251(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetFileCount_((intptr_t)self));
+}
+
+static void replay252(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetFileNameAndSize_((intptr_t)self, r.arg<int>(1), r.arg<int32 *>(2)));
+}
+
+static void replay253(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetQuota_((intptr_t)self, r.arg<uint64 *>(1), r.arg<uint64 *>(2)));
+}
+
+static void replay254(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount_((intptr_t)self));
+}
+
+static void replay255(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp_((intptr_t)self));
+}
+
+static void replay256(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp_((intptr_t)self, r.arg<bool>(1));
+}
+
+static void replay257(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UGCDownload_((intptr_t)self, r.arg<UGCHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay258(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress_((intptr_t)self, r.arg<UGCHandle_t>(1), r.arg<int32 *>(2), r.arg<int32 *>(3)));
+}
+
+static void replay259(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetUGCDetails_((intptr_t)self, r.arg<UGCHandle_t>(1), r.arg<AppId_t *>(2), r.arg<char **>(3), r.arg<int32 *>(4), r.arg<CSteamID *>(5)));
+}
+
+static void replay260(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UGCRead_((intptr_t)self, r.arg<UGCHandle_t>(1), r.arg<void *>(2), r.arg<int32>(3), r.arg<uint32>(4), r.arg<EUGCReadAction>(5)));
+}
+
+static void replay261(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetCachedUGCCount_((intptr_t)self));
+}
+
+static void replay262(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle_((intptr_t)self, r.arg<int32>(1)));
+}
+
+static void replay263(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_PublishWorkshopFile_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2), r.arg<AppId_t>(3), r.arg<char *>(4), r.arg<char *>(5), r.arg<ERemoteStoragePublishedFileVisibility>(6), r.arg<SteamParamStringArray_t *>(7), r.arg<EWorkshopFileType>(8)));
+}
+
+static void replay264(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay265(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay266(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay267(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay268(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay269(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1), r.arg<ERemoteStoragePublishedFileVisibility>(2)));
+}
+
+static void replay270(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1), r.arg<SteamParamStringArray_t *>(2)));
+}
+
+static void replay271(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1)));
+}
+
+static void replay272(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails_((intptr_t)self, r.arg<PublishedFileId_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay273(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_DeletePublishedFile_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay274(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles_((intptr_t)self, r.arg<uint32>(1)));
+}
+
+static void replay275(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_SubscribePublishedFile_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay276(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles_((intptr_t)self, r.arg<uint32>(1)));
+}
+
+static void replay277(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay278(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription_((intptr_t)self, r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay279(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay280(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote_((intptr_t)self, r.arg<PublishedFileId_t>(1), r.arg<bool>(2)));
+}
+
+static void replay281(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay282(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles_((intptr_t)self, r.arg<CSteamID>(1), r.arg<uint32>(2), r.arg<SteamParamStringArray_t *>(3), r.arg<SteamParamStringArray_t *>(4)));
+}
+
+static void replay283(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_PublishVideo_((intptr_t)self, r.arg<EWorkshopVideoProvider>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<char *>(4), r.arg<AppId_t>(5), r.arg<char *>(6), r.arg<char *>(7), r.arg<ERemoteStoragePublishedFileVisibility>(8), r.arg<SteamParamStringArray_t *>(9)));
+}
+
+static void replay284(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction_((intptr_t)self, r.arg<PublishedFileId_t>(1), r.arg<EWorkshopFileAction>(2)));
+}
+
+static void replay285(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction_((intptr_t)self, r.arg<EWorkshopFileAction>(1), r.arg<uint32>(2)));
+}
+
+static void replay286(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles_((intptr_t)self, r.arg<EWorkshopEnumerationType>(1), r.arg<uint32>(2), r.arg<uint32>(3), r.arg<uint32>(4), r.arg<SteamParamStringArray_t *>(5), r.arg<SteamParamStringArray_t *>(6)));
+}
+
+static void replay287(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation_((intptr_t)self, r.arg<UGCHandle_t>(1), r.arg<char *>(2), r.arg<uint32>(3)));
+}
+
+static void replay288(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_RequestCurrentStats_((intptr_t)self));
+}
+
+static void replay289(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetStat_((intptr_t)self, r.arg<char *>(1), r.arg<int32 *>(2)));
+}
+
+static void replay290(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetStat0_((intptr_t)self, r.arg<char *>(1), r.arg<float *>(2)));
+}
+
+static void replay291(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_SetStat_((intptr_t)self, r.arg<char *>(1), r.arg<int32>(2)));
+}
+
+static void replay292(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_SetStat0_((intptr_t)self, r.arg<char *>(1), r.arg<float>(2)));
+}
+
+static void replay293(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_UpdateAvgRateStat_((intptr_t)self, r.arg<char *>(1), r.arg<float>(2), r.arg<double>(3)));
+}
+
+static void replay294(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetAchievement_((intptr_t)self, r.arg<char *>(1), r.arg<bool *>(2)));
+}
+
+static void replay295(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_SetAchievement_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay296(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_ClearAchievement_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay297(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime_((intptr_t)self, r.arg<char *>(1), r.arg<bool *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay298(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_StoreStats_((intptr_t)self));
+}
+
+static void replay299(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetAchievementIcon_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay300(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2)));
+}
+
+static void replay301(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_IndicateAchievementProgress_((intptr_t)self, r.arg<char *>(1), r.arg<uint32>(2), r.arg<uint32>(3)));
+}
+
+static void replay302(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetNumAchievements_((intptr_t)self));
+}
+
+static void replay303(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetAchievementName_((intptr_t)self, r.arg<uint32>(1)));
+}
+
+static void replay304(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_RequestUserStats_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay305(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetUserStat_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<int32 *>(3)));
+}
+
+static void replay306(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetUserStat0_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float *>(3)));
+}
+
+static void replay307(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetUserAchievement_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<bool *>(3)));
+}
+
+static void replay308(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<bool *>(3), r.arg<uint32 *>(4)));
+}
+
+static void replay309(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_ResetAllStats_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay310(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_FindOrCreateLeaderboard_((intptr_t)self, r.arg<char *>(1), r.arg<ELeaderboardSortMethod>(2), r.arg<ELeaderboardDisplayType>(3)));
+}
+
+static void replay311(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_FindLeaderboard_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay312(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetLeaderboardName_((intptr_t)self, r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay313(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetLeaderboardEntryCount_((intptr_t)self, r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay314(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetLeaderboardSortMethod_((intptr_t)self, r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay315(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetLeaderboardDisplayType_((intptr_t)self, r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay316(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_DownloadLeaderboardEntries_((intptr_t)self, r.arg<SteamLeaderboard_t>(1), r.arg<ELeaderboardDataRequest>(2), r.arg<int>(3), r.arg<int>(4)));
+}
+
+static void replay317(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers_((intptr_t)self, r.arg<SteamLeaderboard_t>(1), r.arg<CSteamID *>(2), r.arg<int>(3)));
+}
+
+static void replay318(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry_((intptr_t)self, r.arg<SteamLeaderboardEntries_t>(1), r.arg<int>(2), r.arg<LeaderboardEntry_t *>(3), r.arg<int32 *>(4), r.arg<int>(5)));
+}
+
+static void replay319(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_UploadLeaderboardScore_((intptr_t)self, r.arg<SteamLeaderboard_t>(1), r.arg<ELeaderboardUploadScoreMethod>(2), r.arg<int32>(3), r.arg<int32 *>(4), r.arg<int>(5)));
+}
+
+static void replay320(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_AttachLeaderboardUGC_((intptr_t)self, r.arg<SteamLeaderboard_t>(1), r.arg<UGCHandle_t>(2)));
+}
+
+static void replay321(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers_((intptr_t)self));
+}
+
+static void replay322(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages_((intptr_t)self));
+}
+
+static void replay323(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo_((intptr_t)self, r.arg<char *>(1), r.arg<uint32>(2), r.arg<float *>(3), r.arg<bool *>(4)));
+}
+
+static void replay324(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo_((intptr_t)self, r.arg<int>(1), r.arg<char *>(2), r.arg<uint32>(3), r.arg<float *>(4), r.arg<bool *>(5)));
+}
+
+static void replay325(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetAchievementAchievedPercent_((intptr_t)self, r.arg<char *>(1), r.arg<float *>(2)));
+}
+
+static void replay326(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_RequestGlobalStats_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay327(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetGlobalStat_((intptr_t)self, r.arg<char *>(1), r.arg<int64 *>(2)));
+}
+
+static void replay328(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetGlobalStat0_((intptr_t)self, r.arg<char *>(1), r.arg<double *>(2)));
+}
+
+static void replay329(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetGlobalStatHistory_((intptr_t)self, r.arg<char *>(1), r.arg<int64 *>(2), r.arg<uint32>(3)));
+}
+
+static void replay330(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUserStats_GetGlobalStatHistory0_((intptr_t)self, r.arg<char *>(1), r.arg<double *>(2), r.arg<uint32>(3)));
+}
+
+static void replay331(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsSubscribed_((intptr_t)self));
+}
+
+static void replay332(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsLowViolence_((intptr_t)self));
+}
+
+static void replay333(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsCybercafe_((intptr_t)self));
+}
+
+static void replay334(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsVACBanned_((intptr_t)self));
+}
+
+static void replay335(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetCurrentGameLanguage_((intptr_t)self));
+}
+
+static void replay336(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetAvailableGameLanguages_((intptr_t)self));
+}
+
+static void replay337(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsSubscribedApp_((intptr_t)self, r.arg<AppId_t>(1)));
+}
+
+static void replay338(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsDlcInstalled_((intptr_t)self, r.arg<AppId_t>(1)));
+}
+
+static void replay339(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime_((intptr_t)self, r.arg<AppId_t>(1)));
+}
+
+static void replay340(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend_((intptr_t)self));
+}
+
+static void replay341(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetDLCCount_((intptr_t)self));
+}
+
+static void replay342(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BGetDLCDataByIndex_((intptr_t)self, r.arg<int>(1), r.arg<AppId_t *>(2), r.arg<bool *>(3), r.arg<char *>(4), r.arg<int>(5)));
+}
+
+static void replay343(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    SteamAPI_ISteamApps_InstallDLC_((intptr_t)self, r.arg<AppId_t>(1));
+}
+
+static void replay344(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    SteamAPI_ISteamApps_UninstallDLC_((intptr_t)self, r.arg<AppId_t>(1));
+}
+
+static void replay345(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey_((intptr_t)self, r.arg<AppId_t>(1));
+}
+
+static void replay346(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetCurrentBetaName_((intptr_t)self, r.arg<char *>(1), r.arg<int>(2)));
+}
+
+static void replay347(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_MarkContentCorrupt_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay348(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetInstalledDepots_((intptr_t)self, r.arg<AppId_t>(1), r.arg<DepotId_t *>(2), r.arg<uint32>(3)));
+}
+
+static void replay349(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetAppInstallDir_((intptr_t)self, r.arg<AppId_t>(1), r.arg<char *>(2), r.arg<uint32>(3)));
+}
+
+static void replay350(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_BIsAppInstalled_((intptr_t)self, r.arg<AppId_t>(1)));
+}
+
+static void replay351(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetAppOwner_((intptr_t)self));
+}
+
+static void replay352(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetLaunchQueryParam_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay353(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetDlcDownloadProgress_((intptr_t)self, r.arg<AppId_t>(1), r.arg<uint64 *>(2), r.arg<uint64 *>(3)));
+}
+
+static void replay354(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamApps_GetAppBuildId_((intptr_t)self));
+}
+
+static void replay355(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_SendP2PPacket_((intptr_t)self, r.arg<CSteamID>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<EP2PSend>(4), r.arg<int>(5)));
+}
+
+static void replay356(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_IsP2PPacketAvailable_((intptr_t)self, r.arg<uint32 *>(1), r.arg<int>(2)));
+}
+
+static void replay357(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_ReadP2PPacket_((intptr_t)self, r.arg<void *>(1), r.arg<uint32>(2), r.arg<uint32 *>(3), r.arg<CSteamID *>(4), r.arg<int>(5)));
+}
+
+static void replay358(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay359(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_CloseP2PSessionWithUser_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay360(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_CloseP2PChannelWithUser_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay361(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_GetP2PSessionState_((intptr_t)self, r.arg<CSteamID>(1), r.arg<P2PSessionState_t *>(2)));
+}
+
+static void replay362(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_AllowP2PPacketRelay_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay363(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_CreateListenSocket_((intptr_t)self, r.arg<int>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<bool>(4)));
+}
+
+static void replay364(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_CreateP2PConnectionSocket_((intptr_t)self, r.arg<CSteamID>(1), r.arg<int>(2), r.arg<int>(3), r.arg<bool>(4)));
+}
+
+static void replay365(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_CreateConnectionSocket_((intptr_t)self, r.arg<uint32>(1), r.arg<uint16>(2), r.arg<int>(3)));
+}
+
+static void replay366(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_DestroySocket_((intptr_t)self, r.arg<SNetSocket_t>(1), r.arg<bool>(2)));
+}
+
+static void replay367(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_DestroyListenSocket_((intptr_t)self, r.arg<SNetListenSocket_t>(1), r.arg<bool>(2)));
+}
+
+static void replay368(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_SendDataOnSocket_((intptr_t)self, r.arg<SNetSocket_t>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<bool>(4)));
+}
+
+static void replay369(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_IsDataAvailableOnSocket_((intptr_t)self, r.arg<SNetSocket_t>(1), r.arg<uint32 *>(2)));
+}
+
+static void replay370(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_RetrieveDataFromSocket_((intptr_t)self, r.arg<SNetSocket_t>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4)));
+}
+
+static void replay371(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_IsDataAvailable_((intptr_t)self, r.arg<SNetListenSocket_t>(1), r.arg<uint32 *>(2), r.arg<SNetSocket_t *>(3)));
+}
+
+static void replay372(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_RetrieveData_((intptr_t)self, r.arg<SNetListenSocket_t>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4), r.arg<SNetSocket_t *>(5)));
+}
+
+static void replay373(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_GetSocketInfo_((intptr_t)self, r.arg<SNetSocket_t>(1), r.arg<CSteamID *>(2), r.arg<int *>(3), r.arg<uint32 *>(4), r.arg<uint16 *>(5)));
+}
+
+static void replay374(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_GetListenSocketInfo_((intptr_t)self, r.arg<SNetListenSocket_t>(1), r.arg<uint32 *>(2), r.arg<uint16 *>(3)));
+}
+
+static void replay375(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_GetSocketConnectionType_((intptr_t)self, r.arg<SNetSocket_t>(1)));
+}
+
+static void replay376(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamNetworking_GetMaxPacketSize_((intptr_t)self, r.arg<SNetSocket_t>(1)));
+}
+
+static void replay377(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamScreenshots_WriteScreenshot_((intptr_t)self, r.arg<void *>(1), r.arg<uint32>(2), r.arg<int>(3), r.arg<int>(4)));
+}
+
+static void replay378(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamScreenshots_AddScreenshotToLibrary_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2), r.arg<int>(3), r.arg<int>(4)));
+}
+
+static void replay379(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    SteamAPI_ISteamScreenshots_TriggerScreenshot_((intptr_t)self);
+}
+
+static void replay380(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    SteamAPI_ISteamScreenshots_HookScreenshots_((intptr_t)self, r.arg<bool>(1));
+}
+
+static void replay381(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamScreenshots_SetLocation_((intptr_t)self, r.arg<ScreenshotHandle>(1), r.arg<char *>(2)));
+}
+
+static void replay382(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamScreenshots_TagUser_((intptr_t)self, r.arg<ScreenshotHandle>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay383(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamScreenshots_TagPublishedFile_((intptr_t)self, r.arg<ScreenshotHandle>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay384(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusic_BIsEnabled_((intptr_t)self));
+}
+
+static void replay385(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusic_BIsPlaying_((intptr_t)self));
+}
+
+static void replay386(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusic_GetPlaybackStatus_((intptr_t)self));
+}
+
+static void replay387(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    SteamAPI_ISteamMusic_Play_((intptr_t)self);
+}
+
+static void replay388(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    SteamAPI_ISteamMusic_Pause_((intptr_t)self);
+}
+
+static void replay389(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    SteamAPI_ISteamMusic_PlayPrevious_((intptr_t)self);
+}
+
+static void replay390(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    SteamAPI_ISteamMusic_PlayNext_((intptr_t)self);
+}
+
+static void replay391(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    SteamAPI_ISteamMusic_SetVolume_((intptr_t)self, r.arg<float>(1));
+}
+
+static void replay392(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusic_GetVolume_((intptr_t)self));
+}
+
+static void replay393(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay394(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote_((intptr_t)self));
+}
+
+static void replay395(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote_((intptr_t)self));
+}
+
+static void replay396(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_BActivationSuccess_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay397(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_SetDisplayName_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay398(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64_((intptr_t)self, r.arg<void *>(1), r.arg<uint32>(2)));
+}
+
+static void replay399(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_EnablePlayPrevious_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay400(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_EnablePlayNext_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay401(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_EnableShuffled_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay402(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_EnableLooped_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay403(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_EnableQueue_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay404(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_EnablePlaylists_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay405(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus_((intptr_t)self, r.arg<AudioPlayback_Status>(1)));
+}
+
+static void replay406(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_UpdateShuffled_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay407(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_UpdateLooped_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay408(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_UpdateVolume_((intptr_t)self, r.arg<float>(1)));
+}
+
+static void replay409(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_CurrentEntryWillChange_((intptr_t)self));
+}
+
+static void replay410(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay411(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText_((intptr_t)self, r.arg<char *>(1)));
+}
+
+static void replay412(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay413(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt_((intptr_t)self, r.arg<void *>(1), r.arg<uint32>(2)));
+}
+
+static void replay414(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_CurrentEntryDidChange_((intptr_t)self));
+}
+
+static void replay415(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_QueueWillChange_((intptr_t)self));
+}
+
+static void replay416(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_ResetQueueEntries_((intptr_t)self));
+}
+
+static void replay417(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_SetQueueEntry_((intptr_t)self, r.arg<int>(1), r.arg<int>(2), r.arg<char *>(3)));
+}
+
+static void replay418(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay419(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_QueueDidChange_((intptr_t)self));
+}
+
+static void replay420(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_PlaylistWillChange_((intptr_t)self));
+}
+
+static void replay421(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_ResetPlaylistEntries_((intptr_t)self));
+}
+
+static void replay422(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_SetPlaylistEntry_((intptr_t)self, r.arg<int>(1), r.arg<int>(2), r.arg<char *>(3)));
+}
+
+static void replay423(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry_((intptr_t)self, r.arg<int>(1)));
+}
+
+static void replay424(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamMusicRemote_PlaylistDidChange_((intptr_t)self));
+}
+
+static void replay425(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_CreateHTTPRequest_((intptr_t)self, r.arg<EHTTPMethod>(1), r.arg<char *>(2)));
+}
+
+static void replay426(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestContextValue_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<uint64>(2)));
+}
+
+static void replay427(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<uint32>(2)));
+}
+
+static void replay428(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay429(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay430(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SendHTTPRequest_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<SteamAPICall_t *>(2)));
+}
+
+static void replay431(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<SteamAPICall_t *>(2)));
+}
+
+static void replay432(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_DeferHTTPRequest_((intptr_t)self, r.arg<HTTPRequestHandle>(1)));
+}
+
+static void replay433(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_PrioritizeHTTPRequest_((intptr_t)self, r.arg<HTTPRequestHandle>(1)));
+}
+
+static void replay434(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay435(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<uint8 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay436(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_GetHTTPResponseBodySize_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<uint32 *>(2)));
+}
+
+static void replay437(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_GetHTTPResponseBodyData_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<uint8 *>(2), r.arg<uint32>(3)));
+}
+
+static void replay438(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<uint32>(2), r.arg<uint8 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay439(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_ReleaseHTTPRequest_((intptr_t)self, r.arg<HTTPRequestHandle>(1)));
+}
+
+static void replay440(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<float *>(2)));
+}
+
+static void replay441(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<uint8 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay442(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_CreateCookieContainer_((intptr_t)self, r.arg<bool>(1)));
+}
+
+static void replay443(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_ReleaseCookieContainer_((intptr_t)self, r.arg<HTTPCookieContainerHandle>(1)));
+}
+
+static void replay444(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetCookie_((intptr_t)self, r.arg<HTTPCookieContainerHandle>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<char *>(4)));
+}
+
+static void replay445(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<HTTPCookieContainerHandle>(2)));
+}
+
+static void replay446(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<char *>(2)));
+}
+
+static void replay447(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<bool>(2)));
+}
+
+static void replay448(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<uint32>(2)));
+}
+
+static void replay449(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut_((intptr_t)self, r.arg<HTTPRequestHandle>(1), r.arg<bool *>(2)));
+}
+
+static void replay450(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUnifiedMessages_SendMethod_((intptr_t)self, r.arg<char *>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint64>(4)));
+}
+
+static void replay451(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo_((intptr_t)self, r.arg<ClientUnifiedMessageHandle>(1), r.arg<uint32 *>(2), r.arg<EResult *>(3)));
+}
+
+static void replay452(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUnifiedMessages_GetMethodResponseData_((intptr_t)self, r.arg<ClientUnifiedMessageHandle>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<bool>(4)));
+}
+
+static void replay453(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUnifiedMessages_ReleaseMethod_((intptr_t)self, r.arg<ClientUnifiedMessageHandle>(1)));
+}
+
+static void replay454(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUnifiedMessages_SendNotification_((intptr_t)self, r.arg<char *>(1), r.arg<void *>(2), r.arg<uint32>(3)));
+}
+
+static void replay455(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamController_Init_((intptr_t)self));
+}
+
+static void replay456(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamController_Shutdown_((intptr_t)self));
+}
+
+static void replay457(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    SteamAPI_ISteamController_RunFrame_((intptr_t)self);
+}
+
+static void replay458(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    SteamAPI_ISteamController_TriggerHapticPulse_((intptr_t)self, r.arg<ControllerHandle_t>(1), r.arg<ESteamControllerPad>(2), r.arg<unsigned short>(3));
+}
+
+static void replay459(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_CreateQueryUserUGCRequest_((intptr_t)self, r.arg<AccountID_t>(1), r.arg<EUserUGCList>(2), r.arg<EUGCMatchingUGCType>(3), r.arg<EUserUGCListSortOrder>(4), r.arg<AppId_t>(5), r.arg<AppId_t>(6), r.arg<uint32>(7)));
+}
+
+static void replay460(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_CreateQueryAllUGCRequest_((intptr_t)self, r.arg<EUGCQuery>(1), r.arg<EUGCMatchingUGCType>(2), r.arg<AppId_t>(3), r.arg<AppId_t>(4), r.arg<uint32>(5)));
+}
+
+static void replay461(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest_((intptr_t)self, r.arg<PublishedFileId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay462(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SendQueryUGCRequest_((intptr_t)self, r.arg<UGCQueryHandle_t>(1)));
+}
+
+static void replay463(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetQueryUGCResult_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<SteamUGCDetails_t *>(3)));
+}
+
+static void replay464(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetQueryUGCPreviewURL_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<char *>(3), r.arg<uint32>(4)));
+}
+
+static void replay465(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetQueryUGCMetadata_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<char *>(3), r.arg<uint32>(4)));
+}
+
+static void replay466(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetQueryUGCChildren_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<PublishedFileId_t *>(3), r.arg<uint32>(4)));
+}
+
+static void replay467(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetQueryUGCStatistic_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<EItemStatistic>(3), r.arg<uint64 *>(4)));
+}
+
+static void replay468(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay469(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<uint32>(3), r.arg<char *>(4), r.arg<uint32>(5), r.arg<char *>(6), r.arg<uint32>(7), r.arg<EItemPreviewType *>(8)));
+}
+
+static void replay470(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_ReleaseQueryUGCRequest_((intptr_t)self, r.arg<UGCQueryHandle_t>(1)));
+}
+
+static void replay471(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_AddRequiredTag_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay472(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_AddExcludedTag_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay473(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetReturnLongDescription_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay474(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetReturnMetadata_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay475(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetReturnChildren_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay476(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetReturnAdditionalPreviews_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay477(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetReturnTotalOnly_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay478(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetAllowCachedResponse_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay479(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetCloudFileNameFilter_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay480(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetMatchAnyTag_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay481(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetSearchText_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay482(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetRankedByTrendDays_((intptr_t)self, r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay483(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_RequestUGCDetails_((intptr_t)self, r.arg<PublishedFileId_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay484(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_CreateItem_((intptr_t)self, r.arg<AppId_t>(1), r.arg<EWorkshopFileType>(2)));
+}
+
+static void replay485(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_StartItemUpdate_((intptr_t)self, r.arg<AppId_t>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay486(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetItemTitle_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay487(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetItemDescription_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay488(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetItemMetadata_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay489(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetItemVisibility_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<ERemoteStoragePublishedFileVisibility>(2)));
+}
+
+static void replay490(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetItemTags_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<SteamParamStringArray_t *>(2)));
+}
+
+static void replay491(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetItemContent_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay492(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SetItemPreview_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay493(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SubmitItemUpdate_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay494(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetItemUpdateProgress_((intptr_t)self, r.arg<UGCUpdateHandle_t>(1), r.arg<uint64 *>(2), r.arg<uint64 *>(3)));
+}
+
+static void replay495(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_AddItemToFavorites_((intptr_t)self, r.arg<AppId_t>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay496(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_RemoveItemFromFavorites_((intptr_t)self, r.arg<AppId_t>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay497(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_SubscribeItem_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay498(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_UnsubscribeItem_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay499(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetNumSubscribedItems_((intptr_t)self));
+}
+
+static void replay500(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetSubscribedItems_((intptr_t)self, r.arg<PublishedFileId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay501(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetItemState_((intptr_t)self, r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay502(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetItemInstallInfo_((intptr_t)self, r.arg<PublishedFileId_t>(1), r.arg<uint64 *>(2), r.arg<char *>(3), r.arg<uint32>(4), r.arg<uint32 *>(5)));
+}
+
+static void replay503(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_GetItemDownloadInfo_((intptr_t)self, r.arg<PublishedFileId_t>(1), r.arg<uint64 *>(2), r.arg<uint64 *>(3)));
+}
+
+static void replay504(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamUGC_DownloadItem_((intptr_t)self, r.arg<PublishedFileId_t>(1), r.arg<bool>(2)));
+}
+
+static void replay505(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamAppList_GetNumInstalledApps_((intptr_t)self));
+}
+
+static void replay506(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamAppList_GetInstalledApps_((intptr_t)self, r.arg<AppId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay507(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamAppList_GetAppName_((intptr_t)self, r.arg<AppId_t>(1), r.arg<char *>(2), r.arg<int>(3)));
+}
+
+static void replay508(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamAppList_GetAppInstallDir_((intptr_t)self, r.arg<AppId_t>(1), r.arg<char *>(2), r.arg<int>(3)));
+}
+
+static void replay509(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamAppList_GetAppBuildId_((intptr_t)self, r.arg<AppId_t>(1)));
+}
+
+static void replay510(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface_((intptr_t)self);
+}
+
+static void replay511(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTMLSurface_Init_((intptr_t)self));
+}
+
+static void replay512(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTMLSurface_Shutdown_((intptr_t)self));
+}
+
+static void replay513(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamHTMLSurface_CreateBrowser_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2)));
+}
+
+static void replay514(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_RemoveBrowser_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay515(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_LoadURL_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<char *>(2), r.arg<char *>(3));
+}
+
+static void replay516(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_SetSize_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<uint32>(3));
+}
+
+static void replay517(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_StopLoad_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay518(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_Reload_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay519(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_GoBack_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay520(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_GoForward_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay521(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_AddHeader_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<char *>(2), r.arg<char *>(3));
+}
+
+static void replay522(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_ExecuteJavascript_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<char *>(2));
+}
+
+static void replay523(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_MouseUp_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<ISteamHTMLSurface::EHTMLMouseButton>(2));
+}
+
+static void replay524(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_MouseDown_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<ISteamHTMLSurface::EHTMLMouseButton>(2));
+}
+
+static void replay525(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_MouseDoubleClick_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<ISteamHTMLSurface::EHTMLMouseButton>(2));
+}
+
+static void replay526(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_MouseMove_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<int>(2), r.arg<int>(3));
+}
+
+static void replay527(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_MouseWheel_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<int32>(2));
+}
+
+static void replay528(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_KeyDown_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<ISteamHTMLSurface::EHTMLKeyModifiers>(3));
+}
+
+static void replay529(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_KeyUp_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<ISteamHTMLSurface::EHTMLKeyModifiers>(3));
+}
+
+static void replay530(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_KeyChar_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<ISteamHTMLSurface::EHTMLKeyModifiers>(3));
+}
+
+static void replay531(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_SetHorizontalScroll_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<uint32>(2));
+}
+
+static void replay532(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_SetVerticalScroll_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<uint32>(2));
+}
+
+static void replay533(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_SetKeyFocus_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay534(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_ViewSource_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay535(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_CopyToClipboard_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay536(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_PasteFromClipboard_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay537(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_Find_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<char *>(2), r.arg<bool>(3), r.arg<bool>(4));
+}
+
+static void replay538(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_StopFind_((intptr_t)self, r.arg<HHTMLBrowser>(1));
+}
+
+static void replay539(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_GetLinkAtPosition_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<int>(2), r.arg<int>(3));
+}
+
+static void replay540(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_SetCookie_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<char *>(4), r.arg<RTime32>(5), r.arg<bool>(6), r.arg<bool>(7));
+}
+
+static void replay541(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_SetPageScaleFactor_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<float>(2), r.arg<int>(3), r.arg<int>(4));
+}
+
+static void replay542(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_SetBackgroundMode_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay543(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_AllowStartRequest_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay544(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    SteamAPI_ISteamHTMLSurface_JSDialogResponse_((intptr_t)self, r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay545(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GetResultStatus_((intptr_t)self, r.arg<SteamInventoryResult_t>(1)));
+}
+
+static void replay546(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GetResultItems_((intptr_t)self, r.arg<SteamInventoryResult_t>(1), r.arg<SteamItemDetails_t *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay547(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GetResultTimestamp_((intptr_t)self, r.arg<SteamInventoryResult_t>(1)));
+}
+
+static void replay548(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_CheckResultSteamID_((intptr_t)self, r.arg<SteamInventoryResult_t>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay549(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    SteamAPI_ISteamInventory_DestroyResult_((intptr_t)self, r.arg<SteamInventoryResult_t>(1));
+}
+
+static void replay550(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GetAllItems_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1)));
+}
+
+static void replay551(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GetItemsByID_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemInstanceID_t *>(2), r.arg<uint32>(3)));
+}
+
+static void replay552(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_SerializeResult_((intptr_t)self, r.arg<SteamInventoryResult_t>(1), r.arg<void *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay553(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_DeserializeResult_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<bool>(4)));
+}
+
+static void replay554(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GenerateItems_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t *>(2), r.arg<uint32 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay555(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GrantPromoItems_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1)));
+}
+
+static void replay556(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_AddPromoItem_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t>(2)));
+}
+
+static void replay557(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_AddPromoItems_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t *>(2), r.arg<uint32>(3)));
+}
+
+static void replay558(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_ConsumeItem_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemInstanceID_t>(2), r.arg<uint32>(3)));
+}
+
+static void replay559(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_ExchangeItems_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t *>(2), r.arg<uint32 *>(3), r.arg<uint32>(4), r.arg<SteamItemInstanceID_t *>(5), r.arg<uint32 *>(6), r.arg<uint32>(7)));
+}
+
+static void replay560(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_TransferItemQuantity_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemInstanceID_t>(2), r.arg<uint32>(3), r.arg<SteamItemInstanceID_t>(4)));
+}
+
+static void replay561(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    SteamAPI_ISteamInventory_SendItemDropHeartbeat_((intptr_t)self);
+}
+
+static void replay562(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_TriggerItemDrop_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t>(2)));
+}
+
+static void replay563(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_TradeItems_((intptr_t)self, r.arg<SteamInventoryResult_t *>(1), r.arg<CSteamID>(2), r.arg<SteamItemInstanceID_t *>(3), r.arg<uint32 *>(4), r.arg<uint32>(5), r.arg<SteamItemInstanceID_t *>(6), r.arg<uint32 *>(7), r.arg<uint32>(8)));
+}
+
+static void replay564(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_LoadItemDefinitions_((intptr_t)self));
+}
+
+static void replay565(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GetItemDefinitionIDs_((intptr_t)self, r.arg<SteamItemDef_t *>(1), r.arg<uint32 *>(2)));
+}
+
+static void replay566(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamInventory_GetItemDefinitionProperty_((intptr_t)self, r.arg<SteamItemDef_t>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<uint32 *>(4)));
+}
+
+static void replay567(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamVideo_);
+  if (self != NULL)
+    SteamAPI_ISteamVideo_GetVideoURL_((intptr_t)self, r.arg<AppId_t>(1));
+}
+
+static void replay568(Replay &r)
+{
+  void *self = (void *)r.object(0, (ReplayAccessor)&SteamVideo_);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamVideo_IsBroadcasting_((intptr_t)self, r.arg<int *>(1)));
+}
+
+static void replay569(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_InitGameServer_((intptr_t)self, r.arg<uint32>(1), r.arg<uint16>(2), r.arg<uint16>(3), r.arg<uint32>(4), r.arg<AppId_t>(5), r.arg<char *>(6)));
+}
+
+static void replay570(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetProduct_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay571(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetGameDescription_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay572(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetModDir_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay573(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetDedicatedServer_((intptr_t)self, r.arg<bool>(1));
+}
+
+static void replay574(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_LogOn_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay575(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_LogOnAnonymous_((intptr_t)self);
+}
+
+static void replay576(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_LogOff_((intptr_t)self);
+}
+
+static void replay577(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_BLoggedOn_((intptr_t)self));
+}
+
+static void replay578(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_BSecure_((intptr_t)self));
+}
+
+static void replay579(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_GetSteamID_((intptr_t)self));
+}
+
+static void replay580(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_WasRestartRequested_((intptr_t)self));
+}
+
+static void replay581(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetMaxPlayerCount_((intptr_t)self, r.arg<int>(1));
+}
+
+static void replay582(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetBotPlayerCount_((intptr_t)self, r.arg<int>(1));
+}
+
+static void replay583(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetServerName_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay584(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetMapName_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay585(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetPasswordProtected_((intptr_t)self, r.arg<bool>(1));
+}
+
+static void replay586(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetSpectatorPort_((intptr_t)self, r.arg<uint16>(1));
+}
+
+static void replay587(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetSpectatorServerName_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay588(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_ClearAllKeyValues_((intptr_t)self);
+}
+
+static void replay589(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetKeyValue_((intptr_t)self, r.arg<char *>(1), r.arg<char *>(2));
+}
+
+static void replay590(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetGameTags_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay591(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetGameData_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay592(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetRegion_((intptr_t)self, r.arg<char *>(1));
+}
+
+static void replay593(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate_((intptr_t)self, r.arg<uint32>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<CSteamID *>(4)));
+}
+
+static void replay594(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection_((intptr_t)self));
+}
+
+static void replay595(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SendUserDisconnect_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay596(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_BUpdateUserData_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<uint32>(3)));
+}
+
+static void replay597(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_GetAuthSessionTicket_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay598(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_BeginAuthSession_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<CSteamID>(3)));
+}
+
+static void replay599(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_EndAuthSession_((intptr_t)self, r.arg<CSteamID>(1));
+}
+
+static void replay600(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_CancelAuthTicket_((intptr_t)self, r.arg<HAuthTicket>(1));
+}
+
+static void replay601(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_UserHasLicenseForApp_((intptr_t)self, r.arg<CSteamID>(1), r.arg<AppId_t>(2)));
+}
+
+static void replay602(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_RequestUserGroupStatus_((intptr_t)self, r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay603(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_GetGameplayStats_((intptr_t)self);
+}
+
+static void replay604(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_GetServerReputation_((intptr_t)self));
+}
+
+static void replay605(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_GetPublicIP_((intptr_t)self));
+}
+
+static void replay606(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_HandleIncomingPacket_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<uint32>(3), r.arg<uint16>(4)));
+}
+
+static void replay607(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_GetNextOutgoingPacket_((intptr_t)self, r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3), r.arg<uint16 *>(4)));
+}
+
+static void replay608(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_EnableHeartbeats_((intptr_t)self, r.arg<bool>(1));
+}
+
+static void replay609(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_SetHeartbeatInterval_((intptr_t)self, r.arg<int>(1));
+}
+
+static void replay610(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    SteamAPI_ISteamGameServer_ForceHeartbeat_((intptr_t)self);
+}
+
+static void replay611(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_AssociateWithClan_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay612(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay613(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_RequestUserStats_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay614(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_GetUserStat_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<int32 *>(3)));
+}
+
+static void replay615(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_GetUserStat0_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float *>(3)));
+}
+
+static void replay616(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_GetUserAchievement_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<bool *>(3)));
+}
+
+static void replay617(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_SetUserStat_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<int32>(3)));
+}
+
+static void replay618(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_SetUserStat0_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float>(3)));
+}
+
+static void replay619(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float>(3), r.arg<double>(4)));
+}
+
+static void replay620(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_SetUserAchievement_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay621(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_ClearUserAchievement_((intptr_t)self, r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay622(Replay &r)
+{
+  void *self = (void *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(SteamAPI_ISteamGameServerStats_StoreUserStats_((intptr_t)self, r.arg<CSteamID>(1)));
+}
+
+static void replay623(Replay &r)
+{
+  ISteamAppList_ *self = (ISteamAppList_ *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(self->GetNumInstalledApps());
+}
+
+static void replay624(Replay &r)
+{
+  ISteamAppList_ *self = (ISteamAppList_ *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(self->GetInstalledApps(r.arg<AppId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay625(Replay &r)
+{
+  ISteamAppList_ *self = (ISteamAppList_ *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(self->GetAppName(r.arg<AppId_t>(1), r.arg<char *>(2), r.arg<int>(3)));
+}
+
+static void replay626(Replay &r)
+{
+  ISteamAppList_ *self = (ISteamAppList_ *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(self->GetAppInstallDir(r.arg<AppId_t>(1), r.arg<char *>(2), r.arg<int>(3)));
+}
+
+static void replay627(Replay &r)
+{
+  ISteamAppList_ *self = (ISteamAppList_ *)r.object(0, (ReplayAccessor)&SteamAppList_);
+  if (self != NULL)
+    r.result(self->GetAppBuildId(r.arg<AppId_t>(1)));
+}
+
+static void replay628(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsSubscribed());
+}
+
+static void replay629(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsLowViolence());
+}
+
+static void replay630(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsCybercafe());
+}
+
+static void replay631(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsVACBanned());
+}
+
+static void replay632(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetCurrentGameLanguage());
+}
+
+static void replay633(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetAvailableGameLanguages());
+}
+
+static void replay634(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsSubscribedApp(r.arg<AppId_t>(1)));
+}
+
+static void replay635(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsDlcInstalled(r.arg<AppId_t>(1)));
+}
+
+static void replay636(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetEarliestPurchaseUnixTime(r.arg<AppId_t>(1)));
+}
+
+static void replay637(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsSubscribedFromFreeWeekend());
+}
+
+static void replay638(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetDLCCount());
+}
+
+static void replay639(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BGetDLCDataByIndex(r.arg<int>(1), r.arg<AppId_t *>(2), r.arg<bool *>(3), r.arg<char *>(4), r.arg<int>(5)));
+}
+
+static void replay640(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    self->InstallDLC(r.arg<AppId_t>(1));
+}
+
+static void replay641(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    self->UninstallDLC(r.arg<AppId_t>(1));
+}
+
+static void replay642(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    self->RequestAppProofOfPurchaseKey(r.arg<AppId_t>(1));
+}
+
+static void replay643(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetCurrentBetaName(r.arg<char *>(1), r.arg<int>(2)));
+}
+
+static void replay644(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->MarkContentCorrupt(r.arg<bool>(1)));
+}
+
+static void replay645(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetInstalledDepots(r.arg<AppId_t>(1), r.arg<DepotId_t *>(2), r.arg<uint32>(3)));
+}
+
+static void replay646(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetAppInstallDir(r.arg<AppId_t>(1), r.arg<char *>(2), r.arg<uint32>(3)));
+}
+
+static void replay647(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->BIsAppInstalled(r.arg<AppId_t>(1)));
+}
+
+static void replay648(Replay &r)
+{
+  CSteamID hidden;
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(*self->GetAppOwner(&hidden));
+}
+
+static void replay649(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetLaunchQueryParam(r.arg<char *>(1)));
+}
+
+static void replay650(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetDlcDownloadProgress(r.arg<AppId_t>(1), r.arg<uint64 *>(2), r.arg<uint64 *>(3)));
+}
+
+static void replay651(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetAppBuildId());
+}
+
+static void replay652(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    self->RequestAllProofOfPurchaseKeys();
+}
+
+static void replay653(Replay &r)
+{
+  ISteamApps_ *self = (ISteamApps_ *)r.object(0, (ReplayAccessor)&SteamApps_);
+  if (self != NULL)
+    r.result(self->GetFileDetails(r.arg<char *>(1)));
+}
+
+static void replay654(Replay &r)
+{
+  ISteamAppTicket_ *self = (ISteamAppTicket_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetAppOwnershipTicketData(r.arg<uint32>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4), r.arg<uint32 *>(5), r.arg<uint32 *>(6), r.arg<uint32 *>(7)));
+}
+
+static void replay655(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->CreateSteamPipe());
+}
+
+static void replay656(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->BReleaseSteamPipe(r.arg<HSteamPipe>(1)));
+}
+
+static void replay657(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->ConnectToGlobalUser(r.arg<HSteamPipe>(1)));
+}
+
+static void replay658(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->CreateLocalUser(r.arg<HSteamPipe *>(1), r.arg<EAccountType>(2)));
+}
+
+static void replay659(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    self->ReleaseUser(r.arg<HSteamPipe>(1), r.arg<HSteamUser>(2));
+}
+
+static void replay660(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamUser(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay661(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamGameServer(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay662(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    self->SetLocalIPBinding(r.arg<uint32>(1), r.arg<uint16>(2));
+}
+
+static void replay663(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamFriends(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay664(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamUtils(r.arg<HSteamPipe>(1), r.arg<char *>(2)));
+}
+
+static void replay665(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamMatchmaking(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay666(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamMatchmakingServers(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay667(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamGenericInterface(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay668(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamUserStats(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay669(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamGameServerStats(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay670(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamApps(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay671(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamNetworking(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay672(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamRemoteStorage(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay673(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamScreenshots(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay674(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetIPCCallCount());
+}
+
+static void replay675(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    self->SetWarningMessageHook(r.arg<SteamAPIWarningMessageHook_t>(1));
+}
+
+static void replay676(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->BShutdownIfAllPipesClosed());
+}
+
+static void replay677(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamHTTP(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay678(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamUnifiedMessages(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay679(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamController(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay680(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamUGC(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay681(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamAppList(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay682(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamMusic(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay683(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamMusicRemote(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay684(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamHTMLSurface(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay685(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamInventory(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay686(Replay &r)
+{
+  ISteamClient_ *self = (ISteamClient_ *)r.object(0, (ReplayAccessor)&SteamClient_);
+  if (self != NULL)
+    r.result(self->GetISteamVideo(r.arg<HSteamUser>(1), r.arg<HSteamPipe>(2), r.arg<char *>(3)));
+}
+
+static void replay687(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->Init());
+}
+
+static void replay688(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->Shutdown());
+}
+
+static void replay689(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    self->RunFrame();
+}
+
+static void replay690(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetConnectedControllers(r.arg<ControllerHandle_t *>(1)));
+}
+
+static void replay691(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->ShowBindingPanel(r.arg<ControllerHandle_t>(1)));
+}
+
+static void replay692(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetActionSetHandle(r.arg<char *>(1)));
+}
+
+static void replay693(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    self->ActivateActionSet(r.arg<ControllerHandle_t>(1), r.arg<ControllerActionSetHandle_t>(2));
+}
+
+static void replay694(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetCurrentActionSet(r.arg<ControllerHandle_t>(1)));
+}
+
+static void replay695(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetDigitalActionHandle(r.arg<char *>(1)));
+}
+
+static void replay696(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetDigitalActionData(r.arg<ControllerHandle_t>(1), r.arg<ControllerDigitalActionHandle_t>(2)));
+}
+
+static void replay697(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetDigitalActionOrigins(r.arg<ControllerHandle_t>(1), r.arg<ControllerActionSetHandle_t>(2), r.arg<ControllerDigitalActionHandle_t>(3), r.arg<EControllerActionOrigin *>(4)));
+}
+
+static void replay698(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetAnalogActionHandle(r.arg<char *>(1)));
+}
+
+static void replay699(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetAnalogActionData(r.arg<ControllerHandle_t>(1), r.arg<ControllerAnalogActionHandle_t>(2)));
+}
+
+static void replay700(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetAnalogActionOrigins(r.arg<ControllerHandle_t>(1), r.arg<ControllerActionSetHandle_t>(2), r.arg<ControllerAnalogActionHandle_t>(3), r.arg<EControllerActionOrigin *>(4)));
+}
+
+static void replay701(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    self->StopAnalogActionMomentum(r.arg<ControllerHandle_t>(1), r.arg<ControllerAnalogActionHandle_t>(2));
+}
+
+static void replay702(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    self->TriggerHapticPulse(r.arg<ControllerHandle_t>(1), r.arg<ESteamControllerPad>(2), r.arg<unsigned short>(3));
+}
+
+static void replay703(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    self->TriggerRepeatedHapticPulse(r.arg<ControllerHandle_t>(1), r.arg<ESteamControllerPad>(2), r.arg<unsigned short>(3), r.arg<unsigned short>(4), r.arg<unsigned short>(5), r.arg<int>(6));
+}
+
+static void replay704(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    self->TriggerVibration(r.arg<ControllerHandle_t>(1), r.arg<unsigned short>(2), r.arg<unsigned short>(3));
+}
+
+static void replay705(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    self->SetLEDColor(r.arg<ControllerHandle_t>(1), r.arg<uint8>(2), r.arg<uint8>(3), r.arg<uint8>(4), r.arg<int>(5));
+}
+
+static void replay706(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetGamepadIndexForController(r.arg<ControllerHandle_t>(1)));
+}
+
+static void replay707(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetControllerForGamepadIndex(r.arg<int>(1)));
+}
+
+static void replay708(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetMotionData(r.arg<ControllerHandle_t>(1)));
+}
+
+static void replay709(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->ShowDigitalActionOrigins(r.arg<ControllerHandle_t>(1), r.arg<ControllerDigitalActionHandle_t>(2), r.arg<float>(3), r.arg<float>(4), r.arg<float>(5)));
+}
+
+static void replay710(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->ShowAnalogActionOrigins(r.arg<ControllerHandle_t>(1), r.arg<ControllerAnalogActionHandle_t>(2), r.arg<float>(3), r.arg<float>(4), r.arg<float>(5)));
+}
+
+static void replay711(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetStringForActionOrigin(r.arg<EControllerActionOrigin>(1)));
+}
+
+static void replay712(Replay &r)
+{
+  ISteamController_ *self = (ISteamController_ *)r.object(0, (ReplayAccessor)&SteamController_);
+  if (self != NULL)
+    r.result(self->GetGlyphForActionOrigin(r.arg<EControllerActionOrigin>(1)));
+}
+
+static void replay713(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetPersonaName());
+}
+
+static void replay714(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->SetPersonaName(r.arg<char *>(1)));
+}
+
+static void replay715(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetPersonaState());
+}
+
+static void replay716(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendCount(r.arg<int>(1)));
+}
+
+static void replay717(Replay &r)
+{
+  CSteamID hidden;
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(*self->GetFriendByIndex(&hidden, r.arg<int>(1), r.arg<int>(2)));
+}
+
+static void replay718(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendRelationship(r.arg<CSteamID>(1)));
+}
+
+static void replay719(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendPersonaState(r.arg<CSteamID>(1)));
+}
+
+static void replay720(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendPersonaName(r.arg<CSteamID>(1)));
+}
+
+static void replay721(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendGamePlayed(r.arg<CSteamID>(1), r.arg<FriendGameInfo_t *>(2)));
+}
+
+static void replay722(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendPersonaNameHistory(r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay723(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendSteamLevel(r.arg<CSteamID>(1)));
+}
+
+static void replay724(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetPlayerNickname(r.arg<CSteamID>(1)));
+}
+
+static void replay725(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendsGroupCount());
+}
+
+static void replay726(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendsGroupIDByIndex(r.arg<int>(1)));
+}
+
+static void replay727(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendsGroupName(r.arg<FriendsGroupID_t>(1)));
+}
+
+static void replay728(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendsGroupMembersCount(r.arg<FriendsGroupID_t>(1)));
+}
+
+static void replay729(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->GetFriendsGroupMembersList(r.arg<FriendsGroupID_t>(1), r.arg<CSteamID *>(2), r.arg<int>(3));
+}
+
+static void replay730(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->HasFriend(r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay731(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetClanCount());
+}
+
+static void replay732(Replay &r)
+{
+  CSteamID hidden;
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(*self->GetClanByIndex(&hidden, r.arg<int>(1)));
+}
+
+static void replay733(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetClanName(r.arg<CSteamID>(1)));
+}
+
+static void replay734(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetClanTag(r.arg<CSteamID>(1)));
+}
+
+static void replay735(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetClanActivityCounts(r.arg<CSteamID>(1), r.arg<int *>(2), r.arg<int *>(3), r.arg<int *>(4)));
+}
+
+static void replay736(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->DownloadClanActivityCounts(r.arg<CSteamID *>(1), r.arg<int>(2)));
+}
+
+static void replay737(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendCountFromSource(r.arg<CSteamID>(1)));
+}
+
+static void replay738(Replay &r)
+{
+  CSteamID hidden;
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(*self->GetFriendFromSourceByIndex(&hidden, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay739(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->IsUserInSource(r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay740(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->SetInGameVoiceSpeaking(r.arg<CSteamID>(1), r.arg<bool>(2));
+}
+
+static void replay741(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->ActivateGameOverlay(r.arg<char *>(1));
+}
+
+static void replay742(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->ActivateGameOverlayToUser(r.arg<char *>(1), r.arg<CSteamID>(2));
+}
+
+static void replay743(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->ActivateGameOverlayToWebPage(r.arg<char *>(1));
+}
+
+static void replay744(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->ActivateGameOverlayToStore(r.arg<AppId_t>(1), r.arg<EOverlayToStoreFlag>(2));
+}
+
+static void replay745(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->SetPlayedWith(r.arg<CSteamID>(1));
+}
+
+static void replay746(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->ActivateGameOverlayInviteDialog(r.arg<CSteamID>(1));
+}
+
+static void replay747(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetSmallFriendAvatar(r.arg<CSteamID>(1)));
+}
+
+static void replay748(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetMediumFriendAvatar(r.arg<CSteamID>(1)));
+}
+
+static void replay749(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetLargeFriendAvatar(r.arg<CSteamID>(1)));
+}
+
+static void replay750(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->RequestUserInformation(r.arg<CSteamID>(1), r.arg<bool>(2)));
+}
+
+static void replay751(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->RequestClanOfficerList(r.arg<CSteamID>(1)));
+}
+
+static void replay752(Replay &r)
+{
+  CSteamID hidden;
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(*self->GetClanOwner(&hidden, r.arg<CSteamID>(1)));
+}
+
+static void replay753(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetClanOfficerCount(r.arg<CSteamID>(1)));
+}
+
+static void replay754(Replay &r)
+{
+  CSteamID hidden;
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(*self->GetClanOfficerByIndex(&hidden, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay755(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetUserRestrictions());
+}
+
+static void replay756(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->SetRichPresence(r.arg<char *>(1), r.arg<char *>(2)));
+}
+
+static void replay757(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->ClearRichPresence();
+}
+
+static void replay758(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendRichPresence(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay759(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendRichPresenceKeyCount(r.arg<CSteamID>(1)));
+}
+
+static void replay760(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendRichPresenceKeyByIndex(r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay761(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    self->RequestFriendRichPresence(r.arg<CSteamID>(1));
+}
+
+static void replay762(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->InviteUserToGame(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay763(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetCoplayFriendCount());
+}
+
+static void replay764(Replay &r)
+{
+  CSteamID hidden;
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(*self->GetCoplayFriend(&hidden, r.arg<int>(1)));
+}
+
+static void replay765(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendCoplayTime(r.arg<CSteamID>(1)));
+}
+
+static void replay766(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendCoplayGame(r.arg<CSteamID>(1)));
+}
+
+static void replay767(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->JoinClanChatRoom(r.arg<CSteamID>(1)));
+}
+
+static void replay768(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->LeaveClanChatRoom(r.arg<CSteamID>(1)));
+}
+
+static void replay769(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetClanChatMemberCount(r.arg<CSteamID>(1)));
+}
+
+static void replay770(Replay &r)
+{
+  CSteamID hidden;
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(*self->GetChatMemberByIndex(&hidden, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay771(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->SendClanChatMessage(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay772(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetClanChatMessage(r.arg<CSteamID>(1), r.arg<int>(2), r.arg<void *>(3), r.arg<int>(4), r.arg<EChatEntryType *>(5), r.arg<CSteamID *>(6)));
+}
+
+static void replay773(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->IsClanChatAdmin(r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay774(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->IsClanChatWindowOpenInSteam(r.arg<CSteamID>(1)));
+}
+
+static void replay775(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->OpenClanChatWindowInSteam(r.arg<CSteamID>(1)));
+}
+
+static void replay776(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->CloseClanChatWindowInSteam(r.arg<CSteamID>(1)));
+}
+
+static void replay777(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->SetListenForFriendsMessages(r.arg<bool>(1)));
+}
+
+static void replay778(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->ReplyToFriendMessage(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay779(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFriendMessage(r.arg<CSteamID>(1), r.arg<int>(2), r.arg<void *>(3), r.arg<int>(4), r.arg<EChatEntryType *>(5)));
+}
+
+static void replay780(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->GetFollowerCount(r.arg<CSteamID>(1)));
+}
+
+static void replay781(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->IsFollowing(r.arg<CSteamID>(1)));
+}
+
+static void replay782(Replay &r)
+{
+  ISteamFriends_ *self = (ISteamFriends_ *)r.object(0, (ReplayAccessor)&SteamFriends_);
+  if (self != NULL)
+    r.result(self->EnumerateFollowingList(r.arg<uint32>(1)));
+}
+
+static void replay783(Replay &r)
+{
+  ISteamGameCoordinator_ *self = (ISteamGameCoordinator_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->SendMessage(r.arg<uint32>(1), r.arg<void *>(2), r.arg<uint32>(3)));
+}
+
+static void replay784(Replay &r)
+{
+  ISteamGameCoordinator_ *self = (ISteamGameCoordinator_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->IsMessageAvailable(r.arg<uint32 *>(1)));
+}
+
+static void replay785(Replay &r)
+{
+  ISteamGameCoordinator_ *self = (ISteamGameCoordinator_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->RetrieveMessage(r.arg<uint32 *>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4)));
+}
+
+static void replay786(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->InitGameServer(r.arg<uint32>(1), r.arg<uint16>(2), r.arg<uint16>(3), r.arg<uint32>(4), r.arg<AppId_t>(5), r.arg<char *>(6)));
+}
+
+static void replay787(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetProduct(r.arg<char *>(1));
+}
+
+static void replay788(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetGameDescription(r.arg<char *>(1));
+}
+
+static void replay789(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetModDir(r.arg<char *>(1));
+}
+
+static void replay790(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetDedicatedServer(r.arg<bool>(1));
+}
+
+static void replay791(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->LogOn(r.arg<char *>(1));
+}
+
+static void replay792(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->LogOnAnonymous();
+}
+
+static void replay793(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->LogOff();
+}
+
+static void replay794(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->BLoggedOn());
+}
+
+static void replay795(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->BSecure());
+}
+
+static void replay796(Replay &r)
+{
+  CSteamID hidden;
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(*self->GetSteamID(&hidden));
+}
+
+static void replay797(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->WasRestartRequested());
+}
+
+static void replay798(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetMaxPlayerCount(r.arg<int>(1));
+}
+
+static void replay799(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetBotPlayerCount(r.arg<int>(1));
+}
+
+static void replay800(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetServerName(r.arg<char *>(1));
+}
+
+static void replay801(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetMapName(r.arg<char *>(1));
+}
+
+static void replay802(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetPasswordProtected(r.arg<bool>(1));
+}
+
+static void replay803(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetSpectatorPort(r.arg<uint16>(1));
+}
+
+static void replay804(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetSpectatorServerName(r.arg<char *>(1));
+}
+
+static void replay805(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->ClearAllKeyValues();
+}
+
+static void replay806(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetKeyValue(r.arg<char *>(1), r.arg<char *>(2));
+}
+
+static void replay807(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetGameTags(r.arg<char *>(1));
+}
+
+static void replay808(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetGameData(r.arg<char *>(1));
+}
+
+static void replay809(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetRegion(r.arg<char *>(1));
+}
+
+static void replay810(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->SendUserConnectAndAuthenticate(r.arg<uint32>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<CSteamID *>(4)));
+}
+
+static void replay811(Replay &r)
+{
+  CSteamID hidden;
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(*self->CreateUnauthenticatedUserConnection(&hidden));
+}
+
+static void replay812(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SendUserDisconnect(r.arg<CSteamID>(1));
+}
+
+static void replay813(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->BUpdateUserData(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<uint32>(3)));
+}
+
+static void replay814(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetAuthSessionTicket(r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay815(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->BeginAuthSession(r.arg<void *>(1), r.arg<int>(2), r.arg<CSteamID>(3)));
+}
+
+static void replay816(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->EndAuthSession(r.arg<CSteamID>(1));
+}
+
+static void replay817(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->CancelAuthTicket(r.arg<HAuthTicket>(1));
+}
+
+static void replay818(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->UserHasLicenseForApp(r.arg<CSteamID>(1), r.arg<AppId_t>(2)));
+}
+
+static void replay819(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->RequestUserGroupStatus(r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay820(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->GetGameplayStats();
+}
+
+static void replay821(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetServerReputation());
+}
+
+static void replay822(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetPublicIP());
+}
+
+static void replay823(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->HandleIncomingPacket(r.arg<void *>(1), r.arg<int>(2), r.arg<uint32>(3), r.arg<uint16>(4)));
+}
+
+static void replay824(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetNextOutgoingPacket(r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3), r.arg<uint16 *>(4)));
+}
+
+static void replay825(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->EnableHeartbeats(r.arg<bool>(1));
+}
+
+static void replay826(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->SetHeartbeatInterval(r.arg<int>(1));
+}
+
+static void replay827(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->ForceHeartbeat();
+}
+
+static void replay828(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->AssociateWithClan(r.arg<CSteamID>(1)));
+}
+
+static void replay829(Replay &r)
+{
+  ISteamGameServer_ *self = (ISteamGameServer_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->ComputeNewPlayerCompatibility(r.arg<CSteamID>(1)));
+}
+
+static void replay830(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->RequestUserStats(r.arg<CSteamID>(1)));
+}
+
+static void replay831(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetUserStat(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<int32 *>(3)));
+}
+
+static void replay832(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetUserStat(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float *>(3)));
+}
+
+static void replay833(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->GetUserAchievement(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<bool *>(3)));
+}
+
+static void replay834(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->SetUserStat(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<int32>(3)));
+}
+
+static void replay835(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->SetUserStat(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float>(3)));
+}
+
+static void replay836(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->UpdateUserAvgRateStat(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float>(3), r.arg<double>(4)));
+}
+
+static void replay837(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->SetUserAchievement(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay838(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->ClearUserAchievement(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay839(Replay &r)
+{
+  ISteamGameServerStats_ *self = (ISteamGameServerStats_ *)r.object(0, NULL);
+  if (self != NULL)
+    r.result(self->StoreUserStats(r.arg<CSteamID>(1)));
+}
+
+static void replay840(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    r.result(self->Init());
+}
+
+static void replay841(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    r.result(self->Shutdown());
+}
+
+static void replay842(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    r.result(self->CreateBrowser(r.arg<char *>(1), r.arg<char *>(2)));
+}
+
+static void replay843(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->RemoveBrowser(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay844(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->LoadURL(r.arg<HHTMLBrowser>(1), r.arg<char *>(2), r.arg<char *>(3));
+}
+
+static void replay845(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->SetSize(r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<uint32>(3));
+}
+
+static void replay846(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->StopLoad(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay847(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->Reload(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay848(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->GoBack(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay849(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->GoForward(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay850(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->AddHeader(r.arg<HHTMLBrowser>(1), r.arg<char *>(2), r.arg<char *>(3));
+}
+
+static void replay851(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->ExecuteJavascript(r.arg<HHTMLBrowser>(1), r.arg<char *>(2));
+}
+
+static void replay852(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->MouseUp(r.arg<HHTMLBrowser>(1), r.arg<ISteamHTMLSurface::EHTMLMouseButton>(2));
+}
+
+static void replay853(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->MouseDown(r.arg<HHTMLBrowser>(1), r.arg<ISteamHTMLSurface::EHTMLMouseButton>(2));
+}
+
+static void replay854(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->MouseDoubleClick(r.arg<HHTMLBrowser>(1), r.arg<ISteamHTMLSurface::EHTMLMouseButton>(2));
+}
+
+static void replay855(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->MouseMove(r.arg<HHTMLBrowser>(1), r.arg<int>(2), r.arg<int>(3));
+}
+
+static void replay856(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->MouseWheel(r.arg<HHTMLBrowser>(1), r.arg<int32>(2));
+}
+
+static void replay857(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->KeyDown(r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<ISteamHTMLSurface::EHTMLKeyModifiers>(3));
+}
+
+static void replay858(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->KeyUp(r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<ISteamHTMLSurface::EHTMLKeyModifiers>(3));
+}
+
+static void replay859(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->KeyChar(r.arg<HHTMLBrowser>(1), r.arg<uint32>(2), r.arg<ISteamHTMLSurface::EHTMLKeyModifiers>(3));
+}
+
+static void replay860(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->SetHorizontalScroll(r.arg<HHTMLBrowser>(1), r.arg<uint32>(2));
+}
+
+static void replay861(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->SetVerticalScroll(r.arg<HHTMLBrowser>(1), r.arg<uint32>(2));
+}
+
+static void replay862(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->SetKeyFocus(r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay863(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->ViewSource(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay864(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->CopyToClipboard(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay865(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->PasteFromClipboard(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay866(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->Find(r.arg<HHTMLBrowser>(1), r.arg<char *>(2), r.arg<bool>(3), r.arg<bool>(4));
+}
+
+static void replay867(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->StopFind(r.arg<HHTMLBrowser>(1));
+}
+
+static void replay868(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->GetLinkAtPosition(r.arg<HHTMLBrowser>(1), r.arg<int>(2), r.arg<int>(3));
+}
+
+static void replay869(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->SetCookie(r.arg<char *>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<char *>(4));
+}
+
+static void replay870(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->SetPageScaleFactor(r.arg<HHTMLBrowser>(1), r.arg<float>(2), r.arg<int>(3), r.arg<int>(4));
+}
+
+static void replay871(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->SetBackgroundMode(r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay872(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->AllowStartRequest(r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay873(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->JSDialogResponse(r.arg<HHTMLBrowser>(1), r.arg<bool>(2));
+}
+
+static void replay874(Replay &r)
+{
+  ISteamHTMLSurface_ *self = (ISteamHTMLSurface_ *)r.object(0, (ReplayAccessor)&SteamHTMLSurface_);
+  if (self != NULL)
+    self->FileLoadDialogResponse(r.arg<HHTMLBrowser>(1), r.arg<char **>(2));
+}
+
+static void replay875(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->CreateHTTPRequest(r.arg<EHTTPMethod>(1), r.arg<char *>(2)));
+}
+
+static void replay876(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestContextValue(r.arg<HTTPRequestHandle>(1), r.arg<uint64>(2)));
+}
+
+static void replay877(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestNetworkActivityTimeout(r.arg<HTTPRequestHandle>(1), r.arg<uint32>(2)));
+}
+
+static void replay878(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestHeaderValue(r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay879(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestGetOrPostParameter(r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay880(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SendHTTPRequest(r.arg<HTTPRequestHandle>(1), r.arg<SteamAPICall_t *>(2)));
+}
+
+static void replay881(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SendHTTPRequestAndStreamResponse(r.arg<HTTPRequestHandle>(1), r.arg<SteamAPICall_t *>(2)));
+}
+
+static void replay882(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->DeferHTTPRequest(r.arg<HTTPRequestHandle>(1)));
+}
+
+static void replay883(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->PrioritizeHTTPRequest(r.arg<HTTPRequestHandle>(1)));
+}
+
+static void replay884(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->GetHTTPResponseHeaderSize(r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay885(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->GetHTTPResponseHeaderValue(r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<uint8 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay886(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->GetHTTPResponseBodySize(r.arg<HTTPRequestHandle>(1), r.arg<uint32 *>(2)));
+}
+
+static void replay887(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->GetHTTPResponseBodyData(r.arg<HTTPRequestHandle>(1), r.arg<uint8 *>(2), r.arg<uint32>(3)));
+}
+
+static void replay888(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->GetHTTPStreamingResponseBodyData(r.arg<HTTPRequestHandle>(1), r.arg<uint32>(2), r.arg<uint8 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay889(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->ReleaseHTTPRequest(r.arg<HTTPRequestHandle>(1)));
+}
+
+static void replay890(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->GetHTTPDownloadProgressPct(r.arg<HTTPRequestHandle>(1), r.arg<float *>(2)));
+}
+
+static void replay891(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestRawPostBody(r.arg<HTTPRequestHandle>(1), r.arg<char *>(2), r.arg<uint8 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay892(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->CreateCookieContainer(r.arg<bool>(1)));
+}
+
+static void replay893(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->ReleaseCookieContainer(r.arg<HTTPCookieContainerHandle>(1)));
+}
+
+static void replay894(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetCookie(r.arg<HTTPCookieContainerHandle>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<char *>(4)));
+}
+
+static void replay895(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestCookieContainer(r.arg<HTTPRequestHandle>(1), r.arg<HTTPCookieContainerHandle>(2)));
+}
+
+static void replay896(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestUserAgentInfo(r.arg<HTTPRequestHandle>(1), r.arg<char *>(2)));
+}
+
+static void replay897(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestRequiresVerifiedCertificate(r.arg<HTTPRequestHandle>(1), r.arg<bool>(2)));
+}
+
+static void replay898(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->SetHTTPRequestAbsoluteTimeoutMS(r.arg<HTTPRequestHandle>(1), r.arg<uint32>(2)));
+}
+
+static void replay899(Replay &r)
+{
+  ISteamHTTP_ *self = (ISteamHTTP_ *)r.object(0, (ReplayAccessor)&SteamHTTP_);
+  if (self != NULL)
+    r.result(self->GetHTTPRequestWasTimedOut(r.arg<HTTPRequestHandle>(1), r.arg<bool *>(2)));
+}
+
+static void replay900(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetResultStatus(r.arg<SteamInventoryResult_t>(1)));
+}
+
+static void replay901(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetResultItems(r.arg<SteamInventoryResult_t>(1), r.arg<SteamItemDetails_t *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay902(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetResultTimestamp(r.arg<SteamInventoryResult_t>(1)));
+}
+
+static void replay903(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->CheckResultSteamID(r.arg<SteamInventoryResult_t>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay904(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    self->DestroyResult(r.arg<SteamInventoryResult_t>(1));
+}
+
+static void replay905(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetAllItems(r.arg<SteamInventoryResult_t *>(1)));
+}
+
+static void replay906(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetItemsByID(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemInstanceID_t *>(2), r.arg<uint32>(3)));
+}
+
+static void replay907(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->SerializeResult(r.arg<SteamInventoryResult_t>(1), r.arg<void *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay908(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->DeserializeResult(r.arg<SteamInventoryResult_t *>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<bool>(4)));
+}
+
+static void replay909(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GenerateItems(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t *>(2), r.arg<uint32 *>(3), r.arg<uint32>(4)));
+}
+
+static void replay910(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GrantPromoItems(r.arg<SteamInventoryResult_t *>(1)));
+}
+
+static void replay911(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->AddPromoItem(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t>(2)));
+}
+
+static void replay912(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->AddPromoItems(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t *>(2), r.arg<uint32>(3)));
+}
+
+static void replay913(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->ConsumeItem(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemInstanceID_t>(2), r.arg<uint32>(3)));
+}
+
+static void replay914(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->ExchangeItems(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t *>(2), r.arg<uint32 *>(3), r.arg<uint32>(4), r.arg<SteamItemInstanceID_t *>(5), r.arg<uint32 *>(6), r.arg<uint32>(7)));
+}
+
+static void replay915(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->TransferItemQuantity(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemInstanceID_t>(2), r.arg<uint32>(3), r.arg<SteamItemInstanceID_t>(4)));
+}
+
+static void replay916(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    self->SendItemDropHeartbeat();
+}
+
+static void replay917(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->TriggerItemDrop(r.arg<SteamInventoryResult_t *>(1), r.arg<SteamItemDef_t>(2)));
+}
+
+static void replay918(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->TradeItems(r.arg<SteamInventoryResult_t *>(1), r.arg<CSteamID>(2), r.arg<SteamItemInstanceID_t *>(3), r.arg<uint32 *>(4), r.arg<uint32>(5), r.arg<SteamItemInstanceID_t *>(6), r.arg<uint32 *>(7), r.arg<uint32>(8)));
+}
+
+static void replay919(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->LoadItemDefinitions());
+}
+
+static void replay920(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetItemDefinitionIDs(r.arg<SteamItemDef_t *>(1), r.arg<uint32 *>(2)));
+}
+
+static void replay921(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetItemDefinitionProperty(r.arg<SteamItemDef_t>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<uint32 *>(4)));
+}
+
+static void replay922(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->RequestEligiblePromoItemDefinitionsIDs(r.arg<CSteamID>(1)));
+}
+
+static void replay923(Replay &r)
+{
+  ISteamInventory_ *self = (ISteamInventory_ *)r.object(0, (ReplayAccessor)&SteamInventory_);
+  if (self != NULL)
+    r.result(self->GetEligiblePromoItemDefinitionIDs(r.arg<CSteamID>(1), r.arg<SteamItemDef_t *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay924(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetFavoriteGameCount());
+}
+
+static void replay925(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetFavoriteGame(r.arg<int>(1), r.arg<AppId_t *>(2), r.arg<uint32 *>(3), r.arg<uint16 *>(4), r.arg<uint16 *>(5), r.arg<uint32 *>(6), r.arg<uint32 *>(7)));
+}
+
+static void replay926(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->AddFavoriteGame(r.arg<AppId_t>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<uint16>(4), r.arg<uint32>(5), r.arg<uint32>(6)));
+}
+
+static void replay927(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->RemoveFavoriteGame(r.arg<AppId_t>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<uint16>(4), r.arg<uint32>(5)));
+}
+
+static void replay928(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->RequestLobbyList());
+}
+
+static void replay929(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->AddRequestLobbyListStringFilter(r.arg<char *>(1), r.arg<char *>(2), r.arg<ELobbyComparison>(3));
+}
+
+static void replay930(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->AddRequestLobbyListNumericalFilter(r.arg<char *>(1), r.arg<int>(2), r.arg<ELobbyComparison>(3));
+}
+
+static void replay931(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->AddRequestLobbyListNearValueFilter(r.arg<char *>(1), r.arg<int>(2));
+}
+
+static void replay932(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->AddRequestLobbyListFilterSlotsAvailable(r.arg<int>(1));
+}
+
+static void replay933(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->AddRequestLobbyListDistanceFilter(r.arg<ELobbyDistanceFilter>(1));
+}
+
+static void replay934(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->AddRequestLobbyListResultCountFilter(r.arg<int>(1));
+}
+
+static void replay935(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->AddRequestLobbyListCompatibleMembersFilter(r.arg<CSteamID>(1));
+}
+
+static void replay936(Replay &r)
+{
+  CSteamID hidden;
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(*self->GetLobbyByIndex(&hidden, r.arg<int>(1)));
+}
+
+static void replay937(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->CreateLobby(r.arg<ELobbyType>(1), r.arg<int>(2)));
+}
+
+static void replay938(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->JoinLobby(r.arg<CSteamID>(1)));
+}
+
+static void replay939(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->LeaveLobby(r.arg<CSteamID>(1));
+}
+
+static void replay940(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->InviteUserToLobby(r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay941(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetNumLobbyMembers(r.arg<CSteamID>(1)));
+}
+
+static void replay942(Replay &r)
+{
+  CSteamID hidden;
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(*self->GetLobbyMemberByIndex(&hidden, r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay943(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetLobbyData(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay944(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->SetLobbyData(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay945(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetLobbyDataCount(r.arg<CSteamID>(1)));
+}
+
+static void replay946(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetLobbyDataByIndex(r.arg<CSteamID>(1), r.arg<int>(2), r.arg<char *>(3), r.arg<int>(4), r.arg<char *>(5), r.arg<int>(6)));
+}
+
+static void replay947(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->DeleteLobbyData(r.arg<CSteamID>(1), r.arg<char *>(2)));
+}
+
+static void replay948(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetLobbyMemberData(r.arg<CSteamID>(1), r.arg<CSteamID>(2), r.arg<char *>(3)));
+}
+
+static void replay949(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->SetLobbyMemberData(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<char *>(3));
+}
+
+static void replay950(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->SendLobbyChatMsg(r.arg<CSteamID>(1), r.arg<void *>(2), r.arg<int>(3)));
+}
+
+static void replay951(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetLobbyChatEntry(r.arg<CSteamID>(1), r.arg<int>(2), r.arg<CSteamID *>(3), r.arg<void *>(4), r.arg<int>(5), r.arg<EChatEntryType *>(6)));
+}
+
+static void replay952(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->RequestLobbyData(r.arg<CSteamID>(1)));
+}
+
+static void replay953(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    self->SetLobbyGameServer(r.arg<CSteamID>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<CSteamID>(4));
+}
+
+static void replay954(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetLobbyGameServer(r.arg<CSteamID>(1), r.arg<uint32 *>(2), r.arg<uint16 *>(3), r.arg<CSteamID *>(4)));
+}
+
+static void replay955(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->SetLobbyMemberLimit(r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay956(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->GetLobbyMemberLimit(r.arg<CSteamID>(1)));
+}
+
+static void replay957(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->SetLobbyType(r.arg<CSteamID>(1), r.arg<ELobbyType>(2)));
+}
+
+static void replay958(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->SetLobbyJoinable(r.arg<CSteamID>(1), r.arg<bool>(2)));
+}
+
+static void replay959(Replay &r)
+{
+  CSteamID hidden;
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(*self->GetLobbyOwner(&hidden, r.arg<CSteamID>(1)));
+}
+
+static void replay960(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->SetLobbyOwner(r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay961(Replay &r)
+{
+  ISteamMatchmaking_ *self = (ISteamMatchmaking_ *)r.object(0, (ReplayAccessor)&SteamMatchmaking_);
+  if (self != NULL)
+    r.result(self->SetLinkedLobby(r.arg<CSteamID>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay962(Replay &r)
+{
+  ISteamMatchmakingServerListResponse_ *self = (ISteamMatchmakingServerListResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->ServerResponded(r.arg<HServerListRequest>(1), r.arg<int>(2));
+}
+
+static void replay963(Replay &r)
+{
+  ISteamMatchmakingServerListResponse_ *self = (ISteamMatchmakingServerListResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->ServerFailedToRespond(r.arg<HServerListRequest>(1), r.arg<int>(2));
+}
+
+static void replay964(Replay &r)
+{
+  ISteamMatchmakingServerListResponse_ *self = (ISteamMatchmakingServerListResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->RefreshComplete(r.arg<HServerListRequest>(1), r.arg<EMatchMakingServerResponse>(2));
+}
+
+static void replay965(Replay &r)
+{
+  ISteamMatchmakingPingResponse_ *self = (ISteamMatchmakingPingResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->ServerResponded(r.arg<gameserveritem_t &>(1));
+}
+
+static void replay966(Replay &r)
+{
+  ISteamMatchmakingPingResponse_ *self = (ISteamMatchmakingPingResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->ServerFailedToRespond();
+}
+
+static void replay967(Replay &r)
+{
+  ISteamMatchmakingPlayersResponse_ *self = (ISteamMatchmakingPlayersResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->AddPlayerToList(r.arg<char *>(1), r.arg<int>(2), r.arg<float>(3));
+}
+
+static void replay968(Replay &r)
+{
+  ISteamMatchmakingPlayersResponse_ *self = (ISteamMatchmakingPlayersResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->PlayersFailedToRespond();
+}
+
+static void replay969(Replay &r)
+{
+  ISteamMatchmakingPlayersResponse_ *self = (ISteamMatchmakingPlayersResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->PlayersRefreshComplete();
+}
+
+static void replay970(Replay &r)
+{
+  ISteamMatchmakingRulesResponse_ *self = (ISteamMatchmakingRulesResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->RulesResponded(r.arg<char *>(1), r.arg<char *>(2));
+}
+
+static void replay971(Replay &r)
+{
+  ISteamMatchmakingRulesResponse_ *self = (ISteamMatchmakingRulesResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->RulesFailedToRespond();
+}
+
+static void replay972(Replay &r)
+{
+  ISteamMatchmakingRulesResponse_ *self = (ISteamMatchmakingRulesResponse_ *)r.object(0, NULL);
+  if (self != NULL)
+    self->RulesRefreshComplete();
+}
+
+static void replay973(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->RequestInternetServerList(r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay974(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->RequestLANServerList(r.arg<AppId_t>(1), r.arg<ISteamMatchmakingServerListResponse *>(2)));
+}
+
+static void replay975(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->RequestFriendsServerList(r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay976(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->RequestFavoritesServerList(r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay977(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->RequestHistoryServerList(r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay978(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->RequestSpectatorServerList(r.arg<AppId_t>(1), r.arg<MatchMakingKeyValuePair_t **>(2), r.arg<uint32>(3), r.arg<ISteamMatchmakingServerListResponse *>(4)));
+}
+
+static void replay979(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    self->ReleaseRequest(r.arg<HServerListRequest>(1));
+}
+
+static void replay980(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->GetServerDetails(r.arg<HServerListRequest>(1), r.arg<int>(2)));
+}
+
+static void replay981(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    self->CancelQuery(r.arg<HServerListRequest>(1));
+}
+
+static void replay982(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    self->RefreshQuery(r.arg<HServerListRequest>(1));
+}
+
+static void replay983(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->IsRefreshing(r.arg<HServerListRequest>(1)));
+}
+
+static void replay984(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->GetServerCount(r.arg<HServerListRequest>(1)));
+}
+
+static void replay985(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    self->RefreshServer(r.arg<HServerListRequest>(1), r.arg<int>(2));
+}
+
+static void replay986(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->PingServer(r.arg<uint32>(1), r.arg<uint16>(2), r.arg<ISteamMatchmakingPingResponse *>(3)));
+}
+
+static void replay987(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->PlayerDetails(r.arg<uint32>(1), r.arg<uint16>(2), r.arg<ISteamMatchmakingPlayersResponse *>(3)));
+}
+
+static void replay988(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    r.result(self->ServerRules(r.arg<uint32>(1), r.arg<uint16>(2), r.arg<ISteamMatchmakingRulesResponse *>(3)));
+}
+
+static void replay989(Replay &r)
+{
+  ISteamMatchmakingServers_ *self = (ISteamMatchmakingServers_ *)r.object(0, (ReplayAccessor)&SteamMatchmakingServers_);
+  if (self != NULL)
+    self->CancelServerQuery(r.arg<HServerQuery>(1));
+}
+
+static void replay990(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(self->BIsEnabled());
+}
+
+static void replay991(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(self->BIsPlaying());
+}
+
+static void replay992(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(self->GetPlaybackStatus());
+}
+
+static void replay993(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    self->Play();
+}
+
+static void replay994(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    self->Pause();
+}
+
+static void replay995(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    self->PlayPrevious();
+}
+
+static void replay996(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    self->PlayNext();
+}
+
+static void replay997(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    self->SetVolume(r.arg<float>(1));
+}
+
+static void replay998(Replay &r)
+{
+  ISteamMusic_ *self = (ISteamMusic_ *)r.object(0, (ReplayAccessor)&SteamMusic_);
+  if (self != NULL)
+    r.result(self->GetVolume());
+}
+
+static void replay999(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->RegisterSteamMusicRemote(r.arg<char *>(1)));
+}
+
+static void replay1000(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->DeregisterSteamMusicRemote());
+}
+
+static void replay1001(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->BIsCurrentMusicRemote());
+}
+
+static void replay1002(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->BActivationSuccess(r.arg<bool>(1)));
+}
+
+static void replay1003(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->SetDisplayName(r.arg<char *>(1)));
+}
+
+static void replay1004(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->SetPNGIcon_64x64(r.arg<void *>(1), r.arg<uint32>(2)));
+}
+
+static void replay1005(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->EnablePlayPrevious(r.arg<bool>(1)));
+}
+
+static void replay1006(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->EnablePlayNext(r.arg<bool>(1)));
+}
+
+static void replay1007(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->EnableShuffled(r.arg<bool>(1)));
+}
+
+static void replay1008(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->EnableLooped(r.arg<bool>(1)));
+}
+
+static void replay1009(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->EnableQueue(r.arg<bool>(1)));
+}
+
+static void replay1010(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->EnablePlaylists(r.arg<bool>(1)));
+}
+
+static void replay1011(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->UpdatePlaybackStatus(r.arg<AudioPlayback_Status>(1)));
+}
+
+static void replay1012(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->UpdateShuffled(r.arg<bool>(1)));
+}
+
+static void replay1013(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->UpdateLooped(r.arg<bool>(1)));
+}
+
+static void replay1014(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->UpdateVolume(r.arg<float>(1)));
+}
+
+static void replay1015(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->CurrentEntryWillChange());
+}
+
+static void replay1016(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->CurrentEntryIsAvailable(r.arg<bool>(1)));
+}
+
+static void replay1017(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->UpdateCurrentEntryText(r.arg<char *>(1)));
+}
+
+static void replay1018(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->UpdateCurrentEntryElapsedSeconds(r.arg<int>(1)));
+}
+
+static void replay1019(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->UpdateCurrentEntryCoverArt(r.arg<void *>(1), r.arg<uint32>(2)));
+}
+
+static void replay1020(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->CurrentEntryDidChange());
+}
+
+static void replay1021(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->QueueWillChange());
+}
+
+static void replay1022(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->ResetQueueEntries());
+}
+
+static void replay1023(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->SetQueueEntry(r.arg<int>(1), r.arg<int>(2), r.arg<char *>(3)));
+}
+
+static void replay1024(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->SetCurrentQueueEntry(r.arg<int>(1)));
+}
+
+static void replay1025(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->QueueDidChange());
+}
+
+static void replay1026(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->PlaylistWillChange());
+}
+
+static void replay1027(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->ResetPlaylistEntries());
+}
+
+static void replay1028(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->SetPlaylistEntry(r.arg<int>(1), r.arg<int>(2), r.arg<char *>(3)));
+}
+
+static void replay1029(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->SetCurrentPlaylistEntry(r.arg<int>(1)));
+}
+
+static void replay1030(Replay &r)
+{
+  ISteamMusicRemote_ *self = (ISteamMusicRemote_ *)r.object(0, (ReplayAccessor)&SteamMusicRemote_);
+  if (self != NULL)
+    r.result(self->PlaylistDidChange());
+}
+
+static void replay1031(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->SendP2PPacket(r.arg<CSteamID>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<EP2PSend>(4), r.arg<int>(5)));
+}
+
+static void replay1032(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->IsP2PPacketAvailable(r.arg<uint32 *>(1), r.arg<int>(2)));
+}
+
+static void replay1033(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->ReadP2PPacket(r.arg<void *>(1), r.arg<uint32>(2), r.arg<uint32 *>(3), r.arg<CSteamID *>(4), r.arg<int>(5)));
+}
+
+static void replay1034(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->AcceptP2PSessionWithUser(r.arg<CSteamID>(1)));
+}
+
+static void replay1035(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->CloseP2PSessionWithUser(r.arg<CSteamID>(1)));
+}
+
+static void replay1036(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->CloseP2PChannelWithUser(r.arg<CSteamID>(1), r.arg<int>(2)));
+}
+
+static void replay1037(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->GetP2PSessionState(r.arg<CSteamID>(1), r.arg<P2PSessionState_t *>(2)));
+}
+
+static void replay1038(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->AllowP2PPacketRelay(r.arg<bool>(1)));
+}
+
+static void replay1039(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->CreateListenSocket(r.arg<int>(1), r.arg<uint32>(2), r.arg<uint16>(3), r.arg<bool>(4)));
+}
+
+static void replay1040(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->CreateP2PConnectionSocket(r.arg<CSteamID>(1), r.arg<int>(2), r.arg<int>(3), r.arg<bool>(4)));
+}
+
+static void replay1041(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->CreateConnectionSocket(r.arg<uint32>(1), r.arg<uint16>(2), r.arg<int>(3)));
+}
+
+static void replay1042(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->DestroySocket(r.arg<SNetSocket_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1043(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->DestroyListenSocket(r.arg<SNetListenSocket_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1044(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->SendDataOnSocket(r.arg<SNetSocket_t>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<bool>(4)));
+}
+
+static void replay1045(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->IsDataAvailableOnSocket(r.arg<SNetSocket_t>(1), r.arg<uint32 *>(2)));
+}
+
+static void replay1046(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->RetrieveDataFromSocket(r.arg<SNetSocket_t>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4)));
+}
+
+static void replay1047(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->IsDataAvailable(r.arg<SNetListenSocket_t>(1), r.arg<uint32 *>(2), r.arg<SNetSocket_t *>(3)));
+}
+
+static void replay1048(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->RetrieveData(r.arg<SNetListenSocket_t>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4), r.arg<SNetSocket_t *>(5)));
+}
+
+static void replay1049(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->GetSocketInfo(r.arg<SNetSocket_t>(1), r.arg<CSteamID *>(2), r.arg<int *>(3), r.arg<uint32 *>(4), r.arg<uint16 *>(5)));
+}
+
+static void replay1050(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->GetListenSocketInfo(r.arg<SNetListenSocket_t>(1), r.arg<uint32 *>(2), r.arg<uint16 *>(3)));
+}
+
+static void replay1051(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->GetSocketConnectionType(r.arg<SNetSocket_t>(1)));
+}
+
+static void replay1052(Replay &r)
+{
+  ISteamNetworking_ *self = (ISteamNetworking_ *)r.object(0, (ReplayAccessor)&SteamNetworking_);
+  if (self != NULL)
+    r.result(self->GetMaxPacketSize(r.arg<SNetSocket_t>(1)));
+}
+
+static void replay1053(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileWrite(r.arg<char *>(1), r.arg<void *>(2), r.arg<int32>(3)));
+}
+
+static void replay1054(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileRead(r.arg<char *>(1), r.arg<void *>(2), r.arg<int32>(3)));
+}
+
+static void replay1055(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileWriteAsync(r.arg<char *>(1), r.arg<void *>(2), r.arg<uint32>(3)));
+}
+
+static void replay1056(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileReadAsync(r.arg<char *>(1), r.arg<uint32>(2), r.arg<uint32>(3)));
+}
+
+static void replay1057(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileReadAsyncComplete(r.arg<SteamAPICall_t>(1), r.arg<void *>(2), r.arg<uint32>(3)));
+}
+
+static void replay1058(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileForget(r.arg<char *>(1)));
+}
+
+static void replay1059(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileDelete(r.arg<char *>(1)));
+}
+
+static void replay1060(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileShare(r.arg<char *>(1)));
+}
+
+static void replay1061(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->SetSyncPlatforms(r.arg<char *>(1), r.arg<ERemoteStoragePlatform>(2)));
+}
+
+static void replay1062(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileWriteStreamOpen(r.arg<char *>(1)));
+}
+
+static void replay1063(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileWriteStreamWriteChunk(r.arg<UGCFileWriteStreamHandle_t>(1), r.arg<void *>(2), r.arg<int32>(3)));
+}
+
+static void replay1064(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileWriteStreamClose(r.arg<UGCFileWriteStreamHandle_t>(1)));
+}
+
+static void replay1065(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileWriteStreamCancel(r.arg<UGCFileWriteStreamHandle_t>(1)));
+}
+
+static void replay1066(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FileExists(r.arg<char *>(1)));
+}
+
+static void replay1067(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->FilePersisted(r.arg<char *>(1)));
+}
+
+static void replay1068(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetFileSize(r.arg<char *>(1)));
+}
+
+static void replay1069(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetFileTimestamp(r.arg<char *>(1)));
+}
+
+static void replay1070(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetSyncPlatforms(r.arg<char *>(1)));
+}
+
+static void replay1071(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetFileCount());
+}
+
+static void replay1072(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetFileNameAndSize(r.arg<int>(1), r.arg<int32 *>(2)));
+}
+
+static void replay1073(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetQuota(r.arg<uint64 *>(1), r.arg<uint64 *>(2)));
+}
+
+static void replay1074(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->IsCloudEnabledForAccount());
+}
+
+static void replay1075(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->IsCloudEnabledForApp());
+}
+
+static void replay1076(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    self->SetCloudEnabledForApp(r.arg<bool>(1));
+}
+
+static void replay1077(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UGCDownload(r.arg<UGCHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1078(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetUGCDownloadProgress(r.arg<UGCHandle_t>(1), r.arg<int32 *>(2), r.arg<int32 *>(3)));
+}
+
+static void replay1079(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetUGCDetails(r.arg<UGCHandle_t>(1), r.arg<AppId_t *>(2), r.arg<char **>(3), r.arg<int32 *>(4), r.arg<CSteamID *>(5)));
+}
+
+static void replay1080(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UGCRead(r.arg<UGCHandle_t>(1), r.arg<void *>(2), r.arg<int32>(3), r.arg<uint32>(4), r.arg<EUGCReadAction>(5)));
+}
+
+static void replay1081(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetCachedUGCCount());
+}
+
+static void replay1082(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetCachedUGCHandle(r.arg<int32>(1)));
+}
+
+static void replay1083(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->PublishWorkshopFile(r.arg<char *>(1), r.arg<char *>(2), r.arg<AppId_t>(3), r.arg<char *>(4), r.arg<char *>(5), r.arg<ERemoteStoragePublishedFileVisibility>(6), r.arg<SteamParamStringArray_t *>(7), r.arg<EWorkshopFileType>(8)));
+}
+
+static void replay1084(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->CreatePublishedFileUpdateRequest(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1085(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdatePublishedFileFile(r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1086(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdatePublishedFilePreviewFile(r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1087(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdatePublishedFileTitle(r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1088(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdatePublishedFileDescription(r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1089(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdatePublishedFileVisibility(r.arg<PublishedFileUpdateHandle_t>(1), r.arg<ERemoteStoragePublishedFileVisibility>(2)));
+}
+
+static void replay1090(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdatePublishedFileTags(r.arg<PublishedFileUpdateHandle_t>(1), r.arg<SteamParamStringArray_t *>(2)));
+}
+
+static void replay1091(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->CommitPublishedFileUpdate(r.arg<PublishedFileUpdateHandle_t>(1)));
+}
+
+static void replay1092(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetPublishedFileDetails(r.arg<PublishedFileId_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1093(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->DeletePublishedFile(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1094(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->EnumerateUserPublishedFiles(r.arg<uint32>(1)));
+}
+
+static void replay1095(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->SubscribePublishedFile(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1096(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->EnumerateUserSubscribedFiles(r.arg<uint32>(1)));
+}
+
+static void replay1097(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UnsubscribePublishedFile(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1098(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdatePublishedFileSetChangeDescription(r.arg<PublishedFileUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1099(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetPublishedItemVoteDetails(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1100(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UpdateUserPublishedItemVote(r.arg<PublishedFileId_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1101(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->GetUserPublishedItemVoteDetails(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1102(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->EnumerateUserSharedWorkshopFiles(r.arg<CSteamID>(1), r.arg<uint32>(2), r.arg<SteamParamStringArray_t *>(3), r.arg<SteamParamStringArray_t *>(4)));
+}
+
+static void replay1103(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->PublishVideo(r.arg<EWorkshopVideoProvider>(1), r.arg<char *>(2), r.arg<char *>(3), r.arg<char *>(4), r.arg<AppId_t>(5), r.arg<char *>(6), r.arg<char *>(7), r.arg<ERemoteStoragePublishedFileVisibility>(8), r.arg<SteamParamStringArray_t *>(9)));
+}
+
+static void replay1104(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->SetUserPublishedFileAction(r.arg<PublishedFileId_t>(1), r.arg<EWorkshopFileAction>(2)));
+}
+
+static void replay1105(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->EnumeratePublishedFilesByUserAction(r.arg<EWorkshopFileAction>(1), r.arg<uint32>(2)));
+}
+
+static void replay1106(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->EnumeratePublishedWorkshopFiles(r.arg<EWorkshopEnumerationType>(1), r.arg<uint32>(2), r.arg<uint32>(3), r.arg<uint32>(4), r.arg<SteamParamStringArray_t *>(5), r.arg<SteamParamStringArray_t *>(6)));
+}
+
+static void replay1107(Replay &r)
+{
+  ISteamRemoteStorage_ *self = (ISteamRemoteStorage_ *)r.object(0, (ReplayAccessor)&SteamRemoteStorage_);
+  if (self != NULL)
+    r.result(self->UGCDownloadToLocation(r.arg<UGCHandle_t>(1), r.arg<char *>(2), r.arg<uint32>(3)));
+}
+
+static void replay1108(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(self->WriteScreenshot(r.arg<void *>(1), r.arg<uint32>(2), r.arg<int>(3), r.arg<int>(4)));
+}
+
+static void replay1109(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(self->AddScreenshotToLibrary(r.arg<char *>(1), r.arg<char *>(2), r.arg<int>(3), r.arg<int>(4)));
+}
+
+static void replay1110(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    self->TriggerScreenshot();
+}
+
+static void replay1111(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    self->HookScreenshots(r.arg<bool>(1));
+}
+
+static void replay1112(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(self->SetLocation(r.arg<ScreenshotHandle>(1), r.arg<char *>(2)));
+}
+
+static void replay1113(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(self->TagUser(r.arg<ScreenshotHandle>(1), r.arg<CSteamID>(2)));
+}
+
+static void replay1114(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(self->TagPublishedFile(r.arg<ScreenshotHandle>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay1115(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(self->IsScreenshotsHooked());
+}
+
+static void replay1116(Replay &r)
+{
+  ISteamScreenshots_ *self = (ISteamScreenshots_ *)r.object(0, (ReplayAccessor)&SteamScreenshots_);
+  if (self != NULL)
+    r.result(self->AddVRScreenshotToLibrary(r.arg<EVRScreenshotType>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay1117(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->CreateQueryUserUGCRequest(r.arg<AccountID_t>(1), r.arg<EUserUGCList>(2), r.arg<EUGCMatchingUGCType>(3), r.arg<EUserUGCListSortOrder>(4), r.arg<AppId_t>(5), r.arg<AppId_t>(6), r.arg<uint32>(7)));
+}
+
+static void replay1118(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->CreateQueryAllUGCRequest(r.arg<EUGCQuery>(1), r.arg<EUGCMatchingUGCType>(2), r.arg<AppId_t>(3), r.arg<AppId_t>(4), r.arg<uint32>(5)));
+}
+
+static void replay1119(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->CreateQueryUGCDetailsRequest(r.arg<PublishedFileId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay1120(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SendQueryUGCRequest(r.arg<UGCQueryHandle_t>(1)));
+}
+
+static void replay1121(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCResult(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<SteamUGCDetails_t *>(3)));
+}
+
+static void replay1122(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCPreviewURL(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<char *>(3), r.arg<uint32>(4)));
+}
+
+static void replay1123(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCMetadata(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<char *>(3), r.arg<uint32>(4)));
+}
+
+static void replay1124(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCChildren(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<PublishedFileId_t *>(3), r.arg<uint32>(4)));
+}
+
+static void replay1125(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCStatistic(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<EItemStatistic>(3), r.arg<uint64 *>(4)));
+}
+
+static void replay1126(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCNumAdditionalPreviews(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1127(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCAdditionalPreview(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<uint32>(3), r.arg<char *>(4), r.arg<uint32>(5), r.arg<char *>(6), r.arg<uint32>(7), r.arg<EItemPreviewType *>(8)));
+}
+
+static void replay1128(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCNumKeyValueTags(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1129(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetQueryUGCKeyValueTag(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2), r.arg<uint32>(3), r.arg<char *>(4), r.arg<uint32>(5), r.arg<char *>(6), r.arg<uint32>(7)));
+}
+
+static void replay1130(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->ReleaseQueryUGCRequest(r.arg<UGCQueryHandle_t>(1)));
+}
+
+static void replay1131(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->AddRequiredTag(r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1132(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->AddExcludedTag(r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1133(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetReturnOnlyIDs(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1134(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetReturnKeyValueTags(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1135(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetReturnLongDescription(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1136(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetReturnMetadata(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1137(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetReturnChildren(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1138(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetReturnAdditionalPreviews(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1139(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetReturnTotalOnly(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1140(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetLanguage(r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1141(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetAllowCachedResponse(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1142(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetCloudFileNameFilter(r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1143(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetMatchAnyTag(r.arg<UGCQueryHandle_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1144(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetSearchText(r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1145(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetRankedByTrendDays(r.arg<UGCQueryHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1146(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->AddRequiredKeyValueTag(r.arg<UGCQueryHandle_t>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay1147(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->RequestUGCDetails(r.arg<PublishedFileId_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1148(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->CreateItem(r.arg<AppId_t>(1), r.arg<EWorkshopFileType>(2)));
+}
+
+static void replay1149(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->StartItemUpdate(r.arg<AppId_t>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay1150(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemTitle(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1151(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemDescription(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1152(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemUpdateLanguage(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1153(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemMetadata(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1154(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemVisibility(r.arg<UGCUpdateHandle_t>(1), r.arg<ERemoteStoragePublishedFileVisibility>(2)));
+}
+
+static void replay1155(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemTags(r.arg<UGCUpdateHandle_t>(1), r.arg<SteamParamStringArray_t *>(2)));
+}
+
+static void replay1156(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemContent(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1157(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetItemPreview(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1158(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->RemoveItemKeyValueTags(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1159(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->AddItemKeyValueTag(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2), r.arg<char *>(3)));
+}
+
+static void replay1160(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->AddItemPreviewFile(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2), r.arg<EItemPreviewType>(3)));
+}
+
+static void replay1161(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->AddItemPreviewVideo(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1162(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->UpdateItemPreviewFile(r.arg<UGCUpdateHandle_t>(1), r.arg<uint32>(2), r.arg<char *>(3)));
+}
+
+static void replay1163(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->UpdateItemPreviewVideo(r.arg<UGCUpdateHandle_t>(1), r.arg<uint32>(2), r.arg<char *>(3)));
+}
+
+static void replay1164(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->RemoveItemPreview(r.arg<UGCUpdateHandle_t>(1), r.arg<uint32>(2)));
+}
+
+static void replay1165(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SubmitItemUpdate(r.arg<UGCUpdateHandle_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1166(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetItemUpdateProgress(r.arg<UGCUpdateHandle_t>(1), r.arg<uint64 *>(2), r.arg<uint64 *>(3)));
+}
+
+static void replay1167(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SetUserItemVote(r.arg<PublishedFileId_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1168(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetUserItemVote(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1169(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->AddItemToFavorites(r.arg<AppId_t>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay1170(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->RemoveItemFromFavorites(r.arg<AppId_t>(1), r.arg<PublishedFileId_t>(2)));
+}
+
+static void replay1171(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->SubscribeItem(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1172(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->UnsubscribeItem(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1173(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetNumSubscribedItems());
+}
+
+static void replay1174(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetSubscribedItems(r.arg<PublishedFileId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay1175(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetItemState(r.arg<PublishedFileId_t>(1)));
+}
+
+static void replay1176(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetItemInstallInfo(r.arg<PublishedFileId_t>(1), r.arg<uint64 *>(2), r.arg<char *>(3), r.arg<uint32>(4), r.arg<uint32 *>(5)));
+}
+
+static void replay1177(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->GetItemDownloadInfo(r.arg<PublishedFileId_t>(1), r.arg<uint64 *>(2), r.arg<uint64 *>(3)));
+}
+
+static void replay1178(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->DownloadItem(r.arg<PublishedFileId_t>(1), r.arg<bool>(2)));
+}
+
+static void replay1179(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->BInitWorkshopForGameServer(r.arg<DepotId_t>(1), r.arg<char *>(2)));
+}
+
+static void replay1180(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    self->SuspendDownloads(r.arg<bool>(1));
+}
+
+static void replay1181(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->StartPlaytimeTracking(r.arg<PublishedFileId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay1182(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->StopPlaytimeTracking(r.arg<PublishedFileId_t *>(1), r.arg<uint32>(2)));
+}
+
+static void replay1183(Replay &r)
+{
+  ISteamUGC_ *self = (ISteamUGC_ *)r.object(0, (ReplayAccessor)&SteamUGC_);
+  if (self != NULL)
+    r.result(self->StopPlaytimeTrackingForAllItems());
+}
+
+static void replay1184(Replay &r)
+{
+  ISteamUnifiedMessages_ *self = (ISteamUnifiedMessages_ *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(self->SendMethod(r.arg<char *>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint64>(4)));
+}
+
+static void replay1185(Replay &r)
+{
+  ISteamUnifiedMessages_ *self = (ISteamUnifiedMessages_ *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(self->GetMethodResponseInfo(r.arg<ClientUnifiedMessageHandle>(1), r.arg<uint32 *>(2), r.arg<EResult *>(3)));
+}
+
+static void replay1186(Replay &r)
+{
+  ISteamUnifiedMessages_ *self = (ISteamUnifiedMessages_ *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(self->GetMethodResponseData(r.arg<ClientUnifiedMessageHandle>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<bool>(4)));
+}
+
+static void replay1187(Replay &r)
+{
+  ISteamUnifiedMessages_ *self = (ISteamUnifiedMessages_ *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(self->ReleaseMethod(r.arg<ClientUnifiedMessageHandle>(1)));
+}
+
+static void replay1188(Replay &r)
+{
+  ISteamUnifiedMessages_ *self = (ISteamUnifiedMessages_ *)r.object(0, (ReplayAccessor)&SteamUnifiedMessages_);
+  if (self != NULL)
+    r.result(self->SendNotification(r.arg<char *>(1), r.arg<void *>(2), r.arg<uint32>(3)));
+}
+
+static void replay1189(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetHSteamUser());
+}
+
+static void replay1190(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->BLoggedOn());
+}
+
+static void replay1191(Replay &r)
+{
+  CSteamID hidden;
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(*self->GetSteamID(&hidden));
+}
+
+static void replay1192(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->InitiateGameConnection(r.arg<void *>(1), r.arg<int>(2), r.arg<CSteamID>(3), r.arg<uint32>(4), r.arg<uint16>(5), r.arg<bool>(6)));
+}
+
+static void replay1193(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    self->TerminateGameConnection(r.arg<uint32>(1), r.arg<uint16>(2));
+}
+
+static void replay1194(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    self->TrackAppUsageEvent(r.arg<CGameID>(1), r.arg<int>(2), r.arg<char *>(3));
+}
+
+static void replay1195(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetUserDataFolder(r.arg<char *>(1), r.arg<int>(2)));
+}
+
+static void replay1196(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    self->StartVoiceRecording();
+}
+
+static void replay1197(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    self->StopVoiceRecording();
+}
+
+static void replay1198(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetAvailableVoice(r.arg<uint32 *>(1), r.arg<uint32 *>(2), r.arg<uint32>(3)));
+}
+
+static void replay1199(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetVoice(r.arg<bool>(1), r.arg<void *>(2), r.arg<uint32>(3), r.arg<uint32 *>(4), r.arg<bool>(5), r.arg<void *>(6), r.arg<uint32>(7), r.arg<uint32 *>(8), r.arg<uint32>(9)));
+}
+
+static void replay1200(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->DecompressVoice(r.arg<void *>(1), r.arg<uint32>(2), r.arg<void *>(3), r.arg<uint32>(4), r.arg<uint32 *>(5), r.arg<uint32>(6)));
+}
+
+static void replay1201(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetVoiceOptimalSampleRate());
+}
+
+static void replay1202(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetAuthSessionTicket(r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay1203(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->BeginAuthSession(r.arg<void *>(1), r.arg<int>(2), r.arg<CSteamID>(3)));
+}
+
+static void replay1204(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    self->EndAuthSession(r.arg<CSteamID>(1));
+}
+
+static void replay1205(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    self->CancelAuthTicket(r.arg<HAuthTicket>(1));
+}
+
+static void replay1206(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->UserHasLicenseForApp(r.arg<CSteamID>(1), r.arg<AppId_t>(2)));
+}
+
+static void replay1207(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->BIsBehindNAT());
+}
+
+static void replay1208(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    self->AdvertiseGame(r.arg<CSteamID>(1), r.arg<uint32>(2), r.arg<uint16>(3));
+}
+
+static void replay1209(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->RequestEncryptedAppTicket(r.arg<void *>(1), r.arg<int>(2)));
+}
+
+static void replay1210(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetEncryptedAppTicket(r.arg<void *>(1), r.arg<int>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay1211(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetGameBadgeLevel(r.arg<int>(1), r.arg<bool>(2)));
+}
+
+static void replay1212(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->GetPlayerSteamLevel());
+}
+
+static void replay1213(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->RequestStoreAuthURL(r.arg<char *>(1)));
+}
+
+static void replay1214(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->BIsPhoneVerified());
+}
+
+static void replay1215(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->BIsTwoFactorEnabled());
+}
+
+static void replay1216(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->BIsPhoneIdentifying());
+}
+
+static void replay1217(Replay &r)
+{
+  ISteamUser_ *self = (ISteamUser_ *)r.object(0, (ReplayAccessor)&SteamUser_);
+  if (self != NULL)
+    r.result(self->BIsPhoneRequiringVerification());
+}
+
+static void replay1218(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->RequestCurrentStats());
+}
+
+static void replay1219(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetStat(r.arg<char *>(1), r.arg<int32 *>(2)));
+}
+
+static void replay1220(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetStat(r.arg<char *>(1), r.arg<float *>(2)));
+}
+
+static void replay1221(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->SetStat(r.arg<char *>(1), r.arg<int32>(2)));
+}
+
+static void replay1222(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->SetStat(r.arg<char *>(1), r.arg<float>(2)));
+}
+
+static void replay1223(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->UpdateAvgRateStat(r.arg<char *>(1), r.arg<float>(2), r.arg<double>(3)));
+}
+
+static void replay1224(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetAchievement(r.arg<char *>(1), r.arg<bool *>(2)));
+}
+
+static void replay1225(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->SetAchievement(r.arg<char *>(1)));
+}
+
+static void replay1226(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->ClearAchievement(r.arg<char *>(1)));
+}
+
+static void replay1227(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetAchievementAndUnlockTime(r.arg<char *>(1), r.arg<bool *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay1228(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->StoreStats());
+}
+
+static void replay1229(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetAchievementIcon(r.arg<char *>(1)));
+}
+
+static void replay1230(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetAchievementDisplayAttribute(r.arg<char *>(1), r.arg<char *>(2)));
+}
+
+static void replay1231(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->IndicateAchievementProgress(r.arg<char *>(1), r.arg<uint32>(2), r.arg<uint32>(3)));
+}
+
+static void replay1232(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetNumAchievements());
+}
+
+static void replay1233(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetAchievementName(r.arg<uint32>(1)));
+}
+
+static void replay1234(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->RequestUserStats(r.arg<CSteamID>(1)));
+}
+
+static void replay1235(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetUserStat(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<int32 *>(3)));
+}
+
+static void replay1236(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetUserStat(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<float *>(3)));
+}
+
+static void replay1237(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetUserAchievement(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<bool *>(3)));
+}
+
+static void replay1238(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetUserAchievementAndUnlockTime(r.arg<CSteamID>(1), r.arg<char *>(2), r.arg<bool *>(3), r.arg<uint32 *>(4)));
+}
+
+static void replay1239(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->ResetAllStats(r.arg<bool>(1)));
+}
+
+static void replay1240(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->FindOrCreateLeaderboard(r.arg<char *>(1), r.arg<ELeaderboardSortMethod>(2), r.arg<ELeaderboardDisplayType>(3)));
+}
+
+static void replay1241(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->FindLeaderboard(r.arg<char *>(1)));
+}
+
+static void replay1242(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetLeaderboardName(r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay1243(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetLeaderboardEntryCount(r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay1244(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetLeaderboardSortMethod(r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay1245(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetLeaderboardDisplayType(r.arg<SteamLeaderboard_t>(1)));
+}
+
+static void replay1246(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->DownloadLeaderboardEntries(r.arg<SteamLeaderboard_t>(1), r.arg<ELeaderboardDataRequest>(2), r.arg<int>(3), r.arg<int>(4)));
+}
+
+static void replay1247(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->DownloadLeaderboardEntriesForUsers(r.arg<SteamLeaderboard_t>(1), r.arg<CSteamID *>(2), r.arg<int>(3)));
+}
+
+static void replay1248(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetDownloadedLeaderboardEntry(r.arg<SteamLeaderboardEntries_t>(1), r.arg<int>(2), r.arg<LeaderboardEntry_t *>(3), r.arg<int32 *>(4), r.arg<int>(5)));
+}
+
+static void replay1249(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->UploadLeaderboardScore(r.arg<SteamLeaderboard_t>(1), r.arg<ELeaderboardUploadScoreMethod>(2), r.arg<int32>(3), r.arg<int32 *>(4), r.arg<int>(5)));
+}
+
+static void replay1250(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->AttachLeaderboardUGC(r.arg<SteamLeaderboard_t>(1), r.arg<UGCHandle_t>(2)));
+}
+
+static void replay1251(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetNumberOfCurrentPlayers());
+}
+
+static void replay1252(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->RequestGlobalAchievementPercentages());
+}
+
+static void replay1253(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetMostAchievedAchievementInfo(r.arg<char *>(1), r.arg<uint32>(2), r.arg<float *>(3), r.arg<bool *>(4)));
+}
+
+static void replay1254(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetNextMostAchievedAchievementInfo(r.arg<int>(1), r.arg<char *>(2), r.arg<uint32>(3), r.arg<float *>(4), r.arg<bool *>(5)));
+}
+
+static void replay1255(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetAchievementAchievedPercent(r.arg<char *>(1), r.arg<float *>(2)));
+}
+
+static void replay1256(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->RequestGlobalStats(r.arg<int>(1)));
+}
+
+static void replay1257(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetGlobalStat(r.arg<char *>(1), r.arg<int64 *>(2)));
+}
+
+static void replay1258(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetGlobalStat(r.arg<char *>(1), r.arg<double *>(2)));
+}
+
+static void replay1259(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetGlobalStatHistory(r.arg<char *>(1), r.arg<int64 *>(2), r.arg<uint32>(3)));
+}
+
+static void replay1260(Replay &r)
+{
+  ISteamUserStats_ *self = (ISteamUserStats_ *)r.object(0, (ReplayAccessor)&SteamUserStats_);
+  if (self != NULL)
+    r.result(self->GetGlobalStatHistory(r.arg<char *>(1), r.arg<double *>(2), r.arg<uint32>(3)));
+}
+
+static void replay1261(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetSecondsSinceAppActive());
+}
+
+static void replay1262(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetSecondsSinceComputerActive());
+}
+
+static void replay1263(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetConnectedUniverse());
+}
+
+static void replay1264(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetServerRealTime());
+}
+
+static void replay1265(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetIPCountry());
+}
+
+static void replay1266(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetImageSize(r.arg<int>(1), r.arg<uint32 *>(2), r.arg<uint32 *>(3)));
+}
+
+static void replay1267(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetImageRGBA(r.arg<int>(1), r.arg<uint8 *>(2), r.arg<int>(3)));
+}
+
+static void replay1268(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetCSERIPPort(r.arg<uint32 *>(1), r.arg<uint16 *>(2)));
+}
+
+static void replay1269(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetCurrentBatteryPower());
+}
+
+static void replay1270(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetAppID());
+}
+
+static void replay1271(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    self->SetOverlayNotificationPosition(r.arg<ENotificationPosition>(1));
+}
+
+static void replay1272(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->IsAPICallCompleted(r.arg<SteamAPICall_t>(1), r.arg<bool *>(2)));
+}
+
+static void replay1273(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetAPICallFailureReason(r.arg<SteamAPICall_t>(1)));
+}
+
+static void replay1274(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetAPICallResult(r.arg<SteamAPICall_t>(1), r.arg<void *>(2), r.arg<int>(3), r.arg<int>(4), r.arg<bool *>(5)));
+}
+
+static void replay1275(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetIPCCallCount());
+}
+
+static void replay1276(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    self->SetWarningMessageHook(r.arg<SteamAPIWarningMessageHook_t>(1));
+}
+
+static void replay1277(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->IsOverlayEnabled());
+}
+
+static void replay1278(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->BOverlayNeedsPresent());
+}
+
+static void replay1279(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->CheckFileSignature(r.arg<char *>(1)));
+}
+
+static void replay1280(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->ShowGamepadTextInput(r.arg<EGamepadTextInputMode>(1), r.arg<EGamepadTextInputLineMode>(2), r.arg<char *>(3), r.arg<uint32>(4), r.arg<char *>(5)));
+}
+
+static void replay1281(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetEnteredGamepadTextLength());
+}
+
+static void replay1282(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetEnteredGamepadTextInput(r.arg<char *>(1), r.arg<uint32>(2)));
+}
+
+static void replay1283(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->GetSteamUILanguage());
+}
+
+static void replay1284(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->IsSteamRunningInVR());
+}
+
+static void replay1285(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    self->SetOverlayNotificationInset(r.arg<int>(1), r.arg<int>(2));
+}
+
+static void replay1286(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    r.result(self->IsSteamInBigPictureMode());
+}
+
+static void replay1287(Replay &r)
+{
+  ISteamUtils_ *self = (ISteamUtils_ *)r.object(0, (ReplayAccessor)&SteamUtils_);
+  if (self != NULL)
+    self->StartVRDashboard();
+}
+
+static void replay1288(Replay &r)
+{
+  ISteamVideo_ *self = (ISteamVideo_ *)r.object(0, (ReplayAccessor)&SteamVideo_);
+  if (self != NULL)
+    self->GetVideoURL(r.arg<AppId_t>(1));
+}
+
+static void replay1289(Replay &r)
+{
+  ISteamVideo_ *self = (ISteamVideo_ *)r.object(0, (ReplayAccessor)&SteamVideo_);
+  if (self != NULL)
+    r.result(self->IsBroadcasting(r.arg<int *>(1)));
+}
+
+const ReplayEntry replayEntries[] = {
+  {"SteamAPI_Init", "", 0, replay0},
+  {"SteamAPI_Shutdown", "", 0, replay1},
+  {"SteamAPI_RestartAppIfNecessary", "", 1, replay2},
+  {"SteamAPI_WriteMiniDump", "", 3, replay3},
+  {"SteamAPI_SetMiniDumpComment", "", 1, replay4},
+  {"SteamAPI_RunCallbacks", "", 0, replay5},
+  {"SteamAPI_IsSteamRunning", "", 0, replay6},
+  {"Steam_RunCallbacks", "", 2, replay7},
+  {"Steam_RegisterInterfaceFuncs", "", 1, replay8},
+  {"Steam_GetHSteamUserCurrent", "", 0, replay9},
+  {"SteamAPI_GetSteamInstallPath", "", 0, replay10},
+  {"SteamAPI_GetHSteamPipe", "", 0, replay11},
+  {"SteamAPI_SetTryCatchCallbacks", "", 1, replay12},
+  {"GetHSteamPipe", "", 0, replay13},
+  {"GetHSteamUser", "", 0, replay14},
+  {"SteamAPI_InitSafe", "", 0, replay15},
+  {"SteamAPI_GetHSteamUser", "", 0, replay16},
+  {"SteamAPI_UseBreakpadCrashHandler", "", 6, replay17},
+  {"SteamAPI_SetBreakpadAppID", "", 1, replay18},
+  {"SteamAPI_ISteamClient_CreateSteamPipe", "", 1, replay19},
+  {"SteamAPI_ISteamClient_BReleaseSteamPipe", "", 2, replay20},
+  {"SteamAPI_ISteamClient_ConnectToGlobalUser", "", 2, replay21},
+  {"SteamAPI_ISteamClient_CreateLocalUser", "", 3, replay22},
+  {"SteamAPI_ISteamClient_ReleaseUser", "", 3, replay23},
+  {"SteamAPI_ISteamClient_GetISteamUser", "", 4, replay24},
+  {"SteamAPI_ISteamClient_GetISteamGameServer", "", 4, replay25},
+  {"SteamAPI_ISteamClient_SetLocalIPBinding", "", 3, replay26},
+  {"SteamAPI_ISteamClient_GetISteamFriends", "", 4, replay27},
+  {"SteamAPI_ISteamClient_GetISteamUtils", "", 3, replay28},
+  {"SteamAPI_ISteamClient_GetISteamMatchmaking", "", 4, replay29},
+  {"SteamAPI_ISteamClient_GetISteamMatchmakingServers", "", 4, replay30},
+  {"SteamAPI_ISteamClient_GetISteamGenericInterface", "", 4, replay31},
+  {"SteamAPI_ISteamClient_GetISteamUserStats", "", 4, replay32},
+  {"SteamAPI_ISteamClient_GetISteamGameServerStats", "", 4, replay33},
+  {"SteamAPI_ISteamClient_GetISteamApps", "", 4, replay34},
+  {"SteamAPI_ISteamClient_GetISteamNetworking", "", 4, replay35},
+  {"SteamAPI_ISteamClient_GetISteamRemoteStorage", "", 4, replay36},
+  {"SteamAPI_ISteamClient_GetISteamScreenshots", "", 4, replay37},
+  {"SteamAPI_ISteamClient_GetIPCCallCount", "", 1, replay38},
+  {"SteamAPI_ISteamClient_SetWarningMessageHook", "", 2, replay39},
+  {"SteamAPI_ISteamClient_BShutdownIfAllPipesClosed", "", 1, replay40},
+  {"SteamAPI_ISteamClient_GetISteamHTTP", "", 4, replay41},
+  {"SteamAPI_ISteamClient_GetISteamUnifiedMessages", "", 4, replay42},
+  {"SteamAPI_ISteamClient_GetISteamController", "", 4, replay43},
+  {"SteamAPI_ISteamClient_GetISteamUGC", "", 4, replay44},
+  {"SteamAPI_ISteamClient_GetISteamAppList", "", 4, replay45},
+  {"SteamAPI_ISteamClient_GetISteamMusic", "", 4, replay46},
+  {"SteamAPI_ISteamClient_GetISteamMusicRemote", "", 4, replay47},
+  {"SteamAPI_ISteamClient_GetISteamHTMLSurface", "", 4, replay48},
+  {"SteamAPI_ISteamClient_GetISteamInventory", "", 4, replay49},
+  {"SteamAPI_ISteamClient_GetISteamVideo", "", 4, replay50},
+  {"SteamAPI_ISteamUser_GetHSteamUser", "", 1, replay51},
+  {"SteamAPI_ISteamUser_BLoggedOn", "", 1, replay52},
+  {"SteamAPI_ISteamUser_GetSteamID", "", 1, replay53},
+  {"SteamAPI_ISteamUser_InitiateGameConnection", "1:2", 7, replay54},
+  {"SteamAPI_ISteamUser_TerminateGameConnection", "", 3, replay55},
+  {"SteamAPI_ISteamUser_TrackAppUsageEvent", "", 4, replay56},
+  {"SteamAPI_ISteamUser_GetUserDataFolder", "1:2", 3, replay57},
+  {"SteamAPI_ISteamUser_StartVoiceRecording", "", 1, replay58},
+  {"SteamAPI_ISteamUser_StopVoiceRecording", "", 1, replay59},
+  {"SteamAPI_ISteamUser_GetAvailableVoice", "", 4, replay60},
+  {"SteamAPI_ISteamUser_GetVoice", "2:3 6:7", 10, replay61},
+  {"SteamAPI_ISteamUser_DecompressVoice", "1:2 3:4", 7, replay62},
+  {"SteamAPI_ISteamUser_GetVoiceOptimalSampleRate", "", 1, replay63},
+  {"SteamAPI_ISteamUser_GetAuthSessionTicket", "1:2", 4, replay64},
+  {"SteamAPI_ISteamUser_BeginAuthSession", "1:2", 4, replay65},
+  {"SteamAPI_ISteamUser_EndAuthSession", "", 2, replay66},
+  {"SteamAPI_ISteamUser_CancelAuthTicket", "", 2, replay67},
+  {"SteamAPI_ISteamUser_UserHasLicenseForApp", "", 3, replay68},
+  {"SteamAPI_ISteamUser_BIsBehindNAT", "", 1, replay69},
+  {"SteamAPI_ISteamUser_AdvertiseGame", "", 4, replay70},
+  {"SteamAPI_ISteamUser_RequestEncryptedAppTicket", "1:2", 3, replay71},
+  {"SteamAPI_ISteamUser_GetEncryptedAppTicket", "1:2", 4, replay72},
+  {"SteamAPI_ISteamUser_GetGameBadgeLevel", "", 3, replay73},
+  {"SteamAPI_ISteamUser_GetPlayerSteamLevel", "", 1, replay74},
+  {"SteamAPI_ISteamUser_RequestStoreAuthURL", "", 2, replay75},
+  {"SteamAPI_ISteamFriends_GetPersonaName", "", 1, replay76},
+  {"SteamAPI_ISteamFriends_SetPersonaName", "", 2, replay77},
+  {"SteamAPI_ISteamFriends_GetPersonaState", "", 1, replay78},
+  {"SteamAPI_ISteamFriends_GetFriendCount", "", 2, replay79},
+  {"SteamAPI_ISteamFriends_GetFriendByIndex", "", 3, replay80},
+  {"SteamAPI_ISteamFriends_GetFriendRelationship", "", 2, replay81},
+  {"SteamAPI_ISteamFriends_GetFriendPersonaState", "", 2, replay82},
+  {"SteamAPI_ISteamFriends_GetFriendPersonaName", "", 2, replay83},
+  {"SteamAPI_ISteamFriends_GetFriendGamePlayed", "", 3, replay84},
+  {"SteamAPI_ISteamFriends_GetFriendPersonaNameHistory", "", 3, replay85},
+  {"SteamAPI_ISteamFriends_GetFriendSteamLevel", "", 2, replay86},
+  {"SteamAPI_ISteamFriends_GetPlayerNickname", "", 2, replay87},
+  {"SteamAPI_ISteamFriends_GetFriendsGroupCount", "", 1, replay88},
+  {"SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex", "", 2, replay89},
+  {"SteamAPI_ISteamFriends_GetFriendsGroupName", "", 2, replay90},
+  {"SteamAPI_ISteamFriends_GetFriendsGroupMembersCount", "", 2, replay91},
+  {"SteamAPI_ISteamFriends_GetFriendsGroupMembersList", "", 4, replay92},
+  {"SteamAPI_ISteamFriends_HasFriend", "", 3, replay93},
+  {"SteamAPI_ISteamFriends_GetClanCount", "", 1, replay94},
+  {"SteamAPI_ISteamFriends_GetClanByIndex", "", 2, replay95},
+  {"SteamAPI_ISteamFriends_GetClanName", "", 2, replay96},
+  {"SteamAPI_ISteamFriends_GetClanTag", "", 2, replay97},
+  {"SteamAPI_ISteamFriends_GetClanActivityCounts", "", 5, replay98},
+  {"SteamAPI_ISteamFriends_DownloadClanActivityCounts", "", 3, replay99},
+  {"SteamAPI_ISteamFriends_GetFriendCountFromSource", "", 2, replay100},
+  {"SteamAPI_ISteamFriends_GetFriendFromSourceByIndex", "", 3, replay101},
+  {"SteamAPI_ISteamFriends_IsUserInSource", "", 3, replay102},
+  {"SteamAPI_ISteamFriends_SetInGameVoiceSpeaking", "", 3, replay103},
+  {"SteamAPI_ISteamFriends_ActivateGameOverlay", "", 2, replay104},
+  {"SteamAPI_ISteamFriends_ActivateGameOverlayToUser", "", 3, replay105},
+  {"SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage", "", 2, replay106},
+  {"SteamAPI_ISteamFriends_ActivateGameOverlayToStore", "", 3, replay107},
+  {"SteamAPI_ISteamFriends_SetPlayedWith", "", 2, replay108},
+  {"SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog", "", 2, replay109},
+  {"SteamAPI_ISteamFriends_GetSmallFriendAvatar", "", 2, replay110},
+  {"SteamAPI_ISteamFriends_GetMediumFriendAvatar", "", 2, replay111},
+  {"SteamAPI_ISteamFriends_GetLargeFriendAvatar", "", 2, replay112},
+  {"SteamAPI_ISteamFriends_RequestUserInformation", "", 3, replay113},
+  {"SteamAPI_ISteamFriends_RequestClanOfficerList", "", 2, replay114},
+  {"SteamAPI_ISteamFriends_GetClanOwner", "", 2, replay115},
+  {"SteamAPI_ISteamFriends_GetClanOfficerCount", "", 2, replay116},
+  {"SteamAPI_ISteamFriends_GetClanOfficerByIndex", "", 3, replay117},
+  {"SteamAPI_ISteamFriends_GetUserRestrictions", "", 1, replay118},
+  {"SteamAPI_ISteamFriends_SetRichPresence", "", 3, replay119},
+  {"SteamAPI_ISteamFriends_ClearRichPresence", "", 1, replay120},
+  {"SteamAPI_ISteamFriends_GetFriendRichPresence", "", 3, replay121},
+  {"SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount", "", 2, replay122},
+  {"SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex", "", 3, replay123},
+  {"SteamAPI_ISteamFriends_RequestFriendRichPresence", "", 2, replay124},
+  {"SteamAPI_ISteamFriends_InviteUserToGame", "", 3, replay125},
+  {"SteamAPI_ISteamFriends_GetCoplayFriendCount", "", 1, replay126},
+  {"SteamAPI_ISteamFriends_GetCoplayFriend", "", 2, replay127},
+  {"SteamAPI_ISteamFriends_GetFriendCoplayTime", "", 2, replay128},
+  {"SteamAPI_ISteamFriends_GetFriendCoplayGame", "", 2, replay129},
+  {"SteamAPI_ISteamFriends_JoinClanChatRoom", "", 2, replay130},
+  {"SteamAPI_ISteamFriends_LeaveClanChatRoom", "", 2, replay131},
+  {"SteamAPI_ISteamFriends_GetClanChatMemberCount", "", 2, replay132},
+  {"SteamAPI_ISteamFriends_GetChatMemberByIndex", "", 3, replay133},
+  {"SteamAPI_ISteamFriends_SendClanChatMessage", "", 3, replay134},
+  {"SteamAPI_ISteamFriends_GetClanChatMessage", "3:4", 7, replay135},
+  {"SteamAPI_ISteamFriends_IsClanChatAdmin", "", 3, replay136},
+  {"SteamAPI_ISteamFriends_IsClanChatWindowOpenInSteam", "", 2, replay137},
+  {"SteamAPI_ISteamFriends_OpenClanChatWindowInSteam", "", 2, replay138},
+  {"SteamAPI_ISteamFriends_CloseClanChatWindowInSteam", "", 2, replay139},
+  {"SteamAPI_ISteamFriends_SetListenForFriendsMessages", "", 2, replay140},
+  {"SteamAPI_ISteamFriends_ReplyToFriendMessage", "", 3, replay141},
+  {"SteamAPI_ISteamFriends_GetFriendMessage", "3:4", 6, replay142},
+  {"SteamAPI_ISteamFriends_GetFollowerCount", "", 2, replay143},
+  {"SteamAPI_ISteamFriends_IsFollowing", "", 2, replay144},
+  {"SteamAPI_ISteamFriends_EnumerateFollowingList", "", 2, replay145},
+  {"SteamAPI_ISteamUtils_GetSecondsSinceAppActive", "", 1, replay146},
+  {"SteamAPI_ISteamUtils_GetSecondsSinceComputerActive", "", 1, replay147},
+  {"SteamAPI_ISteamUtils_GetConnectedUniverse", "", 1, replay148},
+  {"SteamAPI_ISteamUtils_GetServerRealTime", "", 1, replay149},
+  {"SteamAPI_ISteamUtils_GetIPCountry", "", 1, replay150},
+  {"SteamAPI_ISteamUtils_GetImageSize", "", 4, replay151},
+  {"SteamAPI_ISteamUtils_GetImageRGBA", "2:3", 4, replay152},
+  {"SteamAPI_ISteamUtils_GetCSERIPPort", "", 3, replay153},
+  {"SteamAPI_ISteamUtils_GetCurrentBatteryPower", "", 1, replay154},
+  {"SteamAPI_ISteamUtils_GetAppID", "", 1, replay155},
+  {"SteamAPI_ISteamUtils_SetOverlayNotificationPosition", "", 2, replay156},
+  {"SteamAPI_ISteamUtils_IsAPICallCompleted", "", 3, replay157},
+  {"SteamAPI_ISteamUtils_GetAPICallFailureReason", "", 2, replay158},
+  {"SteamAPI_ISteamUtils_GetAPICallResult", "2:3", 6, replay159},
+  {"SteamAPI_ISteamUtils_GetIPCCallCount", "", 1, replay160},
+  {"SteamAPI_ISteamUtils_SetWarningMessageHook", "", 2, replay161},
+  {"SteamAPI_ISteamUtils_IsOverlayEnabled", "", 1, replay162},
+  {"SteamAPI_ISteamUtils_BOverlayNeedsPresent", "", 1, replay163},
+  {"SteamAPI_ISteamUtils_CheckFileSignature", "", 2, replay164},
+  {"SteamAPI_ISteamUtils_ShowGamepadTextInput", "", 6, replay165},
+  {"SteamAPI_ISteamUtils_GetEnteredGamepadTextLength", "", 1, replay166},
+  {"SteamAPI_ISteamUtils_GetEnteredGamepadTextInput", "1:2", 3, replay167},
+  {"SteamAPI_ISteamUtils_GetSteamUILanguage", "", 1, replay168},
+  {"SteamAPI_ISteamUtils_IsSteamRunningInVR", "", 1, replay169},
+  {"SteamAPI_ISteamMatchmaking_GetFavoriteGameCount", "", 1, replay170},
+  {"SteamAPI_ISteamMatchmaking_GetFavoriteGame", "", 8, replay171},
+  {"SteamAPI_ISteamMatchmaking_AddFavoriteGame", "", 7, replay172},
+  {"SteamAPI_ISteamMatchmaking_RemoveFavoriteGame", "", 6, replay173},
+  {"SteamAPI_ISteamMatchmaking_RequestLobbyList", "", 1, replay174},
+  {"SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter", "", 4, replay175},
+  {"SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter", "", 4, replay176},
+  {"SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter", "", 3, replay177},
+  {"SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable", "", 2, replay178},
+  {"SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter", "", 2, replay179},
+  {"SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter", "", 2, replay180},
+  {"SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter", "", 2, replay181},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyByIndex", "", 2, replay182},
+  {"SteamAPI_ISteamMatchmaking_CreateLobby", "", 3, replay183},
+  {"SteamAPI_ISteamMatchmaking_JoinLobby", "", 2, replay184},
+  {"SteamAPI_ISteamMatchmaking_LeaveLobby", "", 2, replay185},
+  {"SteamAPI_ISteamMatchmaking_InviteUserToLobby", "", 3, replay186},
+  {"SteamAPI_ISteamMatchmaking_GetNumLobbyMembers", "", 2, replay187},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex", "", 3, replay188},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyData", "", 3, replay189},
+  {"SteamAPI_ISteamMatchmaking_SetLobbyData", "", 4, replay190},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyDataCount", "", 2, replay191},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex", "3:4 5:6", 7, replay192},
+  {"SteamAPI_ISteamMatchmaking_DeleteLobbyData", "", 3, replay193},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyMemberData", "", 4, replay194},
+  {"SteamAPI_ISteamMatchmaking_SetLobbyMemberData", "", 4, replay195},
+  {"SteamAPI_ISteamMatchmaking_SendLobbyChatMsg", "2:3", 4, replay196},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyChatEntry", "4:5", 7, replay197},
+  {"SteamAPI_ISteamMatchmaking_RequestLobbyData", "", 2, replay198},
+  {"SteamAPI_ISteamMatchmaking_SetLobbyGameServer", "", 5, replay199},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyGameServer", "", 5, replay200},
+  {"SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit", "", 3, replay201},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit", "", 2, replay202},
+  {"SteamAPI_ISteamMatchmaking_SetLobbyType", "", 3, replay203},
+  {"SteamAPI_ISteamMatchmaking_SetLobbyJoinable", "", 3, replay204},
+  {"SteamAPI_ISteamMatchmaking_GetLobbyOwner", "", 2, replay205},
+  {"SteamAPI_ISteamMatchmaking_SetLobbyOwner", "", 3, replay206},
+  {"SteamAPI_ISteamMatchmaking_SetLinkedLobby", "", 3, replay207},
+  {"SteamAPI_ISteamMatchmakingServerListResponse_ServerResponded", "", 3, replay208},
+  {"SteamAPI_ISteamMatchmakingServerListResponse_ServerFailedToRespond", "", 3, replay209},
+  {"SteamAPI_ISteamMatchmakingServerListResponse_RefreshComplete", "", 3, replay210},
+  {"SteamAPI_ISteamMatchmakingPingResponse_ServerResponded", "", 2, replay211},
+  {"SteamAPI_ISteamMatchmakingPingResponse_ServerFailedToRespond", "", 1, replay212},
+  {"SteamAPI_ISteamMatchmakingPlayersResponse_AddPlayerToList", "", 4, replay213},
+  {"SteamAPI_ISteamMatchmakingPlayersResponse_PlayersFailedToRespond", "", 1, replay214},
+  {"SteamAPI_ISteamMatchmakingPlayersResponse_PlayersRefreshComplete", "", 1, replay215},
+  {"SteamAPI_ISteamMatchmakingRulesResponse_RulesResponded", "", 3, replay216},
+  {"SteamAPI_ISteamMatchmakingRulesResponse_RulesFailedToRespond", "", 1, replay217},
+  {"SteamAPI_ISteamMatchmakingRulesResponse_RulesRefreshComplete", "", 1, replay218},
+  {"SteamAPI_ISteamMatchmakingServers_RequestInternetServerList", "", 5, replay219},
+  {"SteamAPI_ISteamMatchmakingServers_RequestLANServerList", "", 3, replay220},
+  {"SteamAPI_ISteamMatchmakingServers_RequestFriendsServerList", "", 5, replay221},
+  {"SteamAPI_ISteamMatchmakingServers_RequestFavoritesServerList", "", 5, replay222},
+  {"SteamAPI_ISteamMatchmakingServers_RequestHistoryServerList", "", 5, replay223},
+  {"SteamAPI_ISteamMatchmakingServers_RequestSpectatorServerList", "", 5, replay224},
+  {"SteamAPI_ISteamMatchmakingServers_ReleaseRequest", "", 2, replay225},
+  {"SteamAPI_ISteamMatchmakingServers_GetServerDetails", "", 3, replay226},
+  {"SteamAPI_ISteamMatchmakingServers_CancelQuery", "", 2, replay227},
+  {"SteamAPI_ISteamMatchmakingServers_RefreshQuery", "", 2, replay228},
+  {"SteamAPI_ISteamMatchmakingServers_IsRefreshing", "", 2, replay229},
+  {"SteamAPI_ISteamMatchmakingServers_GetServerCount", "", 2, replay230},
+  {"SteamAPI_ISteamMatchmakingServers_RefreshServer", "", 3, replay231},
+  {"SteamAPI_ISteamMatchmakingServers_PingServer", "", 4, replay232},
+  {"SteamAPI_ISteamMatchmakingServers_PlayerDetails", "", 4, replay233},
+  {"SteamAPI_ISteamMatchmakingServers_ServerRules", "", 4, replay234},
+  {"SteamAPI_ISteamMatchmakingServers_CancelServerQuery", "", 2, replay235},
+  {"SteamAPI_ISteamRemoteStorage_FileWrite", "2:3", 4, replay236},
+  {"SteamAPI_ISteamRemoteStorage_FileRead", "2:3", 4, replay237},
+  {"SteamAPI_ISteamRemoteStorage_FileForget", "", 2, replay238},
+  {"SteamAPI_ISteamRemoteStorage_FileDelete", "", 2, replay239},
+  {"SteamAPI_ISteamRemoteStorage_FileShare", "", 2, replay240},
+  {"SteamAPI_ISteamRemoteStorage_SetSyncPlatforms", "", 3, replay241},
+  {"SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen", "", 2, replay242},
+  {"SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk", "2:3", 4, replay243},
+  {"SteamAPI_ISteamRemoteStorage_FileWriteStreamClose", "", 2, replay244},
+  {"SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel", "", 2, replay245},
+  {"SteamAPI_ISteamRemoteStorage_FileExists", "", 2, replay246},
+  {"SteamAPI_ISteamRemoteStorage_FilePersisted", "", 2, replay247},
+  {"SteamAPI_ISteamRemoteStorage_GetFileSize", "", 2, replay248},
+  {"SteamAPI_ISteamRemoteStorage_GetFileTimestamp", "", 2, replay249},
+  {"SteamAPI_ISteamRemoteStorage_GetSyncPlatforms", "", 2, replay250},
+  {"SteamAPI_ISteamRemoteStorage_GetFileCount", "", 1, replay251},
+  {"SteamAPI_ISteamRemoteStorage_GetFileNameAndSize", "", 3, replay252},
+  {"SteamAPI_ISteamRemoteStorage_GetQuota", "", 3, replay253},
+  {"SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount", "", 1, replay254},
+  {"SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp", "", 1, replay255},
+  {"SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp", "", 2, replay256},
+  {"SteamAPI_ISteamRemoteStorage_UGCDownload", "", 3, replay257},
+  {"SteamAPI_ISteamRemoteStorage_GetUGCDownloadProgress", "", 4, replay258},
+  {"SteamAPI_ISteamRemoteStorage_GetUGCDetails", "", 6, replay259},
+  {"SteamAPI_ISteamRemoteStorage_UGCRead", "2:3", 6, replay260},
+  {"SteamAPI_ISteamRemoteStorage_GetCachedUGCCount", "", 1, replay261},
+  {"SteamAPI_ISteamRemoteStorage_GetCachedUGCHandle", "", 2, replay262},
+  {"SteamAPI_ISteamRemoteStorage_PublishWorkshopFile", "", 9, replay263},
+  {"SteamAPI_ISteamRemoteStorage_CreatePublishedFileUpdateRequest", "", 2, replay264},
+  {"SteamAPI_ISteamRemoteStorage_UpdatePublishedFileFile", "", 3, replay265},
+  {"SteamAPI_ISteamRemoteStorage_UpdatePublishedFilePreviewFile", "", 3, replay266},
+  {"SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTitle", "", 3, replay267},
+  {"SteamAPI_ISteamRemoteStorage_UpdatePublishedFileDescription", "", 3, replay268},
+  {"SteamAPI_ISteamRemoteStorage_UpdatePublishedFileVisibility", "", 3, replay269},
+  {"SteamAPI_ISteamRemoteStorage_UpdatePublishedFileTags", "", 3, replay270},
+  {"SteamAPI_ISteamRemoteStorage_CommitPublishedFileUpdate", "", 2, replay271},
+  {"SteamAPI_ISteamRemoteStorage_GetPublishedFileDetails", "", 3, replay272},
+  {"SteamAPI_ISteamRemoteStorage_DeletePublishedFile", "", 2, replay273},
+  {"SteamAPI_ISteamRemoteStorage_EnumerateUserPublishedFiles", "", 2, replay274},
+  {"SteamAPI_ISteamRemoteStorage_SubscribePublishedFile", "", 2, replay275},
+  {"SteamAPI_ISteamRemoteStorage_EnumerateUserSubscribedFiles", "", 2, replay276},
+  {"SteamAPI_ISteamRemoteStorage_UnsubscribePublishedFile", "", 2, replay277},
+  {"SteamAPI_ISteamRemoteStorage_UpdatePublishedFileSetChangeDescription", "", 3, replay278},
+  {"SteamAPI_ISteamRemoteStorage_GetPublishedItemVoteDetails", "", 2, replay279},
+  {"SteamAPI_ISteamRemoteStorage_UpdateUserPublishedItemVote", "", 3, replay280},
+  {"SteamAPI_ISteamRemoteStorage_GetUserPublishedItemVoteDetails", "", 2, replay281},
+  {"SteamAPI_ISteamRemoteStorage_EnumerateUserSharedWorkshopFiles", "", 5, replay282},
+  {"SteamAPI_ISteamRemoteStorage_PublishVideo", "", 10, replay283},
+  {"SteamAPI_ISteamRemoteStorage_SetUserPublishedFileAction", "", 3, replay284},
+  {"SteamAPI_ISteamRemoteStorage_EnumeratePublishedFilesByUserAction", "", 3, replay285},
+  {"SteamAPI_ISteamRemoteStorage_EnumeratePublishedWorkshopFiles", "", 7, replay286},
+  {"SteamAPI_ISteamRemoteStorage_UGCDownloadToLocation", "", 4, replay287},
+  {"SteamAPI_ISteamUserStats_RequestCurrentStats", "", 1, replay288},
+  {"SteamAPI_ISteamUserStats_GetStat", "", 3, replay289},
+  {"SteamAPI_ISteamUserStats_GetStat0", "", 3, replay290},
+  {"SteamAPI_ISteamUserStats_SetStat", "", 3, replay291},
+  {"SteamAPI_ISteamUserStats_SetStat0", "", 3, replay292},
+  {"SteamAPI_ISteamUserStats_UpdateAvgRateStat", "", 4, replay293},
+  {"SteamAPI_ISteamUserStats_GetAchievement", "", 3, replay294},
+  {"SteamAPI_ISteamUserStats_SetAchievement", "", 2, replay295},
+  {"SteamAPI_ISteamUserStats_ClearAchievement", "", 2, replay296},
+  {"SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime", "", 4, replay297},
+  {"SteamAPI_ISteamUserStats_StoreStats", "", 1, replay298},
+  {"SteamAPI_ISteamUserStats_GetAchievementIcon", "", 2, replay299},
+  {"SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute", "", 3, replay300},
+  {"SteamAPI_ISteamUserStats_IndicateAchievementProgress", "", 4, replay301},
+  {"SteamAPI_ISteamUserStats_GetNumAchievements", "", 1, replay302},
+  {"SteamAPI_ISteamUserStats_GetAchievementName", "", 2, replay303},
+  {"SteamAPI_ISteamUserStats_RequestUserStats", "", 2, replay304},
+  {"SteamAPI_ISteamUserStats_GetUserStat", "", 4, replay305},
+  {"SteamAPI_ISteamUserStats_GetUserStat0", "", 4, replay306},
+  {"SteamAPI_ISteamUserStats_GetUserAchievement", "", 4, replay307},
+  {"SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime", "", 5, replay308},
+  {"SteamAPI_ISteamUserStats_ResetAllStats", "", 2, replay309},
+  {"SteamAPI_ISteamUserStats_FindOrCreateLeaderboard", "", 4, replay310},
+  {"SteamAPI_ISteamUserStats_FindLeaderboard", "", 2, replay311},
+  {"SteamAPI_ISteamUserStats_GetLeaderboardName", "", 2, replay312},
+  {"SteamAPI_ISteamUserStats_GetLeaderboardEntryCount", "", 2, replay313},
+  {"SteamAPI_ISteamUserStats_GetLeaderboardSortMethod", "", 2, replay314},
+  {"SteamAPI_ISteamUserStats_GetLeaderboardDisplayType", "", 2, replay315},
+  {"SteamAPI_ISteamUserStats_DownloadLeaderboardEntries", "", 5, replay316},
+  {"SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers", "", 4, replay317},
+  {"SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry", "", 6, replay318},
+  {"SteamAPI_ISteamUserStats_UploadLeaderboardScore", "", 6, replay319},
+  {"SteamAPI_ISteamUserStats_AttachLeaderboardUGC", "", 3, replay320},
+  {"SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers", "", 1, replay321},
+  {"SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages", "", 1, replay322},
+  {"SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo", "", 5, replay323},
+  {"SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo", "", 6, replay324},
+  {"SteamAPI_ISteamUserStats_GetAchievementAchievedPercent", "", 3, replay325},
+  {"SteamAPI_ISteamUserStats_RequestGlobalStats", "", 2, replay326},
+  {"SteamAPI_ISteamUserStats_GetGlobalStat", "", 3, replay327},
+  {"SteamAPI_ISteamUserStats_GetGlobalStat0", "", 3, replay328},
+  {"SteamAPI_ISteamUserStats_GetGlobalStatHistory", "2:3", 4, replay329},
+  {"SteamAPI_ISteamUserStats_GetGlobalStatHistory0", "2:3", 4, replay330},
+  {"SteamAPI_ISteamApps_BIsSubscribed", "", 1, replay331},
+  {"SteamAPI_ISteamApps_BIsLowViolence", "", 1, replay332},
+  {"SteamAPI_ISteamApps_BIsCybercafe", "", 1, replay333},
+  {"SteamAPI_ISteamApps_BIsVACBanned", "", 1, replay334},
+  {"SteamAPI_ISteamApps_GetCurrentGameLanguage", "", 1, replay335},
+  {"SteamAPI_ISteamApps_GetAvailableGameLanguages", "", 1, replay336},
+  {"SteamAPI_ISteamApps_BIsSubscribedApp", "", 2, replay337},
+  {"SteamAPI_ISteamApps_BIsDlcInstalled", "", 2, replay338},
+  {"SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime", "", 2, replay339},
+  {"SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend", "", 1, replay340},
+  {"SteamAPI_ISteamApps_GetDLCCount", "", 1, replay341},
+  {"SteamAPI_ISteamApps_BGetDLCDataByIndex", "4:5", 6, replay342},
+  {"SteamAPI_ISteamApps_InstallDLC", "", 2, replay343},
+  {"SteamAPI_ISteamApps_UninstallDLC", "", 2, replay344},
+  {"SteamAPI_ISteamApps_RequestAppProofOfPurchaseKey", "", 2, replay345},
+  {"SteamAPI_ISteamApps_GetCurrentBetaName", "1:2", 3, replay346},
+  {"SteamAPI_ISteamApps_MarkContentCorrupt", "", 2, replay347},
+  {"SteamAPI_ISteamApps_GetInstalledDepots", "", 4, replay348},
+  {"SteamAPI_ISteamApps_GetAppInstallDir", "2:3", 4, replay349},
+  {"SteamAPI_ISteamApps_BIsAppInstalled", "", 2, replay350},
+  {"SteamAPI_ISteamApps_GetAppOwner", "", 1, replay351},
+  {"SteamAPI_ISteamApps_GetLaunchQueryParam", "", 2, replay352},
+  {"SteamAPI_ISteamApps_GetDlcDownloadProgress", "", 4, replay353},
+  {"SteamAPI_ISteamApps_GetAppBuildId", "", 1, replay354},
+  {"SteamAPI_ISteamNetworking_SendP2PPacket", "2:3", 6, replay355},
+  {"SteamAPI_ISteamNetworking_IsP2PPacketAvailable", "", 3, replay356},
+  {"SteamAPI_ISteamNetworking_ReadP2PPacket", "1:2", 6, replay357},
+  {"SteamAPI_ISteamNetworking_AcceptP2PSessionWithUser", "", 2, replay358},
+  {"SteamAPI_ISteamNetworking_CloseP2PSessionWithUser", "", 2, replay359},
+  {"SteamAPI_ISteamNetworking_CloseP2PChannelWithUser", "", 3, replay360},
+  {"SteamAPI_ISteamNetworking_GetP2PSessionState", "", 3, replay361},
+  {"SteamAPI_ISteamNetworking_AllowP2PPacketRelay", "", 2, replay362},
+  {"SteamAPI_ISteamNetworking_CreateListenSocket", "", 5, replay363},
+  {"SteamAPI_ISteamNetworking_CreateP2PConnectionSocket", "", 5, replay364},
+  {"SteamAPI_ISteamNetworking_CreateConnectionSocket", "", 4, replay365},
+  {"SteamAPI_ISteamNetworking_DestroySocket", "", 3, replay366},
+  {"SteamAPI_ISteamNetworking_DestroyListenSocket", "", 3, replay367},
+  {"SteamAPI_ISteamNetworking_SendDataOnSocket", "2:3", 5, replay368},
+  {"SteamAPI_ISteamNetworking_IsDataAvailableOnSocket", "", 3, replay369},
+  {"SteamAPI_ISteamNetworking_RetrieveDataFromSocket", "2:3", 5, replay370},
+  {"SteamAPI_ISteamNetworking_IsDataAvailable", "", 4, replay371},
+  {"SteamAPI_ISteamNetworking_RetrieveData", "2:3", 6, replay372},
+  {"SteamAPI_ISteamNetworking_GetSocketInfo", "", 6, replay373},
+  {"SteamAPI_ISteamNetworking_GetListenSocketInfo", "", 4, replay374},
+  {"SteamAPI_ISteamNetworking_GetSocketConnectionType", "", 2, replay375},
+  {"SteamAPI_ISteamNetworking_GetMaxPacketSize", "", 2, replay376},
+  {"SteamAPI_ISteamScreenshots_WriteScreenshot", "1:2", 5, replay377},
+  {"SteamAPI_ISteamScreenshots_AddScreenshotToLibrary", "", 5, replay378},
+  {"SteamAPI_ISteamScreenshots_TriggerScreenshot", "", 1, replay379},
+  {"SteamAPI_ISteamScreenshots_HookScreenshots", "", 2, replay380},
+  {"SteamAPI_ISteamScreenshots_SetLocation", "", 3, replay381},
+  {"SteamAPI_ISteamScreenshots_TagUser", "", 3, replay382},
+  {"SteamAPI_ISteamScreenshots_TagPublishedFile", "", 3, replay383},
+  {"SteamAPI_ISteamMusic_BIsEnabled", "", 1, replay384},
+  {"SteamAPI_ISteamMusic_BIsPlaying", "", 1, replay385},
+  {"SteamAPI_ISteamMusic_GetPlaybackStatus", "", 1, replay386},
+  {"SteamAPI_ISteamMusic_Play", "", 1, replay387},
+  {"SteamAPI_ISteamMusic_Pause", "", 1, replay388},
+  {"SteamAPI_ISteamMusic_PlayPrevious", "", 1, replay389},
+  {"SteamAPI_ISteamMusic_PlayNext", "", 1, replay390},
+  {"SteamAPI_ISteamMusic_SetVolume", "", 2, replay391},
+  {"SteamAPI_ISteamMusic_GetVolume", "", 1, replay392},
+  {"SteamAPI_ISteamMusicRemote_RegisterSteamMusicRemote", "", 2, replay393},
+  {"SteamAPI_ISteamMusicRemote_DeregisterSteamMusicRemote", "", 1, replay394},
+  {"SteamAPI_ISteamMusicRemote_BIsCurrentMusicRemote", "", 1, replay395},
+  {"SteamAPI_ISteamMusicRemote_BActivationSuccess", "", 2, replay396},
+  {"SteamAPI_ISteamMusicRemote_SetDisplayName", "", 2, replay397},
+  {"SteamAPI_ISteamMusicRemote_SetPNGIcon_64x64", "1:2", 3, replay398},
+  {"SteamAPI_ISteamMusicRemote_EnablePlayPrevious", "", 2, replay399},
+  {"SteamAPI_ISteamMusicRemote_EnablePlayNext", "", 2, replay400},
+  {"SteamAPI_ISteamMusicRemote_EnableShuffled", "", 2, replay401},
+  {"SteamAPI_ISteamMusicRemote_EnableLooped", "", 2, replay402},
+  {"SteamAPI_ISteamMusicRemote_EnableQueue", "", 2, replay403},
+  {"SteamAPI_ISteamMusicRemote_EnablePlaylists", "", 2, replay404},
+  {"SteamAPI_ISteamMusicRemote_UpdatePlaybackStatus", "", 2, replay405},
+  {"SteamAPI_ISteamMusicRemote_UpdateShuffled", "", 2, replay406},
+  {"SteamAPI_ISteamMusicRemote_UpdateLooped", "", 2, replay407},
+  {"SteamAPI_ISteamMusicRemote_UpdateVolume", "", 2, replay408},
+  {"SteamAPI_ISteamMusicRemote_CurrentEntryWillChange", "", 1, replay409},
+  {"SteamAPI_ISteamMusicRemote_CurrentEntryIsAvailable", "", 2, replay410},
+  {"SteamAPI_ISteamMusicRemote_UpdateCurrentEntryText", "", 2, replay411},
+  {"SteamAPI_ISteamMusicRemote_UpdateCurrentEntryElapsedSeconds", "", 2, replay412},
+  {"SteamAPI_ISteamMusicRemote_UpdateCurrentEntryCoverArt", "1:2", 3, replay413},
+  {"SteamAPI_ISteamMusicRemote_CurrentEntryDidChange", "", 1, replay414},
+  {"SteamAPI_ISteamMusicRemote_QueueWillChange", "", 1, replay415},
+  {"SteamAPI_ISteamMusicRemote_ResetQueueEntries", "", 1, replay416},
+  {"SteamAPI_ISteamMusicRemote_SetQueueEntry", "", 4, replay417},
+  {"SteamAPI_ISteamMusicRemote_SetCurrentQueueEntry", "", 2, replay418},
+  {"SteamAPI_ISteamMusicRemote_QueueDidChange", "", 1, replay419},
+  {"SteamAPI_ISteamMusicRemote_PlaylistWillChange", "", 1, replay420},
+  {"SteamAPI_ISteamMusicRemote_ResetPlaylistEntries", "", 1, replay421},
+  {"SteamAPI_ISteamMusicRemote_SetPlaylistEntry", "", 4, replay422},
+  {"SteamAPI_ISteamMusicRemote_SetCurrentPlaylistEntry", "", 2, replay423},
+  {"SteamAPI_ISteamMusicRemote_PlaylistDidChange", "", 1, replay424},
+  {"SteamAPI_ISteamHTTP_CreateHTTPRequest", "", 3, replay425},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestContextValue", "", 3, replay426},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestNetworkActivityTimeout", "", 3, replay427},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestHeaderValue", "", 4, replay428},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestGetOrPostParameter", "", 4, replay429},
+  {"SteamAPI_ISteamHTTP_SendHTTPRequest", "", 3, replay430},
+  {"SteamAPI_ISteamHTTP_SendHTTPRequestAndStreamResponse", "", 3, replay431},
+  {"SteamAPI_ISteamHTTP_DeferHTTPRequest", "", 2, replay432},
+  {"SteamAPI_ISteamHTTP_PrioritizeHTTPRequest", "", 2, replay433},
+  {"SteamAPI_ISteamHTTP_GetHTTPResponseHeaderSize", "", 4, replay434},
+  {"SteamAPI_ISteamHTTP_GetHTTPResponseHeaderValue", "3:4", 5, replay435},
+  {"SteamAPI_ISteamHTTP_GetHTTPResponseBodySize", "", 3, replay436},
+  {"SteamAPI_ISteamHTTP_GetHTTPResponseBodyData", "2:3", 4, replay437},
+  {"SteamAPI_ISteamHTTP_GetHTTPStreamingResponseBodyData", "3:4", 5, replay438},
+  {"SteamAPI_ISteamHTTP_ReleaseHTTPRequest", "", 2, replay439},
+  {"SteamAPI_ISteamHTTP_GetHTTPDownloadProgressPct", "", 3, replay440},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestRawPostBody", "", 5, replay441},
+  {"SteamAPI_ISteamHTTP_CreateCookieContainer", "", 2, replay442},
+  {"SteamAPI_ISteamHTTP_ReleaseCookieContainer", "", 2, replay443},
+  {"SteamAPI_ISteamHTTP_SetCookie", "", 5, replay444},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestCookieContainer", "", 3, replay445},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestUserAgentInfo", "", 3, replay446},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestRequiresVerifiedCertificate", "", 3, replay447},
+  {"SteamAPI_ISteamHTTP_SetHTTPRequestAbsoluteTimeoutMS", "", 3, replay448},
+  {"SteamAPI_ISteamHTTP_GetHTTPRequestWasTimedOut", "", 3, replay449},
+  {"SteamAPI_ISteamUnifiedMessages_SendMethod", "2:3", 5, replay450},
+  {"SteamAPI_ISteamUnifiedMessages_GetMethodResponseInfo", "", 4, replay451},
+  {"SteamAPI_ISteamUnifiedMessages_GetMethodResponseData", "2:3", 5, replay452},
+  {"SteamAPI_ISteamUnifiedMessages_ReleaseMethod", "", 2, replay453},
+  {"SteamAPI_ISteamUnifiedMessages_SendNotification", "2:3", 4, replay454},
+  {"SteamAPI_ISteamController_Init", "", 1, replay455},
+  {"SteamAPI_ISteamController_Shutdown", "", 1, replay456},
+  {"SteamAPI_ISteamController_RunFrame", "", 1, replay457},
+  {"SteamAPI_ISteamController_TriggerHapticPulse", "", 4, replay458},
+  {"SteamAPI_ISteamUGC_CreateQueryUserUGCRequest", "", 8, replay459},
+  {"SteamAPI_ISteamUGC_CreateQueryAllUGCRequest", "", 6, replay460},
+  {"SteamAPI_ISteamUGC_CreateQueryUGCDetailsRequest", "", 3, replay461},
+  {"SteamAPI_ISteamUGC_SendQueryUGCRequest", "", 2, replay462},
+  {"SteamAPI_ISteamUGC_GetQueryUGCResult", "", 4, replay463},
+  {"SteamAPI_ISteamUGC_GetQueryUGCPreviewURL", "3:4", 5, replay464},
+  {"SteamAPI_ISteamUGC_GetQueryUGCMetadata", "3:4", 5, replay465},
+  {"SteamAPI_ISteamUGC_GetQueryUGCChildren", "", 5, replay466},
+  {"SteamAPI_ISteamUGC_GetQueryUGCStatistic", "", 5, replay467},
+  {"SteamAPI_ISteamUGC_GetQueryUGCNumAdditionalPreviews", "", 3, replay468},
+  {"SteamAPI_ISteamUGC_GetQueryUGCAdditionalPreview", "4:5 6:7", 9, replay469},
+  {"SteamAPI_ISteamUGC_ReleaseQueryUGCRequest", "", 2, replay470},
+  {"SteamAPI_ISteamUGC_AddRequiredTag", "", 3, replay471},
+  {"SteamAPI_ISteamUGC_AddExcludedTag", "", 3, replay472},
+  {"SteamAPI_ISteamUGC_SetReturnLongDescription", "", 3, replay473},
+  {"SteamAPI_ISteamUGC_SetReturnMetadata", "", 3, replay474},
+  {"SteamAPI_ISteamUGC_SetReturnChildren", "", 3, replay475},
+  {"SteamAPI_ISteamUGC_SetReturnAdditionalPreviews", "", 3, replay476},
+  {"SteamAPI_ISteamUGC_SetReturnTotalOnly", "", 3, replay477},
+  {"SteamAPI_ISteamUGC_SetAllowCachedResponse", "", 3, replay478},
+  {"SteamAPI_ISteamUGC_SetCloudFileNameFilter", "", 3, replay479},
+  {"SteamAPI_ISteamUGC_SetMatchAnyTag", "", 3, replay480},
+  {"SteamAPI_ISteamUGC_SetSearchText", "", 3, replay481},
+  {"SteamAPI_ISteamUGC_SetRankedByTrendDays", "", 3, replay482},
+  {"SteamAPI_ISteamUGC_RequestUGCDetails", "", 3, replay483},
+  {"SteamAPI_ISteamUGC_CreateItem", "", 3, replay484},
+  {"SteamAPI_ISteamUGC_StartItemUpdate", "", 3, replay485},
+  {"SteamAPI_ISteamUGC_SetItemTitle", "", 3, replay486},
+  {"SteamAPI_ISteamUGC_SetItemDescription", "", 3, replay487},
+  {"SteamAPI_ISteamUGC_SetItemMetadata", "", 3, replay488},
+  {"SteamAPI_ISteamUGC_SetItemVisibility", "", 3, replay489},
+  {"SteamAPI_ISteamUGC_SetItemTags", "", 3, replay490},
+  {"SteamAPI_ISteamUGC_SetItemContent", "", 3, replay491},
+  {"SteamAPI_ISteamUGC_SetItemPreview", "", 3, replay492},
+  {"SteamAPI_ISteamUGC_SubmitItemUpdate", "", 3, replay493},
+  {"SteamAPI_ISteamUGC_GetItemUpdateProgress", "", 4, replay494},
+  {"SteamAPI_ISteamUGC_AddItemToFavorites", "", 3, replay495},
+  {"SteamAPI_ISteamUGC_RemoveItemFromFavorites", "", 3, replay496},
+  {"SteamAPI_ISteamUGC_SubscribeItem", "", 2, replay497},
+  {"SteamAPI_ISteamUGC_UnsubscribeItem", "", 2, replay498},
+  {"SteamAPI_ISteamUGC_GetNumSubscribedItems", "", 1, replay499},
+  {"SteamAPI_ISteamUGC_GetSubscribedItems", "", 3, replay500},
+  {"SteamAPI_ISteamUGC_GetItemState", "", 2, replay501},
+  {"SteamAPI_ISteamUGC_GetItemInstallInfo", "3:4", 6, replay502},
+  {"SteamAPI_ISteamUGC_GetItemDownloadInfo", "", 4, replay503},
+  {"SteamAPI_ISteamUGC_DownloadItem", "", 3, replay504},
+  {"SteamAPI_ISteamAppList_GetNumInstalledApps", "", 1, replay505},
+  {"SteamAPI_ISteamAppList_GetInstalledApps", "", 3, replay506},
+  {"SteamAPI_ISteamAppList_GetAppName", "2:3", 4, replay507},
+  {"SteamAPI_ISteamAppList_GetAppInstallDir", "2:3", 4, replay508},
+  {"SteamAPI_ISteamAppList_GetAppBuildId", "", 2, replay509},
+  {"SteamAPI_ISteamHTMLSurface_DestructISteamHTMLSurface", "", 1, replay510},
+  {"SteamAPI_ISteamHTMLSurface_Init", "", 1, replay511},
+  {"SteamAPI_ISteamHTMLSurface_Shutdown", "", 1, replay512},
+  {"SteamAPI_ISteamHTMLSurface_CreateBrowser", "", 3, replay513},
+  {"SteamAPI_ISteamHTMLSurface_RemoveBrowser", "", 2, replay514},
+  {"SteamAPI_ISteamHTMLSurface_LoadURL", "", 4, replay515},
+  {"SteamAPI_ISteamHTMLSurface_SetSize", "", 4, replay516},
+  {"SteamAPI_ISteamHTMLSurface_StopLoad", "", 2, replay517},
+  {"SteamAPI_ISteamHTMLSurface_Reload", "", 2, replay518},
+  {"SteamAPI_ISteamHTMLSurface_GoBack", "", 2, replay519},
+  {"SteamAPI_ISteamHTMLSurface_GoForward", "", 2, replay520},
+  {"SteamAPI_ISteamHTMLSurface_AddHeader", "", 4, replay521},
+  {"SteamAPI_ISteamHTMLSurface_ExecuteJavascript", "", 3, replay522},
+  {"SteamAPI_ISteamHTMLSurface_MouseUp", "", 3, replay523},
+  {"SteamAPI_ISteamHTMLSurface_MouseDown", "", 3, replay524},
+  {"SteamAPI_ISteamHTMLSurface_MouseDoubleClick", "", 3, replay525},
+  {"SteamAPI_ISteamHTMLSurface_MouseMove", "", 4, replay526},
+  {"SteamAPI_ISteamHTMLSurface_MouseWheel", "", 3, replay527},
+  {"SteamAPI_ISteamHTMLSurface_KeyDown", "", 4, replay528},
+  {"SteamAPI_ISteamHTMLSurface_KeyUp", "", 4, replay529},
+  {"SteamAPI_ISteamHTMLSurface_KeyChar", "", 4, replay530},
+  {"SteamAPI_ISteamHTMLSurface_SetHorizontalScroll", "", 3, replay531},
+  {"SteamAPI_ISteamHTMLSurface_SetVerticalScroll", "", 3, replay532},
+  {"SteamAPI_ISteamHTMLSurface_SetKeyFocus", "", 3, replay533},
+  {"SteamAPI_ISteamHTMLSurface_ViewSource", "", 2, replay534},
+  {"SteamAPI_ISteamHTMLSurface_CopyToClipboard", "", 2, replay535},
+  {"SteamAPI_ISteamHTMLSurface_PasteFromClipboard", "", 2, replay536},
+  {"SteamAPI_ISteamHTMLSurface_Find", "", 5, replay537},
+  {"SteamAPI_ISteamHTMLSurface_StopFind", "", 2, replay538},
+  {"SteamAPI_ISteamHTMLSurface_GetLinkAtPosition", "", 4, replay539},
+  {"SteamAPI_ISteamHTMLSurface_SetCookie", "", 8, replay540},
+  {"SteamAPI_ISteamHTMLSurface_SetPageScaleFactor", "", 5, replay541},
+  {"SteamAPI_ISteamHTMLSurface_SetBackgroundMode", "", 3, replay542},
+  {"SteamAPI_ISteamHTMLSurface_AllowStartRequest", "", 3, replay543},
+  {"SteamAPI_ISteamHTMLSurface_JSDialogResponse", "", 3, replay544},
+  {"SteamAPI_ISteamInventory_GetResultStatus", "", 2, replay545},
+  {"SteamAPI_ISteamInventory_GetResultItems", "", 4, replay546},
+  {"SteamAPI_ISteamInventory_GetResultTimestamp", "", 2, replay547},
+  {"SteamAPI_ISteamInventory_CheckResultSteamID", "", 3, replay548},
+  {"SteamAPI_ISteamInventory_DestroyResult", "", 2, replay549},
+  {"SteamAPI_ISteamInventory_GetAllItems", "", 2, replay550},
+  {"SteamAPI_ISteamInventory_GetItemsByID", "", 4, replay551},
+  {"SteamAPI_ISteamInventory_SerializeResult", "", 4, replay552},
+  {"SteamAPI_ISteamInventory_DeserializeResult", "2:3", 5, replay553},
+  {"SteamAPI_ISteamInventory_GenerateItems", "", 5, replay554},
+  {"SteamAPI_ISteamInventory_GrantPromoItems", "", 2, replay555},
+  {"SteamAPI_ISteamInventory_AddPromoItem", "", 3, replay556},
+  {"SteamAPI_ISteamInventory_AddPromoItems", "", 4, replay557},
+  {"SteamAPI_ISteamInventory_ConsumeItem", "", 4, replay558},
+  {"SteamAPI_ISteamInventory_ExchangeItems", "", 8, replay559},
+  {"SteamAPI_ISteamInventory_TransferItemQuantity", "", 5, replay560},
+  {"SteamAPI_ISteamInventory_SendItemDropHeartbeat", "", 1, replay561},
+  {"SteamAPI_ISteamInventory_TriggerItemDrop", "", 3, replay562},
+  {"SteamAPI_ISteamInventory_TradeItems", "", 9, replay563},
+  {"SteamAPI_ISteamInventory_LoadItemDefinitions", "", 1, replay564},
+  {"SteamAPI_ISteamInventory_GetItemDefinitionIDs", "", 3, replay565},
+  {"SteamAPI_ISteamInventory_GetItemDefinitionProperty", "", 5, replay566},
+  {"SteamAPI_ISteamVideo_GetVideoURL", "", 2, replay567},
+  {"SteamAPI_ISteamVideo_IsBroadcasting", "", 2, replay568},
+  {"SteamAPI_ISteamGameServer_InitGameServer", "", 7, replay569},
+  {"SteamAPI_ISteamGameServer_SetProduct", "", 2, replay570},
+  {"SteamAPI_ISteamGameServer_SetGameDescription", "", 2, replay571},
+  {"SteamAPI_ISteamGameServer_SetModDir", "", 2, replay572},
+  {"SteamAPI_ISteamGameServer_SetDedicatedServer", "", 2, replay573},
+  {"SteamAPI_ISteamGameServer_LogOn", "", 2, replay574},
+  {"SteamAPI_ISteamGameServer_LogOnAnonymous", "", 1, replay575},
+  {"SteamAPI_ISteamGameServer_LogOff", "", 1, replay576},
+  {"SteamAPI_ISteamGameServer_BLoggedOn", "", 1, replay577},
+  {"SteamAPI_ISteamGameServer_BSecure", "", 1, replay578},
+  {"SteamAPI_ISteamGameServer_GetSteamID", "", 1, replay579},
+  {"SteamAPI_ISteamGameServer_WasRestartRequested", "", 1, replay580},
+  {"SteamAPI_ISteamGameServer_SetMaxPlayerCount", "", 2, replay581},
+  {"SteamAPI_ISteamGameServer_SetBotPlayerCount", "", 2, replay582},
+  {"SteamAPI_ISteamGameServer_SetServerName", "", 2, replay583},
+  {"SteamAPI_ISteamGameServer_SetMapName", "", 2, replay584},
+  {"SteamAPI_ISteamGameServer_SetPasswordProtected", "", 2, replay585},
+  {"SteamAPI_ISteamGameServer_SetSpectatorPort", "", 2, replay586},
+  {"SteamAPI_ISteamGameServer_SetSpectatorServerName", "", 2, replay587},
+  {"SteamAPI_ISteamGameServer_ClearAllKeyValues", "", 1, replay588},
+  {"SteamAPI_ISteamGameServer_SetKeyValue", "", 3, replay589},
+  {"SteamAPI_ISteamGameServer_SetGameTags", "", 2, replay590},
+  {"SteamAPI_ISteamGameServer_SetGameData", "", 2, replay591},
+  {"SteamAPI_ISteamGameServer_SetRegion", "", 2, replay592},
+  {"SteamAPI_ISteamGameServer_SendUserConnectAndAuthenticate", "2:3", 5, replay593},
+  {"SteamAPI_ISteamGameServer_CreateUnauthenticatedUserConnection", "", 1, replay594},
+  {"SteamAPI_ISteamGameServer_SendUserDisconnect", "", 2, replay595},
+  {"SteamAPI_ISteamGameServer_BUpdateUserData", "", 4, replay596},
+  {"SteamAPI_ISteamGameServer_GetAuthSessionTicket", "1:2", 4, replay597},
+  {"SteamAPI_ISteamGameServer_BeginAuthSession", "1:2", 4, replay598},
+  {"SteamAPI_ISteamGameServer_EndAuthSession", "", 2, replay599},
+  {"SteamAPI_ISteamGameServer_CancelAuthTicket", "", 2, replay600},
+  {"SteamAPI_ISteamGameServer_UserHasLicenseForApp", "", 3, replay601},
+  {"SteamAPI_ISteamGameServer_RequestUserGroupStatus", "", 3, replay602},
+  {"SteamAPI_ISteamGameServer_GetGameplayStats", "", 1, replay603},
+  {"SteamAPI_ISteamGameServer_GetServerReputation", "", 1, replay604},
+  {"SteamAPI_ISteamGameServer_GetPublicIP", "", 1, replay605},
+  {"SteamAPI_ISteamGameServer_HandleIncomingPacket", "1:2", 5, replay606},
+  {"SteamAPI_ISteamGameServer_GetNextOutgoingPacket", "1:2", 5, replay607},
+  {"SteamAPI_ISteamGameServer_EnableHeartbeats", "", 2, replay608},
+  {"SteamAPI_ISteamGameServer_SetHeartbeatInterval", "", 2, replay609},
+  {"SteamAPI_ISteamGameServer_ForceHeartbeat", "", 1, replay610},
+  {"SteamAPI_ISteamGameServer_AssociateWithClan", "", 2, replay611},
+  {"SteamAPI_ISteamGameServer_ComputeNewPlayerCompatibility", "", 2, replay612},
+  {"SteamAPI_ISteamGameServerStats_RequestUserStats", "", 2, replay613},
+  {"SteamAPI_ISteamGameServerStats_GetUserStat", "", 4, replay614},
+  {"SteamAPI_ISteamGameServerStats_GetUserStat0", "", 4, replay615},
+  {"SteamAPI_ISteamGameServerStats_GetUserAchievement", "", 4, replay616},
+  {"SteamAPI_ISteamGameServerStats_SetUserStat", "", 4, replay617},
+  {"SteamAPI_ISteamGameServerStats_SetUserStat0", "", 4, replay618},
+  {"SteamAPI_ISteamGameServerStats_UpdateUserAvgRateStat", "", 5, replay619},
+  {"SteamAPI_ISteamGameServerStats_SetUserAchievement", "", 3, replay620},
+  {"SteamAPI_ISteamGameServerStats_ClearUserAchievement", "", 3, replay621},
+  {"SteamAPI_ISteamGameServerStats_StoreUserStats", "", 2, replay622},
+  {"ISteamAppList::GetNumInstalledApps", "", 1, replay623},
+  {"ISteamAppList::GetInstalledApps", "", 3, replay624},
+  {"ISteamAppList::GetAppName", "2:3", 4, replay625},
+  {"ISteamAppList::GetAppInstallDir", "2:3", 4, replay626},
+  {"ISteamAppList::GetAppBuildId", "", 2, replay627},
+  {"ISteamApps::BIsSubscribed", "", 1, replay628},
+  {"ISteamApps::BIsLowViolence", "", 1, replay629},
+  {"ISteamApps::BIsCybercafe", "", 1, replay630},
+  {"ISteamApps::BIsVACBanned", "", 1, replay631},
+  {"ISteamApps::GetCurrentGameLanguage", "", 1, replay632},
+  {"ISteamApps::GetAvailableGameLanguages", "", 1, replay633},
+  {"ISteamApps::BIsSubscribedApp", "", 2, replay634},
+  {"ISteamApps::BIsDlcInstalled", "", 2, replay635},
+  {"ISteamApps::GetEarliestPurchaseUnixTime", "", 2, replay636},
+  {"ISteamApps::BIsSubscribedFromFreeWeekend", "", 1, replay637},
+  {"ISteamApps::GetDLCCount", "", 1, replay638},
+  {"ISteamApps::BGetDLCDataByIndex", "4:5", 6, replay639},
+  {"ISteamApps::InstallDLC", "", 2, replay640},
+  {"ISteamApps::UninstallDLC", "", 2, replay641},
+  {"ISteamApps::RequestAppProofOfPurchaseKey", "", 2, replay642},
+  {"ISteamApps::GetCurrentBetaName", "1:2", 3, replay643},
+  {"ISteamApps::MarkContentCorrupt", "", 2, replay644},
+  {"ISteamApps::GetInstalledDepots", "", 4, replay645},
+  {"ISteamApps::GetAppInstallDir", "2:3", 4, replay646},
+  {"ISteamApps::BIsAppInstalled", "", 2, replay647},
+  {"ISteamApps::GetAppOwner", "", 1, replay648},
+  {"ISteamApps::GetLaunchQueryParam", "", 2, replay649},
+  {"ISteamApps::GetDlcDownloadProgress", "", 4, replay650},
+  {"ISteamApps::GetAppBuildId", "", 1, replay651},
+  {"ISteamApps::RequestAllProofOfPurchaseKeys", "", 1, replay652},
+  {"ISteamApps::GetFileDetails", "", 2, replay653},
+  {"ISteamAppTicket::GetAppOwnershipTicketData", "2:3", 8, replay654},
+  {"ISteamClient::CreateSteamPipe", "", 1, replay655},
+  {"ISteamClient::BReleaseSteamPipe", "", 2, replay656},
+  {"ISteamClient::ConnectToGlobalUser", "", 2, replay657},
+  {"ISteamClient::CreateLocalUser", "", 3, replay658},
+  {"ISteamClient::ReleaseUser", "", 3, replay659},
+  {"ISteamClient::GetISteamUser", "", 4, replay660},
+  {"ISteamClient::GetISteamGameServer", "", 4, replay661},
+  {"ISteamClient::SetLocalIPBinding", "", 3, replay662},
+  {"ISteamClient::GetISteamFriends", "", 4, replay663},
+  {"ISteamClient::GetISteamUtils", "", 3, replay664},
+  {"ISteamClient::GetISteamMatchmaking", "", 4, replay665},
+  {"ISteamClient::GetISteamMatchmakingServers", "", 4, replay666},
+  {"ISteamClient::GetISteamGenericInterface", "", 4, replay667},
+  {"ISteamClient::GetISteamUserStats", "", 4, replay668},
+  {"ISteamClient::GetISteamGameServerStats", "", 4, replay669},
+  {"ISteamClient::GetISteamApps", "", 4, replay670},
+  {"ISteamClient::GetISteamNetworking", "", 4, replay671},
+  {"ISteamClient::GetISteamRemoteStorage", "", 4, replay672},
+  {"ISteamClient::GetISteamScreenshots", "", 4, replay673},
+  {"ISteamClient::GetIPCCallCount", "", 1, replay674},
+  {"ISteamClient::SetWarningMessageHook", "", 2, replay675},
+  {"ISteamClient::BShutdownIfAllPipesClosed", "", 1, replay676},
+  {"ISteamClient::GetISteamHTTP", "", 4, replay677},
+  {"ISteamClient::GetISteamUnifiedMessages", "", 4, replay678},
+  {"ISteamClient::GetISteamController", "", 4, replay679},
+  {"ISteamClient::GetISteamUGC", "", 4, replay680},
+  {"ISteamClient::GetISteamAppList", "", 4, replay681},
+  {"ISteamClient::GetISteamMusic", "", 4, replay682},
+  {"ISteamClient::GetISteamMusicRemote", "", 4, replay683},
+  {"ISteamClient::GetISteamHTMLSurface", "", 4, replay684},
+  {"ISteamClient::GetISteamInventory", "", 4, replay685},
+  {"ISteamClient::GetISteamVideo", "", 4, replay686},
+  {"ISteamController::Init", "", 1, replay687},
+  {"ISteamController::Shutdown", "", 1, replay688},
+  {"ISteamController::RunFrame", "", 1, replay689},
+  {"ISteamController::GetConnectedControllers", "", 2, replay690},
+  {"ISteamController::ShowBindingPanel", "", 2, replay691},
+  {"ISteamController::GetActionSetHandle", "", 2, replay692},
+  {"ISteamController::ActivateActionSet", "", 3, replay693},
+  {"ISteamController::GetCurrentActionSet", "", 2, replay694},
+  {"ISteamController::GetDigitalActionHandle", "", 2, replay695},
+  {"ISteamController::GetDigitalActionData", "", 3, replay696},
+  {"ISteamController::GetDigitalActionOrigins", "", 5, replay697},
+  {"ISteamController::GetAnalogActionHandle", "", 2, replay698},
+  {"ISteamController::GetAnalogActionData", "", 3, replay699},
+  {"ISteamController::GetAnalogActionOrigins", "", 5, replay700},
+  {"ISteamController::StopAnalogActionMomentum", "", 3, replay701},
+  {"ISteamController::TriggerHapticPulse", "", 4, replay702},
+  {"ISteamController::TriggerRepeatedHapticPulse", "", 7, replay703},
+  {"ISteamController::TriggerVibration", "", 4, replay704},
+  {"ISteamController::SetLEDColor", "", 6, replay705},
+  {"ISteamController::GetGamepadIndexForController", "", 2, replay706},
+  {"ISteamController::GetControllerForGamepadIndex", "", 2, replay707},
+  {"ISteamController::GetMotionData", "", 2, replay708},
+  {"ISteamController::ShowDigitalActionOrigins", "", 6, replay709},
+  {"ISteamController::ShowAnalogActionOrigins", "", 6, replay710},
+  {"ISteamController::GetStringForActionOrigin", "", 2, replay711},
+  {"ISteamController::GetGlyphForActionOrigin", "", 2, replay712},
+  {"ISteamFriends::GetPersonaName", "", 1, replay713},
+  {"ISteamFriends::SetPersonaName", "", 2, replay714},
+  {"ISteamFriends::GetPersonaState", "", 1, replay715},
+  {"ISteamFriends::GetFriendCount", "", 2, replay716},
+  {"ISteamFriends::GetFriendByIndex", "", 3, replay717},
+  {"ISteamFriends::GetFriendRelationship", "", 2, replay718},
+  {"ISteamFriends::GetFriendPersonaState", "", 2, replay719},
+  {"ISteamFriends::GetFriendPersonaName", "", 2, replay720},
+  {"ISteamFriends::GetFriendGamePlayed", "", 3, replay721},
+  {"ISteamFriends::GetFriendPersonaNameHistory", "", 3, replay722},
+  {"ISteamFriends::GetFriendSteamLevel", "", 2, replay723},
+  {"ISteamFriends::GetPlayerNickname", "", 2, replay724},
+  {"ISteamFriends::GetFriendsGroupCount", "", 1, replay725},
+  {"ISteamFriends::GetFriendsGroupIDByIndex", "", 2, replay726},
+  {"ISteamFriends::GetFriendsGroupName", "", 2, replay727},
+  {"ISteamFriends::GetFriendsGroupMembersCount", "", 2, replay728},
+  {"ISteamFriends::GetFriendsGroupMembersList", "", 4, replay729},
+  {"ISteamFriends::HasFriend", "", 3, replay730},
+  {"ISteamFriends::GetClanCount", "", 1, replay731},
+  {"ISteamFriends::GetClanByIndex", "", 2, replay732},
+  {"ISteamFriends::GetClanName", "", 2, replay733},
+  {"ISteamFriends::GetClanTag", "", 2, replay734},
+  {"ISteamFriends::GetClanActivityCounts", "", 5, replay735},
+  {"ISteamFriends::DownloadClanActivityCounts", "", 3, replay736},
+  {"ISteamFriends::GetFriendCountFromSource", "", 2, replay737},
+  {"ISteamFriends::GetFriendFromSourceByIndex", "", 3, replay738},
+  {"ISteamFriends::IsUserInSource", "", 3, replay739},
+  {"ISteamFriends::SetInGameVoiceSpeaking", "", 3, replay740},
+  {"ISteamFriends::ActivateGameOverlay", "", 2, replay741},
+  {"ISteamFriends::ActivateGameOverlayToUser", "", 3, replay742},
+  {"ISteamFriends::ActivateGameOverlayToWebPage", "", 2, replay743},
+  {"ISteamFriends::ActivateGameOverlayToStore", "", 3, replay744},
+  {"ISteamFriends::SetPlayedWith", "", 2, replay745},
+  {"ISteamFriends::ActivateGameOverlayInviteDialog", "", 2, replay746},
+  {"ISteamFriends::GetSmallFriendAvatar", "", 2, replay747},
+  {"ISteamFriends::GetMediumFriendAvatar", "", 2, replay748},
+  {"ISteamFriends::GetLargeFriendAvatar", "", 2, replay749},
+  {"ISteamFriends::RequestUserInformation", "", 3, replay750},
+  {"ISteamFriends::RequestClanOfficerList", "", 2, replay751},
+  {"ISteamFriends::GetClanOwner", "", 2, replay752},
+  {"ISteamFriends::GetClanOfficerCount", "", 2, replay753},
+  {"ISteamFriends::GetClanOfficerByIndex", "", 3, replay754},
+  {"ISteamFriends::GetUserRestrictions", "", 1, replay755},
+  {"ISteamFriends::SetRichPresence", "", 3, replay756},
+  {"ISteamFriends::ClearRichPresence", "", 1, replay757},
+  {"ISteamFriends::GetFriendRichPresence", "", 3, replay758},
+  {"ISteamFriends::GetFriendRichPresenceKeyCount", "", 2, replay759},
+  {"ISteamFriends::GetFriendRichPresenceKeyByIndex", "", 3, replay760},
+  {"ISteamFriends::RequestFriendRichPresence", "", 2, replay761},
+  {"ISteamFriends::InviteUserToGame", "", 3, replay762},
+  {"ISteamFriends::GetCoplayFriendCount", "", 1, replay763},
+  {"ISteamFriends::GetCoplayFriend", "", 2, replay764},
+  {"ISteamFriends::GetFriendCoplayTime", "", 2, replay765},
+  {"ISteamFriends::GetFriendCoplayGame", "", 2, replay766},
+  {"ISteamFriends::JoinClanChatRoom", "", 2, replay767},
+  {"ISteamFriends::LeaveClanChatRoom", "", 2, replay768},
+  {"ISteamFriends::GetClanChatMemberCount", "", 2, replay769},
+  {"ISteamFriends::GetChatMemberByIndex", "", 3, replay770},
+  {"ISteamFriends::SendClanChatMessage", "", 3, replay771},
+  {"ISteamFriends::GetClanChatMessage", "3:4", 7, replay772},
+  {"ISteamFriends::IsClanChatAdmin", "", 3, replay773},
+  {"ISteamFriends::IsClanChatWindowOpenInSteam", "", 2, replay774},
+  {"ISteamFriends::OpenClanChatWindowInSteam", "", 2, replay775},
+  {"ISteamFriends::CloseClanChatWindowInSteam", "", 2, replay776},
+  {"ISteamFriends::SetListenForFriendsMessages", "", 2, replay777},
+  {"ISteamFriends::ReplyToFriendMessage", "", 3, replay778},
+  {"ISteamFriends::GetFriendMessage", "3:4", 6, replay779},
+  {"ISteamFriends::GetFollowerCount", "", 2, replay780},
+  {"ISteamFriends::IsFollowing", "", 2, replay781},
+  {"ISteamFriends::EnumerateFollowingList", "", 2, replay782},
+  {"ISteamGameCoordinator::SendMessage", "2:3", 4, replay783},
+  {"ISteamGameCoordinator::IsMessageAvailable", "", 2, replay784},
+  {"ISteamGameCoordinator::RetrieveMessage", "2:3", 5, replay785},
+  {"ISteamGameServer::InitGameServer", "", 7, replay786},
+  {"ISteamGameServer::SetProduct", "", 2, replay787},
+  {"ISteamGameServer::SetGameDescription", "", 2, replay788},
+  {"ISteamGameServer::SetModDir", "", 2, replay789},
+  {"ISteamGameServer::SetDedicatedServer", "", 2, replay790},
+  {"ISteamGameServer::LogOn", "", 2, replay791},
+  {"ISteamGameServer::LogOnAnonymous", "", 1, replay792},
+  {"ISteamGameServer::LogOff", "", 1, replay793},
+  {"ISteamGameServer::BLoggedOn", "", 1, replay794},
+  {"ISteamGameServer::BSecure", "", 1, replay795},
+  {"ISteamGameServer::GetSteamID", "", 1, replay796},
+  {"ISteamGameServer::WasRestartRequested", "", 1, replay797},
+  {"ISteamGameServer::SetMaxPlayerCount", "", 2, replay798},
+  {"ISteamGameServer::SetBotPlayerCount", "", 2, replay799},
+  {"ISteamGameServer::SetServerName", "", 2, replay800},
+  {"ISteamGameServer::SetMapName", "", 2, replay801},
+  {"ISteamGameServer::SetPasswordProtected", "", 2, replay802},
+  {"ISteamGameServer::SetSpectatorPort", "", 2, replay803},
+  {"ISteamGameServer::SetSpectatorServerName", "", 2, replay804},
+  {"ISteamGameServer::ClearAllKeyValues", "", 1, replay805},
+  {"ISteamGameServer::SetKeyValue", "", 3, replay806},
+  {"ISteamGameServer::SetGameTags", "", 2, replay807},
+  {"ISteamGameServer::SetGameData", "", 2, replay808},
+  {"ISteamGameServer::SetRegion", "", 2, replay809},
+  {"ISteamGameServer::SendUserConnectAndAuthenticate", "2:3", 5, replay810},
+  {"ISteamGameServer::CreateUnauthenticatedUserConnection", "", 1, replay811},
+  {"ISteamGameServer::SendUserDisconnect", "", 2, replay812},
+  {"ISteamGameServer::BUpdateUserData", "", 4, replay813},
+  {"ISteamGameServer::GetAuthSessionTicket", "1:2", 4, replay814},
+  {"ISteamGameServer::BeginAuthSession", "1:2", 4, replay815},
+  {"ISteamGameServer::EndAuthSession", "", 2, replay816},
+  {"ISteamGameServer::CancelAuthTicket", "", 2, replay817},
+  {"ISteamGameServer::UserHasLicenseForApp", "", 3, replay818},
+  {"ISteamGameServer::RequestUserGroupStatus", "", 3, replay819},
+  {"ISteamGameServer::GetGameplayStats", "", 1, replay820},
+  {"ISteamGameServer::GetServerReputation", "", 1, replay821},
+  {"ISteamGameServer::GetPublicIP", "", 1, replay822},
+  {"ISteamGameServer::HandleIncomingPacket", "1:2", 5, replay823},
+  {"ISteamGameServer::GetNextOutgoingPacket", "1:2", 5, replay824},
+  {"ISteamGameServer::EnableHeartbeats", "", 2, replay825},
+  {"ISteamGameServer::SetHeartbeatInterval", "", 2, replay826},
+  {"ISteamGameServer::ForceHeartbeat", "", 1, replay827},
+  {"ISteamGameServer::AssociateWithClan", "", 2, replay828},
+  {"ISteamGameServer::ComputeNewPlayerCompatibility", "", 2, replay829},
+  {"ISteamGameServerStats::RequestUserStats", "", 2, replay830},
+  {"ISteamGameServerStats::GetUserStat", "", 4, replay831},
+  {"ISteamGameServerStats::GetUserStat", "", 4, replay832},
+  {"ISteamGameServerStats::GetUserAchievement", "", 4, replay833},
+  {"ISteamGameServerStats::SetUserStat", "", 4, replay834},
+  {"ISteamGameServerStats::SetUserStat", "", 4, replay835},
+  {"ISteamGameServerStats::UpdateUserAvgRateStat", "", 5, replay836},
+  {"ISteamGameServerStats::SetUserAchievement", "", 3, replay837},
+  {"ISteamGameServerStats::ClearUserAchievement", "", 3, replay838},
+  {"ISteamGameServerStats::StoreUserStats", "", 2, replay839},
+  {"ISteamHTMLSurface::Init", "", 1, replay840},
+  {"ISteamHTMLSurface::Shutdown", "", 1, replay841},
+  {"ISteamHTMLSurface::CreateBrowser", "", 3, replay842},
+  {"ISteamHTMLSurface::RemoveBrowser", "", 2, replay843},
+  {"ISteamHTMLSurface::LoadURL", "", 4, replay844},
+  {"ISteamHTMLSurface::SetSize", "", 4, replay845},
+  {"ISteamHTMLSurface::StopLoad", "", 2, replay846},
+  {"ISteamHTMLSurface::Reload", "", 2, replay847},
+  {"ISteamHTMLSurface::GoBack", "", 2, replay848},
+  {"ISteamHTMLSurface::GoForward", "", 2, replay849},
+  {"ISteamHTMLSurface::AddHeader", "", 4, replay850},
+  {"ISteamHTMLSurface::ExecuteJavascript", "", 3, replay851},
+  {"ISteamHTMLSurface::MouseUp", "", 3, replay852},
+  {"ISteamHTMLSurface::MouseDown", "", 3, replay853},
+  {"ISteamHTMLSurface::MouseDoubleClick", "", 3, replay854},
+  {"ISteamHTMLSurface::MouseMove", "", 4, replay855},
+  {"ISteamHTMLSurface::MouseWheel", "", 3, replay856},
+  {"ISteamHTMLSurface::KeyDown", "", 4, replay857},
+  {"ISteamHTMLSurface::KeyUp", "", 4, replay858},
+  {"ISteamHTMLSurface::KeyChar", "", 4, replay859},
+  {"ISteamHTMLSurface::SetHorizontalScroll", "", 3, replay860},
+  {"ISteamHTMLSurface::SetVerticalScroll", "", 3, replay861},
+  {"ISteamHTMLSurface::SetKeyFocus", "", 3, replay862},
+  {"ISteamHTMLSurface::ViewSource", "", 2, replay863},
+  {"ISteamHTMLSurface::CopyToClipboard", "", 2, replay864},
+  {"ISteamHTMLSurface::PasteFromClipboard", "", 2, replay865},
+  {"ISteamHTMLSurface::Find", "", 5, replay866},
+  {"ISteamHTMLSurface::StopFind", "", 2, replay867},
+  {"ISteamHTMLSurface::GetLinkAtPosition", "", 4, replay868},
+  {"ISteamHTMLSurface::SetCookie", "", 5, replay869},
+  {"ISteamHTMLSurface::SetPageScaleFactor", "", 5, replay870},
+  {"ISteamHTMLSurface::SetBackgroundMode", "", 3, replay871},
+  {"ISteamHTMLSurface::AllowStartRequest", "", 3, replay872},
+  {"ISteamHTMLSurface::JSDialogResponse", "", 3, replay873},
+  {"ISteamHTMLSurface::FileLoadDialogResponse", "", 3, replay874},
+  {"ISteamHTTP::CreateHTTPRequest", "", 3, replay875},
+  {"ISteamHTTP::SetHTTPRequestContextValue", "", 3, replay876},
+  {"ISteamHTTP::SetHTTPRequestNetworkActivityTimeout", "", 3, replay877},
+  {"ISteamHTTP::SetHTTPRequestHeaderValue", "", 4, replay878},
+  {"ISteamHTTP::SetHTTPRequestGetOrPostParameter", "", 4, replay879},
+  {"ISteamHTTP::SendHTTPRequest", "", 3, replay880},
+  {"ISteamHTTP::SendHTTPRequestAndStreamResponse", "", 3, replay881},
+  {"ISteamHTTP::DeferHTTPRequest", "", 2, replay882},
+  {"ISteamHTTP::PrioritizeHTTPRequest", "", 2, replay883},
+  {"ISteamHTTP::GetHTTPResponseHeaderSize", "", 4, replay884},
+  {"ISteamHTTP::GetHTTPResponseHeaderValue", "3:4", 5, replay885},
+  {"ISteamHTTP::GetHTTPResponseBodySize", "", 3, replay886},
+  {"ISteamHTTP::GetHTTPResponseBodyData", "2:3", 4, replay887},
+  {"ISteamHTTP::GetHTTPStreamingResponseBodyData", "3:4", 5, replay888},
+  {"ISteamHTTP::ReleaseHTTPRequest", "", 2, replay889},
+  {"ISteamHTTP::GetHTTPDownloadProgressPct", "", 3, replay890},
+  {"ISteamHTTP::SetHTTPRequestRawPostBody", "", 5, replay891},
+  {"ISteamHTTP::CreateCookieContainer", "", 2, replay892},
+  {"ISteamHTTP::ReleaseCookieContainer", "", 2, replay893},
+  {"ISteamHTTP::SetCookie", "", 5, replay894},
+  {"ISteamHTTP::SetHTTPRequestCookieContainer", "", 3, replay895},
+  {"ISteamHTTP::SetHTTPRequestUserAgentInfo", "", 3, replay896},
+  {"ISteamHTTP::SetHTTPRequestRequiresVerifiedCertificate", "", 3, replay897},
+  {"ISteamHTTP::SetHTTPRequestAbsoluteTimeoutMS", "", 3, replay898},
+  {"ISteamHTTP::GetHTTPRequestWasTimedOut", "", 3, replay899},
+  {"ISteamInventory::GetResultStatus", "", 2, replay900},
+  {"ISteamInventory::GetResultItems", "", 4, replay901},
+  {"ISteamInventory::GetResultTimestamp", "", 2, replay902},
+  {"ISteamInventory::CheckResultSteamID", "", 3, replay903},
+  {"ISteamInventory::DestroyResult", "", 2, replay904},
+  {"ISteamInventory::GetAllItems", "", 2, replay905},
+  {"ISteamInventory::GetItemsByID", "", 4, replay906},
+  {"ISteamInventory::SerializeResult", "", 4, replay907},
+  {"ISteamInventory::DeserializeResult", "2:3", 5, replay908},
+  {"ISteamInventory::GenerateItems", "", 5, replay909},
+  {"ISteamInventory::GrantPromoItems", "", 2, replay910},
+  {"ISteamInventory::AddPromoItem", "", 3, replay911},
+  {"ISteamInventory::AddPromoItems", "", 4, replay912},
+  {"ISteamInventory::ConsumeItem", "", 4, replay913},
+  {"ISteamInventory::ExchangeItems", "", 8, replay914},
+  {"ISteamInventory::TransferItemQuantity", "", 5, replay915},
+  {"ISteamInventory::SendItemDropHeartbeat", "", 1, replay916},
+  {"ISteamInventory::TriggerItemDrop", "", 3, replay917},
+  {"ISteamInventory::TradeItems", "", 9, replay918},
+  {"ISteamInventory::LoadItemDefinitions", "", 1, replay919},
+  {"ISteamInventory::GetItemDefinitionIDs", "", 3, replay920},
+  {"ISteamInventory::GetItemDefinitionProperty", "", 5, replay921},
+  {"ISteamInventory::RequestEligiblePromoItemDefinitionsIDs", "", 2, replay922},
+  {"ISteamInventory::GetEligiblePromoItemDefinitionIDs", "", 4, replay923},
+  {"ISteamMatchmaking::GetFavoriteGameCount", "", 1, replay924},
+  {"ISteamMatchmaking::GetFavoriteGame", "", 8, replay925},
+  {"ISteamMatchmaking::AddFavoriteGame", "", 7, replay926},
+  {"ISteamMatchmaking::RemoveFavoriteGame", "", 6, replay927},
+  {"ISteamMatchmaking::RequestLobbyList", "", 1, replay928},
+  {"ISteamMatchmaking::AddRequestLobbyListStringFilter", "", 4, replay929},
+  {"ISteamMatchmaking::AddRequestLobbyListNumericalFilter", "", 4, replay930},
+  {"ISteamMatchmaking::AddRequestLobbyListNearValueFilter", "", 3, replay931},
+  {"ISteamMatchmaking::AddRequestLobbyListFilterSlotsAvailable", "", 2, replay932},
+  {"ISteamMatchmaking::AddRequestLobbyListDistanceFilter", "", 2, replay933},
+  {"ISteamMatchmaking::AddRequestLobbyListResultCountFilter", "", 2, replay934},
+  {"ISteamMatchmaking::AddRequestLobbyListCompatibleMembersFilter", "", 2, replay935},
+  {"ISteamMatchmaking::GetLobbyByIndex", "", 2, replay936},
+  {"ISteamMatchmaking::CreateLobby", "", 3, replay937},
+  {"ISteamMatchmaking::JoinLobby", "", 2, replay938},
+  {"ISteamMatchmaking::LeaveLobby", "", 2, replay939},
+  {"ISteamMatchmaking::InviteUserToLobby", "", 3, replay940},
+  {"ISteamMatchmaking::GetNumLobbyMembers", "", 2, replay941},
+  {"ISteamMatchmaking::GetLobbyMemberByIndex", "", 3, replay942},
+  {"ISteamMatchmaking::GetLobbyData", "", 3, replay943},
+  {"ISteamMatchmaking::SetLobbyData", "", 4, replay944},
+  {"ISteamMatchmaking::GetLobbyDataCount", "", 2, replay945},
+  {"ISteamMatchmaking::GetLobbyDataByIndex", "3:4 5:6", 7, replay946},
+  {"ISteamMatchmaking::DeleteLobbyData", "", 3, replay947},
+  {"ISteamMatchmaking::GetLobbyMemberData", "", 4, replay948},
+  {"ISteamMatchmaking::SetLobbyMemberData", "", 4, replay949},
+  {"ISteamMatchmaking::SendLobbyChatMsg", "2:3", 4, replay950},
+  {"ISteamMatchmaking::GetLobbyChatEntry", "4:5", 7, replay951},
+  {"ISteamMatchmaking::RequestLobbyData", "", 2, replay952},
+  {"ISteamMatchmaking::SetLobbyGameServer", "", 5, replay953},
+  {"ISteamMatchmaking::GetLobbyGameServer", "", 5, replay954},
+  {"ISteamMatchmaking::SetLobbyMemberLimit", "", 3, replay955},
+  {"ISteamMatchmaking::GetLobbyMemberLimit", "", 2, replay956},
+  {"ISteamMatchmaking::SetLobbyType", "", 3, replay957},
+  {"ISteamMatchmaking::SetLobbyJoinable", "", 3, replay958},
+  {"ISteamMatchmaking::GetLobbyOwner", "", 2, replay959},
+  {"ISteamMatchmaking::SetLobbyOwner", "", 3, replay960},
+  {"ISteamMatchmaking::SetLinkedLobby", "", 3, replay961},
+  {"ISteamMatchmakingServerListResponse::ServerResponded", "", 3, replay962},
+  {"ISteamMatchmakingServerListResponse::ServerFailedToRespond", "", 3, replay963},
+  {"ISteamMatchmakingServerListResponse::RefreshComplete", "", 3, replay964},
+  {"ISteamMatchmakingPingResponse::ServerResponded", "", 2, replay965},
+  {"ISteamMatchmakingPingResponse::ServerFailedToRespond", "", 1, replay966},
+  {"ISteamMatchmakingPlayersResponse::AddPlayerToList", "", 4, replay967},
+  {"ISteamMatchmakingPlayersResponse::PlayersFailedToRespond", "", 1, replay968},
+  {"ISteamMatchmakingPlayersResponse::PlayersRefreshComplete", "", 1, replay969},
+  {"ISteamMatchmakingRulesResponse::RulesResponded", "", 3, replay970},
+  {"ISteamMatchmakingRulesResponse::RulesFailedToRespond", "", 1, replay971},
+  {"ISteamMatchmakingRulesResponse::RulesRefreshComplete", "", 1, replay972},
+  {"ISteamMatchmakingServers::RequestInternetServerList", "", 5, replay973},
+  {"ISteamMatchmakingServers::RequestLANServerList", "", 3, replay974},
+  {"ISteamMatchmakingServers::RequestFriendsServerList", "", 5, replay975},
+  {"ISteamMatchmakingServers::RequestFavoritesServerList", "", 5, replay976},
+  {"ISteamMatchmakingServers::RequestHistoryServerList", "", 5, replay977},
+  {"ISteamMatchmakingServers::RequestSpectatorServerList", "", 5, replay978},
+  {"ISteamMatchmakingServers::ReleaseRequest", "", 2, replay979},
+  {"ISteamMatchmakingServers::GetServerDetails", "", 3, replay980},
+  {"ISteamMatchmakingServers::CancelQuery", "", 2, replay981},
+  {"ISteamMatchmakingServers::RefreshQuery", "", 2, replay982},
+  {"ISteamMatchmakingServers::IsRefreshing", "", 2, replay983},
+  {"ISteamMatchmakingServers::GetServerCount", "", 2, replay984},
+  {"ISteamMatchmakingServers::RefreshServer", "", 3, replay985},
+  {"ISteamMatchmakingServers::PingServer", "", 4, replay986},
+  {"ISteamMatchmakingServers::PlayerDetails", "", 4, replay987},
+  {"ISteamMatchmakingServers::ServerRules", "", 4, replay988},
+  {"ISteamMatchmakingServers::CancelServerQuery", "", 2, replay989},
+  {"ISteamMusic::BIsEnabled", "", 1, replay990},
+  {"ISteamMusic::BIsPlaying", "", 1, replay991},
+  {"ISteamMusic::GetPlaybackStatus", "", 1, replay992},
+  {"ISteamMusic::Play", "", 1, replay993},
+  {"ISteamMusic::Pause", "", 1, replay994},
+  {"ISteamMusic::PlayPrevious", "", 1, replay995},
+  {"ISteamMusic::PlayNext", "", 1, replay996},
+  {"ISteamMusic::SetVolume", "", 2, replay997},
+  {"ISteamMusic::GetVolume", "", 1, replay998},
+  {"ISteamMusicRemote::RegisterSteamMusicRemote", "", 2, replay999},
+  {"ISteamMusicRemote::DeregisterSteamMusicRemote", "", 1, replay1000},
+  {"ISteamMusicRemote::BIsCurrentMusicRemote", "", 1, replay1001},
+  {"ISteamMusicRemote::BActivationSuccess", "", 2, replay1002},
+  {"ISteamMusicRemote::SetDisplayName", "", 2, replay1003},
+  {"ISteamMusicRemote::SetPNGIcon_64x64", "1:2", 3, replay1004},
+  {"ISteamMusicRemote::EnablePlayPrevious", "", 2, replay1005},
+  {"ISteamMusicRemote::EnablePlayNext", "", 2, replay1006},
+  {"ISteamMusicRemote::EnableShuffled", "", 2, replay1007},
+  {"ISteamMusicRemote::EnableLooped", "", 2, replay1008},
+  {"ISteamMusicRemote::EnableQueue", "", 2, replay1009},
+  {"ISteamMusicRemote::EnablePlaylists", "", 2, replay1010},
+  {"ISteamMusicRemote::UpdatePlaybackStatus", "", 2, replay1011},
+  {"ISteamMusicRemote::UpdateShuffled", "", 2, replay1012},
+  {"ISteamMusicRemote::UpdateLooped", "", 2, replay1013},
+  {"ISteamMusicRemote::UpdateVolume", "", 2, replay1014},
+  {"ISteamMusicRemote::CurrentEntryWillChange", "", 1, replay1015},
+  {"ISteamMusicRemote::CurrentEntryIsAvailable", "", 2, replay1016},
+  {"ISteamMusicRemote::UpdateCurrentEntryText", "", 2, replay1017},
+  {"ISteamMusicRemote::UpdateCurrentEntryElapsedSeconds", "", 2, replay1018},
+  {"ISteamMusicRemote::UpdateCurrentEntryCoverArt", "1:2", 3, replay1019},
+  {"ISteamMusicRemote::CurrentEntryDidChange", "", 1, replay1020},
+  {"ISteamMusicRemote::QueueWillChange", "", 1, replay1021},
+  {"ISteamMusicRemote::ResetQueueEntries", "", 1, replay1022},
+  {"ISteamMusicRemote::SetQueueEntry", "", 4, replay1023},
+  {"ISteamMusicRemote::SetCurrentQueueEntry", "", 2, replay1024},
+  {"ISteamMusicRemote::QueueDidChange", "", 1, replay1025},
+  {"ISteamMusicRemote::PlaylistWillChange", "", 1, replay1026},
+  {"ISteamMusicRemote::ResetPlaylistEntries", "", 1, replay1027},
+  {"ISteamMusicRemote::SetPlaylistEntry", "", 4, replay1028},
+  {"ISteamMusicRemote::SetCurrentPlaylistEntry", "", 2, replay1029},
+  {"ISteamMusicRemote::PlaylistDidChange", "", 1, replay1030},
+  {"ISteamNetworking::SendP2PPacket", "2:3", 6, replay1031},
+  {"ISteamNetworking::IsP2PPacketAvailable", "", 3, replay1032},
+  {"ISteamNetworking::ReadP2PPacket", "1:2", 6, replay1033},
+  {"ISteamNetworking::AcceptP2PSessionWithUser", "", 2, replay1034},
+  {"ISteamNetworking::CloseP2PSessionWithUser", "", 2, replay1035},
+  {"ISteamNetworking::CloseP2PChannelWithUser", "", 3, replay1036},
+  {"ISteamNetworking::GetP2PSessionState", "", 3, replay1037},
+  {"ISteamNetworking::AllowP2PPacketRelay", "", 2, replay1038},
+  {"ISteamNetworking::CreateListenSocket", "", 5, replay1039},
+  {"ISteamNetworking::CreateP2PConnectionSocket", "", 5, replay1040},
+  {"ISteamNetworking::CreateConnectionSocket", "", 4, replay1041},
+  {"ISteamNetworking::DestroySocket", "", 3, replay1042},
+  {"ISteamNetworking::DestroyListenSocket", "", 3, replay1043},
+  {"ISteamNetworking::SendDataOnSocket", "2:3", 5, replay1044},
+  {"ISteamNetworking::IsDataAvailableOnSocket", "", 3, replay1045},
+  {"ISteamNetworking::RetrieveDataFromSocket", "2:3", 5, replay1046},
+  {"ISteamNetworking::IsDataAvailable", "", 4, replay1047},
+  {"ISteamNetworking::RetrieveData", "2:3", 6, replay1048},
+  {"ISteamNetworking::GetSocketInfo", "", 6, replay1049},
+  {"ISteamNetworking::GetListenSocketInfo", "", 4, replay1050},
+  {"ISteamNetworking::GetSocketConnectionType", "", 2, replay1051},
+  {"ISteamNetworking::GetMaxPacketSize", "", 2, replay1052},
+  {"ISteamRemoteStorage::FileWrite", "2:3", 4, replay1053},
+  {"ISteamRemoteStorage::FileRead", "2:3", 4, replay1054},
+  {"ISteamRemoteStorage::FileWriteAsync", "2:3", 4, replay1055},
+  {"ISteamRemoteStorage::FileReadAsync", "", 4, replay1056},
+  {"ISteamRemoteStorage::FileReadAsyncComplete", "2:3", 4, replay1057},
+  {"ISteamRemoteStorage::FileForget", "", 2, replay1058},
+  {"ISteamRemoteStorage::FileDelete", "", 2, replay1059},
+  {"ISteamRemoteStorage::FileShare", "", 2, replay1060},
+  {"ISteamRemoteStorage::SetSyncPlatforms", "", 3, replay1061},
+  {"ISteamRemoteStorage::FileWriteStreamOpen", "", 2, replay1062},
+  {"ISteamRemoteStorage::FileWriteStreamWriteChunk", "2:3", 4, replay1063},
+  {"ISteamRemoteStorage::FileWriteStreamClose", "", 2, replay1064},
+  {"ISteamRemoteStorage::FileWriteStreamCancel", "", 2, replay1065},
+  {"ISteamRemoteStorage::FileExists", "", 2, replay1066},
+  {"ISteamRemoteStorage::FilePersisted", "", 2, replay1067},
+  {"ISteamRemoteStorage::GetFileSize", "", 2, replay1068},
+  {"ISteamRemoteStorage::GetFileTimestamp", "", 2, replay1069},
+  {"ISteamRemoteStorage::GetSyncPlatforms", "", 2, replay1070},
+  {"ISteamRemoteStorage::GetFileCount", "", 1, replay1071},
+  {"ISteamRemoteStorage::GetFileNameAndSize", "", 3, replay1072},
+  {"ISteamRemoteStorage::GetQuota", "", 3, replay1073},
+  {"ISteamRemoteStorage::IsCloudEnabledForAccount", "", 1, replay1074},
+  {"ISteamRemoteStorage::IsCloudEnabledForApp", "", 1, replay1075},
+  {"ISteamRemoteStorage::SetCloudEnabledForApp", "", 2, replay1076},
+  {"ISteamRemoteStorage::UGCDownload", "", 3, replay1077},
+  {"ISteamRemoteStorage::GetUGCDownloadProgress", "", 4, replay1078},
+  {"ISteamRemoteStorage::GetUGCDetails", "", 6, replay1079},
+  {"ISteamRemoteStorage::UGCRead", "2:3", 6, replay1080},
+  {"ISteamRemoteStorage::GetCachedUGCCount", "", 1, replay1081},
+  {"ISteamRemoteStorage::GetCachedUGCHandle", "", 2, replay1082},
+  {"ISteamRemoteStorage::PublishWorkshopFile", "", 9, replay1083},
+  {"ISteamRemoteStorage::CreatePublishedFileUpdateRequest", "", 2, replay1084},
+  {"ISteamRemoteStorage::UpdatePublishedFileFile", "", 3, replay1085},
+  {"ISteamRemoteStorage::UpdatePublishedFilePreviewFile", "", 3, replay1086},
+  {"ISteamRemoteStorage::UpdatePublishedFileTitle", "", 3, replay1087},
+  {"ISteamRemoteStorage::UpdatePublishedFileDescription", "", 3, replay1088},
+  {"ISteamRemoteStorage::UpdatePublishedFileVisibility", "", 3, replay1089},
+  {"ISteamRemoteStorage::UpdatePublishedFileTags", "", 3, replay1090},
+  {"ISteamRemoteStorage::CommitPublishedFileUpdate", "", 2, replay1091},
+  {"ISteamRemoteStorage::GetPublishedFileDetails", "", 3, replay1092},
+  {"ISteamRemoteStorage::DeletePublishedFile", "", 2, replay1093},
+  {"ISteamRemoteStorage::EnumerateUserPublishedFiles", "", 2, replay1094},
+  {"ISteamRemoteStorage::SubscribePublishedFile", "", 2, replay1095},
+  {"ISteamRemoteStorage::EnumerateUserSubscribedFiles", "", 2, replay1096},
+  {"ISteamRemoteStorage::UnsubscribePublishedFile", "", 2, replay1097},
+  {"ISteamRemoteStorage::UpdatePublishedFileSetChangeDescription", "", 3, replay1098},
+  {"ISteamRemoteStorage::GetPublishedItemVoteDetails", "", 2, replay1099},
+  {"ISteamRemoteStorage::UpdateUserPublishedItemVote", "", 3, replay1100},
+  {"ISteamRemoteStorage::GetUserPublishedItemVoteDetails", "", 2, replay1101},
+  {"ISteamRemoteStorage::EnumerateUserSharedWorkshopFiles", "", 5, replay1102},
+  {"ISteamRemoteStorage::PublishVideo", "", 10, replay1103},
+  {"ISteamRemoteStorage::SetUserPublishedFileAction", "", 3, replay1104},
+  {"ISteamRemoteStorage::EnumeratePublishedFilesByUserAction", "", 3, replay1105},
+  {"ISteamRemoteStorage::EnumeratePublishedWorkshopFiles", "", 7, replay1106},
+  {"ISteamRemoteStorage::UGCDownloadToLocation", "", 4, replay1107},
+  {"ISteamScreenshots::WriteScreenshot", "1:2", 5, replay1108},
+  {"ISteamScreenshots::AddScreenshotToLibrary", "", 5, replay1109},
+  {"ISteamScreenshots::TriggerScreenshot", "", 1, replay1110},
+  {"ISteamScreenshots::HookScreenshots", "", 2, replay1111},
+  {"ISteamScreenshots::SetLocation", "", 3, replay1112},
+  {"ISteamScreenshots::TagUser", "", 3, replay1113},
+  {"ISteamScreenshots::TagPublishedFile", "", 3, replay1114},
+  {"ISteamScreenshots::IsScreenshotsHooked", "", 1, replay1115},
+  {"ISteamScreenshots::AddVRScreenshotToLibrary", "", 4, replay1116},
+  {"ISteamUGC::CreateQueryUserUGCRequest", "", 8, replay1117},
+  {"ISteamUGC::CreateQueryAllUGCRequest", "", 6, replay1118},
+  {"ISteamUGC::CreateQueryUGCDetailsRequest", "", 3, replay1119},
+  {"ISteamUGC::SendQueryUGCRequest", "", 2, replay1120},
+  {"ISteamUGC::GetQueryUGCResult", "", 4, replay1121},
+  {"ISteamUGC::GetQueryUGCPreviewURL", "3:4", 5, replay1122},
+  {"ISteamUGC::GetQueryUGCMetadata", "3:4", 5, replay1123},
+  {"ISteamUGC::GetQueryUGCChildren", "", 5, replay1124},
+  {"ISteamUGC::GetQueryUGCStatistic", "", 5, replay1125},
+  {"ISteamUGC::GetQueryUGCNumAdditionalPreviews", "", 3, replay1126},
+  {"ISteamUGC::GetQueryUGCAdditionalPreview", "4:5 6:7", 9, replay1127},
+  {"ISteamUGC::GetQueryUGCNumKeyValueTags", "", 3, replay1128},
+  {"ISteamUGC::GetQueryUGCKeyValueTag", "4:5 6:7", 8, replay1129},
+  {"ISteamUGC::ReleaseQueryUGCRequest", "", 2, replay1130},
+  {"ISteamUGC::AddRequiredTag", "", 3, replay1131},
+  {"ISteamUGC::AddExcludedTag", "", 3, replay1132},
+  {"ISteamUGC::SetReturnOnlyIDs", "", 3, replay1133},
+  {"ISteamUGC::SetReturnKeyValueTags", "", 3, replay1134},
+  {"ISteamUGC::SetReturnLongDescription", "", 3, replay1135},
+  {"ISteamUGC::SetReturnMetadata", "", 3, replay1136},
+  {"ISteamUGC::SetReturnChildren", "", 3, replay1137},
+  {"ISteamUGC::SetReturnAdditionalPreviews", "", 3, replay1138},
+  {"ISteamUGC::SetReturnTotalOnly", "", 3, replay1139},
+  {"ISteamUGC::SetLanguage", "", 3, replay1140},
+  {"ISteamUGC::SetAllowCachedResponse", "", 3, replay1141},
+  {"ISteamUGC::SetCloudFileNameFilter", "", 3, replay1142},
+  {"ISteamUGC::SetMatchAnyTag", "", 3, replay1143},
+  {"ISteamUGC::SetSearchText", "", 3, replay1144},
+  {"ISteamUGC::SetRankedByTrendDays", "", 3, replay1145},
+  {"ISteamUGC::AddRequiredKeyValueTag", "", 4, replay1146},
+  {"ISteamUGC::RequestUGCDetails", "", 3, replay1147},
+  {"ISteamUGC::CreateItem", "", 3, replay1148},
+  {"ISteamUGC::StartItemUpdate", "", 3, replay1149},
+  {"ISteamUGC::SetItemTitle", "", 3, replay1150},
+  {"ISteamUGC::SetItemDescription", "", 3, replay1151},
+  {"ISteamUGC::SetItemUpdateLanguage", "", 3, replay1152},
+  {"ISteamUGC::SetItemMetadata", "", 3, replay1153},
+  {"ISteamUGC::SetItemVisibility", "", 3, replay1154},
+  {"ISteamUGC::SetItemTags", "", 3, replay1155},
+  {"ISteamUGC::SetItemContent", "", 3, replay1156},
+  {"ISteamUGC::SetItemPreview", "", 3, replay1157},
+  {"ISteamUGC::RemoveItemKeyValueTags", "", 3, replay1158},
+  {"ISteamUGC::AddItemKeyValueTag", "", 4, replay1159},
+  {"ISteamUGC::AddItemPreviewFile", "", 4, replay1160},
+  {"ISteamUGC::AddItemPreviewVideo", "", 3, replay1161},
+  {"ISteamUGC::UpdateItemPreviewFile", "", 4, replay1162},
+  {"ISteamUGC::UpdateItemPreviewVideo", "", 4, replay1163},
+  {"ISteamUGC::RemoveItemPreview", "", 3, replay1164},
+  {"ISteamUGC::SubmitItemUpdate", "", 3, replay1165},
+  {"ISteamUGC::GetItemUpdateProgress", "", 4, replay1166},
+  {"ISteamUGC::SetUserItemVote", "", 3, replay1167},
+  {"ISteamUGC::GetUserItemVote", "", 2, replay1168},
+  {"ISteamUGC::AddItemToFavorites", "", 3, replay1169},
+  {"ISteamUGC::RemoveItemFromFavorites", "", 3, replay1170},
+  {"ISteamUGC::SubscribeItem", "", 2, replay1171},
+  {"ISteamUGC::UnsubscribeItem", "", 2, replay1172},
+  {"ISteamUGC::GetNumSubscribedItems", "", 1, replay1173},
+  {"ISteamUGC::GetSubscribedItems", "", 3, replay1174},
+  {"ISteamUGC::GetItemState", "", 2, replay1175},
+  {"ISteamUGC::GetItemInstallInfo", "3:4", 6, replay1176},
+  {"ISteamUGC::GetItemDownloadInfo", "", 4, replay1177},
+  {"ISteamUGC::DownloadItem", "", 3, replay1178},
+  {"ISteamUGC::BInitWorkshopForGameServer", "", 3, replay1179},
+  {"ISteamUGC::SuspendDownloads", "", 2, replay1180},
+  {"ISteamUGC::StartPlaytimeTracking", "", 3, replay1181},
+  {"ISteamUGC::StopPlaytimeTracking", "", 3, replay1182},
+  {"ISteamUGC::StopPlaytimeTrackingForAllItems", "", 1, replay1183},
+  {"ISteamUnifiedMessages::SendMethod", "2:3", 5, replay1184},
+  {"ISteamUnifiedMessages::GetMethodResponseInfo", "", 4, replay1185},
+  {"ISteamUnifiedMessages::GetMethodResponseData", "2:3", 5, replay1186},
+  {"ISteamUnifiedMessages::ReleaseMethod", "", 2, replay1187},
+  {"ISteamUnifiedMessages::SendNotification", "2:3", 4, replay1188},
+  {"ISteamUser::GetHSteamUser", "", 1, replay1189},
+  {"ISteamUser::BLoggedOn", "", 1, replay1190},
+  {"ISteamUser::GetSteamID", "", 1, replay1191},
+  {"ISteamUser::InitiateGameConnection", "1:2", 7, replay1192},
+  {"ISteamUser::TerminateGameConnection", "", 3, replay1193},
+  {"ISteamUser::TrackAppUsageEvent", "", 4, replay1194},
+  {"ISteamUser::GetUserDataFolder", "1:2", 3, replay1195},
+  {"ISteamUser::StartVoiceRecording", "", 1, replay1196},
+  {"ISteamUser::StopVoiceRecording", "", 1, replay1197},
+  {"ISteamUser::GetAvailableVoice", "", 4, replay1198},
+  {"ISteamUser::GetVoice", "2:3 6:7", 10, replay1199},
+  {"ISteamUser::DecompressVoice", "1:2 3:4", 7, replay1200},
+  {"ISteamUser::GetVoiceOptimalSampleRate", "", 1, replay1201},
+  {"ISteamUser::GetAuthSessionTicket", "1:2", 4, replay1202},
+  {"ISteamUser::BeginAuthSession", "1:2", 4, replay1203},
+  {"ISteamUser::EndAuthSession", "", 2, replay1204},
+  {"ISteamUser::CancelAuthTicket", "", 2, replay1205},
+  {"ISteamUser::UserHasLicenseForApp", "", 3, replay1206},
+  {"ISteamUser::BIsBehindNAT", "", 1, replay1207},
+  {"ISteamUser::AdvertiseGame", "", 4, replay1208},
+  {"ISteamUser::RequestEncryptedAppTicket", "1:2", 3, replay1209},
+  {"ISteamUser::GetEncryptedAppTicket", "1:2", 4, replay1210},
+  {"ISteamUser::GetGameBadgeLevel", "", 3, replay1211},
+  {"ISteamUser::GetPlayerSteamLevel", "", 1, replay1212},
+  {"ISteamUser::RequestStoreAuthURL", "", 2, replay1213},
+  {"ISteamUser::BIsPhoneVerified", "", 1, replay1214},
+  {"ISteamUser::BIsTwoFactorEnabled", "", 1, replay1215},
+  {"ISteamUser::BIsPhoneIdentifying", "", 1, replay1216},
+  {"ISteamUser::BIsPhoneRequiringVerification", "", 1, replay1217},
+  {"ISteamUserStats::RequestCurrentStats", "", 1, replay1218},
+  {"ISteamUserStats::GetStat", "", 3, replay1219},
+  {"ISteamUserStats::GetStat", "", 3, replay1220},
+  {"ISteamUserStats::SetStat", "", 3, replay1221},
+  {"ISteamUserStats::SetStat", "", 3, replay1222},
+  {"ISteamUserStats::UpdateAvgRateStat", "", 4, replay1223},
+  {"ISteamUserStats::GetAchievement", "", 3, replay1224},
+  {"ISteamUserStats::SetAchievement", "", 2, replay1225},
+  {"ISteamUserStats::ClearAchievement", "", 2, replay1226},
+  {"ISteamUserStats::GetAchievementAndUnlockTime", "", 4, replay1227},
+  {"ISteamUserStats::StoreStats", "", 1, replay1228},
+  {"ISteamUserStats::GetAchievementIcon", "", 2, replay1229},
+  {"ISteamUserStats::GetAchievementDisplayAttribute", "", 3, replay1230},
+  {"ISteamUserStats::IndicateAchievementProgress", "", 4, replay1231},
+  {"ISteamUserStats::GetNumAchievements", "", 1, replay1232},
+  {"ISteamUserStats::GetAchievementName", "", 2, replay1233},
+  {"ISteamUserStats::RequestUserStats", "", 2, replay1234},
+  {"ISteamUserStats::GetUserStat", "", 4, replay1235},
+  {"ISteamUserStats::GetUserStat", "", 4, replay1236},
+  {"ISteamUserStats::GetUserAchievement", "", 4, replay1237},
+  {"ISteamUserStats::GetUserAchievementAndUnlockTime", "", 5, replay1238},
+  {"ISteamUserStats::ResetAllStats", "", 2, replay1239},
+  {"ISteamUserStats::FindOrCreateLeaderboard", "", 4, replay1240},
+  {"ISteamUserStats::FindLeaderboard", "", 2, replay1241},
+  {"ISteamUserStats::GetLeaderboardName", "", 2, replay1242},
+  {"ISteamUserStats::GetLeaderboardEntryCount", "", 2, replay1243},
+  {"ISteamUserStats::GetLeaderboardSortMethod", "", 2, replay1244},
+  {"ISteamUserStats::GetLeaderboardDisplayType", "", 2, replay1245},
+  {"ISteamUserStats::DownloadLeaderboardEntries", "", 5, replay1246},
+  {"ISteamUserStats::DownloadLeaderboardEntriesForUsers", "", 4, replay1247},
+  {"ISteamUserStats::GetDownloadedLeaderboardEntry", "", 6, replay1248},
+  {"ISteamUserStats::UploadLeaderboardScore", "", 6, replay1249},
+  {"ISteamUserStats::AttachLeaderboardUGC", "", 3, replay1250},
+  {"ISteamUserStats::GetNumberOfCurrentPlayers", "", 1, replay1251},
+  {"ISteamUserStats::RequestGlobalAchievementPercentages", "", 1, replay1252},
+  {"ISteamUserStats::GetMostAchievedAchievementInfo", "", 5, replay1253},
+  {"ISteamUserStats::GetNextMostAchievedAchievementInfo", "", 6, replay1254},
+  {"ISteamUserStats::GetAchievementAchievedPercent", "", 3, replay1255},
+  {"ISteamUserStats::RequestGlobalStats", "", 2, replay1256},
+  {"ISteamUserStats::GetGlobalStat", "", 3, replay1257},
+  {"ISteamUserStats::GetGlobalStat", "", 3, replay1258},
+  {"ISteamUserStats::GetGlobalStatHistory", "2:3", 4, replay1259},
+  {"ISteamUserStats::GetGlobalStatHistory", "2:3", 4, replay1260},
+  {"ISteamUtils::GetSecondsSinceAppActive", "", 1, replay1261},
+  {"ISteamUtils::GetSecondsSinceComputerActive", "", 1, replay1262},
+  {"ISteamUtils::GetConnectedUniverse", "", 1, replay1263},
+  {"ISteamUtils::GetServerRealTime", "", 1, replay1264},
+  {"ISteamUtils::GetIPCountry", "", 1, replay1265},
+  {"ISteamUtils::GetImageSize", "", 4, replay1266},
+  {"ISteamUtils::GetImageRGBA", "2:3", 4, replay1267},
+  {"ISteamUtils::GetCSERIPPort", "", 3, replay1268},
+  {"ISteamUtils::GetCurrentBatteryPower", "", 1, replay1269},
+  {"ISteamUtils::GetAppID", "", 1, replay1270},
+  {"ISteamUtils::SetOverlayNotificationPosition", "", 2, replay1271},
+  {"ISteamUtils::IsAPICallCompleted", "", 3, replay1272},
+  {"ISteamUtils::GetAPICallFailureReason", "", 2, replay1273},
+  {"ISteamUtils::GetAPICallResult", "2:3", 6, replay1274},
+  {"ISteamUtils::GetIPCCallCount", "", 1, replay1275},
+  {"ISteamUtils::SetWarningMessageHook", "", 2, replay1276},
+  {"ISteamUtils::IsOverlayEnabled", "", 1, replay1277},
+  {"ISteamUtils::BOverlayNeedsPresent", "", 1, replay1278},
+  {"ISteamUtils::CheckFileSignature", "", 2, replay1279},
+  {"ISteamUtils::ShowGamepadTextInput", "", 6, replay1280},
+  {"ISteamUtils::GetEnteredGamepadTextLength", "", 1, replay1281},
+  {"ISteamUtils::GetEnteredGamepadTextInput", "1:2", 3, replay1282},
+  {"ISteamUtils::GetSteamUILanguage", "", 1, replay1283},
+  {"ISteamUtils::IsSteamRunningInVR", "", 1, replay1284},
+  {"ISteamUtils::SetOverlayNotificationInset", "", 3, replay1285},
+  {"ISteamUtils::IsSteamInBigPictureMode", "", 1, replay1286},
+  {"ISteamUtils::StartVRDashboard", "", 1, replay1287},
+  {"ISteamVideo::GetVideoURL", "", 2, replay1288},
+  {"ISteamVideo::IsBroadcasting", "", 2, replay1289}
+};
+const unsigned replayEntryCount = 1290;
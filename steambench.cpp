@@ -0,0 +1,577 @@
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <windows.h>
+#include <steam_api_.h>
+#include "timer.h"
+
+// Usage: steambench.exe [--dll <name>] [--iterations <n>] [--repeat <n>]
+//                       [--label <text>] [--output <file>]
+//
+// End-to-end benchmarks of steam_api.dll as a game sees it: the dll is
+// loaded with LoadLibrary and called through its exports and the thiscall
+// vtables of the wrappers, so every number includes the Windows to Linux
+// transition, the wrapper and whatever libsteam_api does. Run it against
+// the stand-in (standin/standin.h) for numbers that only change with the
+// forwarder. Results go to stdout as JSON, progress and skipped cases to
+// stderr.
+
+#ifdef _WIN64
+#define STEAMBENCH_DLL "steam_api64.dll"
+#else
+#define STEAMBENCH_DLL "steam_api.dll"
+#endif
+
+// A callback as a game compiled with MSVC lays out CCallbackBase, see
+// WinCallback in callbacks.h
+class BenchCallback
+{
+public:
+  BenchCallback(int callback, int size): m_nCallbackFlags(0), m_iCallback(callback),
+                                         size(size), runs(0), results(0) {}
+  virtual __attribute__((thiscall)) void Run(void *pvParam) { runs++; }
+  virtual __attribute__((thiscall)) void Run(void *pvParam, bool bIOFailure, SteamAPICall_t hSteamAPICall)
+  {
+    results++;
+  }
+  virtual __attribute__((thiscall)) int GetCallbackSizeBytes() { return size; }
+  uint8 m_nCallbackFlags;
+  int m_iCallback;
+  int size;
+  uint64_t runs;
+  uint64_t results;
+};
+
+// The cost of the call the game makes anyway, to tell the forwarder's share
+class BenchBaseline
+{
+public:
+  virtual __attribute__((thiscall)) bool BLoggedOn();
+};
+
+__attribute__((noinline)) bool BenchBaseline::BLoggedOn()
+{
+  return true;
+}
+
+typedef void *(*Accessor)();
+typedef bool (*Init)();
+typedef void (*RunCallbacks)();
+typedef void (*RegisterCallback)(BenchCallback *callback, int id);
+typedef void (*UnregisterCallback)(BenchCallback *callback);
+typedef void (*CallResultRegistration)(BenchCallback *callback, SteamAPICall_t call);
+typedef bool (*FlatBLoggedOn)(intptr_t instance);
+
+static HMODULE dll;
+static ISteamUser_ *user;
+static ISteamFriends_ *friends;
+static ISteamUtils_ *utils;
+static ISteamApps_ *apps;
+static ISteamUserStats_ *userStats;
+static ISteamRemoteStorage_ *remoteStorage;
+static ISteamNetworking_ *networking;
+static ISteamMatchmaking_ *matchmaking;
+static ISteamMusic_ *music;
+static ISteamAppList_ *appList;
+static ISteamInventory_ *inventory;
+static ISteamClient_ *client;
+static RunCallbacks runCallbacks;
+static RegisterCallback registerCallback;
+static UnregisterCallback unregisterCallback;
+static CallResultRegistration registerCallResult;
+static CallResultRegistration unregisterCallResult;
+static FlatBLoggedOn flatBLoggedOn;
+static BenchBaseline baseline;
+static BenchBaseline *baselineObject = &baseline;
+
+template <class T>
+static T *accessor(const char *name)
+{
+  Accessor get = (Accessor)GetProcAddress(dll, name);
+  return get != NULL ? (T *)get() : NULL;
+}
+
+struct BenchTiming
+{
+  uint64_t ns;
+  // What was done: calls, callbacks delivered, packets or files
+  uint64_t ops;
+};
+
+// Does count operations moving bytes each, false if the case cannot run here
+typedef bool (*BenchRun)(unsigned count, unsigned bytes, BenchTiming &timing);
+
+struct BenchCase
+{
+  const char *name;
+  const char *group;
+  unsigned bytes;
+  // Iterations per operation, so the slow cases take about as long
+  unsigned cost;
+  BenchRun run;
+};
+
+// One case per method, all the same but for the call
+#define BENCH_CALL(function, object, call) \
+  static bool function(unsigned count, unsigned bytes, BenchTiming &timing) \
+  { \
+    if (object == NULL) \
+      return false; \
+    uint64_t start = monotonicNs(); \
+    for (unsigned i = 0; i < count; i++) \
+      object->call; \
+    timing.ns = monotonicNs() - start; \
+    timing.ops = count; \
+    return true; \
+  }
+
+static CSteamID steamID;
+static int32 stat;
+static uint32 packetSize;
+
+BENCH_CALL(benchBaseline, baselineObject, BLoggedOn())
+BENCH_CALL(benchBLoggedOn, user, BLoggedOn())
+BENCH_CALL(benchGetSteamID, user, GetSteamID(&steamID))
+BENCH_CALL(benchGetPersonaName, friends, GetPersonaName())
+BENCH_CALL(benchGetFriendCount, friends, GetFriendCount(k_EFriendFlagImmediate))
+BENCH_CALL(benchGetAppID, utils, GetAppID())
+BENCH_CALL(benchGetSecondsSinceAppActive, utils, GetSecondsSinceAppActive())
+BENCH_CALL(benchBIsSubscribed, apps, BIsSubscribed())
+BENCH_CALL(benchGetCurrentGameLanguage, apps, GetCurrentGameLanguage())
+BENCH_CALL(benchGetStat, userStats, GetStat((char *)"steambench", &stat))
+BENCH_CALL(benchGetFileCount, remoteStorage, GetFileCount())
+BENCH_CALL(benchIsP2PPacketAvailable, networking, IsP2PPacketAvailable(&packetSize, 0))
+BENCH_CALL(benchGetFavoriteGameCount, matchmaking, GetFavoriteGameCount())
+BENCH_CALL(benchBIsEnabled, music, BIsEnabled())
+BENCH_CALL(benchGetNumInstalledApps, appList, GetNumInstalledApps())
+BENCH_CALL(benchGetResultStatus, inventory, GetResultStatus(k_SteamInventoryResultInvalid))
+BENCH_CALL(benchGetIPCCallCount, client, GetIPCCallCount())
+
+// The flat export translates the wrapper back to the Linux interface
+static bool benchFlatBLoggedOn(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (flatBLoggedOn == NULL || user == NULL)
+    return false;
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count; i++)
+    flatBLoggedOn((intptr_t)user);
+  timing.ns = monotonicNs() - start;
+  timing.ops = count;
+  return true;
+}
+
+static bool benchRunCallbacks(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (runCallbacks == NULL)
+    return false;
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count; i++)
+    runCallbacks();
+  timing.ns = monotonicNs() - start;
+  timing.ops = count;
+  return true;
+}
+
+// Per callback delivered; libsteam_api has to deliver some, the stand-in
+// does with STEAMSTANDIN_CALLBACKS
+static bool benchCallbackDispatch(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (runCallbacks == NULL || registerCallback == NULL || unregisterCallback == NULL)
+    return false;
+  std::vector<BenchCallback> callbacks;
+  // Registered by address, so the vector must not grow afterwards
+  callbacks.reserve(16);
+  for (int i = 0; i < 16; i++)
+  {
+    callbacks.push_back(BenchCallback(P2PSessionRequest_t::k_iCallback + i,
+                                      sizeof(P2PSessionRequest_t)));
+    registerCallback(&callbacks.back(), callbacks.back().m_iCallback);
+  }
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count; i++)
+    runCallbacks();
+  timing.ns = monotonicNs() - start;
+  timing.ops = 0;
+  for (size_t i = 0; i < callbacks.size(); i++)
+  {
+    unregisterCallback(&callbacks[i]);
+    timing.ops += callbacks[i].runs;
+  }
+  return timing.ops > 0;
+}
+
+// From the call to the delivery of its result; libsteam_api has to answer
+// within a few frames, which the stand-in does
+static bool benchCallResult(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (userStats == NULL || runCallbacks == NULL || registerCallResult == NULL ||
+      unregisterCallResult == NULL)
+    return false;
+  BenchCallback callback(LeaderboardFindResult_t::k_iCallback, sizeof(LeaderboardFindResult_t));
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count; i++)
+  {
+    SteamAPICall_t call = userStats->FindOrCreateLeaderboard((char *)"steambench",
+      k_ELeaderboardSortMethodDescending, k_ELeaderboardDisplayTypeNumeric);
+    registerCallResult(&callback, call);
+    uint64_t waited = callback.results;
+    for (int frame = 0; frame < 100 && callback.results == waited; frame++)
+      runCallbacks();
+    if (callback.results == waited)
+    {
+      unregisterCallResult(&callback, call);
+      return false;
+    }
+  }
+  timing.ns = monotonicNs() - start;
+  timing.ops = count;
+  return true;
+}
+
+// A packet to ourselves and back, which the stand-in loops back
+static bool benchP2P(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (networking == NULL || user == NULL)
+    return false;
+  CSteamID self;
+  user->GetSteamID(&self);
+  EP2PSend send = bytes > 1200 ? k_EP2PSendReliable : k_EP2PSendUnreliable;
+  std::vector<unsigned char> out(bytes, 0x5a), in(bytes);
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count; i++)
+  {
+    uint32 size;
+    CSteamID from;
+    if (!networking->SendP2PPacket(self, &out[0], bytes, send, 0) ||
+        !networking->ReadP2PPacket(&in[0], bytes, &size, &from, 0))
+      return false;
+  }
+  timing.ns = monotonicNs() - start;
+  timing.ops = count;
+  return true;
+}
+
+// Channels the P2P receive case polls every frame, whether they have
+// packets or not, as games do
+#define STEAMBENCH_P2P_CHANNELS 8
+
+// Packets from the stand-in's fake peer, STEAMSTANDIN_P2P_PACKETS per frame
+// on STEAMSTANDIN_P2P_CHANNELS channels, drained like a game does every
+// frame; compare with and without STEAMFORWARDER_P2P_BATCH=1 (p2p.h)
+static bool benchP2PReceive(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (networking == NULL || runCallbacks == NULL)
+    return false;
+  std::vector<unsigned char> in(1200);
+  timing.ops = 0;
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count; i++)
+  {
+    runCallbacks();
+    for (int channel = 0; channel < STEAMBENCH_P2P_CHANNELS; channel++)
+    {
+      uint32 size;
+      CSteamID from;
+      while (networking->IsP2PPacketAvailable(&size, channel))
+      {
+        if (size > in.size())
+          in.resize(size);
+        networking->ReadP2PPacket(&in[0], in.size(), &size, &from, channel);
+        timing.ops++;
+      }
+    }
+  }
+  timing.ns = monotonicNs() - start;
+  return timing.ops > 0;
+}
+
+// Players of the session case, the first fake Steam account they use, and
+// a channel none of the other cases reads
+#define STEAMBENCH_SESSION_PEERS 16
+#define STEAMBENCH_SESSION_ACCOUNT 2000
+#define STEAMBENCH_SESSION_CHANNEL 15
+
+// The state of every player's session asked each frame, as games do for
+// their connection UI. Ops are frames; compare with and without
+// STEAMFORWARDER_P2P_SESSIONS=<ms> (sessions.h).
+static bool benchSessions(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (networking == NULL || runCallbacks == NULL)
+    return false;
+  std::vector<CSteamID> peers;
+  unsigned char hello = 0;
+  for (unsigned p = 0; p < STEAMBENCH_SESSION_PEERS; p++)
+  {
+    peers.push_back(CSteamID(STEAMBENCH_SESSION_ACCOUNT + p, k_EUniversePublic, k_EAccountTypeIndividual));
+    networking->SendP2PPacket(peers.back(), &hello, sizeof(hello), k_EP2PSendReliable,
+                              STEAMBENCH_SESSION_CHANNEL);
+  }
+  bool active = true;
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count && active; i++)
+  {
+    runCallbacks();
+    for (size_t p = 0; p < peers.size(); p++)
+    {
+      P2PSessionState_t state;
+      active = networking->GetP2PSessionState(peers[p], &state) && state.m_bConnectionActive && active;
+    }
+  }
+  timing.ns = monotonicNs() - start;
+  timing.ops = count;
+  for (size_t p = 0; p < peers.size(); p++)
+    networking->CloseP2PSessionWithUser(peers[p]);
+  return active;
+}
+
+// Virtual port of the socket cases, and the clients which send a message
+// every frame, the other sockets are polled idle
+#define STEAMBENCH_SOCKET_PORT 27015
+#define STEAMBENCH_SOCKET_SENDERS 8
+
+// A server polling every connection socket each frame, most of them idle,
+// with the clients on the same Steam user, which the stand-in connects at
+// once. Ops are frames; compare with and without STEAMFORWARDER_SOCKET_POLL=1
+// (sockets.h).
+static bool benchSockets(unsigned count, unsigned sockets, BenchTiming &timing)
+{
+  if (networking == NULL || user == NULL || runCallbacks == NULL)
+    return false;
+  CSteamID self;
+  user->GetSteamID(&self);
+  SNetListenSocket_t listen = networking->CreateListenSocket(STEAMBENCH_SOCKET_PORT, 0, 0, true);
+  if (listen == 0)
+    return false;
+  std::vector<SNetSocket_t> clients, accepted;
+  unsigned char message[64] = {0};
+  for (unsigned i = 0; i < sockets; i++)
+  {
+    clients.push_back(networking->CreateP2PConnectionSocket(self, STEAMBENCH_SOCKET_PORT, 5, true));
+    networking->SendDataOnSocket(clients.back(), message, sizeof(message), true);
+  }
+  // The server learns its sockets from the first message of each
+  runCallbacks();
+  uint32 size;
+  SNetSocket_t from;
+  while (networking->RetrieveData(listen, message, sizeof(message), &size, &from))
+    if (std::find(accepted.begin(), accepted.end(), from) == accepted.end())
+      accepted.push_back(from);
+  bool connected = accepted.size() == sockets;
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count && connected; i++)
+  {
+    runCallbacks();
+    for (unsigned c = 0; c < STEAMBENCH_SOCKET_SENDERS; c++)
+      networking->SendDataOnSocket(clients[(i * STEAMBENCH_SOCKET_SENDERS + c) % sockets], message,
+                                   sizeof(message), false);
+    for (size_t a = 0; a < accepted.size(); a++)
+      while (networking->IsDataAvailableOnSocket(accepted[a], &size))
+        networking->RetrieveDataFromSocket(accepted[a], message, sizeof(message), &size);
+  }
+  timing.ns = monotonicNs() - start;
+  timing.ops = count;
+  for (size_t c = 0; c < clients.size(); c++)
+    networking->DestroySocket(clients[c], false);
+  networking->DestroyListenSocket(listen, false);
+  return connected;
+}
+
+static bool benchSockets64(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  return benchSockets(count, 64, timing);
+}
+
+static bool benchSockets128(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  return benchSockets(count, 128, timing);
+}
+
+static bool benchSockets256(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  return benchSockets(count, 256, timing);
+}
+
+// A cloud file written and read back
+static bool benchFileCopy(unsigned count, unsigned bytes, BenchTiming &timing)
+{
+  if (remoteStorage == NULL)
+    return false;
+  std::vector<unsigned char> out(bytes, 0xa5), in(bytes);
+  char name[] = "steambench.dat";
+  uint64_t start = monotonicNs();
+  for (unsigned i = 0; i < count; i++)
+    if (!remoteStorage->FileWrite(name, &out[0], bytes) ||
+        remoteStorage->FileRead(name, &in[0], bytes) != (int32)bytes)
+    {
+      remoteStorage->FileDelete(name);
+      return false;
+    }
+  timing.ns = monotonicNs() - start;
+  timing.ops = count;
+  remoteStorage->FileDelete(name);
+  return true;
+}
+
+static const BenchCase benchCases[] = {
+  {"baseline", "call", 0, 1, benchBaseline},
+  {"ISteamUser::BLoggedOn", "call", 0, 1, benchBLoggedOn},
+  {"ISteamUser::GetSteamID", "call", 0, 1, benchGetSteamID},
+  {"ISteamFriends::GetPersonaName", "call", 0, 1, benchGetPersonaName},
+  {"ISteamFriends::GetFriendCount", "call", 0, 1, benchGetFriendCount},
+  {"ISteamUtils::GetAppID", "call", 0, 1, benchGetAppID},
+  {"ISteamUtils::GetSecondsSinceAppActive", "call", 0, 1, benchGetSecondsSinceAppActive},
+  {"ISteamApps::BIsSubscribed", "call", 0, 1, benchBIsSubscribed},
+  {"ISteamApps::GetCurrentGameLanguage", "call", 0, 1, benchGetCurrentGameLanguage},
+  {"ISteamUserStats::GetStat", "call", 0, 1, benchGetStat},
+  {"ISteamRemoteStorage::GetFileCount", "call", 0, 1, benchGetFileCount},
+  {"ISteamNetworking::IsP2PPacketAvailable", "call", 0, 1, benchIsP2PPacketAvailable},
+  {"ISteamMatchmaking::GetFavoriteGameCount", "call", 0, 1, benchGetFavoriteGameCount},
+  {"ISteamMusic::BIsEnabled", "call", 0, 1, benchBIsEnabled},
+  {"ISteamAppList::GetNumInstalledApps", "call", 0, 1, benchGetNumInstalledApps},
+  {"ISteamInventory::GetResultStatus", "call", 0, 1, benchGetResultStatus},
+  {"ISteamClient::GetIPCCallCount", "call", 0, 1, benchGetIPCCallCount},
+  {"SteamAPI_ISteamUser_BLoggedOn", "call", 0, 1, benchFlatBLoggedOn},
+  {"SteamAPI_RunCallbacks", "callback", 0, 10, benchRunCallbacks},
+  {"callback dispatch", "callback", 0, 100, benchCallbackDispatch},
+  {"call result", "callback", 0, 100, benchCallResult},
+  {"P2P 64", "p2p", 64, 10, benchP2P},
+  {"P2P 1200", "p2p", 1200, 10, benchP2P},
+  {"P2P 16384", "p2p", 16384, 100, benchP2P},
+  {"P2P receive", "p2p", 0, 100, benchP2PReceive},
+  {"P2P sessions", "p2p", 0, 100, benchSessions},
+  {"sockets 64", "sockets", 0, 1000, benchSockets64},
+  {"sockets 128", "sockets", 0, 1000, benchSockets128},
+  {"sockets 256", "sockets", 0, 1000, benchSockets256},
+  {"file 65536", "copy", 65536, 1000, benchFileCopy},
+  {"file 1048576", "copy", 1048576, 10000, benchFileCopy},
+};
+
+static void jsonString(FILE *out, const char *value)
+{
+  fputc('"', out);
+  for (; *value != '\0'; value++)
+    if (*value == '"' || *value == '\\')
+      fprintf(out, "\\%c", *value);
+    else if ((unsigned char)*value < 0x20)
+      fprintf(out, "\\u%04x", *value);
+    else
+      fputc(*value, out);
+  fputc('"', out);
+}
+
+static bool loadSteam(const char *name)
+{
+  dll = LoadLibraryA(name);
+  if (dll == NULL)
+    return false;
+  Init init = (Init)GetProcAddress(dll, "SteamAPI_Init");
+  if (init == NULL || !init())
+    fprintf(stderr, "SteamAPI_Init failed, the interfaces may be missing\n");
+  user = accessor<ISteamUser_>("SteamUser");
+  friends = accessor<ISteamFriends_>("SteamFriends");
+  utils = accessor<ISteamUtils_>("SteamUtils");
+  apps = accessor<ISteamApps_>("SteamApps");
+  userStats = accessor<ISteamUserStats_>("SteamUserStats");
+  remoteStorage = accessor<ISteamRemoteStorage_>("SteamRemoteStorage");
+  networking = accessor<ISteamNetworking_>("SteamNetworking");
+  matchmaking = accessor<ISteamMatchmaking_>("SteamMatchmaking");
+  music = accessor<ISteamMusic_>("SteamMusic");
+  appList = accessor<ISteamAppList_>("SteamAppList");
+  inventory = accessor<ISteamInventory_>("SteamInventory");
+  client = accessor<ISteamClient_>("SteamClient");
+  runCallbacks = (RunCallbacks)GetProcAddress(dll, "SteamAPI_RunCallbacks");
+  registerCallback = (RegisterCallback)GetProcAddress(dll, "SteamAPI_RegisterCallback");
+  unregisterCallback = (UnregisterCallback)GetProcAddress(dll, "SteamAPI_UnregisterCallback");
+  registerCallResult = (CallResultRegistration)GetProcAddress(dll, "SteamAPI_RegisterCallResult");
+  unregisterCallResult = (CallResultRegistration)GetProcAddress(dll, "SteamAPI_UnregisterCallResult");
+  flatBLoggedOn = (FlatBLoggedOn)GetProcAddress(dll, "SteamAPI_ISteamUser_BLoggedOn");
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *name = STEAMBENCH_DLL, *label = "", *output = NULL;
+  unsigned iterations = STEAMBENCH_ITERATIONS, repeat = STEAMBENCH_REPEAT;
+  for (int i = 1; i < argc; i++)
+  {
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (value != NULL && strcmp(argv[i], "--dll") == 0)
+      name = value;
+    else if (value != NULL && strcmp(argv[i], "--iterations") == 0)
+      iterations = strtoul(value, NULL, 10);
+    else if (value != NULL && strcmp(argv[i], "--repeat") == 0)
+      repeat = strtoul(value, NULL, 10);
+    else if (value != NULL && strcmp(argv[i], "--label") == 0)
+      label = value;
+    else if (value != NULL && strcmp(argv[i], "--output") == 0)
+      output = value;
+    else
+    {
+      fprintf(stderr, "Usage: %s [--dll <name>] [--iterations <n>] [--repeat <n>] "
+              "[--label <text>] [--output <file>]\n", argv[0]);
+      return 2;
+    }
+    i++;
+  }
+  if (repeat == 0)
+    repeat = 1;
+  if (!loadSteam(name))
+  {
+    fprintf(stderr, "Cannot load %s\n", name);
+    return 1;
+  }
+  FILE *out = output != NULL ? fopen(output, "w") : stdout;
+  if (out == NULL)
+  {
+    fprintf(stderr, "Cannot write %s\n", output);
+    return 1;
+  }
+  fprintf(out, "{\n  \"label\": ");
+  jsonString(out, label);
+  fprintf(out, ",\n  \"dll\": ");
+  jsonString(out, name);
+  fprintf(out, ",\n  \"compiler\": ");
+  jsonString(out, __VERSION__);
+  fprintf(out, ",\n  \"bits\": %u,\n  \"iterations\": %u,\n  \"repeat\": %u,\n  \"results\": [",
+          (unsigned)sizeof(void *) * 8, iterations, repeat);
+  bool first = true;
+  for (size_t c = 0; c < sizeof(benchCases) / sizeof(benchCases[0]); c++)
+  {
+    const BenchCase &bench = benchCases[c];
+    unsigned count = std::max(iterations / bench.cost, 1u);
+    BenchTiming timing;
+    // The first run warms up caches and the forwarder's lookups
+    if (!bench.run(std::max(count / 10, 1u), bench.bytes, timing))
+    {
+      fprintf(stderr, "%s skipped\n", bench.name);
+      continue;
+    }
+    std::vector<double> ns;
+    for (unsigned r = 0; r < repeat && bench.run(count, bench.bytes, timing); r++)
+      ns.push_back((double)timing.ns / timing.ops);
+    if (ns.size() < repeat)
+    {
+      fprintf(stderr, "%s failed\n", bench.name);
+      continue;
+    }
+    std::sort(ns.begin(), ns.end());
+    double best = ns[0], median = ns[ns.size() / 2];
+    fprintf(stderr, "%-40s %12.1f ns\n", bench.name, best);
+    fprintf(out, "%s\n    {\"name\": ", first ? "" : ",");
+    jsonString(out, bench.name);
+    fprintf(out, ", \"group\": \"%s\", \"bytes\": %u, \"ops\": %llu, \"ns\": %.2f, "
+            "\"ns_median\": %.2f, \"ops_per_second\": %.0f, \"mb_per_second\": %.1f}",
+            bench.group, bench.bytes, (unsigned long long)timing.ops, best, median,
+            1e9 / best, bench.bytes * 1e3 / best);
+    first = false;
+  }
+  fprintf(out, "\n  ]\n}\n");
+  if (out != stdout)
+    fclose(out);
+  RunCallbacks shutdown = (RunCallbacks)GetProcAddress(dll, "SteamAPI_Shutdown");
+  if (shutdown != NULL)
+    shutdown();
+  return 0;
+}
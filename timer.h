@@ -0,0 +1,12 @@
+#ifndef STEAM_FORWARDER_TIMER
+#define STEAM_FORWARDER_TIMER
+#include <stdint.h>
+#include <time.h>
+
+static inline uint64_t monotonicNs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+#endif
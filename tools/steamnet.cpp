@@ -0,0 +1,138 @@
+// Live view of the P2P statistics (STEAMFORWARDER_NET_STATS=<file>).
+// Usage: steamnet [pid] [seconds between updates] [rows]
+#include <algorithm>
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include "netstats.h"
+
+struct Row
+{
+  uint32_t entry;
+  uint64_t sentPackets;
+  uint64_t sentBytes;
+  uint64_t failedSends;
+  uint64_t receivedPackets;
+  uint64_t receivedBytes;
+};
+
+// The newest segment if no pid is given
+static bool findSegment(char *name, size_t size)
+{
+  DIR *dir = opendir("/dev/shm");
+  if (dir == NULL)
+    return false;
+  time_t newest = 0;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL)
+  {
+    struct stat st;
+    char path[512];
+    if (strncmp(entry->d_name, "steamnet-", 9) != 0)
+      continue;
+    snprintf(path, sizeof(path), "/dev/shm/%s", entry->d_name);
+    if (stat(path, &st) == 0 && st.st_mtime >= newest)
+    {
+      newest = st.st_mtime;
+      snprintf(name, size, "/%s", entry->d_name);
+    }
+  }
+  closedir(dir);
+  return newest != 0;
+}
+
+static void snapshot(NetStatsHeader *h, std::vector<Row> &rows)
+{
+  rows.assign(h->entries, Row());
+  for (uint32_t i = 0; i < h->entries; i++)
+  {
+    NetStatsEntry *e = netStatsEntry(h, i);
+    Row &r = rows[i];
+    r.entry = i;
+    if (e->ready.load(std::memory_order_acquire) == 0)
+      continue;
+    r.sentPackets = e->sentPackets.load(std::memory_order_relaxed);
+    r.sentBytes = e->sentBytes.load(std::memory_order_relaxed);
+    r.failedSends = e->failedSends.load(std::memory_order_relaxed);
+    r.receivedPackets = e->receivedPackets.load(std::memory_order_relaxed);
+    r.receivedBytes = e->receivedBytes.load(std::memory_order_relaxed);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  char name[300];
+  if (argc > 1)
+    snprintf(name, sizeof(name), "/steamnet-%s", argv[1]);
+  else if (!findSegment(name, sizeof(name)))
+  {
+    fprintf(stderr, "No /dev/shm/steamnet-* found, was the game started with STEAMFORWARDER_NET_STATS?\n");
+    return 1;
+  }
+  double interval = argc > 2 ? atof(argv[2]) : 1.0;
+  unsigned lines = argc > 3 ? atoi(argv[3]) : 30;
+
+  int fd = shm_open(name, O_RDONLY, 0);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(NetStatsHeader))
+  {
+    fprintf(stderr, "Cannot open /dev/shm%s\n", name);
+    return 1;
+  }
+  NetStatsHeader *h = (NetStatsHeader *)mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (h == MAP_FAILED || h->magic != NET_STATS_MAGIC || h->layout != NET_STATS_LAYOUT ||
+      netStatsSize(h->entries) > (size_t)st.st_size)
+  {
+    fprintf(stderr, "/dev/shm%s is not a P2P statistics segment of this version\n", name);
+    return 1;
+  }
+
+  std::vector<Row> before, now, delta;
+  snapshot(h, before);
+  for (;;)
+  {
+    usleep((useconds_t)(interval * 1e6));
+    snapshot(h, now);
+    delta = now;
+    for (size_t i = 0; i < before.size(); i++)
+    {
+      delta[i].sentPackets -= before[i].sentPackets;
+      delta[i].sentBytes -= before[i].sentBytes;
+      delta[i].failedSends -= before[i].failedSends;
+      delta[i].receivedPackets -= before[i].receivedPackets;
+      delta[i].receivedBytes -= before[i].receivedBytes;
+    }
+    std::sort(delta.begin(), delta.end(), [](const Row &a, const Row &b) {
+      return a.sentBytes + a.receivedBytes > b.sentBytes + b.receivedBytes;
+    });
+    printf("\033[H\033[2J%s, %u peer channels\n\n", name + 1,
+           std::min(h->usedEntries.load(), h->entries) - 1);
+    printf("%-20s %7s %9s %9s %9s %9s %9s %9s %9s\n", "peer", "channel", "sent/s", "KB/s out",
+           "failed/s", "recv/s", "KB/s in", "jitter us", "jit p99");
+    for (size_t i = 0; i < delta.size() && i < lines; i++)
+    {
+      const Row &r = delta[i];
+      if (r.sentPackets + r.receivedPackets + r.failedSends == 0)
+        break;
+      const NetStatsEntry *e = netStatsEntry(h, r.entry);
+      if (r.entry == 0)
+        printf("%-20s %7s", "other", "");
+      else
+        printf("%-20llu %7d", (unsigned long long)e->remote, e->channel);
+      printf(" %9.0f %9.1f %9.0f %9.0f %9.1f %9.1f %9.1f\n", r.sentPackets / interval,
+             r.sentBytes / 1024.0 / interval, r.failedSends / interval, r.receivedPackets / interval,
+             r.receivedBytes / 1024.0 / interval, e->jitter.load(std::memory_order_relaxed) / 1e3,
+             e->jitters.percentile(0.99) / 1e3);
+    }
+    fflush(stdout);
+    before.swap(now);
+  }
+  return 0;
+}
@@ -0,0 +1,193 @@
+// Prints a recording of the forwarder (STEAMFORWARDER_RECORD=<file>), one
+// line per call or callback, or with -s the calls and time per function.
+// Usage: steamrecord [-s] <recording>
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "recorder.h"
+
+struct Function
+{
+  std::string name;
+  uint64_t calls;
+  uint64_t ns;
+};
+
+static void printValue(char code, uint64_t value)
+{
+  switch (code)
+  {
+  case 'b':
+    printf("%s", value ? "true" : "false");
+    break;
+  case 'i':
+    printf("%lld", (long long)unzigzag(value));
+    break;
+  case 'f':
+  {
+    double d;
+    memcpy(&d, &value, sizeof(d));
+    printf("%g", d);
+    break;
+  }
+  case 'x':
+    printf("{...}");
+    break;
+  default:
+    printf(code == 'u' ? "%llu" : "0x%llx", (unsigned long long)value);
+  }
+}
+
+// Strings as text, other buffers as their first bytes in hex
+static void printBuffer(unsigned argument, const unsigned char *bytes, size_t length)
+{
+  bool text = true;
+  for (size_t i = 0; i < length; i++)
+    if (bytes[i] != 0 && (bytes[i] < 0x20 || bytes[i] > 0x7e))
+      text = false;
+  printf(" [%u]=", argument);
+  if (text)
+    printf("\"%.*s\"", (int)std::min(length, (size_t)64), (const char *)bytes);
+  else
+  {
+    for (size_t i = 0; i < length && i < 16; i++)
+      printf("%02x", bytes[i]);
+    if (length > 16)
+      printf("...(%lu bytes)", (unsigned long)length);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  bool summary = argc == 3 && strcmp(argv[1], "-s") == 0;
+  if (argc != 2 && !summary)
+  {
+    fprintf(stderr, "Usage: %s [-s] <recording>\n", argv[0]);
+    return 2;
+  }
+  FILE *file = fopen(argv[argc - 1], "rb");
+  std::vector<unsigned char> data;
+  if (file != NULL)
+  {
+    unsigned char chunk[65536];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+      data.insert(data.end(), chunk, chunk + read);
+    fclose(file);
+  }
+  if (data.size() < RECORD_MAGIC_SIZE || memcmp(&data[0], RECORD_MAGIC, RECORD_MAGIC_SIZE) != 0)
+  {
+    fprintf(stderr, "%s is not a recording\n", argv[argc - 1]);
+    return 1;
+  }
+  std::vector<Function> functions;
+  uint64_t callbacks = 0;
+  const unsigned char *p = &data[0] + RECORD_MAGIC_SIZE;
+  const unsigned char *end = &data[0] + data.size();
+  bool complete = true;
+  while (p < end && complete)
+  {
+    unsigned char type = *p++;
+    uint64_t id, thread, start, duration, value, number, length;
+    const unsigned char *bytes, *codes, *byte;
+    complete = false;
+    if (type == RECORD_NAME)
+    {
+      if (!readNumber(p, end, id) || id > RECORD_MAX_ID || !readNumber(p, end, length) ||
+          !readBytes(p, end, length, bytes))
+        break;
+      if (functions.size() <= id)
+        functions.resize(id + 1);
+      functions[id].name.assign((const char *)bytes, length);
+    }
+    else if (type == RECORD_CALL)
+    {
+      if (!readNumber(p, end, id) || !readNumber(p, end, thread) ||
+          !readNumber(p, end, start) || !readNumber(p, end, duration) ||
+          !readBytes(p, end, 1, byte) || !readBytes(p, end, *byte, codes) ||
+          id >= functions.size())
+        break;
+      unsigned count = *byte;
+      if (summary)
+      {
+        functions[id].calls++;
+        functions[id].ns += duration;
+      }
+      else
+        printf("%12.6f %3llu %s(", start / 1e9, (unsigned long long)thread,
+               functions[id].name.c_str());
+      unsigned i = 0;
+      for (; i < count && readNumber(p, end, value); i++)
+        if (!summary)
+        {
+          printf(i > 0 ? ", " : "");
+          printValue(codes[i], value);
+        }
+      if (i < count || !readBytes(p, end, 1, byte) || !readNumber(p, end, value) ||
+          !readNumber(p, end, number))
+        break;
+      if (!summary)
+      {
+        printf(")");
+        if (*byte != 0)
+        {
+          printf(" = ");
+          printValue(*byte, value);
+        }
+        printf(" %.1f us", duration / 1e3);
+      }
+      for (i = 0; i < number; i++)
+      {
+        if (!readBytes(p, end, 1, byte) || !readNumber(p, end, length) ||
+            !readBytes(p, end, length, bytes))
+          break;
+        if (!summary)
+          printBuffer(*byte, bytes, length);
+      }
+      if (i < number)
+        break;
+      if (!summary)
+        printf("\n");
+    }
+    else if (type == RECORD_CALLBACK)
+    {
+      uint64_t callback, call;
+      if (!readNumber(p, end, thread) || !readNumber(p, end, start) ||
+          !readNumber(p, end, callback) || !readBytes(p, end, 1, byte) ||
+          !readNumber(p, end, call) || !readNumber(p, end, length) ||
+          !readBytes(p, end, length, bytes))
+        break;
+      callbacks++;
+      if (!summary)
+      {
+        printf("%12.6f %3llu callback %llu", start / 1e9, (unsigned long long)thread,
+               (unsigned long long)callback);
+        if (*byte & RECORD_CALL_RESULT)
+          printf(" call result 0x%llx%s", (unsigned long long)call,
+                 *byte & RECORD_IO_FAILURE ? " io failure" : "");
+        printBuffer(0, bytes, length);
+        printf("\n");
+      }
+    }
+    else
+      break;
+    complete = true;
+  }
+  if (!complete)
+    fprintf(stderr, "%s is cut off or damaged after offset %ld\n", argv[argc - 1],
+            (long)(p - &data[0]));
+  if (summary)
+  {
+    std::sort(functions.begin(), functions.end(),
+              [](const Function &a, const Function &b) { return a.ns > b.ns; });
+    printf("%12s %10s %10s  %s\n", "calls", "avg us", "total ms", "function");
+    for (size_t i = 0; i < functions.size() && functions[i].calls > 0; i++)
+      printf("%12llu %10.2f %10.2f  %s\n", (unsigned long long)functions[i].calls,
+             functions[i].ns / 1e3 / functions[i].calls, functions[i].ns / 1e6,
+             functions[i].name.c_str());
+    printf("%llu callbacks\n", (unsigned long long)callbacks);
+  }
+  return complete ? 0 : 1;
+}
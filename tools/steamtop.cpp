@@ -0,0 +1,123 @@
+// Live view of the forwarder profiler (STEAMFORWARDER_PROFILE=1).
+// Usage: steamtop [pid] [seconds between updates] [rows]
+#include <algorithm>
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include "profiler.h"
+
+struct Row
+{
+  uint32_t point;
+  uint64_t calls;
+  uint64_t ns;
+};
+
+// The newest segment if no pid is given
+static bool findSegment(char *name, size_t size)
+{
+  DIR *dir = opendir("/dev/shm");
+  if (dir == NULL)
+    return false;
+  time_t newest = 0;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL)
+  {
+    struct stat st;
+    char path[512];
+    if (strncmp(entry->d_name, "steamforwarder-", 15) != 0)
+      continue;
+    snprintf(path, sizeof(path), "/dev/shm/%s", entry->d_name);
+    if (stat(path, &st) == 0 && st.st_mtime >= newest)
+    {
+      newest = st.st_mtime;
+      snprintf(name, size, "/%s", entry->d_name);
+    }
+  }
+  closedir(dir);
+  return newest != 0;
+}
+
+static void sum(ProfileHeader *h, std::vector<Row> &rows)
+{
+  uint32_t points = std::min(h->usedPoints.load(std::memory_order_acquire), h->points);
+  uint32_t threads = std::min(h->usedThreads.load(std::memory_order_acquire), h->threads);
+  rows.assign(points, Row());
+  for (uint32_t p = 0; p < points; p++)
+    rows[p].point = p;
+  for (uint32_t t = 0; t < threads; t++)
+  {
+    ProfileCounter *row = profileRow(h, t);
+    for (uint32_t p = 1; p < points; p++)
+    {
+      rows[p].calls += row[p].calls.load(std::memory_order_relaxed);
+      rows[p].ns += row[p].ns.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  char name[300];
+  if (argc > 1)
+    snprintf(name, sizeof(name), "/steamforwarder-%s", argv[1]);
+  else if (!findSegment(name, sizeof(name)))
+  {
+    fprintf(stderr, "No /dev/shm/steamforwarder-* found, was the game started with STEAMFORWARDER_PROFILE=1?\n");
+    return 1;
+  }
+  double interval = argc > 2 ? atof(argv[2]) : 1.0;
+  unsigned lines = argc > 3 ? atoi(argv[3]) : 30;
+
+  int fd = shm_open(name, O_RDONLY, 0);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(ProfileHeader))
+  {
+    fprintf(stderr, "Cannot open /dev/shm%s\n", name);
+    return 1;
+  }
+  ProfileHeader *h = (ProfileHeader *)mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (h == MAP_FAILED || h->magic != PROFILE_MAGIC || h->layout != PROFILE_LAYOUT ||
+      profileSize(h->points, h->threads) > (size_t)st.st_size)
+  {
+    fprintf(stderr, "/dev/shm%s is not a profiler segment of this version\n", name);
+    return 1;
+  }
+
+  std::vector<Row> before, now, delta;
+  sum(h, before);
+  for (;;)
+  {
+    usleep((useconds_t)(interval * 1e6));
+    sum(h, now);
+    delta = now;
+    for (size_t i = 0; i < before.size(); i++)
+    {
+      delta[i].calls -= before[i].calls;
+      delta[i].ns -= before[i].ns;
+    }
+    std::sort(delta.begin(), delta.end(),
+              [](const Row &a, const Row &b) { return a.ns > b.ns; });
+    printf("\033[H\033[2J%s, %u functions called, %u threads\n\n", name + 1,
+           (unsigned)now.size() - 1, std::min(h->usedThreads.load(), h->threads));
+    printf("%10s %10s %10s %12s  %s\n", "calls/s", "avg us", "ms/s", "total calls", "function");
+    for (size_t i = 0; i < delta.size() && i < lines && delta[i].calls > 0; i++)
+    {
+      const Row &r = delta[i];
+      printf("%10.0f %10.2f %10.2f %12llu  %.*s\n", r.calls / interval,
+             r.ns / 1e3 / r.calls, r.ns / 1e6 / interval,
+             (unsigned long long)now[r.point].calls, PROFILE_NAME_SIZE,
+             profileName(h, r.point));
+    }
+    fflush(stdout);
+    before.swap(now);
+  }
+  return 0;
+}
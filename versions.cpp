@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <vector>
+#include "config.h"
+#include "versions.h"
+
+static uint32_t nextPow2(uint32_t n)
+{
+  uint32_t result = 1;
+  while (result < n)
+    result *= 2;
+  return result;
+}
+
+VersionTable buildVersionTable(const InterfaceVersion *versions, uint32_t count)
+{
+  std::vector<const InterfaceVersion *> keys;
+  for (uint32_t i = 0; i < count; i++)
+  {
+    bool known = false;
+    for (const InterfaceVersion *k: keys)
+      known = known || strcmp(k->version, versions[i].version) == 0;
+    if (!known)
+      keys.push_back(&versions[i]);
+  }
+  uint32_t size = nextPow2(keys.size() * 2), buckets = nextPow2(keys.size() / 2);
+  std::vector<uint64_t> hashes;
+  std::vector<std::vector<uint32_t> > members(buckets);
+  for (uint32_t k = 0; k < keys.size(); k++)
+  {
+    hashes.push_back(versionHash(keys[k]->version, strlen(keys[k]->version)));
+    members[hashes[k] & (buckets - 1)].push_back(k);
+  }
+  std::vector<uint32_t> order(buckets);
+  for (uint32_t b = 0; b < buckets; b++)
+    order[b] = b;
+  std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+    return members[a].size() > members[b].size();
+  });
+  // Lives as long as the dll
+  uint32_t *seeds = new uint32_t[buckets]();
+  InterfaceVersion *slots = new InterfaceVersion[size]();
+  for (uint32_t b: order)
+  {
+    for (uint32_t seed = 1; !members[b].empty(); seed++)
+    {
+      std::vector<uint32_t> taken;
+      for (uint32_t k: members[b])
+      {
+        uint32_t slot = versionSlot(hashes[k], seed) & (size - 1);
+        if (slots[slot].version != NULL || std::find(taken.begin(), taken.end(), slot) != taken.end())
+          break;
+        taken.push_back(slot);
+      }
+      if (taken.size() != members[b].size())
+        continue;
+      for (size_t i = 0; i < taken.size(); i++)
+        slots[taken[i]] = *keys[members[b][i]];
+      seeds[b] = seed;
+      break;
+    }
+  }
+  VersionTable table = {seeds, buckets, slots, size};
+  return table;
+}
+
+const VersionTable interfaceVersions = buildVersionTable(knownVersions, knownVersionCount);
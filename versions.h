@@ -0,0 +1,117 @@
+#ifndef STEAM_FORWARDER_VERSIONS
+#define STEAM_FORWARDER_VERSIONS
+#include <stdint.h>
+#include <string.h>
+#include "intern.h"
+
+// Every interface version string the codegen found, listed in
+// autoclass/versions.cpp and put in a perfect hash table when the dll loads
+// (versions.cpp): the bucket of a string gives the seed which moves it to
+// its own slot, so a lookup is one hash and one strcmp, whatever the number
+// of versions.
+
+// Wraps an internal interface of that version in the matching ISteam*_
+typedef void *(*InterfaceWrap)(void *internal, const char *version);
+
+struct InterfaceVersion
+{
+  const char *version;
+  // The interface without version, e.g. ISteamUser for SteamUser017
+  const char *type;
+  InterfaceWrap wrap;
+};
+
+struct VersionTable
+{
+  const uint32_t *seeds;
+  uint32_t buckets;
+  const InterfaceVersion *slots;
+  uint32_t size;
+};
+// The versions of the current headers by their STEAM*_INTERFACE_VERSION,
+// then the older ones given to the codegen with --versions
+extern const InterfaceVersion knownVersions[];
+extern const uint32_t knownVersionCount;
+// Built from knownVersions, see buildVersionTable()
+extern const VersionTable interfaceVersions;
+
+// Eight bytes at a time, the codegen hashes the same way (versions.nim)
+static inline uint64_t versionHash(const char *version, size_t length)
+{
+  uint64_t h = 0x9e3779b97f4a7c15ull ^ length;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8)
+  {
+    uint64_t chunk;
+    memcpy(&chunk, version + i, 8);
+    h = (h ^ chunk) * 0xff51afd7ed558ccdull;
+    h ^= h >> 32;
+  }
+  if (i < length)
+  {
+    uint64_t chunk = 0;
+    for (size_t shift = 0; i < length; i++, shift += 8)
+      chunk |= (uint64_t)(unsigned char)version[i] << shift;
+    h = (h ^ chunk) * 0xff51afd7ed558ccdull;
+    h ^= h >> 32;
+  }
+  return h;
+}
+
+static inline uint32_t versionSlot(uint64_t hash, uint32_t seed)
+{
+  return (uint32_t)(((hash ^ seed) * 0x9e3779b97f4a7c15ull) >> 32);
+}
+
+// Hash and displace: versions are grouped into buckets by the low bits of
+// their hash, then the largest bucket first gets the smallest seed that
+// moves all its versions into free slots. The first of duplicates wins.
+VersionTable buildVersionTable(const InterfaceVersion *versions, uint32_t count);
+
+// buckets and size are powers of two
+static inline const InterfaceVersion *findVersion(const VersionTable *table,
+                                                  const char *version)
+{
+  if (version == NULL)
+    return NULL;
+  uint64_t hash = versionHash(version, strlen(version));
+  uint32_t seed = table->seeds[hash & (table->buckets - 1)];
+  const InterfaceVersion *slot =
+    &table->slots[versionSlot(hash, seed) & (table->size - 1)];
+  if (slot->version == NULL || strcmp(slot->version, version) != 0)
+    return NULL;
+  return slot;
+}
+
+// Like internInterface(), but an older version than the headers know gets
+// the wrapper generated for its own vtable
+template <class W, class I>
+void *wrapVersion(const char *type, I *internal, const char *version)
+{
+  if (internal == NULL)
+    return NULL;
+  const InterfaceVersion *found = findVersion(&interfaceVersions, version);
+  if (found != NULL && strcmp(found->type, type) == 0)
+    return found->wrap(internal, version);
+  return internInterface<W, I>(type, internal, version);
+}
+
+// GetISteamGenericInterface() says nothing about the type of what it
+// returns, so the version string alone picks the wrapper. That covers every
+// interface of the headers the dll is built against and the older versions
+// given to the codegen; anything else, e.g. an interface newer than the
+// headers, is handed out unwrapped, as before.
+static inline void *wrapGenericInterface(void *internal, const char *version)
+{
+  if (internal == NULL)
+    return NULL;
+  const InterfaceVersion *found = findVersion(&interfaceVersions, version);
+  if (found == NULL)
+  {
+    WARN("No wrapper for interface version %s, returning it unwrapped\n",
+         version ? version : "(null)");
+    return internal;
+  }
+  return found->wrap(internal, version);
+}
+#endif